@@ -96,7 +96,8 @@ extern uint32_t SystemCoreClock;
 
 /* Hook function related definitions. */
 #define configUSE_IDLE_HOOK                     0
-#define configUSE_TICK_HOOK                     0
+/* Flags the CPU load samples, taken by the gfx task between frames */
+#define configUSE_TICK_HOOK                     configGENERATE_RUN_TIME_STATS
 #define configCHECK_FOR_STACK_OVERFLOW          2
 #define configUSE_MALLOC_FAILED_HOOK            1
 #define configUSE_DAEMON_TASK_STARTUP_HOOK      0
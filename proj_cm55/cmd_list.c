@@ -0,0 +1,163 @@
+/*******************************************************************************
+* File Name        : cmd_list.c
+*
+* Description      : This file contains the execution of the draw commands issued
+*                    by the scene graph.
+*
+* Related Document : See README.md
+*
+********************************************************************************
+* Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+
+#include "cmd_list.h"
+#include "gpu_profile.h"
+
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+static cmd_path_hook_t path_hook;
+static void *path_hook_data;
+
+/*******************************************************************************
+* Function Name: cmd_execute
+********************************************************************************
+* Summary:
+*  Issues the vg_lite call of one command. A draw rejected by the path hook
+*  is skipped and counts as successful.
+*
+* Parameters:
+*  cmd             - Command
+*  frame_target    - Render target replacing CMD_TARGET_FRAME
+*
+* Return:
+*  vg_lite_error_t - Result of the vg_lite call
+*
+*******************************************************************************/
+vg_lite_error_t cmd_execute(cmd_t *cmd, vg_lite_buffer_t *frame_target)
+{
+    vg_lite_buffer_t *target = (CMD_TARGET_FRAME == cmd->target) ? frame_target : cmd->target;
+    vg_lite_error_t error = VG_LITE_INVALID_ARGUMENT;
+
+    switch (cmd->op)
+    {
+        case CMD_OP_CLEAR:
+            error = GPU_PROFILE_CALL("vg_lite_clear",
+                                     vg_lite_clear(target, cmd->u.clear.full ? NULL : &cmd->u.clear.rect,
+                                                   cmd->color));
+            break;
+
+        case CMD_OP_DRAW:
+            if ((NULL != path_hook) &&
+                !path_hook(cmd->u.draw.path, &cmd->matrix, target, path_hook_data))
+            {
+                error = VG_LITE_SUCCESS;
+                break;
+            }
+            cmd->u.draw.path->quality = cmd->quality;
+            error = GPU_PROFILE_CALL("vg_lite_draw",
+                                     vg_lite_draw(target, cmd->u.draw.path, cmd->fill_rule,
+                                                  &cmd->matrix, cmd->blend, cmd->color));
+            break;
+
+        case CMD_OP_BLIT:
+            /* The level is chosen at execution from the scale of the matrix */
+            if (NULL != cmd->u.blit.pyramid)
+            {
+                error = image_pyramid_blit(cmd->u.blit.pyramid, target, &cmd->matrix,
+                                           cmd->blend, cmd->color, cmd->filter);
+                break;
+            }
+            error = GPU_PROFILE_CALL("vg_lite_blit",
+                                     vg_lite_blit(target, cmd->u.blit.source, &cmd->matrix,
+                                                  cmd->blend, cmd->color, cmd->filter));
+            break;
+
+        case CMD_OP_BLIT_RECT:
+            error = GPU_PROFILE_CALL("vg_lite_blit_rect",
+                                     vg_lite_blit_rect(target, cmd->u.blit.source, &cmd->u.blit.rect,
+                                                       &cmd->matrix, cmd->blend, cmd->color,
+                                                       cmd->filter));
+            break;
+
+        case CMD_OP_DRAW_PATTERN:
+            if ((NULL != path_hook) &&
+                !path_hook(cmd->u.pattern.path, &cmd->matrix, target, path_hook_data))
+            {
+                error = VG_LITE_SUCCESS;
+                break;
+            }
+            cmd->u.pattern.path->quality = cmd->quality;
+            error = GPU_PROFILE_CALL("vg_lite_draw_pattern",
+                                     vg_lite_draw_pattern(target, cmd->u.pattern.path, cmd->fill_rule,
+                                                          &cmd->matrix, cmd->u.pattern.image,
+                                                          &cmd->u.pattern.image_matrix, cmd->blend,
+                                                          cmd->u.pattern.mode,
+                                                          cmd->u.pattern.pattern_color,
+                                                          cmd->color, cmd->filter));
+            break;
+
+        case CMD_OP_TEXT:
+            error = text_run_draw(cmd->u.text.run, target, &cmd->matrix, cmd->color);
+            break;
+
+        default:
+            break;
+    }
+
+    return error;
+}
+
+/*******************************************************************************
+* Function Name: cmd_set_path_hook
+********************************************************************************
+* Summary:
+*  Registers a function called with the path of every draw command, e.g. to
+*  keep the path uploaded or to cull draws outside the target.
+*
+* Parameters:
+*  hook      - Function to be called, NULL to remove it
+*  user_data - Passed to the hook
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void cmd_set_path_hook(cmd_path_hook_t hook, void *user_data)
+{
+    path_hook      = hook;
+    path_hook_data = user_data;
+}
+
+/* [] END OF FILE */
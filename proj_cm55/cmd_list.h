@@ -0,0 +1,132 @@
+/*******************************************************************************
+* File Name        : cmd_list.h
+*
+* Description      : This file contains the declarations of the draw commands.
+*                    A command holds one vg_lite call of the scene graph with all
+*                    its arguments and is executed on the render target of the frame.
+*
+* Related Document : See README.md
+*
+********************************************************************************
+* Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+
+#ifndef CMD_LIST_H
+#define CMD_LIST_H
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include <stdint.h>
+#include <stdbool.h>
+#include "vg_lite.h"
+#include "image_pyramid.h"
+#include "text_engine.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+
+/* Target of commands drawing into the frame, resolved at execution */
+#define CMD_TARGET_FRAME                    (NULL)
+
+/*******************************************************************************
+* Data Structures and Types
+*******************************************************************************/
+
+typedef enum {
+    CMD_OP_CLEAR,               /* vg_lite_clear() */
+    CMD_OP_DRAW,                /* vg_lite_draw() */
+    CMD_OP_BLIT,                /* vg_lite_blit() */
+    CMD_OP_BLIT_RECT,           /* vg_lite_blit_rect() */
+    CMD_OP_DRAW_PATTERN,        /* vg_lite_draw_pattern() */
+    CMD_OP_TEXT                 /* vg_lite_blit_rect() per span of a run */
+} cmd_op_t;
+
+typedef struct {
+    cmd_op_t op;
+    vg_lite_buffer_t *target;   /* CMD_TARGET_FRAME or an offscreen buffer */
+    vg_lite_matrix_t matrix;
+    vg_lite_fill_t fill_rule;
+    vg_lite_blend_t blend;
+    vg_lite_filter_t filter;
+    vg_lite_color_t color;
+    vg_lite_quality_t quality;  /* Antialiasing of path draws */
+    union {
+        struct {
+            bool full;          /* Whole target, rect is ignored */
+            vg_lite_rectangle_t rect;
+        } clear;
+        struct {
+            vg_lite_path_t *path;
+        } draw;
+        struct {
+            vg_lite_buffer_t *source;
+            vg_lite_rectangle_t rect;   /* CMD_OP_BLIT_RECT only */
+            image_pyramid_t *pyramid;   /* CMD_OP_BLIT: levels of source, or NULL */
+        } blit;
+        struct {
+            vg_lite_path_t *path;
+            vg_lite_buffer_t *image;
+            vg_lite_matrix_t image_matrix;
+            vg_lite_pattern_mode_t mode;
+            vg_lite_color_t pattern_color;
+        } pattern;
+        struct {
+            const text_run_t *run;
+        } text;
+    } u;
+} cmd_t;
+
+/* Called with the path of every draw before the vg_lite call is issued,
+ * returns false to skip the draw */
+typedef bool (*cmd_path_hook_t)(vg_lite_path_t *path, const vg_lite_matrix_t *matrix,
+                                vg_lite_buffer_t *target, void *user_data);
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+vg_lite_error_t cmd_execute(cmd_t *cmd, vg_lite_buffer_t *frame_target);
+void cmd_set_path_hook(cmd_path_hook_t hook, void *user_data);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* CMD_LIST_H */
+
+/* [] END OF FILE */
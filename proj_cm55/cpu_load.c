@@ -0,0 +1,446 @@
+/*******************************************************************************
+* File Name        : cpu_load.c
+*
+* Description      : This file contains the CPU accounting: per task and per
+*                    interrupt shares of the CM55 over sliding windows.
+*
+* Related Document : See README.md
+*
+********************************************************************************
+* Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include <stdio.h>
+#include <string.h>
+#include "cpu_load.h"
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+static const char *const irq_names[CPU_LOAD_IRQ_COUNT] = {
+    "DC interrupt",
+    "GPU interrupt"
+};
+
+
+/*******************************************************************************
+* Function Name: share_permille
+********************************************************************************
+* Summary:
+*  Returns a part of an interval in 1/1000, at most all of it.
+*
+* Parameters:
+*  part     - Part of the interval
+*  whole    - Length of the interval
+*
+* Return:
+*  uint16_t - Share in 1/1000
+*
+*******************************************************************************/
+static uint16_t share_permille(uint64_t part, uint64_t whole)
+{
+    uint64_t permille;
+
+    if (0U == whole)
+    {
+        return 0U;
+    }
+    permille = (part * CPU_LOAD_PERMILLE) / whole;
+    return (uint16_t)((permille > CPU_LOAD_PERMILLE) ? CPU_LOAD_PERMILLE : permille);
+}
+
+
+/*******************************************************************************
+* Function Name: find_task
+********************************************************************************
+* Summary:
+*  Returns the slot of a task, registering it if it is new and a slot is
+*  free. A task created after the first sample starts from a run time of
+*  zero, which is what the unused slot holds.
+*
+* Parameters:
+*  load     - CPU accounting
+*  name     - Task name
+*
+* Return:
+*  uint8_t  - Slot of the task, CPU_LOAD_MAX_TASKS if all slots are in use
+*
+*******************************************************************************/
+static uint8_t find_task(cpu_load_t *load, const char *name)
+{
+    uint8_t task;
+
+    for (task = 0U; task < load->task_count; task++)
+    {
+        if (0 == strncmp(load->task_names[task], name, CPU_LOAD_NAME_LENGTH - 1U))
+        {
+            return task;
+        }
+    }
+    if (load->task_count >= CPU_LOAD_MAX_TASKS)
+    {
+        return CPU_LOAD_MAX_TASKS;
+    }
+    (void)strncpy(load->task_names[task], name, CPU_LOAD_NAME_LENGTH - 1U);
+    load->task_names[task][CPU_LOAD_NAME_LENGTH - 1U] = '\0';
+    load->task_count++;
+    return task;
+}
+
+
+/*******************************************************************************
+* Function Name: cpu_load_init
+********************************************************************************
+* Summary:
+*  Initializes the CPU accounting with no tasks and no samples.
+*
+* Parameters:
+*  load     - CPU accounting
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void cpu_load_init(cpu_load_t *load)
+{
+    memset(load, 0, sizeof(*load));
+    load->idle_task = CPU_LOAD_MAX_TASKS;
+}
+
+
+/*******************************************************************************
+* Function Name: cpu_load_add_irq
+********************************************************************************
+* Summary:
+*  Adds the cycles spent in an interrupt handler. Called at the end of the
+*  handler; handlers of the same interrupt must not nest.
+*
+* Parameters:
+*  load     - CPU accounting
+*  irq      - Interrupt
+*  cycles   - Cycles spent in the handler
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void cpu_load_add_irq(cpu_load_t *load, cpu_load_irq_t irq, uint32_t cycles)
+{
+    load->irq_cycles[irq] += cycles;
+}
+
+
+/*******************************************************************************
+* Function Name: cpu_load_begin
+********************************************************************************
+* Summary:
+*  Starts a sample. The counters of all tasks are added with
+*  cpu_load_add_task() and the sample is stored by cpu_load_end().
+*
+* Parameters:
+*  load     - CPU accounting
+*  time     - Run time counter the task counters are based on
+*  cycles   - Cycle counter the interrupt handlers are timed with
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void cpu_load_begin(cpu_load_t *load, uint32_t time, uint32_t cycles)
+{
+    load->time   = time;
+    load->cycles = cycles;
+    memset(load->task_seen, 0, sizeof(load->task_seen));
+}
+
+
+/*******************************************************************************
+* Function Name: cpu_load_add_task
+********************************************************************************
+* Summary:
+*  Adds the run time counter of a task to the sample being taken.
+*
+* Parameters:
+*  load     - CPU accounting
+*  name     - Task name, tasks are told apart by name
+*  run_time - Run time counter of the task
+*  idle     - The task is the idle task
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void cpu_load_add_task(cpu_load_t *load, const char *name, uint32_t run_time, bool idle)
+{
+    uint8_t task = find_task(load, name);
+
+    if (task < CPU_LOAD_MAX_TASKS)
+    {
+        load->task_time[task] = run_time;
+        load->task_seen[task] = true;
+        if (idle)
+        {
+            load->idle_task = task;
+        }
+    }
+}
+
+
+/*******************************************************************************
+* Function Name: cpu_load_end
+********************************************************************************
+* Summary:
+*  Stores the sample being taken. Each counter is extended by the unsigned
+*  difference to the previous sample, which is correct across one wrap, so
+*  samples must be taken more often than the counters wrap. The first
+*  sample is the start of the history. A task missing from a sample keeps
+*  its time, and counts from zero if it shows up again.
+*
+* Parameters:
+*  load     - CPU accounting
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void cpu_load_end(cpu_load_t *load)
+{
+    uint32_t count = load->sample_count;
+    cpu_load_sample_t *sample = &load->samples[count % CPU_LOAD_HISTORY];
+    const cpu_load_sample_t *last = &load->samples[(count + CPU_LOAD_HISTORY - 1U) %
+                                                   CPU_LOAD_HISTORY];
+    uint32_t irq_cycles;
+
+    if (0U == count)
+    {
+        memset(sample, 0, sizeof(*sample));
+    }
+    else
+    {
+        sample->time   = last->time + (uint32_t)(load->time - load->last_time);
+        sample->cycles = last->cycles + (uint32_t)(load->cycles - load->last_cycles);
+        for (uint8_t task = 0U; task < CPU_LOAD_MAX_TASKS; task++)
+        {
+            sample->task_time[task] = last->task_time[task];
+            if (load->task_seen[task])
+            {
+                sample->task_time[task] += (uint32_t)(load->task_time[task] -
+                                                      load->last_task_time[task]);
+            }
+        }
+        for (uint8_t irq = 0U; irq < (uint8_t)CPU_LOAD_IRQ_COUNT; irq++)
+        {
+            irq_cycles = load->irq_cycles[irq];
+            sample->irq_cycles[irq] = last->irq_cycles[irq] +
+                                      (uint32_t)(irq_cycles - load->last_irq_cycles[irq]);
+        }
+    }
+
+    for (uint8_t task = 0U; task < CPU_LOAD_MAX_TASKS; task++)
+    {
+        load->last_task_time[task] = load->task_seen[task] ? load->task_time[task] : 0U;
+    }
+    for (uint8_t irq = 0U; irq < (uint8_t)CPU_LOAD_IRQ_COUNT; irq++)
+    {
+        load->last_irq_cycles[irq] = load->irq_cycles[irq];
+    }
+    load->last_time   = load->time;
+    load->last_cycles = load->cycles;
+
+    /* Published last, the sample is complete once it is counted */
+    load->sample_count = count + 1U;
+}
+
+
+/*******************************************************************************
+* Function Name: cpu_load_get
+********************************************************************************
+* Summary:
+*  Returns the share of each task and interrupt handler over the last
+*  samples. Task shares are of the run time counter, interrupt shares of the
+*  cycle counter. Interrupt time is also part of the task it interrupted.
+*
+* Parameters:
+*  load     - CPU accounting
+*  samples  - Length of the window, shortened to the samples available
+*  report   - Shares over the window
+*
+* Return:
+*  bool     - false until two samples were taken
+*
+*******************************************************************************/
+bool cpu_load_get(const cpu_load_t *load, uint32_t samples, cpu_load_report_t *report)
+{
+    uint32_t count = load->sample_count;
+    const cpu_load_sample_t *newest;
+    const cpu_load_sample_t *oldest;
+    uint32_t busy = 0U;
+
+    memset(report, 0, sizeof(*report));
+    if (count < 2U)
+    {
+        return false;
+    }
+    if (samples > (count - 1U))
+    {
+        samples = count - 1U;
+    }
+    if (samples > CPU_LOAD_LONG_WINDOW)
+    {
+        samples = CPU_LOAD_LONG_WINDOW;
+    }
+    if (0U == samples)
+    {
+        samples = 1U;
+    }
+    newest = &load->samples[(count - 1U) % CPU_LOAD_HISTORY];
+    oldest = &load->samples[(count - 1U - samples) % CPU_LOAD_HISTORY];
+
+    report->samples    = samples;
+    report->task_count = load->task_count;
+    for (uint8_t task = 0U; task < load->task_count; task++)
+    {
+        report->task_permille[task] = share_permille(newest->task_time[task] -
+                                                     oldest->task_time[task],
+                                                     newest->time - oldest->time);
+        if (task != load->idle_task)
+        {
+            busy += report->task_permille[task];
+        }
+    }
+    for (uint8_t irq = 0U; irq < (uint8_t)CPU_LOAD_IRQ_COUNT; irq++)
+    {
+        report->irq_permille[irq] = share_permille(newest->irq_cycles[irq] -
+                                                   oldest->irq_cycles[irq],
+                                                   newest->cycles - oldest->cycles);
+    }
+
+    /* Time no task is charged with, e.g. before the scheduler starts, is
+     * busy as long as the idle task is known */
+    if (load->idle_task < CPU_LOAD_MAX_TASKS)
+    {
+        busy = CPU_LOAD_PERMILLE - report->task_permille[load->idle_task];
+    }
+    report->busy_permille = (uint16_t)((busy > CPU_LOAD_PERMILLE) ? CPU_LOAD_PERMILLE : busy);
+    return true;
+}
+
+
+/*******************************************************************************
+* Function Name: cpu_load_task_name
+********************************************************************************
+* Summary:
+*  Returns the name of a task slot.
+*
+* Parameters:
+*  load     - CPU accounting
+*  task     - Task slot
+*
+* Return:
+*  const char* - Task name, NULL for an unused slot
+*
+*******************************************************************************/
+const char *cpu_load_task_name(const cpu_load_t *load, uint8_t task)
+{
+    return (task < load->task_count) ? load->task_names[task] : NULL;
+}
+
+
+/*******************************************************************************
+* Function Name: cpu_load_print
+********************************************************************************
+* Summary:
+*  Prints the share of each task and interrupt handler over the short and
+*  the long window, in percent.
+*
+* Parameters:
+*  load     - CPU accounting
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void cpu_load_print(const cpu_load_t *load)
+{
+    cpu_load_report_t windows[2];
+    uint32_t window_ms;
+
+    if (!cpu_load_get(load, CPU_LOAD_SHORT_WINDOW, &windows[0]) ||
+        !cpu_load_get(load, CPU_LOAD_LONG_WINDOW, &windows[1]))
+    {
+        printf("\r\nCPU load: not sampled yet\r\n");
+        return;
+    }
+
+    printf("\r\n%-16s", "CPU load (%)");
+    for (uint8_t w = 0U; w < 2U; w++)
+    {
+        window_ms = windows[w].samples * CPU_LOAD_PERIOD_MS;
+        printf(" %5u.%u s", (unsigned int)(window_ms / 1000U),
+               (unsigned int)((window_ms % 1000U) / 100U));
+    }
+    printf("\r\n");
+
+    for (uint8_t task = 0U; task < windows[1].task_count; task++)
+    {
+        printf("%-16s", load->task_names[task]);
+        for (uint8_t w = 0U; w < 2U; w++)
+        {
+            printf(" %5u.%u %%", (unsigned int)(windows[w].task_permille[task] / 10U),
+                   (unsigned int)(windows[w].task_permille[task] % 10U));
+        }
+        printf("\r\n");
+    }
+    for (uint8_t irq = 0U; irq < (uint8_t)CPU_LOAD_IRQ_COUNT; irq++)
+    {
+        printf("%-16s", irq_names[irq]);
+        for (uint8_t w = 0U; w < 2U; w++)
+        {
+            printf(" %5u.%u %%", (unsigned int)(windows[w].irq_permille[irq] / 10U),
+                   (unsigned int)(windows[w].irq_permille[irq] % 10U));
+        }
+        printf("\r\n");
+    }
+    printf("%-16s", "Busy");
+    for (uint8_t w = 0U; w < 2U; w++)
+    {
+        printf(" %5u.%u %%", (unsigned int)(windows[w].busy_permille / 10U),
+               (unsigned int)(windows[w].busy_permille % 10U));
+    }
+    printf("\r\nInterrupt time is also part of the task it interrupted\r\n");
+}
+
+/* [] END OF FILE */
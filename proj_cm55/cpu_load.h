@@ -0,0 +1,150 @@
+/*******************************************************************************
+* File Name        : cpu_load.h
+*
+* Description      : This file contains the declarations of the CPU accounting.
+*                    Samples of the FreeRTOS run time counters of each task and
+*                    of the cycles spent in interrupt handlers are extended to 64
+*                    bits and kept in a short history, giving the share of each
+*                    over sliding windows.
+*
+* Related Document : See README.md
+*
+********************************************************************************
+* Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+
+#ifndef CPU_LOAD_H
+#define CPU_LOAD_H
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include <stdint.h>
+#include <stdbool.h>
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+
+/* Interval between two samples. It must be shorter than a wrap of the run
+ * time counter and of the cycle counter, about 10 s at 400 MHz.
+ * Can be overridden from the Makefile, e.g. DEFINES+=CPU_LOAD_PERIOD_MS=500U */
+#ifndef CPU_LOAD_PERIOD_MS
+#define CPU_LOAD_PERIOD_MS                  (1000U)
+#endif
+
+/* Windows reported, in samples */
+#define CPU_LOAD_SHORT_WINDOW               (1U)
+#define CPU_LOAD_LONG_WINDOW                (10U)
+
+/* One spare sample, so the oldest sample of a window is not overwritten
+ * while it is read */
+#define CPU_LOAD_HISTORY                    (CPU_LOAD_LONG_WINDOW + 2U)
+
+/* Tasks told apart, tasks created beyond it are not reported */
+#define CPU_LOAD_MAX_TASKS                  (8U)
+#define CPU_LOAD_NAME_LENGTH                (16U)
+
+#define CPU_LOAD_PERMILLE                   (1000U)
+
+/*******************************************************************************
+* Data Structures and Types
+*******************************************************************************/
+
+typedef enum {
+    CPU_LOAD_IRQ_DC,
+    CPU_LOAD_IRQ_GPU,
+    CPU_LOAD_IRQ_COUNT
+} cpu_load_irq_t;
+
+/* Counters extended to 64 bits, so two samples of a window are subtracted
+ * without regard to wraps */
+typedef struct {
+    uint64_t time;                              /* Run time counter */
+    uint64_t cycles;                            /* Cycle counter */
+    uint64_t task_time[CPU_LOAD_MAX_TASKS];     /* Run time of each task */
+    uint64_t irq_cycles[CPU_LOAD_IRQ_COUNT];    /* Cycles in each handler */
+} cpu_load_sample_t;
+
+typedef struct {
+    char task_names[CPU_LOAD_MAX_TASKS][CPU_LOAD_NAME_LENGTH];
+    uint8_t task_count;
+    uint8_t idle_task;          /* CPU_LOAD_MAX_TASKS until it is seen */
+    /* Summed by the interrupt handlers, wraps */
+    volatile uint32_t irq_cycles[CPU_LOAD_IRQ_COUNT];
+    /* Raw counters of the sample being taken and of the one before */
+    uint32_t time;
+    uint32_t cycles;
+    uint32_t task_time[CPU_LOAD_MAX_TASKS];
+    bool task_seen[CPU_LOAD_MAX_TASKS];
+    uint32_t last_time;
+    uint32_t last_cycles;
+    uint32_t last_task_time[CPU_LOAD_MAX_TASKS];
+    uint32_t last_irq_cycles[CPU_LOAD_IRQ_COUNT];
+    cpu_load_sample_t samples[CPU_LOAD_HISTORY];
+    /* Samples taken, the newest is at (sample_count - 1) % CPU_LOAD_HISTORY */
+    volatile uint32_t sample_count;
+} cpu_load_t;
+
+/* Shares over a window in 1/1000 */
+typedef struct {
+    uint32_t samples;           /* Length of the window */
+    uint8_t task_count;
+    uint16_t task_permille[CPU_LOAD_MAX_TASKS];
+    uint16_t irq_permille[CPU_LOAD_IRQ_COUNT];
+    uint16_t busy_permille;     /* All but the idle task */
+} cpu_load_report_t;
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+void cpu_load_init(cpu_load_t *load);
+void cpu_load_add_irq(cpu_load_t *load, cpu_load_irq_t irq, uint32_t cycles);
+void cpu_load_begin(cpu_load_t *load, uint32_t time, uint32_t cycles);
+void cpu_load_add_task(cpu_load_t *load, const char *name, uint32_t run_time, bool idle);
+void cpu_load_end(cpu_load_t *load);
+bool cpu_load_get(const cpu_load_t *load, uint32_t samples, cpu_load_report_t *report);
+const char *cpu_load_task_name(const cpu_load_t *load, uint8_t task);
+void cpu_load_print(const cpu_load_t *load);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* CPU_LOAD_H */
+
+/* [] END OF FILE */
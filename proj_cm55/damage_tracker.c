@@ -0,0 +1,648 @@
+/*******************************************************************************
+* File Name        : damage_tracker.c
+*
+* Description      : This file contains the damage rectangle tracker. It has no
+*                    dependency on the graphics driver so that the rectangle merging
+*                    can be built and checked on a host.
+*
+* Related Document : See README.md
+*
+********************************************************************************
+* Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+
+#include <string.h>
+#include <math.h>
+#include "damage_tracker.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+#define FNV_PRIME                           (16777619UL)
+
+/* Padding added around transformed bounds to cover antialiased edges */
+#define AA_PADDING                          (1)
+
+/*******************************************************************************
+* Function Name: rect_union
+********************************************************************************
+* Summary:
+*  Returns the bounding rectangle of two rectangles.
+*
+* Parameters:
+*  a, b          - Rectangles to combine
+*
+* Return:
+*  damage_rect_t - Smallest rectangle containing both
+*
+*******************************************************************************/
+static damage_rect_t rect_union(const damage_rect_t *a, const damage_rect_t *b)
+{
+    damage_rect_t out;
+
+    out.x0 = (a->x0 < b->x0) ? a->x0 : b->x0;
+    out.y0 = (a->y0 < b->y0) ? a->y0 : b->y0;
+    out.x1 = (a->x1 > b->x1) ? a->x1 : b->x1;
+    out.y1 = (a->y1 > b->y1) ? a->y1 : b->y1;
+
+    return out;
+}
+
+/*******************************************************************************
+* Function Name: rect_contains
+********************************************************************************
+* Summary:
+*  Checks whether rectangle a fully contains rectangle b.
+*
+* Parameters:
+*  a, b - Rectangles to compare
+*
+* Return:
+*  bool - true if b lies inside a
+*
+*******************************************************************************/
+static bool rect_contains(const damage_rect_t *a, const damage_rect_t *b)
+{
+    return ((a->x0 <= b->x0) && (a->y0 <= b->y0) &&
+            (a->x1 >= b->x1) && (a->y1 >= b->y1));
+}
+
+/*******************************************************************************
+* Function Name: region_remove
+********************************************************************************
+* Summary:
+*  Removes the rectangle at the given index from a region.
+*
+* Parameters:
+*  region - Pointer to the region
+*  index  - Index of the rectangle to remove
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void region_remove(damage_region_t *region, uint8_t index)
+{
+    region->count--;
+    region->rects[index] = region->rects[region->count];
+}
+
+/*******************************************************************************
+* Function Name: damage_rect_is_empty
+********************************************************************************
+* Summary:
+*  Checks whether a rectangle covers no pixels.
+*
+* Parameters:
+*  rect - Rectangle to check
+*
+* Return:
+*  bool - true if the rectangle is empty
+*
+*******************************************************************************/
+bool damage_rect_is_empty(const damage_rect_t *rect)
+{
+    return ((rect->x1 <= rect->x0) || (rect->y1 <= rect->y0));
+}
+
+/*******************************************************************************
+* Function Name: damage_rect_intersect
+********************************************************************************
+* Summary:
+*  Computes the intersection of two rectangles.
+*
+* Parameters:
+*  a, b - Rectangles to intersect
+*  out  - Intersection, may be NULL if only the test is needed
+*
+* Return:
+*  bool - true if the rectangles overlap
+*
+*******************************************************************************/
+bool damage_rect_intersect(const damage_rect_t *a, const damage_rect_t *b,
+                           damage_rect_t *out)
+{
+    damage_rect_t r;
+
+    r.x0 = (a->x0 > b->x0) ? a->x0 : b->x0;
+    r.y0 = (a->y0 > b->y0) ? a->y0 : b->y0;
+    r.x1 = (a->x1 < b->x1) ? a->x1 : b->x1;
+    r.y1 = (a->y1 < b->y1) ? a->y1 : b->y1;
+
+    if (NULL != out)
+    {
+        *out = r;
+    }
+
+    return !damage_rect_is_empty(&r);
+}
+
+/*******************************************************************************
+* Function Name: damage_rect_area
+********************************************************************************
+* Summary:
+*  Returns the number of pixels covered by a rectangle.
+*
+* Parameters:
+*  rect     - Rectangle
+*
+* Return:
+*  uint32_t - Area in pixels, 0 for an empty rectangle
+*
+*******************************************************************************/
+uint32_t damage_rect_area(const damage_rect_t *rect)
+{
+    return damage_rect_is_empty(rect) ? 0U :
+           (uint32_t)(rect->x1 - rect->x0) * (uint32_t)(rect->y1 - rect->y0);
+}
+
+/*******************************************************************************
+* Function Name: damage_rect_transform
+********************************************************************************
+* Summary:
+*  Transforms a rectangle through an affine 3x3 matrix (same layout as
+*  vg_lite_matrix_t) and returns the pixel aligned bounds of the result,
+*  padded for antialiasing.
+*
+* Parameters:
+*  matrix         - Transformation matrix
+*  x0, y0, x1, y1 - Rectangle in local coordinates
+*
+* Return:
+*  damage_rect_t  - Screen bounds of the transformed rectangle
+*
+*******************************************************************************/
+damage_rect_t damage_rect_transform(const float matrix[3][3],
+                                    int32_t x0, int32_t y0,
+                                    int32_t x1, int32_t y1)
+{
+    const float xs[4] = { (float)x0, (float)x1, (float)x1, (float)x0 };
+    const float ys[4] = { (float)y0, (float)y0, (float)y1, (float)y1 };
+    float min_x = 0.0f;
+    float min_y = 0.0f;
+    float max_x = 0.0f;
+    float max_y = 0.0f;
+    damage_rect_t out;
+
+    for (uint8_t i = 0; i < 4U; i++)
+    {
+        float x = (matrix[0][0] * xs[i]) + (matrix[0][1] * ys[i]) + matrix[0][2];
+        float y = (matrix[1][0] * xs[i]) + (matrix[1][1] * ys[i]) + matrix[1][2];
+
+        if ((0U == i) || (x < min_x)) { min_x = x; }
+        if ((0U == i) || (x > max_x)) { max_x = x; }
+        if ((0U == i) || (y < min_y)) { min_y = y; }
+        if ((0U == i) || (y > max_y)) { max_y = y; }
+    }
+
+    out.x0 = (int32_t)floorf(min_x) - AA_PADDING;
+    out.y0 = (int32_t)floorf(min_y) - AA_PADDING;
+    out.x1 = (int32_t)ceilf(max_x) + AA_PADDING;
+    out.y1 = (int32_t)ceilf(max_y) + AA_PADDING;
+
+    return out;
+}
+
+/*******************************************************************************
+* Function Name: damage_region_clear
+********************************************************************************
+* Summary:
+*  Empties a region.
+*
+* Parameters:
+*  region - Pointer to the region
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void damage_region_clear(damage_region_t *region)
+{
+    region->count = 0U;
+}
+
+/*******************************************************************************
+* Function Name: damage_region_add
+********************************************************************************
+* Summary:
+*  Adds a rectangle to a region. Rectangles already covered are dropped, and
+*  two rectangles are merged into their bounding box whenever that does not
+*  cost more pixels than drawing them separately. If the region is full, the
+*  new rectangle is merged with the one whose bounding box grows the least.
+*
+* Parameters:
+*  region - Pointer to the region
+*  rect   - Rectangle to add
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void damage_region_add(damage_region_t *region, const damage_rect_t *rect)
+{
+    damage_rect_t pending = *rect;
+    damage_rect_t merged;
+    uint32_t best_cost;
+    uint32_t cost;
+    uint8_t best;
+    bool again = true;
+
+    if (damage_rect_is_empty(&pending))
+    {
+        return;
+    }
+
+    /* Fold the new rectangle into existing ones until nothing changes */
+    while (again)
+    {
+        again = false;
+        for (uint8_t i = 0; i < region->count; i++)
+        {
+            if (rect_contains(&region->rects[i], &pending))
+            {
+                return;
+            }
+
+            merged = rect_union(&region->rects[i], &pending);
+            if (damage_rect_area(&merged) <=
+                (damage_rect_area(&region->rects[i]) + damage_rect_area(&pending)))
+            {
+                pending = merged;
+                region_remove(region, i);
+                again = true;
+                break;
+            }
+        }
+    }
+
+    if (region->count < DAMAGE_MAX_RECTS)
+    {
+        region->rects[region->count++] = pending;
+    }
+    else
+    {
+        best = 0U;
+        best_cost = UINT32_MAX;
+        for (uint8_t i = 0; i < region->count; i++)
+        {
+            merged = rect_union(&region->rects[i], &pending);
+            cost = damage_rect_area(&merged) - damage_rect_area(&region->rects[i]);
+            if (cost < best_cost)
+            {
+                best_cost = cost;
+                best = i;
+            }
+        }
+
+        merged = rect_union(&region->rects[best], &pending);
+        region_remove(region, best);
+
+        /* The grown rectangle may now absorb others */
+        damage_region_add(region, &merged);
+    }
+}
+
+/*******************************************************************************
+* Function Name: damage_region_area
+********************************************************************************
+* Summary:
+*  Returns the number of pixels covered by a region, counting overlaps once
+*  per rectangle.
+*
+* Parameters:
+*  region   - Pointer to the region
+*
+* Return:
+*  uint32_t - Sum of the rectangle areas
+*
+*******************************************************************************/
+uint32_t damage_region_area(const damage_region_t *region)
+{
+    uint32_t area = 0U;
+
+    for (uint8_t i = 0; i < region->count; i++)
+    {
+        area += damage_rect_area(&region->rects[i]);
+    }
+
+    return area;
+}
+
+/*******************************************************************************
+* Function Name: damage_hash
+********************************************************************************
+* Summary:
+*  FNV-1a hash, used to build item keys from draw arguments.
+*
+* Parameters:
+*  data     - Data to hash
+*  size     - Size of the data in bytes
+*  seed     - DAMAGE_HASH_SEED, or a previous result to chain several fields
+*
+* Return:
+*  uint32_t - Hash value
+*
+*******************************************************************************/
+uint32_t damage_hash(const void *data, size_t size, uint32_t seed)
+{
+    const uint8_t *bytes = (const uint8_t *)data;
+    uint32_t hash = seed;
+
+    for (size_t i = 0; i < size; i++)
+    {
+        hash ^= bytes[i];
+        hash *= FNV_PRIME;
+    }
+
+    return hash;
+}
+
+/*******************************************************************************
+* Function Name: damage_tracker_reset
+********************************************************************************
+* Summary:
+*  Resets the tracker. The next frame in every buffer is a full repaint.
+*
+* Parameters:
+*  tracker - Pointer to the tracker
+*  width   - Render target width
+*  height  - Render target height
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void damage_tracker_reset(damage_tracker_t *tracker, int32_t width,
+                          int32_t height)
+{
+    damage_stats_t stats = tracker->stats;
+
+    memset(tracker, 0, sizeof(*tracker));
+    tracker->width   = width;
+    tracker->height  = height;
+    tracker->invalid = true;
+    tracker->stats   = stats;
+}
+
+/*******************************************************************************
+* Function Name: damage_tracker_invalidate
+********************************************************************************
+* Summary:
+*  Forces a full screen repaint of the current frame, e.g. when something
+*  not covered by the items (background color) changed.
+*
+* Parameters:
+*  tracker - Pointer to the tracker
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void damage_tracker_invalidate(damage_tracker_t *tracker)
+{
+    tracker->invalid = true;
+}
+
+/*******************************************************************************
+* Function Name: damage_tracker_begin_frame
+********************************************************************************
+* Summary:
+*  Starts collecting the items of a new frame.
+*
+* Parameters:
+*  tracker - Pointer to the tracker
+*  slot    - Swap chain slot of the render target
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void damage_tracker_begin_frame(damage_tracker_t *tracker, uint8_t slot)
+{
+    tracker->slot = slot;
+    tracker->item_count[tracker->current] = 0U;
+    tracker->overflow = false;
+}
+
+/*******************************************************************************
+* Function Name: damage_tracker_add_item
+********************************************************************************
+* Summary:
+*  Reports one draw of the current frame.
+*
+* Parameters:
+*  tracker - Pointer to the tracker
+*  key     - Identity of the draw, see damage_hash()
+*  rect    - Screen bounds of the draw
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void damage_tracker_add_item(damage_tracker_t *tracker, uint32_t key,
+                             const damage_rect_t *rect)
+{
+    uint8_t *count = &tracker->item_count[tracker->current];
+
+    if (*count < DAMAGE_MAX_ITEMS)
+    {
+        tracker->items[tracker->current][*count].key  = key;
+        tracker->items[tracker->current][*count].rect = *rect;
+        (*count)++;
+    }
+    else
+    {
+        tracker->overflow = true;
+    }
+}
+
+/*******************************************************************************
+* Function Name: find_item
+********************************************************************************
+* Summary:
+*  Looks for an item with the same key and bounds in a list.
+*
+* Parameters:
+*  items - Item list
+*  count - Number of items in the list
+*  item  - Item to look for
+*
+* Return:
+*  bool  - true if found
+*
+*******************************************************************************/
+static bool find_item(const damage_item_t *items, uint8_t count,
+                      const damage_item_t *item)
+{
+    for (uint8_t i = 0; i < count; i++)
+    {
+        if ((items[i].key == item->key) &&
+            (0 == memcmp(&items[i].rect, &item->rect, sizeof(damage_rect_t))))
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+/*******************************************************************************
+* Function Name: damage_tracker_end_frame
+********************************************************************************
+* Summary:
+*  Compares the items of the current frame with the previous frame and
+*  returns the region of the render target that has to be cleared and
+*  redrawn. A buffer last rendered N frames ago needs the damage of the last
+*  N frames; buffers never rendered, or older than the history, are
+*  repainted in full.
+*
+* Parameters:
+*  tracker                 - Pointer to the tracker
+*
+* Return:
+*  const damage_region_t * - Repaint region, clipped to the render target
+*
+*******************************************************************************/
+const damage_region_t *damage_tracker_end_frame(damage_tracker_t *tracker)
+{
+    const damage_rect_t screen = { 0, 0, tracker->width, tracker->height };
+    const damage_item_t *cur  = tracker->items[tracker->current];
+    const damage_item_t *prev = tracker->items[tracker->current ^ 1U];
+    uint8_t cur_count  = tracker->item_count[tracker->current];
+    uint8_t prev_count = tracker->item_count[tracker->current ^ 1U];
+    damage_region_t *damage = &tracker->history[tracker->frame % DAMAGE_HISTORY];
+    damage_rect_t clipped;
+    uint32_t age;
+    uint32_t drawn;
+    uint8_t slot = tracker->slot;
+
+    damage_region_clear(damage);
+
+    if (tracker->invalid || tracker->overflow)
+    {
+        damage_region_add(damage, &screen);
+    }
+    else
+    {
+        for (uint8_t i = 0; i < cur_count; i++)
+        {
+            if ((!find_item(prev, prev_count, &cur[i])) &&
+                damage_rect_intersect(&cur[i].rect, &screen, &clipped))
+            {
+                damage_region_add(damage, &clipped);
+            }
+        }
+        for (uint8_t i = 0; i < prev_count; i++)
+        {
+            if ((!find_item(cur, cur_count, &prev[i])) &&
+                damage_rect_intersect(&prev[i].rect, &screen, &clipped))
+            {
+                damage_region_add(damage, &clipped);
+            }
+        }
+    }
+
+    damage_region_clear(&tracker->repaint);
+
+    if ((slot >= SWAP_CHAIN_MAX_DEPTH) || (!tracker->slot_valid[slot]))
+    {
+        damage_region_add(&tracker->repaint, &screen);
+    }
+    else
+    {
+        age = tracker->frame - tracker->slot_frame[slot];
+        if ((0U == age) || (age > DAMAGE_HISTORY))
+        {
+            damage_region_add(&tracker->repaint, &screen);
+        }
+        else
+        {
+            for (uint32_t i = 0; i < age; i++)
+            {
+                const damage_region_t *past =
+                    &tracker->history[(tracker->frame - i) % DAMAGE_HISTORY];
+
+                for (uint8_t r = 0; r < past->count; r++)
+                {
+                    damage_region_add(&tracker->repaint, &past->rects[r]);
+                }
+            }
+        }
+    }
+
+    if (slot < SWAP_CHAIN_MAX_DEPTH)
+    {
+        tracker->slot_frame[slot] = tracker->frame;
+        tracker->slot_valid[slot] = true;
+    }
+    tracker->frame++;
+    tracker->current ^= 1U;
+    tracker->invalid = false;
+
+    drawn = damage_region_area(&tracker->repaint);
+    tracker->stats.frames++;
+    tracker->stats.pixels_drawn += drawn;
+    if (drawn < damage_rect_area(&screen))
+    {
+        tracker->stats.pixels_saved += damage_rect_area(&screen) - drawn;
+    }
+
+    return &tracker->repaint;
+}
+
+/*******************************************************************************
+* Function Name: damage_tracker_get_stats
+********************************************************************************
+* Summary:
+*  Copies the damage statistics, optionally resetting the counters.
+*
+* Parameters:
+*  tracker - Pointer to the tracker
+*  stats   - Destination for the statistics
+*  reset   - true to clear the counters after reading them
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void damage_tracker_get_stats(damage_tracker_t *tracker,
+                              damage_stats_t *stats, bool reset)
+{
+    *stats = tracker->stats;
+    if (reset)
+    {
+        memset(&tracker->stats, 0, sizeof(tracker->stats));
+    }
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,154 @@
+/*******************************************************************************
+* File Name        : damage_tracker.h
+*
+* Description      : This file contains the declarations of the damage rectangle
+*                    tracker. Demos report the screen bounds of their draws every
+*                    frame; the tracker works out which regions of the current render
+*                    target are out of date, taking the swap chain buffer age into
+*                    account, so that only those regions are cleared and redrawn.
+*
+* Related Document : See README.md
+*
+********************************************************************************
+* Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+
+#ifndef DAMAGE_TRACKER_H
+#define DAMAGE_TRACKER_H
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include "swap_chain.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+#define DAMAGE_MAX_RECTS                    (4U)
+#define DAMAGE_MAX_ITEMS                    (16U)
+#define DAMAGE_HISTORY                      (SWAP_CHAIN_MAX_DEPTH)
+#define DAMAGE_HASH_SEED                    (0x811C9DC5UL)
+
+/*******************************************************************************
+* Data Structures and Types
+*******************************************************************************/
+
+/* Screen rectangle, x1 and y1 are exclusive */
+typedef struct {
+    int32_t x0;
+    int32_t y0;
+    int32_t x1;
+    int32_t y1;
+} damage_rect_t;
+
+typedef struct {
+    damage_rect_t rects[DAMAGE_MAX_RECTS];
+    uint8_t count;
+} damage_region_t;
+
+/* One draw of a frame, identified by a key covering everything that affects
+ * its pixels (asset, paint, transform) */
+typedef struct {
+    uint32_t key;
+    damage_rect_t rect;
+} damage_item_t;
+
+typedef struct {
+    uint32_t frames;            /* Frames tracked */
+    uint32_t pixels_drawn;      /* Pixels inside the repaint regions */
+    uint32_t pixels_saved;      /* Pixels a full screen redraw would add */
+} damage_stats_t;
+
+typedef struct {
+    int32_t width;
+    int32_t height;
+
+    /* Items of the current and the previous frame */
+    damage_item_t items[2][DAMAGE_MAX_ITEMS];
+    uint8_t item_count[2];
+    uint8_t current;
+    bool overflow;
+    bool invalid;
+
+    /* Damage of the last frames, indexed by frame number */
+    damage_region_t history[DAMAGE_HISTORY];
+    uint32_t frame;
+
+    /* Frame number last rendered into each swap chain slot */
+    uint32_t slot_frame[SWAP_CHAIN_MAX_DEPTH];
+    bool slot_valid[SWAP_CHAIN_MAX_DEPTH];
+    uint8_t slot;
+
+    damage_region_t repaint;
+    damage_stats_t stats;
+} damage_tracker_t;
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+bool damage_rect_is_empty(const damage_rect_t *rect);
+bool damage_rect_intersect(const damage_rect_t *a, const damage_rect_t *b,
+                           damage_rect_t *out);
+uint32_t damage_rect_area(const damage_rect_t *rect);
+damage_rect_t damage_rect_transform(const float matrix[3][3],
+                                    int32_t x0, int32_t y0,
+                                    int32_t x1, int32_t y1);
+void damage_region_clear(damage_region_t *region);
+void damage_region_add(damage_region_t *region, const damage_rect_t *rect);
+uint32_t damage_region_area(const damage_region_t *region);
+uint32_t damage_hash(const void *data, size_t size, uint32_t seed);
+
+void damage_tracker_reset(damage_tracker_t *tracker, int32_t width,
+                          int32_t height);
+void damage_tracker_invalidate(damage_tracker_t *tracker);
+void damage_tracker_begin_frame(damage_tracker_t *tracker, uint8_t slot);
+void damage_tracker_add_item(damage_tracker_t *tracker, uint32_t key,
+                             const damage_rect_t *rect);
+const damage_region_t *damage_tracker_end_frame(damage_tracker_t *tracker);
+void damage_tracker_get_stats(damage_tracker_t *tracker,
+                              damage_stats_t *stats, bool reset);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* DAMAGE_TRACKER_H */
+
+/* [] END OF FILE */
@@ -0,0 +1,285 @@
+/*******************************************************************************
+* File Name        : frame_pacer.c
+*
+* Description      : This file contains the vsync locked frame pacer. All timestamps
+*                    are passed in by the caller so the pacing algorithm can be run
+*                    against a simulated vsync source on a host build.
+*
+* Related Document : See README.md
+*
+********************************************************************************
+* Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+
+#include <string.h>
+#include "frame_pacer.h"
+#include "gfx_port.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+
+/* Refresh period estimate follows measured intervals with a 1/8 weight */
+#define PERIOD_FILTER_SHIFT                 (3U)
+
+/* Intervals further than 1/4 period from nominal are not used for the
+ * estimate (missed or spurious interrupts) */
+#define PERIOD_TOLERANCE_SHIFT              (2U)
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+static const char * const target_names[FRAME_PACER_TARGET_MAX] =
+{
+    [FRAME_PACER_UNLIMITED] = "unlimited",
+    [FRAME_PACER_NATIVE]    = "native",
+    [FRAME_PACER_HALF]      = "1/2",
+    [FRAME_PACER_THIRD]     = "1/3",
+};
+
+/*******************************************************************************
+* Function Name: frame_pacer_init
+********************************************************************************
+* Summary:
+*  Initializes the frame pacer.
+*
+* Parameters:
+*  pacer                 - Pointer to the frame pacer
+*  target                - Initial pacing target
+*  nominal_period_cycles - Expected refresh period of the panel
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void frame_pacer_init(frame_pacer_t *pacer, frame_pacer_target_t target,
+                      uint32_t nominal_period_cycles)
+{
+    memset(pacer, 0, sizeof(*pacer));
+    pacer->target                = target;
+    pacer->nominal_period_cycles = nominal_period_cycles;
+    pacer->period_cycles         = nominal_period_cycles;
+}
+
+/*******************************************************************************
+* Function Name: frame_pacer_set_target
+********************************************************************************
+* Summary:
+*  Selects a new pacing target. The deadline sequence restarts on the next
+*  completed frame.
+*
+* Parameters:
+*  pacer  - Pointer to the frame pacer
+*  target - New pacing target
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void frame_pacer_set_target(frame_pacer_t *pacer, frame_pacer_target_t target)
+{
+    if (target < FRAME_PACER_TARGET_MAX)
+    {
+        pacer->target = target;
+        pacer->synced = false;
+    }
+}
+
+/*******************************************************************************
+* Function Name: frame_pacer_on_vsync
+********************************************************************************
+* Summary:
+*  Records a display refresh. To be called from the DC interrupt. The refresh
+*  index advances by the number of periods elapsed since the previous call,
+*  so the pacer stays in step even if the DC does not interrupt on every
+*  refresh.
+*
+* Parameters:
+*  pacer      - Pointer to the frame pacer
+*  now_cycles - Timestamp of the refresh
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void frame_pacer_on_vsync(frame_pacer_t *pacer, uint32_t now_cycles)
+{
+    uint32_t delta;
+    uint32_t elapsed;
+    uint32_t period;
+    uint32_t tolerance;
+    uint32_t state = GFX_ENTER_CRITICAL();
+
+    if (pacer->have_vsync)
+    {
+        period    = pacer->period_cycles;
+        delta     = now_cycles - pacer->last_vsync_cycles;
+        elapsed   = (delta + (period / 2U)) / period;
+        tolerance = pacer->nominal_period_cycles >> PERIOD_TOLERANCE_SHIFT;
+
+        if ((delta + tolerance >= pacer->nominal_period_cycles) &&
+            (delta <= pacer->nominal_period_cycles + tolerance))
+        {
+            pacer->period_cycles = period - (period >> PERIOD_FILTER_SHIFT) +
+                                   (delta >> PERIOD_FILTER_SHIFT);
+        }
+
+        pacer->vsync_index += (elapsed > 0U) ? elapsed : 1U;
+    }
+    else
+    {
+        pacer->have_vsync = true;
+    }
+
+    pacer->last_vsync_cycles = now_cycles;
+
+    GFX_EXIT_CRITICAL(state);
+}
+
+/*******************************************************************************
+* Function Name: frame_pacer_frame_done
+********************************************************************************
+* Summary:
+*  Called by the render task after a frame has been submitted. Checks the
+*  frame against its refresh deadline and returns how long to wait before
+*  starting the next frame: the time left until the refresh that was this
+*  frame's deadline, so that the next frame gets the full target interval.
+*  A late frame counts as a missed deadline and the next frame starts right
+*  away.
+*
+* Parameters:
+*  pacer      - Pointer to the frame pacer
+*  now_cycles - Current timestamp
+*
+* Return:
+*  uint32_t   - Cycles to sleep, 0 to start the next frame immediately
+*
+*******************************************************************************/
+uint32_t frame_pacer_frame_done(frame_pacer_t *pacer, uint32_t now_cycles)
+{
+    uint32_t sleep_cycles = 0U;
+    uint32_t vsync_index;
+    uint32_t last_vsync;
+    uint32_t period;
+    uint32_t now_index;
+    uint32_t wake;
+    uint32_t interval = (uint32_t)pacer->target;
+    uint32_t state = GFX_ENTER_CRITICAL();
+
+    vsync_index = pacer->vsync_index;
+    last_vsync  = pacer->last_vsync_cycles;
+    period      = pacer->period_cycles;
+
+    GFX_EXIT_CRITICAL(state);
+
+    pacer->stats.frames++;
+
+    if ((FRAME_PACER_UNLIMITED == pacer->target) || (!pacer->have_vsync))
+    {
+        pacer->synced = false;
+    }
+    else
+    {
+        /* Refreshes since the last interrupt, if it was skipped */
+        now_index = vsync_index + ((now_cycles - last_vsync) / period);
+
+        if (!pacer->synced)
+        {
+            pacer->deadline_index = now_index + 1U;
+            pacer->synced = true;
+        }
+
+        if ((int32_t)(now_index - pacer->deadline_index) >= 0)
+        {
+            pacer->stats.missed_deadlines++;
+            pacer->deadline_index = now_index + interval;
+        }
+        else
+        {
+            wake = last_vsync +
+                   ((pacer->deadline_index - vsync_index) * period);
+            if ((int32_t)(wake - now_cycles) > 0)
+            {
+                sleep_cycles = wake - now_cycles;
+            }
+            pacer->deadline_index += interval;
+        }
+    }
+
+    return sleep_cycles;
+}
+
+/*******************************************************************************
+* Function Name: frame_pacer_get_stats
+********************************************************************************
+* Summary:
+*  Copies the frame pacer statistics, optionally resetting the counters.
+*
+* Parameters:
+*  pacer - Pointer to the frame pacer
+*  stats - Destination for the statistics
+*  reset - true to clear the counters after reading them
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void frame_pacer_get_stats(frame_pacer_t *pacer, frame_pacer_stats_t *stats,
+                           bool reset)
+{
+    *stats = pacer->stats;
+    if (reset)
+    {
+        memset(&pacer->stats, 0, sizeof(pacer->stats));
+    }
+}
+
+/*******************************************************************************
+* Function Name: frame_pacer_target_name
+********************************************************************************
+* Summary:
+*  Returns a printable name for a pacing target.
+*
+* Parameters:
+*  target       - Pacing target
+*
+* Return:
+*  const char * - Name of the target
+*
+*******************************************************************************/
+const char *frame_pacer_target_name(frame_pacer_target_t target)
+{
+    return (target < FRAME_PACER_TARGET_MAX) ? target_names[target] : "?";
+}
+
+/* [] END OF FILE */
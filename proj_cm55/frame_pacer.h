@@ -0,0 +1,111 @@
+/*******************************************************************************
+* File Name        : frame_pacer.h
+*
+* Description      : This file contains the declarations of the vsync locked frame
+*                    pacer. The pacer tracks display refresh timestamps from the DC
+*                    interrupt and tells the render task how long to sleep before it
+*                    starts the next frame.
+*
+* Related Document : See README.md
+*
+********************************************************************************
+* Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+
+#ifndef FRAME_PACER_H
+#define FRAME_PACER_H
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include <stdint.h>
+#include <stdbool.h>
+
+/*******************************************************************************
+* Data Structures and Types
+*******************************************************************************/
+
+/* Pacing target, the value is the number of refreshes per rendered frame */
+typedef enum {
+    FRAME_PACER_UNLIMITED,      /* Render as fast as the swap chain allows */
+    FRAME_PACER_NATIVE,         /* One frame per refresh */
+    FRAME_PACER_HALF,           /* One frame every second refresh */
+    FRAME_PACER_THIRD,          /* One frame every third refresh */
+    FRAME_PACER_TARGET_MAX
+} frame_pacer_target_t;
+
+typedef struct {
+    uint32_t frames;            /* Frames completed */
+    uint32_t missed_deadlines;  /* Frames completed after their refresh */
+} frame_pacer_stats_t;
+
+typedef struct {
+    volatile frame_pacer_target_t target;
+
+    /* Refresh timing, updated from the DC interrupt */
+    uint32_t nominal_period_cycles;
+    volatile uint32_t period_cycles;
+    volatile uint32_t last_vsync_cycles;
+    volatile uint32_t vsync_index;
+    volatile bool have_vsync;
+
+    /* Refresh index the frame being rendered must be ready for */
+    uint32_t deadline_index;
+    bool synced;
+
+    frame_pacer_stats_t stats;
+} frame_pacer_t;
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+void frame_pacer_init(frame_pacer_t *pacer, frame_pacer_target_t target,
+                      uint32_t nominal_period_cycles);
+void frame_pacer_set_target(frame_pacer_t *pacer, frame_pacer_target_t target);
+void frame_pacer_on_vsync(frame_pacer_t *pacer, uint32_t now_cycles);
+uint32_t frame_pacer_frame_done(frame_pacer_t *pacer, uint32_t now_cycles);
+void frame_pacer_get_stats(frame_pacer_t *pacer, frame_pacer_stats_t *stats,
+                           bool reset);
+const char *frame_pacer_target_name(frame_pacer_target_t target);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* FRAME_PACER_H */
+
+/* [] END OF FILE */
@@ -0,0 +1,495 @@
+/*******************************************************************************
+* File Name        : frame_stats.c
+*
+* Description      : This file contains the frame time statistics. Each frame duration
+*                    is recorded into a fixed size log-linear histogram of the current
+*                    demo and into one for the FPS line, without allocating memory.
+*                    Percentiles are read from the bucket counts.
+*
+* Related Document : See README.md
+*
+********************************************************************************
+* Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include <stdio.h>
+#include <string.h>
+#include "gfx_port.h"
+#include "frame_stats.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+#define PERMILLE                            (1000U)
+#define FRAME_STATS_P50                     (500U)
+#define FRAME_STATS_P95                     (950U)
+#define FRAME_STATS_P99                     (990U)
+
+
+/*******************************************************************************
+* Function Name: bucket_index
+********************************************************************************
+* Summary:
+*  Returns the bucket of a duration: the position of its highest set bit
+*  selects the octave, the FRAME_STATS_SUB_BITS bits below it the bucket.
+*
+* Parameters:
+*  us       - Duration in microseconds
+*
+* Return:
+*  uint32_t - Bucket index
+*
+*******************************************************************************/
+static uint32_t bucket_index(uint32_t us)
+{
+    uint32_t shift = 0U;
+
+    if (us >= (1UL << FRAME_STATS_RANGE_BITS))
+    {
+        return FRAME_STATS_BUCKETS - 1U;
+    }
+
+    while ((us >> shift) >= (2U * FRAME_STATS_SUB_COUNT))
+    {
+        shift++;
+    }
+
+    return (shift << FRAME_STATS_SUB_BITS) + (us >> shift);
+}
+
+/*******************************************************************************
+* Function Name: bucket_middle
+********************************************************************************
+* Summary:
+*  Returns the middle of the durations of a bucket.
+*
+* Parameters:
+*  index    - Bucket index
+*
+* Return:
+*  uint32_t - Duration in microseconds
+*
+*******************************************************************************/
+static uint32_t bucket_middle(uint32_t index)
+{
+    uint32_t shift = 0U;
+    uint32_t mantissa = index;
+
+    if (index >= (2U * FRAME_STATS_SUB_COUNT))
+    {
+        shift    = (index >> FRAME_STATS_SUB_BITS) - 1U;
+        mantissa = (index & (FRAME_STATS_SUB_COUNT - 1U)) + FRAME_STATS_SUB_COUNT;
+    }
+
+    return (mantissa << shift) + ((1UL << shift) >> 1);
+}
+
+/*******************************************************************************
+* Function Name: frame_histogram_reset
+********************************************************************************
+* Summary:
+*  Empties a histogram.
+*
+* Parameters:
+*  histogram - Histogram
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void frame_histogram_reset(frame_histogram_t *histogram)
+{
+    memset(histogram, 0, sizeof(*histogram));
+    histogram->min_us = UINT32_MAX;
+}
+
+/*******************************************************************************
+* Function Name: frame_histogram_add
+********************************************************************************
+* Summary:
+*  Records one frame duration.
+*
+* Parameters:
+*  histogram   - Histogram
+*  duration_us - Frame duration in microseconds
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void frame_histogram_add(frame_histogram_t *histogram, uint32_t duration_us)
+{
+    histogram->buckets[bucket_index(duration_us)]++;
+    histogram->frames++;
+    histogram->min_us = (duration_us < histogram->min_us) ? duration_us : histogram->min_us;
+    histogram->max_us = (duration_us > histogram->max_us) ? duration_us : histogram->max_us;
+}
+
+/*******************************************************************************
+* Function Name: frame_histogram_percentile
+********************************************************************************
+* Summary:
+*  Returns the duration not exceeded by the given share of the frames: the
+*  middle of the bucket holding that frame, kept within the shortest and
+*  longest recorded frame. Frames beyond the range report the longest one.
+*
+* Parameters:
+*  histogram - Histogram
+*  permille  - Share of the frames in 1/1000, e.g. 990 for the 99th percentile
+*
+* Return:
+*  uint32_t  - Duration in microseconds, 0 for an empty histogram
+*
+*******************************************************************************/
+uint32_t frame_histogram_percentile(const frame_histogram_t *histogram, uint32_t permille)
+{
+    /* Rank of the frame, rounded up so that p100 is the longest frame */
+    uint32_t rank = (uint32_t)((((uint64_t)histogram->frames * permille) + (PERMILLE - 1U)) /
+                               PERMILLE);
+    uint32_t seen = 0U;
+    uint32_t value;
+
+    if (0U == histogram->frames)
+    {
+        return 0U;
+    }
+    rank = (0U == rank) ? 1U : rank;
+
+    for (uint32_t i = 0; i < FRAME_STATS_BUCKETS; i++)
+    {
+        seen += histogram->buckets[i];
+        if (seen >= rank)
+        {
+            /* The last bucket is open ended */
+            value = ((FRAME_STATS_BUCKETS - 1U) == i) ? histogram->max_us : bucket_middle(i);
+            value = (value < histogram->min_us) ? histogram->min_us : value;
+            return (value > histogram->max_us) ? histogram->max_us : value;
+        }
+    }
+
+    return histogram->max_us;
+}
+
+/*******************************************************************************
+* Function Name: frame_histogram_report
+********************************************************************************
+* Summary:
+*  Computes the reported values of a histogram.
+*
+* Parameters:
+*  histogram - Histogram
+*  report    - Output values
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void frame_histogram_report(const frame_histogram_t *histogram, frame_stats_report_t *report)
+{
+    report->frames        = histogram->frames;
+    report->p50_us        = frame_histogram_percentile(histogram, FRAME_STATS_P50);
+    report->p95_us        = frame_histogram_percentile(histogram, FRAME_STATS_P95);
+    report->p99_us        = frame_histogram_percentile(histogram, FRAME_STATS_P99);
+    report->max_us        = histogram->max_us;
+    report->jitter_us     = (0U != histogram->jitter_count) ?
+                            (uint32_t)(histogram->jitter_sum_us / histogram->jitter_count) : 0U;
+    report->jitter_max_us = histogram->jitter_max_us;
+    report->missed_vsyncs = histogram->missed_vsyncs;
+}
+
+/*******************************************************************************
+* Function Name: record
+********************************************************************************
+* Summary:
+*  Records one frame with its jitter and missed refreshes.
+*
+* Parameters:
+*  histogram   - Histogram
+*  duration_us - Frame duration in microseconds
+*  have_jitter - true if jitter_us is valid
+*  jitter_us   - Difference to the previous frame duration
+*  missed      - Refreshes beyond the pacing target
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void record(frame_histogram_t *histogram, uint32_t duration_us, bool have_jitter,
+                   uint32_t jitter_us, uint32_t missed)
+{
+    frame_histogram_add(histogram, duration_us);
+    if (have_jitter)
+    {
+        histogram->jitter_sum_us += jitter_us;
+        histogram->jitter_count++;
+        histogram->jitter_max_us = (jitter_us > histogram->jitter_max_us) ?
+                                   jitter_us : histogram->jitter_max_us;
+    }
+    histogram->missed_vsyncs += missed;
+}
+
+/*******************************************************************************
+* Function Name: apply_reset
+********************************************************************************
+* Summary:
+*  Empties all histograms. The next frame starts a new interval.
+*
+* Parameters:
+*  stats  - Frame statistics
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void apply_reset(frame_stats_t *stats)
+{
+    for (uint8_t d = 0; d < FRAME_STATS_MAX_DEMOS; d++)
+    {
+        frame_histogram_reset(&stats->demos[d]);
+    }
+    frame_histogram_reset(&stats->window);
+    stats->have_start    = false;
+    stats->have_duration = false;
+    stats->reset_pending = false;
+}
+
+/*******************************************************************************
+* Function Name: frame_stats_init
+********************************************************************************
+* Summary:
+*  Initializes the frame statistics with empty histograms.
+*
+* Parameters:
+*  stats  - Frame statistics to be initialized
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void frame_stats_init(frame_stats_t *stats)
+{
+    stats->demo = 0U;
+    apply_reset(stats);
+}
+
+/*******************************************************************************
+* Function Name: frame_stats_set_demo
+********************************************************************************
+* Summary:
+*  Charges the following frames to a demo. The time until its first frame
+*  is not recorded.
+*
+* Parameters:
+*  stats  - Frame statistics
+*  demo   - Demo number
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void frame_stats_set_demo(frame_stats_t *stats, uint8_t demo)
+{
+    stats->demo          = (demo < FRAME_STATS_MAX_DEMOS) ? demo : (FRAME_STATS_MAX_DEMOS - 1U);
+    stats->have_start    = false;
+    stats->have_duration = false;
+}
+
+/*******************************************************************************
+* Function Name: frame_stats_frame
+********************************************************************************
+* Summary:
+*  Records the time since the previous frame. Refreshes are counted as
+*  missed when the frame spanned more of them than the pacing target, at
+*  least one per frame.
+*
+* Parameters:
+*  stats               - Frame statistics
+*  now_cycles          - Completion time of the frame
+*  refresh_cycles      - Display refresh period, 0 if unknown
+*  refreshes_per_frame - Pacing target, 0 for unlimited
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void frame_stats_frame(frame_stats_t *stats, uint32_t now_cycles, uint32_t refresh_cycles,
+                       uint32_t refreshes_per_frame)
+{
+    uint32_t elapsed = now_cycles - stats->last_cycles;
+    uint32_t duration_us = gfx_port_cycles_to_us(elapsed);
+    uint32_t jitter_us = 0U;
+    uint32_t missed = 0U;
+    uint32_t refreshes;
+
+    if (stats->reset_pending)
+    {
+        apply_reset(stats);
+    }
+    stats->last_cycles = now_cycles;
+    if (!stats->have_start)
+    {
+        stats->have_start = true;
+        return;
+    }
+
+    if (0U != refresh_cycles)
+    {
+        refreshes = (elapsed + (refresh_cycles / 2U)) / refresh_cycles;
+        refreshes_per_frame = (0U == refreshes_per_frame) ? 1U : refreshes_per_frame;
+        missed = (refreshes > refreshes_per_frame) ? (refreshes - refreshes_per_frame) : 0U;
+    }
+    if (stats->have_duration)
+    {
+        jitter_us = (duration_us > stats->last_us) ? (duration_us - stats->last_us) :
+                                                     (stats->last_us - duration_us);
+    }
+
+    record(&stats->demos[stats->demo], duration_us, stats->have_duration, jitter_us, missed);
+    record(&stats->window, duration_us, stats->have_duration, jitter_us, missed);
+    stats->last_us       = duration_us;
+    stats->have_duration = true;
+}
+
+/*******************************************************************************
+* Function Name: frame_stats_get_window
+********************************************************************************
+* Summary:
+*  Reports the frames since the window was last reset. Call from the render
+*  task.
+*
+* Parameters:
+*  stats  - Frame statistics
+*  report - Output values
+*  reset  - true to start a new window
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void frame_stats_get_window(frame_stats_t *stats, frame_stats_report_t *report, bool reset)
+{
+    frame_histogram_report(&stats->window, report);
+
+    if (reset)
+    {
+        frame_histogram_reset(&stats->window);
+    }
+}
+
+/*******************************************************************************
+* Function Name: frame_stats_get_demo
+********************************************************************************
+* Summary:
+*  Reports the frames of one demo since the last reset.
+*
+* Parameters:
+*  stats  - Frame statistics
+*  demo   - Demo number
+*  report - Output values
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void frame_stats_get_demo(frame_stats_t *stats, uint8_t demo, frame_stats_report_t *report)
+{
+    demo = (demo < FRAME_STATS_MAX_DEMOS) ? demo : (FRAME_STATS_MAX_DEMOS - 1U);
+    frame_histogram_report(&stats->demos[demo], report);
+}
+
+/*******************************************************************************
+* Function Name: frame_stats_reset
+********************************************************************************
+* Summary:
+*  Empties all histograms before the next frame. Safe to call from another
+*  task than the render task.
+*
+* Parameters:
+*  stats  - Frame statistics
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void frame_stats_reset(frame_stats_t *stats)
+{
+    stats->reset_pending = true;
+}
+
+/*******************************************************************************
+* Function Name: frame_stats_print
+********************************************************************************
+* Summary:
+*  Prints one line per demo with frames: frame count, percentiles, maximum,
+*  jitter and missed refreshes, in milliseconds. The values of a demo being
+*  rendered may be a frame apart.
+*
+* Parameters:
+*  stats  - Frame statistics
+*  names  - Name of each demo
+*  count  - Number of demos
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void frame_stats_print(frame_stats_t *stats, const char *const *names, uint8_t count)
+{
+    frame_stats_report_t report;
+
+    printf("\r\n%-16s %7s %8s %8s %8s %8s %15s %6s\r\n", "Frame time (ms)", "frames",
+           "p50", "p95", "p99", "max", "jitter avg/max", "missed");
+    for (uint8_t d = 0; (d < count) && (d < FRAME_STATS_MAX_DEMOS); d++)
+    {
+        frame_stats_get_demo(stats, d, &report);
+        if (0U == report.frames)
+        {
+            continue;
+        }
+        printf("%-16s %7u %4u.%03u %4u.%03u %4u.%03u %4u.%03u %3u.%03u/%3u.%03u %6u\r\n",
+               names[d], (unsigned int)report.frames,
+               (unsigned int)(report.p50_us / 1000U), (unsigned int)(report.p50_us % 1000U),
+               (unsigned int)(report.p95_us / 1000U), (unsigned int)(report.p95_us % 1000U),
+               (unsigned int)(report.p99_us / 1000U), (unsigned int)(report.p99_us % 1000U),
+               (unsigned int)(report.max_us / 1000U), (unsigned int)(report.max_us % 1000U),
+               (unsigned int)(report.jitter_us / 1000U), (unsigned int)(report.jitter_us % 1000U),
+               (unsigned int)(report.jitter_max_us / 1000U),
+               (unsigned int)(report.jitter_max_us % 1000U),
+               (unsigned int)report.missed_vsyncs);
+    }
+}
+
+/* [] END OF FILE */
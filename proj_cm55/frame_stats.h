@@ -0,0 +1,139 @@
+/*******************************************************************************
+* File Name        : frame_stats.h
+*
+* Description      : This file contains the declarations of the frame time statistics.
+*                    Each frame duration is recorded into a fixed size log-linear
+*                    histogram per demo, from which the median, 95th and 99th
+*                    percentile, the maximum, the frame to frame jitter and the missed
+*                    refreshes are reported.
+*
+* Related Document : See README.md
+*
+********************************************************************************
+* Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+
+#ifndef FRAME_STATS_H
+#define FRAME_STATS_H
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include <stdint.h>
+#include <stdbool.h>
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+
+/* Buckets per octave are 2^FRAME_STATS_SUB_BITS, so a reported value is
+ * within 1/32 of the recorded ones */
+#define FRAME_STATS_SUB_BITS                (4U)
+#define FRAME_STATS_SUB_COUNT               (1UL << FRAME_STATS_SUB_BITS)
+/* Longest frame told apart, longer frames share the last bucket */
+#define FRAME_STATS_RANGE_BITS              (20U)
+#define FRAME_STATS_BUCKETS                 (((FRAME_STATS_RANGE_BITS - FRAME_STATS_SUB_BITS) + 1U) * \
+                                             FRAME_STATS_SUB_COUNT)
+
+/* Histograms kept per demo, demo numbers above the last share it */
+#define FRAME_STATS_MAX_DEMOS               (6U)
+
+/*******************************************************************************
+* Data Structures and Types
+*******************************************************************************/
+
+/* Frame durations in microseconds. Buckets below 2 * FRAME_STATS_SUB_COUNT
+ * are one microsecond wide, each octave above is split in
+ * FRAME_STATS_SUB_COUNT buckets. */
+typedef struct {
+    uint32_t buckets[FRAME_STATS_BUCKETS];
+    uint32_t frames;
+    uint32_t min_us;
+    uint32_t max_us;
+    uint64_t jitter_sum_us;     /* Differences between consecutive frames */
+    uint32_t jitter_count;
+    uint32_t jitter_max_us;
+    uint32_t missed_vsyncs;     /* Refreshes beyond the pacing target */
+} frame_histogram_t;
+
+/* Values reported from a histogram, all in microseconds */
+typedef struct {
+    uint32_t frames;
+    uint32_t p50_us;
+    uint32_t p95_us;
+    uint32_t p99_us;
+    uint32_t max_us;
+    uint32_t jitter_us;         /* Mean difference between consecutive frames */
+    uint32_t jitter_max_us;
+    uint32_t missed_vsyncs;
+} frame_stats_report_t;
+
+typedef struct {
+    frame_histogram_t demos[FRAME_STATS_MAX_DEMOS];
+    frame_histogram_t window;   /* Since the last FPS line */
+    uint8_t demo;
+    bool have_start;            /* A frame of the current demo was seen */
+    bool have_duration;         /* Two frames of the current demo were seen */
+    uint32_t last_cycles;
+    uint32_t last_us;
+    volatile bool reset_pending; /* Set from the CLI task */
+} frame_stats_t;
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+void frame_histogram_reset(frame_histogram_t *histogram);
+void frame_histogram_add(frame_histogram_t *histogram, uint32_t duration_us);
+uint32_t frame_histogram_percentile(const frame_histogram_t *histogram, uint32_t permille);
+void frame_histogram_report(const frame_histogram_t *histogram, frame_stats_report_t *report);
+
+void frame_stats_init(frame_stats_t *stats);
+void frame_stats_set_demo(frame_stats_t *stats, uint8_t demo);
+void frame_stats_frame(frame_stats_t *stats, uint32_t now_cycles, uint32_t refresh_cycles,
+                       uint32_t refreshes_per_frame);
+void frame_stats_get_window(frame_stats_t *stats, frame_stats_report_t *report, bool reset);
+void frame_stats_get_demo(frame_stats_t *stats, uint8_t demo, frame_stats_report_t *report);
+void frame_stats_reset(frame_stats_t *stats);
+void frame_stats_print(frame_stats_t *stats, const char *const *names, uint8_t count);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* FRAME_STATS_H */
+
+/* [] END OF FILE */
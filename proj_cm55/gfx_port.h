@@ -0,0 +1,237 @@
+/*******************************************************************************
+* File Name        : gfx_port.h
+*
+* Description      : This file contains the small set of platform hooks used by the
+*                    graphics pipeline modules (critical sections and a free
+*                    running cycle counter for timestamps). Defining
+*                    GFX_HOST_BUILD maps them to no-ops so the pipeline state machines
+*                    can be compiled and exercised on a Linux host.
+*
+* Related Document : See README.md
+*
+********************************************************************************
+* Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+
+#ifndef GFX_PORT_H
+#define GFX_PORT_H
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include <stdint.h>
+#include <stdbool.h>
+
+#if defined(GFX_HOST_BUILD)
+#include <time.h>
+#else
+#include "cy_syslib.h"
+#endif
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+
+#if defined(GFX_HOST_BUILD)
+#define GFX_ENTER_CRITICAL()                (0U)
+#define GFX_EXIT_CRITICAL(state)            ((void)(state))
+#else
+/* Safe to use from both task and interrupt context */
+#define GFX_ENTER_CRITICAL()                Cy_SysLib_EnterCriticalSection()
+#define GFX_EXIT_CRITICAL(state)            Cy_SysLib_ExitCriticalSection(state)
+#endif
+
+#define GFX_US_PER_SEC                      (1000000UL)
+#define GFX_NS_PER_US                       (1000UL)
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+#if !defined(GFX_HOST_BUILD)
+/* Added to the DWT cycle counter, covers the time the CPU clock was gated */
+extern volatile uint32_t gfx_port_cycle_offset;
+#endif
+
+/*******************************************************************************
+* Functions
+*******************************************************************************/
+
+#if defined(GFX_HOST_BUILD)
+/* On the host one "cycle" is one nanosecond of CLOCK_MONOTONIC */
+static inline void gfx_port_init(void)
+{
+}
+
+#if defined(GFX_HOST_SIM_CLOCK)
+/* Host checks that simulate the display timing advance this clock */
+extern uint32_t gfx_port_sim_cycles;
+
+static inline uint32_t gfx_port_cycles(void)
+{
+    return gfx_port_sim_cycles;
+}
+#else
+static inline uint32_t gfx_port_cycles(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint32_t)(((uint64_t)ts.tv_sec * 1000000000ULL) + (uint64_t)ts.tv_nsec);
+}
+#endif
+
+static inline uint32_t gfx_port_cycles_to_us(uint32_t cycles)
+{
+    return cycles / 1000U;
+}
+
+static inline uint32_t gfx_port_cycles_to_ns(uint32_t cycles)
+{
+    return cycles;
+}
+#else
+/*******************************************************************************
+* Function Name: gfx_port_init
+********************************************************************************
+* Summary:
+*  Enables the DWT cycle counter used for graphics pipeline timestamps.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+__STATIC_INLINE void gfx_port_init(void)
+{
+    DCB->DEMCR |= DCB_DEMCR_TRCENA_Msk;
+    DWT->CYCCNT = 0U;
+    DWT->CTRL  |= DWT_CTRL_CYCCNTENA_Msk;
+}
+
+/*******************************************************************************
+* Function Name: gfx_port_cycles
+********************************************************************************
+* Summary:
+*  Returns the free running CPU cycle counter. Differences of two values are
+*  wrap safe as long as the interval is shorter than 2^32 cycles. The DWT
+*  counter stops while the CPU clock is gated, the time slept is added back
+*  with gfx_port_resume_cycles().
+*
+* Parameters:
+*  void
+*
+* Return:
+*  uint32_t - Current cycle count
+*
+*******************************************************************************/
+__STATIC_INLINE uint32_t gfx_port_cycles(void)
+{
+    return DWT->CYCCNT + gfx_port_cycle_offset;
+}
+
+/*******************************************************************************
+* Function Name: gfx_port_resume_cycles
+********************************************************************************
+* Summary:
+*  Continues the cycle count at the given value after the CPU woke up. Call
+*  it with interrupts disabled. The DWT counter is enabled again in case it
+*  was reset in Deep Sleep.
+*
+* Parameters:
+*  cycles   - Cycle count the counter continues from
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+__STATIC_INLINE void gfx_port_resume_cycles(uint32_t cycles)
+{
+    if (0U == (DWT->CTRL & DWT_CTRL_CYCCNTENA_Msk))
+    {
+        DCB->DEMCR |= DCB_DEMCR_TRCENA_Msk;
+        DWT->CTRL  |= DWT_CTRL_CYCCNTENA_Msk;
+    }
+    gfx_port_cycle_offset = cycles - DWT->CYCCNT;
+}
+
+/*******************************************************************************
+* Function Name: gfx_port_cycles_to_us
+********************************************************************************
+* Summary:
+*  Converts a cycle count interval into microseconds.
+*
+* Parameters:
+*  cycles   - Interval in CPU cycles
+*
+* Return:
+*  uint32_t - Interval in microseconds
+*
+*******************************************************************************/
+__STATIC_INLINE uint32_t gfx_port_cycles_to_us(uint32_t cycles)
+{
+    return cycles / (SystemCoreClock / GFX_US_PER_SEC);
+}
+
+/*******************************************************************************
+* Function Name: gfx_port_cycles_to_ns
+********************************************************************************
+* Summary:
+*  Converts a cycle count interval shorter than about four seconds into
+*  nanoseconds.
+*
+* Parameters:
+*  cycles   - Interval in CPU cycles
+*
+* Return:
+*  uint32_t - Interval in nanoseconds
+*
+*******************************************************************************/
+__STATIC_INLINE uint32_t gfx_port_cycles_to_ns(uint32_t cycles)
+{
+    return (uint32_t)(((uint64_t)cycles * GFX_NS_PER_US) / (SystemCoreClock / GFX_US_PER_SEC));
+}
+#endif /* defined(GFX_HOST_BUILD) */
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* GFX_PORT_H */
+
+/* [] END OF FILE */
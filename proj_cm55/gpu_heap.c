@@ -0,0 +1,585 @@
+/*******************************************************************************
+* File Name        : gpu_heap.c
+*
+* Description      : This file contains the VGLite heap accounting. The driver
+*                    allocates first fit from the heap given to vg_lite_init_mem(),
+*                    so the free blocks are the gaps between the tracked blocks.
+*
+* Related Document : See README.md
+*
+********************************************************************************
+* Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+
+#include <stdio.h>
+#include <string.h>
+#include "gpu_heap.h"
+#include "gfx_port.h"
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+static const char *const tag_names[GPU_HEAP_TAG_MAX] = {
+    "driver",
+    "frame_buffer",
+    "intermediate",
+    "path",
+    "other"
+};
+
+
+/*******************************************************************************
+* Function Name: insert_block
+********************************************************************************
+* Summary:
+*  Adds a block to the sorted list of live blocks. To be called in a critical
+*  section.
+*
+* Parameters:
+*  heap   - Pointer to the heap
+*  offset - Offset of the block in the heap
+*  bytes  - Size of the block
+*  tag    - Owner of the block
+*
+* Return:
+*  bool   - false if the list is full or the block overlaps a live one
+*
+*******************************************************************************/
+static bool insert_block(gpu_heap_t *heap, uint32_t offset, uint32_t bytes, gpu_heap_tag_t tag)
+{
+    uint8_t pos = 0U;
+
+    while ((pos < heap->count) && (heap->blocks[pos].offset < offset))
+    {
+        pos++;
+    }
+
+    if ((GPU_HEAP_MAX_BLOCKS == heap->count) ||
+        ((pos > 0U) &&
+         ((heap->blocks[pos - 1U].offset + heap->blocks[pos - 1U].bytes) > offset)) ||
+        ((pos < heap->count) && ((offset + bytes) > heap->blocks[pos].offset)))
+    {
+        return false;
+    }
+
+    memmove(&heap->blocks[pos + 1U], &heap->blocks[pos],
+            (heap->count - pos) * sizeof(heap->blocks[0]));
+    heap->blocks[pos].offset = offset;
+    heap->blocks[pos].bytes  = bytes;
+    heap->blocks[pos].tag    = tag;
+    heap->count++;
+
+    heap->used += bytes;
+    if (heap->used > heap->peak)
+    {
+        heap->peak = heap->used;
+    }
+
+    return true;
+}
+
+/*******************************************************************************
+* Function Name: compute_stats
+********************************************************************************
+* Summary:
+*  Derives the free space, the largest free block, the fragmentation and the
+*  use per tag from the live blocks.
+*
+* Parameters:
+*  heap  - Heap state
+*  stats - Output statistics
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void compute_stats(const gpu_heap_t *heap, gpu_heap_stats_t *stats)
+{
+    uint32_t start = 0U;
+    uint32_t end;
+
+    memset(stats, 0, sizeof(*stats));
+    stats->size       = heap->size;
+    stats->used_bytes = heap->used;
+    stats->peak_bytes = heap->peak;
+    stats->free_bytes = heap->size - heap->used;
+    stats->blocks     = heap->count;
+    stats->failures   = heap->failures;
+    stats->untracked  = heap->untracked;
+
+    for (uint32_t i = 0U; i <= heap->count; i++)
+    {
+        end = (i < heap->count) ? heap->blocks[i].offset : heap->size;
+        if ((end - start) > stats->largest_free)
+        {
+            stats->largest_free = end - start;
+        }
+
+        if (i < heap->count)
+        {
+            start = heap->blocks[i].offset + heap->blocks[i].bytes;
+            stats->tag_blocks[heap->blocks[i].tag]++;
+            stats->tag_bytes[heap->blocks[i].tag] += heap->blocks[i].bytes;
+        }
+    }
+
+    if (0U != stats->free_bytes)
+    {
+        stats->fragmentation = (uint32_t)(((uint64_t)(stats->free_bytes - stats->largest_free) *
+                                           100U) / stats->free_bytes);
+    }
+}
+
+/*******************************************************************************
+* Function Name: read_stats
+********************************************************************************
+* Summary:
+*  Computes the statistics in place with interrupts disabled, so the heap
+*  can be reported from another task than the one allocating without
+*  copying the block list onto the stack of the caller.
+*
+* Parameters:
+*  heap  - Pointer to the heap
+*  stats - Output statistics
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void read_stats(const gpu_heap_t *heap, gpu_heap_stats_t *stats)
+{
+    uint32_t state = GFX_ENTER_CRITICAL();
+
+    compute_stats(heap, stats);
+    GFX_EXIT_CRITICAL(state);
+}
+
+/*******************************************************************************
+* Function Name: read_block
+********************************************************************************
+* Summary:
+*  Copies one block of the heap with interrupts disabled.
+*
+* Parameters:
+*  heap  - Pointer to the heap
+*  index - Index of the block, by offset
+*  block - Output block
+*
+* Return:
+*  bool  - false if there is no block at that index
+*
+*******************************************************************************/
+static bool read_block(const gpu_heap_t *heap, uint8_t index, gpu_heap_block_t *block)
+{
+    bool found;
+    uint32_t state = GFX_ENTER_CRITICAL();
+
+    found = (index < heap->count);
+    if (found)
+    {
+        *block = heap->blocks[index];
+    }
+    GFX_EXIT_CRITICAL(state);
+
+    return found;
+}
+
+/*******************************************************************************
+* Function Name: gpu_heap_init
+********************************************************************************
+* Summary:
+*  Initializes the accounting of an empty heap.
+*
+* Parameters:
+*  heap - Pointer to the heap
+*  base - Heap given to vg_lite_init_mem()
+*  size - Size of the heap in bytes
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void gpu_heap_init(gpu_heap_t *heap, const void *base, uint32_t size)
+{
+    memset(heap, 0, sizeof(*heap));
+    heap->base = (const uint8_t *)base;
+    heap->size = size;
+}
+
+/*******************************************************************************
+* Function Name: gpu_heap_record
+********************************************************************************
+* Summary:
+*  Records an allocated block. The driver allocates its command and
+*  tessellation buffers in vg_lite_init(), before the application; whatever
+*  lies below the first recorded block is recorded as one driver block.
+*
+* Parameters:
+*  heap   - Pointer to the heap
+*  memory - CPU address of the block
+*  bytes  - Size of the block
+*  tag    - Owner of the block
+*
+* Return:
+*  bool   - false if the block is outside the heap or cannot be tracked
+*
+*******************************************************************************/
+bool gpu_heap_record(gpu_heap_t *heap, const void *memory, uint32_t bytes, gpu_heap_tag_t tag)
+{
+    const uint8_t *address = (const uint8_t *)memory;
+    uint32_t offset;
+    uint32_t state;
+    bool tracked;
+
+    if ((address < heap->base) || (bytes > heap->size) ||
+        ((uint32_t)(address - heap->base) > (heap->size - bytes)))
+    {
+        heap->untracked++;
+        return false;
+    }
+    offset = (uint32_t)(address - heap->base);
+
+    state = GFX_ENTER_CRITICAL();
+    if (!heap->driver_recorded)
+    {
+        heap->driver_recorded = true;
+        if ((0U == heap->count) && (0U != offset))
+        {
+            (void)insert_block(heap, 0U, offset, GPU_HEAP_TAG_DRIVER);
+        }
+    }
+    tracked = insert_block(heap, offset, bytes, tag);
+    if (!tracked)
+    {
+        heap->untracked++;
+    }
+    GFX_EXIT_CRITICAL(state);
+
+    return tracked;
+}
+
+/*******************************************************************************
+* Function Name: gpu_heap_forget
+********************************************************************************
+* Summary:
+*  Removes a freed block.
+*
+* Parameters:
+*  heap   - Pointer to the heap
+*  memory - CPU address of the block
+*
+* Return:
+*  bool   - false if the block was not tracked
+*
+*******************************************************************************/
+bool gpu_heap_forget(gpu_heap_t *heap, const void *memory)
+{
+    const uint8_t *address = (const uint8_t *)memory;
+    bool found = false;
+    uint32_t state = GFX_ENTER_CRITICAL();
+
+    for (uint8_t i = 0U; i < heap->count; i++)
+    {
+        if ((heap->base + heap->blocks[i].offset) == address)
+        {
+            heap->used -= heap->blocks[i].bytes;
+            heap->count--;
+            memmove(&heap->blocks[i], &heap->blocks[i + 1U],
+                    (heap->count - i) * sizeof(heap->blocks[0]));
+            found = true;
+            break;
+        }
+    }
+    GFX_EXIT_CRITICAL(state);
+
+    return found;
+}
+
+/*******************************************************************************
+* Function Name: gpu_heap_allocate
+********************************************************************************
+* Summary:
+*  Allocates a buffer with vg_lite_allocate() or vg_lite_allocate_with_align()
+*  and records its pixel data. A failure is reported with the largest free
+*  block.
+*
+* Parameters:
+*  heap   - Pointer to the heap, NULL to allocate without accounting
+*  buffer - Buffer with width, height and format set
+*  align  - Alignment of the pixel data, 0 for the driver default
+*  tag    - Owner of the buffer
+*
+* Return:
+*  vg_lite_error_t - Result of the allocation
+*
+*******************************************************************************/
+vg_lite_error_t gpu_heap_allocate(gpu_heap_t *heap, vg_lite_buffer_t *buffer, uint32_t align,
+                                  gpu_heap_tag_t tag)
+{
+    vg_lite_error_t error;
+    gpu_heap_stats_t stats;
+
+    error = (0U == align) ? vg_lite_allocate(buffer) : vg_lite_allocate_with_align(buffer, align);
+    if (NULL == heap)
+    {
+        return error;
+    }
+
+    if (VG_LITE_SUCCESS == error)
+    {
+        (void)gpu_heap_record(heap, buffer->memory,
+                              (uint32_t)buffer->stride * (uint32_t)buffer->height, tag);
+    }
+    else
+    {
+        heap->failures++;
+        gpu_heap_get_stats(heap, &stats, false);
+        printf("GPU heap: %s %dx%d allocation failed: %d, largest free block %u of %u bytes free\r\n",
+               gpu_heap_tag_name(tag), (int)buffer->width, (int)buffer->height, (int)error,
+               (unsigned int)stats.largest_free, (unsigned int)stats.free_bytes);
+    }
+
+    return error;
+}
+
+/*******************************************************************************
+* Function Name: gpu_heap_free
+********************************************************************************
+* Summary:
+*  Frees a buffer allocated with gpu_heap_allocate().
+*
+* Parameters:
+*  heap   - Pointer to the heap, NULL to free without accounting
+*  buffer - Allocated buffer
+*
+* Return:
+*  vg_lite_error_t - Result of vg_lite_free()
+*
+*******************************************************************************/
+vg_lite_error_t gpu_heap_free(gpu_heap_t *heap, vg_lite_buffer_t *buffer)
+{
+    if ((NULL != heap) && (NULL != buffer->memory))
+    {
+        (void)gpu_heap_forget(heap, buffer->memory);
+    }
+
+    return vg_lite_free(buffer);
+}
+
+/*******************************************************************************
+* Function Name: gpu_heap_upload_path
+********************************************************************************
+* Summary:
+*  Uploads a path with vg_lite_upload_path() and records the uploaded copy.
+*
+* Parameters:
+*  heap - Pointer to the heap, NULL to upload without accounting
+*  path - Path with data
+*
+* Return:
+*  vg_lite_error_t - Result of the upload
+*
+*******************************************************************************/
+vg_lite_error_t gpu_heap_upload_path(gpu_heap_t *heap, vg_lite_path_t *path)
+{
+    vg_lite_error_t error = vg_lite_upload_path(path);
+
+    if (NULL != heap)
+    {
+        if (VG_LITE_SUCCESS == error)
+        {
+            (void)gpu_heap_record(heap, path->uploaded.memory, path->uploaded.bytes,
+                                  GPU_HEAP_TAG_PATH);
+        }
+        else
+        {
+            heap->failures++;
+        }
+    }
+
+    return error;
+}
+
+/*******************************************************************************
+* Function Name: gpu_heap_clear_path
+********************************************************************************
+* Summary:
+*  Frees the uploaded copy of a path with vg_lite_clear_path(), which also
+*  drops the data pointer of the path.
+*
+* Parameters:
+*  heap - Pointer to the heap, NULL to clear without accounting
+*  path - Path
+*
+* Return:
+*  vg_lite_error_t - Result of vg_lite_clear_path()
+*
+*******************************************************************************/
+vg_lite_error_t gpu_heap_clear_path(gpu_heap_t *heap, vg_lite_path_t *path)
+{
+    if ((NULL != heap) && (NULL != path->uploaded.memory))
+    {
+        (void)gpu_heap_forget(heap, path->uploaded.memory);
+    }
+
+    return vg_lite_clear_path(path);
+}
+
+/*******************************************************************************
+* Function Name: gpu_heap_tag_name
+********************************************************************************
+* Summary:
+*  Returns the name of a tag as used in the reports.
+*
+* Parameters:
+*  tag - Tag
+*
+* Return:
+*  const char* - Name of the tag
+*
+*******************************************************************************/
+const char *gpu_heap_tag_name(gpu_heap_tag_t tag)
+{
+    return (tag < GPU_HEAP_TAG_MAX) ? tag_names[tag] : "invalid";
+}
+
+/*******************************************************************************
+* Function Name: gpu_heap_get_stats
+********************************************************************************
+* Summary:
+*  Returns the current use of the heap, optionally resetting the failure
+*  counters. The peak is kept since initialization.
+*
+* Parameters:
+*  heap  - Pointer to the heap
+*  stats - Output statistics
+*  reset - true to clear the failure counters after reading them
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void gpu_heap_get_stats(gpu_heap_t *heap, gpu_heap_stats_t *stats, bool reset)
+{
+    uint32_t state = GFX_ENTER_CRITICAL();
+
+    compute_stats(heap, stats);
+    if (reset)
+    {
+        heap->failures  = 0U;
+        heap->untracked = 0U;
+    }
+    GFX_EXIT_CRITICAL(state);
+}
+
+/*******************************************************************************
+* Function Name: gpu_heap_report
+********************************************************************************
+* Summary:
+*  Prints the use of the heap per tag, the largest free block and the margin
+*  left at the peak, for sizing VGLITE_HEAP_SIZE.
+*
+* Parameters:
+*  heap - Pointer to the heap
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void gpu_heap_report(gpu_heap_t *heap)
+{
+    gpu_heap_stats_t stats;
+
+    read_stats(heap, &stats);
+
+    printf("\r\nGPU heap: %u bytes, %u used (peak %u), %u free in %u blocks\r\n",
+           (unsigned int)stats.size, (unsigned int)stats.used_bytes,
+           (unsigned int)stats.peak_bytes, (unsigned int)stats.free_bytes,
+           (unsigned int)stats.blocks);
+    for (uint32_t tag = 0U; tag < GPU_HEAP_TAG_MAX; tag++)
+    {
+        printf("  %-12s: %3u blocks, %8u bytes\r\n", tag_names[tag],
+               (unsigned int)stats.tag_blocks[tag], (unsigned int)stats.tag_bytes[tag]);
+    }
+    printf("Largest free block: %u bytes, fragmentation %u%%\r\n",
+           (unsigned int)stats.largest_free, (unsigned int)stats.fragmentation);
+    printf("Unused at peak: %u bytes | Failures: %u | Untracked: %u\r\n",
+           (unsigned int)(stats.size - stats.peak_bytes), (unsigned int)stats.failures,
+           (unsigned int)stats.untracked);
+}
+
+/*******************************************************************************
+* Function Name: gpu_heap_dump
+********************************************************************************
+* Summary:
+*  Prints the heap statistics and every live block as one line of JSON, for
+*  capture by host scripts. The blocks are read one at a time, so a block
+*  allocated meanwhile may be listed without being part of the totals.
+*
+* Parameters:
+*  heap - Pointer to the heap
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void gpu_heap_dump(gpu_heap_t *heap)
+{
+    gpu_heap_block_t block;
+    gpu_heap_stats_t stats;
+
+    read_stats(heap, &stats);
+
+    printf("\r\n{\"gpu_heap\":{\"size\":%u,\"used\":%u,\"peak\":%u,\"free\":%u,"
+           "\"largest_free\":%u,\"fragmentation\":%u,\"failures\":%u,\"untracked\":%u,"
+           "\"tags\":{",
+           (unsigned int)stats.size, (unsigned int)stats.used_bytes,
+           (unsigned int)stats.peak_bytes, (unsigned int)stats.free_bytes,
+           (unsigned int)stats.largest_free, (unsigned int)stats.fragmentation,
+           (unsigned int)stats.failures, (unsigned int)stats.untracked);
+    for (uint32_t tag = 0U; tag < GPU_HEAP_TAG_MAX; tag++)
+    {
+        printf("%s\"%s\":{\"blocks\":%u,\"bytes\":%u}", (0U == tag) ? "" : ",", tag_names[tag],
+               (unsigned int)stats.tag_blocks[tag], (unsigned int)stats.tag_bytes[tag]);
+    }
+    printf("},\"blocks\":[");
+    for (uint8_t i = 0U; read_block(heap, i, &block); i++)
+    {
+        printf("%s{\"offset\":%u,\"bytes\":%u,\"tag\":\"%s\"}", (0U == i) ? "" : ",",
+               (unsigned int)block.offset, (unsigned int)block.bytes,
+               gpu_heap_tag_name(block.tag));
+    }
+    printf("]}}\r\n");
+}
+
+/* [] END OF FILE */
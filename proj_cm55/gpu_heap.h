@@ -0,0 +1,134 @@
+/*******************************************************************************
+* File Name        : gpu_heap.h
+*
+* Description      : This file contains the declarations of the VGLite heap
+*                    accounting. Buffer and path allocations are made through it so
+*                    the live blocks, their tags, the peak use, the largest free
+*                    block and the fragmentation of the contiguous heap can be
+*                    reported.
+*
+* Related Document : See README.md
+*
+********************************************************************************
+* Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+
+#ifndef GPU_HEAP_H
+#define GPU_HEAP_H
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include <stdint.h>
+#include <stdbool.h>
+#include "vg_lite.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+
+/* Number of live blocks that can be tracked */
+#define GPU_HEAP_MAX_BLOCKS                 (48U)
+
+/*******************************************************************************
+* Data Structures and Types
+*******************************************************************************/
+
+typedef enum {
+    GPU_HEAP_TAG_DRIVER,        /* Command and tessellation buffers of vg_lite_init() */
+    GPU_HEAP_TAG_FRAME_BUFFER,
+    GPU_HEAP_TAG_INTERMEDIATE,
+    GPU_HEAP_TAG_PATH,
+    GPU_HEAP_TAG_OTHER,
+    GPU_HEAP_TAG_MAX
+} gpu_heap_tag_t;
+
+typedef struct {
+    uint32_t offset;            /* From the start of the heap */
+    uint32_t bytes;
+    gpu_heap_tag_t tag;
+} gpu_heap_block_t;
+
+typedef struct {
+    uint32_t size;
+    uint32_t used_bytes;
+    uint32_t peak_bytes;        /* Since initialization, not reset */
+    uint32_t free_bytes;
+    uint32_t largest_free;      /* Largest allocation that can still succeed */
+    uint32_t fragmentation;     /* Percent of the free bytes outside the largest free block */
+    uint32_t blocks;
+    uint32_t failures;          /* Failed allocations and uploads */
+    uint32_t untracked;         /* Allocations that could not be tracked */
+    uint32_t tag_blocks[GPU_HEAP_TAG_MAX];
+    uint32_t tag_bytes[GPU_HEAP_TAG_MAX];
+} gpu_heap_stats_t;
+
+typedef struct {
+    const uint8_t *base;        /* Heap given to vg_lite_init_mem() */
+    uint32_t size;
+    gpu_heap_block_t blocks[GPU_HEAP_MAX_BLOCKS];   /* Sorted by offset */
+    uint8_t count;
+    bool driver_recorded;
+    uint32_t used;
+    uint32_t peak;
+    uint32_t failures;
+    uint32_t untracked;
+} gpu_heap_t;
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+void gpu_heap_init(gpu_heap_t *heap, const void *base, uint32_t size);
+bool gpu_heap_record(gpu_heap_t *heap, const void *memory, uint32_t bytes, gpu_heap_tag_t tag);
+bool gpu_heap_forget(gpu_heap_t *heap, const void *memory);
+vg_lite_error_t gpu_heap_allocate(gpu_heap_t *heap, vg_lite_buffer_t *buffer, uint32_t align,
+                                  gpu_heap_tag_t tag);
+vg_lite_error_t gpu_heap_free(gpu_heap_t *heap, vg_lite_buffer_t *buffer);
+vg_lite_error_t gpu_heap_upload_path(gpu_heap_t *heap, vg_lite_path_t *path);
+vg_lite_error_t gpu_heap_clear_path(gpu_heap_t *heap, vg_lite_path_t *path);
+const char *gpu_heap_tag_name(gpu_heap_tag_t tag);
+void gpu_heap_get_stats(gpu_heap_t *heap, gpu_heap_stats_t *stats, bool reset);
+void gpu_heap_report(gpu_heap_t *heap);
+void gpu_heap_dump(gpu_heap_t *heap);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* GPU_HEAP_H */
+
+/* [] END OF FILE */
@@ -0,0 +1,185 @@
+/*******************************************************************************
+* File Name        : gpu_mem_plan.c
+*
+* Description      : This file prints the planned memory map of the VGLite heap
+*                    and compares it with the blocks actually allocated.
+*
+* Related Document : See README.md
+*
+********************************************************************************
+* Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+
+#include <stdio.h>
+#include "gpu_mem_plan.h"
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+
+/* Planned bytes of each heap tag */
+static const uint32_t planned_bytes[GPU_HEAP_TAG_MAX] = {
+    [GPU_HEAP_TAG_DRIVER]       = GPU_PLAN_CMD_BYTES + GPU_PLAN_TESS_BYTES,
+    [GPU_HEAP_TAG_FRAME_BUFFER] = GPU_PLAN_FRAME_BYTES * APP_BUFFER_COUNT,
+    [GPU_HEAP_TAG_INTERMEDIATE] = GPU_PLAN_INTERMEDIATE_BYTES,
+    [GPU_HEAP_TAG_PATH]         = GPU_PLAN_PATH_BYTES,
+    [GPU_HEAP_TAG_OTHER]        = 0U
+};
+
+
+/*******************************************************************************
+* Function Name: print_region
+********************************************************************************
+* Summary:
+*  Prints one line of the memory map.
+*
+* Parameters:
+*  offset - Offset of the region in the heap
+*  bytes  - Size of the region
+*  name   - Description of the region
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void print_region(uint32_t offset, uint32_t bytes, const char *name)
+{
+    printf("  0x%06X %8u  %s\r\n", (unsigned int)offset, (unsigned int)bytes, name);
+}
+
+/*******************************************************************************
+* Function Name: gpu_mem_plan_print
+********************************************************************************
+* Summary:
+*  Prints the planned layout of the VGLite heap and, if the heap accounting is
+*  given, the bytes allocated per tag against the plan.
+*
+* Parameters:
+*  heap - Pointer to the heap accounting, NULL to print the plan only
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void gpu_mem_plan_print(gpu_heap_t *heap)
+{
+    gpu_heap_stats_t stats;
+    char name[56];
+
+    printf("\r\nVGLite heap plan: %u bytes, budget %u bytes (%u spare)\r\n",
+           (unsigned int)VGLITE_HEAP_SIZE, (unsigned int)GPU_MEM_BUDGET_BYTES,
+           (unsigned int)(GPU_MEM_BUDGET_BYTES - VGLITE_HEAP_SIZE));
+    printf("  offset      bytes  region\r\n");
+
+    (void)snprintf(name, sizeof(name), "command buffers (%u x %u)",
+                   (unsigned int)GPU_CMD_BUFFER_COUNT, (unsigned int)GPU_CMD_BUFFER_SIZE);
+    print_region(GPU_PLAN_CMD_OFFSET, GPU_PLAN_CMD_BYTES, name);
+    (void)snprintf(name, sizeof(name), "tessellation buffer (%u lines)",
+                   (unsigned int)GPU_TESSELLATION_HEIGHT);
+    print_region(GPU_PLAN_TESS_OFFSET, GPU_PLAN_TESS_BYTES, name);
+    for (uint32_t i = 0U; i < APP_BUFFER_COUNT; i++)
+    {
+        (void)snprintf(name, sizeof(name), "frame buffer %u (%ux%u %s, stride %u)",
+                       (unsigned int)i, (unsigned int)DISP_W_ACTUAL, (unsigned int)DISP_H,
+                       FRAME_BUFFER_FORMAT_NAME, (unsigned int)GPU_PLAN_FRAME_STRIDE);
+        print_region(GPU_PLAN_FRAME_OFFSET + (i * GPU_PLAN_FRAME_BYTES),
+                     GPU_PLAN_FRAME_BYTES, name);
+    }
+    (void)snprintf(name, sizeof(name), "intermediate target (%ux%u, stride %u)",
+                   (unsigned int)INTERMEDIATE_WIDTH, (unsigned int)INTERMEDIATE_HEIGHT,
+                   (unsigned int)GPU_PLAN_INTERMEDIATE_STRIDE);
+    print_region(GPU_PLAN_INTERMEDIATE_OFFSET, GPU_PLAN_INTERMEDIATE_BYTES, name);
+    print_region(GPU_PLAN_PATH_OFFSET, GPU_PLAN_PATH_BYTES, "path uploads");
+    print_region(GPU_PLAN_MARGIN_OFFSET, VGLITE_HEAP_SIZE - GPU_PLAN_MARGIN_OFFSET, "margin");
+
+    if (NULL == heap)
+    {
+        return;
+    }
+
+    gpu_heap_get_stats(heap, &stats, false);
+    printf("Allocated against the plan:\r\n");
+    for (uint32_t tag = 0U; tag < GPU_HEAP_TAG_MAX; tag++)
+    {
+        printf("  %-12s: %8u of %8u bytes%s\r\n", gpu_heap_tag_name((gpu_heap_tag_t)tag),
+               (unsigned int)stats.tag_bytes[tag], (unsigned int)planned_bytes[tag],
+               (stats.tag_bytes[tag] > planned_bytes[tag]) ? " OVER PLAN" : "");
+    }
+}
+
+/*******************************************************************************
+* Function Name: gpu_mem_plan_verify
+********************************************************************************
+* Summary:
+*  Checks the bytes the driver and the application allocated per tag against
+*  the plan. The driver tag is the space below the first recorded block, so
+*  it holds what vg_lite_init() really took. Allocations larger than planned
+*  are printed; together they must fit in GPU_PLAN_MARGIN_BYTES, otherwise
+*  later allocations may fail at run time.
+*
+* Parameters:
+*  heap - Pointer to the heap accounting, after the start-up allocations
+*
+* Return:
+*  bool - true if the allocations fit in the plan and its margin
+*
+*******************************************************************************/
+bool gpu_mem_plan_verify(gpu_heap_t *heap)
+{
+    gpu_heap_stats_t stats;
+    uint32_t over = 0U;
+
+    gpu_heap_get_stats(heap, &stats, false);
+    for (uint32_t tag = 0U; tag < GPU_HEAP_TAG_MAX; tag++)
+    {
+        if (stats.tag_bytes[tag] > planned_bytes[tag])
+        {
+            printf("Warning: %s allocations exceed the heap plan by %u bytes\r\n",
+                   gpu_heap_tag_name((gpu_heap_tag_t)tag),
+                   (unsigned int)(stats.tag_bytes[tag] - planned_bytes[tag]));
+            over += stats.tag_bytes[tag] - planned_bytes[tag];
+        }
+    }
+
+    if (over > GPU_PLAN_MARGIN_BYTES)
+    {
+        printf("Error: allocations exceed the heap plan by %u bytes, more than the margin of "
+               "%u bytes. Raise GPU_PLAN_MARGIN_BYTES or fix the plan in gpu_mem_plan.h\r\n",
+               (unsigned int)over, (unsigned int)GPU_PLAN_MARGIN_BYTES);
+        return false;
+    }
+
+    return true;
+}
+
+/* [] END OF FILE */
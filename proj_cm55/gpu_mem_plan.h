@@ -0,0 +1,208 @@
+/*******************************************************************************
+* File Name        : gpu_mem_plan.h
+*
+* Description      : This file contains the plan of the VGLite heap. The size and
+*                    offset of every buffer (driver command and tessellation buffers,
+*                    swap chain frame buffers, intermediate target and path uploads)
+*                    are computed at compile time from the display geometry, the
+*                    buffer counts and the formats; the build fails if the heap
+*                    exceeds GPU_MEM_BUDGET_BYTES.
+*
+* Related Document : See README.md
+*
+********************************************************************************
+* Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+
+#ifndef GPU_MEM_PLAN_H
+#define GPU_MEM_PLAN_H
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include <stdint.h>
+#include "swap_chain.h"
+#include "tess_probe.h"
+#include "path_cache.h"
+#include "gpu_heap.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+
+#define DISP_H                              (480U)
+#define DISP_W                              (832U)
+#define DISP_W_ACTUAL                       (800U)
+
+/* Frame buffer formats. Selected from the Makefile, e.g.
+ * DEFINES+=FRAME_FORMAT=FRAME_FORMAT_ARGB8888 */
+#define FRAME_FORMAT_BGR565                 (0U)
+#define FRAME_FORMAT_ARGB8888               (1U)
+
+#ifndef FRAME_FORMAT
+#define FRAME_FORMAT                        (FRAME_FORMAT_BGR565)
+#endif
+
+#if (FRAME_FORMAT == FRAME_FORMAT_BGR565)
+#define FRAME_BUFFER_FORMAT                 (VG_LITE_BGR565)
+#define FRAME_BUFFER_BPP                    (16U)
+#define FRAME_BUFFER_FORMAT_NAME            ("BGR565")
+#elif (FRAME_FORMAT == FRAME_FORMAT_ARGB8888)
+#define FRAME_BUFFER_FORMAT                 (VG_LITE_ARGB8888)
+#define FRAME_BUFFER_BPP                    (32U)
+#define FRAME_BUFFER_FORMAT_NAME            ("ARGB8888")
+#else
+#error "FRAME_FORMAT must be FRAME_FORMAT_BGR565 or FRAME_FORMAT_ARGB8888"
+#endif
+
+/* Number of frame buffers in the swap chain. ARGB8888 buffers take twice
+ * the memory, so that format double buffers by default. Can be overridden
+ * from the Makefile, e.g. DEFINES+=APP_BUFFER_COUNT=2U */
+#ifndef APP_BUFFER_COUNT
+#if (FRAME_FORMAT == FRAME_FORMAT_ARGB8888)
+#define APP_BUFFER_COUNT                    (2U)
+#else
+#define APP_BUFFER_COUNT                    (3U)
+#endif
+#endif
+
+#if (APP_BUFFER_COUNT < SWAP_CHAIN_MIN_DEPTH) || \
+    (APP_BUFFER_COUNT > SWAP_CHAIN_MAX_DEPTH)
+#error "APP_BUFFER_COUNT must be between SWAP_CHAIN_MIN_DEPTH and SWAP_CHAIN_MAX_DEPTH"
+#endif
+
+/* Intermediate render target of the alpha behavior and blit color demos: half the
+ * screen, BGR565 */
+#define INTERMEDIATE_WIDTH                  (DISP_W / 2U)
+#define INTERMEDIATE_HEIGHT                 (DISP_H / 2U)
+#define INTERMEDIATE_FORMAT                 (VG_LITE_BGR565)
+#define INTERMEDIATE_BPP                    (16U)
+
+/* Command buffers of the driver, set with vg_lite_set_command_buffer_size().
+ * The driver fills one while the GPU executes the other. */
+#define GPU_CMD_BUFFER_SIZE                 ((64U) * (1024U))
+#define GPU_CMD_BUFFER_COUNT                (2U)
+
+/* Height of the GPU tessellation window in lines. Draws taller than it are
+ * tessellated in several passes. Can be overridden from the Makefile with
+ * the value recommended by the calibration ('t' in the UART menu), e.g.
+ * DEFINES+=GPU_TESSELLATION_HEIGHT=256U */
+#ifndef GPU_TESSELLATION_HEIGHT
+#define GPU_TESSELLATION_HEIGHT             (DISP_H)
+#endif
+
+#define GPU_TESSELLATION_BUFFER_SIZE        ((GPU_TESSELLATION_HEIGHT) * \
+                                             (TESS_PROBE_BYTES_PER_ROW))
+
+/* SRAM available to the VGLite heap in .cy_gpu_buf. Two ARGB8888 buffers
+ * need more than three BGR565 ones. Can be overridden from the Makefile,
+ * e.g. DEFINES+=GPU_MEM_BUDGET_BYTES=2097152U */
+#ifndef GPU_MEM_BUDGET_BYTES
+#if (FRAME_FORMAT == FRAME_FORMAT_ARGB8888)
+#define GPU_MEM_BUDGET_BYTES                ((3456U) * (1024U))
+#else
+#define GPU_MEM_BUDGET_BYTES                ((2720U) * (1024U))
+#endif
+#endif
+
+/* Alignment of the frame buffer data and of the strides the driver uses */
+#define GPU_PLAN_BLOCK_ALIGN                (128U)
+#define GPU_PLAN_STRIDE_ALIGN               (64U)
+
+#define GPU_PLAN_ALIGN(value, align)        ((((value) + (align) - 1U) / (align)) * (align))
+#define GPU_PLAN_STRIDE(width, bpp)         (GPU_PLAN_ALIGN((((width) * (bpp)) + 7U) / 8U, \
+                                                            GPU_PLAN_STRIDE_ALIGN))
+
+/* Size of each region, in the order of allocation. The driver allocates
+ * first fit, so this order is also the layout. */
+#define GPU_PLAN_CMD_BYTES                  (GPU_PLAN_ALIGN(GPU_CMD_BUFFER_SIZE, \
+                                                            GPU_PLAN_BLOCK_ALIGN) * \
+                                             (GPU_CMD_BUFFER_COUNT))
+#define GPU_PLAN_TESS_BYTES                 (GPU_PLAN_ALIGN(GPU_TESSELLATION_BUFFER_SIZE, \
+                                                            GPU_PLAN_BLOCK_ALIGN))
+#define GPU_PLAN_FRAME_STRIDE               (GPU_PLAN_STRIDE(DISP_W_ACTUAL, FRAME_BUFFER_BPP))
+#define GPU_PLAN_FRAME_BYTES                (GPU_PLAN_ALIGN((GPU_PLAN_FRAME_STRIDE) * (DISP_H), \
+                                                            GPU_PLAN_BLOCK_ALIGN))
+#define GPU_PLAN_INTERMEDIATE_STRIDE        (GPU_PLAN_STRIDE(INTERMEDIATE_WIDTH, \
+                                                             INTERMEDIATE_BPP))
+#define GPU_PLAN_INTERMEDIATE_BYTES         (GPU_PLAN_ALIGN((GPU_PLAN_INTERMEDIATE_STRIDE) * \
+                                                            (INTERMEDIATE_HEIGHT), \
+                                                            GPU_PLAN_BLOCK_ALIGN))
+#define GPU_PLAN_PATH_BYTES                 (GPU_PLAN_ALIGN(PATH_CACHE_BUDGET_BYTES, \
+                                                            GPU_PLAN_BLOCK_ALIGN))
+
+#define GPU_PLAN_CMD_OFFSET                 (0U)
+#define GPU_PLAN_TESS_OFFSET                ((GPU_PLAN_CMD_OFFSET) + (GPU_PLAN_CMD_BYTES))
+#define GPU_PLAN_FRAME_OFFSET               ((GPU_PLAN_TESS_OFFSET) + (GPU_PLAN_TESS_BYTES))
+#define GPU_PLAN_INTERMEDIATE_OFFSET        ((GPU_PLAN_FRAME_OFFSET) + \
+                                             ((GPU_PLAN_FRAME_BYTES) * (APP_BUFFER_COUNT)))
+#define GPU_PLAN_PATH_OFFSET                ((GPU_PLAN_INTERMEDIATE_OFFSET) + \
+                                             (GPU_PLAN_INTERMEDIATE_BYTES))
+
+/* Slack after the planned regions. The plan assumes the first fit order,
+ * alignment and tessellation buffer size of the driver; the margin absorbs
+ * allocations larger than planned, and gpu_mem_plan_verify() checks at
+ * start-up that they fit in it. Can be overridden from the Makefile, e.g.
+ * DEFINES+=GPU_PLAN_MARGIN_BYTES=131072U */
+#ifndef GPU_PLAN_MARGIN_BYTES
+#define GPU_PLAN_MARGIN_BYTES               ((64U) * (1024U))
+#endif
+
+#define GPU_PLAN_MARGIN_OFFSET              ((GPU_PLAN_PATH_OFFSET) + (GPU_PLAN_PATH_BYTES))
+
+/* Heap handed to vg_lite_init_mem() */
+#define VGLITE_HEAP_SIZE                    ((GPU_PLAN_MARGIN_OFFSET) + \
+                                             (GPU_PLAN_ALIGN(GPU_PLAN_MARGIN_BYTES, \
+                                                             GPU_PLAN_BLOCK_ALIGN)))
+
+#if (VGLITE_HEAP_SIZE > GPU_MEM_BUDGET_BYTES)
+#error "The VGLite heap plan exceeds GPU_MEM_BUDGET_BYTES, see tools/host 'make plan'"
+#endif
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+void gpu_mem_plan_print(gpu_heap_t *heap);
+bool gpu_mem_plan_verify(gpu_heap_t *heap);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* GPU_MEM_PLAN_H */
+
+/* [] END OF FILE */
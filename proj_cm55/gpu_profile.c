@@ -0,0 +1,321 @@
+/*******************************************************************************
+* File Name        : gpu_profile.c
+*
+* Description      : This file contains the opt-in GPU profiler. Each wrapped VGLite
+*                    call is bracketed with vg_lite_finish() and timed with the cycle
+*                    counter, and the cost is summed per demo and per call site. The
+*                    table is dumped as comma separated lines to compare runs.
+*
+* Related Document : See README.md
+*
+********************************************************************************
+* Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include <stdio.h>
+#include <string.h>
+#include "gfx_port.h"
+#include "gpu_profile.h"
+
+#if GPU_PROFILE_ENABLED
+/*******************************************************************************
+* Data Structures and Types
+*******************************************************************************/
+typedef struct {
+    gpu_profile_site_t sites[GPU_PROFILE_MAX_SITES];
+    volatile uint32_t count;    /* Read by the dump from the CLI task */
+    uint32_t dropped;           /* Calls of sites not fitting in the table */
+    uint32_t overhead_ns;       /* Time of a bracket around no call */
+    const char *demo;
+    uint32_t start;
+    volatile bool reset_pending; /* Set from the CLI task */
+} gpu_profile_t;
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+
+/* Calls are made from the render task only. The first one measures the
+ * bracket overhead. */
+static gpu_profile_t profile = { .reset_pending = true };
+
+
+/*******************************************************************************
+* Function Name: apply_reset
+********************************************************************************
+* Summary:
+*  Empties the table and measures the time of a bracket around no call, with
+*  the GPU idle.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void apply_reset(void)
+{
+    uint32_t start;
+
+    profile.count = 0U;
+    memset(profile.sites, 0, sizeof(profile.sites));
+    profile.dropped = 0U;
+
+    (void)vg_lite_finish();
+    start = gfx_port_cycles();
+    (void)vg_lite_finish();
+    profile.overhead_ns = gfx_port_cycles_to_ns(gfx_port_cycles() - start);
+
+    profile.reset_pending = false;
+}
+
+/*******************************************************************************
+* Function Name: find_site
+********************************************************************************
+* Summary:
+*  Returns the row of a call site for the current demo, adding it if needed.
+*  Sites are told apart by their string constants, not by their contents.
+*
+* Parameters:
+*  function - Function making the call
+*  line     - Line of the call
+*  call     - VGLite function called
+*
+* Return:
+*  gpu_profile_site_t* - Row, NULL if the table is full
+*
+*******************************************************************************/
+static gpu_profile_site_t *find_site(const char *function, uint32_t line, const char *call)
+{
+    gpu_profile_site_t *site;
+
+    for (uint32_t i = 0; i < profile.count; i++)
+    {
+        site = &profile.sites[i];
+        if ((site->line == line) && (site->function == function) &&
+            (site->demo == profile.demo))
+        {
+            return site;
+        }
+    }
+
+    if (profile.count >= GPU_PROFILE_MAX_SITES)
+    {
+        return NULL;
+    }
+
+    site = &profile.sites[profile.count];
+    site->demo     = profile.demo;
+    site->function = function;
+    site->call     = call;
+    site->line     = line;
+    /* Published after it is filled in, for the dump */
+    profile.count++;
+
+    return site;
+}
+
+/*******************************************************************************
+* Function Name: gpu_profile_set_demo
+********************************************************************************
+* Summary:
+*  Charges the following calls to a demo. Use GPU_PROFILE_DEMO().
+*
+* Parameters:
+*  demo   - Name of the demo, a string constant
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void gpu_profile_set_demo(const char *demo)
+{
+    profile.demo = demo;
+}
+
+/*******************************************************************************
+* Function Name: gpu_profile_begin
+********************************************************************************
+* Summary:
+*  Waits for the GPU to finish all earlier work and starts timing a call.
+*  Use GPU_PROFILE_CALL().
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void gpu_profile_begin(void)
+{
+    if (profile.reset_pending)
+    {
+        apply_reset();
+    }
+
+    (void)vg_lite_finish();
+    profile.start = gfx_port_cycles();
+}
+
+/*******************************************************************************
+* Function Name: gpu_profile_end
+********************************************************************************
+* Summary:
+*  Waits for the GPU to finish the timed call and charges its time, CPU
+*  encoding included, to the call site. Use GPU_PROFILE_CALL().
+*
+* Parameters:
+*  function        - Function making the call
+*  line            - Line of the call
+*  call            - VGLite function called
+*  error           - Result of the call
+*
+* Return:
+*  vg_lite_error_t - error, unchanged
+*
+*******************************************************************************/
+vg_lite_error_t gpu_profile_end(const char *function, uint32_t line, const char *call,
+                                vg_lite_error_t error)
+{
+    gpu_profile_site_t *site;
+    uint32_t elapsed_ns;
+
+    (void)vg_lite_finish();
+    elapsed_ns = gfx_port_cycles_to_ns(gfx_port_cycles() - profile.start);
+
+    site = find_site(function, line, call);
+    if (NULL == site)
+    {
+        profile.dropped++;
+    }
+    else
+    {
+        site->calls++;
+        site->total_ns += elapsed_ns;
+        site->max_ns = (elapsed_ns > site->max_ns) ? elapsed_ns : site->max_ns;
+    }
+
+    return error;
+}
+#endif /* GPU_PROFILE_ENABLED */
+
+/*******************************************************************************
+* Function Name: gpu_profile_get_sites
+********************************************************************************
+* Summary:
+*  Returns the rows of the cost table.
+*
+* Parameters:
+*  sites    - Output pointer to the first row, NULL if profiling is disabled
+*
+* Return:
+*  uint32_t - Number of rows
+*
+*******************************************************************************/
+uint32_t gpu_profile_get_sites(const gpu_profile_site_t **sites)
+{
+#if GPU_PROFILE_ENABLED
+    *sites = profile.sites;
+    return profile.count;
+#else
+    *sites = NULL;
+    return 0U;
+#endif
+}
+
+/*******************************************************************************
+* Function Name: gpu_profile_reset
+********************************************************************************
+* Summary:
+*  Empties the table before the next timed call. Safe to call from another
+*  task than the render task.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void gpu_profile_reset(void)
+{
+#if GPU_PROFILE_ENABLED
+    profile.reset_pending = true;
+#endif
+}
+
+/*******************************************************************************
+* Function Name: gpu_profile_dump
+********************************************************************************
+* Summary:
+*  Prints the cost table, one comma separated line per demo and call site.
+*  Save the output of two runs and compare them with
+*  tools/host/gpu_profile_diff.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void gpu_profile_dump(void)
+{
+#if GPU_PROFILE_ENABLED
+    uint32_t count = profile.count;
+
+    printf("\r\nGPU profile: %u call sites, %u calls dropped, %u ns bracket overhead per call\r\n",
+           (unsigned int)count, (unsigned int)profile.dropped,
+           (unsigned int)profile.overhead_ns);
+    printf(GPU_PROFILE_DUMP_PREFIX "demo,site,call,calls,avg_ns,max_ns,total_us\r\n");
+    for (uint32_t i = 0; i < count; i++)
+    {
+        const gpu_profile_site_t *site = &profile.sites[i];
+
+        printf(GPU_PROFILE_DUMP_PREFIX "%s,%s:%u,%s,%u,%u,%u,%u\r\n",
+               (NULL != site->demo) ? site->demo : "-", site->function,
+               (unsigned int)site->line, site->call, (unsigned int)site->calls,
+               (unsigned int)((0U != site->calls) ? (site->total_ns / site->calls) : 0U),
+               (unsigned int)site->max_ns, (unsigned int)(site->total_ns / GFX_NS_PER_US));
+    }
+#else
+    printf("\r\nGPU profiling is compiled out, build with DEFINES+=GPU_PROFILE_ENABLED=true\r\n");
+#endif
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,120 @@
+/*******************************************************************************
+* File Name        : gpu_profile.h
+*
+* Description      : This file contains the declarations of the opt-in GPU profiler.
+*                    Each wrapped VGLite call is bracketed with vg_lite_finish() and
+*                    timed, and the cost is summed per demo and per call site. With
+*                    GPU_PROFILE_ENABLED false the wrappers are the bare calls.
+*
+* Related Document : See README.md
+*
+********************************************************************************
+* Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+
+#ifndef GPU_PROFILE_H
+#define GPU_PROFILE_H
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include <stdint.h>
+#include <stdbool.h>
+#include "vg_lite.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+
+/* Times every wrapped call. Serializes the CPU and the GPU, so the FPS line
+ * is not representative while enabled. Can be overridden from the Makefile,
+ * e.g. DEFINES+=GPU_PROFILE_ENABLED=true */
+#ifndef GPU_PROFILE_ENABLED
+#define GPU_PROFILE_ENABLED                 (false)
+#endif
+
+/* Rows of the cost table, one per demo and call site */
+#define GPU_PROFILE_MAX_SITES               (64U)
+
+/* Prefix of every line of the dump, see tools/host/gpu_profile_diff.c */
+#define GPU_PROFILE_DUMP_PREFIX             "gpu_profile,"
+
+#if GPU_PROFILE_ENABLED
+/* Evaluates expr, a VGLite call named call, and charges its time to the
+ * current demo and to the calling function and line */
+#define GPU_PROFILE_CALL(call, expr)        (gpu_profile_begin(), \
+                                             gpu_profile_end(__func__, __LINE__, (call), (expr)))
+/* Charges the following calls to the demo named name */
+#define GPU_PROFILE_DEMO(name)              gpu_profile_set_demo(name)
+#else
+#define GPU_PROFILE_CALL(call, expr)        (expr)
+#define GPU_PROFILE_DEMO(name)              ((void)0)
+#endif
+
+/*******************************************************************************
+* Data Structures and Types
+*******************************************************************************/
+
+/* Cost of one call site while one demo is rendering */
+typedef struct {
+    const char *demo;
+    const char *function;       /* Function making the call */
+    const char *call;           /* VGLite function called */
+    uint32_t line;
+    uint32_t calls;
+    uint64_t total_ns;          /* Bracketed time, summed */
+    uint32_t max_ns;
+} gpu_profile_site_t;
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+void gpu_profile_set_demo(const char *demo);
+void gpu_profile_begin(void);
+vg_lite_error_t gpu_profile_end(const char *function, uint32_t line, const char *call,
+                                vg_lite_error_t error);
+uint32_t gpu_profile_get_sites(const gpu_profile_site_t **sites);
+void gpu_profile_reset(void);
+void gpu_profile_dump(void);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* GPU_PROFILE_H */
+
+/* [] END OF FILE */
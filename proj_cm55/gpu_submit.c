@@ -0,0 +1,380 @@
+/*******************************************************************************
+* File Name        : gpu_submit.c
+*
+* Description      : This file contains the GPU frame submission layer. The fence
+*                    of a frame is recorded before its vg_lite_flush(), so its
+*                    interrupt can not arrive first. The GPU executes submissions
+*                    in order, so an interrupt completes at least the oldest frame.
+*                    Interrupts are not paired with frames one to one:
+*                    vg_lite_finish() raises extra ones and the driver may serve two
+*                    completions with one. Every frame left is retired once the
+*                    render task knows the GPU is idle.
+*
+* Related Document : See README.md
+*
+********************************************************************************
+* Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+
+#include <string.h>
+#include "gpu_submit.h"
+#include "gfx_port.h"
+
+/*******************************************************************************
+* Function Name: retire_oldest
+********************************************************************************
+* Summary:
+*  Completes the oldest pending frame and hands it to the done callback.
+*  Must be called with interrupts disabled and a frame pending.
+*
+* Parameters:
+*  ctx        - Pointer to the submission context
+*  now_cycles - Timestamp the frame is known to be complete at
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void retire_oldest(gpu_submit_t *ctx, uint32_t now_cycles)
+{
+    gpu_submit_entry_t *entry = &ctx->pending[ctx->pending_head];
+    uint32_t start;
+
+    ctx->pending_head = (ctx->pending_head + 1U) % GPU_SUBMIT_MAX_PENDING;
+    ctx->pending_count--;
+
+    /* The GPU starts a frame when it is submitted or when the previous
+     * one completes, whichever is later */
+    start = entry->submit_cycles;
+    if ((ctx->has_completed) &&
+        ((int32_t)(ctx->last_complete_cycles - start) > 0))
+    {
+        start = ctx->last_complete_cycles;
+    }
+
+    ctx->stats.gpu_busy_cycles += now_cycles - start;
+    ctx->stats.frames++;
+    ctx->last_complete_cycles = now_cycles;
+    ctx->has_completed = true;
+    ctx->completed_fence = entry->fence;
+
+    if (NULL != ctx->done)
+    {
+        ctx->done(entry->slot, ctx->user_data);
+    }
+}
+
+/*******************************************************************************
+* Function Name: gpu_submit_init
+********************************************************************************
+* Summary:
+*  Initializes the GPU submission layer.
+*
+* Parameters:
+*  ctx       - Pointer to the submission context
+*  done      - Callback invoked from the GPU interrupt for completed frames
+*  user_data - Opaque pointer passed to the callback
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void gpu_submit_init(gpu_submit_t *ctx, gpu_submit_done_t done,
+                     void *user_data)
+{
+    memset(ctx, 0, sizeof(*ctx));
+    ctx->next_fence = 1U;
+    ctx->done       = done;
+    ctx->user_data  = user_data;
+}
+
+/*******************************************************************************
+* Function Name: gpu_submit_frame
+********************************************************************************
+* Summary:
+*  Records a frame about to be handed to the GPU with vg_lite_flush(). Must
+*  be called before the flush, whose interrupt may arrive before it returns.
+*  The part of the encoding interval during which the GPU was still busy
+*  with earlier frames is accounted as CPU/GPU overlap.
+*
+* Parameters:
+*  ctx                 - Pointer to the submission context
+*  slot                - Swap chain slot the frame was rendered into
+*  encode_start_cycles - Timestamp at which encoding of the frame started
+*  now_cycles          - Current timestamp
+*
+* Return:
+*  uint32_t            - Fence of the frame, GPU_SUBMIT_NO_FENCE if every
+*                        entry is pending: retire them with
+*                        gpu_submit_on_idle() after vg_lite_finish() and
+*                        record the frame again
+*
+*******************************************************************************/
+uint32_t gpu_submit_frame(gpu_submit_t *ctx, uint8_t slot,
+                          uint32_t encode_start_cycles, uint32_t now_cycles)
+{
+    gpu_submit_entry_t *entry;
+    uint32_t encode = now_cycles - encode_start_cycles;
+    uint32_t overlap = 0U;
+    uint32_t fence;
+    uint32_t state = GFX_ENTER_CRITICAL();
+
+    if (ctx->pending_count > 0U)
+    {
+        /* GPU has been busy for the whole encoding interval */
+        overlap = encode;
+    }
+    else if ((ctx->has_completed) &&
+             ((int32_t)(ctx->last_complete_cycles - encode_start_cycles) > 0))
+    {
+        overlap = ctx->last_complete_cycles - encode_start_cycles;
+    }
+
+    if (ctx->pending_count >= GPU_SUBMIT_MAX_PENDING)
+    {
+        ctx->stats.queue_full++;
+        GFX_EXIT_CRITICAL(state);
+        return GPU_SUBMIT_NO_FENCE;
+    }
+
+    fence = ctx->next_fence++;
+    if (GPU_SUBMIT_NO_FENCE == ctx->next_fence)
+    {
+        ctx->next_fence++;
+    }
+
+    entry = &ctx->pending[(ctx->pending_head + ctx->pending_count) %
+                          GPU_SUBMIT_MAX_PENDING];
+    entry->fence         = fence;
+    entry->submit_cycles = now_cycles;
+    entry->slot          = slot;
+    ctx->pending_count++;
+
+    ctx->stats.encode_cycles  += encode;
+    ctx->stats.overlap_cycles += overlap;
+
+    GFX_EXIT_CRITICAL(state);
+
+    return fence;
+}
+
+/*******************************************************************************
+* Function Name: gpu_submit_cancel
+********************************************************************************
+* Summary:
+*  Drops the newest frame again when its vg_lite_flush() failed.
+*
+* Parameters:
+*  ctx   - Pointer to the submission context
+*  fence - Fence returned by gpu_submit_frame()
+*
+* Return:
+*  bool  - false if the frame was no longer pending
+*
+*******************************************************************************/
+bool gpu_submit_cancel(gpu_submit_t *ctx, uint32_t fence)
+{
+    bool cancelled = false;
+    uint32_t state = GFX_ENTER_CRITICAL();
+    uint8_t newest = (ctx->pending_head + ctx->pending_count + GPU_SUBMIT_MAX_PENDING - 1U) %
+                     GPU_SUBMIT_MAX_PENDING;
+
+    if ((ctx->pending_count > 0U) && (ctx->pending[newest].fence == fence))
+    {
+        ctx->pending_count--;
+        cancelled = true;
+    }
+
+    GFX_EXIT_CRITICAL(state);
+
+    return cancelled;
+}
+
+/*******************************************************************************
+* Function Name: gpu_submit_retire
+********************************************************************************
+* Summary:
+*  Completes every pending frame up to and including the given fence, in
+*  submission order.
+*
+* Parameters:
+*  ctx        - Pointer to the submission context
+*  fence      - Newest fence known to be complete
+*  now_cycles - Current timestamp
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void gpu_submit_retire(gpu_submit_t *ctx, uint32_t fence, uint32_t now_cycles)
+{
+    uint32_t state = GFX_ENTER_CRITICAL();
+
+    while ((ctx->pending_count > 0U) &&
+           ((int32_t)(fence - ctx->pending[ctx->pending_head].fence) >= 0))
+    {
+        retire_oldest(ctx, now_cycles);
+    }
+
+    GFX_EXIT_CRITICAL(state);
+}
+
+/*******************************************************************************
+* Function Name: gpu_submit_on_irq
+********************************************************************************
+* Summary:
+*  Retires the oldest pending frame, which the GPU has completed when any
+*  of its interrupts arrives. To be called from the GPU interrupt before
+*  vg_lite_IRQHandler().
+*
+* Parameters:
+*  ctx        - Pointer to the submission context
+*  now_cycles - Timestamp of the interrupt
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void gpu_submit_on_irq(gpu_submit_t *ctx, uint32_t now_cycles)
+{
+    uint32_t state = GFX_ENTER_CRITICAL();
+
+    if (ctx->pending_count > 0U)
+    {
+        gpu_submit_retire(ctx, ctx->pending[ctx->pending_head].fence, now_cycles);
+    }
+    else
+    {
+        /* E.g. the end of a vg_lite_finish() */
+        ctx->stats.stray_irqs++;
+    }
+
+    GFX_EXIT_CRITICAL(state);
+}
+
+/*******************************************************************************
+* Function Name: gpu_submit_on_idle
+********************************************************************************
+* Summary:
+*  Retires every pending frame. To be called by the render task when the
+*  GPU is known to be idle, i.e. after vg_lite_finish() returned, so a frame
+*  whose interrupt was shared with another one is not left pending.
+*
+* Parameters:
+*  ctx        - Pointer to the submission context
+*  now_cycles - Current timestamp
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void gpu_submit_on_idle(gpu_submit_t *ctx, uint32_t now_cycles)
+{
+    uint32_t state = GFX_ENTER_CRITICAL();
+
+    ctx->stats.idle_retired += ctx->pending_count;
+    while (ctx->pending_count > 0U)
+    {
+        retire_oldest(ctx, now_cycles);
+    }
+
+    GFX_EXIT_CRITICAL(state);
+}
+
+/*******************************************************************************
+* Function Name: gpu_submit_get_pending
+********************************************************************************
+* Summary:
+*  Returns the number of frames the GPU may still be working on.
+*
+* Parameters:
+*  ctx     - Pointer to the submission context
+*
+* Return:
+*  uint8_t - Number of pending frames
+*
+*******************************************************************************/
+uint8_t gpu_submit_get_pending(const gpu_submit_t *ctx)
+{
+    return ctx->pending_count;
+}
+
+/*******************************************************************************
+* Function Name: gpu_submit_fence_done
+********************************************************************************
+* Summary:
+*  Checks whether the GPU has completed the frame with the given fence.
+*
+* Parameters:
+*  ctx   - Pointer to the submission context
+*  fence - Fence returned by gpu_submit_frame()
+*
+* Return:
+*  bool  - true if the frame is complete
+*
+*******************************************************************************/
+bool gpu_submit_fence_done(const gpu_submit_t *ctx, uint32_t fence)
+{
+    return ((int32_t)(ctx->completed_fence - fence) >= 0);
+}
+
+/*******************************************************************************
+* Function Name: gpu_submit_get_stats
+********************************************************************************
+* Summary:
+*  Copies the submission statistics, optionally resetting the counters.
+*
+* Parameters:
+*  ctx   - Pointer to the submission context
+*  stats - Destination for the statistics
+*  reset - true to clear the counters after reading them
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void gpu_submit_get_stats(gpu_submit_t *ctx, gpu_submit_stats_t *stats,
+                          bool reset)
+{
+    uint32_t state = GFX_ENTER_CRITICAL();
+
+    *stats = ctx->stats;
+    if (reset)
+    {
+        memset(&ctx->stats, 0, sizeof(ctx->stats));
+    }
+
+    GFX_EXIT_CRITICAL(state);
+}
+
+/* [] END OF FILE */
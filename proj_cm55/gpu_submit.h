@@ -0,0 +1,129 @@
+/*******************************************************************************
+* File Name        : gpu_submit.h
+*
+* Description      : This file contains the declarations of the GPU frame submission
+*                    layer. Frames are handed to the GPU with vg_lite_flush() and
+*                    completed by per-frame fences, retired by sequence number from
+*                    the GPU interrupt or once the GPU is known to be idle, so the
+*                    CPU can encode the next frame while the GPU is busy.
+*
+* Related Document : See README.md
+*
+********************************************************************************
+* Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+
+#ifndef GPU_SUBMIT_H
+#define GPU_SUBMIT_H
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include <stdint.h>
+#include <stdbool.h>
+#include "swap_chain.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+#define GPU_SUBMIT_MAX_PENDING              (SWAP_CHAIN_MAX_DEPTH)
+/* Returned by gpu_submit_frame() when every entry is in use */
+#define GPU_SUBMIT_NO_FENCE                 (0U)
+
+/*******************************************************************************
+* Data Structures and Types
+*******************************************************************************/
+
+/* Called once the frame rendered into slot is done, from the GPU interrupt
+ * or from the render task after the GPU went idle */
+typedef void (*gpu_submit_done_t)(uint8_t slot, void *user_data);
+
+typedef struct {
+    uint32_t frames;            /* Frames completed by the GPU */
+    uint32_t gpu_busy_cycles;   /* GPU execution time, summed */
+    uint32_t encode_cycles;     /* CPU command encoding time, summed */
+    uint32_t overlap_cycles;    /* Encoding time with the GPU busy, summed */
+    uint32_t stray_irqs;        /* GPU interrupts with no frame pending */
+    uint32_t idle_retired;      /* Frames retired after the GPU went idle */
+    uint32_t queue_full;        /* Frames refused with every entry in use */
+} gpu_submit_stats_t;
+
+typedef struct {
+    uint32_t fence;                     /* Sequence number of the frame */
+    uint32_t submit_cycles;             /* Timestamp just before vg_lite_flush() */
+    uint8_t  slot;                      /* Swap chain slot rendered into */
+} gpu_submit_entry_t;
+
+typedef struct {
+    gpu_submit_entry_t pending[GPU_SUBMIT_MAX_PENDING];
+    uint8_t pending_head;
+    volatile uint8_t pending_count;
+
+    uint32_t next_fence;
+    volatile uint32_t completed_fence;
+    uint32_t last_complete_cycles;
+    bool has_completed;
+
+    gpu_submit_done_t done;
+    void *user_data;
+
+    gpu_submit_stats_t stats;
+} gpu_submit_t;
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+void gpu_submit_init(gpu_submit_t *ctx, gpu_submit_done_t done,
+                     void *user_data);
+uint32_t gpu_submit_frame(gpu_submit_t *ctx, uint8_t slot,
+                          uint32_t encode_start_cycles, uint32_t now_cycles);
+bool gpu_submit_cancel(gpu_submit_t *ctx, uint32_t fence);
+void gpu_submit_retire(gpu_submit_t *ctx, uint32_t fence, uint32_t now_cycles);
+void gpu_submit_on_irq(gpu_submit_t *ctx, uint32_t now_cycles);
+void gpu_submit_on_idle(gpu_submit_t *ctx, uint32_t now_cycles);
+uint8_t gpu_submit_get_pending(const gpu_submit_t *ctx);
+bool gpu_submit_fence_done(const gpu_submit_t *ctx, uint32_t fence);
+void gpu_submit_get_stats(gpu_submit_t *ctx, gpu_submit_stats_t *stats,
+                          bool reset);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* GPU_SUBMIT_H */
+
+/* [] END OF FILE */
@@ -1,253 +0,0 @@
-/*******************************************************************************
-* File Name        : facial_rec.h
-*
-* Description      : This header file contains pixel map of Facial_Rec.png
-*                    image to be used by vglite API(s). 
-*
-* Related Document : See README.md
-*
-********************************************************************************
-* Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
-* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
-*
-* This software, including source code, documentation and related
-* materials ("Software") is owned by Cypress Semiconductor Corporation
-* or one of its affiliates ("Cypress") and is protected by and subject to
-* worldwide patent protection (United States and foreign),
-* United States copyright laws and international treaty provisions.
-* Therefore, you may use this Software only as provided in the license
-* agreement accompanying the software package from which you
-* obtained this Software ("EULA").
-* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
-* non-transferable license to copy, modify, and compile the Software
-* source code solely for use in connection with Cypress's
-* integrated circuit products.  Any reproduction, modification, translation,
-* compilation, or representation of this Software except as specified
-* above is prohibited without the express written permission of Cypress.
-*
-* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
-* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
-* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
-* reserves the right to make changes to the Software without notice. Cypress
-* does not assume any liability arising out of the application or use of the
-* Software or any product or circuit described in the Software. Cypress does
-* not authorize its products for use in any products where a malfunction or
-* failure of the Cypress product may reasonably be expected to result in
-* significant property damage, injury or death ("High Risk Product"). By
-* including Cypress's product in a High Risk Product, the manufacturer
-* of such system or application assumes all risk of such use and in doing
-* so agrees to indemnify Cypress against all liability.
-*******************************************************************************/
-#ifndef __FACIAL_REC_H__
-#define __FACIAL_REC_H__
-
-#if defined(__cplusplus)
-extern "C" {
-#endif
-
-CY_SECTION(".cy_socmem_data") uint8_t Facial_Rec_map[] __attribute__((aligned(128))) = {
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0x09, 0x84, 0x71, 0xD7, 0x0B, 0x7E, 0x73, 0xFF, 0x0D, 0x86, 0x79, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x85, 0x78, 0xD3, 0x0A, 0x7E, 0x71, 0x13, 0x0D, 0x78, 0x6B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x0F, 0x7F, 0x6F, 0xCF, 0x0C, 0x82, 0x76, 0xFF, 0x0D, 0x87, 0x7A, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0D, 0x8A, 0x7D, 0xC4, 0x0D, 0x87, 0x7A, 0x28, 0x0C, 0x79, 0x6C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0x09, 0x84, 0x71, 0xD7, 0x0B, 0x7E, 0x73, 0xFF, 0x0D, 0x86, 0x79, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x85, 0x78, 0xD3, 0x0A, 0x7E, 0x71, 0x13, 0x0D, 0x78, 0x6B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x0F, 0x7F, 0x6F, 0xCF, 0x0C, 0x82, 0x76, 0xFF, 0x0D, 0x87, 0x7A, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0D, 0x8A, 0x7D, 0xC4, 0x0D, 0x87, 0x7A, 0x28, 0x0C, 0x79, 0x6C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0x09, 0x84, 0x71, 0xD7, 0x0B, 0x7E, 0x73, 0xFF, 0x0D, 0x86, 0x79, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x85, 0x78, 0xD3, 0x0A, 0x7E, 0x71, 0x13, 0x0D, 0x78, 0x6B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x0F, 0x7F, 0x6F, 0xCF, 0x0C, 0x82, 0x76, 0xFF, 0x0D, 0x87, 0x7A, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0D, 0x8A, 0x7D, 0xC4, 0x0D, 0x87, 0x7A, 0x28, 0x0C, 0x79, 0x6C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0x09, 0x84, 0x71, 0xD7, 0x0B, 0x7E, 0x73, 0xFF, 0x0D, 0x86, 0x79, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x85, 0x78, 0xD3, 0x0A, 0x7E, 0x71, 0x13, 0x0D, 0x78, 0x6B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x0F, 0x7F, 0x6F, 0xCF, 0x0C, 0x82, 0x76, 0xFF, 0x0D, 0x87, 0x7A, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0D, 0x8A, 0x7D, 0xC4, 0x0D, 0x87, 0x7A, 0x28, 0x0C, 0x79, 0x6C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0x09, 0x84, 0x71, 0xD7, 0x0B, 0x7E, 0x73, 0xFF, 0x0D, 0x86, 0x79, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x85, 0x78, 0xD2, 0x0A, 0x7F, 0x72, 0x13, 0x0D, 0x78, 0x6B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x5F, 0x5F, 0x0F, 0x11, 0x77, 0x66, 0x15, 0x0C, 0x79, 0x6D, 0x1A, 0x09, 0x75, 0x6B, 0x1C, 0x09, 0x76, 0x6D, 0x1C, 0x09, 0x76, 0x6D, 0x1A, 0x09, 0x75, 0x6B, 0x16, 0x0B, 0x73, 0x68, 0x10, 0x0F, 0x6F, 0x5F, 0x08, 0x00, 0x5F, 0x5F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x0F, 0x7F, 0x6F, 0xCF, 0x0C, 0x82, 0x76, 0xFF, 0x0D, 0x87, 0x7A, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0D, 0x8A, 0x7D, 0xC4, 0x0D, 0x87, 0x7A, 0x28, 0x0C, 0x79, 0x6C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0x09, 0x84, 0x71, 0xD7, 0x0B, 0x7E, 0x73, 0xFF, 0x0D, 0x86, 0x79, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x81, 0x74, 0xFF, 0x0D, 0x83, 0x76, 0xFF, 0x0D, 0x83, 0x76, 0xFF, 0x0D, 0x83, 0x76, 0xFF, 0x0D, 0x83, 0x76, 0xFF, 0x0D, 0x83, 0x76, 0xFF, 0x0D, 0x83, 0x76, 0xFF, 0x0D, 0x83, 0x76, 0xFF, 0x0D, 0x83, 0x76, 0xFF, 0x0D, 0x83, 0x76, 0xFF, 0x0D, 0x83, 0x76, 0xFF, 0x0D, 0x83, 0x76, 0xFF, 0x0D, 0x83, 0x76, 0xFF, 0x0D, 0x83, 0x76, 0xFF, 0x0D, 0x83, 0x76, 0xFF, 0x0D, 0x84, 0x77, 0xFF, 0x0D, 0x89, 0x7C, 0xD9, 0x0A, 0x7E, 0x71, 0x14, 0x0C, 0x72, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x0E, 0x7F, 0x71, 0x29, 0x0C, 0x7C, 0x6F, 0x3B, 0x08, 0x7D, 0x70, 0x56, 0x0B, 0x7C, 0x70, 0x72, 0x0D, 0x81, 0x74, 0x88, 0x0D, 0x85, 0x78, 0x99, 0x0D, 0x85, 0x79, 0xA7, 0x0C, 0x84, 0x78, 0xB1, 0x0B, 0x84, 0x77, 0xB6, 0x0C, 0x83, 0x77, 0xB6, 0x0C, 0x83, 0x77, 0xB1, 0x0B, 0x84, 0x77, 0xA8, 0x0C, 0x84, 0x77, 0x9A, 0x0D, 0x84, 0x78, 0x87, 0x0D, 0x84, 0x78, 0x72, 0x0B, 0x81, 0x76, 0x55, 0x09, 0x81, 0x75, 0x3C, 0x0C, 0x7B, 0x72, 0x29, 0x0C, 0x7C, 0x6F, 0x13, 0x0D, 0x78, 0x6B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x0F, 0x7B, 0x73, 0xD4, 0x0C, 0x83, 0x75, 0xFF, 0x0E, 0x8B, 0x7D, 0xFF, 0x0D, 0x83, 0x76, 0xFF, 0x0D, 0x83, 0x76, 0xFF, 0x0D, 0x83, 0x76, 0xFF, 0x0D, 0x83, 0x76, 0xFF, 0x0D, 0x83, 0x76, 0xFF, 0x0D, 0x83, 0x76, 0xFF, 0x0D, 0x83, 0x76, 0xFF, 0x0D, 0x83, 0x76, 0xFF, 0x0D, 0x83, 0x76, 0xFF, 0x0D, 0x83, 0x76, 0xFF, 0x0D, 0x83, 0x76, 0xFF, 0x0D, 0x83, 0x76, 0xFF, 0x0D, 0x83, 0x76, 0xFF, 0x0D, 0x83, 0x76, 0xFF, 0x0D, 0x83, 0x76, 0xFF, 0x0C, 0x81, 0x74, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0D, 0x8A, 0x7D, 0xC4, 0x0D, 0x87, 0x7A, 0x28, 0x0C, 0x79, 0x6C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0x09, 0x84, 0x71, 0xD7, 0x0B, 0x7E, 0x73, 0xFF, 0x0D, 0x86, 0x79, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x81, 0x75, 0xFF, 0x0C, 0x84, 0x78, 0xFF, 0x0C, 0x84, 0x78, 0xFF, 0x0C, 0x84, 0x78, 0xFF, 0x0C, 0x84, 0x78, 0xFF, 0x0C, 0x84, 0x78, 0xFF, 0x0C, 0x84, 0x78, 0xFF, 0x0C, 0x84, 0x78, 0xFF, 0x0C, 0x84, 0x78, 0xFF, 0x0C, 0x84, 0x78, 0xFF, 0x0C, 0x84, 0x78, 0xFF, 0x0C, 0x84, 0x78, 0xFF, 0x0C, 0x84, 0x78, 0xFF, 0x0C, 0x84, 0x78, 0xFF, 0x0C, 0x84, 0x78, 0xFF, 0x0C, 0x85, 0x79, 0xFF, 0x0C, 0x8A, 0x7E, 0xDC, 0x0B, 0x7E, 0x73, 0x14, 0x0C, 0x72, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x23, 0x0E, 0x7B, 0x74, 0x46, 0x0A, 0x7B, 0x74, 0x71, 0x0D, 0x82, 0x77, 0x9F, 0x0C, 0x86, 0x7B, 0xCA, 0x0C, 0x84, 0x77, 0xEB, 0x0A, 0x83, 0x76, 0xFF, 0x0B, 0x82, 0x76, 0xFF, 0x0D, 0x87, 0x7B, 0xFF, 0x0D, 0x8A, 0x7D, 0xFF, 0x0D, 0x8B, 0x7E, 0xFF, 0x0D, 0x8A, 0x7D, 0xFF, 0x0D, 0x8A, 0x7D, 0xFF, 0x0D, 0x8A, 0x7D, 0xFF, 0x0D, 0x8A, 0x7D, 0xFF, 0x0D, 0x8A, 0x7D, 0xFF, 0x0D, 0x8A, 0x7D, 0xFF, 0x0D, 0x8B, 0x7E, 0xFF, 0x0D, 0x8A, 0x7D, 0xFF, 0x0D, 0x88, 0x7B, 0xFF, 0x0C, 0x83, 0x75, 0xEB, 0x0D, 0x83, 0x77, 0xCA, 0x0C, 0x84, 0x77, 0xA0, 0x0C, 0x85, 0x7A, 0x74, 0x0D, 0x81, 0x76, 0x47, 0x0A, 0x7D, 0x72, 0x24, 0x0E, 0x7F, 0x71, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x07, 0x78, 0x70, 0xD6, 0x0B, 0x83, 0x75, 0xFF, 0x0D, 0x8D, 0x7F, 0xFF, 0x0C, 0x84, 0x78, 0xFF, 0x0C, 0x84, 0x78, 0xFF, 0x0C, 0x84, 0x78, 0xFF, 0x0C, 0x84, 0x78, 0xFF, 0x0C, 0x84, 0x78, 0xFF, 0x0C, 0x84, 0x78, 0xFF, 0x0C, 0x84, 0x78, 0xFF, 0x0C, 0x84, 0x78, 0xFF, 0x0C, 0x84, 0x78, 0xFF, 0x0C, 0x84, 0x78, 0xFF, 0x0C, 0x84, 0x78, 0xFF, 0x0C, 0x84, 0x78, 0xFF, 0x0C, 0x84, 0x78, 0xFF, 0x0C, 0x84, 0x78, 0xFF, 0x0C, 0x84, 0x77, 0xFF, 0x0C, 0x81, 0x75, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0D, 0x8A, 0x7D, 0xC4, 0x0D, 0x87, 0x7A, 0x28, 0x0C, 0x79, 0x6C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0x09, 0x84, 0x71, 0xD7, 0x0B, 0x7E, 0x73, 0xFF, 0x0D, 0x86, 0x79, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x80, 0x74, 0xFE, 0x0C, 0x82, 0x75, 0xC5, 0x0B, 0x7D, 0x71, 0x7C, 0x0A, 0x7D, 0x73, 0x7E, 0x0A, 0x7B, 0x71, 0x7E, 0x0A, 0x7B, 0x71, 0x7E, 0x0A, 0x7B, 0x71, 0x7E, 0x0A, 0x7B, 0x71, 0x7E, 0x0A, 0x7B, 0x71, 0x7E, 0x0A, 0x7B, 0x71, 0x7E, 0x0A, 0x7B, 0x71, 0x7E, 0x0A, 0x7B, 0x71, 0x7E, 0x0A, 0x7B, 0x71, 0x7E, 0x0A, 0x7B, 0x71, 0x7E, 0x0A, 0x7B, 0x71, 0x7E, 0x0A, 0x7B, 0x71, 0x7E, 0x0A, 0x7B, 0x71, 0x7F, 0x0A, 0x7C, 0x72, 0x83, 0x09, 0x7C, 0x72, 0x68, 0x0C, 0x7D, 0x70, 0x09, 0x1C, 0x8D, 0x71, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x0B, 0x79, 0x79, 0x49, 0x0A, 0x81, 0x73, 0x82, 0x0B, 0x85, 0x77, 0xBD, 0x0C, 0x86, 0x7A, 0xEF, 0x0C, 0x82, 0x77, 0xFF, 0x0D, 0x88, 0x7B, 0xFF, 0x0D, 0x8B, 0x7F, 0xFF, 0x0D, 0x89, 0x7C, 0xFF, 0x0D, 0x86, 0x79, 0xFF, 0x0C, 0x83, 0x76, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7E, 0x73, 0xFF, 0x0C, 0x7E, 0x73, 0xFF, 0x0C, 0x7E, 0x73, 0xFF, 0x0C, 0x7E, 0x73, 0xFF, 0x0C, 0x7E, 0x73, 0xFF, 0x0C, 0x7E, 0x73, 0xFF, 0x0C, 0x7E, 0x73, 0xFF, 0x0C, 0x7E, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x82, 0x76, 0xFF, 0x0D, 0x86, 0x79, 0xFF, 0x0D, 0x89, 0x7C, 0xFF, 0x0D, 0x8B, 0x7E, 0xFF, 0x0D, 0x88, 0x7A, 0xF1, 0x0C, 0x83, 0x76, 0xBE, 0x0C, 0x87, 0x7A, 0x85, 0x0B, 0x84, 0x74, 0x4A, 0x0A, 0x7F, 0x71, 0x18, 0x0A, 0x7F, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x0F, 0x7F, 0x6F, 0x66, 0x0C, 0x82, 0x75, 0x82, 0x0B, 0x81, 0x75, 0x7E, 0x0A, 0x7B, 0x71, 0x7E, 0x0A, 0x7B, 0x71, 0x7E, 0x0A, 0x7B, 0x71, 0x7E, 0x0A, 0x7B, 0x71, 0x7E, 0x0A, 0x7B, 0x71, 0x7E, 0x0A, 0x7B, 0x71, 0x7E, 0x0A, 0x7B, 0x71, 0x7E, 0x0A, 0x7B, 0x71, 0x7E, 0x0A, 0x7B, 0x71, 0x7E, 0x0A, 0x7B, 0x71, 0x7E, 0x0A, 0x7B, 0x71, 0x7E, 0x0A, 0x7B, 0x71, 0x7E, 0x0A, 0x7B, 0x71, 0x7D, 0x0A, 0x7C, 0x72, 0x81, 0x09, 0x7C, 0x70, 0xCA, 0x0B, 0x7E, 0x74, 0xFF, 0x0C, 0x84, 0x77, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0D, 0x8A, 0x7D, 0xC4, 0x0D, 0x87, 0x7A, 0x28, 0x0C, 0x79, 0x6C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0x09, 0x84, 0x71, 0xD7, 0x0B, 0x7E, 0x73, 0xFF, 0x0D, 0x86, 0x79, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x82, 0x76, 0xFB, 0x0D, 0x86, 0x78, 0x84, 0x0D, 0x7D, 0x73, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0x0D, 0x7C, 0x75, 0x66, 0x0C, 0x82, 0x75, 0xAC, 0x0B, 0x86, 0x7C, 0xEB, 0x0D, 0x84, 0x78, 0xFF, 0x0D, 0x8A, 0x7C, 0xFF, 0x0D, 0x8B, 0x7E, 0xFF, 0x0C, 0x85, 0x79, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0C, 0x7E, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7E, 0x73, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0D, 0x85, 0x79, 0xFF, 0x0D, 0x8B, 0x7E, 0xFF, 0x0D, 0x8A, 0x7C, 0xEC, 0x0C, 0x84, 0x77, 0xAD, 0x0B, 0x89, 0x7A, 0x66, 0x0A, 0x82, 0x73, 0x26, 0x0D, 0x7F, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8E, 0x0C, 0x83, 0x76, 0xFF, 0x0D, 0x89, 0x7C, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0D, 0x8A, 0x7D, 0xC4, 0x0D, 0x87, 0x7A, 0x28, 0x0C, 0x79, 0x6C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0x09, 0x84, 0x71, 0xD7, 0x0B, 0x7E, 0x73, 0xFF, 0x0D, 0x86, 0x79, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x82, 0x76, 0xFB, 0x0D, 0x86, 0x78, 0x8B, 0x0C, 0x7E, 0x73, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x07, 0x7F, 0x70, 0x6D, 0x0B, 0x85, 0x77, 0xBF, 0x0C, 0x88, 0x7C, 0xFD, 0x0C, 0x84, 0x77, 0xFF, 0x0D, 0x8C, 0x7E, 0xFF, 0x0D, 0x86, 0x79, 0xFF, 0x0C, 0x80, 0x73, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0C, 0x7F, 0x72, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7E, 0x73, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0D, 0x86, 0x7A, 0xFF, 0x0D, 0x8B, 0x7E, 0xFD, 0x0C, 0x85, 0x77, 0xC0, 0x0D, 0x88, 0x7B, 0x71, 0x0D, 0x80, 0x73, 0x22, 0x0F, 0x7F, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x71, 0x71, 0x95, 0x0B, 0x82, 0x76, 0xFF, 0x0D, 0x88, 0x7B, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0D, 0x8A, 0x7D, 0xC4, 0x0D, 0x87, 0x7A, 0x28, 0x0C, 0x79, 0x6C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0x09, 0x84, 0x71, 0xD7, 0x0B, 0x7E, 0x73, 0xFF, 0x0D, 0x86, 0x79, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x82, 0x76, 0xFC, 0x0D, 0x85, 0x78, 0x8C, 0x0C, 0x7D, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x7F, 0x5B, 0x64, 0x0C, 0x82, 0x72, 0xBF, 0x0C, 0x88, 0x7A, 0xFD, 0x0C, 0x86, 0x78, 0xFF, 0x0D, 0x8B, 0x7E, 0xFF, 0x0D, 0x84, 0x77, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x81, 0x75, 0xFF, 0x0C, 0x83, 0x76, 0xFF, 0x0C, 0x84, 0x77, 0xFF, 0x0D, 0x84, 0x78, 0xFF, 0x0D, 0x85, 0x78, 0xFF, 0x0C, 0x84, 0x77, 0xFF, 0x0C, 0x83, 0x76, 0xFF, 0x0C, 0x81, 0x75, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0D, 0x83, 0x77, 0xFF, 0x0D, 0x8B, 0x7E, 0xFF, 0x0C, 0x85, 0x78, 0xBF, 0x0D, 0x86, 0x7A, 0x64, 0x0A, 0x7F, 0x75, 0x10, 0x0F, 0x7F, 0x6F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x71, 0x71, 0x96, 0x0B, 0x81, 0x76, 0xFF, 0x0D, 0x88, 0x7B, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0D, 0x8A, 0x7D, 0xC4, 0x0D, 0x87, 0x7A, 0x28, 0x0C, 0x79, 0x6C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0x09, 0x84, 0x71, 0xD7, 0x0B, 0x7E, 0x73, 0xFF, 0x0D, 0x86, 0x79, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x82, 0x76, 0xFC, 0x0D, 0x85, 0x78, 0x8C, 0x0C, 0x7D, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x0C, 0x7B, 0x73, 0xAB, 0x0B, 0x81, 0x77, 0xF2, 0x0C, 0x87, 0x7A, 0xFF, 0x0D, 0x8B, 0x7D, 0xFF, 0x0D, 0x84, 0x77, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x82, 0x76, 0xFF, 0x0D, 0x86, 0x7A, 0xFF, 0x0D, 0x8A, 0x7D, 0xFF, 0x0D, 0x8B, 0x7E, 0xFF, 0x0D, 0x89, 0x7C, 0xFF, 0x0D, 0x85, 0x79, 0xFF, 0x0C, 0x81, 0x75, 0xFA, 0x0C, 0x81, 0x74, 0xF6, 0x0B, 0x81, 0x75, 0xF6, 0x0B, 0x81, 0x76, 0xFA, 0x0C, 0x80, 0x75, 0xFF, 0x0C, 0x81, 0x75, 0xFF, 0x0C, 0x85, 0x79, 0xFF, 0x0D, 0x89, 0x7B, 0xFF, 0x0D, 0x8B, 0x7E, 0xFF, 0x0D, 0x8A, 0x7E, 0xFF, 0x0D, 0x87, 0x7A, 0xFF, 0x0C, 0x82, 0x75, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0C, 0x84, 0x77, 0xFF, 0x0D, 0x8B, 0x7E, 0xF3, 0x0C, 0x87, 0x7A, 0xAA, 0x0D, 0x85, 0x78, 0x3E, 0x0C, 0x7F, 0x73, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x71, 0x71, 0x96, 0x0B, 0x81, 0x76, 0xFF, 0x0D, 0x88, 0x7B, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0D, 0x8A, 0x7D, 0xC4, 0x0D, 0x87, 0x7A, 0x28, 0x0C, 0x79, 0x6C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0x09, 0x84, 0x71, 0xD7, 0x0B, 0x7E, 0x73, 0xFF, 0x0D, 0x86, 0x79, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x82, 0x76, 0xFC, 0x0D, 0x85, 0x78, 0x8C, 0x0C, 0x7D, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x17, 0x5C, 0x5C, 0x70, 0x0B, 0x81, 0x76, 0xD9, 0x0C, 0x88, 0x7B, 0xFF, 0x0D, 0x89, 0x7D, 0xFF, 0x0D, 0x86, 0x79, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7E, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0D, 0x82, 0x76, 0xFF, 0x0D, 0x89, 0x7C, 0xFF, 0x0D, 0x8B, 0x7E, 0xFF, 0x0C, 0x82, 0x76, 0xE1, 0x0C, 0x82, 0x76, 0xBB, 0x0C, 0x85, 0x77, 0x99, 0x0B, 0x85, 0x79, 0x7F, 0x0C, 0x82, 0x76, 0x6A, 0x0C, 0x7F, 0x73, 0x5A, 0x0B, 0x7C, 0x71, 0x4E, 0x09, 0x7C, 0x6F, 0x49, 0x0A, 0x7D, 0x73, 0x49, 0x0A, 0x7A, 0x6F, 0x4D, 0x09, 0x7D, 0x70, 0x59, 0x0B, 0x7B, 0x6F, 0x69, 0x09, 0x7E, 0x74, 0x7E, 0x0C, 0x83, 0x77, 0x98, 0x0B, 0x86, 0x78, 0xB9, 0x0C, 0x85, 0x7A, 0xE0, 0x0C, 0x82, 0x76, 0xFF, 0x0C, 0x82, 0x75, 0xFF, 0x0D, 0x8A, 0x7D, 0xFF, 0x0D, 0x89, 0x7C, 0xFF, 0x0C, 0x83, 0x76, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7E, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0D, 0x86, 0x79, 0xFF, 0x0D, 0x8A, 0x7E, 0xD9, 0x0C, 0x88, 0x7B, 0x75, 0x0D, 0x80, 0x73, 0x0E, 0x12, 0x6D, 0x6D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x71, 0x71, 0x96, 0x0B, 0x81, 0x76, 0xFF, 0x0D, 0x88, 0x7B, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0D, 0x8A, 0x7D, 0xC4, 0x0D, 0x87, 0x7A, 0x28, 0x0C, 0x79, 0x6C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0x09, 0x84, 0x71, 0xD7, 0x0B, 0x7E, 0x73, 0xFF, 0x0D, 0x86, 0x79, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x82, 0x76, 0xFC, 0x0D, 0x85, 0x78, 0x8C, 0x0C, 0x7D, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x0D, 0x78, 0x72, 0xA2, 0x0C, 0x82, 0x76, 0xF4, 0x0C, 0x88, 0x7C, 0xFF, 0x0D, 0x89, 0x7C, 0xFF, 0x0C, 0x81, 0x75, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0D, 0x86, 0x79, 0xFF, 0x0D, 0x8A, 0x7D, 0xFC, 0x0C, 0x81, 0x75, 0xC7, 0x0C, 0x85, 0x78, 0x8B, 0x0C, 0x85, 0x79, 0x57, 0x0B, 0x80, 0x75, 0x36, 0x09, 0x7A, 0x71, 0x21, 0x07, 0x7B, 0x6C, 0x0F, 0x11, 0x77, 0x66, 0x01, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0F, 0x11, 0x77, 0x66, 0x20, 0x07, 0x7F, 0x6F, 0x35, 0x09, 0x7D, 0x6E, 0x56, 0x0B, 0x7F, 0x73, 0x89, 0x0D, 0x86, 0x78, 0xC5, 0x0C, 0x85, 0x78, 0xFC, 0x0C, 0x81, 0x74, 0xFF, 0x0D, 0x8A, 0x7E, 0xFF, 0x0D, 0x86, 0x7A, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0C, 0x81, 0x75, 0xFF, 0x0D, 0x8A, 0x7C, 0xF6, 0x0D, 0x88, 0x7C, 0xA4, 0x0C, 0x84, 0x77, 0x25, 0x0D, 0x7C, 0x6E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x71, 0x71, 0x96, 0x0B, 0x81, 0x76, 0xFF, 0x0D, 0x88, 0x7B, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0D, 0x8A, 0x7D, 0xC4, 0x0D, 0x87, 0x7A, 0x28, 0x0C, 0x79, 0x6C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0x09, 0x84, 0x71, 0xD7, 0x0B, 0x7E, 0x73, 0xFF, 0x0D, 0x86, 0x79, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x82, 0x76, 0xFC, 0x0D, 0x85, 0x78, 0x8C, 0x0C, 0x7D, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x0C, 0x7D, 0x75, 0xC4, 0x0D, 0x86, 0x78, 0xFF, 0x0D, 0x89, 0x7C, 0xFF, 0x0D, 0x85, 0x79, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x80, 0x73, 0xFF, 0x0D, 0x86, 0x7A, 0xFF, 0x0D, 0x89, 0x7C, 0xE3, 0x0B, 0x82, 0x75, 0x94, 0x0C, 0x84, 0x7A, 0x4B, 0x0D, 0x81, 0x76, 0x25, 0x0D, 0x7C, 0x6E, 0x0A, 0x19, 0x7F, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x71, 0x71, 0x24, 0x0E, 0x78, 0x71, 0x4D, 0x0D, 0x7D, 0x73, 0x91, 0x0C, 0x87, 0x7B, 0xE0, 0x0B, 0x82, 0x76, 0xFF, 0x0D, 0x89, 0x7B, 0xFF, 0x0D, 0x86, 0x7A, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0D, 0x85, 0x79, 0xFF, 0x0D, 0x8A, 0x7D, 0xC2, 0x0B, 0x88, 0x7A, 0x40, 0x0B, 0x7F, 0x73, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x71, 0x71, 0x96, 0x0B, 0x81, 0x76, 0xFF, 0x0D, 0x88, 0x7B, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0D, 0x8A, 0x7D, 0xC4, 0x0D, 0x87, 0x7A, 0x28, 0x0C, 0x79, 0x6C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0x09, 0x84, 0x71, 0xD7, 0x0B, 0x7E, 0x73, 0xFF, 0x0D, 0x86, 0x79, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x82, 0x76, 0xFC, 0x0D, 0x85, 0x78, 0x8C, 0x0C, 0x7D, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x51, 0x0C, 0x81, 0x71, 0xD6, 0x0D, 0x89, 0x7B, 0xFF, 0x0D, 0x8B, 0x7D, 0xFF, 0x0C, 0x82, 0x76, 0xFF, 0x0C, 0x7E, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x85, 0x78, 0xFF, 0x0D, 0x89, 0x7C, 0xDE, 0x0C, 0x82, 0x76, 0x7D, 0x0C, 0x86, 0x78, 0x31, 0x0A, 0x7C, 0x72, 0x0D, 0x13, 0x75, 0x75, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x15, 0x7F, 0x6A, 0x2C, 0x0B, 0x7F, 0x6E, 0x7A, 0x0C, 0x85, 0x79, 0xD8, 0x0C, 0x84, 0x78, 0xFF, 0x0D, 0x88, 0x7B, 0xFF, 0x0C, 0x85, 0x78, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0C, 0x82, 0x75, 0xFF, 0x0D, 0x8B, 0x7E, 0xDB, 0x0C, 0x87, 0x79, 0x54, 0x0C, 0x7C, 0x73, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x71, 0x71, 0x96, 0x0B, 0x81, 0x76, 0xFF, 0x0D, 0x88, 0x7B, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0D, 0x8A, 0x7D, 0xC4, 0x0D, 0x87, 0x7A, 0x28, 0x0C, 0x79, 0x6C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0x09, 0x84, 0x71, 0xD7, 0x0B, 0x7E, 0x73, 0xFF, 0x0D, 0x86, 0x79, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x82, 0x76, 0xFC, 0x0D, 0x85, 0x78, 0x8C, 0x0C, 0x7D, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5D, 0x0A, 0x7E, 0x73, 0xE1, 0x0C, 0x86, 0x7A, 0xFF, 0x0D, 0x8A, 0x7D, 0xFF, 0x0C, 0x81, 0x75, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x82, 0x75, 0xFF, 0x0D, 0x89, 0x7C, 0xEE, 0x0C, 0x83, 0x76, 0x87, 0x0B, 0x84, 0x78, 0x2C, 0x0B, 0x7F, 0x73, 0x06, 0x00, 0x7F, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x7F, 0x55, 0x26, 0x0D, 0x78, 0x72, 0x83, 0x0B, 0x84, 0x7A, 0xE8, 0x0C, 0x84, 0x78, 0xFF, 0x0D, 0x89, 0x7C, 0xFF, 0x0C, 0x82, 0x75, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0D, 0x89, 0x7C, 0xE8, 0x0C, 0x86, 0x78, 0x5C, 0x0B, 0x82, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x71, 0x71, 0x96, 0x0B, 0x81, 0x76, 0xFF, 0x0D, 0x88, 0x7B, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0D, 0x8A, 0x7D, 0xC4, 0x0D, 0x87, 0x7A, 0x28, 0x0C, 0x79, 0x6C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0x09, 0x84, 0x71, 0xD7, 0x0B, 0x7E, 0x73, 0xFF, 0x0D, 0x86, 0x79, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x82, 0x76, 0xFC, 0x0D, 0x85, 0x78, 0x8C, 0x0C, 0x7D, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5D, 0x0A, 0x7E, 0x73, 0xE5, 0x0C, 0x87, 0x7B, 0xFF, 0x0D, 0x89, 0x7C, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x85, 0x78, 0xFC, 0x0D, 0x87, 0x7A, 0xB4, 0x0C, 0x85, 0x78, 0x40, 0x0B, 0x7F, 0x73, 0x08, 0x00, 0x7F, 0x5F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x6D, 0x6D, 0x39, 0x08, 0x81, 0x74, 0xAF, 0x0B, 0x83, 0x77, 0xFC, 0x0D, 0x86, 0x7A, 0xFF, 0x0C, 0x85, 0x79, 0xFF, 0x0C, 0x7F, 0x74, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0D, 0x88, 0x7B, 0xED, 0x0C, 0x85, 0x78, 0x5D, 0x0D, 0x7E, 0x73, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x71, 0x71, 0x96, 0x0B, 0x81, 0x76, 0xFF, 0x0D, 0x88, 0x7B, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0D, 0x8A, 0x7D, 0xC4, 0x0D, 0x87, 0x7A, 0x28, 0x0C, 0x79, 0x6C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0x09, 0x84, 0x71, 0xD7, 0x0B, 0x7E, 0x73, 0xFF, 0x0D, 0x86, 0x79, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x82, 0x76, 0xFC, 0x0D, 0x85, 0x78, 0x8C, 0x0C, 0x7D, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x0C, 0x81, 0x75, 0xE1, 0x0C, 0x87, 0x7B, 0xFF, 0x0D, 0x89, 0x7C, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x87, 0x7A, 0xEE, 0x0C, 0x84, 0x77, 0x7A, 0x0C, 0x83, 0x77, 0x10, 0x0F, 0x6F, 0x6F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x0E, 0x71, 0x71, 0x75, 0x0D, 0x82, 0x75, 0xEA, 0x0B, 0x83, 0x76, 0xFF, 0x0D, 0x88, 0x7B, 0xFF, 0x0C, 0x81, 0x75, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0D, 0x88, 0x7B, 0xEA, 0x0D, 0x86, 0x78, 0x53, 0x0C, 0x7D, 0x71, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x71, 0x71, 0x96, 0x0B, 0x81, 0x76, 0xFF, 0x0D, 0x88, 0x7B, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0D, 0x8A, 0x7D, 0xC4, 0x0D, 0x87, 0x7A, 0x28, 0x0C, 0x79, 0x6C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0x09, 0x84, 0x71, 0xD7, 0x0B, 0x7E, 0x73, 0xFF, 0x0D, 0x86, 0x79, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x82, 0x76, 0xFC, 0x0D, 0x85, 0x78, 0x8C, 0x0C, 0x7D, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x0B, 0x7B, 0x70, 0xD7, 0x0D, 0x87, 0x7B, 0xFF, 0x0D, 0x8A, 0x7D, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x81, 0x75, 0xFF, 0x0D, 0x88, 0x7B, 0xD7, 0x0B, 0x82, 0x77, 0x51, 0x0C, 0x7D, 0x71, 0x04, 0x00, 0x7F, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x55, 0x55, 0x48, 0x0A, 0x7F, 0x74, 0xCD, 0x0C, 0x86, 0x79, 0xFF, 0x0D, 0x88, 0x7C, 0xFF, 0x0C, 0x81, 0x75, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0D, 0x89, 0x7C, 0xDF, 0x0C, 0x85, 0x79, 0x41, 0x0B, 0x7D, 0x71, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x71, 0x71, 0x96, 0x0B, 0x81, 0x76, 0xFF, 0x0D, 0x88, 0x7B, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0D, 0x8A, 0x7D, 0xC4, 0x0D, 0x87, 0x7A, 0x28, 0x0C, 0x79, 0x6C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0x09, 0x84, 0x71, 0xD7, 0x0B, 0x7E, 0x73, 0xFF, 0x0D, 0x86, 0x79, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x82, 0x76, 0xFC, 0x0D, 0x85, 0x78, 0x8C, 0x0C, 0x7D, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2A, 0x0C, 0x79, 0x6D, 0xC2, 0x0B, 0x87, 0x7A, 0xFF, 0x0D, 0x8B, 0x7E, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x82, 0x76, 0xFF, 0x0D, 0x88, 0x7B, 0xC2, 0x0B, 0x82, 0x76, 0x32, 0x0A, 0x7F, 0x75, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x0C, 0x7F, 0x72, 0x3E, 0x0C, 0x87, 0x77, 0x60, 0x0D, 0x84, 0x7A, 0x5E, 0x0D, 0x84, 0x77, 0x3A, 0x08, 0x7F, 0x76, 0x10, 0x0F, 0x7F, 0x6F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2B, 0x0B, 0x76, 0x70, 0xB6, 0x0C, 0x86, 0x78, 0xFE, 0x0D, 0x89, 0x7C, 0xFF, 0x0C, 0x82, 0x76, 0xFF, 0x0C, 0x7E, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0D, 0x8B, 0x7E, 0xCA, 0x0C, 0x84, 0x77, 0x2B, 0x0B, 0x76, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x71, 0x71, 0x96, 0x0B, 0x81, 0x76, 0xFF, 0x0D, 0x88, 0x7B, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0D, 0x8A, 0x7D, 0xC4, 0x0D, 0x87, 0x7A, 0x28, 0x0C, 0x79, 0x6C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0x09, 0x84, 0x71, 0xD7, 0x0B, 0x7E, 0x73, 0xFF, 0x0D, 0x86, 0x79, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x82, 0x76, 0xFC, 0x0D, 0x85, 0x78, 0x8C, 0x0C, 0x7D, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x7F, 0x6D, 0xA5, 0x0C, 0x83, 0x75, 0xFF, 0x0D, 0x8B, 0x7D, 0xFF, 0x0C, 0x81, 0x75, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0C, 0x81, 0x75, 0xFF, 0x0D, 0x89, 0x7C, 0xB7, 0x0C, 0x81, 0x76, 0x24, 0x0E, 0x78, 0x71, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x7F, 0x7F, 0x47, 0x0A, 0x81, 0x72, 0xB8, 0x0D, 0x85, 0x78, 0xF7, 0x0C, 0x83, 0x75, 0xFE, 0x0D, 0x86, 0x79, 0xFE, 0x0D, 0x86, 0x78, 0xF5, 0x0C, 0x83, 0x75, 0xAB, 0x0B, 0x86, 0x7A, 0x3B, 0x0C, 0x7D, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x10, 0x7B, 0x73, 0xAA, 0x0D, 0x85, 0x79, 0xFD, 0x0D, 0x8A, 0x7C, 0xFF, 0x0C, 0x83, 0x76, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0D, 0x8B, 0x7D, 0xA8, 0x0C, 0x82, 0x77, 0x14, 0x0C, 0x72, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x71, 0x71, 0x96, 0x0B, 0x81, 0x76, 0xFF, 0x0D, 0x88, 0x7B, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0D, 0x8A, 0x7D, 0xC4, 0x0D, 0x87, 0x7A, 0x28, 0x0C, 0x79, 0x6C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0x09, 0x84, 0x71, 0xD7, 0x0B, 0x7E, 0x73, 0xFF, 0x0D, 0x86, 0x79, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x82, 0x76, 0xFC, 0x0D, 0x85, 0x78, 0x8C, 0x0C, 0x7D, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x66, 0x66, 0x76, 0x0A, 0x81, 0x74, 0xFF, 0x0C, 0x86, 0x79, 0xFF, 0x0D, 0x84, 0x77, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7E, 0x73, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0D, 0x89, 0x7C, 0xB8, 0x0B, 0x82, 0x75, 0x1F, 0x08, 0x7B, 0x73, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x52, 0x0C, 0x7C, 0x73, 0xE9, 0x0C, 0x85, 0x79, 0xFF, 0x0D, 0x8B, 0x7E, 0xFF, 0x0C, 0x83, 0x76, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x84, 0x77, 0xFF, 0x0D, 0x8D, 0x80, 0xD9, 0x0C, 0x85, 0x77, 0x41, 0x0B, 0x7D, 0x71, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1D, 0x08, 0x7B, 0x72, 0xAA, 0x0C, 0x85, 0x79, 0xFE, 0x0D, 0x8A, 0x7C, 0xFF, 0x0C, 0x82, 0x75, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x82, 0x76, 0xFF, 0x0C, 0x87, 0x7B, 0x76, 0x0C, 0x7F, 0x72, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x71, 0x71, 0x96, 0x0B, 0x81, 0x76, 0xFF, 0x0D, 0x88, 0x7B, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0D, 0x8A, 0x7D, 0xC4, 0x0D, 0x87, 0x7A, 0x28, 0x0C, 0x79, 0x6C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1D, 0x08, 0x83, 0x72, 0xE3, 0x0C, 0x80, 0x74, 0xFF, 0x0E, 0x8F, 0x81, 0xFF, 0x0D, 0x87, 0x7B, 0xFF, 0x0D, 0x87, 0x7B, 0xFF, 0x0D, 0x87, 0x7B, 0xFF, 0x0D, 0x8B, 0x7E, 0xFF, 0x0E, 0x8D, 0x7F, 0x95, 0x0B, 0x7C, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0x0B, 0x7F, 0x73, 0xDE, 0x0C, 0x88, 0x7C, 0xFF, 0x0D, 0x89, 0x7C, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x74, 0xFF, 0x0D, 0x8A, 0x7D, 0xC6, 0x0B, 0x83, 0x76, 0x25, 0x06, 0x7C, 0x6E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1D, 0x11, 0x7B, 0x72, 0xD5, 0x0D, 0x82, 0x76, 0xFF, 0x0D, 0x8A, 0x7C, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0D, 0x8D, 0x7F, 0xBB, 0x0C, 0x82, 0x76, 0x14, 0x0C, 0x7F, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x07, 0x78, 0x6A, 0xB6, 0x0C, 0x86, 0x78, 0xFF, 0x0D, 0x8B, 0x7D, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0D, 0x86, 0x79, 0xEB, 0x0B, 0x84, 0x78, 0x3C, 0x08, 0x7F, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x66, 0x66, 0xA0, 0x0B, 0x82, 0x77, 0xFF, 0x0E, 0x92, 0x83, 0xFF, 0x0D, 0x88, 0x7C, 0xFF, 0x0D, 0x87, 0x7B, 0xFF, 0x0D, 0x87, 0x7B, 0xFF, 0x0D, 0x86, 0x7A, 0xFF, 0x0E, 0x93, 0x85, 0xCF, 0x0D, 0x89, 0x7B, 0x2A, 0x0C, 0x7F, 0x73, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x0C, 0x85, 0x6D, 0xA4, 0x0C, 0x7F, 0x74, 0xC3, 0x0D, 0x86, 0x79, 0xC2, 0x0B, 0x7F, 0x73, 0xC2, 0x0B, 0x7F, 0x73, 0xC2, 0x0B, 0x7F, 0x73, 0xC3, 0x0B, 0x82, 0x75, 0xC0, 0x0D, 0x86, 0x78, 0x6B, 0x0B, 0x7B, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x0E, 0x71, 0x71, 0xAF, 0x0D, 0x81, 0x76, 0xFF, 0x0D, 0x8C, 0x7F, 0xFF, 0x0C, 0x7F, 0x72, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0D, 0x89, 0x7C, 0xDC, 0x0B, 0x84, 0x77, 0x35, 0x09, 0x81, 0x73, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x0B, 0x7F, 0x74, 0xF7, 0x0C, 0x88, 0x7B, 0xFF, 0x0C, 0x83, 0x76, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0D, 0x87, 0x7A, 0xF0, 0x0B, 0x86, 0x79, 0x5F, 0x0A, 0x7E, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x0A, 0x7A, 0x6A, 0xCE, 0x0C, 0x84, 0x76, 0xFF, 0x0D, 0x8B, 0x7D, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0D, 0x8A, 0x7D, 0xB9, 0x0C, 0x81, 0x75, 0x13, 0x00, 0x78, 0x6B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x6D, 0x6D, 0x73, 0x08, 0x80, 0x77, 0xC3, 0x0D, 0x87, 0x7A, 0xC2, 0x0B, 0x80, 0x74, 0xC2, 0x0B, 0x7F, 0x73, 0xC2, 0x0B, 0x7F, 0x73, 0xC2, 0x0B, 0x7F, 0x72, 0xC3, 0x0D, 0x8A, 0x7D, 0x96, 0x0D, 0x87, 0x7A, 0x1E, 0x08, 0x77, 0x6E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x7F, 0x7F, 0x0E, 0x12, 0x7F, 0x6D, 0x12, 0x0E, 0x7F, 0x63, 0x10, 0x0F, 0x7F, 0x6F, 0x10, 0x0F, 0x7F, 0x6F, 0x10, 0x0F, 0x7F, 0x6F, 0x11, 0x0F, 0x78, 0x69, 0x11, 0x0F, 0x78, 0x78, 0x08, 0x00, 0x7F, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x7F, 0x7F, 0x63, 0x0C, 0x80, 0x76, 0xFD, 0x0D, 0x87, 0x78, 0xFF, 0x0D, 0x83, 0x76, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7E, 0x73, 0xFF, 0x0C, 0x86, 0x78, 0xEE, 0x0C, 0x89, 0x7B, 0x57, 0x0B, 0x80, 0x75, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA4, 0x0C, 0x7F, 0x71, 0xFF, 0x0D, 0x87, 0x79, 0xFF, 0x0C, 0x81, 0x75, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0D, 0x82, 0x75, 0xFF, 0x0C, 0x87, 0x79, 0x87, 0x09, 0x7E, 0x71, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4B, 0x0A, 0x7D, 0x70, 0xE9, 0x0C, 0x85, 0x77, 0xFF, 0x0D, 0x89, 0x7B, 0xFF, 0x0C, 0x7E, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x82, 0x75, 0xFF, 0x0D, 0x86, 0x79, 0x69, 0x0C, 0x7E, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x7F, 0x66, 0x12, 0x0E, 0x7F, 0x71, 0x10, 0x0F, 0x7F, 0x6F, 0x10, 0x0F, 0x7F, 0x6F, 0x10, 0x0F, 0x7F, 0x6F, 0x10, 0x0F, 0x7F, 0x6F, 0x13, 0x0D, 0x78, 0x6B, 0x0E, 0x12, 0x6D, 0x6D, 0x03, 0x00, 0x55, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0x0D, 0x75, 0x67, 0xCE, 0x0C, 0x81, 0x75, 0xFF, 0x0D, 0x8B, 0x7D, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7E, 0x73, 0xFF, 0x0C, 0x81, 0x75, 0xFF, 0x0D, 0x8A, 0x7C, 0x84, 0x0D, 0x81, 0x73, 0x09, 0x00, 0x71, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0x0C, 0x7D, 0x72, 0xFE, 0x0D, 0x86, 0x79, 0xFF, 0x0C, 0x81, 0x75, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x82, 0x76, 0xFF, 0x0C, 0x85, 0x79, 0x83, 0x0B, 0x7E, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7A, 0x0C, 0x81, 0x72, 0xF6, 0x0D, 0x89, 0x7D, 0xFF, 0x0C, 0x84, 0x78, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0D, 0x86, 0x7A, 0xD9, 0x0C, 0x82, 0x75, 0x1F, 0x10, 0x7B, 0x73, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x7F, 0x55, 0x72, 0x0D, 0x83, 0x76, 0xFF, 0x0D, 0x89, 0x7C, 0xFF, 0x0C, 0x81, 0x75, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0D, 0x8B, 0x7E, 0xC1, 0x0D, 0x81, 0x75, 0x19, 0x0A, 0x7A, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x89, 0x0D, 0x80, 0x73, 0xFD, 0x0D, 0x86, 0x78, 0xFF, 0x0C, 0x82, 0x76, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0D, 0x83, 0x77, 0xFF, 0x0D, 0x83, 0x77, 0x74, 0x0A, 0x7D, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x0B, 0x79, 0x6E, 0xB1, 0x0C, 0x83, 0x77, 0xFF, 0x0D, 0x8B, 0x7D, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x7E, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x81, 0x75, 0xFF, 0x0D, 0x88, 0x7A, 0x7F, 0x0C, 0x7E, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x0D, 0x78, 0x6B, 0xD5, 0x0B, 0x81, 0x74, 0xFF, 0x0D, 0x8A, 0x7C, 0xFF, 0x0C, 0x7E, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0D, 0x85, 0x78, 0xED, 0x0C, 0x87, 0x7B, 0x4F, 0x0C, 0x7D, 0x77, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x0A, 0x7F, 0x74, 0xCA, 0x0B, 0x84, 0x77, 0xFF, 0x0D, 0x83, 0x77, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0D, 0x83, 0x77, 0xC6, 0x0C, 0x84, 0x79, 0x48, 0x0A, 0x7F, 0x71, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0x0B, 0x79, 0x72, 0xE6, 0x0D, 0x85, 0x77, 0xFF, 0x0D, 0x88, 0x7B, 0xFF, 0x0C, 0x7E, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0D, 0x86, 0x79, 0xDC, 0x0C, 0x82, 0x76, 0x1E, 0x08, 0x7F, 0x77, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x7F, 0x7F, 0x69, 0x0C, 0x83, 0x76, 0xFF, 0x0D, 0x88, 0x7B, 0xFF, 0x0C, 0x81, 0x74, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0D, 0x8B, 0x7E, 0x96, 0x0B, 0x81, 0x76, 0x0D, 0x13, 0x62, 0x62, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x7F, 0x66, 0x70, 0x0B, 0x7F, 0x74, 0xE2, 0x0C, 0x87, 0x7A, 0xFF, 0x0C, 0x88, 0x7B, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x82, 0x76, 0xFF, 0x0D, 0x84, 0x78, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x85, 0x78, 0xFF, 0x0D, 0x82, 0x76, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0D, 0x89, 0x7C, 0xE2, 0x0D, 0x88, 0x7C, 0x71, 0x0D, 0x80, 0x75, 0x08, 0x00, 0x7F, 0x5F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x7F, 0x7F, 0x93, 0x0C, 0x80, 0x74, 0xFD, 0x0D, 0x88, 0x7B, 0xFF, 0x0D, 0x82, 0x76, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x82, 0x76, 0xFD, 0x0D, 0x86, 0x79, 0x77, 0x0A, 0x7E, 0x71, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x13, 0x75, 0x6B, 0xC2, 0x0D, 0x82, 0x77, 0xFF, 0x0D, 0x8A, 0x7D, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0D, 0x88, 0x7A, 0xE1, 0x0B, 0x85, 0x79, 0x3E, 0x0C, 0x7B, 0x6F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x08, 0x77, 0x6E, 0x98, 0x0B, 0x84, 0x75, 0xF5, 0x0C, 0x88, 0x7A, 0xFF, 0x0D, 0x88, 0x7B, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0D, 0x85, 0x79, 0xFE, 0x0C, 0x81, 0x75, 0xF4, 0x0C, 0x81, 0x75, 0xFF, 0x0C, 0x80, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x80, 0x73, 0xFD, 0x0B, 0x80, 0x73, 0xF2, 0x0B, 0x80, 0x74, 0xF8, 0x0D, 0x82, 0x77, 0xFF, 0x0D, 0x86, 0x79, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0D, 0x88, 0x7C, 0xF4, 0x0D, 0x88, 0x7B, 0x92, 0x0C, 0x86, 0x78, 0x1B, 0x09, 0x7A, 0x67, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2E, 0x0B, 0x79, 0x69, 0xD8, 0x0B, 0x84, 0x77, 0xFF, 0x0D, 0x88, 0x7B, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x86, 0x7A, 0xCE, 0x0C, 0x80, 0x73, 0x10, 0x0F, 0x7F, 0x6F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0x0A, 0x81, 0x73, 0xFA, 0x0D, 0x83, 0x77, 0xFF, 0x0C, 0x82, 0x76, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0D, 0x8B, 0x7D, 0x90, 0x0A, 0x81, 0x76, 0x09, 0x00, 0x71, 0x71, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3A, 0x08, 0x7F, 0x6D, 0xB7, 0x0B, 0x87, 0x79, 0xFF, 0x0D, 0x89, 0x7C, 0xFF, 0x0D, 0x85, 0x78, 0xFF, 0x0C, 0x7E, 0x73, 0xFF, 0x0D, 0x89, 0x7C, 0xE6, 0x0C, 0x86, 0x79, 0x68, 0x09, 0x7F, 0x73, 0x54, 0x0C, 0x7F, 0x70, 0xE7, 0x0C, 0x81, 0x75, 0xFF, 0x0C, 0x83, 0x76, 0xFF, 0x0D, 0x85, 0x78, 0xDE, 0x0B, 0x81, 0x75, 0x51, 0x0C, 0x7A, 0x71, 0x68, 0x0C, 0x7F, 0x75, 0xE7, 0x0D, 0x86, 0x7A, 0xFF, 0x0D, 0x8A, 0x7D, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0D, 0x84, 0x78, 0xFF, 0x0D, 0x89, 0x7B, 0xB7, 0x0C, 0x85, 0x77, 0x38, 0x0D, 0x7A, 0x71, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8E, 0x0A, 0x7F, 0x72, 0xFB, 0x0C, 0x88, 0x7A, 0xFF, 0x0D, 0x83, 0x76, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x84, 0x77, 0xF3, 0x0C, 0x86, 0x79, 0x52, 0x0C, 0x7F, 0x73, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x19, 0x7F, 0x66, 0x91, 0x0C, 0x83, 0x77, 0xFF, 0x0D, 0x8B, 0x7D, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0D, 0x87, 0x7A, 0xE7, 0x0C, 0x85, 0x79, 0x48, 0x0A, 0x78, 0x71, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5B, 0x0B, 0x80, 0x75, 0xD5, 0x0D, 0x87, 0x7A, 0xFF, 0x0D, 0x8A, 0x7D, 0xFF, 0x0C, 0x82, 0x75, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0D, 0x8B, 0x7E, 0xCC, 0x0C, 0x87, 0x7A, 0x48, 0x0A, 0x83, 0x74, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x7F, 0x7F, 0xD7, 0x0B, 0x80, 0x73, 0xFF, 0x0C, 0x85, 0x78, 0xFF, 0x0D, 0x87, 0x7A, 0xCD, 0x0C, 0x82, 0x74, 0x09, 0x00, 0xA9, 0x71, 0x00, 0x00, 0x00, 0x00, 0x4F, 0x0C, 0x81, 0x74, 0xCF, 0x0C, 0x86, 0x79, 0xFF, 0x0D, 0x8B, 0x7F, 0xFF, 0x0D, 0x80, 0x74, 0xFF, 0x0C, 0x82, 0x75, 0xFF, 0x0D, 0x8A, 0x7D, 0xD7, 0x0B, 0x84, 0x78, 0x5C, 0x0B, 0x7F, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0x0E, 0x78, 0x6E, 0xDD, 0x0C, 0x84, 0x79, 0xFF, 0x0D, 0x88, 0x7B, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x82, 0x75, 0xFD, 0x0D, 0x87, 0x7A, 0xA4, 0x0A, 0x7F, 0x73, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x07, 0x77, 0x67, 0xD8, 0x0B, 0x80, 0x73, 0xFF, 0x0C, 0x87, 0x7A, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0D, 0x8B, 0x7E, 0xA8, 0x0C, 0x84, 0x77, 0x0F, 0x00, 0x77, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x7F, 0x6F, 0x84, 0x0B, 0x81, 0x73, 0xEA, 0x0D, 0x89, 0x7B, 0xFF, 0x0D, 0x89, 0x7D, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0D, 0x83, 0x77, 0xFF, 0x0D, 0x88, 0x7A, 0xAB, 0x0D, 0x86, 0x78, 0x2F, 0x10, 0x82, 0x77, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x0B, 0x79, 0x79, 0xD8, 0x0B, 0x7F, 0x73, 0xFF, 0x0C, 0x85, 0x78, 0xFF, 0x0D, 0x87, 0x7A, 0xD1, 0x0C, 0x82, 0x75, 0x1C, 0x09, 0x7F, 0x76, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x0F, 0x77, 0x72, 0xAC, 0x0B, 0x85, 0x78, 0xFF, 0x0D, 0x89, 0x7B, 0xFF, 0x0D, 0x84, 0x77, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x88, 0x7B, 0xEA, 0x0D, 0x89, 0x7C, 0x80, 0x0D, 0x83, 0x77, 0x0B, 0x00, 0x73, 0x5C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x7F, 0x7F, 0xA6, 0x0C, 0x7D, 0x73, 0xFF, 0x0D, 0x86, 0x7A, 0xFF, 0x0C, 0x81, 0x75, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x86, 0x7A, 0xDB, 0x0B, 0x81, 0x75, 0x1C, 0x09, 0x7F, 0x6D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4A, 0x0A, 0x82, 0x75, 0xFD, 0x0C, 0x82, 0x75, 0xFF, 0x0C, 0x82, 0x76, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7E, 0x73, 0xFF, 0x0D, 0x84, 0x77, 0xFC, 0x0C, 0x84, 0x78, 0x68, 0x0C, 0x7D, 0x73, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x07, 0x78, 0x6A, 0xA9, 0x0C, 0x84, 0x78, 0xF9, 0x0C, 0x89, 0x7B, 0xFF, 0x0D, 0x86, 0x79, 0xFF, 0x0C, 0x7E, 0x73, 0xFF, 0x0D, 0x87, 0x7A, 0xF6, 0x0C, 0x85, 0x79, 0x86, 0x0D, 0x81, 0x75, 0x18, 0x0A, 0x74, 0x6A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x0A, 0x7F, 0x74, 0xD9, 0x0B, 0x7E, 0x74, 0xFF, 0x0C, 0x85, 0x78, 0xFF, 0x0D, 0x87, 0x7A, 0xD1, 0x0C, 0x82, 0x75, 0x1C, 0x09, 0x7F, 0x76, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x0B, 0x7F, 0x68, 0x87, 0x0B, 0x82, 0x75, 0xF3, 0x0C, 0x89, 0x7B, 0xFF, 0x0D, 0x88, 0x7B, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0D, 0x85, 0x79, 0xF7, 0x0D, 0x89, 0x7B, 0xA5, 0x0C, 0x84, 0x78, 0x25, 0x06, 0x75, 0x6E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0x0A, 0x7C, 0x6F, 0xED, 0x0C, 0x87, 0x7A, 0xFF, 0x0D, 0x85, 0x79, 0xFF, 0x0C, 0x7E, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x84, 0x77, 0xF0, 0x0C, 0x88, 0x7B, 0x5A, 0x0B, 0x7F, 0x71, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x6D, 0x6D, 0x84, 0x0D, 0x83, 0x77, 0xFF, 0x0D, 0x89, 0x7C, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0D, 0x8A, 0x7D, 0xD3, 0x0C, 0x86, 0x78, 0x35, 0x09, 0x78, 0x6E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x46, 0x0A, 0x7F, 0x70, 0xC7, 0x0C, 0x87, 0x7B, 0xFF, 0x0D, 0x89, 0x7C, 0xFF, 0x0C, 0x83, 0x76, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0D, 0x89, 0x7D, 0xDD, 0x0C, 0x88, 0x7A, 0x5D, 0x0A, 0x80, 0x75, 0x09, 0x00, 0x71, 0x71, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x0A, 0x7F, 0x74, 0xD9, 0x0B, 0x7E, 0x74, 0xFF, 0x0C, 0x85, 0x78, 0xFF, 0x0D, 0x87, 0x7A, 0xD0, 0x0C, 0x80, 0x74, 0x1A, 0x09, 0x7F, 0x75, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x66, 0x66, 0x5E, 0x0A, 0x84, 0x77, 0xE0, 0x0C, 0x86, 0x79, 0xFF, 0x0D, 0x89, 0x7C, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x83, 0x76, 0xFF, 0x0D, 0x88, 0x7B, 0xC9, 0x0C, 0x85, 0x78, 0x46, 0x0A, 0x7F, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x09, 0x7F, 0x75, 0xD1, 0x0C, 0x81, 0x76, 0xFF, 0x0D, 0x86, 0x7A, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x82, 0x75, 0xFD, 0x0D, 0x87, 0x79, 0x96, 0x0A, 0x7F, 0x71, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x0D, 0x6B, 0x6B, 0xBB, 0x0C, 0x80, 0x75, 0xFF, 0x0D, 0x87, 0x7B, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0D, 0x8A, 0x7D, 0xA4, 0x0A, 0x82, 0x76, 0x0A, 0x00, 0x66, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x71, 0x71, 0x6C, 0x0B, 0x7F, 0x76, 0xE6, 0x0C, 0x85, 0x78, 0xFF, 0x0D, 0x89, 0x7C, 0xFF, 0x0C, 0x81, 0x74, 0xFF, 0x0D, 0x82, 0x76, 0xFF, 0x0E, 0x89, 0x7D, 0xC1, 0x0B, 0x85, 0x79, 0x3A, 0x0D, 0x7F, 0x76, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x0A, 0x7F, 0x74, 0xD9, 0x0B, 0x7E, 0x74, 0xFF, 0x0C, 0x85, 0x78, 0xFF, 0x0D, 0x87, 0x7A, 0xD0, 0x0C, 0x80, 0x74, 0x1A, 0x09, 0x7F, 0x75, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x3F, 0x0C, 0x81, 0x75, 0xC3, 0x0B, 0x84, 0x78, 0xFF, 0x0D, 0x88, 0x7C, 0xFF, 0x0C, 0x83, 0x77, 0xFF, 0x0C, 0x81, 0x75, 0xFF, 0x0D, 0x88, 0x7B, 0xE7, 0x0C, 0x84, 0x77, 0x69, 0x0C, 0x80, 0x76, 0x05, 0x00, 0x66, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA1, 0x0C, 0x7D, 0x73, 0xFF, 0x0D, 0x86, 0x79, 0xFF, 0x0C, 0x82, 0x75, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x86, 0x79, 0xC4, 0x0A, 0x7F, 0x72, 0x08, 0x1F, 0x7F, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x23, 0x07, 0x7B, 0x74, 0xE5, 0x0C, 0x7E, 0x72, 0xFF, 0x0C, 0x84, 0x78, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x83, 0x76, 0xFE, 0x0C, 0x84, 0x77, 0x76, 0x0A, 0x7D, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x6D, 0x6D, 0x2D, 0x0B, 0x87, 0x76, 0x56, 0x0B, 0x82, 0x79, 0x5C, 0x0B, 0x85, 0x79, 0x39, 0x0D, 0x81, 0x78, 0x0A, 0x00, 0x7F, 0x66, 0x18, 0x0A, 0x7F, 0x74, 0x94, 0x0D, 0x81, 0x76, 0xF6, 0x0C, 0x86, 0x7B, 0xFF, 0x0D, 0x86, 0x79, 0xFF, 0x0C, 0x80, 0x73, 0xFF, 0x0D, 0x86, 0x79, 0xFA, 0x0D, 0x86, 0x7A, 0x9D, 0x0B, 0x81, 0x76, 0x21, 0x0F, 0x83, 0x73, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x0A, 0x7F, 0x74, 0xD9, 0x0B, 0x7E, 0x74, 0xFF, 0x0C, 0x85, 0x78, 0xFF, 0x0D, 0x87, 0x7A, 0xD0, 0x0C, 0x80, 0x74, 0x1A, 0x09, 0x7F, 0x75, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x0F, 0x77, 0x6F, 0x9D, 0x0C, 0x83, 0x76, 0xF9, 0x0D, 0x89, 0x7B, 0xFF, 0x0C, 0x86, 0x7A, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x86, 0x79, 0xF4, 0x0C, 0x87, 0x7B, 0x8F, 0x0C, 0x82, 0x77, 0x12, 0x00, 0x71, 0x71, 0x0C, 0x00, 0x7F, 0x6A, 0x3B, 0x08, 0x81, 0x79, 0x5C, 0x0B, 0x85, 0x77, 0x55, 0x0C, 0x84, 0x78, 0x2B, 0x11, 0x82, 0x76, 0x07, 0x00, 0x6D, 0x6D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6A, 0x0C, 0x7F, 0x75, 0xF3, 0x0C, 0x87, 0x79, 0xFF, 0x0C, 0x84, 0x77, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0D, 0x86, 0x78, 0xDE, 0x0C, 0x84, 0x77, 0x2B, 0x0B, 0x7C, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x0B, 0x7F, 0x74, 0xFC, 0x0C, 0x7F, 0x74, 0xFF, 0x0C, 0x82, 0x75, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0D, 0x87, 0x7A, 0xE7, 0x0D, 0x85, 0x79, 0x4F, 0x0C, 0x7A, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x0C, 0x82, 0x6F, 0x9C, 0x0D, 0x84, 0x77, 0xEB, 0x0B, 0x83, 0x75, 0xF6, 0x0C, 0x87, 0x7A, 0xF6, 0x0C, 0x87, 0x7C, 0xEC, 0x0B, 0x83, 0x76, 0xB8, 0x0C, 0x80, 0x73, 0xBA, 0x0C, 0x82, 0x75, 0xFD, 0x0D, 0x85, 0x79, 0xFF, 0x0C, 0x83, 0x76, 0xFF, 0x0C, 0x81, 0x74, 0xFF, 0x0D, 0x88, 0x7B, 0xE9, 0x0C, 0x86, 0x7A, 0x75, 0x0D, 0x80, 0x75, 0x0B, 0x00, 0x5C, 0x5C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x0A, 0x7F, 0x74, 0xD9, 0x0B, 0x7E, 0x74, 0xFF, 0x0C, 0x85, 0x78, 0xFF, 0x0D, 0x87, 0x7A, 0xD0, 0x0C, 0x80, 0x74, 0x1A, 0x09, 0x7F, 0x75, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x7F, 0x5F, 0x77, 0x0C, 0x82, 0x73, 0xE9, 0x0C, 0x87, 0x7B, 0xFF, 0x0C, 0x88, 0x7B, 0xFF, 0x0C, 0x81, 0x74, 0xFF, 0x0C, 0x84, 0x77, 0xF9, 0x0D, 0x87, 0x79, 0xBD, 0x0C, 0x7E, 0x74, 0xB7, 0x0C, 0x7E, 0x73, 0xF2, 0x0B, 0x81, 0x74, 0xF6, 0x0C, 0x87, 0x7B, 0xF6, 0x0C, 0x87, 0x7A, 0xEB, 0x0D, 0x83, 0x77, 0x9A, 0x0B, 0x84, 0x78, 0x2A, 0x0C, 0x7F, 0x73, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0x0D, 0x7D, 0x74, 0xE3, 0x0D, 0x85, 0x79, 0xFF, 0x0D, 0x85, 0x78, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0D, 0x85, 0x78, 0xEB, 0x0D, 0x87, 0x7A, 0x54, 0x0C, 0x7F, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x68, 0x0C, 0x81, 0x75, 0xFF, 0x0D, 0x85, 0x78, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0D, 0x89, 0x7C, 0xC9, 0x0C, 0x87, 0x79, 0x2E, 0x0B, 0x79, 0x6E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2C, 0x0B, 0x7F, 0x73, 0xCB, 0x0B, 0x83, 0x77, 0xFF, 0x0D, 0x8B, 0x7E, 0xFF, 0x0C, 0x85, 0x79, 0xFF, 0x0C, 0x82, 0x76, 0xFF, 0x0C, 0x82, 0x76, 0xFF, 0x0C, 0x83, 0x77, 0xFF, 0x0D, 0x86, 0x7A, 0xFF, 0x0D, 0x85, 0x79, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x82, 0x76, 0xFF, 0x0D, 0x8A, 0x7C, 0xD1, 0x0C, 0x87, 0x7A, 0x4E, 0x09, 0x7F, 0x75, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x09, 0x7F, 0x6B, 0xDB, 0x0C, 0x7E, 0x73, 0xFF, 0x0C, 0x85, 0x78, 0xFF, 0x0D, 0x87, 0x7A, 0xD0, 0x0C, 0x80, 0x74, 0x1A, 0x09, 0x7F, 0x75, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x51, 0x0C, 0x7D, 0x74, 0xD6, 0x0B, 0x84, 0x77, 0xFF, 0x0D, 0x89, 0x7B, 0xFF, 0x0C, 0x82, 0x76, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0D, 0x85, 0x78, 0xFF, 0x0D, 0x86, 0x79, 0xFF, 0x0C, 0x83, 0x76, 0xFF, 0x0C, 0x82, 0x76, 0xFF, 0x0C, 0x82, 0x76, 0xFF, 0x0C, 0x85, 0x78, 0xFF, 0x0E, 0x8C, 0x7F, 0xC5, 0x0C, 0x85, 0x78, 0x31, 0x0A, 0x7C, 0x6D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x0C, 0x7F, 0x72, 0xD3, 0x0C, 0x7D, 0x71, 0xFF, 0x0C, 0x85, 0x79, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x84, 0x77, 0xF6, 0x0C, 0x86, 0x7A, 0x78, 0x0A, 0x7F, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x7F, 0x55, 0x88, 0x0D, 0x81, 0x76, 0xFF, 0x0D, 0x87, 0x7A, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0D, 0x89, 0x7D, 0xB2, 0x0C, 0x82, 0x76, 0x11, 0x0F, 0x78, 0x69, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x91, 0x6D, 0xAC, 0x0B, 0x80, 0x75, 0xFF, 0x0D, 0x8A, 0x7D, 0xFF, 0x0C, 0x82, 0x76, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x81, 0x75, 0xF4, 0x0C, 0x86, 0x7B, 0xB4, 0x0C, 0x82, 0x76, 0x2F, 0x0A, 0x82, 0x71, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x09, 0x7F, 0x6B, 0xDB, 0x0C, 0x7E, 0x73, 0xFF, 0x0C, 0x85, 0x78, 0xFF, 0x0D, 0x87, 0x7A, 0xD0, 0x0C, 0x80, 0x74, 0x1A, 0x09, 0x7F, 0x75, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x0F, 0x7F, 0x6F, 0xB4, 0x0C, 0x82, 0x76, 0xF5, 0x0C, 0x87, 0x79, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x82, 0x76, 0xFF, 0x0D, 0x8C, 0x80, 0xA3, 0x0C, 0x83, 0x76, 0x0C, 0x00, 0x6A, 0x6A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB6, 0x0C, 0x7E, 0x71, 0xFF, 0x0C, 0x86, 0x79, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x82, 0x76, 0xFF, 0x0C, 0x84, 0x79, 0x95, 0x0A, 0x7E, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x73, 0x5C, 0xA2, 0x0C, 0x81, 0x76, 0xFF, 0x0D, 0x88, 0x7B, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0D, 0x89, 0x7B, 0x9D, 0x0C, 0x7E, 0x73, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x46, 0x0A, 0x7F, 0x74, 0xE5, 0x0C, 0x88, 0x7B, 0xFF, 0x0D, 0x87, 0x7A, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x86, 0x79, 0xAD, 0x0B, 0x81, 0x74, 0x12, 0x0E, 0x7F, 0x63, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x09, 0x7F, 0x6B, 0xDB, 0x0C, 0x7E, 0x73, 0xFF, 0x0C, 0x85, 0x78, 0xFF, 0x0D, 0x87, 0x7A, 0xD0, 0x0C, 0x80, 0x74, 0x1A, 0x09, 0x7F, 0x75, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x0C, 0x72, 0x72, 0xB2, 0x0B, 0x80, 0x75, 0xFF, 0x0D, 0x86, 0x79, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0D, 0x88, 0x7C, 0xE8, 0x0C, 0x84, 0x78, 0x4A, 0x0A, 0x7C, 0x71, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x99, 0x0B, 0x7E, 0x72, 0xFE, 0x0D, 0x85, 0x79, 0xFF, 0x0C, 0x81, 0x75, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x81, 0x75, 0xFF, 0x0C, 0x86, 0x79, 0xAC, 0x0B, 0x7E, 0x73, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x11, 0x77, 0x66, 0xB7, 0x0B, 0x81, 0x75, 0xFF, 0x0D, 0x87, 0x7B, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x81, 0x75, 0xFF, 0x0C, 0x86, 0x79, 0x85, 0x0B, 0x80, 0x73, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x79, 0x0C, 0x7C, 0x71, 0xF6, 0x0C, 0x86, 0x7A, 0xFF, 0x0C, 0x84, 0x78, 0xFF, 0x0C, 0x7E, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x81, 0x75, 0xFF, 0x0C, 0x87, 0x7A, 0x9D, 0x0B, 0x7E, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x09, 0x7F, 0x6B, 0xDB, 0x0C, 0x7E, 0x73, 0xFF, 0x0C, 0x85, 0x78, 0xFF, 0x0D, 0x87, 0x7A, 0xD0, 0x0C, 0x80, 0x74, 0x1A, 0x09, 0x7F, 0x75, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0x0B, 0x7F, 0x74, 0xFE, 0x0D, 0x87, 0x7A, 0xFF, 0x0C, 0x81, 0x75, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x82, 0x76, 0xFF, 0x0C, 0x84, 0x78, 0x6D, 0x09, 0x7B, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x82, 0x0D, 0x7F, 0x73, 0xF9, 0x0D, 0x87, 0x7A, 0xFF, 0x0C, 0x82, 0x76, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x86, 0x7A, 0xBF, 0x0C, 0x7D, 0x72, 0x06, 0x00, 0x7F, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x0F, 0x78, 0x69, 0xC6, 0x0B, 0x7F, 0x75, 0xFF, 0x0D, 0x86, 0x7A, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0D, 0x83, 0x76, 0xFE, 0x0C, 0x83, 0x76, 0x74, 0x0A, 0x7F, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x83, 0x0B, 0x7C, 0x70, 0xFA, 0x0C, 0x85, 0x79, 0xFF, 0x0C, 0x83, 0x77, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0D, 0x85, 0x78, 0xD6, 0x0B, 0x81, 0x74, 0x55, 0x0C, 0x81, 0x75, 0x1F, 0x08, 0x7B, 0x73, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x09, 0x7F, 0x6B, 0xDB, 0x0C, 0x7E, 0x73, 0xFF, 0x0C, 0x85, 0x78, 0xFF, 0x0D, 0x87, 0x7A, 0xD0, 0x0C, 0x80, 0x74, 0x1A, 0x09, 0x7F, 0x75, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x08, 0x83, 0x73, 0x53, 0x0C, 0x81, 0x74, 0xDA, 0x0B, 0x81, 0x74, 0xFF, 0x0D, 0x83, 0x78, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x81, 0x75, 0xFF, 0x0C, 0x86, 0x79, 0x76, 0x0A, 0x7D, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x71, 0x0D, 0x80, 0x70, 0xF4, 0x0C, 0x87, 0x7B, 0xFF, 0x0C, 0x83, 0x77, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0D, 0x87, 0x7A, 0xCB, 0x0C, 0x80, 0x72, 0x12, 0x0E, 0x7F, 0x71, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x0E, 0x7F, 0x71, 0xCE, 0x0C, 0x80, 0x73, 0xFF, 0x0D, 0x86, 0x79, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7E, 0x73, 0xFF, 0x0D, 0x84, 0x77, 0xF8, 0x0C, 0x83, 0x77, 0x6B, 0x0B, 0x79, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0x0C, 0x7D, 0x73, 0xF1, 0x0C, 0x89, 0x7B, 0xFF, 0x0C, 0x85, 0x79, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x83, 0x77, 0xF9, 0x0C, 0x82, 0x75, 0xB6, 0x0C, 0x87, 0x7B, 0x6C, 0x0E, 0x84, 0x76, 0x33, 0x0A, 0x82, 0x73, 0x06, 0x00, 0x7F, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0x09, 0x7A, 0x67, 0xDB, 0x0C, 0x7E, 0x73, 0xFF, 0x0C, 0x85, 0x78, 0xFF, 0x0D, 0x87, 0x7A, 0xD0, 0x0C, 0x80, 0x74, 0x1B, 0x09, 0x7A, 0x71, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x6D, 0x6D, 0x34, 0x09, 0x7F, 0x75, 0x70, 0x0D, 0x81, 0x76, 0xB7, 0x0C, 0x88, 0x7A, 0xF8, 0x0C, 0x82, 0x77, 0xFF, 0x0C, 0x83, 0x76, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0C, 0x85, 0x78, 0xFA, 0x0C, 0x84, 0x78, 0x61, 0x0A, 0x7B, 0x71, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x64, 0x0C, 0x7F, 0x75, 0xF1, 0x0C, 0x88, 0x7B, 0xFF, 0x0C, 0x83, 0x77, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0D, 0x86, 0x7A, 0xD0, 0x0C, 0x80, 0x74, 0x19, 0x0A, 0x7A, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x0D, 0x78, 0x6B, 0xD3, 0x0A, 0x7E, 0x72, 0xFF, 0x0D, 0x86, 0x79, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0D, 0x85, 0x78, 0xF5, 0x0C, 0x84, 0x77, 0x66, 0x0C, 0x7D, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x23, 0x0E, 0x7B, 0x74, 0xD5, 0x0B, 0x84, 0x78, 0xFF, 0x0D, 0x8A, 0x7D, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0C, 0x7E, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0C, 0x81, 0x75, 0xFF, 0x0D, 0x86, 0x7A, 0xFF, 0x0C, 0x81, 0x75, 0xFF, 0x0C, 0x83, 0x76, 0xFF, 0x0D, 0x8A, 0x7D, 0xFF, 0x0D, 0x86, 0x7A, 0xD6, 0x0D, 0x86, 0x79, 0x90, 0x0C, 0x84, 0x7A, 0x4E, 0x09, 0x7F, 0x72, 0x19, 0x0A, 0x84, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x0F, 0x78, 0x69, 0xD8, 0x0C, 0x7E, 0x73, 0xFF, 0x0C, 0x85, 0x78, 0xFF, 0x0D, 0x87, 0x7A, 0xCC, 0x0B, 0x80, 0x74, 0x0F, 0x00, 0x77, 0x77, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x0A, 0x84, 0x70, 0x4D, 0x0D, 0x7D, 0x73, 0x90, 0x0C, 0x84, 0x78, 0xD7, 0x0D, 0x86, 0x7A, 0xFF, 0x0D, 0x87, 0x7A, 0xFF, 0x0D, 0x8A, 0x7D, 0xFF, 0x0C, 0x83, 0x77, 0xFF, 0x0C, 0x81, 0x75, 0xFF, 0x0D, 0x86, 0x79, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x7E, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0D, 0x8D, 0x80, 0xCE, 0x0C, 0x85, 0x7A, 0x2B, 0x0B, 0x7C, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0x0A, 0x80, 0x73, 0xF0, 0x0C, 0x88, 0x7B, 0xFF, 0x0C, 0x83, 0x77, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0D, 0x87, 0x7A, 0xD2, 0x0C, 0x81, 0x75, 0x1D, 0x08, 0x7B, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x0C, 0x7F, 0x66, 0xD4, 0x0A, 0x7F, 0x73, 0xFF, 0x0D, 0x85, 0x79, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0D, 0x85, 0x78, 0xF3, 0x0C, 0x85, 0x78, 0x64, 0x0C, 0x7F, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6E, 0x0B, 0x7D, 0x73, 0xF9, 0x0C, 0x86, 0x79, 0xFF, 0x0D, 0x8B, 0x7E, 0xFF, 0x0C, 0x80, 0x75, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x84, 0x78, 0xFF, 0x0D, 0x86, 0x79, 0xED, 0x0B, 0x84, 0x78, 0xFF, 0x0C, 0x86, 0x79, 0xFF, 0x0D, 0x8A, 0x7D, 0xFF, 0x0D, 0x82, 0x76, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0D, 0x88, 0x7B, 0xFF, 0x0D, 0x8B, 0x7E, 0xEF, 0x0C, 0x85, 0x77, 0xAE, 0x0D, 0x88, 0x7B, 0x69, 0x0C, 0x83, 0x76, 0x31, 0x0A, 0x7C, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x0C, 0x79, 0x6C, 0xE1, 0x0B, 0x7E, 0x74, 0xFF, 0x0C, 0x84, 0x77, 0xFF, 0x0D, 0x86, 0x79, 0xD7, 0x0B, 0x81, 0x75, 0x25, 0x06, 0x7C, 0x6E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x0A, 0x82, 0x72, 0x6E, 0x0B, 0x7F, 0x73, 0xAE, 0x0B, 0x88, 0x7B, 0xF0, 0x0C, 0x83, 0x78, 0xFF, 0x0D, 0x8B, 0x7D, 0xFF, 0x0D, 0x88, 0x7B, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0D, 0x82, 0x76, 0xFF, 0x0D, 0x8A, 0x7D, 0xFF, 0x0C, 0x86, 0x79, 0xEE, 0x0B, 0x83, 0x76, 0xFF, 0x0D, 0x85, 0x79, 0xFF, 0x0D, 0x84, 0x77, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7E, 0x73, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0D, 0x8B, 0x7E, 0xF4, 0x0C, 0x89, 0x7C, 0x6A, 0x0C, 0x7F, 0x75, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0x0A, 0x80, 0x70, 0xF0, 0x0C, 0x88, 0x7B, 0xFF, 0x0C, 0x83, 0x77, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0D, 0x87, 0x7A, 0xD2, 0x0C, 0x81, 0x75, 0x1D, 0x08, 0x7B, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x0C, 0x7F, 0x66, 0xD4, 0x0A, 0x7F, 0x73, 0xFF, 0x0D, 0x85, 0x79, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0D, 0x85, 0x78, 0xF3, 0x0C, 0x85, 0x78, 0x64, 0x0C, 0x7C, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x1F, 0x7F, 0x7F, 0x7A, 0x0C, 0x81, 0x77, 0xE2, 0x0C, 0x89, 0x7D, 0xFF, 0x0C, 0x85, 0x79, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x81, 0x75, 0xF3, 0x0B, 0x85, 0x78, 0xA1, 0x0C, 0x83, 0x78, 0x56, 0x0B, 0x7C, 0x6D, 0x81, 0x09, 0x82, 0x74, 0xC8, 0x0C, 0x88, 0x7B, 0xFF, 0x0C, 0x83, 0x77, 0xFF, 0x0D, 0x8B, 0x7E, 0xFF, 0x0D, 0x86, 0x79, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0D, 0x85, 0x78, 0xFF, 0x0D, 0x8B, 0x7E, 0xFF, 0x0D, 0x85, 0x77, 0xCB, 0x0C, 0x88, 0x7B, 0x8A, 0x0C, 0x85, 0x76, 0x48, 0x07, 0x7B, 0x71, 0x14, 0x0C, 0x72, 0x72, 0x45, 0x0E, 0x7D, 0x72, 0xB3, 0x0C, 0x87, 0x7A, 0xF9, 0x0C, 0x82, 0x76, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x81, 0x74, 0xF7, 0x0C, 0x84, 0x77, 0xB4, 0x0C, 0x86, 0x79, 0x44, 0x0B, 0x7F, 0x70, 0x11, 0x0F, 0x78, 0x69, 0x48, 0x0A, 0x7F, 0x71, 0x8A, 0x0B, 0x85, 0x78, 0xCC, 0x0C, 0x88, 0x7B, 0xFF, 0x0C, 0x85, 0x78, 0xFF, 0x0D, 0x8B, 0x7E, 0xFF, 0x0C, 0x85, 0x78, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0D, 0x85, 0x79, 0xFF, 0x0D, 0x8B, 0x7E, 0xFE, 0x0D, 0x83, 0x76, 0xC8, 0x0C, 0x87, 0x7B, 0x84, 0x09, 0x81, 0x71, 0x57, 0x0B, 0x7B, 0x6F, 0xA5, 0x0C, 0x80, 0x73, 0xF4, 0x0C, 0x85, 0x79, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x74, 0xFF, 0x0C, 0x86, 0x79, 0xE2, 0x0D, 0x89, 0x7D, 0x76, 0x0C, 0x81, 0x76, 0x0D, 0x13, 0x75, 0x62, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0x0A, 0x7E, 0x70, 0xF0, 0x0C, 0x88, 0x7B, 0xFF, 0x0C, 0x83, 0x77, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0D, 0x87, 0x7A, 0xD2, 0x0C, 0x81, 0x75, 0x1D, 0x08, 0x7B, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x0C, 0x7F, 0x66, 0xD4, 0x0A, 0x7F, 0x73, 0xFF, 0x0D, 0x85, 0x79, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0D, 0x85, 0x78, 0xF3, 0x0C, 0x85, 0x78, 0x64, 0x0C, 0x7C, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x7F, 0x00, 0x45, 0x0B, 0x81, 0x72, 0xC0, 0x0B, 0x80, 0x76, 0xFE, 0x0D, 0x83, 0x77, 0xFF, 0x0D, 0x83, 0x77, 0xF9, 0x0C, 0x85, 0x78, 0x98, 0x0B, 0x7F, 0x75, 0x15, 0x0C, 0x79, 0x6D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2D, 0x0B, 0x7C, 0x71, 0x69, 0x09, 0x7E, 0x72, 0xAA, 0x0C, 0x87, 0x7B, 0xEC, 0x0C, 0x84, 0x77, 0xFF, 0x0D, 0x8A, 0x7D, 0xFF, 0x0D, 0x88, 0x7C, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0D, 0x82, 0x75, 0xFF, 0x0D, 0x89, 0x7D, 0xFF, 0x0C, 0x88, 0x7B, 0xE2, 0x0B, 0x85, 0x78, 0xB2, 0x0B, 0x83, 0x76, 0xDF, 0x0C, 0x82, 0x76, 0xFF, 0x0D, 0x8A, 0x7D, 0xFF, 0x0C, 0x82, 0x75, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0C, 0x82, 0x76, 0xFF, 0x0D, 0x8A, 0x7D, 0xDE, 0x0C, 0x82, 0x76, 0xB0, 0x0B, 0x83, 0x78, 0xE2, 0x0C, 0x86, 0x77, 0xFF, 0x0D, 0x8A, 0x7C, 0xFF, 0x0D, 0x89, 0x7C, 0xFF, 0x0C, 0x82, 0x76, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0D, 0x88, 0x7C, 0xFF, 0x0D, 0x8A, 0x7D, 0xEA, 0x0D, 0x84, 0x78, 0xAA, 0x0C, 0x87, 0x79, 0x64, 0x0C, 0x7F, 0x75, 0x2C, 0x0B, 0x7F, 0x73, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x0D, 0x86, 0x78, 0x92, 0x0C, 0x81, 0x75, 0xFF, 0x0D, 0x85, 0x79, 0xFF, 0x0D, 0x82, 0x75, 0xFF, 0x0C, 0x83, 0x77, 0xBE, 0x0C, 0x80, 0x74, 0x44, 0x0B, 0x7B, 0x70, 0x04, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0x0A, 0x7F, 0x71, 0xF0, 0x0C, 0x88, 0x7B, 0xFF, 0x0C, 0x83, 0x77, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0D, 0x87, 0x7A, 0xD2, 0x0C, 0x81, 0x75, 0x1D, 0x08, 0x7B, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x0C, 0x7F, 0x66, 0xD4, 0x0A, 0x7F, 0x73, 0xFF, 0x0D, 0x85, 0x79, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0D, 0x85, 0x78, 0xF3, 0x0C, 0x85, 0x78, 0x64, 0x0C, 0x7C, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x0C, 0x81, 0x74, 0xF9, 0x0C, 0x88, 0x7A, 0xFF, 0x0D, 0x86, 0x79, 0xF5, 0x0C, 0x87, 0x79, 0x6B, 0x0B, 0x7E, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x0B, 0x7F, 0x68, 0x4A, 0x0A, 0x7F, 0x71, 0x8B, 0x0C, 0x85, 0x79, 0xD2, 0x0D, 0x85, 0x7A, 0xFF, 0x0D, 0x86, 0x7A, 0xFF, 0x0D, 0x8B, 0x7E, 0xFF, 0x0C, 0x83, 0x77, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0D, 0x87, 0x7A, 0xFF, 0x0D, 0x8A, 0x7D, 0xFF, 0x0D, 0x86, 0x79, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0D, 0x86, 0x79, 0xFF, 0x0D, 0x8A, 0x7E, 0xFF, 0x0D, 0x87, 0x7A, 0xFF, 0x0D, 0x80, 0x74, 0xFF, 0x0D, 0x83, 0x77, 0xFF, 0x0D, 0x8B, 0x7D, 0xFF, 0x0C, 0x86, 0x7A, 0xD1, 0x0C, 0x86, 0x7B, 0x8C, 0x0C, 0x83, 0x78, 0x4A, 0x0A, 0x7F, 0x71, 0x16, 0x0B, 0x7F, 0x68, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x0D, 0x7F, 0x74, 0xFF, 0x0D, 0x87, 0x7A, 0xFF, 0x0D, 0x84, 0x78, 0xFD, 0x0C, 0x84, 0x77, 0x78, 0x0A, 0x7F, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0x0A, 0x7F, 0x71, 0xF0, 0x0C, 0x88, 0x7B, 0xFF, 0x0C, 0x83, 0x77, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0D, 0x87, 0x7A, 0xD2, 0x0C, 0x81, 0x75, 0x1D, 0x08, 0x7B, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x0C, 0x7F, 0x66, 0xD4, 0x0A, 0x7F, 0x73, 0xFF, 0x0D, 0x85, 0x79, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0D, 0x85, 0x78, 0xF3, 0x0C, 0x85, 0x78, 0x64, 0x0C, 0x7C, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x71, 0x0D, 0x80, 0x73, 0xF7, 0x0C, 0x87, 0x7A, 0xFF, 0x0D, 0x85, 0x79, 0xF8, 0x0D, 0x87, 0x7A, 0x81, 0x0D, 0x80, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x66, 0x66, 0x30, 0x0A, 0x7F, 0x74, 0x6A, 0x0E, 0x81, 0x75, 0xB2, 0x0C, 0x88, 0x7B, 0xF6, 0x0B, 0x83, 0x77, 0xFF, 0x0D, 0x8B, 0x7D, 0xFF, 0x0C, 0x83, 0x76, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0D, 0x83, 0x76, 0xFF, 0x0D, 0x8A, 0x7E, 0xF6, 0x0C, 0x82, 0x77, 0xB1, 0x0C, 0x87, 0x7A, 0x66, 0x0A, 0x82, 0x78, 0x30, 0x0A, 0x7F, 0x74, 0x04, 0x00, 0x7F, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x66, 0x66, 0x78, 0x0C, 0x81, 0x77, 0xFF, 0x0D, 0x88, 0x7B, 0xFF, 0x0D, 0x85, 0x78, 0xF8, 0x0C, 0x84, 0x78, 0x75, 0x0D, 0x7C, 0x71, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0x0A, 0x7F, 0x71, 0xF0, 0x0C, 0x88, 0x7B, 0xFF, 0x0C, 0x83, 0x77, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0D, 0x87, 0x7A, 0xD2, 0x0C, 0x81, 0x75, 0x1D, 0x08, 0x7B, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x0C, 0x7F, 0x66, 0xD4, 0x0A, 0x7F, 0x73, 0xFF, 0x0D, 0x85, 0x79, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0D, 0x85, 0x78, 0xF2, 0x0C, 0x84, 0x78, 0x63, 0x0C, 0x7B, 0x71, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x67, 0x0C, 0x83, 0x74, 0xF6, 0x0C, 0x86, 0x7A, 0xFF, 0x0D, 0x85, 0x79, 0xFB, 0x0D, 0x87, 0x79, 0x8C, 0x0C, 0x7F, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1D, 0x08, 0x7B, 0x72, 0x4B, 0x0A, 0x81, 0x73, 0x91, 0x0C, 0x89, 0x79, 0xE8, 0x0A, 0x82, 0x76, 0xFF, 0x0C, 0x81, 0x74, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x82, 0x76, 0xE7, 0x0C, 0x83, 0x76, 0x92, 0x0C, 0x86, 0x7C, 0x4A, 0x0D, 0x7F, 0x75, 0x1C, 0x09, 0x7F, 0x6D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x6D, 0x6D, 0x82, 0x0B, 0x83, 0x77, 0xFF, 0x0D, 0x88, 0x7B, 0xFF, 0x0D, 0x85, 0x79, 0xF4, 0x0C, 0x85, 0x79, 0x6E, 0x0B, 0x7A, 0x71, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0x0A, 0x7F, 0x71, 0xF0, 0x0C, 0x88, 0x7B, 0xFF, 0x0C, 0x83, 0x77, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0D, 0x87, 0x7A, 0xD2, 0x0C, 0x81, 0x75, 0x1D, 0x08, 0x7B, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x0C, 0x7F, 0x66, 0xD4, 0x0A, 0x7F, 0x73, 0xFF, 0x0D, 0x85, 0x79, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0D, 0x85, 0x78, 0xF2, 0x0C, 0x83, 0x78, 0x62, 0x0D, 0x7C, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5C, 0x0B, 0x82, 0x74, 0xF4, 0x0C, 0x86, 0x7A, 0xFF, 0x0D, 0x85, 0x78, 0xFE, 0x0D, 0x85, 0x78, 0x96, 0x0B, 0x7F, 0x73, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x7F, 0x7F, 0xA6, 0x0A, 0x7F, 0x73, 0xFF, 0x0D, 0x86, 0x79, 0xFF, 0x0C, 0x81, 0x75, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x87, 0x7B, 0x9B, 0x0B, 0x7E, 0x73, 0x0D, 0x00, 0x75, 0x75, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x1C, 0x8D, 0x71, 0x8D, 0x0C, 0x84, 0x77, 0xFF, 0x0D, 0x88, 0x7B, 0xFF, 0x0D, 0x86, 0x79, 0xEF, 0x0C, 0x86, 0x79, 0x65, 0x0A, 0x7E, 0x71, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0x0A, 0x7F, 0x71, 0xF0, 0x0C, 0x88, 0x7B, 0xFF, 0x0C, 0x83, 0x77, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0D, 0x87, 0x7A, 0xD2, 0x0C, 0x81, 0x75, 0x1D, 0x08, 0x7B, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x0C, 0x7F, 0x66, 0xD4, 0x0A, 0x7F, 0x73, 0xFF, 0x0D, 0x85, 0x79, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0D, 0x85, 0x78, 0xF2, 0x0C, 0x83, 0x78, 0x62, 0x0D, 0x7C, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x51, 0x0C, 0x81, 0x74, 0xF2, 0x0C, 0x85, 0x79, 0xFF, 0x0D, 0x85, 0x78, 0xFF, 0x0D, 0x85, 0x78, 0xA0, 0x0B, 0x7D, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x75, 0x0A, 0x7E, 0x73, 0xF7, 0x0C, 0x88, 0x7B, 0xFF, 0x0C, 0x83, 0x77, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7E, 0x73, 0xFF, 0x0D, 0x83, 0x77, 0xFD, 0x0D, 0x84, 0x77, 0x71, 0x0D, 0x7C, 0x73, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x15, 0x7F, 0x6A, 0x98, 0x0B, 0x82, 0x77, 0xFF, 0x0D, 0x88, 0x7B, 0xFF, 0x0D, 0x86, 0x7A, 0xEA, 0x0D, 0x87, 0x7A, 0x5C, 0x0B, 0x7C, 0x71, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0x0A, 0x7F, 0x71, 0xF0, 0x0C, 0x88, 0x7B, 0xFF, 0x0C, 0x83, 0x77, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0D, 0x87, 0x7A, 0xD2, 0x0C, 0x81, 0x75, 0x1D, 0x08, 0x7B, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x0C, 0x7F, 0x66, 0xD4, 0x0A, 0x7F, 0x73, 0xFF, 0x0D, 0x85, 0x79, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0D, 0x85, 0x78, 0xF2, 0x0C, 0x83, 0x78, 0x62, 0x0D, 0x7C, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x46, 0x0A, 0x83, 0x74, 0xF1, 0x0C, 0x84, 0x77, 0xFF, 0x0D, 0x85, 0x78, 0xFF, 0x0D, 0x86, 0x78, 0xA9, 0x0C, 0x7E, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x0C, 0x7C, 0x6F, 0xE0, 0x0C, 0x81, 0x76, 0xFF, 0x0C, 0x85, 0x79, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0D, 0x88, 0x7B, 0xD3, 0x0D, 0x86, 0x78, 0x35, 0x0E, 0x7D, 0x6E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x11, 0x77, 0x66, 0xA4, 0x0C, 0x82, 0x76, 0xFF, 0x0D, 0x88, 0x7B, 0xFF, 0x0D, 0x87, 0x7A, 0xE5, 0x0C, 0x86, 0x7A, 0x51, 0x09, 0x7D, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0x0A, 0x7F, 0x71, 0xF0, 0x0C, 0x88, 0x7B, 0xFF, 0x0C, 0x83, 0x77, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0D, 0x87, 0x7A, 0xD2, 0x0C, 0x81, 0x75, 0x1D, 0x08, 0x7B, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x0C, 0x7F, 0x66, 0xD4, 0x0A, 0x7F, 0x73, 0xFF, 0x0D, 0x85, 0x79, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0D, 0x85, 0x78, 0xF2, 0x0C, 0x83, 0x78, 0x62, 0x0D, 0x7C, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x0C, 0x7F, 0x72, 0xEF, 0x0B, 0x82, 0x76, 0xFF, 0x0C, 0x85, 0x78, 0xFF, 0x0C, 0x86, 0x79, 0xB2, 0x0A, 0x7F, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x0A, 0x7B, 0x71, 0xE8, 0x0C, 0x82, 0x75, 0xFF, 0x0C, 0x84, 0x77, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7E, 0x73, 0xFF, 0x0D, 0x86, 0x79, 0xE1, 0x0C, 0x84, 0x78, 0x4D, 0x0D, 0x7A, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x0E, 0x71, 0x71, 0xAE, 0x0B, 0x82, 0x76, 0xFF, 0x0D, 0x88, 0x7B, 0xFF, 0x0D, 0x87, 0x7A, 0xDF, 0x0C, 0x88, 0x7A, 0x48, 0x0A, 0x7B, 0x71, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0x0A, 0x7F, 0x71, 0xF0, 0x0C, 0x88, 0x7B, 0xFF, 0x0C, 0x83, 0x77, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0D, 0x87, 0x7A, 0xD2, 0x0C, 0x81, 0x75, 0x1D, 0x08, 0x7B, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x0C, 0x7F, 0x66, 0xD4, 0x0A, 0x7F, 0x73, 0xFF, 0x0D, 0x85, 0x79, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0D, 0x85, 0x79, 0xF1, 0x0C, 0x84, 0x77, 0x60, 0x0A, 0x7F, 0x6F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x0A, 0x7D, 0x73, 0xEE, 0x0B, 0x7F, 0x73, 0xFF, 0x0C, 0x84, 0x78, 0xFF, 0x0C, 0x86, 0x79, 0xBD, 0x0C, 0x7E, 0x72, 0x04, 0x3F, 0x7F, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2D, 0x0B, 0x7C, 0x71, 0xD1, 0x0C, 0x83, 0x77, 0xFD, 0x0C, 0x86, 0x78, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x82, 0x76, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x81, 0x74, 0xFF, 0x0C, 0x82, 0x76, 0xFF, 0x0C, 0x7F, 0x73, 0xFE, 0x0D, 0x88, 0x7B, 0xC6, 0x0C, 0x88, 0x7A, 0x33, 0x0A, 0x78, 0x6E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x0C, 0x72, 0x66, 0xB9, 0x0B, 0x80, 0x73, 0xFF, 0x0D, 0x87, 0x7B, 0xFF, 0x0D, 0x88, 0x7B, 0xDA, 0x0C, 0x87, 0x7A, 0x3E, 0x0C, 0x7B, 0x6F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0x0A, 0x7F, 0x71, 0xF0, 0x0C, 0x88, 0x7B, 0xFF, 0x0C, 0x83, 0x77, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0D, 0x87, 0x7A, 0xD2, 0x0C, 0x81, 0x75, 0x1D, 0x08, 0x7B, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x0C, 0x7F, 0x66, 0xD4, 0x0A, 0x7F, 0x73, 0xFF, 0x0D, 0x85, 0x79, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0D, 0x85, 0x79, 0xF1, 0x0C, 0x84, 0x77, 0x60, 0x0A, 0x7F, 0x6F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2A, 0x0C, 0x7F, 0x73, 0xEB, 0x0B, 0x7D, 0x71, 0xFF, 0x0C, 0x85, 0x78, 0xFF, 0x0C, 0x86, 0x79, 0xC5, 0x0A, 0x7E, 0x73, 0x09, 0x1C, 0x71, 0x8D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x78, 0x78, 0xB7, 0x0C, 0x82, 0x76, 0xFF, 0x0D, 0x89, 0x7B, 0xFF, 0x0C, 0x81, 0x75, 0xFF, 0x0C, 0x82, 0x76, 0xF8, 0x0C, 0x80, 0x75, 0xF7, 0x0C, 0x7E, 0x72, 0xFF, 0x0C, 0x7F, 0x73, 0xFE, 0x0C, 0x7F, 0x73, 0xF6, 0x0C, 0x7F, 0x73, 0xF6, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x83, 0x76, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0D, 0x8B, 0x7D, 0xB1, 0x0B, 0x83, 0x77, 0x1A, 0x09, 0x75, 0x6B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x0B, 0x73, 0x73, 0xC3, 0x0D, 0x80, 0x75, 0xFF, 0x0D, 0x87, 0x7A, 0xFF, 0x0D, 0x88, 0x7B, 0xD5, 0x0D, 0x87, 0x7A, 0x35, 0x09, 0x7D, 0x6E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5C, 0x0B, 0x7F, 0x74, 0xF0, 0x0C, 0x88, 0x7B, 0xFF, 0x0C, 0x83, 0x77, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0D, 0x87, 0x7A, 0xD2, 0x0C, 0x81, 0x75, 0x1D, 0x08, 0x7B, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x0C, 0x7F, 0x66, 0xD4, 0x0A, 0x7F, 0x73, 0xFF, 0x0D, 0x85, 0x79, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0D, 0x85, 0x79, 0xF1, 0x0C, 0x84, 0x77, 0x60, 0x0A, 0x7F, 0x6F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x07, 0x7B, 0x73, 0xE3, 0x0B, 0x7D, 0x72, 0xFF, 0x0C, 0x85, 0x78, 0xFF, 0x0C, 0x86, 0x79, 0xCF, 0x0B, 0x7E, 0x71, 0x11, 0x0F, 0x78, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x7F, 0x5F, 0x96, 0x0B, 0x82, 0x75, 0xFF, 0x0C, 0x87, 0x7A, 0xFF, 0x0C, 0x82, 0x76, 0xFF, 0x0C, 0x82, 0x76, 0xF0, 0x0C, 0x85, 0x79, 0x85, 0x0B, 0x7E, 0x74, 0xD4, 0x0A, 0x7F, 0x73, 0xFF, 0x0C, 0x83, 0x77, 0xFF, 0x0C, 0x83, 0x77, 0xCA, 0x0C, 0x7E, 0x72, 0x80, 0x0B, 0x7D, 0x73, 0xF5, 0x0C, 0x82, 0x75, 0xFF, 0x0C, 0x84, 0x78, 0xFF, 0x0C, 0x81, 0x75, 0xFF, 0x0C, 0x88, 0x7C, 0x92, 0x0C, 0x81, 0x73, 0x06, 0x00, 0x7F, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x0A, 0x7F, 0x74, 0xCD, 0x0B, 0x7E, 0x74, 0xFF, 0x0D, 0x86, 0x7A, 0xFF, 0x0D, 0x88, 0x7B, 0xD1, 0x0D, 0x86, 0x78, 0x2B, 0x0B, 0x82, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5B, 0x0B, 0x80, 0x72, 0xEF, 0x0C, 0x87, 0x7A, 0xFF, 0x0C, 0x84, 0x77, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0D, 0x87, 0x7A, 0xD2, 0x0C, 0x81, 0x75, 0x1D, 0x08, 0x7B, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x0C, 0x7F, 0x66, 0xD4, 0x0A, 0x7F, 0x73, 0xFF, 0x0D, 0x85, 0x79, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0D, 0x85, 0x79, 0xF1, 0x0C, 0x84, 0x77, 0x60, 0x0A, 0x7F, 0x6F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x0A, 0x7A, 0x70, 0xDB, 0x0A, 0x7E, 0x72, 0xFF, 0x0C, 0x85, 0x78, 0xFF, 0x0D, 0x86, 0x79, 0xD7, 0x0B, 0x7E, 0x71, 0x19, 0x0A, 0x7A, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x3F, 0x3F, 0x76, 0x0C, 0x81, 0x72, 0xF3, 0x0C, 0x89, 0x7B, 0xFF, 0x0D, 0x84, 0x78, 0xFF, 0x0C, 0x82, 0x76, 0xFE, 0x0D, 0x88, 0x7B, 0x84, 0x0D, 0x83, 0x75, 0x19, 0x0A, 0x70, 0x65, 0xD6, 0x0B, 0x7F, 0x72, 0xFF, 0x0C, 0x85, 0x78, 0xFF, 0x0D, 0x87, 0x7B, 0xC4, 0x0B, 0x7F, 0x73, 0x11, 0x0F, 0x78, 0x69, 0x82, 0x0B, 0x85, 0x79, 0xFC, 0x0D, 0x8A, 0x7D, 0xFF, 0x0C, 0x81, 0x75, 0xFF, 0x0D, 0x84, 0x77, 0xF9, 0x0C, 0x86, 0x79, 0x70, 0x0B, 0x7F, 0x71, 0x03, 0x00, 0x55, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0x09, 0x7A, 0x71, 0xD6, 0x0D, 0x80, 0x74, 0xFF, 0x0D, 0x85, 0x79, 0xFF, 0x0D, 0x88, 0x7B, 0xCB, 0x0C, 0x85, 0x78, 0x23, 0x07, 0x74, 0x6D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5B, 0x0B, 0x80, 0x72, 0xEF, 0x0C, 0x87, 0x7A, 0xFF, 0x0C, 0x84, 0x77, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0D, 0x87, 0x7A, 0xD2, 0x0C, 0x81, 0x75, 0x1D, 0x08, 0x7B, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x0C, 0x7F, 0x66, 0xD4, 0x0A, 0x7F, 0x73, 0xFF, 0x0D, 0x85, 0x79, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0D, 0x85, 0x79, 0xF1, 0x0C, 0x84, 0x77, 0x60, 0x0A, 0x7F, 0x6F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x71, 0x63, 0xD2, 0x0C, 0x7F, 0x72, 0xFF, 0x0C, 0x85, 0x79, 0xFF, 0x0D, 0x86, 0x79, 0xDC, 0x0B, 0x80, 0x73, 0x21, 0x07, 0x7B, 0x73, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x0C, 0x7E, 0x72, 0xE5, 0x0D, 0x88, 0x7B, 0xFF, 0x0D, 0x87, 0x7A, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0D, 0x89, 0x7D, 0xB0, 0x0B, 0x83, 0x75, 0x0A, 0x19, 0x7F, 0x66, 0x10, 0x0F, 0x6F, 0x5F, 0xDD, 0x0C, 0x7E, 0x73, 0xFF, 0x0C, 0x85, 0x78, 0xFF, 0x0D, 0x86, 0x7A, 0xCF, 0x0C, 0x80, 0x73, 0x0E, 0x12, 0x6D, 0x6D, 0x1A, 0x09, 0x7F, 0x6B, 0xAE, 0x0D, 0x85, 0x78, 0xFF, 0x0D, 0x8C, 0x7E, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0D, 0x86, 0x7A, 0xE7, 0x0C, 0x88, 0x79, 0x52, 0x09, 0x7C, 0x6F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x08, 0x7F, 0x6E, 0xDF, 0x0B, 0x80, 0x74, 0xFF, 0x0D, 0x85, 0x79, 0xFF, 0x0D, 0x88, 0x7B, 0xC7, 0x0B, 0x82, 0x77, 0x1A, 0x09, 0x75, 0x6B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5B, 0x0B, 0x80, 0x72, 0xEF, 0x0C, 0x87, 0x7A, 0xFF, 0x0C, 0x84, 0x77, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0D, 0x87, 0x7A, 0xD2, 0x0C, 0x83, 0x75, 0x1F, 0x10, 0x7B, 0x73, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x0C, 0x7F, 0x66, 0xD4, 0x0A, 0x7F, 0x73, 0xFF, 0x0D, 0x85, 0x79, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0D, 0x86, 0x79, 0xF0, 0x0C, 0x84, 0x78, 0x5F, 0x0A, 0x7B, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x73, 0x73, 0xC9, 0x0A, 0x80, 0x73, 0xFF, 0x0C, 0x86, 0x79, 0xFF, 0x0D, 0x86, 0x79, 0xDE, 0x0C, 0x82, 0x76, 0x2A, 0x0C, 0x7F, 0x73, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0x0E, 0x7A, 0x70, 0xD3, 0x0D, 0x86, 0x78, 0xFF, 0x0D, 0x89, 0x7C, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0D, 0x89, 0x7C, 0xD1, 0x0C, 0x82, 0x76, 0x26, 0x06, 0x7F, 0x72, 0x00, 0x00, 0x00, 0x00, 0x1B, 0x09, 0x7A, 0x67, 0xDD, 0x0C, 0x7E, 0x72, 0xFF, 0x0C, 0x85, 0x78, 0xFF, 0x0D, 0x86, 0x7A, 0xD0, 0x0C, 0x7F, 0x73, 0x19, 0x0A, 0x7A, 0x70, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x0A, 0x7C, 0x71, 0xCF, 0x0C, 0x85, 0x77, 0xFF, 0x0D, 0x8B, 0x7D, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0D, 0x8A, 0x7D, 0xCF, 0x0C, 0x87, 0x7B, 0x36, 0x09, 0x7F, 0x71, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x06, 0x7F, 0x72, 0xE7, 0x0C, 0x7E, 0x73, 0xFF, 0x0C, 0x85, 0x78, 0xFF, 0x0D, 0x87, 0x7B, 0xC3, 0x0B, 0x80, 0x74, 0x12, 0x0E, 0x7F, 0x63, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5B, 0x0B, 0x80, 0x72, 0xEF, 0x0C, 0x87, 0x7A, 0xFF, 0x0C, 0x84, 0x77, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0D, 0x87, 0x7A, 0xD2, 0x0C, 0x83, 0x75, 0x20, 0x0F, 0x7F, 0x6F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x0C, 0x7F, 0x66, 0xD4, 0x0A, 0x7F, 0x73, 0xFF, 0x0D, 0x85, 0x79, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0D, 0x86, 0x79, 0xF0, 0x0C, 0x84, 0x78, 0x5F, 0x0A, 0x7B, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x7F, 0x7F, 0xC0, 0x0B, 0x7F, 0x74, 0xFF, 0x0D, 0x86, 0x79, 0xFF, 0x0D, 0x86, 0x7A, 0xE1, 0x0C, 0x84, 0x78, 0x34, 0x09, 0x7A, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x0A, 0x7A, 0x70, 0xBC, 0x0C, 0x82, 0x76, 0xFF, 0x0E, 0x8B, 0x7D, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0D, 0x87, 0x7B, 0xE6, 0x0D, 0x86, 0x79, 0x45, 0x0B, 0x7D, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0x09, 0x84, 0x71, 0xDD, 0x0C, 0x7E, 0x72, 0xFF, 0x0C, 0x85, 0x78, 0xFF, 0x0D, 0x87, 0x7A, 0xCF, 0x0C, 0x80, 0x73, 0x17, 0x0B, 0x79, 0x6E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x46, 0x0E, 0x7F, 0x70, 0xE7, 0x0D, 0x85, 0x77, 0xFF, 0x0D, 0x89, 0x7C, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0D, 0x8C, 0x7E, 0xB7, 0x0C, 0x85, 0x77, 0x1D, 0x11, 0x7B, 0x69, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x0A, 0x7C, 0x71, 0xEE, 0x0A, 0x80, 0x73, 0xFF, 0x0C, 0x85, 0x78, 0xFF, 0x0D, 0x88, 0x7B, 0xBD, 0x0C, 0x7E, 0x71, 0x0A, 0x19, 0x7F, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5B, 0x0B, 0x80, 0x72, 0xEF, 0x0C, 0x87, 0x7A, 0xFF, 0x0C, 0x84, 0x77, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0D, 0x87, 0x7A, 0xD2, 0x0C, 0x83, 0x75, 0x20, 0x0F, 0x7F, 0x6F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x0C, 0x7F, 0x66, 0xD3, 0x0A, 0x7E, 0x72, 0xFF, 0x0D, 0x85, 0x79, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0D, 0x86, 0x79, 0xF0, 0x0C, 0x84, 0x78, 0x5F, 0x0A, 0x7B, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x7F, 0x5F, 0xB6, 0x0C, 0x7F, 0x75, 0xFF, 0x0D, 0x86, 0x79, 0xFF, 0x0D, 0x86, 0x79, 0xE4, 0x0D, 0x86, 0x79, 0x3E, 0x0C, 0x7F, 0x73, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x0F, 0x6F, 0x5F, 0x9B, 0x0B, 0x81, 0x76, 0xFF, 0x0D, 0x8A, 0x7D, 0xFF, 0x0D, 0x82, 0x75, 0xFF, 0x0D, 0x85, 0x78, 0xF3, 0x0C, 0x89, 0x7C, 0x65, 0x0C, 0x80, 0x74, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0x09, 0x84, 0x71, 0xDD, 0x0C, 0x7E, 0x72, 0xFF, 0x0C, 0x85, 0x78, 0xFF, 0x0D, 0x87, 0x7A, 0xCF, 0x0C, 0x80, 0x73, 0x17, 0x0B, 0x79, 0x6E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x68, 0x0C, 0x81, 0x73, 0xF0, 0x0C, 0x8A, 0x7C, 0xFF, 0x0D, 0x86, 0x79, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0D, 0x8B, 0x7C, 0x99, 0x0B, 0x81, 0x74, 0x0A, 0x19, 0x7F, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x09, 0x7A, 0x71, 0xF6, 0x0B, 0x7F, 0x72, 0xFF, 0x0C, 0x84, 0x78, 0xFF, 0x0D, 0x87, 0x7A, 0xB3, 0x0B, 0x7E, 0x71, 0x03, 0x00, 0xAA, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5B, 0x0B, 0x7E, 0x72, 0xEF, 0x0C, 0x87, 0x7A, 0xFF, 0x0C, 0x84, 0x77, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0D, 0x87, 0x7A, 0xD2, 0x0C, 0x83, 0x75, 0x1F, 0x10, 0x7B, 0x73, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x0D, 0x78, 0x6B, 0xD0, 0x0C, 0x7E, 0x73, 0xFF, 0x0D, 0x86, 0x79, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0D, 0x86, 0x79, 0xEF, 0x0C, 0x85, 0x78, 0x5E, 0x0A, 0x7A, 0x71, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x6D, 0x6D, 0xAC, 0x0D, 0x80, 0x75, 0xFF, 0x0D, 0x86, 0x79, 0xFF, 0x0D, 0x86, 0x79, 0xE7, 0x0D, 0x87, 0x7A, 0x49, 0x0A, 0x7D, 0x6F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x55, 0x55, 0x7A, 0x0C, 0x81, 0x75, 0xF6, 0x0C, 0x8A, 0x7D, 0xFF, 0x0D, 0x84, 0x78, 0xFF, 0x0C, 0x82, 0x76, 0xFF, 0x0D, 0x89, 0x7C, 0x85, 0x0B, 0x80, 0x76, 0x09, 0x00, 0x54, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0x09, 0x84, 0x71, 0xDD, 0x0C, 0x7E, 0x72, 0xFF, 0x0C, 0x85, 0x78, 0xFF, 0x0D, 0x87, 0x7A, 0xCF, 0x0C, 0x80, 0x73, 0x17, 0x0B, 0x79, 0x6E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x66, 0x66, 0x8A, 0x0B, 0x83, 0x76, 0xFA, 0x0C, 0x8A, 0x7D, 0xFF, 0x0C, 0x83, 0x76, 0xFF, 0x0D, 0x82, 0x76, 0xFE, 0x0C, 0x86, 0x7A, 0x75, 0x0A, 0x80, 0x73, 0x02, 0x00, 0x7F, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0x0B, 0x7B, 0x73, 0xFC, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x84, 0x77, 0xFF, 0x0C, 0x87, 0x7A, 0xAA, 0x0A, 0x7E, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5B, 0x0B, 0x7E, 0x72, 0xEF, 0x0C, 0x87, 0x7A, 0xFF, 0x0C, 0x84, 0x77, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0D, 0x87, 0x7A, 0xD1, 0x0C, 0x81, 0x75, 0x1C, 0x09, 0x76, 0x6D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x0F, 0x87, 0x78, 0xC8, 0x0B, 0x7F, 0x74, 0xFF, 0x0D, 0x86, 0x79, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0D, 0x85, 0x79, 0xF3, 0x0C, 0x84, 0x77, 0x62, 0x0A, 0x7C, 0x6F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x7F, 0x55, 0xA2, 0x0C, 0x7F, 0x74, 0xFF, 0x0D, 0x87, 0x7A, 0xFF, 0x0D, 0x86, 0x79, 0xEA, 0x0D, 0x88, 0x7B, 0x53, 0x0F, 0x7D, 0x71, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5A, 0x0E, 0x7F, 0x71, 0xE7, 0x0D, 0x89, 0x7C, 0xFF, 0x0D, 0x87, 0x7A, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0D, 0x8B, 0x7E, 0xA9, 0x0C, 0x81, 0x75, 0x12, 0x0E, 0x71, 0x63, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0x09, 0x84, 0x71, 0xDD, 0x0C, 0x7E, 0x73, 0xFF, 0x0C, 0x85, 0x78, 0xFF, 0x0D, 0x87, 0x7A, 0xCF, 0x0C, 0x80, 0x73, 0x17, 0x0B, 0x79, 0x6E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x09, 0x75, 0x6B, 0xAA, 0x0C, 0x84, 0x78, 0xFF, 0x0D, 0x8B, 0x7E, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0D, 0x85, 0x79, 0xEC, 0x0B, 0x88, 0x7B, 0x53, 0x0C, 0x81, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4B, 0x0A, 0x7D, 0x73, 0xFE, 0x0C, 0x81, 0x74, 0xFF, 0x0C, 0x84, 0x77, 0xFF, 0x0C, 0x86, 0x79, 0xA0, 0x0C, 0x7D, 0x71, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x67, 0x0C, 0x7E, 0x74, 0xF2, 0x0C, 0x87, 0x7B, 0xFF, 0x0C, 0x83, 0x77, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0D, 0x86, 0x7A, 0xCC, 0x0C, 0x7F, 0x74, 0x14, 0x0C, 0x7F, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x11, 0x77, 0x77, 0xB8, 0x0B, 0x82, 0x75, 0xFF, 0x0D, 0x87, 0x7B, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7E, 0x73, 0xFF, 0x0D, 0x83, 0x77, 0xFC, 0x0C, 0x83, 0x77, 0x73, 0x0B, 0x7E, 0x71, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x66, 0x66, 0x97, 0x0D, 0x80, 0x76, 0xFF, 0x0D, 0x86, 0x7A, 0xFF, 0x0D, 0x86, 0x79, 0xED, 0x0C, 0x87, 0x7B, 0x5E, 0x0D, 0x7F, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x09, 0x7D, 0x6F, 0xDA, 0x0B, 0x85, 0x78, 0xFF, 0x0D, 0x8A, 0x7D, 0xFF, 0x0C, 0x7D, 0x72, 0xFF, 0x0D, 0x8B, 0x7E, 0xCB, 0x0B, 0x81, 0x76, 0x24, 0x07, 0x78, 0x71, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1D, 0x11, 0x7B, 0x72, 0xDF, 0x0C, 0x7E, 0x73, 0xFF, 0x0C, 0x85, 0x78, 0xFF, 0x0D, 0x86, 0x7A, 0xCF, 0x0C, 0x80, 0x73, 0x17, 0x0B, 0x79, 0x6E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x0C, 0x76, 0x69, 0xCA, 0x0B, 0x84, 0x76, 0xFF, 0x0D, 0x8A, 0x7E, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0D, 0x89, 0x7C, 0xD9, 0x0C, 0x87, 0x7A, 0x37, 0x09, 0x7D, 0x73, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x0C, 0x7F, 0x73, 0xFE, 0x0C, 0x82, 0x76, 0xFF, 0x0C, 0x84, 0x78, 0xFF, 0x0C, 0x86, 0x78, 0x95, 0x0B, 0x7E, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0x0D, 0x7F, 0x73, 0xFA, 0x0D, 0x86, 0x79, 0xFF, 0x0C, 0x83, 0x76, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x86, 0x7A, 0xC2, 0x0B, 0x7E, 0x72, 0x09, 0x00, 0x71, 0x71, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x73, 0x73, 0xA4, 0x0C, 0x81, 0x74, 0xFF, 0x0D, 0x88, 0x7B, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x81, 0x75, 0xFF, 0x0D, 0x87, 0x7A, 0x91, 0x0C, 0x7C, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x55, 0x55, 0x8C, 0x0A, 0x81, 0x74, 0xFD, 0x0D, 0x87, 0x79, 0xFF, 0x0D, 0x86, 0x79, 0xF1, 0x0C, 0x87, 0x79, 0x68, 0x0C, 0x7F, 0x73, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x07, 0x77, 0x6F, 0xC1, 0x0D, 0x82, 0x76, 0xFF, 0x0D, 0x8B, 0x7E, 0xFF, 0x0C, 0x7D, 0x72, 0xFF, 0x0D, 0x89, 0x7C, 0xDB, 0x0C, 0x88, 0x7A, 0x42, 0x0B, 0x7B, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1D, 0x11, 0x7B, 0x72, 0xDF, 0x0C, 0x7E, 0x72, 0xFF, 0x0C, 0x85, 0x78, 0xFF, 0x0D, 0x86, 0x7A, 0xCF, 0x0C, 0x80, 0x73, 0x17, 0x0B, 0x79, 0x6E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x0B, 0x79, 0x6D, 0xE1, 0x0C, 0x85, 0x79, 0xFF, 0x0D, 0x88, 0x7C, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0D, 0x8A, 0x7D, 0xC2, 0x0B, 0x82, 0x77, 0x1E, 0x08, 0x77, 0x6E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0x0D, 0x82, 0x77, 0xFF, 0x0D, 0x84, 0x78, 0xFF, 0x0D, 0x84, 0x77, 0xFF, 0x0D, 0x84, 0x78, 0x8D, 0x0A, 0x7E, 0x71, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA4, 0x0A, 0x7F, 0x73, 0xFF, 0x0C, 0x85, 0x79, 0xFF, 0x0C, 0x82, 0x75, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x86, 0x79, 0xAF, 0x0A, 0x7E, 0x71, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x6D, 0x6D, 0x89, 0x0D, 0x82, 0x75, 0xFF, 0x0D, 0x88, 0x7B, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0D, 0x8A, 0x7D, 0xAE, 0x0D, 0x82, 0x76, 0x0C, 0x00, 0x6A, 0x6A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x7F, 0x7F, 0x80, 0x0B, 0x81, 0x75, 0xFC, 0x0D, 0x86, 0x7A, 0xFF, 0x0D, 0x85, 0x79, 0xF5, 0x0C, 0x87, 0x79, 0x74, 0x0A, 0x7F, 0x72, 0x00, 0x00, 0x00, 0x00, 0x12, 0x0E, 0x71, 0x71, 0xA0, 0x0B, 0x81, 0x75, 0xFF, 0x0D, 0x8B, 0x7E, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0D, 0x85, 0x79, 0xED, 0x0C, 0x89, 0x7C, 0x61, 0x0D, 0x7E, 0x73, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1D, 0x11, 0x7B, 0x72, 0xDF, 0x0C, 0x7E, 0x72, 0xFF, 0x0C, 0x85, 0x78, 0xFF, 0x0D, 0x86, 0x7A, 0xCF, 0x0C, 0x80, 0x73, 0x17, 0x0B, 0x79, 0x6E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0x0C, 0x7E, 0x71, 0xEE, 0x0C, 0x88, 0x7C, 0xFF, 0x0D, 0x86, 0x79, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0D, 0x8A, 0x7D, 0xA1, 0x0B, 0x80, 0x75, 0x08, 0x00, 0x7F, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x6A, 0x0C, 0x81, 0x75, 0xFF, 0x0D, 0x85, 0x79, 0xFF, 0x0D, 0x85, 0x78, 0xFD, 0x0D, 0x84, 0x76, 0x85, 0x0B, 0x7C, 0x6F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x8D, 0x71, 0xC7, 0x0B, 0x7D, 0x72, 0xFF, 0x0D, 0x85, 0x79, 0xFF, 0x0C, 0x80, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x82, 0x76, 0xFF, 0x0D, 0x85, 0x79, 0x98, 0x0B, 0x7D, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xFF, 0xFF, 0x68, 0x0C, 0x81, 0x75, 0xFE, 0x0D, 0x86, 0x78, 0xFF, 0x0C, 0x81, 0x74, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0D, 0x8A, 0x7D, 0xC9, 0x0D, 0x86, 0x7B, 0x2C, 0x0B, 0x79, 0x6E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x75, 0x0A, 0x82, 0x75, 0xFB, 0x0D, 0x87, 0x79, 0xFF, 0x0D, 0x85, 0x78, 0xF8, 0x0D, 0x86, 0x79, 0x79, 0x0C, 0x7E, 0x73, 0x05, 0x00, 0x33, 0x66, 0x7D, 0x0C, 0x82, 0x76, 0xFA, 0x0D, 0x89, 0x7C, 0xFF, 0x0C, 0x82, 0x76, 0xFF, 0x0D, 0x82, 0x76, 0xFC, 0x0C, 0x88, 0x7B, 0x80, 0x09, 0x81, 0x75, 0x09, 0x00, 0x54, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1D, 0x11, 0x7B, 0x72, 0xDF, 0x0C, 0x7E, 0x72, 0xFF, 0x0C, 0x85, 0x78, 0xFF, 0x0D, 0x86, 0x7A, 0xCF, 0x0C, 0x80, 0x73, 0x17, 0x0B, 0x79, 0x6E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x7F, 0x55, 0x85, 0x0D, 0x80, 0x73, 0xF8, 0x0D, 0x89, 0x7D, 0xFF, 0x0D, 0x83, 0x77, 0xFF, 0x0C, 0x82, 0x76, 0xFD, 0x0D, 0x87, 0x7A, 0x7A, 0x0C, 0x81, 0x75, 0x01, 0x00, 0x00, 0x00, 0x6E, 0x0D, 0x81, 0x76, 0xFF, 0x0D, 0x86, 0x7A, 0xFF, 0x0D, 0x85, 0x78, 0xF8, 0x0C, 0x85, 0x79, 0x7C, 0x0A, 0x7B, 0x71, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2A, 0x0C, 0x85, 0x73, 0xDF, 0x0D, 0x83, 0x76, 0xFF, 0x0D, 0x85, 0x78, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0D, 0x83, 0x77, 0xF7, 0x0C, 0x86, 0x79, 0x7A, 0x0A, 0x7F, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x45, 0x0B, 0x81, 0x72, 0xFC, 0x0C, 0x7F, 0x74, 0xFF, 0x0C, 0x82, 0x75, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0D, 0x87, 0x7A, 0xEA, 0x0D, 0x83, 0x77, 0x52, 0x0C, 0x79, 0x6F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x62, 0x0A, 0x82, 0x75, 0xF9, 0x0C, 0x87, 0x79, 0xFF, 0x0D, 0x85, 0x79, 0xF4, 0x0C, 0x86, 0x7A, 0x78, 0x0C, 0x7F, 0x72, 0x4D, 0x0D, 0x81, 0x77, 0xEE, 0x0C, 0x88, 0x7B, 0xFF, 0x0D, 0x85, 0x78, 0xFF, 0x0D, 0x80, 0x73, 0xFF, 0x0D, 0x8A, 0x7D, 0xA3, 0x0C, 0x81, 0x75, 0x10, 0x00, 0x6F, 0x6F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1D, 0x11, 0x7B, 0x72, 0xDF, 0x0C, 0x7E, 0x72, 0xFF, 0x0C, 0x85, 0x78, 0xFF, 0x0D, 0x86, 0x7A, 0xCF, 0x0C, 0x80, 0x73, 0x17, 0x0B, 0x79, 0x6E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x0E, 0x71, 0x63, 0xA8, 0x0C, 0x82, 0x77, 0xFF, 0x0D, 0x89, 0x7C, 0xFF, 0x0C, 0x80, 0x75, 0xFF, 0x0D, 0x85, 0x79, 0xEA, 0x0D, 0x88, 0x7B, 0x50, 0x0C, 0x7F, 0x75, 0x6D, 0x0B, 0x83, 0x74, 0xFE, 0x0D, 0x87, 0x7A, 0xFF, 0x0D, 0x86, 0x79, 0xF2, 0x0C, 0x86, 0x7B, 0x6D, 0x0B, 0x7E, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5A, 0x0B, 0x7F, 0x74, 0xED, 0x0C, 0x87, 0x7B, 0xFF, 0x0C, 0x84, 0x77, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0D, 0x85, 0x78, 0xEB, 0x0D, 0x87, 0x7B, 0x56, 0x0B, 0x82, 0x73, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x23, 0x07, 0x83, 0x74, 0xE7, 0x0C, 0x7D, 0x71, 0xFF, 0x0D, 0x84, 0x78, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x82, 0x76, 0xFE, 0x0C, 0x85, 0x78, 0x7D, 0x0A, 0x7C, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x68, 0x09, 0x81, 0x75, 0xFA, 0x0D, 0x85, 0x79, 0xFF, 0x0C, 0x83, 0x77, 0xF6, 0x0C, 0x82, 0x76, 0xC5, 0x0B, 0x7E, 0x70, 0xD5, 0x0B, 0x80, 0x75, 0xFF, 0x0D, 0x88, 0x7B, 0xFF, 0x0C, 0x7F, 0x72, 0xFF, 0x0D, 0x8B, 0x7E, 0xC1, 0x0D, 0x82, 0x76, 0x21, 0x07, 0x73, 0x6C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1D, 0x11, 0x7B, 0x72, 0xDF, 0x0C, 0x7E, 0x72, 0xFF, 0x0C, 0x85, 0x78, 0xFF, 0x0D, 0x86, 0x7A, 0xCF, 0x0C, 0x80, 0x73, 0x17, 0x0B, 0x79, 0x6E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x10, 0x7B, 0x73, 0xC6, 0x0A, 0x83, 0x76, 0xFF, 0x0D, 0x88, 0x7C, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x84, 0x78, 0xDD, 0x0C, 0x7E, 0x72, 0xBF, 0x0C, 0x80, 0x74, 0xFE, 0x0C, 0x82, 0x75, 0xFF, 0x0D, 0x85, 0x78, 0xF4, 0x0C, 0x86, 0x7A, 0x6E, 0x0B, 0x7F, 0x73, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x91, 0x0C, 0x7C, 0x70, 0xFC, 0x0D, 0x86, 0x79, 0xFF, 0x0C, 0x83, 0x76, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x86, 0x79, 0xDF, 0x0C, 0x84, 0x78, 0x2E, 0x10, 0x7F, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x0D, 0x78, 0x6B, 0xBE, 0x0C, 0x80, 0x74, 0xFF, 0x0D, 0x88, 0x7B, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0D, 0x8A, 0x7E, 0xAA, 0x0C, 0x84, 0x78, 0x11, 0x0F, 0x78, 0x69, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6A, 0x0C, 0x7F, 0x75, 0xDD, 0x0C, 0x83, 0x76, 0xFE, 0x0C, 0x82, 0x75, 0xFF, 0x0C, 0x7F, 0x73, 0xFE, 0x0C, 0x7F, 0x73, 0xFE, 0x0C, 0x81, 0x75, 0xFF, 0x0C, 0x83, 0x77, 0xFF, 0x0C, 0x7F, 0x72, 0xFF, 0x0D, 0x88, 0x7B, 0xD5, 0x0D, 0x88, 0x7B, 0x3E, 0x08, 0x7B, 0x6F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1D, 0x11, 0x7B, 0x72, 0xDF, 0x0C, 0x7E, 0x72, 0xFF, 0x0C, 0x85, 0x78, 0xFF, 0x0D, 0x86, 0x7A, 0xCF, 0x0C, 0x80, 0x73, 0x17, 0x0B, 0x79, 0x6E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0x0D, 0x7D, 0x74, 0xDF, 0x0C, 0x83, 0x79, 0xFF, 0x0C, 0x86, 0x79, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x83, 0x76, 0xFE, 0x0C, 0x81, 0x75, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x80, 0x74, 0xFD, 0x0C, 0x84, 0x76, 0xDD, 0x0B, 0x83, 0x76, 0x68, 0x09, 0x7F, 0x75, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x15, 0x6A, 0x6A, 0xC4, 0x0D, 0x7F, 0x72, 0xFF, 0x0D, 0x87, 0x7A, 0xFF, 0x0C, 0x80, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x86, 0x79, 0xC7, 0x0A, 0x80, 0x73, 0x0A, 0x19, 0x7F, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x7F, 0x7F, 0x8A, 0x0C, 0x83, 0x76, 0xFF, 0x0D, 0x88, 0x7B, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0D, 0x89, 0x7C, 0xDA, 0x0C, 0x84, 0x79, 0x3D, 0x0C, 0x79, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x71, 0x0B, 0x80, 0x70, 0xED, 0x0C, 0x89, 0x7C, 0xFF, 0x0C, 0x86, 0x7A, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x81, 0x75, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0D, 0x84, 0x78, 0xE3, 0x0C, 0x85, 0x79, 0x59, 0x0B, 0x80, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1D, 0x11, 0x7B, 0x72, 0xDF, 0x0C, 0x7E, 0x72, 0xFF, 0x0C, 0x85, 0x78, 0xFF, 0x0D, 0x86, 0x7A, 0xCF, 0x0C, 0x80, 0x73, 0x17, 0x0B, 0x79, 0x6E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x0C, 0x81, 0x75, 0xE7, 0x0C, 0x84, 0x77, 0xFF, 0x0C, 0x83, 0x77, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x81, 0x75, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0D, 0x88, 0x7B, 0xF1, 0x0B, 0x88, 0x7B, 0x6F, 0x0B, 0x7E, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x0B, 0x79, 0x71, 0xE3, 0x0D, 0x86, 0x7A, 0xFF, 0x0D, 0x86, 0x79, 0xFF, 0x0C, 0x7E, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x82, 0x76, 0xFE, 0x0D, 0x85, 0x78, 0x9D, 0x0B, 0x7D, 0x73, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x52, 0x0C, 0x82, 0x76, 0xFF, 0x0C, 0x83, 0x77, 0xFF, 0x0C, 0x81, 0x75, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x83, 0x76, 0xFD, 0x0C, 0x85, 0x77, 0x6F, 0x0B, 0x7C, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x0A, 0x7D, 0x73, 0xDF, 0x0C, 0x86, 0x7A, 0xFF, 0x0D, 0x89, 0x7C, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0D, 0x89, 0x7C, 0xC3, 0x0D, 0x84, 0x78, 0x1A, 0x09, 0x75, 0x6B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1D, 0x11, 0x7B, 0x72, 0xDF, 0x0C, 0x7E, 0x72, 0xFF, 0x0C, 0x85, 0x78, 0xFF, 0x0D, 0x86, 0x7A, 0xCF, 0x0C, 0x80, 0x73, 0x17, 0x0B, 0x79, 0x6E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x7F, 0x7F, 0xD1, 0x0A, 0x81, 0x73, 0xFF, 0x0C, 0x86, 0x79, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0D, 0x8C, 0x7F, 0xD7, 0x0D, 0x87, 0x7B, 0x3B, 0x0C, 0x79, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0x0B, 0x7D, 0x72, 0xFB, 0x0C, 0x86, 0x78, 0xFF, 0x0C, 0x83, 0x76, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x84, 0x77, 0xF2, 0x0C, 0x87, 0x7B, 0x65, 0x0C, 0x7E, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x06, 0x78, 0x72, 0xE2, 0x0B, 0x80, 0x75, 0xFF, 0x0D, 0x85, 0x79, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0D, 0x8B, 0x7E, 0xA9, 0x0D, 0x86, 0x78, 0x13, 0x0D, 0x78, 0x6B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x85, 0x0B, 0x7E, 0x73, 0xFC, 0x0C, 0x87, 0x7A, 0xFF, 0x0C, 0x83, 0x76, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0D, 0x86, 0x79, 0xE9, 0x0D, 0x85, 0x79, 0x58, 0x0B, 0x7C, 0x71, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1D, 0x11, 0x7B, 0x72, 0xDF, 0x0C, 0x7E, 0x72, 0xFF, 0x0C, 0x85, 0x78, 0xFF, 0x0D, 0x86, 0x7A, 0xCF, 0x0C, 0x80, 0x73, 0x17, 0x0B, 0x79, 0x6E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x51, 0x0C, 0x81, 0x74, 0xEC, 0x0C, 0x87, 0x7B, 0xFF, 0x0C, 0x83, 0x77, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x83, 0x76, 0xFF, 0x0D, 0x86, 0x7A, 0x7F, 0x0C, 0x7E, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x11, 0x77, 0x66, 0xC2, 0x0B, 0x7F, 0x73, 0xFF, 0x0D, 0x87, 0x7B, 0xFF, 0x0C, 0x80, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x85, 0x78, 0xE2, 0x0C, 0x82, 0x76, 0x2A, 0x0C, 0x7F, 0x73, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x0F, 0x6F, 0x5F, 0xA6, 0x0C, 0x82, 0x76, 0xFF, 0x0D, 0x8A, 0x7D, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0D, 0x87, 0x7A, 0xE6, 0x0C, 0x85, 0x77, 0x45, 0x0B, 0x79, 0x6E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAE, 0x0A, 0x7F, 0x72, 0xFF, 0x0D, 0x86, 0x79, 0xFF, 0x0C, 0x81, 0x75, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0D, 0x82, 0x76, 0xFF, 0x0C, 0x85, 0x79, 0x81, 0x09, 0x7E, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1D, 0x11, 0x7B, 0x72, 0xDF, 0x0C, 0x7E, 0x72, 0xFF, 0x0C, 0x85, 0x78, 0xFF, 0x0D, 0x87, 0x7A, 0xCE, 0x0C, 0x7F, 0x73, 0x15, 0x0C, 0x85, 0x79, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x85, 0x0B, 0x80, 0x74, 0xFA, 0x0C, 0x87, 0x7B, 0xFF, 0x0C, 0x82, 0x76, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0D, 0x89, 0x7C, 0xA3, 0x0C, 0x80, 0x75, 0x03, 0x00, 0xAA, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x52, 0x0C, 0x7C, 0x6F, 0xE8, 0x0D, 0x87, 0x7A, 0xFF, 0x0D, 0x86, 0x7A, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x86, 0x79, 0xB9, 0x0B, 0x7E, 0x72, 0x02, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x0D, 0x80, 0x76, 0xFF, 0x0D, 0x86, 0x7A, 0xFF, 0x0C, 0x80, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0D, 0x8A, 0x7C, 0x86, 0x0B, 0x7F, 0x74, 0x03, 0x00, 0x55, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB1, 0x0A, 0x7E, 0x71, 0xFF, 0x0D, 0x86, 0x79, 0xFF, 0x0C, 0x81, 0x75, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x82, 0x77, 0xFD, 0x0C, 0x84, 0x78, 0x7B, 0x0A, 0x7C, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1D, 0x11, 0x7B, 0x72, 0xDF, 0x0C, 0x7E, 0x72, 0xFF, 0x0C, 0x85, 0x78, 0xFF, 0x0D, 0x87, 0x7A, 0xCE, 0x0C, 0x7F, 0x73, 0x15, 0x0C, 0x85, 0x79, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x0C, 0x80, 0x74, 0xF8, 0x0C, 0x87, 0x7A, 0xFF, 0x0C, 0x82, 0x76, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0D, 0x8A, 0x7C, 0xA5, 0x0C, 0x80, 0x75, 0x05, 0x00, 0x99, 0x99, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x7F, 0x7F, 0x9E, 0x0B, 0x7F, 0x72, 0xFF, 0x0C, 0x87, 0x7A, 0xFF, 0x0C, 0x81, 0x75, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x83, 0x76, 0xF8, 0x0D, 0x87, 0x7B, 0x74, 0x0D, 0x7F, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2B, 0x0B, 0x7C, 0x70, 0xE4, 0x0C, 0x7F, 0x74, 0xFF, 0x0C, 0x85, 0x79, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0D, 0x89, 0x7C, 0xD0, 0x0C, 0x85, 0x78, 0x2F, 0x0A, 0x77, 0x6C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8E, 0x0C, 0x7D, 0x72, 0xFE, 0x0D, 0x87, 0x7A, 0xFF, 0x0C, 0x82, 0x76, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0D, 0x84, 0x78, 0xF4, 0x0C, 0x84, 0x78, 0x6C, 0x09, 0x7A, 0x6E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1D, 0x11, 0x7B, 0x72, 0xDF, 0x0C, 0x7E, 0x72, 0xFF, 0x0C, 0x85, 0x78, 0xFF, 0x0D, 0x87, 0x7A, 0xCE, 0x0C, 0x7F, 0x73, 0x15, 0x0C, 0x85, 0x79, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x65, 0x0C, 0x7E, 0x76, 0xF4, 0x0C, 0x86, 0x7A, 0xFF, 0x0C, 0x83, 0x77, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x82, 0x76, 0xFF, 0x0C, 0x88, 0x7A, 0x87, 0x0B, 0x7E, 0x71, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x36, 0x09, 0x7A, 0x6C, 0xD8, 0x0C, 0x86, 0x79, 0xFF, 0x0D, 0x88, 0x7B, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x85, 0x78, 0xE5, 0x0D, 0x82, 0x77, 0x2A, 0x0C, 0x7F, 0x6D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x11, 0x77, 0x77, 0x9A, 0x0B, 0x84, 0x77, 0xFF, 0x0D, 0x8B, 0x7E, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x81, 0x75, 0xFF, 0x0C, 0x88, 0x7B, 0x6F, 0x0B, 0x82, 0x75, 0x03, 0x00, 0x55, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x0C, 0x81, 0x70, 0xE6, 0x0D, 0x88, 0x7B, 0xFF, 0x0C, 0x88, 0x7B, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7E, 0x73, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x83, 0x77, 0xBC, 0x0C, 0x84, 0x78, 0x3D, 0x0C, 0x7D, 0x75, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1D, 0x11, 0x7B, 0x72, 0xDF, 0x0C, 0x7E, 0x72, 0xFF, 0x0C, 0x85, 0x78, 0xFF, 0x0D, 0x87, 0x7A, 0xCE, 0x0C, 0x7F, 0x73, 0x15, 0x0C, 0x85, 0x79, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3B, 0x0C, 0x7D, 0x70, 0xBE, 0x0D, 0x84, 0x78, 0xFF, 0x0C, 0x83, 0x76, 0xFF, 0x0C, 0x80, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0E, 0x8B, 0x7E, 0xE2, 0x0D, 0x86, 0x78, 0x43, 0x0B, 0x79, 0x6E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x89, 0x0D, 0x7E, 0x73, 0xFE, 0x0C, 0x86, 0x79, 0xFF, 0x0D, 0x83, 0x76, 0xFF, 0x0C, 0x7E, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x80, 0x74, 0xFE, 0x0D, 0x88, 0x7B, 0xAD, 0x0B, 0x80, 0x72, 0x01, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x0C, 0x7F, 0x72, 0xFA, 0x0C, 0x85, 0x77, 0xFF, 0x0C, 0x82, 0x76, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0D, 0x8A, 0x7D, 0xC7, 0x0C, 0x85, 0x77, 0x25, 0x06, 0x75, 0x67, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0x0D, 0x7F, 0x70, 0xF9, 0x0D, 0x88, 0x7B, 0xFF, 0x0D, 0x8A, 0x7D, 0xFF, 0x0C, 0x83, 0x77, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x81, 0x74, 0xFF, 0x0D, 0x84, 0x78, 0xFF, 0x0D, 0x87, 0x7A, 0xFF, 0x0D, 0x82, 0x76, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0E, 0x8A, 0x7C, 0xDB, 0x0C, 0x85, 0x7A, 0x57, 0x0B, 0x83, 0x78, 0x04, 0x00, 0x7F, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x10, 0x7B, 0x73, 0xE0, 0x0C, 0x7E, 0x72, 0xFF, 0x0C, 0x85, 0x78, 0xFF, 0x0D, 0x87, 0x7A, 0xCE, 0x0C, 0x7F, 0x73, 0x15, 0x0C, 0x85, 0x79, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x7F, 0x55, 0x5B, 0x0B, 0x7E, 0x72, 0xDD, 0x0C, 0x84, 0x77, 0xFF, 0x0D, 0x88, 0x7B, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0D, 0x83, 0x77, 0xFF, 0x0D, 0x87, 0x7A, 0xFF, 0x0D, 0x84, 0x77, 0xFF, 0x0C, 0x81, 0x74, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0D, 0x83, 0x77, 0xFF, 0x0D, 0x8A, 0x7E, 0xF8, 0x0D, 0x89, 0x7B, 0x81, 0x0B, 0x80, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2A, 0x0C, 0x79, 0x6D, 0xD0, 0x0D, 0x84, 0x79, 0xFF, 0x0D, 0x8A, 0x7C, 0xFF, 0x0C, 0x7E, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x83, 0x76, 0xF7, 0x0C, 0x86, 0x79, 0x56, 0x0B, 0x82, 0x76, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1D, 0x08, 0x72, 0x69, 0xC0, 0x0D, 0x83, 0x76, 0xFF, 0x0D, 0x8B, 0x7D, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x81, 0x75, 0xFF, 0x0D, 0x87, 0x7A, 0x6B, 0x0E, 0x80, 0x72, 0x03, 0x00, 0x55, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x8D, 0x71, 0x81, 0x0B, 0x80, 0x74, 0xDC, 0x0C, 0x8B, 0x7D, 0xFE, 0x0D, 0x86, 0x79, 0xFF, 0x0C, 0x87, 0x7B, 0xFF, 0x0C, 0x88, 0x7B, 0xF4, 0x0C, 0x85, 0x79, 0xDA, 0x0C, 0x86, 0x79, 0xF4, 0x0C, 0x83, 0x77, 0xFF, 0x0D, 0x87, 0x7A, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0D, 0x89, 0x7C, 0xEC, 0x0C, 0x89, 0x7C, 0x75, 0x0A, 0x82, 0x77, 0x10, 0x00, 0x6F, 0x6F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x10, 0x7B, 0x73, 0xE0, 0x0C, 0x7E, 0x72, 0xFF, 0x0C, 0x85, 0x78, 0xFF, 0x0D, 0x87, 0x7A, 0xCE, 0x0C, 0x7F, 0x73, 0x15, 0x0C, 0x85, 0x79, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x0F, 0x78, 0x69, 0x78, 0x0C, 0x83, 0x77, 0xF1, 0x0C, 0x86, 0x79, 0xFF, 0x0D, 0x88, 0x7C, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0D, 0x86, 0x79, 0xF7, 0x0C, 0x84, 0x76, 0xD9, 0x0C, 0x85, 0x7A, 0xF6, 0x0C, 0x85, 0x79, 0xFF, 0x0C, 0x88, 0x7B, 0xFF, 0x0C, 0x88, 0x7B, 0xFE, 0x0C, 0x85, 0x7A, 0xDA, 0x0C, 0x8B, 0x7E, 0x80, 0x09, 0x7F, 0x73, 0x0D, 0x00, 0x75, 0x62, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x83, 0x0B, 0x80, 0x74, 0xFC, 0x0C, 0x87, 0x7A, 0xFF, 0x0D, 0x83, 0x76, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x87, 0x7A, 0xD2, 0x0C, 0x7F, 0x73, 0x13, 0x00, 0x78, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x7F, 0x7F, 0x6A, 0x0C, 0x81, 0x78, 0xFF, 0x0D, 0x88, 0x7B, 0xFF, 0x0C, 0x81, 0x75, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0D, 0x89, 0x7D, 0xCF, 0x0C, 0x82, 0x76, 0x26, 0x06, 0x78, 0x6B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x0B, 0x83, 0x73, 0x82, 0x0B, 0x83, 0x75, 0xA3, 0x0A, 0x7E, 0x73, 0x9F, 0x0B, 0x80, 0x75, 0x6E, 0x0B, 0x81, 0x73, 0x3C, 0x0C, 0x7B, 0x72, 0x7B, 0x0C, 0x82, 0x76, 0xEC, 0x0C, 0x89, 0x7C, 0xFF, 0x0D, 0x89, 0x7D, 0xFF, 0x0C, 0x7E, 0x73, 0xFF, 0x0D, 0x86, 0x79, 0xFC, 0x0C, 0x87, 0x7A, 0x98, 0x0A, 0x82, 0x77, 0x20, 0x0F, 0x77, 0x6F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x10, 0x7B, 0x73, 0xE0, 0x0C, 0x7E, 0x72, 0xFF, 0x0C, 0x85, 0x78, 0xFF, 0x0D, 0x87, 0x7A, 0xCE, 0x0C, 0x7F, 0x73, 0x15, 0x0C, 0x85, 0x79, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x0F, 0x77, 0x6F, 0x96, 0x0B, 0x84, 0x78, 0xFC, 0x0D, 0x87, 0x7B, 0xFF, 0x0D, 0x86, 0x79, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0D, 0x8A, 0x7C, 0xEB, 0x0D, 0x87, 0x7A, 0x7C, 0x0C, 0x7F, 0x73, 0x3C, 0x0C, 0x7B, 0x72, 0x73, 0x0D, 0x80, 0x75, 0x9E, 0x0C, 0x81, 0x75, 0xA1, 0x0B, 0x81, 0x75, 0x82, 0x0B, 0x7F, 0x75, 0x3E, 0x0C, 0x7F, 0x77, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2E, 0x0B, 0x79, 0x69, 0xD4, 0x0C, 0x84, 0x77, 0xFF, 0x0D, 0x89, 0x7C, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x81, 0x75, 0xFF, 0x0D, 0x87, 0x7A, 0x77, 0x0C, 0x7E, 0x75, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x06, 0x6F, 0x69, 0xD5, 0x0B, 0x81, 0x75, 0xFF, 0x0D, 0x89, 0x7D, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x80, 0x75, 0xFF, 0x0C, 0x89, 0x7C, 0x79, 0x0A, 0x82, 0x76, 0x06, 0x00, 0x55, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x7F, 0x7F, 0x63, 0x0A, 0x7E, 0x73, 0xDB, 0x0C, 0x87, 0x7B, 0xFF, 0x0E, 0x8B, 0x7D, 0xFF, 0x0C, 0x80, 0x73, 0xFF, 0x0D, 0x82, 0x77, 0xFF, 0x0D, 0x8A, 0x7D, 0xB8, 0x0C, 0x83, 0x78, 0x37, 0x09, 0x78, 0x6F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x10, 0x7B, 0x73, 0xE0, 0x0C, 0x7E, 0x72, 0xFF, 0x0C, 0x85, 0x78, 0xFF, 0x0D, 0x87, 0x7A, 0xCE, 0x0C, 0x7F, 0x73, 0x15, 0x0C, 0x85, 0x79, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0x09, 0x7D, 0x6E, 0xB8, 0x0C, 0x85, 0x78, 0xFF, 0x0D, 0x8A, 0x7E, 0xFF, 0x0D, 0x83, 0x76, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0D, 0x8B, 0x7D, 0xDA, 0x0C, 0x87, 0x7A, 0x5F, 0x0A, 0x80, 0x73, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x55, 0x55, 0x8B, 0x0C, 0x82, 0x75, 0xFF, 0x0D, 0x89, 0x7B, 0xFF, 0x0D, 0x82, 0x75, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x85, 0x79, 0xE3, 0x0C, 0x81, 0x74, 0x22, 0x0F, 0x7F, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x7F, 0x55, 0x78, 0x0C, 0x85, 0x77, 0xFF, 0x0D, 0x8A, 0x7D, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7E, 0x73, 0xFF, 0x0D, 0x87, 0x7A, 0xE0, 0x0C, 0x85, 0x77, 0x34, 0x09, 0x7A, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0x0B, 0x7D, 0x72, 0xC6, 0x0C, 0x83, 0x77, 0xFF, 0x0D, 0x8B, 0x7D, 0xFF, 0x0D, 0x83, 0x75, 0xFF, 0x0D, 0x7F, 0x73, 0xFF, 0x0D, 0x8B, 0x7E, 0xD0, 0x0C, 0x86, 0x7A, 0x52, 0x0C, 0x7F, 0x76, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x10, 0x7B, 0x73, 0xE0, 0x0C, 0x7E, 0x72, 0xFF, 0x0C, 0x85, 0x78, 0xFF, 0x0D, 0x87, 0x7A, 0xCE, 0x0C, 0x7F, 0x73, 0x15, 0x0C, 0x85, 0x79, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0x09, 0x7D, 0x71, 0xD1, 0x0C, 0x87, 0x7B, 0xFF, 0x0D, 0x8C, 0x7E, 0xFF, 0x0D, 0x80, 0x75, 0xFF, 0x0D, 0x81, 0x75, 0xFF, 0x0D, 0x8B, 0x7D, 0xC5, 0x0C, 0x86, 0x79, 0x44, 0x0B, 0x7F, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x0B, 0x77, 0x6F, 0xE0, 0x0C, 0x86, 0x79, 0xFF, 0x0D, 0x89, 0x7B, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0D, 0x88, 0x7C, 0x86, 0x0D, 0x81, 0x74, 0x03, 0x00, 0x55, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2D, 0x0B, 0x7C, 0x6B, 0xD8, 0x0C, 0x84, 0x77, 0xFF, 0x0D, 0x8A, 0x7C, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0D, 0x8B, 0x7E, 0x9D, 0x09, 0x80, 0x74, 0x09, 0x00, 0x71, 0x71, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2A, 0x0C, 0x79, 0x73, 0xA7, 0x0C, 0x86, 0x7A, 0xFF, 0x0D, 0x89, 0x7C, 0xFF, 0x0D, 0x85, 0x78, 0xFF, 0x0C, 0x7E, 0x71, 0xFF, 0x0D, 0x8A, 0x7D, 0xE4, 0x0D, 0x89, 0x7C, 0x6C, 0x0B, 0x86, 0x78, 0x07, 0x00, 0x6D, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x0F, 0x77, 0x6F, 0xE0, 0x0C, 0x7E, 0x72, 0xFF, 0x0C, 0x85, 0x78, 0xFF, 0x0D, 0x87, 0x7A, 0xCE, 0x0C, 0x7F, 0x73, 0x15, 0x0C, 0x85, 0x79, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x7F, 0x5F, 0x71, 0x0B, 0x82, 0x75, 0xE7, 0x0C, 0x87, 0x7B, 0xFF, 0x0D, 0x8A, 0x7E, 0xFF, 0x0C, 0x7E, 0x73, 0xFF, 0x0D, 0x85, 0x79, 0xFF, 0x0D, 0x88, 0x7B, 0xA9, 0x0C, 0x83, 0x75, 0x2A, 0x0C, 0x7F, 0x73, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x0E, 0x71, 0x71, 0xA4, 0x0C, 0x82, 0x77, 0xFF, 0x0D, 0x8B, 0x7E, 0xFF, 0x0D, 0x80, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x86, 0x7A, 0xE5, 0x0C, 0x82, 0x76, 0x29, 0x0C, 0x7C, 0x6F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x66, 0x66, 0x78, 0x0C, 0x83, 0x77, 0xFF, 0x0D, 0x89, 0x7D, 0xFF, 0x0D, 0x81, 0x75, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0D, 0x83, 0x77, 0xF6, 0x0C, 0x86, 0x7A, 0x52, 0x0C, 0x82, 0x76, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x0B, 0x7F, 0x73, 0x88, 0x0D, 0x85, 0x79, 0xF4, 0x0D, 0x87, 0x7B, 0xFF, 0x0D, 0x88, 0x7B, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0D, 0x88, 0x7B, 0xF4, 0x0C, 0x88, 0x7B, 0x90, 0x0A, 0x83, 0x76, 0x18, 0x0A, 0x74, 0x6A, 0x00, 0x00, 0x00, 0x00, 0x18, 0x15, 0x7F, 0x74, 0xDF, 0x0C, 0x7E, 0x73, 0xFF, 0x0C, 0x85, 0x78, 0xFF, 0x0D, 0x87, 0x7A, 0xCC, 0x0C, 0x7F, 0x73, 0x10, 0x0F, 0x8F, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x19, 0x14, 0x7A, 0x70, 0x90, 0x0C, 0x84, 0x78, 0xF5, 0x0C, 0x89, 0x7B, 0xFF, 0x0D, 0x88, 0x7B, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0D, 0x88, 0x7B, 0xF3, 0x0C, 0x88, 0x7B, 0x86, 0x0D, 0x85, 0x75, 0x16, 0x0B, 0x73, 0x68, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0x0C, 0x80, 0x73, 0xF1, 0x0C, 0x89, 0x7B, 0xFF, 0x0C, 0x85, 0x79, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0D, 0x89, 0x7C, 0x81, 0x0B, 0x80, 0x74, 0x03, 0x00, 0x55, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x06, 0x79, 0x6C, 0xCD, 0x0C, 0x83, 0x77, 0xFF, 0x0D, 0x8B, 0x7E, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0D, 0x89, 0x7C, 0xCF, 0x0C, 0x81, 0x76, 0x1F, 0x08, 0x7B, 0x73, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x1C, 0x71, 0x71, 0x6B, 0x0E, 0x83, 0x74, 0xE4, 0x0C, 0x87, 0x7B, 0xFF, 0x0D, 0x8A, 0x7D, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0D, 0x84, 0x78, 0xFF, 0x0D, 0x88, 0x7B, 0xAF, 0x0B, 0x83, 0x77, 0x27, 0x06, 0x7C, 0x75, 0x15, 0x0C, 0x79, 0x6D, 0xE0, 0x0B, 0x80, 0x74, 0xFF, 0x0C, 0x85, 0x78, 0xFF, 0x0D, 0x87, 0x7A, 0xCC, 0x0C, 0x80, 0x74, 0x0A, 0x19, 0x7F, 0x7F, 0x2A, 0x0C, 0x7F, 0x73, 0xB0, 0x0D, 0x83, 0x76, 0xFF, 0x0D, 0x89, 0x7C, 0xFF, 0x0D, 0x85, 0x78, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0D, 0x8B, 0x7D, 0xE2, 0x0C, 0x88, 0x7A, 0x67, 0x09, 0x83, 0x76, 0x07, 0x24, 0x6D, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x06, 0x76, 0x69, 0xD2, 0x0C, 0x81, 0x75, 0xFF, 0x0D, 0x8B, 0x7E, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0D, 0x87, 0x7B, 0xDB, 0x0C, 0x81, 0x75, 0x25, 0x0D, 0x7C, 0x6E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x1F, 0x7F, 0x5F, 0x45, 0x0B, 0x79, 0x72, 0x56, 0x08, 0x7C, 0x70, 0x51, 0x09, 0x7D, 0x74, 0x51, 0x09, 0x7D, 0x74, 0x51, 0x09, 0x7D, 0x74, 0x53, 0x09, 0x7D, 0x71, 0x52, 0x0C, 0x7F, 0x76, 0x2C, 0x0B, 0x7F, 0x73, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x7F, 0x7F, 0x6B, 0x0B, 0x80, 0x74, 0xFA, 0x0C, 0x87, 0x7B, 0xFF, 0x0D, 0x84, 0x77, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0D, 0x8A, 0x7D, 0x93, 0x0C, 0x82, 0x75, 0x06, 0x00, 0x7F, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4A, 0x0D, 0x7F, 0x71, 0xCD, 0x0C, 0x86, 0x79, 0xFF, 0x0C, 0x8B, 0x7E, 0xFF, 0x0C, 0x80, 0x75, 0xFF, 0x0D, 0x82, 0x76, 0xFF, 0x0C, 0x87, 0x7B, 0xCA, 0x0B, 0x7F, 0x74, 0xAE, 0x0A, 0x7E, 0x72, 0xF5, 0x0B, 0x81, 0x74, 0xFF, 0x0C, 0x81, 0x75, 0xFF, 0x0C, 0x82, 0x76, 0xED, 0x0B, 0x81, 0x74, 0xA7, 0x0A, 0x7D, 0x72, 0xC6, 0x0B, 0x80, 0x75, 0xFF, 0x0D, 0x89, 0x7C, 0xFF, 0x0C, 0x82, 0x75, 0xFF, 0x0D, 0x80, 0x73, 0xFF, 0x0D, 0x8B, 0x7E, 0xCB, 0x0C, 0x86, 0x79, 0x4B, 0x0D, 0x81, 0x73, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x0F, 0x6F, 0x6F, 0x98, 0x0B, 0x84, 0x77, 0xFF, 0x0D, 0x8C, 0x7E, 0xFF, 0x0C, 0x80, 0x75, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x80, 0x75, 0xFF, 0x0D, 0x86, 0x7B, 0x6A, 0x0C, 0x81, 0x75, 0x02, 0x00, 0x7F, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x55, 0x55, 0x30, 0x0A, 0x7F, 0x74, 0x53, 0x0C, 0x81, 0x77, 0x52, 0x09, 0x7C, 0x6F, 0x51, 0x09, 0x7D, 0x74, 0x51, 0x09, 0x7D, 0x74, 0x51, 0x09, 0x7D, 0x74, 0x57, 0x0B, 0x7E, 0x72, 0x40, 0x0F, 0x7F, 0x73, 0x0C, 0x15, 0x7F, 0x6A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x09, 0x7F, 0x75, 0xC2, 0x0D, 0x87, 0x7A, 0xE7, 0x0D, 0x8D, 0x7E, 0xE5, 0x0C, 0x86, 0x7A, 0xE5, 0x0C, 0x86, 0x7A, 0xE5, 0x0C, 0x86, 0x7A, 0xE5, 0x0C, 0x8B, 0x7D, 0xE5, 0x0D, 0x8C, 0x7E, 0x87, 0x0B, 0x7C, 0x71, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x0C, 0x6D, 0x6D, 0xB6, 0x0B, 0x83, 0x75, 0xFF, 0x0D, 0x8B, 0x7F, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x84, 0x77, 0xF6, 0x0C, 0x86, 0x79, 0x59, 0x0B, 0x80, 0x75, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2D, 0x0B, 0x7C, 0x71, 0xB1, 0x0B, 0x85, 0x79, 0xFF, 0x0C, 0x8A, 0x7C, 0xFF, 0x0C, 0x83, 0x76, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0D, 0x87, 0x7A, 0xFF, 0x0C, 0x86, 0x7A, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x81, 0x74, 0xFF, 0x0C, 0x86, 0x7A, 0xFF, 0x0C, 0x86, 0x7A, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0D, 0x83, 0x77, 0xFF, 0x0D, 0x8A, 0x7C, 0xB0, 0x0D, 0x85, 0x78, 0x30, 0x0A, 0x7A, 0x6F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0x0C, 0x80, 0x73, 0xF3, 0x0C, 0x89, 0x7B, 0xFF, 0x0C, 0x85, 0x78, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0D, 0x8A, 0x7D, 0xBF, 0x0C, 0x81, 0x76, 0x19, 0x0A, 0x7A, 0x65, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x66, 0x66, 0x8E, 0x0A, 0x84, 0x76, 0xE6, 0x0D, 0x90, 0x82, 0xE5, 0x0C, 0x87, 0x7B, 0xE5, 0x0C, 0x86, 0x7A, 0xE5, 0x0C, 0x86, 0x7A, 0xE5, 0x0C, 0x86, 0x79, 0xE8, 0x0D, 0x91, 0x83, 0xB4, 0x0E, 0x8C, 0x7F, 0x27, 0x0D, 0x75, 0x6F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1D, 0x08, 0x83, 0x72, 0xDE, 0x0C, 0x81, 0x76, 0xFF, 0x0E, 0x8E, 0x80, 0xFF, 0x0D, 0x86, 0x7A, 0xFF, 0x0D, 0x86, 0x7A, 0xFF, 0x0D, 0x86, 0x7A, 0xFF, 0x0D, 0x8A, 0x7D, 0xFF, 0x0E, 0x8C, 0x7E, 0x94, 0x0C, 0x7D, 0x73, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x0C, 0x7C, 0x72, 0xE5, 0x0D, 0x88, 0x7B, 0xFF, 0x0D, 0x88, 0x7B, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0D, 0x88, 0x7B, 0xDC, 0x0C, 0x82, 0x76, 0x2E, 0x10, 0x79, 0x6E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0x09, 0x7A, 0x71, 0x91, 0x0C, 0x85, 0x77, 0xF5, 0x0B, 0x84, 0x77, 0xFF, 0x0C, 0x81, 0x75, 0xFF, 0x0C, 0x80, 0x73, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x81, 0x74, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0D, 0x82, 0x76, 0xF6, 0x0D, 0x85, 0x78, 0x91, 0x0C, 0x83, 0x75, 0x1A, 0x09, 0x7F, 0x6B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x36, 0x0E, 0x7A, 0x71, 0xDF, 0x0C, 0x83, 0x75, 0xFF, 0x0D, 0x89, 0x7C, 0xFF, 0x0C, 0x7E, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0D, 0x84, 0x78, 0xF4, 0x0B, 0x84, 0x78, 0x4B, 0x0A, 0x7D, 0x73, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x66, 0x66, 0x9E, 0x0B, 0x82, 0x77, 0xFF, 0x0E, 0x90, 0x82, 0xFF, 0x0D, 0x87, 0x7B, 0xFF, 0x0D, 0x86, 0x7A, 0xFF, 0x0D, 0x86, 0x7A, 0xFF, 0x0D, 0x85, 0x79, 0xFF, 0x0E, 0x92, 0x84, 0xCB, 0x0D, 0x8A, 0x7D, 0x2B, 0x0B, 0x76, 0x6A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0x09, 0x84, 0x71, 0xD7, 0x0B, 0x7D, 0x73, 0xFF, 0x0D, 0x85, 0x78, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0C, 0x81, 0x75, 0xFC, 0x0D, 0x84, 0x77, 0x8B, 0x0C, 0x7E, 0x73, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x6D, 0x6D, 0x8E, 0x0C, 0x81, 0x74, 0xFF, 0x0D, 0x88, 0x7C, 0xFF, 0x0D, 0x82, 0x76, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x81, 0x75, 0xFF, 0x0D, 0x89, 0x7D, 0xB6, 0x0C, 0x82, 0x74, 0x11, 0x0F, 0x78, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0x13, 0x75, 0x75, 0x9A, 0x0D, 0x7D, 0x72, 0xFB, 0x0D, 0x86, 0x78, 0xFF, 0x0C, 0x81, 0x75, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0D, 0x82, 0x76, 0xFD, 0x0D, 0x84, 0x77, 0x8A, 0x0C, 0x81, 0x74, 0x0D, 0x13, 0x75, 0x62, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x09, 0x76, 0x6D, 0xB7, 0x0C, 0x84, 0x77, 0xFF, 0x0D, 0x8B, 0x7E, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0D, 0x8B, 0x7D, 0x90, 0x0C, 0x81, 0x74, 0x07, 0x00, 0x6D, 0x6D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x71, 0x71, 0x95, 0x0B, 0x82, 0x77, 0xFF, 0x0D, 0x87, 0x7A, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0C, 0x7D, 0x71, 0xFF, 0x0D, 0x89, 0x7C, 0xC4, 0x0D, 0x87, 0x7A, 0x28, 0x0C, 0x79, 0x6C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0x09, 0x84, 0x71, 0xD7, 0x0B, 0x7E, 0x73, 0xFF, 0x0D, 0x86, 0x79, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x82, 0x76, 0xFC, 0x0D, 0x85, 0x78, 0x8C, 0x0C, 0x7D, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x0E, 0x78, 0x6A, 0xC2, 0x0D, 0x83, 0x77, 0xFF, 0x0D, 0x87, 0x7B, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x82, 0x77, 0xFF, 0x0D, 0x87, 0x7B, 0x90, 0x0C, 0x7F, 0x74, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x91, 0x0C, 0x7C, 0x72, 0xFE, 0x0D, 0x85, 0x79, 0xFF, 0x0C, 0x82, 0x75, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x83, 0x76, 0xFE, 0x0C, 0x84, 0x78, 0x75, 0x0A, 0x7C, 0x71, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x11, 0x77, 0x66, 0x91, 0x0C, 0x83, 0x77, 0xFE, 0x0D, 0x89, 0x7C, 0xFF, 0x0C, 0x81, 0x75, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0D, 0x87, 0x7A, 0xC8, 0x0C, 0x83, 0x77, 0x2A, 0x0C, 0x79, 0x6D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x71, 0x71, 0x96, 0x0B, 0x81, 0x76, 0xFF, 0x0D, 0x88, 0x7B, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0D, 0x8A, 0x7D, 0xC4, 0x0D, 0x87, 0x7A, 0x28, 0x0C, 0x79, 0x6C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0x09, 0x84, 0x71, 0xD7, 0x0B, 0x7E, 0x73, 0xFF, 0x0D, 0x86, 0x79, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x82, 0x76, 0xFC, 0x0D, 0x85, 0x78, 0x8C, 0x0C, 0x7D, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x87, 0x0B, 0x7E, 0x73, 0xFF, 0x0D, 0x86, 0x7A, 0xFF, 0x0C, 0x82, 0x76, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x84, 0x78, 0xF4, 0x0D, 0x88, 0x7B, 0x71, 0x0B, 0x7E, 0x73, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA9, 0x0C, 0x7E, 0x72, 0xFF, 0x0D, 0x86, 0x79, 0xFF, 0x0C, 0x81, 0x75, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x81, 0x75, 0xFF, 0x0C, 0x87, 0x7A, 0x8C, 0x0A, 0x7D, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x33, 0x33, 0x72, 0x0D, 0x83, 0x76, 0xF8, 0x0D, 0x87, 0x7B, 0xFF, 0x0C, 0x84, 0x78, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0D, 0x89, 0x7C, 0x7C, 0x0C, 0x7F, 0x75, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x71, 0x71, 0x96, 0x0B, 0x81, 0x76, 0xFF, 0x0D, 0x88, 0x7B, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0D, 0x8A, 0x7D, 0xC4, 0x0D, 0x87, 0x7A, 0x28, 0x0C, 0x79, 0x6C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0x09, 0x84, 0x71, 0xD7, 0x0B, 0x7E, 0x73, 0xFF, 0x0D, 0x86, 0x79, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x82, 0x76, 0xFC, 0x0D, 0x85, 0x78, 0x8C, 0x0C, 0x7D, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0x0B, 0x7D, 0x72, 0xFF, 0x0D, 0x85, 0x79, 0xFF, 0x0C, 0x82, 0x76, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x86, 0x7A, 0xE9, 0x0D, 0x87, 0x7A, 0x5A, 0x0B, 0x7F, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x91, 0x0C, 0x80, 0x74, 0xFD, 0x0D, 0x87, 0x7A, 0xFF, 0x0C, 0x82, 0x76, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0D, 0x83, 0x77, 0xFF, 0x0D, 0x85, 0x78, 0x79, 0x0C, 0x7E, 0x71, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5B, 0x0E, 0x7E, 0x70, 0xF4, 0x0C, 0x83, 0x77, 0xFF, 0x0C, 0x85, 0x79, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0D, 0x89, 0x7C, 0x76, 0x0C, 0x81, 0x76, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x71, 0x71, 0x96, 0x0B, 0x81, 0x76, 0xFF, 0x0D, 0x88, 0x7B, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0D, 0x8A, 0x7D, 0xC4, 0x0D, 0x87, 0x7A, 0x28, 0x0C, 0x79, 0x6C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0x09, 0x84, 0x71, 0xD7, 0x0B, 0x7E, 0x73, 0xFF, 0x0D, 0x86, 0x79, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x82, 0x76, 0xFC, 0x0D, 0x85, 0x78, 0x8C, 0x0C, 0x7D, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8B, 0x0C, 0x7C, 0x6F, 0xFF, 0x0C, 0x86, 0x79, 0xFF, 0x0C, 0x82, 0x76, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0D, 0x88, 0x7A, 0xE1, 0x0D, 0x85, 0x78, 0x4A, 0x0A, 0x7F, 0x71, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4A, 0x0A, 0x7F, 0x71, 0xEE, 0x0C, 0x88, 0x7B, 0xFF, 0x0C, 0x86, 0x79, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0D, 0x8A, 0x7D, 0xDD, 0x0C, 0x88, 0x7B, 0x40, 0x0B, 0x7B, 0x6F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0x0A, 0x7D, 0x76, 0xE7, 0x0C, 0x84, 0x77, 0xFF, 0x0D, 0x87, 0x7A, 0xFF, 0x0C, 0x7E, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0D, 0x89, 0x7C, 0x7B, 0x0C, 0x82, 0x76, 0x02, 0x00, 0x7F, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x71, 0x71, 0x96, 0x0B, 0x81, 0x76, 0xFF, 0x0D, 0x88, 0x7B, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0D, 0x8A, 0x7D, 0xC4, 0x0D, 0x87, 0x7A, 0x28, 0x0C, 0x79, 0x6C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0x09, 0x84, 0x71, 0xD7, 0x0B, 0x7E, 0x73, 0xFF, 0x0D, 0x86, 0x79, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x82, 0x76, 0xFC, 0x0D, 0x85, 0x78, 0x8C, 0x0C, 0x7D, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8D, 0x0C, 0x7C, 0x70, 0xFF, 0x0C, 0x86, 0x79, 0xFF, 0x0C, 0x82, 0x75, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x88, 0x7B, 0xDB, 0x0B, 0x84, 0x77, 0x42, 0x0B, 0x7F, 0x73, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x7F, 0x55, 0xA3, 0x0C, 0x7E, 0x73, 0xFF, 0x0D, 0x89, 0x7C, 0xFF, 0x0C, 0x86, 0x79, 0xFF, 0x0C, 0x81, 0x75, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x80, 0x75, 0xFF, 0x0C, 0x87, 0x7B, 0xFC, 0x0D, 0x89, 0x7B, 0x8A, 0x0B, 0x7F, 0x74, 0x01, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x0B, 0x7D, 0x71, 0xDD, 0x0B, 0x83, 0x77, 0xFF, 0x0D, 0x87, 0x7A, 0xFF, 0x0C, 0x7F, 0x72, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0D, 0x89, 0x7C, 0x7C, 0x0C, 0x83, 0x77, 0x03, 0x00, 0x55, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x71, 0x71, 0x96, 0x0B, 0x81, 0x76, 0xFF, 0x0D, 0x88, 0x7B, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0D, 0x8A, 0x7D, 0xC4, 0x0D, 0x87, 0x7A, 0x28, 0x0C, 0x79, 0x6C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0x09, 0x84, 0x71, 0xD7, 0x0B, 0x7E, 0x73, 0xFF, 0x0D, 0x86, 0x79, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x82, 0x76, 0xFC, 0x0D, 0x85, 0x78, 0x8C, 0x0C, 0x7D, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0x0A, 0x7E, 0x72, 0xFF, 0x0C, 0x87, 0x7A, 0xFF, 0x0C, 0x81, 0x75, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0D, 0x89, 0x7C, 0xD6, 0x0D, 0x85, 0x77, 0x41, 0x0B, 0x7D, 0x71, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x09, 0x76, 0x76, 0xA9, 0x0D, 0x83, 0x77, 0xF1, 0x0C, 0x8A, 0x7D, 0xFF, 0x0C, 0x88, 0x7B, 0xFF, 0x0D, 0x87, 0x79, 0xFF, 0x0D, 0x86, 0x79, 0xFF, 0x0C, 0x88, 0x7B, 0xED, 0x0C, 0x8B, 0x7E, 0x97, 0x0B, 0x80, 0x74, 0x13, 0x0D, 0x78, 0x6B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x07, 0x7D, 0x71, 0xDA, 0x0C, 0x85, 0x77, 0xFF, 0x0D, 0x88, 0x7B, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x80, 0x73, 0xFF, 0x0D, 0x89, 0x7C, 0x7E, 0x0C, 0x83, 0x77, 0x04, 0x00, 0x7F, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x71, 0x71, 0x96, 0x0B, 0x81, 0x76, 0xFF, 0x0D, 0x88, 0x7B, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0D, 0x8A, 0x7D, 0xC4, 0x0D, 0x87, 0x7A, 0x28, 0x0C, 0x79, 0x6C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0x09, 0x84, 0x71, 0xD7, 0x0B, 0x7E, 0x73, 0xFF, 0x0D, 0x86, 0x79, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x82, 0x76, 0xFC, 0x0D, 0x85, 0x78, 0x8C, 0x0C, 0x7D, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x0A, 0x7F, 0x73, 0xFF, 0x0C, 0x87, 0x7A, 0xFF, 0x0C, 0x81, 0x75, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7E, 0x73, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0D, 0x8A, 0x7D, 0xD8, 0x0C, 0x85, 0x78, 0x4A, 0x0A, 0x7C, 0x6E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x15, 0x6A, 0x7F, 0x68, 0x0C, 0x81, 0x78, 0xB3, 0x0B, 0x83, 0x76, 0xD3, 0x0C, 0x81, 0x74, 0xD2, 0x0C, 0x80, 0x74, 0xAE, 0x0D, 0x80, 0x75, 0x5C, 0x0D, 0x82, 0x74, 0x08, 0x00, 0x5F, 0x5F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x47, 0x0A, 0x7D, 0x72, 0xDA, 0x0B, 0x86, 0x79, 0xFF, 0x0D, 0x88, 0x7B, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x80, 0x73, 0xFF, 0x0D, 0x89, 0x7C, 0x80, 0x0B, 0x81, 0x75, 0x04, 0x00, 0x7F, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x71, 0x71, 0x96, 0x0B, 0x81, 0x76, 0xFF, 0x0D, 0x88, 0x7B, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0D, 0x8A, 0x7D, 0xC4, 0x0D, 0x87, 0x7A, 0x28, 0x0C, 0x79, 0x6C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0x09, 0x84, 0x71, 0xD7, 0x0B, 0x7E, 0x73, 0xFF, 0x0D, 0x86, 0x79, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x82, 0x76, 0xFC, 0x0D, 0x85, 0x78, 0x8C, 0x0C, 0x7D, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x0A, 0x7D, 0x71, 0xFF, 0x0C, 0x86, 0x7A, 0xFF, 0x0C, 0x81, 0x75, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7E, 0x73, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0D, 0x89, 0x7D, 0xDF, 0x0B, 0x85, 0x79, 0x57, 0x0B, 0x80, 0x75, 0x03, 0x00, 0x55, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xFF, 0x00, 0x18, 0x0A, 0x7F, 0x74, 0x15, 0x0C, 0x85, 0x79, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x55, 0x55, 0x56, 0x0B, 0x7F, 0x73, 0xE1, 0x0C, 0x84, 0x78, 0xFF, 0x0D, 0x88, 0x7B, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0D, 0x8A, 0x7C, 0x81, 0x0B, 0x82, 0x76, 0x05, 0x00, 0x66, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x71, 0x71, 0x96, 0x0B, 0x81, 0x76, 0xFF, 0x0D, 0x88, 0x7B, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0D, 0x8A, 0x7D, 0xC4, 0x0D, 0x87, 0x7A, 0x28, 0x0C, 0x79, 0x6C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0x09, 0x84, 0x71, 0xD7, 0x0B, 0x7E, 0x73, 0xFF, 0x0D, 0x86, 0x79, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x82, 0x76, 0xFC, 0x0D, 0x85, 0x78, 0x8C, 0x0C, 0x7D, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x94, 0x0A, 0x7D, 0x6F, 0xFF, 0x0C, 0x87, 0x7A, 0xFF, 0x0C, 0x81, 0x75, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0D, 0x89, 0x7C, 0xEA, 0x0D, 0x87, 0x7B, 0x6E, 0x0B, 0x84, 0x78, 0x0D, 0x13, 0x75, 0x62, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x12, 0x6D, 0x6D, 0x71, 0x0D, 0x80, 0x75, 0xED, 0x0B, 0x85, 0x78, 0xFF, 0x0D, 0x87, 0x7B, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0D, 0x8A, 0x7C, 0x82, 0x0B, 0x83, 0x77, 0x05, 0x00, 0x66, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x71, 0x71, 0x96, 0x0B, 0x81, 0x76, 0xFF, 0x0D, 0x88, 0x7B, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0D, 0x8A, 0x7D, 0xC4, 0x0D, 0x87, 0x7A, 0x28, 0x0C, 0x79, 0x6C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0x09, 0x84, 0x71, 0xD7, 0x0B, 0x7E, 0x73, 0xFF, 0x0D, 0x86, 0x79, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x82, 0x76, 0xFC, 0x0D, 0x85, 0x78, 0x8C, 0x0C, 0x7D, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x95, 0x0A, 0x7C, 0x72, 0xFF, 0x0C, 0x87, 0x7A, 0xFF, 0x0C, 0x81, 0x75, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x84, 0x78, 0xFF, 0x0C, 0x81, 0x75, 0xFF, 0x0C, 0x7E, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7E, 0x73, 0xFF, 0x0D, 0x87, 0x7A, 0xF7, 0x0C, 0x88, 0x7A, 0x8F, 0x0C, 0x83, 0x79, 0x21, 0x0F, 0x7B, 0x6C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x0F, 0x7B, 0x73, 0x90, 0x0C, 0x86, 0x78, 0xFC, 0x0C, 0x85, 0x78, 0xFF, 0x0D, 0x87, 0x7A, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x81, 0x75, 0xFF, 0x0D, 0x83, 0x77, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0D, 0x8A, 0x7D, 0x84, 0x0B, 0x83, 0x77, 0x06, 0x00, 0x7F, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x71, 0x71, 0x96, 0x0B, 0x81, 0x76, 0xFF, 0x0D, 0x88, 0x7B, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0D, 0x8A, 0x7D, 0xC4, 0x0D, 0x87, 0x7A, 0x28, 0x0C, 0x79, 0x6C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0x09, 0x84, 0x71, 0xD7, 0x0B, 0x7E, 0x73, 0xFF, 0x0D, 0x86, 0x79, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x82, 0x76, 0xFC, 0x0D, 0x85, 0x78, 0x8C, 0x0C, 0x7D, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x96, 0x0A, 0x7D, 0x73, 0xFF, 0x0C, 0x87, 0x7B, 0xFF, 0x0C, 0x81, 0x75, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFD, 0x0C, 0x7E, 0x72, 0xE7, 0x0C, 0x82, 0x76, 0xFF, 0x0C, 0x83, 0x77, 0xFF, 0x0D, 0x81, 0x76, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0D, 0x84, 0x78, 0xFF, 0x0D, 0x8A, 0x7D, 0xBA, 0x0C, 0x86, 0x78, 0x49, 0x0A, 0x7D, 0x73, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x45, 0x0B, 0x81, 0x72, 0xB9, 0x0C, 0x85, 0x7A, 0xFF, 0x0D, 0x8A, 0x7C, 0xFF, 0x0C, 0x84, 0x77, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0C, 0x82, 0x76, 0xFF, 0x0C, 0x84, 0x78, 0xEC, 0x0B, 0x82, 0x75, 0xFD, 0x0B, 0x7E, 0x72, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0D, 0x8A, 0x7D, 0x87, 0x0B, 0x82, 0x76, 0x07, 0x00, 0x6D, 0x6D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x71, 0x71, 0x96, 0x0B, 0x81, 0x76, 0xFF, 0x0D, 0x88, 0x7B, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0D, 0x8A, 0x7D, 0xC4, 0x0D, 0x87, 0x7A, 0x28, 0x0C, 0x79, 0x6C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0x09, 0x84, 0x71, 0xD7, 0x0B, 0x7E, 0x73, 0xFF, 0x0D, 0x86, 0x79, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x82, 0x76, 0xFC, 0x0D, 0x85, 0x78, 0x8C, 0x0C, 0x7D, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x98, 0x0A, 0x7D, 0x70, 0xFF, 0x0C, 0x87, 0x7A, 0xFF, 0x0C, 0x81, 0x75, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x81, 0x75, 0xF7, 0x0C, 0x84, 0x77, 0x7E, 0x0C, 0x7F, 0x71, 0xA2, 0x0B, 0x7F, 0x72, 0xFF, 0x0D, 0x88, 0x7B, 0xFF, 0x0D, 0x83, 0x77, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0D, 0x82, 0x75, 0xFF, 0x0D, 0x8B, 0x7E, 0xE4, 0x0D, 0x87, 0x7B, 0x7B, 0x0E, 0x84, 0x7A, 0x25, 0x0D, 0x7C, 0x6E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0x0D, 0x75, 0x6E, 0x7F, 0x0E, 0x82, 0x78, 0xE3, 0x0C, 0x87, 0x79, 0xFF, 0x0D, 0x8B, 0x7E, 0xFF, 0x0C, 0x81, 0x75, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0D, 0x84, 0x78, 0xFF, 0x0D, 0x88, 0x7B, 0xA2, 0x0B, 0x82, 0x77, 0x88, 0x0B, 0x7D, 0x70, 0xFC, 0x0C, 0x81, 0x75, 0xFF, 0x0C, 0x81, 0x75, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0D, 0x8A, 0x7D, 0x87, 0x0B, 0x84, 0x76, 0x08, 0x00, 0x5F, 0x5F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x71, 0x71, 0x97, 0x0B, 0x80, 0x76, 0xFF, 0x0D, 0x88, 0x7B, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0D, 0x8A, 0x7D, 0xC4, 0x0D, 0x87, 0x7A, 0x28, 0x0C, 0x79, 0x6C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0x09, 0x84, 0x71, 0xD7, 0x0B, 0x7E, 0x73, 0xFF, 0x0D, 0x86, 0x79, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x83, 0x76, 0xFB, 0x0D, 0x86, 0x78, 0x87, 0x0B, 0x7C, 0x73, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x99, 0x09, 0x7E, 0x71, 0xFF, 0x0C, 0x87, 0x7B, 0xFF, 0x0C, 0x81, 0x75, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x81, 0x75, 0xF8, 0x0C, 0x87, 0x7A, 0x53, 0x0C, 0x84, 0x74, 0x15, 0x0C, 0x79, 0x79, 0xA1, 0x0B, 0x83, 0x76, 0xFF, 0x0D, 0x88, 0x7C, 0xFF, 0x0D, 0x85, 0x78, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0D, 0x88, 0x7B, 0xFF, 0x0D, 0x87, 0x7B, 0xBF, 0x0C, 0x86, 0x7A, 0x66, 0x0C, 0x82, 0x75, 0x1D, 0x08, 0x7B, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x09, 0x7F, 0x75, 0x67, 0x0C, 0x80, 0x71, 0xBE, 0x0C, 0x86, 0x78, 0xFF, 0x0D, 0x87, 0x7B, 0xFF, 0x0D, 0x88, 0x7B, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7E, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0D, 0x85, 0x78, 0xFF, 0x0D, 0x8A, 0x7C, 0xA1, 0x0C, 0x85, 0x79, 0x17, 0x16, 0x79, 0x6E, 0x57, 0x0B, 0x7E, 0x72, 0xFF, 0x0D, 0x87, 0x7A, 0xFF, 0x0C, 0x81, 0x75, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0D, 0x8A, 0x7D, 0x89, 0x0D, 0x86, 0x77, 0x08, 0x00, 0x7F, 0x5F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x7F, 0x00, 0x8F, 0x0C, 0x82, 0x77, 0xFF, 0x0D, 0x89, 0x7C, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0D, 0x8A, 0x7D, 0xC4, 0x0D, 0x87, 0x7A, 0x28, 0x0C, 0x79, 0x6C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0x09, 0x84, 0x71, 0xD7, 0x0B, 0x7E, 0x73, 0xFF, 0x0D, 0x86, 0x79, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x82, 0x76, 0xFB, 0x0D, 0x85, 0x78, 0x99, 0x0B, 0x7B, 0x72, 0x1D, 0x08, 0x7B, 0x72, 0x20, 0x07, 0x7F, 0x6F, 0x21, 0x07, 0x7B, 0x6C, 0x21, 0x07, 0x7B, 0x6C, 0x21, 0x07, 0x7B, 0x6C, 0x21, 0x07, 0x7B, 0x6C, 0x21, 0x07, 0x7B, 0x6C, 0x21, 0x07, 0x7B, 0x6C, 0x21, 0x07, 0x7B, 0x6C, 0x21, 0x07, 0x7B, 0x6C, 0x21, 0x07, 0x7B, 0x6C, 0x21, 0x07, 0x7B, 0x6C, 0x21, 0x07, 0x7B, 0x6C, 0x21, 0x07, 0x7B, 0x6C, 0x21, 0x07, 0x7B, 0x6C, 0x23, 0x07, 0x7B, 0x6D, 0x1B, 0x09, 0x7A, 0x71, 0x02, 0x00, 0x7F, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9B, 0x0B, 0x7E, 0x73, 0xFF, 0x0D, 0x88, 0x7A, 0xFF, 0x0C, 0x81, 0x74, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x81, 0x75, 0xFA, 0x0D, 0x86, 0x7A, 0x68, 0x0C, 0x81, 0x75, 0x00, 0x00, 0x00, 0x00, 0x14, 0x0C, 0x72, 0x72, 0x8E, 0x0A, 0x83, 0x74, 0xF9, 0x0D, 0x88, 0x7A, 0xFF, 0x0D, 0x88, 0x7B, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0D, 0x82, 0x76, 0xFF, 0x0D, 0x8A, 0x7D, 0xF8, 0x0D, 0x84, 0x78, 0xBA, 0x0C, 0x86, 0x78, 0x72, 0x0B, 0x81, 0x74, 0x36, 0x09, 0x7F, 0x71, 0x06, 0x00, 0x7F, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x99, 0x66, 0x36, 0x09, 0x7F, 0x71, 0x74, 0x0A, 0x7F, 0x74, 0xB8, 0x0C, 0x86, 0x7B, 0xF9, 0x0C, 0x85, 0x77, 0xFF, 0x0D, 0x8B, 0x7D, 0xFF, 0x0C, 0x82, 0x76, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0D, 0x87, 0x7A, 0xFD, 0x0C, 0x86, 0x78, 0x93, 0x0C, 0x83, 0x75, 0x19, 0x0A, 0x70, 0x65, 0x00, 0x00, 0x00, 0x00, 0x6D, 0x0B, 0x7E, 0x72, 0xFF, 0x0D, 0x87, 0x79, 0xFF, 0x0C, 0x81, 0x74, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0D, 0x8A, 0x7D, 0x8B, 0x0C, 0x84, 0x79, 0x0A, 0x00, 0x66, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x3F, 0x7F, 0x7F, 0x1A, 0x09, 0x7F, 0x75, 0x22, 0x07, 0x7F, 0x70, 0x21, 0x07, 0x7B, 0x6C, 0x21, 0x07, 0x7B, 0x6C, 0x21, 0x07, 0x7B, 0x6C, 0x21, 0x07, 0x7B, 0x6C, 0x21, 0x07, 0x7B, 0x6C, 0x21, 0x07, 0x7B, 0x6C, 0x21, 0x07, 0x7B, 0x6C, 0x21, 0x07, 0x7B, 0x6C, 0x21, 0x07, 0x7B, 0x6C, 0x21, 0x07, 0x7B, 0x6C, 0x21, 0x07, 0x7B, 0x6C, 0x21, 0x07, 0x7B, 0x6C, 0x21, 0x07, 0x7B, 0x6C, 0x1F, 0x08, 0x7B, 0x73, 0x28, 0x06, 0x79, 0x6C, 0x9F, 0x0C, 0x80, 0x75, 0xFF, 0x0D, 0x87, 0x7A, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0D, 0x8A, 0x7D, 0xC4, 0x0D, 0x87, 0x7A, 0x28, 0x0C, 0x79, 0x6C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0x09, 0x84, 0x71, 0xD7, 0x0B, 0x7E, 0x73, 0xFF, 0x0D, 0x86, 0x79, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x80, 0x74, 0xFE, 0x0C, 0x7F, 0x74, 0xE3, 0x0C, 0x81, 0x74, 0xBE, 0x0D, 0x86, 0x7A, 0xC1, 0x0D, 0x86, 0x79, 0xC1, 0x0D, 0x86, 0x79, 0xC1, 0x0D, 0x86, 0x79, 0xC1, 0x0D, 0x86, 0x79, 0xC1, 0x0D, 0x86, 0x79, 0xC1, 0x0D, 0x86, 0x79, 0xC1, 0x0D, 0x86, 0x79, 0xC1, 0x0D, 0x86, 0x79, 0xC1, 0x0D, 0x86, 0x79, 0xC1, 0x0D, 0x86, 0x79, 0xC1, 0x0D, 0x86, 0x79, 0xC1, 0x0D, 0x86, 0x79, 0xC1, 0x0D, 0x86, 0x79, 0xC1, 0x0D, 0x86, 0x79, 0xC2, 0x0D, 0x8B, 0x7E, 0xA9, 0x0C, 0x7E, 0x72, 0x10, 0x0F, 0x6F, 0x6F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9D, 0x0B, 0x7E, 0x73, 0xFF, 0x0D, 0x87, 0x7B, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x81, 0x75, 0xFB, 0x0D, 0x86, 0x79, 0x69, 0x0C, 0x80, 0x74, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x73, 0x5C, 0x71, 0x0B, 0x82, 0x75, 0xE8, 0x0D, 0x88, 0x7C, 0xFF, 0x0D, 0x8A, 0x7D, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0D, 0x84, 0x78, 0xFF, 0x0D, 0x8A, 0x7D, 0xFD, 0x0D, 0x84, 0x76, 0xD1, 0x0C, 0x88, 0x7B, 0xA9, 0x0C, 0x81, 0x75, 0x7C, 0x0C, 0x7D, 0x73, 0x60, 0x0A, 0x7A, 0x6F, 0x4F, 0x0C, 0x7D, 0x70, 0x4F, 0x0C, 0x7D, 0x70, 0x60, 0x0A, 0x7C, 0x72, 0x7D, 0x0A, 0x7E, 0x70, 0xA6, 0x0A, 0x82, 0x76, 0xD1, 0x0C, 0x88, 0x7B, 0xFE, 0x0C, 0x83, 0x77, 0xFF, 0x0D, 0x8A, 0x7E, 0xFF, 0x0D, 0x85, 0x78, 0xFF, 0x0C, 0x7F, 0x72, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0D, 0x8A, 0x7D, 0xED, 0x0B, 0x86, 0x79, 0x79, 0x0A, 0x7E, 0x73, 0x0E, 0x00, 0x6D, 0x6D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6E, 0x0B, 0x7F, 0x73, 0xFF, 0x0D, 0x87, 0x7A, 0xFF, 0x0C, 0x81, 0x74, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0D, 0x8A, 0x7D, 0x8D, 0x0C, 0x82, 0x77, 0x0B, 0x00, 0x73, 0x5C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x09, 0x7F, 0x6B, 0xA3, 0x0A, 0x84, 0x76, 0xC2, 0x0D, 0x8D, 0x80, 0xC1, 0x0D, 0x86, 0x79, 0xC1, 0x0D, 0x86, 0x79, 0xC1, 0x0D, 0x86, 0x79, 0xC1, 0x0D, 0x86, 0x79, 0xC1, 0x0D, 0x86, 0x79, 0xC1, 0x0D, 0x86, 0x79, 0xC1, 0x0D, 0x86, 0x79, 0xC1, 0x0D, 0x86, 0x79, 0xC1, 0x0D, 0x86, 0x79, 0xC1, 0x0D, 0x86, 0x79, 0xC1, 0x0D, 0x86, 0x79, 0xC1, 0x0D, 0x86, 0x79, 0xC1, 0x0D, 0x86, 0x79, 0xC0, 0x0D, 0x86, 0x78, 0xC3, 0x0D, 0x85, 0x78, 0xE6, 0x0C, 0x80, 0x75, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0D, 0x8A, 0x7D, 0xC4, 0x0D, 0x87, 0x7A, 0x28, 0x0C, 0x79, 0x6C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0x09, 0x84, 0x71, 0xD7, 0x0B, 0x7E, 0x73, 0xFF, 0x0D, 0x86, 0x79, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7E, 0x73, 0xFF, 0x0C, 0x83, 0x77, 0xFF, 0x0D, 0x89, 0x7C, 0xFF, 0x0D, 0x89, 0x7C, 0xFF, 0x0D, 0x89, 0x7C, 0xFF, 0x0D, 0x89, 0x7C, 0xFF, 0x0D, 0x89, 0x7C, 0xFF, 0x0D, 0x89, 0x7C, 0xFF, 0x0D, 0x89, 0x7C, 0xFF, 0x0D, 0x89, 0x7C, 0xFF, 0x0D, 0x89, 0x7C, 0xFF, 0x0D, 0x89, 0x7C, 0xFF, 0x0D, 0x89, 0x7C, 0xFF, 0x0D, 0x89, 0x7C, 0xFF, 0x0D, 0x89, 0x7C, 0xFF, 0x0D, 0x89, 0x7C, 0xFF, 0x0D, 0x8A, 0x7D, 0xFF, 0x0D, 0x8F, 0x82, 0xE4, 0x0B, 0x7E, 0x72, 0x15, 0x0C, 0x79, 0x6D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9F, 0x0B, 0x7E, 0x73, 0xFF, 0x0D, 0x88, 0x7B, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x81, 0x75, 0xFB, 0x0D, 0x86, 0x79, 0x69, 0x0C, 0x80, 0x74, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x0C, 0x82, 0x75, 0xCD, 0x0C, 0x86, 0x78, 0xFF, 0x0D, 0x8C, 0x7E, 0xFF, 0x0D, 0x83, 0x77, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0D, 0x83, 0x77, 0xFF, 0x0D, 0x89, 0x7C, 0xFF, 0x0D, 0x89, 0x7C, 0xFF, 0x0D, 0x84, 0x78, 0xEF, 0x0C, 0x85, 0x78, 0xE4, 0x0D, 0x87, 0x79, 0xE4, 0x0D, 0x87, 0x79, 0xEF, 0x0C, 0x85, 0x78, 0xFF, 0x0C, 0x84, 0x77, 0xFF, 0x0C, 0x89, 0x7C, 0xFF, 0x0D, 0x89, 0x7C, 0xFF, 0x0D, 0x83, 0x77, 0xFF, 0x0C, 0x7E, 0x73, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x83, 0x76, 0xFF, 0x0D, 0x8B, 0x7E, 0xCE, 0x0C, 0x86, 0x7A, 0x52, 0x0C, 0x7F, 0x73, 0x03, 0x00, 0x55, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0x0B, 0x7E, 0x72, 0xFF, 0x0D, 0x87, 0x7A, 0xFF, 0x0C, 0x81, 0x74, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0D, 0x8A, 0x7D, 0x8F, 0x0C, 0x83, 0x77, 0x0B, 0x00, 0x73, 0x73, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x23, 0x0E, 0x7B, 0x6D, 0xDE, 0x0C, 0x84, 0x76, 0xFF, 0x0E, 0x92, 0x84, 0xFF, 0x0D, 0x89, 0x7C, 0xFF, 0x0D, 0x89, 0x7C, 0xFF, 0x0D, 0x89, 0x7C, 0xFF, 0x0D, 0x89, 0x7C, 0xFF, 0x0D, 0x89, 0x7C, 0xFF, 0x0D, 0x89, 0x7C, 0xFF, 0x0D, 0x89, 0x7C, 0xFF, 0x0D, 0x89, 0x7C, 0xFF, 0x0D, 0x89, 0x7C, 0xFF, 0x0D, 0x89, 0x7C, 0xFF, 0x0D, 0x89, 0x7C, 0xFF, 0x0D, 0x89, 0x7C, 0xFF, 0x0D, 0x89, 0x7C, 0xFF, 0x0D, 0x89, 0x7C, 0xFF, 0x0D, 0x89, 0x7C, 0xFF, 0x0C, 0x83, 0x77, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0D, 0x8A, 0x7D, 0xC4, 0x0D, 0x87, 0x7A, 0x28, 0x0C, 0x79, 0x6C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0x09, 0x84, 0x71, 0xD7, 0x0B, 0x7E, 0x73, 0xFF, 0x0D, 0x86, 0x79, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x84, 0x77, 0xD2, 0x0A, 0x7F, 0x70, 0x13, 0x0D, 0x78, 0x6B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0x0C, 0x7D, 0x72, 0xFF, 0x0D, 0x87, 0x7B, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x81, 0x75, 0xFB, 0x0D, 0x87, 0x7A, 0x6A, 0x0C, 0x81, 0x75, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x0A, 0x7C, 0x71, 0xA0, 0x0C, 0x84, 0x77, 0xFC, 0x0D, 0x86, 0x7A, 0xFF, 0x0D, 0x89, 0x7B, 0xFF, 0x0C, 0x80, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0D, 0x83, 0x76, 0xFF, 0x0D, 0x86, 0x79, 0xFF, 0x0D, 0x87, 0x7A, 0xFF, 0x0D, 0x87, 0x7A, 0xFF, 0x0D, 0x86, 0x79, 0xFF, 0x0D, 0x83, 0x76, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0D, 0x88, 0x7C, 0xFF, 0x0C, 0x85, 0x78, 0xA4, 0x0C, 0x85, 0x79, 0x2E, 0x0B, 0x7F, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x0B, 0x7F, 0x74, 0xFF, 0x0D, 0x87, 0x7A, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0D, 0x8A, 0x7E, 0x90, 0x0C, 0x84, 0x78, 0x0C, 0x00, 0x7F, 0x6A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x0F, 0x7F, 0x6F, 0xCE, 0x0C, 0x81, 0x76, 0xFF, 0x0D, 0x86, 0x79, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0D, 0x8A, 0x7D, 0xC4, 0x0D, 0x87, 0x7A, 0x28, 0x0C, 0x79, 0x6C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0x09, 0x84, 0x71, 0xD7, 0x0B, 0x7E, 0x73, 0xFF, 0x0D, 0x86, 0x79, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x85, 0x78, 0xD3, 0x0A, 0x7E, 0x71, 0x13, 0x0D, 0x78, 0x6B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0xFF, 0xA3, 0x0C, 0x7D, 0x72, 0xFF, 0x0D, 0x88, 0x7B, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x81, 0x75, 0xFB, 0x0D, 0x87, 0x7A, 0x6B, 0x0B, 0x80, 0x77, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x0D, 0x78, 0x6B, 0x61, 0x0D, 0x86, 0x78, 0xD7, 0x0B, 0x84, 0x78, 0xFF, 0x0D, 0x8B, 0x7D, 0xFF, 0x0D, 0x85, 0x78, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0D, 0x84, 0x78, 0xFF, 0x0D, 0x8B, 0x7E, 0xD7, 0x0B, 0x86, 0x78, 0x68, 0x0C, 0x81, 0x75, 0x15, 0x0C, 0x79, 0x6D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x0B, 0x7F, 0x74, 0xFF, 0x0D, 0x87, 0x7A, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0D, 0x8B, 0x7D, 0x92, 0x0C, 0x84, 0x78, 0x0D, 0x00, 0x75, 0x62, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x0F, 0x7F, 0x6F, 0xCF, 0x0C, 0x82, 0x76, 0xFF, 0x0D, 0x87, 0x7A, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0D, 0x8A, 0x7D, 0xC4, 0x0D, 0x87, 0x7A, 0x28, 0x0C, 0x79, 0x6C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0x09, 0x84, 0x71, 0xD7, 0x0B, 0x7E, 0x73, 0xFF, 0x0D, 0x86, 0x79, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x85, 0x78, 0xD3, 0x0A, 0x7E, 0x71, 0x13, 0x0D, 0x78, 0x6B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x7F, 0x7F, 0xA4, 0x0C, 0x7F, 0x74, 0xFF, 0x0D, 0x89, 0x7C, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x81, 0x75, 0xFB, 0x0D, 0x87, 0x7A, 0x6D, 0x0B, 0x83, 0x77, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2E, 0x0B, 0x7F, 0x6E, 0x8D, 0x0C, 0x85, 0x79, 0xEE, 0x0C, 0x84, 0x76, 0xFF, 0x0D, 0x8A, 0x7D, 0xFF, 0x0C, 0x84, 0x78, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0D, 0x83, 0x78, 0xFF, 0x0D, 0x8A, 0x7D, 0xEE, 0x0C, 0x84, 0x77, 0x92, 0x0C, 0x84, 0x76, 0x2E, 0x0B, 0x7F, 0x6E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x72, 0x0B, 0x7F, 0x72, 0xFF, 0x0D, 0x87, 0x7B, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0D, 0x8B, 0x7D, 0x93, 0x0C, 0x85, 0x79, 0x0D, 0x00, 0x75, 0x75, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x0F, 0x7F, 0x6F, 0xCF, 0x0C, 0x82, 0x76, 0xFF, 0x0D, 0x87, 0x7A, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0D, 0x8A, 0x7D, 0xC4, 0x0D, 0x87, 0x7A, 0x28, 0x0C, 0x79, 0x6C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0x09, 0x84, 0x71, 0xD9, 0x0B, 0x7E, 0x73, 0xFF, 0x0D, 0x87, 0x7A, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x81, 0x75, 0xFF, 0x0C, 0x86, 0x79, 0xD5, 0x0A, 0x7E, 0x71, 0x13, 0x0D, 0x78, 0x6B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0xAA, 0xAA, 0xA6, 0x0C, 0x7D, 0x71, 0xFF, 0x0D, 0x88, 0x7B, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x81, 0x75, 0xFB, 0x0D, 0x87, 0x7A, 0x6D, 0x0B, 0x83, 0x77, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x73, 0x73, 0x3D, 0x0C, 0x81, 0x75, 0x9A, 0x0D, 0x86, 0x78, 0xEF, 0x0B, 0x83, 0x76, 0xFF, 0x0D, 0x88, 0x7C, 0xFF, 0x0C, 0x86, 0x79, 0xFF, 0x0C, 0x82, 0x75, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x81, 0x75, 0xFF, 0x0D, 0x86, 0x79, 0xFF, 0x0D, 0x89, 0x7C, 0xED, 0x0B, 0x84, 0x77, 0x9F, 0x0C, 0x86, 0x78, 0x3B, 0x0C, 0x85, 0x79, 0x0D, 0x00, 0x75, 0x62, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x72, 0x0B, 0x7F, 0x72, 0xFF, 0x0D, 0x87, 0x7B, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0D, 0x8B, 0x7D, 0x94, 0x0C, 0x84, 0x78, 0x0E, 0x00, 0x6D, 0x6D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x0F, 0x7F, 0x6F, 0xD1, 0x0C, 0x82, 0x76, 0xFF, 0x0D, 0x88, 0x7B, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0D, 0x8B, 0x7E, 0xC6, 0x0C, 0x87, 0x7A, 0x28, 0x0C, 0x79, 0x6C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1D, 0x08, 0x83, 0x72, 0xD8, 0x0C, 0x87, 0x7A, 0xFF, 0x0E, 0x8E, 0x81, 0xFF, 0x0D, 0x87, 0x7B, 0xFF, 0x0D, 0x87, 0x7B, 0xFF, 0x0D, 0x87, 0x7B, 0xFF, 0x0D, 0x87, 0x7B, 0xFF, 0x0D, 0x87, 0x7B, 0xFF, 0x0D, 0x87, 0x7B, 0xFF, 0x0D, 0x87, 0x7B, 0xFF, 0x0D, 0x87, 0x7B, 0xFF, 0x0D, 0x87, 0x7B, 0xFF, 0x0D, 0x87, 0x7B, 0xFF, 0x0D, 0x87, 0x7B, 0xFF, 0x0D, 0x87, 0x7B, 0xFF, 0x0D, 0x87, 0x7B, 0xFF, 0x0D, 0x87, 0x7B, 0xFF, 0x0D, 0x87, 0x7B, 0xFF, 0x0D, 0x87, 0x7B, 0xFF, 0x0D, 0x87, 0x7B, 0xFF, 0x0D, 0x87, 0x7B, 0xFF, 0x0D, 0x87, 0x7B, 0xFF, 0x0D, 0x87, 0x7B, 0xFF, 0x0D, 0x88, 0x7C, 0xFF, 0x0D, 0x8D, 0x80, 0xE0, 0x0C, 0x7F, 0x72, 0x15, 0x0C, 0x79, 0x6D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x55, 0x55, 0xA7, 0x0C, 0x7D, 0x70, 0xFF, 0x0D, 0x89, 0x7C, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x81, 0x75, 0xFB, 0x0D, 0x87, 0x7A, 0x6F, 0x0B, 0x82, 0x75, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x15, 0x7F, 0x6A, 0x37, 0x0D, 0x81, 0x73, 0x88, 0x0D, 0x83, 0x78, 0xD7, 0x0B, 0x81, 0x75, 0xFA, 0x0D, 0x84, 0x78, 0xFE, 0x0D, 0x88, 0x7B, 0xFF, 0x0D, 0x87, 0x7A, 0xFF, 0x0C, 0x84, 0x77, 0xFF, 0x0C, 0x83, 0x76, 0xFF, 0x0C, 0x82, 0x75, 0xFF, 0x0C, 0x82, 0x75, 0xFF, 0x0C, 0x82, 0x75, 0xFF, 0x0C, 0x82, 0x75, 0xFF, 0x0C, 0x83, 0x76, 0xFF, 0x0C, 0x84, 0x77, 0xFF, 0x0C, 0x86, 0x7A, 0xFF, 0x0D, 0x88, 0x7B, 0xFA, 0x0D, 0x84, 0x78, 0xD9, 0x0C, 0x81, 0x75, 0x8B, 0x0C, 0x85, 0x77, 0x36, 0x09, 0x84, 0x76, 0x0D, 0x13, 0x89, 0x75, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x73, 0x0B, 0x80, 0x73, 0xFF, 0x0D, 0x87, 0x7B, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0D, 0x8B, 0x7D, 0x95, 0x0B, 0x83, 0x77, 0x0E, 0x00, 0x6D, 0x6D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x23, 0x07, 0x7B, 0x6D, 0xD8, 0x0B, 0x85, 0x77, 0xFF, 0x0E, 0x8F, 0x82, 0xFF, 0x0D, 0x87, 0x7B, 0xFF, 0x0D, 0x87, 0x7B, 0xFF, 0x0D, 0x87, 0x7B, 0xFF, 0x0D, 0x87, 0x7B, 0xFF, 0x0D, 0x87, 0x7B, 0xFF, 0x0D, 0x87, 0x7B, 0xFF, 0x0D, 0x87, 0x7B, 0xFF, 0x0D, 0x87, 0x7B, 0xFF, 0x0D, 0x87, 0x7B, 0xFF, 0x0D, 0x87, 0x7B, 0xFF, 0x0D, 0x87, 0x7B, 0xFF, 0x0D, 0x87, 0x7B, 0xFF, 0x0D, 0x87, 0x7B, 0xFF, 0x0D, 0x87, 0x7B, 0xFF, 0x0D, 0x87, 0x7B, 0xFF, 0x0D, 0x87, 0x7B, 0xFF, 0x0D, 0x87, 0x7B, 0xFF, 0x0D, 0x87, 0x7B, 0xFF, 0x0D, 0x87, 0x7B, 0xFF, 0x0D, 0x87, 0x7B, 0xFF, 0x0D, 0x86, 0x7A, 0xFF, 0x0E, 0x93, 0x85, 0xC8, 0x0E, 0x8D, 0x80, 0x2B, 0x0B, 0x7C, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x0F, 0x8F, 0x6F, 0x83, 0x0B, 0x80, 0x74, 0xA1, 0x0B, 0x81, 0x75, 0x9B, 0x0B, 0x80, 0x74, 0x9B, 0x0B, 0x80, 0x74, 0x9B, 0x0B, 0x80, 0x74, 0x9B, 0x0B, 0x80, 0x74, 0x9B, 0x0B, 0x80, 0x74, 0x9B, 0x0B, 0x80, 0x74, 0x9B, 0x0B, 0x80, 0x74, 0x9B, 0x0B, 0x80, 0x74, 0x9B, 0x0B, 0x80, 0x74, 0x9B, 0x0B, 0x80, 0x74, 0x9B, 0x0B, 0x80, 0x74, 0x9B, 0x0B, 0x80, 0x74, 0x9B, 0x0B, 0x80, 0x74, 0x9B, 0x0B, 0x80, 0x74, 0x9B, 0x0B, 0x80, 0x74, 0x9B, 0x0B, 0x80, 0x74, 0x9B, 0x0B, 0x80, 0x74, 0x9B, 0x0B, 0x80, 0x74, 0x9B, 0x0B, 0x80, 0x74, 0x9B, 0x0B, 0x80, 0x74, 0x9B, 0x0B, 0x81, 0x74, 0x9F, 0x0B, 0x83, 0x76, 0x83, 0x0B, 0x7E, 0x72, 0x0B, 0x17, 0x8B, 0x73, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA4, 0x0A, 0x7F, 0x73, 0xFF, 0x0D, 0x89, 0x7C, 0xFF, 0x0C, 0x80, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x81, 0x75, 0xFB, 0x0D, 0x87, 0x7A, 0x70, 0x0B, 0x81, 0x74, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x6D, 0x6D, 0x1C, 0x12, 0x76, 0x76, 0x51, 0x0C, 0x84, 0x77, 0x90, 0x0C, 0x83, 0x78, 0xC5, 0x0C, 0x82, 0x75, 0xE8, 0x0C, 0x80, 0x73, 0xF4, 0x0C, 0x83, 0x77, 0xF7, 0x0C, 0x86, 0x78, 0xF8, 0x0D, 0x86, 0x7A, 0xF8, 0x0D, 0x86, 0x7A, 0xF7, 0x0C, 0x86, 0x79, 0xF4, 0x0C, 0x83, 0x77, 0xE9, 0x0C, 0x7E, 0x74, 0xC6, 0x0B, 0x80, 0x75, 0x93, 0x0A, 0x82, 0x77, 0x52, 0x0F, 0x85, 0x79, 0x1D, 0x11, 0x83, 0x7B, 0x08, 0x00, 0x7F, 0x5F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x73, 0x0B, 0x80, 0x73, 0xFF, 0x0D, 0x87, 0x7B, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0D, 0x8B, 0x7E, 0x92, 0x0D, 0x84, 0x78, 0x08, 0x1F, 0x5F, 0x5F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x0C, 0x72, 0x72, 0x80, 0x0B, 0x81, 0x75, 0x9E, 0x0B, 0x85, 0x79, 0x9B, 0x0B, 0x80, 0x74, 0x9B, 0x0B, 0x80, 0x74, 0x9B, 0x0B, 0x80, 0x74, 0x9B, 0x0B, 0x80, 0x74, 0x9B, 0x0B, 0x80, 0x74, 0x9B, 0x0B, 0x80, 0x74, 0x9B, 0x0B, 0x80, 0x74, 0x9B, 0x0B, 0x80, 0x74, 0x9B, 0x0B, 0x80, 0x74, 0x9B, 0x0B, 0x80, 0x74, 0x9B, 0x0B, 0x80, 0x74, 0x9B, 0x0B, 0x80, 0x74, 0x9B, 0x0B, 0x80, 0x74, 0x9B, 0x0B, 0x80, 0x74, 0x9B, 0x0B, 0x80, 0x74, 0x9B, 0x0B, 0x80, 0x74, 0x9B, 0x0B, 0x80, 0x74, 0x9B, 0x0B, 0x80, 0x74, 0x9B, 0x0B, 0x80, 0x74, 0x9B, 0x0B, 0x80, 0x74, 0x9B, 0x0B, 0x80, 0x74, 0xA2, 0x0B, 0x85, 0x79, 0x79, 0x0A, 0x84, 0x7A, 0x19, 0x0A, 0x7A, 0x65, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x06, 0x00, 0x7F, 0x7F, 0x08, 0x00, 0x7F, 0x5F, 0x08, 0x00, 0x5F, 0x5F, 0x08, 0x00, 0x5F, 0x5F, 0x08, 0x00, 0x5F, 0x5F, 0x08, 0x00, 0x5F, 0x5F, 0x08, 0x00, 0x5F, 0x5F, 0x08, 0x00, 0x5F, 0x5F, 0x08, 0x00, 0x5F, 0x5F, 0x08, 0x00, 0x5F, 0x5F, 0x08, 0x00, 0x5F, 0x5F, 0x08, 0x00, 0x5F, 0x5F, 0x08, 0x00, 0x5F, 0x5F, 0x08, 0x00, 0x5F, 0x5F, 0x08, 0x00, 0x5F, 0x5F, 0x08, 0x00, 0x5F, 0x5F, 0x08, 0x00, 0x5F, 0x5F, 0x08, 0x00, 0x5F, 0x5F, 0x08, 0x00, 0x5F, 0x5F, 0x08, 0x00, 0x5F, 0x5F, 0x08, 0x00, 0x5F, 0x5F, 0x08, 0x00, 0x5F, 0x5F, 0x08, 0x00, 0x5F, 0x5F, 0x08, 0x00, 0x7F, 0x5F, 0x06, 0x00, 0x7F, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x17, 0x73, 0x73, 0x39, 0x0D, 0x86, 0x78, 0xC9, 0x0B, 0x82, 0x77, 0xFF, 0x0D, 0x86, 0x7A, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x81, 0x75, 0xFB, 0x0D, 0x87, 0x7A, 0x71, 0x0B, 0x82, 0x75, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x7F, 0x7F, 0x0D, 0x13, 0x75, 0x75, 0x25, 0x0D, 0x82, 0x75, 0x42, 0x0B, 0x7F, 0x77, 0x58, 0x0B, 0x82, 0x76, 0x64, 0x0C, 0x82, 0x75, 0x64, 0x0C, 0x82, 0x75, 0x58, 0x0B, 0x82, 0x76, 0x44, 0x0B, 0x7F, 0x78, 0x26, 0x0D, 0x7F, 0x78, 0x0F, 0x11, 0x77, 0x77, 0x07, 0x00, 0x6D, 0x6D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x0A, 0x81, 0x74, 0xFF, 0x0D, 0x88, 0x7B, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0D, 0x86, 0x7A, 0xC0, 0x0B, 0x84, 0x78, 0x3B, 0x0C, 0x81, 0x74, 0x0A, 0x00, 0x7F, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x06, 0x00, 0x7F, 0x7F, 0x08, 0x00, 0x7F, 0x5F, 0x08, 0x00, 0x5F, 0x5F, 0x08, 0x00, 0x5F, 0x5F, 0x08, 0x00, 0x5F, 0x5F, 0x08, 0x00, 0x5F, 0x5F, 0x08, 0x00, 0x5F, 0x5F, 0x08, 0x00, 0x5F, 0x5F, 0x08, 0x00, 0x5F, 0x5F, 0x08, 0x00, 0x5F, 0x5F, 0x08, 0x00, 0x5F, 0x5F, 0x08, 0x00, 0x5F, 0x5F, 0x08, 0x00, 0x5F, 0x5F, 0x08, 0x00, 0x5F, 0x5F, 0x08, 0x00, 0x5F, 0x5F, 0x08, 0x00, 0x5F, 0x5F, 0x08, 0x00, 0x5F, 0x5F, 0x08, 0x00, 0x5F, 0x5F, 0x08, 0x00, 0x5F, 0x5F, 0x08, 0x00, 0x5F, 0x5F, 0x08, 0x00, 0x5F, 0x5F, 0x08, 0x00, 0x5F, 0x5F, 0x08, 0x00, 0x5F, 0x5F, 0x09, 0x00, 0x71, 0x54, 0x06, 0x00, 0x7F, 0x7F, 0x01, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x77, 0x77, 0x3C, 0x0C, 0x88, 0x77, 0x9D, 0x0C, 0x85, 0x78, 0xEB, 0x0D, 0x84, 0x77, 0xFE, 0x0D, 0x83, 0x77, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x81, 0x75, 0xFB, 0x0D, 0x88, 0x7A, 0x72, 0x0B, 0x81, 0x76, 0x02, 0x00, 0x7F, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x75, 0x0A, 0x80, 0x73, 0xFF, 0x0D, 0x88, 0x7B, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFE, 0x0D, 0x83, 0x77, 0xE9, 0x0D, 0x83, 0x77, 0x9A, 0x0D, 0x84, 0x78, 0x3B, 0x0C, 0x81, 0x79, 0x0E, 0x12, 0x7F, 0x6D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x0B, 0x73, 0x73, 0x48, 0x0E, 0x7F, 0x78, 0xA7, 0x0A, 0x84, 0x78, 0xF1, 0x0B, 0x85, 0x78, 0xFF, 0x0D, 0x89, 0x7C, 0xFF, 0x0C, 0x83, 0x77, 0xFF, 0x0C, 0x7F, 0x74, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x81, 0x75, 0xFB, 0x0D, 0x88, 0x7A, 0x73, 0x0B, 0x80, 0x75, 0x02, 0x00, 0x7F, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x75, 0x0A, 0x80, 0x73, 0xFF, 0x0D, 0x88, 0x7B, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x84, 0x77, 0xFF, 0x0D, 0x89, 0x7C, 0xEF, 0x0B, 0x84, 0x77, 0xA3, 0x0C, 0x84, 0x76, 0x48, 0x0A, 0x83, 0x74, 0x14, 0x0C, 0x7F, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0x09, 0x7A, 0x71, 0x53, 0x0C, 0x87, 0x7A, 0xB1, 0x0C, 0x84, 0x79, 0xF7, 0x0C, 0x84, 0x77, 0xFF, 0x0D, 0x8A, 0x7D, 0xFF, 0x0D, 0x83, 0x76, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x80, 0x75, 0xFE, 0x0D, 0x89, 0x7C, 0x7A, 0x0A, 0x81, 0x75, 0x02, 0x00, 0x7F, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x7A, 0x0C, 0x83, 0x75, 0xFF, 0x0D, 0x8B, 0x7E, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x84, 0x77, 0xFF, 0x0D, 0x8A, 0x7D, 0xF8, 0x0B, 0x82, 0x77, 0xAD, 0x0B, 0x84, 0x78, 0x53, 0x0C, 0x81, 0x74, 0x1A, 0x09, 0x7F, 0x6B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x07, 0x83, 0x73, 0x5F, 0x0A, 0x83, 0x76, 0xB9, 0x0D, 0x85, 0x77, 0xFC, 0x0C, 0x84, 0x78, 0xFF, 0x0D, 0x8A, 0x7D, 0xFF, 0x0C, 0x82, 0x76, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0C, 0x82, 0x76, 0xFF, 0x0D, 0x89, 0x7C, 0xFF, 0x0D, 0x8C, 0x7E, 0x74, 0x0A, 0x81, 0x76, 0x02, 0x00, 0x7F, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x73, 0x0B, 0x85, 0x77, 0xFF, 0x0D, 0x8E, 0x81, 0xFF, 0x0D, 0x88, 0x7B, 0xFF, 0x0C, 0x82, 0x76, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x83, 0x76, 0xFF, 0x0D, 0x8A, 0x7D, 0xFE, 0x0C, 0x81, 0x76, 0xB5, 0x0C, 0x85, 0x79, 0x5E, 0x0D, 0x82, 0x77, 0x20, 0x07, 0x7F, 0x6F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2A, 0x0C, 0x7F, 0x73, 0x6D, 0x0B, 0x80, 0x77, 0xC2, 0x0A, 0x86, 0x78, 0xFF, 0x0C, 0x84, 0x78, 0xFF, 0x0D, 0x8A, 0x7C, 0xFF, 0x0C, 0x82, 0x75, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0D, 0x83, 0x76, 0xFF, 0x0D, 0x88, 0x7B, 0xFF, 0x0D, 0x86, 0x79, 0xDA, 0x0C, 0x88, 0x7B, 0x97, 0x0D, 0x83, 0x77, 0x2F, 0x0A, 0x82, 0x71, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x0A, 0x7C, 0x72, 0x9F, 0x0C, 0x81, 0x75, 0xDB, 0x0C, 0x89, 0x7C, 0xFF, 0x0D, 0x87, 0x7A, 0xFF, 0x0D, 0x89, 0x7C, 0xFF, 0x0C, 0x82, 0x76, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0C, 0x7E, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x82, 0x76, 0xFF, 0x0D, 0x8A, 0x7D, 0xFF, 0x0C, 0x84, 0x78, 0xBF, 0x0C, 0x86, 0x79, 0x6A, 0x0C, 0x84, 0x78, 0x28, 0x0C, 0x7F, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xFF, 0xFF, 0x31, 0x0A, 0x7C, 0x72, 0x79, 0x0C, 0x82, 0x76, 0xCA, 0x0C, 0x85, 0x79, 0xFF, 0x0D, 0x86, 0x7A, 0xFF, 0x0D, 0x8A, 0x7D, 0xFF, 0x0C, 0x82, 0x76, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7E, 0x73, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0D, 0x83, 0x77, 0xFF, 0x0D, 0x89, 0x7C, 0xFF, 0x0D, 0x86, 0x7A, 0xD2, 0x0D, 0x87, 0x7B, 0x8D, 0x0C, 0x82, 0x77, 0x3C, 0x0C, 0x7F, 0x77, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x0C, 0x7D, 0x75, 0x94, 0x0C, 0x82, 0x75, 0xD3, 0x0D, 0x89, 0x7C, 0xFF, 0x0D, 0x86, 0x7A, 0xFF, 0x0D, 0x89, 0x7D, 0xFF, 0x0C, 0x83, 0x77, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0C, 0x7E, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x82, 0x75, 0xFF, 0x0D, 0x8A, 0x7D, 0xFF, 0x0D, 0x87, 0x7A, 0xC7, 0x0C, 0x86, 0x79, 0x72, 0x0D, 0x86, 0x78, 0x30, 0x0A, 0x7F, 0x6F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0xAA, 0x55, 0x3B, 0x0C, 0x7D, 0x70, 0x84, 0x0B, 0x85, 0x77, 0xD2, 0x0D, 0x86, 0x79, 0xFF, 0x0D, 0x88, 0x7B, 0xFF, 0x0D, 0x89, 0x7C, 0xFF, 0x0C, 0x81, 0x75, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7E, 0x73, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0D, 0x84, 0x77, 0xFF, 0x0D, 0x8A, 0x7D, 0xFF, 0x0D, 0x84, 0x78, 0xCA, 0x0C, 0x88, 0x7A, 0x82, 0x0B, 0x83, 0x77, 0x33, 0x0A, 0x82, 0x73, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0x09, 0x7D, 0x73, 0x88, 0x0D, 0x81, 0x74, 0xCB, 0x0C, 0x88, 0x7C, 0xFF, 0x0C, 0x86, 0x79, 0xFF, 0x0D, 0x8A, 0x7D, 0xFF, 0x0C, 0x84, 0x77, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0C, 0x7E, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0C, 0x81, 0x75, 0xFF, 0x0D, 0x89, 0x7D, 0xFF, 0x0D, 0x88, 0x7B, 0xD2, 0x0D, 0x86, 0x79, 0x7E, 0x0C, 0x87, 0x79, 0x39, 0x08, 0x7D, 0x6F, 0x02, 0x00, 0x7F, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x48, 0x48, 0x44, 0x0B, 0x7F, 0x74, 0x8D, 0x0E, 0x85, 0x77, 0xDA, 0x0C, 0x86, 0x79, 0xFF, 0x0D, 0x8A, 0x7D, 0xFF, 0x0D, 0x89, 0x7C, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0C, 0x7F, 0x72, 0xFF, 0x0D, 0x85, 0x78, 0xFF, 0x0D, 0x8B, 0x7E, 0xFD, 0x0C, 0x84, 0x77, 0xC0, 0x0D, 0x88, 0x7B, 0x79, 0x0C, 0x80, 0x73, 0x2C, 0x05, 0x7F, 0x73, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2E, 0x0B, 0x7F, 0x6E, 0x7D, 0x0A, 0x80, 0x74, 0xC2, 0x0D, 0x88, 0x7B, 0xFE, 0x0C, 0x84, 0x77, 0xFF, 0x0D, 0x8B, 0x7E, 0xFF, 0x0C, 0x84, 0x78, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0C, 0x7E, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0D, 0x8A, 0x7D, 0xFF, 0x0D, 0x8A, 0x7C, 0xD8, 0x0B, 0x86, 0x78, 0x8A, 0x0C, 0x85, 0x78, 0x43, 0x0B, 0x7D, 0x72, 0x05, 0x00, 0x99, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x19, 0x7F, 0x66, 0x4D, 0x09, 0x81, 0x77, 0x98, 0x0B, 0x86, 0x78, 0xE1, 0x0C, 0x86, 0x79, 0xFF, 0x0D, 0x8A, 0x7D, 0xFF, 0x0D, 0x88, 0x7C, 0xFF, 0x0C, 0x81, 0x75, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0C, 0x7F, 0x72, 0xFF, 0x0C, 0x85, 0x79, 0xFF, 0x0D, 0x8B, 0x7E, 0xFA, 0x0C, 0x83, 0x77, 0xB8, 0x0C, 0x89, 0x7B, 0x6F, 0x0B, 0x80, 0x72, 0x24, 0x0E, 0x7F, 0x71, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x0D, 0x7F, 0x72, 0x70, 0x0B, 0x81, 0x74, 0xBA, 0x0D, 0x87, 0x7B, 0xFB, 0x0C, 0x84, 0x77, 0xFF, 0x0D, 0x8B, 0x7E, 0xFF, 0x0D, 0x85, 0x78, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0C, 0x7E, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0C, 0x81, 0x74, 0xFF, 0x0D, 0x89, 0x7C, 0xFF, 0x0D, 0x89, 0x7C, 0xDF, 0x0C, 0x86, 0x7A, 0x96, 0x0B, 0x86, 0x78, 0x4B, 0x0D, 0x81, 0x73, 0x09, 0x00, 0x71, 0x71, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x11, 0x77, 0x77, 0x59, 0x0E, 0x80, 0x75, 0xA4, 0x0C, 0x85, 0x7A, 0xE7, 0x0C, 0x87, 0x7A, 0xFF, 0x0D, 0x8B, 0x7E, 0xFF, 0x0D, 0x88, 0x7B, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0C, 0x7F, 0x72, 0xFF, 0x0C, 0x86, 0x79, 0xFF, 0x0D, 0x8C, 0x7E, 0xF5, 0x0B, 0x85, 0x77, 0xAD, 0x0D, 0x86, 0x7A, 0x63, 0x0C, 0x7E, 0x73, 0x1E, 0x08, 0x7F, 0x6E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x0F, 0x7F, 0x6F, 0x62, 0x0D, 0x82, 0x75, 0xB0, 0x0B, 0x86, 0x7B, 0xF5, 0x0C, 0x85, 0x78, 0xFF, 0x0D, 0x8B, 0x7E, 0xFF, 0x0D, 0x85, 0x78, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0C, 0x7E, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0D, 0x89, 0x7B, 0xFF, 0x0D, 0x8A, 0x7D, 0xE5, 0x0C, 0x87, 0x79, 0xA4, 0x0C, 0x84, 0x77, 0x56, 0x08, 0x7F, 0x73, 0x0F, 0x00, 0x88, 0x77, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x85, 0x6D, 0x63, 0x0A, 0x80, 0x73, 0xAF, 0x0D, 0x86, 0x7A, 0xEC, 0x0C, 0x87, 0x7A, 0xFF, 0x0D, 0x8A, 0x7D, 0xFF, 0x0D, 0x87, 0x7A, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0D, 0x86, 0x79, 0xFF, 0x0D, 0x8B, 0x7E, 0xF0, 0x0B, 0x83, 0x78, 0xA4, 0x0C, 0x87, 0x7A, 0x56, 0x08, 0x82, 0x73, 0x18, 0x0A, 0x7F, 0x6A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x09, 0x7F, 0x75, 0x55, 0x09, 0x84, 0x75, 0xA8, 0x0D, 0x87, 0x79, 0xF1, 0x0C, 0x85, 0x77, 0xFF, 0x0D, 0x8B, 0x7E, 0xFF, 0x0D, 0x85, 0x79, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0D, 0x87, 0x7B, 0xFF, 0x0D, 0x8A, 0x7D, 0xEA, 0x0B, 0x87, 0x7B, 0xB1, 0x0B, 0x83, 0x76, 0x5F, 0x0A, 0x80, 0x73, 0x14, 0x0C, 0x7F, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x09, 0x7F, 0x76, 0x6F, 0x09, 0x80, 0x75, 0xBD, 0x0C, 0x84, 0x78, 0xF1, 0x0C, 0x87, 0x79, 0xFF, 0x0D, 0x8A, 0x7C, 0xFF, 0x0D, 0x86, 0x7A, 0xFF, 0x0C, 0x80, 0x73, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0D, 0x87, 0x7A, 0xFF, 0x0D, 0x8B, 0x7D, 0xE9, 0x0C, 0x85, 0x78, 0x99, 0x0B, 0x85, 0x79, 0x49, 0x0D, 0x7D, 0x73, 0x13, 0x0D, 0x78, 0x6B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x0C, 0x79, 0x6D, 0x49, 0x0A, 0x81, 0x73, 0x9B, 0x0D, 0x86, 0x7B, 0xEB, 0x0D, 0x84, 0x77, 0xFF, 0x0D, 0x8C, 0x7E, 0xFF, 0x0D, 0x86, 0x79, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0D, 0x87, 0x7A, 0xFF, 0x0D, 0x89, 0x7C, 0xEF, 0x0C, 0x87, 0x7A, 0xBD, 0x0C, 0x84, 0x76, 0x6B, 0x0B, 0x80, 0x74, 0x1B, 0x09, 0x7A, 0x7A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x23, 0x0E, 0x83, 0x74, 0x79, 0x0C, 0x80, 0x73, 0xC7, 0x0B, 0x83, 0x77, 0xF4, 0x0C, 0x87, 0x7B, 0xFF, 0x0D, 0x89, 0x7D, 0xFF, 0x0D, 0x86, 0x79, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0D, 0x87, 0x7A, 0xFF, 0x0D, 0x89, 0x7D, 0xE3, 0x0C, 0x84, 0x78, 0x8F, 0x0C, 0x87, 0x79, 0x3D, 0x08, 0x81, 0x75, 0x0F, 0x11, 0x77, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x0F, 0x7F, 0x6F, 0x40, 0x0B, 0x83, 0x73, 0x92, 0x0C, 0x86, 0x7A, 0xE7, 0x0C, 0x83, 0x77, 0xFF, 0x0D, 0x8A, 0x7D, 0xFF, 0x0D, 0x87, 0x7A, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0D, 0x86, 0x79, 0xFF, 0x0D, 0x89, 0x7B, 0xF3, 0x0C, 0x87, 0x79, 0xC5, 0x0C, 0x84, 0x78, 0x77, 0x0A, 0x80, 0x75, 0x2A, 0x0C, 0x79, 0x73, 0x01, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2C, 0x0B, 0x7F, 0x73, 0x83, 0x0B, 0x84, 0x76, 0xD1, 0x0C, 0x83, 0x76, 0xF7, 0x0D, 0x87, 0x79, 0xFF, 0x0D, 0x88, 0x7B, 0xFF, 0x0D, 0x85, 0x78, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0D, 0x87, 0x7A, 0xFF, 0x0D, 0x89, 0x7B, 0xDB, 0x0B, 0x84, 0x77, 0x84, 0x0D, 0x85, 0x77, 0x33, 0x0A, 0x82, 0x73, 0x0C, 0x00, 0x7F, 0x6A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x75, 0x75, 0x39, 0x08, 0x81, 0x74, 0x87, 0x0D, 0x86, 0x78, 0xE0, 0x0C, 0x84, 0x77, 0xFF, 0x0D, 0x89, 0x7C, 0xFF, 0x0D, 0x87, 0x7A, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7E, 0x73, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0D, 0x8A, 0x7D, 0xFF, 0x0E, 0x93, 0x85, 0xFD, 0x0D, 0x8B, 0x7D, 0xC6, 0x0B, 0x80, 0x76, 0x4E, 0x09, 0x7F, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x0A, 0x82, 0x73, 0x8F, 0x0C, 0x82, 0x75, 0xD9, 0x0C, 0x84, 0x79, 0xFA, 0x0C, 0x87, 0x7A, 0xFF, 0x0D, 0x87, 0x7A, 0xFF, 0x0C, 0x84, 0x77, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x81, 0x75, 0xFF, 0x0D, 0x87, 0x7A, 0xFF, 0x0D, 0x87, 0x7A, 0xD6, 0x0B, 0x83, 0x77, 0x7A, 0x0C, 0x85, 0x79, 0x2A, 0x0C, 0x7F, 0x79, 0x08, 0x00, 0x7F, 0x5F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x71, 0x71, 0x2F, 0x0A, 0x82, 0x77, 0x7B, 0x0C, 0x84, 0x7A, 0xD9, 0x0B, 0x82, 0x77, 0xFF, 0x0C, 0x88, 0x7B, 0xFF, 0x0D, 0x88, 0x7A, 0xFF, 0x0C, 0x81, 0x75, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x80, 0x73, 0xFF, 0x0C, 0x82, 0x75, 0xFF, 0x0D, 0x88, 0x7B, 0xFF, 0x0D, 0x87, 0x7A, 0xE7, 0x0B, 0x81, 0x73, 0xA9, 0x0C, 0x86, 0x77, 0x6F, 0x0D, 0x87, 0x7E, 0x46, 0x0E, 0x83, 0x78, 0x1B, 0x09, 0x7A, 0x71, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x3B, 0x0C, 0x85, 0x79, 0x9A, 0x0B, 0x82, 0x75, 0xDF, 0x0C, 0x85, 0x79, 0xFC, 0x0D, 0x86, 0x7A, 0xFF, 0x0D, 0x87, 0x7A, 0xFF, 0x0C, 0x83, 0x77, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x82, 0x76, 0xFF, 0x0D, 0x88, 0x7A, 0xFE, 0x0D, 0x85, 0x79, 0xCD, 0x0C, 0x82, 0x76, 0x6E, 0x0D, 0x84, 0x78, 0x24, 0x07, 0x7F, 0x78, 0x06, 0x00, 0x7F, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x7F, 0x7F, 0x27, 0x0D, 0x7C, 0x75, 0x70, 0x0B, 0x86, 0x78, 0xD0, 0x0B, 0x81, 0x76, 0xFE, 0x0C, 0x85, 0x79, 0xFF, 0x0D, 0x88, 0x7B, 0xFF, 0x0C, 0x82, 0x76, 0xFF, 0x0C, 0x82, 0x76, 0xFF, 0x0D, 0x88, 0x7B, 0xFE, 0x0C, 0x82, 0x76, 0xC4, 0x0B, 0x83, 0x76, 0x70, 0x0D, 0x84, 0x78, 0x2D, 0x0B, 0x82, 0x71, 0x13, 0x0D, 0x78, 0x6B, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x6D, 0x6D, 0x44, 0x0F, 0x83, 0x78, 0xA5, 0x0A, 0x83, 0x75, 0xE7, 0x0C, 0x86, 0x79, 0xFF, 0x0D, 0x87, 0x7A, 0xFF, 0x0D, 0x85, 0x79, 0xFF, 0x0C, 0x82, 0x76, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x83, 0x76, 0xFF, 0x0D, 0x88, 0x7B, 0xFA, 0x0C, 0x85, 0x79, 0xC5, 0x0B, 0x81, 0x75, 0x63, 0x0C, 0x83, 0x76, 0x1D, 0x08, 0x7B, 0x69, 0x02, 0x00, 0x7F, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x55, 0x55, 0x1D, 0x08, 0x7B, 0x72, 0x65, 0x0C, 0x83, 0x76, 0xC7, 0x0C, 0x82, 0x77, 0xFA, 0x0D, 0x87, 0x7B, 0xFA, 0x0D, 0x85, 0x79, 0xBA, 0x0C, 0x80, 0x77, 0x56, 0x0B, 0x82, 0x76, 0x17, 0x0B, 0x79, 0x6E, 0x03, 0x00, 0x55, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x89, 0x75, 0x4D, 0x0D, 0x87, 0x7A, 0xB1, 0x0B, 0x81, 0x77, 0xEE, 0x0C, 0x85, 0x7A, 0xFF, 0x0D, 0x87, 0x7A, 0xFF, 0x0C, 0x84, 0x78, 0xFF, 0x0C, 0x82, 0x75, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x81, 0x75, 0xFF, 0x0C, 0x84, 0x77, 0xFF, 0x0D, 0x88, 0x7B, 0xF5, 0x0C, 0x85, 0x78, 0xBB, 0x0A, 0x81, 0x75, 0x57, 0x0E, 0x83, 0x78, 0x15, 0x0C, 0x79, 0x79, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x16, 0x0B, 0x73, 0x73, 0x5C, 0x0D, 0x87, 0x7C, 0x58, 0x0E, 0x85, 0x79, 0x17, 0x16, 0x79, 0x6E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x0B, 0x7F, 0x73, 0x59, 0x0E, 0x83, 0x75, 0xBB, 0x0C, 0x82, 0x76, 0xF4, 0x0C, 0x86, 0x79, 0xFF, 0x0D, 0x88, 0x7B, 0xFF, 0x0C, 0x84, 0x77, 0xFF, 0x0C, 0x81, 0x75, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x82, 0x75, 0xFF, 0x0C, 0x84, 0x78, 0xFF, 0x0D, 0x88, 0x7A, 0xED, 0x0C, 0x86, 0x7A, 0xB0, 0x0B, 0x82, 0x76, 0x4E, 0x09, 0x82, 0x78, 0x0E, 0x00, 0x7F, 0x6D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x78, 0x5A, 0x5F, 0x0A, 0x83, 0x76, 0xC7, 0x0A, 0x82, 0x77, 0xFA, 0x0C, 0x85, 0x79, 0xFF, 0x0D, 0x88, 0x7B, 0xFF, 0x0C, 0x83, 0x76, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x82, 0x76, 0xFF, 0x0D, 0x85, 0x79, 0xFE, 0x0D, 0x87, 0x7A, 0xE7, 0x0D, 0x86, 0x79, 0xA4, 0x0C, 0x84, 0x76, 0x43, 0x0B, 0x81, 0x75, 0x07, 0x00, 0x6D, 0x6D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2A, 0x0C, 0x7F, 0x73, 0xA5, 0x0A, 0x84, 0x76, 0xFE, 0x0C, 0x86, 0x79, 0xFF, 0x0D, 0x89, 0x7C, 0xFF, 0x0C, 0x82, 0x76, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7E, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x83, 0x77, 0xFF, 0x0D, 0x87, 0x7A, 0xFC, 0x0D, 0x87, 0x7A, 0xDF, 0x0C, 0x85, 0x7A, 0x99, 0x0B, 0x83, 0x76, 0x3B, 0x0C, 0x81, 0x79, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x7F, 0x7F, 0x0D, 0x13, 0x75, 0x75, 0x16, 0x0B, 0x7F, 0x73, 0x1D, 0x08, 0x7B, 0x69, 0x21, 0x07, 0x7B, 0x6C, 0x23, 0x0E, 0x7B, 0x6D, 0x23, 0x0E, 0x7B, 0x6D, 0x21, 0x07, 0x7B, 0x6C, 0x1C, 0x09, 0x7F, 0x76, 0x16, 0x0B, 0x7F, 0x73, 0x0D, 0x00, 0x75, 0x75, 0x02, 0x00, 0x7F, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x36, 0x09, 0x7F, 0x76, 0xC6, 0x0B, 0x85, 0x7A, 0xFF, 0x0D, 0x8B, 0x7E, 0xFF, 0x0C, 0x83, 0x76, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7E, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x84, 0x77, 0xFF, 0x0D, 0x87, 0x7A, 0xFA, 0x0D, 0x86, 0x7A, 0xD9, 0x0C, 0x85, 0x79, 0x8E, 0x0A, 0x83, 0x76, 0x31, 0x0A, 0x82, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0x13, 0x75, 0x75, 0x24, 0x0E, 0x78, 0x71, 0x43, 0x0B, 0x81, 0x75, 0x6E, 0x0D, 0x84, 0x78, 0x94, 0x0D, 0x84, 0x7A, 0xB3, 0x0B, 0x83, 0x77, 0xCA, 0x0A, 0x80, 0x74, 0xD7, 0x0B, 0x81, 0x74, 0xDE, 0x0C, 0x81, 0x75, 0xDE, 0x0C, 0x80, 0x75, 0xD7, 0x0B, 0x81, 0x74, 0xC9, 0x0B, 0x82, 0x75, 0xB3, 0x0B, 0x83, 0x77, 0x93, 0x0C, 0x85, 0x79, 0x6D, 0x0B, 0x83, 0x77, 0x43, 0x0B, 0x81, 0x75, 0x23, 0x0E, 0x7B, 0x74, 0x0D, 0x13, 0x75, 0x75, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x0A, 0x82, 0x71, 0xC8, 0x0C, 0x87, 0x7A, 0xFF, 0x0D, 0x8B, 0x7E, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0D, 0x85, 0x78, 0xFF, 0x0D, 0x88, 0x7C, 0xF7, 0x0D, 0x88, 0x7A, 0xD1, 0x0C, 0x84, 0x78, 0x85, 0x0D, 0x80, 0x74, 0x2B, 0x0B, 0x82, 0x76, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x07, 0x83, 0x73, 0x51, 0x0C, 0x81, 0x77, 0x93, 0x0C, 0x85, 0x7B, 0xD1, 0x0C, 0x82, 0x77, 0xFA, 0x0C, 0x81, 0x74, 0xFF, 0x0C, 0x88, 0x7B, 0xFF, 0x0D, 0x8A, 0x7D, 0xFF, 0x0D, 0x89, 0x7C, 0xFF, 0x0D, 0x87, 0x7B, 0xFF, 0x0D, 0x86, 0x79, 0xFF, 0x0D, 0x85, 0x78, 0xFF, 0x0D, 0x85, 0x79, 0xFF, 0x0D, 0x86, 0x79, 0xFF, 0x0D, 0x87, 0x7A, 0xFF, 0x0D, 0x89, 0x7C, 0xFF, 0x0D, 0x89, 0x7C, 0xFF, 0x0D, 0x88, 0x7B, 0xF9, 0x0B, 0x80, 0x74, 0xCF, 0x0C, 0x83, 0x77, 0x91, 0x0C, 0x85, 0x7B, 0x51, 0x0F, 0x84, 0x77, 0x20, 0x07, 0x7F, 0x6F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x0A, 0x7A, 0x65, 0xB7, 0x0C, 0x82, 0x76, 0xFF, 0x0D, 0x8B, 0x7E, 0xFF, 0x0C, 0x80, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0D, 0x86, 0x79, 0xFF, 0x0D, 0x89, 0x7B, 0xF5, 0x0C, 0x87, 0x78, 0xC8, 0x0B, 0x83, 0x76, 0x79, 0x0C, 0x80, 0x73, 0x23, 0x0E, 0x83, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x0C, 0x7F, 0x72, 0x71, 0x0B, 0x82, 0x77, 0xC2, 0x0A, 0x86, 0x78, 0xFE, 0x0C, 0x82, 0x76, 0xFF, 0x0D, 0x8B, 0x7E, 0xFF, 0x0D, 0x87, 0x7A, 0xFF, 0x0C, 0x82, 0x76, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x82, 0x76, 0xFF, 0x0D, 0x87, 0x7B, 0xFF, 0x0D, 0x8A, 0x7E, 0xFE, 0x0C, 0x82, 0x75, 0xBF, 0x0C, 0x86, 0x7A, 0x6D, 0x0B, 0x85, 0x77, 0x27, 0x0D, 0x7C, 0x75, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x7F, 0x7F, 0x7F, 0x0C, 0x80, 0x74, 0xFF, 0x0D, 0x8A, 0x7C, 0xFF, 0x0C, 0x81, 0x75, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7E, 0x73, 0xFF, 0x0C, 0x7E, 0x73, 0xFF, 0x0D, 0x86, 0x79, 0xFF, 0x0C, 0x89, 0x7D, 0xF1, 0x0C, 0x87, 0x7A, 0xBD, 0x0D, 0x84, 0x76, 0x6F, 0x0B, 0x82, 0x75, 0x1D, 0x08, 0x7B, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x09, 0x75, 0x6B, 0x6B, 0x0E, 0x83, 0x74, 0xC8, 0x0C, 0x87, 0x7A, 0xFF, 0x0D, 0x87, 0x7B, 0xFF, 0x0D, 0x8A, 0x7D, 0xFF, 0x0C, 0x83, 0x76, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x82, 0x76, 0xFF, 0x0D, 0x8A, 0x7D, 0xFF, 0x0D, 0x87, 0x7C, 0xC5, 0x0C, 0x86, 0x7A, 0x68, 0x0E, 0x81, 0x78, 0x18, 0x0A, 0x74, 0x6A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x33, 0x0A, 0x82, 0x78, 0xEC, 0x0C, 0x83, 0x76, 0xFF, 0x0D, 0x85, 0x79, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0C, 0x80, 0x75, 0xFF, 0x0D, 0x88, 0x7C, 0xF0, 0x0C, 0x85, 0x7A, 0xB0, 0x0B, 0x85, 0x78, 0x63, 0x0A, 0x80, 0x73, 0x15, 0x0C, 0x79, 0x79, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x0C, 0x7F, 0x73, 0xAE, 0x0D, 0x86, 0x79, 0xFF, 0x0D, 0x86, 0x78, 0xFF, 0x0D, 0x8B, 0x7D, 0xFF, 0x0C, 0x81, 0x75, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0C, 0x81, 0x75, 0xFF, 0x0D, 0x8B, 0x7E, 0xFF, 0x0D, 0x85, 0x79, 0xAB, 0x0D, 0x87, 0x7A, 0x3E, 0x0C, 0x7B, 0x6F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x02, 0x00, 0x7F, 0x7F, 0x95, 0x0B, 0x82, 0x74, 0xFF, 0x0D, 0x8A, 0x7D, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0D, 0x80, 0x74, 0xFF, 0x0D, 0x88, 0x7C, 0xCD, 0x0B, 0x83, 0x77, 0x5F, 0x0A, 0x80, 0x73, 0x0F, 0x11, 0x77, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x17, 0x73, 0x5C, 0x6D, 0x09, 0x80, 0x72, 0xDD, 0x0C, 0x88, 0x7B, 0xFF, 0x0D, 0x8C, 0x7F, 0xFF, 0x0C, 0x83, 0x77, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0C, 0x83, 0x77, 0xFF, 0x0D, 0x8C, 0x80, 0xDB, 0x0C, 0x88, 0x7B, 0x6A, 0x0C, 0x81, 0x73, 0x09, 0x00, 0x71, 0x71, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x19, 0x0A, 0x7A, 0x70, 0xE6, 0x0C, 0x80, 0x73, 0xFF, 0x0D, 0x85, 0x78, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0D, 0x89, 0x7C, 0xC7, 0x0B, 0x82, 0x77, 0x32, 0x0A, 0x7A, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x0B, 0x73, 0x68, 0x8C, 0x0C, 0x84, 0x76, 0xF7, 0x0C, 0x87, 0x7A, 0xFF, 0x0D, 0x89, 0x7C, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x84, 0x78, 0xFF, 0x0D, 0x88, 0x7B, 0xFF, 0x0D, 0x89, 0x7C, 0xFF, 0x0D, 0x8A, 0x7D, 0xFF, 0x0D, 0x8A, 0x7D, 0xFF, 0x0D, 0x89, 0x7C, 0xFF, 0x0D, 0x88, 0x7B, 0xFF, 0x0C, 0x84, 0x78, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7E, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0E, 0x8A, 0x7D, 0xF4, 0x0C, 0x88, 0x7C, 0x86, 0x0B, 0x85, 0x77, 0x11, 0x0F, 0x78, 0x69, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x4E, 0x0D, 0x82, 0x75, 0xFC, 0x0D, 0x84, 0x78, 0xFF, 0x0C, 0x81, 0x75, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x72, 0xFF, 0x0D, 0x88, 0x7B, 0xDD, 0x0C, 0x86, 0x7A, 0x41, 0x0B, 0x79, 0x6D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0x09, 0x7A, 0x67, 0x9C, 0x0D, 0x86, 0x77, 0xFF, 0x0D, 0x89, 0x7B, 0xFF, 0x0D, 0x86, 0x7A, 0xFF, 0x0C, 0x7E, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0D, 0x88, 0x7B, 0xFF, 0x0D, 0x8B, 0x7E, 0xFF, 0x0D, 0x87, 0x7A, 0xF5, 0x0C, 0x83, 0x75, 0xDE, 0x0C, 0x84, 0x77, 0xCD, 0x0C, 0x86, 0x78, 0xC4, 0x0D, 0x86, 0x78, 0xC4, 0x0D, 0x86, 0x78, 0xCD, 0x0C, 0x86, 0x78, 0xDF, 0x0D, 0x83, 0x78, 0xF7, 0x0B, 0x82, 0x75, 0xFF, 0x0C, 0x87, 0x7A, 0xFF, 0x0D, 0x8B, 0x7E, 0xFF, 0x0D, 0x87, 0x7A, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0D, 0x87, 0x7A, 0xFC, 0x0D, 0x8A, 0x7C, 0x98, 0x0B, 0x82, 0x77, 0x15, 0x0C, 0x79, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x90, 0x0A, 0x81, 0x74, 0xFA, 0x0D, 0x88, 0x7B, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7E, 0x73, 0xFF, 0x0D, 0x82, 0x75, 0xFF, 0x0D, 0x87, 0x79, 0x88, 0x0D, 0x81, 0x74, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x0B, 0x6E, 0x63, 0x9C, 0x0B, 0x84, 0x77, 0xFE, 0x0D, 0x8A, 0x7D, 0xFF, 0x0D, 0x85, 0x78, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7E, 0x73, 0xFF, 0x0C, 0x81, 0x74, 0xFF, 0x0D, 0x89, 0x7C, 0xFF, 0x0C, 0x87, 0x7B, 0xDE, 0x0C, 0x85, 0x78, 0xA4, 0x0D, 0x87, 0x79, 0x76, 0x0C, 0x7F, 0x74, 0x51, 0x0C, 0x81, 0x71, 0x3E, 0x0C, 0x7B, 0x6F, 0x31, 0x0A, 0x7C, 0x6D, 0x2A, 0x0C, 0x79, 0x6D, 0x2A, 0x0C, 0x79, 0x6D, 0x31, 0x0A, 0x7C, 0x6D, 0x3E, 0x0C, 0x7B, 0x73, 0x52, 0x09, 0x7F, 0x73, 0x79, 0x0C, 0x80, 0x73, 0xA8, 0x0D, 0x85, 0x79, 0xE0, 0x0C, 0x84, 0x77, 0xFF, 0x0D, 0x87, 0x7B, 0xFF, 0x0D, 0x89, 0x7C, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0D, 0x85, 0x78, 0xFE, 0x0D, 0x8A, 0x7C, 0x95, 0x0D, 0x85, 0x77, 0x12, 0x0E, 0x7F, 0x71, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0xC8, 0x0B, 0x7F, 0x74, 0xFC, 0x0C, 0x83, 0x78, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0D, 0x88, 0x7B, 0xDF, 0x0C, 0x85, 0x79, 0x42, 0x0B, 0x77, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x73, 0x5C, 0x8D, 0x0C, 0x82, 0x77, 0xFA, 0x0D, 0x8B, 0x7D, 0xFF, 0x0D, 0x85, 0x78, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0D, 0x87, 0x7B, 0xFF, 0x0D, 0x87, 0x7B, 0xC6, 0x0C, 0x85, 0x7A, 0x73, 0x0B, 0x85, 0x77, 0x38, 0x09, 0x7F, 0x71, 0x13, 0x0D, 0x78, 0x6B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x0C, 0x79, 0x79, 0x3A, 0x0D, 0x7F, 0x72, 0x7A, 0x0C, 0x7F, 0x75, 0xCA, 0x0C, 0x85, 0x7A, 0xFF, 0x0D, 0x88, 0x7B, 0xFF, 0x0D, 0x86, 0x7A, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0D, 0x85, 0x77, 0xFA, 0x0D, 0x8B, 0x7E, 0x86, 0x0B, 0x83, 0x75, 0x0D, 0x00, 0x62, 0x4E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0xF1, 0x0C, 0x7D, 0x71, 0xFF, 0x0C, 0x80, 0x75, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0D, 0x89, 0x7C, 0xBC, 0x0C, 0x86, 0x78, 0x17, 0x0B, 0x79, 0x6E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6D, 0x0B, 0x7E, 0x72, 0xF4, 0x0C, 0x88, 0x7C, 0xFF, 0x0D, 0x87, 0x7A, 0xFF, 0x0C, 0x7F, 0x72, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x81, 0x75, 0xFF, 0x0D, 0x8A, 0x7D, 0xDF, 0x0C, 0x85, 0x78, 0x77, 0x0C, 0x82, 0x77, 0x27, 0x0D, 0x7C, 0x75, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2A, 0x0C, 0x7F, 0x73, 0x7D, 0x0C, 0x82, 0x74, 0xE2, 0x0C, 0x86, 0x78, 0xFF, 0x0D, 0x89, 0x7C, 0xFF, 0x0C, 0x81, 0x75, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0C, 0x86, 0x79, 0xF3, 0x0C, 0x8A, 0x7C, 0x64, 0x0C, 0x82, 0x75, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x80, 0x73, 0xFF, 0x0D, 0x89, 0x7B, 0xAF, 0x0B, 0x80, 0x74, 0x07, 0x00, 0x6D, 0x6D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0x0B, 0x7B, 0x70, 0xE5, 0x0C, 0x83, 0x77, 0xFF, 0x0D, 0x89, 0x7D, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x84, 0x76, 0xFF, 0x0D, 0x88, 0x7B, 0xAF, 0x0D, 0x86, 0x78, 0x37, 0x09, 0x81, 0x6F, 0x03, 0x00, 0x55, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x7F, 0x7F, 0x3C, 0x0C, 0x83, 0x77, 0xB8, 0x0C, 0x85, 0x78, 0xFF, 0x0D, 0x88, 0x7C, 0xFF, 0x0D, 0x82, 0x77, 0xFF, 0x0C, 0x7E, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7E, 0x73, 0xFF, 0x0D, 0x89, 0x7C, 0xE5, 0x0B, 0x83, 0x76, 0x39, 0x08, 0x78, 0x6F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x80, 0x73, 0xFF, 0x0D, 0x89, 0x7B, 0xAF, 0x0B, 0x7E, 0x73, 0x06, 0x00, 0x7F, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x09, 0x7F, 0x6D, 0xB1, 0x0C, 0x85, 0x79, 0xFF, 0x0D, 0x8C, 0x7F, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x84, 0x77, 0xFF, 0x0D, 0x85, 0x79, 0x91, 0x0C, 0x83, 0x79, 0x19, 0x0A, 0x7A, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x07, 0x77, 0x6F, 0x99, 0x0D, 0x83, 0x77, 0xFF, 0x0C, 0x86, 0x7A, 0xFF, 0x0D, 0x83, 0x78, 0xFF, 0x0C, 0x7E, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0D, 0x8B, 0x7F, 0xB2, 0x0C, 0x82, 0x75, 0x16, 0x0B, 0x73, 0x68, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x80, 0x73, 0xFF, 0x0D, 0x89, 0x7B, 0xAF, 0x0B, 0x7E, 0x73, 0x07, 0x00, 0x6D, 0x6D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6E, 0x0B, 0x81, 0x76, 0xFA, 0x0D, 0x87, 0x7B, 0xFF, 0x0C, 0x83, 0x77, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x83, 0x76, 0xFF, 0x0D, 0x85, 0x78, 0x86, 0x0B, 0x81, 0x77, 0x0F, 0x00, 0x77, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x0F, 0x78, 0x69, 0x8E, 0x0C, 0x81, 0x74, 0xFF, 0x0C, 0x86, 0x79, 0xFF, 0x0D, 0x83, 0x77, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x82, 0x76, 0xFC, 0x0D, 0x88, 0x7B, 0x64, 0x0A, 0x82, 0x77, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x80, 0x73, 0xFF, 0x0D, 0x89, 0x7B, 0xAF, 0x0B, 0x7E, 0x73, 0x07, 0x00, 0x6D, 0x6D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2E, 0x0B, 0x74, 0x6E, 0xCD, 0x0C, 0x85, 0x78, 0xFF, 0x0D, 0x8B, 0x7E, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x81, 0x75, 0xFF, 0x0D, 0x88, 0x7B, 0x92, 0x0C, 0x82, 0x75, 0x0E, 0x00, 0x6D, 0x6D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x0F, 0x78, 0x69, 0x99, 0x0B, 0x83, 0x76, 0xFF, 0x0D, 0x89, 0x7C, 0xFF, 0x0C, 0x82, 0x76, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0D, 0x89, 0x7C, 0xD3, 0x0C, 0x81, 0x74, 0x1E, 0x11, 0x7F, 0x77, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x80, 0x73, 0xFF, 0x0D, 0x89, 0x7B, 0xAF, 0x0B, 0x7E, 0x73, 0x07, 0x00, 0x6D, 0x6D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xFF, 0x00, 0x75, 0x0D, 0x80, 0x75, 0xFE, 0x0D, 0x88, 0x7C, 0xFF, 0x0C, 0x81, 0x75, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0D, 0x8A, 0x7D, 0xB3, 0x0B, 0x83, 0x77, 0x1A, 0x09, 0x7F, 0x6B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x07, 0x78, 0x69, 0xB6, 0x0C, 0x86, 0x79, 0xFF, 0x0D, 0x8A, 0x7E, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x81, 0x74, 0xFF, 0x0D, 0x88, 0x7B, 0x6C, 0x0E, 0x84, 0x78, 0x02, 0x00, 0x7F, 0x7F, 0x00, 0x00, 0x00, 0x00, 
-    0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x80, 0x73, 0xFF, 0x0D, 0x89, 0x7B, 0xAF, 0x0B, 0x7E, 0x73, 0x07, 0x00, 0x6D, 0x6D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0x0D, 0x7C, 0x6F, 0xC7, 0x0C, 0x83, 0x77, 0xFF, 0x0D, 0x8A, 0x7D, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0D, 0x86, 0x7A, 0xE4, 0x0C, 0x82, 0x76, 0x35, 0x0E, 0x81, 0x73, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x0A, 0x7A, 0x65, 0x06, 0x00, 0x7F, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x45, 0x0B, 0x79, 0x6E, 0xE3, 0x0D, 0x84, 0x78, 0xFF, 0x0D, 0x88, 0x7B, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0D, 0x87, 0x7A, 0xCD, 0x0B, 0x81, 0x73, 0x19, 0x0A, 0x7A, 0x65, 0x00, 0x00, 0x00, 0x00, 
-    0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x80, 0x73, 0xFF, 0x0D, 0x89, 0x7B, 0xAF, 0x0B, 0x7E, 0x73, 0x07, 0x00, 0x6D, 0x6D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5A, 0x0B, 0x7C, 0x74, 0xFF, 0x0B, 0x83, 0x77, 0xFF, 0x0C, 0x83, 0x76, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x81, 0x74, 0xFE, 0x0D, 0x88, 0x7B, 0x74, 0x0D, 0x81, 0x76, 0x03, 0x00, 0x55, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0x0B, 0x7F, 0x73, 0xC9, 0x0C, 0x89, 0x7B, 0x7A, 0x0C, 0x7F, 0x75, 0x05, 0x00, 0x66, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x83, 0x0D, 0x80, 0x72, 0xFD, 0x0D, 0x89, 0x7A, 0xFF, 0x0C, 0x82, 0x75, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x81, 0x75, 0xFE, 0x0D, 0x83, 0x77, 0x50, 0x09, 0x82, 0x75, 0x00, 0x00, 0x00, 0x00, 
-    0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x80, 0x73, 0xFF, 0x0D, 0x89, 0x7B, 0xAF, 0x0B, 0x7E, 0x73, 0x07, 0x00, 0x6D, 0x6D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x6F, 0x6F, 0x99, 0x0B, 0x85, 0x79, 0xFF, 0x0D, 0x8B, 0x7E, 0xFF, 0x0C, 0x7E, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0D, 0x89, 0x7C, 0xCD, 0x0C, 0x81, 0x76, 0x23, 0x0E, 0x74, 0x6D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x0C, 0x7D, 0x75, 0xD8, 0x0C, 0x84, 0x78, 0xFF, 0x0D, 0x8E, 0x81, 0xF3, 0x0C, 0x86, 0x79, 0x70, 0x0B, 0x81, 0x76, 0x07, 0x00, 0x6D, 0x6D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2E, 0x0B, 0x79, 0x6E, 0xCB, 0x0D, 0x86, 0x78, 0xFF, 0x0D, 0x8A, 0x7C, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0D, 0x89, 0x7C, 0x9D, 0x0B, 0x80, 0x76, 0x05, 0x00, 0x66, 0x66, 
-    0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x80, 0x73, 0xFF, 0x0D, 0x89, 0x7B, 0xAF, 0x0B, 0x7E, 0x73, 0x07, 0x00, 0x6D, 0x6D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2D, 0x0B, 0x76, 0x71, 0xD7, 0x0B, 0x82, 0x76, 0xFF, 0x0D, 0x88, 0x7B, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0D, 0x88, 0x7A, 0x6F, 0x0B, 0x82, 0x77, 0x02, 0x00, 0x7F, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x08, 0x7D, 0x71, 0xD7, 0x0B, 0x84, 0x78, 0xFF, 0x0D, 0x89, 0x7C, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0D, 0x86, 0x79, 0xF1, 0x0C, 0x87, 0x7A, 0x71, 0x0B, 0x80, 0x75, 0x07, 0x00, 0x6D, 0x6D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x83, 0x0B, 0x80, 0x72, 0xFD, 0x0D, 0x88, 0x7A, 0xFF, 0x0C, 0x81, 0x75, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0D, 0x86, 0x79, 0xDC, 0x0B, 0x7E, 0x72, 0x11, 0x00, 0x78, 0x69, 
-    0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x80, 0x73, 0xFF, 0x0D, 0x89, 0x7B, 0xAF, 0x0B, 0x7E, 0x73, 0x07, 0x00, 0x6D, 0x6D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4C, 0x0A, 0x7F, 0x72, 0xFC, 0x0C, 0x81, 0x75, 0xFF, 0x0C, 0x83, 0x76, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0D, 0x87, 0x7A, 0xE5, 0x0C, 0x80, 0x73, 0x33, 0x0A, 0x78, 0x6E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x0C, 0x7F, 0x73, 0xD7, 0x0B, 0x84, 0x78, 0xFF, 0x0D, 0x89, 0x7C, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0D, 0x87, 0x79, 0xF0, 0x0C, 0x88, 0x7A, 0x71, 0x0B, 0x82, 0x75, 0x0F, 0x11, 0x77, 0x77, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x07, 0x78, 0x70, 0xDF, 0x0C, 0x85, 0x79, 0xFF, 0x0D, 0x88, 0x7B, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x82, 0x76, 0xF7, 0x0C, 0x83, 0x75, 0x34, 0x09, 0x84, 0x7A, 
-    0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x80, 0x73, 0xFF, 0x0D, 0x89, 0x7B, 0xAF, 0x0B, 0x7E, 0x73, 0x07, 0x00, 0x6D, 0x6D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x55, 0x55, 0x77, 0x0C, 0x80, 0x73, 0xFF, 0x0D, 0x89, 0x7B, 0xFF, 0x0C, 0x7F, 0x74, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0D, 0x8C, 0x7F, 0xA5, 0x0D, 0x84, 0x78, 0x14, 0x0C, 0x72, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x0B, 0x7B, 0x73, 0xD7, 0x0B, 0x84, 0x78, 0xFF, 0x0D, 0x89, 0x7C, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0D, 0x87, 0x7B, 0xFA, 0x0D, 0x88, 0x7B, 0x71, 0x0B, 0x7E, 0x73, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x0E, 0x71, 0x71, 0xB0, 0x0B, 0x83, 0x76, 0xFF, 0x0D, 0x8A, 0x7D, 0xFF, 0x0C, 0x7F, 0x72, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x81, 0x75, 0xF9, 0x0C, 0x88, 0x7A, 0x64, 0x0C, 0x82, 0x77, 
-    0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x80, 0x73, 0xFF, 0x0D, 0x89, 0x7B, 0xAF, 0x0B, 0x7E, 0x73, 0x07, 0x00, 0x6D, 0x6D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x69, 0x69, 0x9A, 0x0B, 0x84, 0x77, 0xFF, 0x0D, 0x8A, 0x7D, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x88, 0x7B, 0x72, 0x0D, 0x81, 0x76, 0x01, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x0C, 0x7D, 0x75, 0xD7, 0x0B, 0x84, 0x78, 0xFF, 0x0D, 0x89, 0x7C, 0xFF, 0x0C, 0x80, 0x73, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7E, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0D, 0x89, 0x7C, 0xEC, 0x0B, 0x88, 0x7A, 0x69, 0x09, 0x7E, 0x6F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0x0B, 0x7B, 0x70, 0xFF, 0x0D, 0x86, 0x79, 0xFF, 0x0C, 0x82, 0x75, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x81, 0x74, 0xFB, 0x0D, 0x87, 0x79, 0x94, 0x0C, 0x82, 0x75, 
-    0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x80, 0x73, 0xFF, 0x0D, 0x89, 0x7B, 0xAF, 0x0B, 0x7E, 0x73, 0x07, 0x00, 0x6D, 0x6D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1D, 0x08, 0x7B, 0x69, 0xB8, 0x0C, 0x83, 0x77, 0xFF, 0x0D, 0x89, 0x7C, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x83, 0x77, 0xFA, 0x0B, 0x81, 0x75, 0x4E, 0x09, 0x7C, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x07, 0x7B, 0x6F, 0xD7, 0x0D, 0x86, 0x78, 0xFF, 0x0D, 0x8A, 0x7D, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0C, 0x7E, 0x73, 0xFF, 0x0D, 0x89, 0x7C, 0xE8, 0x0D, 0x86, 0x78, 0x5D, 0x0A, 0x7E, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x0D, 0x7B, 0x71, 0xF4, 0x0D, 0x83, 0x77, 0xFF, 0x0D, 0x85, 0x78, 0xFF, 0x0C, 0x7E, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x80, 0x74, 0xFC, 0x0D, 0x84, 0x78, 0xC0, 0x0B, 0x7F, 0x73, 
-    0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x80, 0x73, 0xFF, 0x0D, 0x89, 0x7B, 0xAF, 0x0B, 0x7E, 0x73, 0x07, 0x00, 0x6D, 0x6D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x0D, 0x78, 0x72, 0xCD, 0x0D, 0x82, 0x77, 0xFF, 0x0D, 0x87, 0x7A, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0D, 0x87, 0x7A, 0xE5, 0x0D, 0x82, 0x76, 0x39, 0x08, 0x7D, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x0D, 0x78, 0x78, 0x71, 0x0B, 0x7E, 0x73, 0x37, 0x0D, 0x7D, 0x6F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x0B, 0x7B, 0x6F, 0xD6, 0x0B, 0x85, 0x78, 0xFF, 0x0D, 0x8A, 0x7D, 0xFF, 0x0C, 0x80, 0x73, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0D, 0x88, 0x7C, 0xE8, 0x0C, 0x86, 0x78, 0x5B, 0x0E, 0x7E, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x0E, 0x7B, 0x6D, 0xDF, 0x0D, 0x88, 0x7A, 0xFF, 0x0D, 0x88, 0x7B, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x80, 0x74, 0xFD, 0x0C, 0x82, 0x75, 0xE4, 0x0B, 0x7E, 0x73, 
-    0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x80, 0x73, 0xFF, 0x0D, 0x89, 0x7B, 0xAF, 0x0B, 0x7E, 0x73, 0x07, 0x00, 0x6D, 0x6D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2B, 0x0B, 0x7C, 0x70, 0xDB, 0x0C, 0x82, 0x75, 0xFF, 0x0D, 0x86, 0x79, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0D, 0x89, 0x7C, 0xD3, 0x0C, 0x83, 0x77, 0x30, 0x0A, 0x7A, 0x6F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x73, 0x73, 0x90, 0x0C, 0x81, 0x76, 0xFF, 0x0D, 0x8B, 0x7F, 0xC8, 0x0C, 0x84, 0x77, 0x2F, 0x0A, 0x7C, 0x71, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x0B, 0x7F, 0x6F, 0xD6, 0x0B, 0x85, 0x78, 0xFF, 0x0E, 0x8A, 0x7D, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0D, 0x89, 0x7C, 0xE9, 0x0D, 0x86, 0x79, 0x5C, 0x0B, 0x7C, 0x71, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x09, 0x78, 0x6F, 0xD3, 0x0C, 0x87, 0x7B, 0xFF, 0x0D, 0x89, 0x7C, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFB, 0x0B, 0x7E, 0x73, 
-    0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x80, 0x73, 0xFF, 0x0D, 0x89, 0x7B, 0xAF, 0x0B, 0x7E, 0x73, 0x07, 0x00, 0x6D, 0x6D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2E, 0x0B, 0x79, 0x6E, 0xE2, 0x0C, 0x80, 0x75, 0xFF, 0x0D, 0x86, 0x79, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0D, 0x8A, 0x7D, 0xCA, 0x0C, 0x84, 0x77, 0x2B, 0x0B, 0x76, 0x6A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x73, 0x5C, 0x8E, 0x0A, 0x81, 0x76, 0xFD, 0x0D, 0x87, 0x79, 0xFF, 0x0D, 0x87, 0x7B, 0xFF, 0x0D, 0x8B, 0x7D, 0xC3, 0x0B, 0x85, 0x79, 0x31, 0x0A, 0x77, 0x6D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x0B, 0x7D, 0x71, 0xD8, 0x0C, 0x85, 0x78, 0xFF, 0x0E, 0x8B, 0x7D, 0xFF, 0x0C, 0x80, 0x73, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0D, 0x88, 0x7B, 0xE8, 0x0D, 0x86, 0x7A, 0x5B, 0x0B, 0x7E, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2E, 0x0B, 0x79, 0x6E, 0xCC, 0x0C, 0x88, 0x7A, 0xFF, 0x0D, 0x89, 0x7C, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x80, 0x73, 
-    0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x80, 0x73, 0xFF, 0x0D, 0x89, 0x7B, 0xAF, 0x0B, 0x7E, 0x73, 0x07, 0x00, 0x6D, 0x6D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2E, 0x0B, 0x79, 0x69, 0xE2, 0x0C, 0x80, 0x74, 0xFF, 0x0D, 0x86, 0x79, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0D, 0x8A, 0x7D, 0xCB, 0x0C, 0x85, 0x77, 0x2B, 0x0B, 0x7C, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x1C, 0x71, 0x71, 0x8E, 0x0C, 0x81, 0x74, 0xFC, 0x0D, 0x87, 0x7A, 0xFF, 0x0D, 0x85, 0x79, 0xFF, 0x0C, 0x7D, 0x71, 0xFF, 0x0C, 0x81, 0x75, 0xFF, 0x0D, 0x8C, 0x7E, 0xC1, 0x0B, 0x86, 0x79, 0x30, 0x0A, 0x7A, 0x6F, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x08, 0x7D, 0x75, 0xD9, 0x0B, 0x84, 0x77, 0xFF, 0x0E, 0x8B, 0x7D, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0D, 0x88, 0x7B, 0xE9, 0x0D, 0x85, 0x79, 0x5B, 0x0B, 0x7E, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x0A, 0x7C, 0x71, 0xCD, 0x0C, 0x87, 0x7B, 0xFF, 0x0D, 0x89, 0x7C, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 
-    0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x80, 0x73, 0xFF, 0x0D, 0x89, 0x7B, 0xAF, 0x0B, 0x7E, 0x73, 0x07, 0x00, 0x6D, 0x6D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2B, 0x0B, 0x7C, 0x6A, 0xDB, 0x0C, 0x82, 0x75, 0xFF, 0x0D, 0x87, 0x7A, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0D, 0x88, 0x7B, 0xD5, 0x0D, 0x83, 0x77, 0x31, 0x0A, 0x7C, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x09, 0x76, 0x6D, 0x95, 0x0B, 0x82, 0x76, 0xFC, 0x0D, 0x86, 0x79, 0xFF, 0x0D, 0x85, 0x78, 0xFF, 0x0C, 0x7E, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0C, 0x81, 0x75, 0xFF, 0x0D, 0x8A, 0x7E, 0xB6, 0x0C, 0x85, 0x77, 0x70, 0x0B, 0x7A, 0x6F, 0xCA, 0x0C, 0x83, 0x77, 0xFF, 0x0D, 0x8B, 0x7E, 0xFF, 0x0C, 0x80, 0x73, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7E, 0x73, 0xFF, 0x0D, 0x87, 0x7B, 0xE9, 0x0D, 0x85, 0x79, 0x59, 0x0E, 0x80, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x0D, 0x7A, 0x71, 0xD4, 0x0D, 0x86, 0x7A, 0xFF, 0x0D, 0x88, 0x7B, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x80, 0x74, 0xFA, 0x0B, 0x7F, 0x72, 
-    0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x80, 0x73, 0xFF, 0x0D, 0x89, 0x7B, 0xAF, 0x0B, 0x7E, 0x73, 0x07, 0x00, 0x6D, 0x6D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0x0D, 0x7C, 0x6E, 0xCD, 0x0C, 0x82, 0x77, 0xFF, 0x0D, 0x88, 0x7B, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7E, 0x73, 0xFF, 0x0D, 0x87, 0x7A, 0xE7, 0x0C, 0x82, 0x76, 0x3B, 0x0C, 0x7D, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x0B, 0x7D, 0x71, 0xFA, 0x0C, 0x83, 0x78, 0xFF, 0x0D, 0x8A, 0x7D, 0xFF, 0x0C, 0x7D, 0x71, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0C, 0x81, 0x75, 0xFE, 0x0C, 0x83, 0x77, 0xF5, 0x0C, 0x83, 0x77, 0xFF, 0x0D, 0x83, 0x77, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0D, 0x88, 0x7B, 0xEA, 0x0B, 0x87, 0x78, 0x5B, 0x0B, 0x7E, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4A, 0x0A, 0x7F, 0x6E, 0xE2, 0x0C, 0x86, 0x78, 0xFF, 0x0D, 0x87, 0x7A, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x80, 0x73, 0xFE, 0x0C, 0x81, 0x75, 0xE4, 0x0B, 0x7E, 0x73, 
-    0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x80, 0x73, 0xFF, 0x0D, 0x89, 0x7B, 0xAF, 0x0B, 0x7E, 0x73, 0x07, 0x00, 0x6D, 0x6D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x09, 0x76, 0x6D, 0xB8, 0x0B, 0x83, 0x78, 0xFF, 0x0D, 0x8A, 0x7D, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x83, 0x77, 0xFC, 0x0B, 0x81, 0x75, 0x51, 0x0C, 0x7D, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x0D, 0x78, 0x6B, 0x76, 0x0C, 0x81, 0x74, 0xF7, 0x0C, 0x85, 0x77, 0xFF, 0x0D, 0x85, 0x78, 0xFF, 0x0C, 0x7E, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0C, 0x81, 0x75, 0xFF, 0x0D, 0x84, 0x78, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7E, 0x73, 0xFF, 0x0D, 0x87, 0x7B, 0xEA, 0x0D, 0x86, 0x78, 0x5B, 0x0B, 0x80, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x65, 0x0A, 0x7B, 0x6F, 0xF7, 0x0C, 0x83, 0x76, 0xFF, 0x0D, 0x85, 0x78, 0xFF, 0x0C, 0x7E, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x80, 0x74, 0xFC, 0x0D, 0x84, 0x78, 0xBF, 0x0A, 0x7E, 0x74, 
-    0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x80, 0x73, 0xFF, 0x0D, 0x89, 0x7C, 0xAB, 0x0B, 0x7E, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x0F, 0x6F, 0x6F, 0x9A, 0x0D, 0x86, 0x78, 0xFF, 0x0D, 0x8B, 0x7E, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0D, 0x89, 0x7C, 0x78, 0x0C, 0x81, 0x77, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x66, 0x66, 0x71, 0x0D, 0x80, 0x73, 0xF7, 0x0C, 0x85, 0x78, 0xFF, 0x0D, 0x86, 0x79, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0D, 0x87, 0x7B, 0xEA, 0x0D, 0x86, 0x78, 0x5A, 0x0E, 0x7F, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8B, 0x0C, 0x7E, 0x71, 0xFF, 0x0C, 0x87, 0x7A, 0xFF, 0x0C, 0x81, 0x75, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x81, 0x74, 0xFA, 0x0D, 0x87, 0x7A, 0x94, 0x0C, 0x81, 0x73, 
-    0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x80, 0x73, 0xFF, 0x0D, 0x88, 0x7A, 0xB6, 0x0C, 0x7E, 0x72, 0x1C, 0x09, 0x76, 0x76, 0x15, 0x0C, 0x79, 0x6D, 0x18, 0x0A, 0x7F, 0x74, 0x18, 0x0A, 0x7F, 0x74, 0x18, 0x0A, 0x7F, 0x74, 0x18, 0x0A, 0x7F, 0x74, 0x18, 0x0A, 0x7F, 0x74, 0x18, 0x0A, 0x7F, 0x74, 0x18, 0x0A, 0x7F, 0x74, 0x18, 0x0A, 0x7F, 0x74, 0x18, 0x0A, 0x7F, 0x74, 0x18, 0x0A, 0x7F, 0x74, 0x18, 0x0A, 0x7F, 0x74, 0x18, 0x0A, 0x7F, 0x74, 0x18, 0x0A, 0x7F, 0x74, 0x18, 0x0A, 0x7F, 0x74, 0x18, 0x0A, 0x7F, 0x74, 0x18, 0x0A, 0x7F, 0x74, 0x18, 0x0A, 0x7F, 0x74, 0x18, 0x0A, 0x7F, 0x74, 0x18, 0x0A, 0x7F, 0x74, 0x18, 0x0A, 0x7F, 0x74, 0x18, 0x0A, 0x7F, 0x74, 0x18, 0x0A, 0x7F, 0x74, 0x18, 0x0A, 0x7F, 0x74, 0x18, 0x0A, 0x7F, 0x74, 0x18, 0x0A, 0x7F, 0x74, 0x18, 0x0A, 0x7F, 0x74, 0x18, 0x0A, 0x7F, 0x74, 0x18, 0x0A, 0x7F, 0x74, 0x18, 0x0A, 0x7F, 0x74, 0x18, 0x0A, 0x7F, 0x74, 0x18, 0x0A, 0x7F, 0x74, 0x18, 0x0A, 0x7F, 0x74, 0x18, 0x0A, 0x7F, 0x74, 0x18, 0x0A, 0x7F, 0x74, 0x18, 0x0A, 0x7F, 0x74, 0x18, 0x0A, 0x7F, 0x74, 0x18, 0x0A, 0x7F, 0x74, 0x18, 0x0A, 0x7F, 0x74, 0x18, 0x0A, 0x7F, 0x74, 0x18, 0x0A, 0x7F, 0x74, 0x18, 0x0A, 0x7F, 0x74, 0x18, 0x0A, 0x7F, 0x74, 0x18, 0x0A, 0x7F, 0x74, 0x18, 0x0A, 0x7F, 0x74, 0x18, 0x0A, 0x7F, 0x74, 0x18, 0x0A, 0x7F, 0x74, 0x18, 0x0A, 0x7F, 0x74, 0x18, 0x0A, 0x7F, 0x74, 0x18, 0x0A, 0x7F, 0x74, 0x18, 0x0A, 0x7F, 0x74, 0x18, 0x0A, 0x7F, 0x74, 0x18, 0x0A, 0x7F, 0x74, 0x18, 0x0A, 0x7F, 0x74, 0x18, 0x0A, 0x7F, 0x74, 0x18, 0x0A, 0x7F, 0x74, 0x18, 0x0A, 0x7F, 0x74, 0x18, 0x0A, 0x7F, 0x74, 0x18, 0x0A, 0x7F, 0x74, 0x18, 0x0A, 0x7F, 0x74, 0x18, 0x0A, 0x7F, 0x74, 0x18, 0x0A, 0x7F, 0x74, 0x18, 0x0A, 0x7F, 0x74, 0x18, 0x0A, 0x7F, 0x74, 0x18, 0x0A, 0x7F, 0x74, 0x18, 0x0A, 0x7F, 0x74, 0x18, 0x0A, 0x7F, 0x74, 0x18, 0x0A, 0x7F, 0x74, 0x18, 0x0A, 0x7F, 0x74, 0x18, 0x0A, 0x7F, 0x74, 0x18, 0x0A, 0x7F, 0x74, 0x18, 0x0A, 0x7F, 0x74, 0x18, 0x0A, 0x7F, 0x74, 0x18, 0x0A, 0x7F, 0x74, 0x18, 0x0A, 0x7F, 0x74, 0x18, 0x0A, 0x7F, 0x74, 0x18, 0x0A, 0x7F, 0x74, 0x18, 0x0A, 0x7F, 0x74, 0x18, 0x0A, 0x7F, 0x74, 0x18, 0x0A, 0x7F, 0x74, 0x18, 0x0A, 0x7F, 0x74, 0x18, 0x0A, 0x7F, 0x74, 0x18, 0x0A, 0x7F, 0x74, 0x18, 0x0A, 0x7F, 0x74, 0x18, 0x0A, 0x7F, 0x74, 0x18, 0x0A, 0x7F, 0x74, 0x18, 0x0A, 0x7F, 0x74, 0x18, 0x0A, 0x7F, 0x74, 0x18, 0x0A, 0x7F, 0x74, 0x18, 0x0A, 0x7F, 0x74, 0x18, 0x0A, 0x7F, 0x74, 0x18, 0x0A, 0x7F, 0x74, 0x18, 0x0A, 0x7F, 0x74, 0x18, 0x0A, 0x7F, 0x74, 0x18, 0x0A, 0x7F, 0x74, 0x18, 0x0A, 0x7F, 0x74, 0x18, 0x0A, 0x7F, 0x74, 0x18, 0x0A, 0x7F, 0x74, 0x18, 0x0A, 0x7F, 0x74, 0x18, 0x0A, 0x7F, 0x74, 0x18, 0x0A, 0x7F, 0x74, 0x18, 0x0A, 0x7F, 0x74, 0x18, 0x0A, 0x7F, 0x74, 0x18, 0x0A, 0x7F, 0x74, 0x18, 0x0A, 0x8A, 0x7F, 0x0E, 0x12, 0x7F, 0x6D, 0x01, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x7F, 0x7F, 0x76, 0x0C, 0x83, 0x74, 0xFF, 0x0D, 0x89, 0x7C, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0D, 0x8B, 0x7E, 0xAD, 0x0D, 0x84, 0x78, 0x18, 0x0A, 0x74, 0x6A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x66, 0x66, 0x70, 0x0B, 0x7F, 0x74, 0xF8, 0x0C, 0x84, 0x77, 0xFF, 0x0D, 0x85, 0x78, 0xFF, 0x0C, 0x7E, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0D, 0x88, 0x7B, 0xE9, 0x0C, 0x85, 0x78, 0x59, 0x0B, 0x80, 0x72, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x0B, 0x6E, 0x6E, 0xB5, 0x0C, 0x85, 0x79, 0xFF, 0x0D, 0x8A, 0x7D, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x81, 0x75, 0xF9, 0x0D, 0x88, 0x7A, 0x64, 0x0C, 0x82, 0x75, 
-    0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x80, 0x74, 0xF3, 0x0C, 0x7E, 0x73, 0xD9, 0x0B, 0x7E, 0x73, 0xD7, 0x0A, 0x7E, 0x73, 0xD8, 0x0B, 0x7F, 0x72, 0xD8, 0x0B, 0x7F, 0x72, 0xD8, 0x0B, 0x7F, 0x72, 0xD8, 0x0B, 0x7F, 0x72, 0xD8, 0x0B, 0x7F, 0x72, 0xD8, 0x0B, 0x7F, 0x72, 0xD8, 0x0B, 0x7F, 0x72, 0xD8, 0x0B, 0x7F, 0x72, 0xD8, 0x0B, 0x7F, 0x72, 0xD8, 0x0B, 0x7F, 0x72, 0xD8, 0x0B, 0x7F, 0x72, 0xD8, 0x0B, 0x7F, 0x72, 0xD8, 0x0B, 0x7F, 0x72, 0xD8, 0x0B, 0x7F, 0x72, 0xD8, 0x0B, 0x7F, 0x72, 0xD8, 0x0B, 0x7F, 0x72, 0xD8, 0x0B, 0x7F, 0x72, 0xD8, 0x0B, 0x7F, 0x72, 0xD8, 0x0B, 0x7F, 0x72, 0xD8, 0x0B, 0x7F, 0x72, 0xD8, 0x0B, 0x7F, 0x72, 0xD8, 0x0B, 0x7F, 0x72, 0xD8, 0x0B, 0x7F, 0x72, 0xD8, 0x0B, 0x7F, 0x72, 0xD8, 0x0B, 0x7F, 0x72, 0xD8, 0x0B, 0x7F, 0x72, 0xD8, 0x0B, 0x7F, 0x72, 0xD8, 0x0B, 0x7F, 0x72, 0xD8, 0x0B, 0x7F, 0x72, 0xD8, 0x0B, 0x7F, 0x72, 0xD8, 0x0B, 0x7F, 0x72, 0xD8, 0x0B, 0x7F, 0x72, 0xD8, 0x0B, 0x7F, 0x72, 0xD8, 0x0B, 0x7F, 0x72, 0xD8, 0x0B, 0x7F, 0x72, 0xD8, 0x0B, 0x7F, 0x72, 0xD8, 0x0B, 0x7F, 0x72, 0xD8, 0x0B, 0x7F, 0x72, 0xD8, 0x0B, 0x7F, 0x72, 0xD8, 0x0B, 0x7F, 0x72, 0xD8, 0x0B, 0x7F, 0x72, 0xD8, 0x0B, 0x7F, 0x72, 0xD8, 0x0B, 0x7F, 0x72, 0xD8, 0x0B, 0x7F, 0x72, 0xD8, 0x0B, 0x7F, 0x72, 0xD8, 0x0B, 0x7F, 0x72, 0xD8, 0x0B, 0x7F, 0x72, 0xD8, 0x0B, 0x7F, 0x72, 0xD8, 0x0B, 0x7F, 0x72, 0xD8, 0x0B, 0x7F, 0x72, 0xD8, 0x0B, 0x7F, 0x72, 0xD8, 0x0B, 0x7F, 0x72, 0xD8, 0x0B, 0x7F, 0x72, 0xD8, 0x0B, 0x7F, 0x72, 0xD8, 0x0B, 0x7F, 0x72, 0xD8, 0x0B, 0x7F, 0x72, 0xD8, 0x0B, 0x7F, 0x72, 0xD8, 0x0B, 0x7F, 0x72, 0xD8, 0x0B, 0x7F, 0x72, 0xD8, 0x0B, 0x7F, 0x72, 0xD8, 0x0B, 0x7F, 0x72, 0xD8, 0x0B, 0x7F, 0x72, 0xD8, 0x0B, 0x7F, 0x72, 0xD8, 0x0B, 0x7F, 0x72, 0xD8, 0x0B, 0x7F, 0x72, 0xD8, 0x0B, 0x7F, 0x72, 0xD8, 0x0B, 0x7F, 0x72, 0xD8, 0x0B, 0x7F, 0x72, 0xD8, 0x0B, 0x7F, 0x72, 0xD8, 0x0B, 0x7F, 0x72, 0xD8, 0x0B, 0x7F, 0x72, 0xD8, 0x0B, 0x7F, 0x72, 0xD8, 0x0B, 0x7F, 0x72, 0xD8, 0x0B, 0x7F, 0x72, 0xD8, 0x0B, 0x7F, 0x72, 0xD8, 0x0B, 0x7F, 0x72, 0xD8, 0x0B, 0x7F, 0x72, 0xD8, 0x0B, 0x7F, 0x72, 0xD8, 0x0B, 0x7F, 0x72, 0xD8, 0x0B, 0x7F, 0x72, 0xD8, 0x0B, 0x7F, 0x72, 0xD8, 0x0B, 0x7F, 0x72, 0xD8, 0x0B, 0x7F, 0x72, 0xD8, 0x0B, 0x7F, 0x72, 0xD8, 0x0B, 0x7F, 0x72, 0xD8, 0x0B, 0x7F, 0x72, 0xD8, 0x0B, 0x7F, 0x72, 0xD8, 0x0B, 0x7F, 0x72, 0xD8, 0x0B, 0x7F, 0x72, 0xD8, 0x0B, 0x7F, 0x72, 0xD8, 0x0B, 0x7F, 0x72, 0xD8, 0x0B, 0x7F, 0x72, 0xD8, 0x0B, 0x7F, 0x72, 0xD8, 0x0B, 0x7F, 0x72, 0xD8, 0x0B, 0x7F, 0x72, 0xD8, 0x0B, 0x7F, 0x72, 0xD8, 0x0B, 0x7F, 0x72, 0xD8, 0x0B, 0x7F, 0x72, 0xD8, 0x0B, 0x7F, 0x72, 0xD8, 0x0B, 0x7F, 0x72, 0xD8, 0x0B, 0x7F, 0x72, 0xD8, 0x0B, 0x7F, 0x72, 0xD9, 0x0B, 0x7E, 0x71, 0xDB, 0x0B, 0x84, 0x79, 0xA3, 0x0A, 0x81, 0x73, 0x13, 0x0D, 0x78, 0x6B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4C, 0x0A, 0x7F, 0x75, 0xFD, 0x0B, 0x81, 0x74, 0xFF, 0x0C, 0x83, 0x77, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0D, 0x86, 0x79, 0xEA, 0x0B, 0x81, 0x75, 0x39, 0x08, 0x78, 0x6B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x66, 0x66, 0x70, 0x0D, 0x81, 0x74, 0xF8, 0x0C, 0x84, 0x77, 0xFF, 0x0D, 0x85, 0x78, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0D, 0x87, 0x7B, 0xE9, 0x0D, 0x85, 0x78, 0x59, 0x0B, 0x7E, 0x72, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4C, 0x0A, 0x78, 0x6E, 0xE5, 0x0C, 0x85, 0x78, 0xFF, 0x0D, 0x87, 0x7A, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x82, 0x76, 0xF7, 0x0C, 0x83, 0x76, 0x35, 0x0E, 0x81, 0x73, 
-    0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x81, 0x75, 0xFF, 0x0C, 0x85, 0x78, 0xFF, 0x0C, 0x85, 0x78, 0xFF, 0x0C, 0x85, 0x78, 0xFF, 0x0C, 0x85, 0x78, 0xFF, 0x0C, 0x85, 0x78, 0xFF, 0x0C, 0x85, 0x78, 0xFF, 0x0C, 0x85, 0x78, 0xFF, 0x0C, 0x85, 0x78, 0xFF, 0x0C, 0x85, 0x78, 0xFF, 0x0C, 0x85, 0x78, 0xFF, 0x0C, 0x85, 0x78, 0xFF, 0x0C, 0x85, 0x78, 0xFF, 0x0C, 0x85, 0x78, 0xFF, 0x0C, 0x85, 0x78, 0xFF, 0x0C, 0x85, 0x78, 0xFF, 0x0C, 0x85, 0x78, 0xFF, 0x0C, 0x85, 0x78, 0xFF, 0x0C, 0x85, 0x78, 0xFF, 0x0C, 0x85, 0x78, 0xFF, 0x0C, 0x85, 0x78, 0xFF, 0x0C, 0x85, 0x78, 0xFF, 0x0C, 0x85, 0x78, 0xFF, 0x0C, 0x85, 0x78, 0xFF, 0x0C, 0x85, 0x78, 0xFF, 0x0C, 0x85, 0x78, 0xFF, 0x0C, 0x85, 0x78, 0xFF, 0x0C, 0x85, 0x78, 0xFF, 0x0C, 0x85, 0x78, 0xFF, 0x0C, 0x85, 0x78, 0xFF, 0x0C, 0x85, 0x78, 0xFF, 0x0C, 0x85, 0x78, 0xFF, 0x0C, 0x85, 0x78, 0xFF, 0x0C, 0x85, 0x78, 0xFF, 0x0C, 0x85, 0x78, 0xFF, 0x0C, 0x85, 0x78, 0xFF, 0x0C, 0x85, 0x78, 0xFF, 0x0C, 0x85, 0x78, 0xFF, 0x0C, 0x85, 0x78, 0xFF, 0x0C, 0x85, 0x78, 0xFF, 0x0C, 0x85, 0x78, 0xFF, 0x0C, 0x85, 0x78, 0xFF, 0x0C, 0x85, 0x78, 0xFF, 0x0C, 0x85, 0x78, 0xFF, 0x0C, 0x85, 0x78, 0xFF, 0x0C, 0x85, 0x78, 0xFF, 0x0C, 0x85, 0x78, 0xFF, 0x0C, 0x85, 0x78, 0xFF, 0x0C, 0x85, 0x78, 0xFF, 0x0C, 0x85, 0x78, 0xFF, 0x0C, 0x85, 0x78, 0xFF, 0x0C, 0x85, 0x78, 0xFF, 0x0C, 0x85, 0x78, 0xFF, 0x0C, 0x85, 0x78, 0xFF, 0x0C, 0x85, 0x78, 0xFF, 0x0C, 0x85, 0x78, 0xFF, 0x0C, 0x85, 0x78, 0xFF, 0x0C, 0x85, 0x78, 0xFF, 0x0C, 0x85, 0x78, 0xFF, 0x0C, 0x85, 0x78, 0xFF, 0x0C, 0x85, 0x78, 0xFF, 0x0C, 0x85, 0x78, 0xFF, 0x0C, 0x85, 0x78, 0xFF, 0x0C, 0x85, 0x78, 0xFF, 0x0C, 0x85, 0x78, 0xFF, 0x0C, 0x85, 0x78, 0xFF, 0x0C, 0x85, 0x78, 0xFF, 0x0C, 0x85, 0x78, 0xFF, 0x0C, 0x85, 0x78, 0xFF, 0x0C, 0x85, 0x78, 0xFF, 0x0C, 0x85, 0x78, 0xFF, 0x0C, 0x85, 0x78, 0xFF, 0x0C, 0x85, 0x78, 0xFF, 0x0C, 0x85, 0x78, 0xFF, 0x0C, 0x85, 0x78, 0xFF, 0x0C, 0x85, 0x78, 0xFF, 0x0C, 0x85, 0x78, 0xFF, 0x0C, 0x85, 0x78, 0xFF, 0x0C, 0x85, 0x78, 0xFF, 0x0C, 0x85, 0x78, 0xFF, 0x0C, 0x85, 0x78, 0xFF, 0x0C, 0x85, 0x78, 0xFF, 0x0C, 0x85, 0x78, 0xFF, 0x0C, 0x85, 0x78, 0xFF, 0x0C, 0x85, 0x78, 0xFF, 0x0C, 0x85, 0x78, 0xFF, 0x0C, 0x85, 0x78, 0xFF, 0x0C, 0x85, 0x78, 0xFF, 0x0C, 0x85, 0x78, 0xFF, 0x0C, 0x85, 0x78, 0xFF, 0x0C, 0x85, 0x78, 0xFF, 0x0C, 0x85, 0x78, 0xFF, 0x0C, 0x85, 0x78, 0xFF, 0x0C, 0x85, 0x78, 0xFF, 0x0C, 0x85, 0x78, 0xFF, 0x0C, 0x85, 0x78, 0xFF, 0x0C, 0x85, 0x78, 0xFF, 0x0C, 0x85, 0x78, 0xFF, 0x0C, 0x85, 0x78, 0xFF, 0x0C, 0x85, 0x78, 0xFF, 0x0C, 0x85, 0x78, 0xFF, 0x0C, 0x85, 0x78, 0xFF, 0x0C, 0x85, 0x78, 0xFF, 0x0C, 0x85, 0x78, 0xFF, 0x0C, 0x85, 0x78, 0xFF, 0x0C, 0x85, 0x78, 0xFF, 0x0D, 0x8B, 0x7E, 0xEB, 0x0B, 0x81, 0x73, 0x25, 0x0D, 0x7C, 0x6E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2D, 0x0B, 0x76, 0x71, 0xD6, 0x0B, 0x83, 0x77, 0xFF, 0x0D, 0x88, 0x7B, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0D, 0x89, 0x7C, 0x7B, 0x0C, 0x82, 0x76, 0x04, 0x00, 0x7F, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x99, 0x66, 0x70, 0x0B, 0x7F, 0x74, 0xF8, 0x0D, 0x84, 0x77, 0xFF, 0x0D, 0x86, 0x79, 0xFF, 0x0C, 0x7E, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0D, 0x88, 0x7B, 0xE9, 0x0D, 0x85, 0x79, 0x5A, 0x0E, 0x7C, 0x74, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x8C, 0x0C, 0x7F, 0x72, 0xFE, 0x0D, 0x88, 0x7C, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x85, 0x79, 0xDB, 0x0B, 0x80, 0x73, 0x11, 0x0F, 0x87, 0x78, 
-    0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x80, 0x73, 0xFF, 0x0C, 0x80, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x82, 0x76, 0xFE, 0x0C, 0x81, 0x75, 0x4B, 0x0A, 0x7D, 0x73, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x0F, 0x7F, 0x6F, 0x99, 0x0D, 0x85, 0x77, 0xFF, 0x0D, 0x8B, 0x7E, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0D, 0x88, 0x7B, 0xD6, 0x0D, 0x84, 0x75, 0x2B, 0x0B, 0x7C, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x66, 0x66, 0x70, 0x0B, 0x81, 0x74, 0xF6, 0x0D, 0x85, 0x78, 0xFF, 0x0D, 0x86, 0x79, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0D, 0x88, 0x7C, 0xE8, 0x0D, 0x86, 0x78, 0x59, 0x0B, 0x80, 0x75, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x0D, 0x78, 0x6F, 0xD4, 0x0D, 0x86, 0x79, 0xFF, 0x0D, 0x8A, 0x7D, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0D, 0x89, 0x7C, 0x9D, 0x0C, 0x81, 0x74, 0x05, 0x00, 0x66, 0x66, 
-    0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0D, 0x88, 0x7B, 0x82, 0x0B, 0x81, 0x75, 0x06, 0x00, 0x55, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5A, 0x0B, 0x7C, 0x71, 0xFC, 0x0C, 0x83, 0x78, 0xFF, 0x0C, 0x83, 0x76, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0D, 0x89, 0x7D, 0x82, 0x0B, 0x83, 0x77, 0x04, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x66, 0x66, 0x6F, 0x0B, 0x80, 0x72, 0xF4, 0x0C, 0x86, 0x79, 0xFF, 0x0D, 0x86, 0x79, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0D, 0x89, 0x7C, 0xE8, 0x0C, 0x86, 0x78, 0x59, 0x0E, 0x7E, 0x75, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x7F, 0x7F, 0x8F, 0x0C, 0x80, 0x75, 0xFF, 0x0D, 0x89, 0x7D, 0xFF, 0x0C, 0x81, 0x75, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x82, 0x75, 0xFD, 0x0D, 0x84, 0x77, 0x50, 0x0C, 0x7F, 0x75, 0x00, 0x00, 0x00, 0x00, 
-    0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x80, 0x73, 0xFF, 0x0D, 0x87, 0x7A, 0xC2, 0x0B, 0x7F, 0x73, 0x12, 0x0E, 0x71, 0x63, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x0D, 0x78, 0x6B, 0xC6, 0x0B, 0x84, 0x77, 0xFF, 0x0D, 0x8B, 0x7D, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0D, 0x85, 0x79, 0xEC, 0x0B, 0x84, 0x79, 0x42, 0x0B, 0x7F, 0x73, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x7F, 0x3F, 0x70, 0x0B, 0x81, 0x74, 0xF3, 0x0C, 0x86, 0x79, 0xFF, 0x0D, 0x8F, 0x82, 0xE7, 0x0C, 0x86, 0x79, 0x58, 0x0B, 0x82, 0x73, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0x0C, 0x7D, 0x71, 0xEA, 0x0B, 0x86, 0x7A, 0xFF, 0x0D, 0x87, 0x7A, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0D, 0x88, 0x7B, 0xCD, 0x0C, 0x80, 0x74, 0x18, 0x0A, 0x74, 0x6A, 0x00, 0x00, 0x00, 0x00, 
-    0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x83, 0x77, 0xF3, 0x0B, 0x82, 0x74, 0x36, 0x0E, 0x7F, 0x71, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x76, 0x0A, 0x81, 0x76, 0xFE, 0x0D, 0x88, 0x7C, 0xFF, 0x0C, 0x81, 0x75, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0D, 0x89, 0x7C, 0xC2, 0x0B, 0x84, 0x77, 0x24, 0x0E, 0x78, 0x71, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x55, 0x55, 0x7A, 0x0C, 0x83, 0x75, 0xD8, 0x0B, 0x88, 0x7B, 0x60, 0x0A, 0x7F, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2C, 0x0B, 0x79, 0x6E, 0xC3, 0x0D, 0x87, 0x79, 0xFF, 0x0D, 0x8A, 0x7D, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x81, 0x75, 0xFF, 0x0D, 0x88, 0x7B, 0x6C, 0x0B, 0x84, 0x76, 0x04, 0x00, 0x7F, 0x3F, 0x00, 0x00, 0x00, 0x00, 
-    0xFF, 0x0D, 0x87, 0x7B, 0xFF, 0x0D, 0x87, 0x7B, 0xFF, 0x0D, 0x87, 0x7B, 0xFF, 0x0D, 0x87, 0x7B, 0xFF, 0x0D, 0x87, 0x7B, 0xFF, 0x0D, 0x87, 0x7B, 0xFF, 0x0D, 0x87, 0x7B, 0xFF, 0x0D, 0x87, 0x7B, 0xFF, 0x0D, 0x87, 0x7B, 0xFF, 0x0D, 0x87, 0x7B, 0xFF, 0x0D, 0x87, 0x7B, 0xFF, 0x0D, 0x87, 0x7B, 0xFF, 0x0D, 0x87, 0x7B, 0xFF, 0x0D, 0x87, 0x7B, 0xFF, 0x0D, 0x87, 0x7B, 0xFF, 0x0D, 0x87, 0x7B, 0xFF, 0x0D, 0x87, 0x7B, 0xFF, 0x0D, 0x87, 0x7B, 0xFF, 0x0D, 0x87, 0x7B, 0xFF, 0x0D, 0x87, 0x7B, 0xFF, 0x0D, 0x87, 0x7B, 0xFF, 0x0D, 0x87, 0x7B, 0xFF, 0x0D, 0x87, 0x7B, 0xFF, 0x0D, 0x87, 0x7B, 0xFF, 0x0D, 0x87, 0x7B, 0xFF, 0x0D, 0x87, 0x7B, 0xFF, 0x0D, 0x87, 0x7B, 0xFF, 0x0D, 0x87, 0x7B, 0xFF, 0x0D, 0x87, 0x7B, 0xFF, 0x0D, 0x87, 0x7B, 0xFF, 0x0D, 0x87, 0x7B, 0xFF, 0x0D, 0x87, 0x7B, 0xFF, 0x0D, 0x87, 0x7B, 0xFF, 0x0D, 0x87, 0x7B, 0xFF, 0x0D, 0x87, 0x7B, 0xFF, 0x0D, 0x87, 0x7B, 0xFF, 0x0D, 0x87, 0x7B, 0xFF, 0x0D, 0x87, 0x7B, 0xFF, 0x0D, 0x87, 0x7B, 0xFF, 0x0D, 0x87, 0x7B, 0xFF, 0x0D, 0x87, 0x7B, 0xFF, 0x0D, 0x87, 0x7B, 0xFF, 0x0D, 0x87, 0x7B, 0xFF, 0x0D, 0x87, 0x7B, 0xFF, 0x0D, 0x87, 0x7B, 0xFF, 0x0D, 0x87, 0x7B, 0xFF, 0x0D, 0x87, 0x7B, 0xFF, 0x0D, 0x87, 0x7B, 0xFF, 0x0D, 0x87, 0x7B, 0xFF, 0x0D, 0x87, 0x7B, 0xFF, 0x0D, 0x87, 0x7B, 0xFF, 0x0D, 0x87, 0x7B, 0xFF, 0x0D, 0x87, 0x7B, 0xFF, 0x0D, 0x87, 0x7B, 0xFF, 0x0D, 0x87, 0x7B, 0xFF, 0x0D, 0x87, 0x7B, 0xFF, 0x0D, 0x87, 0x7B, 0xFF, 0x0D, 0x87, 0x7B, 0xFF, 0x0D, 0x87, 0x7B, 0xFF, 0x0D, 0x87, 0x7B, 0xFF, 0x0D, 0x87, 0x7B, 0xFF, 0x0D, 0x87, 0x7B, 0xFF, 0x0D, 0x87, 0x7B, 0xFF, 0x0D, 0x87, 0x7B, 0xFF, 0x0D, 0x87, 0x7B, 0xFF, 0x0D, 0x87, 0x7B, 0xFF, 0x0D, 0x87, 0x7B, 0xFF, 0x0D, 0x87, 0x7B, 0xFF, 0x0D, 0x87, 0x7B, 0xFF, 0x0D, 0x87, 0x7B, 0xFF, 0x0D, 0x87, 0x7B, 0xFF, 0x0D, 0x87, 0x7B, 0xFF, 0x0D, 0x87, 0x7B, 0xFF, 0x0D, 0x87, 0x7B, 0xFF, 0x0D, 0x87, 0x7B, 0xFF, 0x0D, 0x87, 0x7B, 0xFF, 0x0D, 0x87, 0x7B, 0xFF, 0x0D, 0x87, 0x7B, 0xFF, 0x0D, 0x87, 0x7B, 0xFF, 0x0D, 0x87, 0x7B, 0xFF, 0x0D, 0x87, 0x7B, 0xFF, 0x0D, 0x87, 0x7B, 0xFF, 0x0D, 0x87, 0x7B, 0xFF, 0x0D, 0x87, 0x7B, 0xFF, 0x0D, 0x87, 0x7B, 0xFF, 0x0D, 0x87, 0x7B, 0xFF, 0x0D, 0x87, 0x7B, 0xFF, 0x0D, 0x87, 0x7B, 0xFF, 0x0D, 0x87, 0x7B, 0xFF, 0x0D, 0x87, 0x7B, 0xFF, 0x0D, 0x87, 0x7B, 0xFF, 0x0D, 0x87, 0x7B, 0xFF, 0x0D, 0x87, 0x7B, 0xFF, 0x0D, 0x87, 0x7B, 0xFF, 0x0D, 0x87, 0x7B, 0xFF, 0x0D, 0x87, 0x7B, 0xFF, 0x0D, 0x87, 0x7B, 0xFF, 0x0D, 0x87, 0x7B, 0xFF, 0x0D, 0x87, 0x7B, 0xFF, 0x0D, 0x87, 0x7B, 0xFF, 0x0D, 0x87, 0x7B, 0xFF, 0x0D, 0x87, 0x7B, 0xFF, 0x0D, 0x87, 0x7B, 0xFF, 0x0D, 0x87, 0x7B, 0xFF, 0x0D, 0x87, 0x7B, 0xFF, 0x0D, 0x87, 0x7B, 0xFF, 0x0D, 0x87, 0x7B, 0xFF, 0x0D, 0x87, 0x7B, 0xFF, 0x0D, 0x87, 0x7B, 0xFF, 0x0D, 0x87, 0x7B, 0xFF, 0x0D, 0x87, 0x7B, 0xFF, 0x0D, 0x87, 0x7B, 0xFF, 0x0D, 0x87, 0x7B, 0xFF, 0x0D, 0x87, 0x7B, 0xFF, 0x0D, 0x89, 0x7C, 0xFF, 0x0E, 0x90, 0x82, 0x91, 0x0C, 0x82, 0x75, 0x07, 0x00, 0x6D, 0x6D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2B, 0x0B, 0x76, 0x70, 0xD0, 0x0C, 0x83, 0x76, 0xFF, 0x0D, 0x8B, 0x7D, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0D, 0x89, 0x7C, 0xA4, 0x0C, 0x84, 0x77, 0x16, 0x0B, 0x7F, 0x73, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x7F, 0x7F, 0x23, 0x07, 0x7B, 0x6D, 0x06, 0x00, 0x55, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x0A, 0x70, 0x70, 0xAA, 0x0C, 0x82, 0x76, 0xFF, 0x0D, 0x8B, 0x7D, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0D, 0x88, 0x7B, 0xD4, 0x0D, 0x81, 0x73, 0x1F, 0x08, 0x7B, 0x6A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0xBE, 0x0C, 0x7E, 0x72, 0xBE, 0x0C, 0x7E, 0x72, 0xBE, 0x0C, 0x7E, 0x72, 0xBE, 0x0C, 0x7E, 0x72, 0xBE, 0x0C, 0x7E, 0x72, 0xBE, 0x0C, 0x7E, 0x72, 0xBE, 0x0C, 0x7E, 0x72, 0xBE, 0x0C, 0x7E, 0x72, 0xBE, 0x0C, 0x7E, 0x72, 0xBE, 0x0C, 0x7E, 0x72, 0xBE, 0x0C, 0x7E, 0x72, 0xBE, 0x0C, 0x7E, 0x72, 0xBE, 0x0C, 0x7E, 0x72, 0xBE, 0x0C, 0x7E, 0x72, 0xBE, 0x0C, 0x7E, 0x72, 0xBE, 0x0C, 0x7E, 0x72, 0xBE, 0x0C, 0x7E, 0x72, 0xBE, 0x0C, 0x7E, 0x72, 0xBE, 0x0C, 0x7E, 0x72, 0xBE, 0x0C, 0x7E, 0x72, 0xBE, 0x0C, 0x7E, 0x72, 0xBE, 0x0C, 0x7E, 0x72, 0xBE, 0x0C, 0x7E, 0x72, 0xBE, 0x0C, 0x7E, 0x72, 0xBE, 0x0C, 0x7E, 0x72, 0xBE, 0x0C, 0x7E, 0x72, 0xBE, 0x0C, 0x7E, 0x72, 0xBE, 0x0C, 0x7E, 0x72, 0xBE, 0x0C, 0x7E, 0x72, 0xBE, 0x0C, 0x7E, 0x72, 0xBE, 0x0C, 0x7E, 0x72, 0xBE, 0x0C, 0x7E, 0x72, 0xBE, 0x0C, 0x7E, 0x72, 0xBE, 0x0C, 0x7E, 0x72, 0xBE, 0x0C, 0x7E, 0x72, 0xBE, 0x0C, 0x7E, 0x72, 0xBE, 0x0C, 0x7E, 0x72, 0xBE, 0x0C, 0x7E, 0x72, 0xBE, 0x0C, 0x7E, 0x72, 0xBE, 0x0C, 0x7E, 0x72, 0xBE, 0x0C, 0x7E, 0x72, 0xBE, 0x0C, 0x7E, 0x72, 0xBE, 0x0C, 0x7E, 0x72, 0xBE, 0x0C, 0x7E, 0x72, 0xBE, 0x0C, 0x7E, 0x72, 0xBE, 0x0C, 0x7E, 0x72, 0xBE, 0x0C, 0x7E, 0x72, 0xBE, 0x0C, 0x7E, 0x72, 0xBE, 0x0C, 0x7E, 0x72, 0xBE, 0x0C, 0x7E, 0x72, 0xBE, 0x0C, 0x7E, 0x72, 0xBE, 0x0C, 0x7E, 0x72, 0xBE, 0x0C, 0x7E, 0x72, 0xBE, 0x0C, 0x7E, 0x72, 0xBE, 0x0C, 0x7E, 0x72, 0xBE, 0x0C, 0x7E, 0x72, 0xBE, 0x0C, 0x7E, 0x72, 0xBE, 0x0C, 0x7E, 0x72, 0xBE, 0x0C, 0x7E, 0x72, 0xBE, 0x0C, 0x7E, 0x72, 0xBE, 0x0C, 0x7E, 0x72, 0xBE, 0x0C, 0x7E, 0x72, 0xBE, 0x0C, 0x7E, 0x72, 0xBE, 0x0C, 0x7E, 0x72, 0xBE, 0x0C, 0x7E, 0x72, 0xBE, 0x0C, 0x7E, 0x72, 0xBE, 0x0C, 0x7E, 0x72, 0xBE, 0x0C, 0x7E, 0x72, 0xBE, 0x0C, 0x7E, 0x72, 0xBE, 0x0C, 0x7E, 0x72, 0xBE, 0x0C, 0x7E, 0x72, 0xBE, 0x0C, 0x7E, 0x72, 0xBE, 0x0C, 0x7E, 0x72, 0xBE, 0x0C, 0x7E, 0x72, 0xBE, 0x0C, 0x7E, 0x72, 0xBE, 0x0C, 0x7E, 0x72, 0xBE, 0x0C, 0x7E, 0x72, 0xBE, 0x0C, 0x7E, 0x72, 0xBE, 0x0C, 0x7E, 0x72, 0xBE, 0x0C, 0x7E, 0x72, 0xBE, 0x0C, 0x7E, 0x72, 0xBE, 0x0C, 0x7E, 0x72, 0xBE, 0x0C, 0x7E, 0x72, 0xBE, 0x0C, 0x7E, 0x72, 0xBE, 0x0C, 0x7E, 0x72, 0xBE, 0x0C, 0x7E, 0x72, 0xBE, 0x0C, 0x7E, 0x72, 0xBE, 0x0C, 0x7E, 0x72, 0xBE, 0x0C, 0x7E, 0x72, 0xBE, 0x0C, 0x7E, 0x72, 0xBE, 0x0C, 0x7E, 0x72, 0xBE, 0x0C, 0x7E, 0x72, 0xBE, 0x0C, 0x7E, 0x72, 0xBE, 0x0C, 0x7E, 0x72, 0xBE, 0x0C, 0x7E, 0x72, 0xBE, 0x0C, 0x7E, 0x72, 0xBE, 0x0C, 0x7E, 0x72, 0xBE, 0x0C, 0x7E, 0x72, 0xBE, 0x0C, 0x7E, 0x72, 0xBE, 0x0C, 0x7E, 0x72, 0xBE, 0x0C, 0x7E, 0x72, 0xBE, 0x0C, 0x7E, 0x72, 0xBE, 0x0C, 0x7E, 0x72, 0xBE, 0x0C, 0x7E, 0x72, 0xBE, 0x0C, 0x7E, 0x72, 0xBE, 0x0C, 0x7E, 0x72, 0xBE, 0x0C, 0x7E, 0x72, 0xBE, 0x0C, 0x7E, 0x72, 0xBE, 0x0C, 0x7E, 0x72, 0xBE, 0x0C, 0x7E, 0x72, 0xBE, 0x0C, 0x7E, 0x72, 0xBE, 0x0C, 0x7E, 0x72, 0xBE, 0x0C, 0x7E, 0x72, 0xBE, 0x0C, 0x7E, 0x72, 0xBF, 0x0C, 0x7D, 0x71, 0xC0, 0x0D, 0x84, 0x77, 0x96, 0x0A, 0x81, 0x73, 0x0D, 0x00, 0x75, 0x75, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x0B, 0x7F, 0x71, 0xF9, 0x0C, 0x89, 0x7C, 0xFF, 0x0C, 0x84, 0x77, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x82, 0x76, 0xFF, 0x0D, 0x88, 0x7A, 0x9B, 0x0B, 0x81, 0x76, 0x18, 0x0A, 0x7F, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0x09, 0x71, 0x67, 0xA3, 0x0A, 0x81, 0x76, 0xFF, 0x0D, 0x89, 0x7C, 0xFF, 0x0C, 0x81, 0x75, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x82, 0x76, 0xFD, 0x0C, 0x88, 0x7A, 0x62, 0x0D, 0x84, 0x77, 0x03, 0x00, 0x55, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x0C, 0x15, 0x7F, 0x6A, 0x0C, 0x15, 0x7F, 0x6A, 0x0C, 0x15, 0x7F, 0x6A, 0x0C, 0x15, 0x7F, 0x6A, 0x0C, 0x15, 0x7F, 0x6A, 0x0C, 0x15, 0x7F, 0x6A, 0x0C, 0x15, 0x7F, 0x6A, 0x0C, 0x15, 0x7F, 0x6A, 0x0C, 0x15, 0x7F, 0x6A, 0x0C, 0x15, 0x7F, 0x6A, 0x0C, 0x15, 0x7F, 0x6A, 0x0C, 0x15, 0x7F, 0x6A, 0x0C, 0x15, 0x7F, 0x6A, 0x0C, 0x15, 0x7F, 0x6A, 0x0C, 0x15, 0x7F, 0x6A, 0x0C, 0x15, 0x7F, 0x6A, 0x0C, 0x15, 0x7F, 0x6A, 0x0C, 0x15, 0x7F, 0x6A, 0x0C, 0x15, 0x7F, 0x6A, 0x0C, 0x15, 0x7F, 0x6A, 0x0C, 0x15, 0x7F, 0x6A, 0x0C, 0x15, 0x7F, 0x6A, 0x0C, 0x15, 0x7F, 0x6A, 0x0C, 0x15, 0x7F, 0x6A, 0x0C, 0x15, 0x7F, 0x6A, 0x0C, 0x15, 0x7F, 0x6A, 0x0C, 0x15, 0x7F, 0x6A, 0x0C, 0x15, 0x7F, 0x6A, 0x0C, 0x15, 0x7F, 0x6A, 0x0C, 0x15, 0x7F, 0x6A, 0x0C, 0x15, 0x7F, 0x6A, 0x0C, 0x15, 0x7F, 0x6A, 0x0C, 0x15, 0x7F, 0x6A, 0x0C, 0x15, 0x7F, 0x6A, 0x0C, 0x15, 0x7F, 0x6A, 0x0C, 0x15, 0x7F, 0x6A, 0x0C, 0x15, 0x7F, 0x6A, 0x0C, 0x15, 0x7F, 0x6A, 0x0C, 0x15, 0x7F, 0x6A, 0x0C, 0x15, 0x7F, 0x6A, 0x0C, 0x15, 0x7F, 0x6A, 0x0C, 0x15, 0x7F, 0x6A, 0x0C, 0x15, 0x7F, 0x6A, 0x0C, 0x15, 0x7F, 0x6A, 0x0C, 0x15, 0x7F, 0x6A, 0x0C, 0x15, 0x7F, 0x6A, 0x0C, 0x15, 0x7F, 0x6A, 0x0C, 0x15, 0x7F, 0x6A, 0x0C, 0x15, 0x7F, 0x6A, 0x0C, 0x15, 0x7F, 0x6A, 0x0C, 0x15, 0x7F, 0x6A, 0x0C, 0x15, 0x7F, 0x6A, 0x0C, 0x15, 0x7F, 0x6A, 0x0C, 0x15, 0x7F, 0x6A, 0x0C, 0x15, 0x7F, 0x6A, 0x0C, 0x15, 0x7F, 0x6A, 0x0C, 0x15, 0x7F, 0x6A, 0x0C, 0x15, 0x7F, 0x6A, 0x0C, 0x15, 0x7F, 0x6A, 0x0C, 0x15, 0x7F, 0x6A, 0x0C, 0x15, 0x7F, 0x6A, 0x0C, 0x15, 0x7F, 0x6A, 0x0C, 0x15, 0x7F, 0x6A, 0x0C, 0x15, 0x7F, 0x6A, 0x0C, 0x15, 0x7F, 0x6A, 0x0C, 0x15, 0x7F, 0x6A, 0x0C, 0x15, 0x7F, 0x6A, 0x0C, 0x15, 0x7F, 0x6A, 0x0C, 0x15, 0x7F, 0x6A, 0x0C, 0x15, 0x7F, 0x6A, 0x0C, 0x15, 0x7F, 0x6A, 0x0C, 0x15, 0x7F, 0x6A, 0x0C, 0x15, 0x7F, 0x6A, 0x0C, 0x15, 0x7F, 0x6A, 0x0C, 0x15, 0x7F, 0x6A, 0x0C, 0x15, 0x7F, 0x6A, 0x0C, 0x15, 0x7F, 0x6A, 0x0C, 0x15, 0x7F, 0x6A, 0x0C, 0x15, 0x7F, 0x6A, 0x0C, 0x15, 0x7F, 0x6A, 0x0C, 0x15, 0x7F, 0x6A, 0x0C, 0x15, 0x7F, 0x6A, 0x0C, 0x15, 0x7F, 0x6A, 0x0C, 0x15, 0x7F, 0x6A, 0x0C, 0x15, 0x7F, 0x6A, 0x0C, 0x15, 0x7F, 0x6A, 0x0C, 0x15, 0x7F, 0x6A, 0x0C, 0x15, 0x7F, 0x6A, 0x0C, 0x15, 0x7F, 0x6A, 0x0C, 0x15, 0x7F, 0x6A, 0x0C, 0x15, 0x7F, 0x6A, 0x0C, 0x15, 0x7F, 0x6A, 0x0C, 0x15, 0x7F, 0x6A, 0x0C, 0x15, 0x7F, 0x6A, 0x0C, 0x15, 0x7F, 0x6A, 0x0C, 0x15, 0x7F, 0x6A, 0x0C, 0x15, 0x7F, 0x6A, 0x0C, 0x15, 0x7F, 0x6A, 0x0C, 0x15, 0x7F, 0x6A, 0x0C, 0x15, 0x7F, 0x6A, 0x0C, 0x15, 0x7F, 0x6A, 0x0C, 0x15, 0x7F, 0x6A, 0x0C, 0x15, 0x7F, 0x6A, 0x0C, 0x15, 0x7F, 0x6A, 0x0C, 0x15, 0x7F, 0x6A, 0x0C, 0x15, 0x7F, 0x6A, 0x0C, 0x15, 0x7F, 0x6A, 0x0C, 0x15, 0x7F, 0x6A, 0x0C, 0x15, 0x7F, 0x6A, 0x0C, 0x15, 0x7F, 0x6A, 0x0C, 0x15, 0x7F, 0x6A, 0x0C, 0x15, 0x7F, 0x6A, 0x0C, 0x15, 0x7F, 0x6A, 0x0C, 0x15, 0x7F, 0x6A, 0x0B, 0x17, 0x8B, 0x73, 0x0D, 0x13, 0x62, 0x62, 0x10, 0x0F, 0x7F, 0x6F, 0x03, 0x00, 0x55, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1D, 0x08, 0x72, 0x69, 0xB4, 0x0B, 0x85, 0x78, 0xFF, 0x0D, 0x8D, 0x7F, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7E, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x83, 0x76, 0xFF, 0x0C, 0x88, 0x7B, 0xA5, 0x0C, 0x84, 0x78, 0x28, 0x0C, 0x7F, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x0A, 0x77, 0x6C, 0xAC, 0x0B, 0x85, 0x76, 0xFF, 0x0C, 0x89, 0x7C, 0xFF, 0x0D, 0x82, 0x75, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0D, 0x8B, 0x7F, 0xB3, 0x0B, 0x81, 0x76, 0x13, 0x0D, 0x6B, 0x6B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x0B, 0x7D, 0x71, 0xE5, 0x0C, 0x84, 0x78, 0xFF, 0x0D, 0x8A, 0x7D, 0xFF, 0x0C, 0x7E, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x82, 0x76, 0xFF, 0x0D, 0x8A, 0x7D, 0xC2, 0x0D, 0x87, 0x7A, 0x4B, 0x0A, 0x81, 0x76, 0x06, 0x00, 0x7F, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x7F, 0x5F, 0x53, 0x0C, 0x84, 0x77, 0xC9, 0x0C, 0x85, 0x79, 0xFF, 0x0D, 0x8A, 0x7C, 0xFF, 0x0C, 0x81, 0x75, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0D, 0x8A, 0x7C, 0xE1, 0x0C, 0x85, 0x79, 0x39, 0x0D, 0x81, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6E, 0x0D, 0x7F, 0x73, 0xF2, 0x0C, 0x8B, 0x7D, 0xFF, 0x0D, 0x87, 0x7A, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0D, 0x8A, 0x7D, 0xE9, 0x0D, 0x86, 0x79, 0x90, 0x0C, 0x83, 0x76, 0x3A, 0x0D, 0x7F, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x7F, 0x7F, 0x3D, 0x0C, 0x7D, 0x70, 0x94, 0x0C, 0x82, 0x78, 0xEC, 0x0C, 0x85, 0x7A, 0xFF, 0x0D, 0x8A, 0x7D, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0D, 0x86, 0x79, 0xF3, 0x0C, 0x8A, 0x7C, 0x66, 0x0C, 0x82, 0x75, 0x04, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x6D, 0x5B, 0x8D, 0x0C, 0x82, 0x75, 0xFB, 0x0D, 0x8B, 0x7D, 0xFF, 0x0D, 0x85, 0x78, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0D, 0x87, 0x7A, 0xFF, 0x0D, 0x89, 0x7C, 0xD5, 0x0D, 0x87, 0x7B, 0x90, 0x0C, 0x81, 0x74, 0x4E, 0x09, 0x7F, 0x72, 0x1C, 0x09, 0x7F, 0x6D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x10, 0x7B, 0x73, 0x50, 0x0C, 0x7F, 0x72, 0x94, 0x0C, 0x81, 0x76, 0xD9, 0x0C, 0x85, 0x79, 0xFF, 0x0D, 0x88, 0x7D, 0xFF, 0x0D, 0x86, 0x7A, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0D, 0x84, 0x78, 0xFE, 0x0D, 0x88, 0x7C, 0x87, 0x0D, 0x80, 0x75, 0x0C, 0x15, 0x55, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x0B, 0x6E, 0x63, 0x9C, 0x0B, 0x84, 0x77, 0xFF, 0x0D, 0x8B, 0x7D, 0xFF, 0x0D, 0x84, 0x78, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0C, 0x81, 0x75, 0xFF, 0x0D, 0x89, 0x7C, 0xFF, 0x0C, 0x88, 0x7B, 0xE8, 0x0C, 0x84, 0x78, 0xBA, 0x0C, 0x86, 0x7A, 0x92, 0x0C, 0x7F, 0x73, 0x6C, 0x0B, 0x7F, 0x71, 0x54, 0x0C, 0x7F, 0x70, 0x42, 0x0B, 0x7B, 0x70, 0x39, 0x0D, 0x7D, 0x6F, 0x39, 0x0D, 0x7D, 0x6F, 0x43, 0x0B, 0x7D, 0x72, 0x56, 0x0B, 0x7C, 0x70, 0x6E, 0x0B, 0x7D, 0x6F, 0x93, 0x0C, 0x80, 0x72, 0xBC, 0x0D, 0x86, 0x7A, 0xEA, 0x0B, 0x86, 0x78, 0xFF, 0x0D, 0x88, 0x7C, 0xFF, 0x0D, 0x88, 0x7C, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0D, 0x84, 0x78, 0xFF, 0x0D, 0x8A, 0x7D, 0x98, 0x0B, 0x82, 0x75, 0x11, 0x0F, 0x78, 0x69, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x09, 0x75, 0x62, 0x9C, 0x0B, 0x86, 0x78, 0xFF, 0x0D, 0x8A, 0x7C, 0xFF, 0x0D, 0x85, 0x79, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0D, 0x87, 0x7A, 0xFF, 0x0D, 0x8A, 0x7D, 0xFF, 0x0C, 0x87, 0x7A, 0xFB, 0x0C, 0x83, 0x75, 0xE9, 0x0D, 0x85, 0x78, 0xDB, 0x0C, 0x85, 0x7A, 0xD4, 0x0D, 0x86, 0x79, 0xD4, 0x0D, 0x86, 0x79, 0xDC, 0x0C, 0x86, 0x79, 0xEA, 0x0D, 0x86, 0x77, 0xFC, 0x0C, 0x83, 0x76, 0xFF, 0x0C, 0x88, 0x7A, 0xFF, 0x0D, 0x8A, 0x7C, 0xFF, 0x0D, 0x86, 0x7A, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0D, 0x86, 0x79, 0xFF, 0x0D, 0x89, 0x7C, 0x99, 0x0B, 0x83, 0x76, 0x15, 0x0C, 0x79, 0x6D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x0B, 0x73, 0x68, 0x8B, 0x0C, 0x84, 0x77, 0xFA, 0x0D, 0x86, 0x79, 0xFF, 0x0D, 0x89, 0x7C, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x84, 0x77, 0xFF, 0x0D, 0x86, 0x7A, 0xFF, 0x0D, 0x88, 0x7B, 0xFF, 0x0D, 0x89, 0x7C, 0xFF, 0x0D, 0x89, 0x7C, 0xFF, 0x0D, 0x88, 0x7B, 0xFF, 0x0D, 0x86, 0x7A, 0xFF, 0x0D, 0x84, 0x77, 0xFF, 0x0C, 0x81, 0x74, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7E, 0x73, 0xFF, 0x0D, 0x89, 0x7C, 0xF6, 0x0C, 0x88, 0x7B, 0x85, 0x0B, 0x82, 0x76, 0x12, 0x0E, 0x71, 0x71, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0x13, 0x75, 0x62, 0x6B, 0x0E, 0x83, 0x74, 0xE3, 0x0C, 0x85, 0x79, 0xFF, 0x0D, 0x8A, 0x7E, 0xFF, 0x0C, 0x82, 0x76, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0C, 0x7E, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7E, 0x72, 0xFF, 0x0C, 0x82, 0x76, 0xFF, 0x0D, 0x8C, 0x7F, 0xE0, 0x0C, 0x86, 0x78, 0x66, 0x0C, 0x84, 0x78, 0x0A, 0x00, 0x66, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x3D, 0x0C, 0x7D, 0x75, 0xAF, 0x0D, 0x86, 0x78, 0xFF, 0x0D, 0x86, 0x7A, 0xFF, 0x0D, 0x88, 0x7C, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x81, 0x74, 0xFF, 0x0D, 0x88, 0x7B, 0xFE, 0x0C, 0x86, 0x7A, 0xAC, 0x0B, 0x86, 0x7B, 0x3D, 0x0C, 0x7D, 0x70, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x0B, 0x79, 0x6E, 0x6A, 0x0C, 0x84, 0x78, 0xCF, 0x0D, 0x86, 0x78, 0xFF, 0x0D, 0x87, 0x7B, 0xFF, 0x0D, 0x88, 0x7B, 0xFF, 0x0C, 0x81, 0x75, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x82, 0x76, 0xFF, 0x0D, 0x88, 0x7B, 0xFF, 0x0D, 0x87, 0x7A, 0xCE, 0x0C, 0x84, 0x78, 0x63, 0x0C, 0x85, 0x7B, 0x16, 0x0B, 0x7F, 0x73, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x7F, 0x00, 0x20, 0x0F, 0x7F, 0x77, 0x70, 0x0D, 0x81, 0x78, 0xCA, 0x0C, 0x83, 0x76, 0xFE, 0x0C, 0x83, 0x76, 0xFF, 0x0D, 0x89, 0x7C, 0xFF, 0x0D, 0x85, 0x79, 0xFF, 0x0C, 0x82, 0x76, 0xFF, 0x0C, 0x81, 0x75, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x81, 0x74, 0xFF, 0x0C, 0x81, 0x75, 0xFF, 0x0C, 0x82, 0x76, 0xFF, 0x0C, 0x85, 0x79, 0xFF, 0x0D, 0x89, 0x7C, 0xFB, 0x0C, 0x84, 0x77, 0xC6, 0x0C, 0x84, 0x77, 0x6B, 0x0E, 0x85, 0x79, 0x1F, 0x08, 0x83, 0x73, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x55, 0x55, 0x1A, 0x09, 0x75, 0x6B, 0x51, 0x09, 0x84, 0x7A, 0x9A, 0x0D, 0x86, 0x78, 0xD8, 0x0C, 0x81, 0x74, 0xF7, 0x0C, 0x82, 0x75, 0xF9, 0x0D, 0x87, 0x7A, 0xFB, 0x0D, 0x87, 0x79, 0xFC, 0x0D, 0x84, 0x78, 0xFE, 0x0C, 0x81, 0x75, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x7F, 0x73, 0xFF, 0x0C, 0x80, 0x74, 0xFE, 0x0C, 0x81, 0x75, 0xFC, 0x0D, 0x84, 0x78, 0xFA, 0x0D, 0x87, 0x7A, 0xF9, 0x0D, 0x87, 0x7A, 0xF7, 0x0C, 0x82, 0x75, 0xD5, 0x0A, 0x81, 0x76, 0x99, 0x0D, 0x83, 0x77, 0x4E, 0x0D, 0x82, 0x78, 0x16, 0x0B, 0x7F, 0x73, 0x02, 0x00, 0x7F, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x7F, 0x55, 0x11, 0x0F, 0x87, 0x78, 0x34, 0x09, 0x84, 0x75, 0x62, 0x0D, 0x84, 0x77, 0x90, 0x0C, 0x83, 0x76, 0xBA, 0x0C, 0x80, 0x75, 0xDD, 0x0B, 0x80, 0x74, 0xF7, 0x0B, 0x7E, 0x72, 0xFF, 0x0C, 0x80, 0x74, 0xFF, 0x0C, 0x7F, 0x73, 0xF6, 0x0B, 0x7E, 0x72, 0xDD, 0x0B, 0x80, 0x73, 0xB9, 0x0B, 0x80, 0x75, 0x8F, 0x0C, 0x82, 0x77, 0x61, 0x0D, 0x83, 0x76, 0x33, 0x0F, 0x87, 0x78, 0x0E, 0x00, 0x7F, 0x7F, 0x05, 0x00, 0x66, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-};
-const unsigned int Facial_Rec_argb8888_len = 133760;
-
-
-#define FACIAL_WIDTH    176
-#define FACIAL_HEIGHT   190
-#define FACIAL_STRIDE   176*4
-
-#if defined(__cplusplus)
-}
-#endif
-
-#endif  /* __FACIAL_REC_H__ */
-
-/* [] END OF FILE */
@@ -0,0 +1,244 @@
+/*******************************************************************************
+* File Name        : image_asset.c
+*
+* Description      : This file contains the helpers describing the memory layout of
+*                    the image formats, loading the color lookup table of indexed
+*                    images into VGLite and choosing the blend mode of an image.
+*
+* Related Document : See README.md
+*
+********************************************************************************
+* Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+
+#include <stdio.h>
+#include "image_asset.h"
+
+
+/*******************************************************************************
+* Function Name: image_asset_bits_per_pixel
+********************************************************************************
+* Summary:
+*  Returns the size of one pixel of an image format.
+*
+* Parameters:
+*  format   - Image format
+*
+* Return:
+*  uint32_t - Bits per pixel, 0 for formats not used for images
+*
+*******************************************************************************/
+uint32_t image_asset_bits_per_pixel(vg_lite_buffer_format_t format)
+{
+    switch (format)
+    {
+        case VG_LITE_RGBA8888:
+        case VG_LITE_BGRA8888:
+        case VG_LITE_ARGB8888: return 32U;
+        case VG_LITE_BGR565:
+        case VG_LITE_RGB565:   return 16U;
+        case VG_LITE_L8:
+        case VG_LITE_A8:
+        case VG_LITE_INDEX_8:  return 8U;
+        case VG_LITE_A4:
+        case VG_LITE_INDEX_4:  return 4U;
+        default:               return 0U;
+    }
+}
+
+/*******************************************************************************
+* Function Name: image_asset_is_indexed
+********************************************************************************
+* Summary:
+*  Tells whether the pixels of a format are indices into the color lookup
+*  table.
+*
+* Parameters:
+*  format   - Image format
+*
+* Return:
+*  bool     - true for VG_LITE_INDEX_8 and VG_LITE_INDEX_4
+*
+*******************************************************************************/
+bool image_asset_is_indexed(vg_lite_buffer_format_t format)
+{
+    return (VG_LITE_INDEX_8 == format) || (VG_LITE_INDEX_4 == format);
+}
+
+/*******************************************************************************
+* Function Name: image_asset_is_alpha
+********************************************************************************
+* Summary:
+*  Tells whether a format only holds coverage, drawn in the blit color.
+*
+* Parameters:
+*  format   - Image format
+*
+* Return:
+*  bool     - true for VG_LITE_A8 and VG_LITE_A4
+*
+*******************************************************************************/
+bool image_asset_is_alpha(vg_lite_buffer_format_t format)
+{
+    return (VG_LITE_A8 == format) || (VG_LITE_A4 == format);
+}
+
+/*******************************************************************************
+* Function Name: image_asset_format_name
+********************************************************************************
+* Summary:
+*  Returns the name of an image format for log messages.
+*
+* Parameters:
+*  format   - Image format
+*
+* Return:
+*  const char* - Name of the format
+*
+*******************************************************************************/
+const char *image_asset_format_name(vg_lite_buffer_format_t format)
+{
+    switch (format)
+    {
+        case VG_LITE_ARGB8888: return "ARGB8888";
+        case VG_LITE_BGR565:   return "BGR565";
+        case VG_LITE_INDEX_8:  return "INDEX_8";
+        case VG_LITE_INDEX_4:  return "INDEX_4";
+        case VG_LITE_A8:       return "A8";
+        case VG_LITE_A4:       return "A4";
+        case VG_LITE_L8:       return "L8";
+        default:               return "other";
+    }
+}
+
+/*******************************************************************************
+* Function Name: image_asset_min_stride
+********************************************************************************
+* Summary:
+*  Returns the smallest row pitch holding one row of an image, sub byte
+*  formats pack two pixels per byte.
+*
+* Parameters:
+*  format   - Image format
+*  width    - Image width in pixels
+*
+* Return:
+*  int32_t  - Bytes per row, 0 for formats not used for images
+*
+*******************************************************************************/
+int32_t image_asset_min_stride(vg_lite_buffer_format_t format, int32_t width)
+{
+    return (int32_t)((((uint32_t)width * image_asset_bits_per_pixel(format)) + 7U) / 8U);
+}
+
+/*******************************************************************************
+* Function Name: image_asset_bytes
+********************************************************************************
+* Summary:
+*  Returns the memory held by the pixels of an image. The color lookup table
+*  is shared by the images of a format and not included.
+*
+* Parameters:
+*  asset    - Image
+*
+* Return:
+*  uint32_t - Size in bytes
+*
+*******************************************************************************/
+uint32_t image_asset_bytes(const image_asset_t *asset)
+{
+    return (uint32_t)asset->stride * (uint32_t)asset->height;
+}
+
+/*******************************************************************************
+* Function Name: image_asset_load_clut
+********************************************************************************
+* Summary:
+*  Loads the color lookup table of an indexed image. VGLite keeps one table
+*  per index size, images of the same size share it and are prepared with
+*  the same table. Nothing to do for the other formats.
+*
+* Parameters:
+*  asset    - Image
+*
+* Return:
+*  bool     - true on success, false if the table does not match the format
+*
+*******************************************************************************/
+bool image_asset_load_clut(const image_asset_t *asset)
+{
+    vg_lite_error_t error;
+
+    if (!image_asset_is_indexed(asset->format))
+    {
+        return true;
+    }
+    if ((NULL == asset->clut) ||
+        (asset->clut_count != (1UL << image_asset_bits_per_pixel(asset->format))))
+    {
+        printf("Image %s: %u CLUT entries for %s\r\n", asset->name,
+               (unsigned int)asset->clut_count, image_asset_format_name(asset->format));
+        return false;
+    }
+
+    error = vg_lite_set_CLUT(asset->clut_count, (vg_lite_uint32_t *)asset->clut);
+    if (VG_LITE_SUCCESS != error)
+    {
+        printf("vg_lite_set_CLUT() returned error %d\r\n", error);
+        return false;
+    }
+
+    return true;
+}
+
+/*******************************************************************************
+* Function Name: image_asset_blend
+********************************************************************************
+* Summary:
+*  Returns the source over blend mode matching the alpha of an image. The
+*  GPU multiplies straight alpha images by their alpha on every blit,
+*  premultiplied ones are blended as they are.
+*
+* Parameters:
+*  asset    - Image
+*
+* Return:
+*  vg_lite_blend_t - Blend mode
+*
+*******************************************************************************/
+vg_lite_blend_t image_asset_blend(const image_asset_t *asset)
+{
+    return asset->premultiplied ? VG_LITE_BLEND_PREMULTIPLY_SRC_OVER : VG_LITE_BLEND_SRC_OVER;
+}
+
+/* [] END OF FILE */
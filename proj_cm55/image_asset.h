@@ -0,0 +1,104 @@
+/*******************************************************************************
+* File Name        : image_asset.h
+*
+* Description      : This file contains the descriptor of an image prepared by
+*                    tools/host/img2vglite in one of the pixel formats the GPU reads
+*                    directly: ARGB8888 or BGR565, indexed 8 or 4 bit with a color
+*                    lookup table, or 8 or 4 bit alpha drawn in a tint color.
+*
+* Related Document : See README.md
+*
+********************************************************************************
+* Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+
+#ifndef IMAGE_ASSET_H
+#define IMAGE_ASSET_H
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include <stdint.h>
+#include <stdbool.h>
+#include "vg_lite.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+
+/* Row pitch of the prepared images in bytes, a multiple of the GPU memory
+ * burst */
+#define IMAGE_ASSET_STRIDE_ALIGN            (64U)
+/* Alignment of the pixel data, checked again by setup_vglite_image_buffer() */
+#define IMAGE_ASSET_DATA_ALIGN              (128U)
+
+/*******************************************************************************
+* Data Structures and Types
+*******************************************************************************/
+typedef struct image_asset {
+    const char *name;
+    vg_lite_buffer_format_t format;
+    int32_t width;
+    int32_t height;
+    int32_t stride;             /* Bytes per row */
+    uint8_t *data;              /* IMAGE_ASSET_DATA_ALIGN aligned pixels */
+    const uint32_t *clut;       /* Indexed formats: 0xAARRGGBB entries */
+    uint32_t clut_count;        /* 256 for VG_LITE_INDEX_8, 16 for VG_LITE_INDEX_4 */
+    vg_lite_color_t tint;       /* Alpha formats: color the alpha is drawn in */
+    bool premultiplied;         /* Color channels already multiplied by alpha */
+    const struct image_asset *next_level;  /* Half resolution, NULL if none */
+} image_asset_t;
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+uint32_t image_asset_bits_per_pixel(vg_lite_buffer_format_t format);
+bool image_asset_is_indexed(vg_lite_buffer_format_t format);
+bool image_asset_is_alpha(vg_lite_buffer_format_t format);
+const char *image_asset_format_name(vg_lite_buffer_format_t format);
+int32_t image_asset_min_stride(vg_lite_buffer_format_t format, int32_t width);
+uint32_t image_asset_bytes(const image_asset_t *asset);
+bool image_asset_load_clut(const image_asset_t *asset);
+vg_lite_blend_t image_asset_blend(const image_asset_t *asset);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* IMAGE_ASSET_H */
+
+/* [] END OF FILE */
@@ -0,0 +1,288 @@
+/*******************************************************************************
+* File Name        : image_pyramid.c
+*
+* Description      : This file contains the image pyramids. The blit wrapper draws the
+*                    half resolution level closest to the scale of the draw matrix, so a
+*                    scaled down image reads fewer bytes and aliases less, and it counts
+*                    the bytes read against a blit of the full resolution image.
+*
+* Related Document : See README.md
+*
+********************************************************************************
+* Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+#include "image_pyramid.h"
+#include "gpu_profile.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* Address alignment of the image buffers required by the GPU */
+#define IMAGE_PYRAMID_ADDRESS_MASK          (0x3FU)
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+static image_pyramid_stats_t pyramid_stats;
+
+
+/*******************************************************************************
+* Function Name: level_bytes
+********************************************************************************
+* Summary:
+*  Returns the pixel bytes of one level.
+*
+* Parameters:
+*  level    - Level buffer
+*
+* Return:
+*  uint32_t - Row pitch times height
+*
+*******************************************************************************/
+static uint32_t level_bytes(const vg_lite_buffer_t *level)
+{
+    return (uint32_t)level->stride * (uint32_t)level->height;
+}
+
+/*******************************************************************************
+* Function Name: image_pyramid_init
+********************************************************************************
+* Summary:
+*  Sets up the level buffers of a prepared image, following the chain of its
+*  half resolution levels. Each level must have the format of the image and
+*  half the size of the previous one, rounded up.
+*
+* Parameters:
+*  pyramid  - Pyramid, filled in
+*  asset    - Full resolution image
+*
+* Return:
+*  bool     - false if a level is not usable, the error is reported
+*
+*******************************************************************************/
+bool image_pyramid_init(image_pyramid_t *pyramid, const image_asset_t *asset)
+{
+    const image_asset_t *level = asset;
+
+    memset(pyramid, 0, sizeof(*pyramid));
+
+    while ((NULL != level) && (pyramid->level_count < IMAGE_PYRAMID_MAX_LEVELS))
+    {
+        vg_lite_buffer_t *buffer = &pyramid->levels[pyramid->level_count];
+        const vg_lite_buffer_t *previous = (0U == pyramid->level_count) ? NULL : (buffer - 1);
+
+        if (0U != ((uintptr_t)level->data & IMAGE_PYRAMID_ADDRESS_MASK))
+        {
+            printf("Image %s is not aligned at 64 bytes\r\n", level->name);
+            return false;
+        }
+        if ((0U == image_asset_bits_per_pixel(level->format)) ||
+            (level->stride < image_asset_min_stride(level->format, level->width)))
+        {
+            printf("Image %s: stride %d too small for %d %s pixels\r\n", level->name,
+                   (int)level->stride, (int)level->width, image_asset_format_name(level->format));
+            return false;
+        }
+        if ((NULL != previous) &&
+            ((level->format != asset->format) ||
+             (level->width != ((previous->width + 1) / 2)) ||
+             (level->height != ((previous->height + 1) / 2))))
+        {
+            printf("Image %s is not a half resolution level of %s\r\n", level->name,
+                   asset->name);
+            return false;
+        }
+
+        buffer->width  = level->width;
+        buffer->height = level->height;
+        buffer->stride = level->stride;
+        buffer->format = level->format;
+        /* Alpha only images are multiplied by the blit color */
+        buffer->image_mode = image_asset_is_alpha(level->format) ? VG_LITE_MULTIPLY_IMAGE_MODE :
+                                                                  VG_LITE_NORMAL_IMAGE_MODE;
+        buffer->handle  = NULL;
+        buffer->memory  = level->data;
+        buffer->address = (uint32_t)(uintptr_t)level->data;
+
+        pyramid->level_count++;
+        level = level->next_level;
+    }
+
+    return (pyramid->level_count > 0U);
+}
+
+/*******************************************************************************
+* Function Name: image_pyramid_bytes
+********************************************************************************
+* Summary:
+*  Returns the pixel bytes of all levels of a pyramid.
+*
+* Parameters:
+*  pyramid  - Pyramid
+*
+* Return:
+*  uint32_t - Bytes
+*
+*******************************************************************************/
+uint32_t image_pyramid_bytes(const image_pyramid_t *pyramid)
+{
+    uint32_t bytes = 0U;
+
+    for (uint8_t i = 0; i < pyramid->level_count; i++)
+    {
+        bytes += level_bytes(&pyramid->levels[i]);
+    }
+
+    return bytes;
+}
+
+/*******************************************************************************
+* Function Name: image_pyramid_select
+********************************************************************************
+* Summary:
+*  Returns the level closest to the on-screen size of the image. The scale is
+*  the longer of the two image axes mapped by the affine part of the matrix,
+*  so a level is never minified along one axis more than needed. The smallest
+*  level drawn magnified by at most IMAGE_PYRAMID_MAX_MAGNIFICATION is chosen.
+*
+* Parameters:
+*  pyramid  - Pyramid
+*  matrix   - Draw matrix of the full resolution image
+*
+* Return:
+*  uint8_t  - Level index, 0 for full resolution
+*
+*******************************************************************************/
+uint8_t image_pyramid_select(const image_pyramid_t *pyramid, const vg_lite_matrix_t *matrix)
+{
+    float scale_x = sqrtf((matrix->m[0][0] * matrix->m[0][0]) +
+                          (matrix->m[1][0] * matrix->m[1][0]));
+    float scale_y = sqrtf((matrix->m[0][1] * matrix->m[0][1]) +
+                          (matrix->m[1][1] * matrix->m[1][1]));
+    float scale = (scale_x > scale_y) ? scale_x : scale_y;
+    uint8_t level = 0U;
+
+    while (((level + 1U) < pyramid->level_count) &&
+           (((float)pyramid->levels[level + 1U].width * IMAGE_PYRAMID_MAX_MAGNIFICATION) >=
+            ((float)pyramid->levels[0].width * scale)) &&
+           (((float)pyramid->levels[level + 1U].height * IMAGE_PYRAMID_MAX_MAGNIFICATION) >=
+            ((float)pyramid->levels[0].height * scale)))
+    {
+        level++;
+    }
+
+    return level;
+}
+
+/*******************************************************************************
+* Function Name: image_pyramid_blit
+********************************************************************************
+* Summary:
+*  Blits the level selected for the draw matrix. The matrix is scaled up by
+*  the size ratio of the level, so the level covers the same pixels as the
+*  full resolution image would.
+*
+* Parameters:
+*  pyramid         - Pyramid
+*  target          - Render target
+*  matrix          - Draw matrix of the full resolution image
+*  blend           - Blend mode
+*  color           - Blit color
+*  filter          - Filter
+*
+* Return:
+*  vg_lite_error_t - Result of vg_lite_blit()
+*
+*******************************************************************************/
+vg_lite_error_t image_pyramid_blit(image_pyramid_t *pyramid, vg_lite_buffer_t *target,
+                                   const vg_lite_matrix_t *matrix, vg_lite_blend_t blend,
+                                   vg_lite_color_t color, vg_lite_filter_t filter)
+{
+    uint8_t level = image_pyramid_select(pyramid, matrix);
+    vg_lite_buffer_t *source = &pyramid->levels[level];
+    vg_lite_matrix_t level_matrix = *matrix;
+
+    if (0U != level)
+    {
+        float ratio_x = (float)pyramid->levels[0].width / (float)source->width;
+        float ratio_y = (float)pyramid->levels[0].height / (float)source->height;
+
+        for (uint8_t row = 0; row < 3U; row++)
+        {
+            level_matrix.m[row][0] *= ratio_x;
+            level_matrix.m[row][1] *= ratio_y;
+        }
+        pyramid_stats.reduced++;
+    }
+
+    pyramid_stats.blits++;
+    pyramid_stats.fetched_bytes += level_bytes(source);
+    pyramid_stats.full_bytes += level_bytes(&pyramid->levels[0]);
+
+    return GPU_PROFILE_CALL("vg_lite_blit",
+                            vg_lite_blit(target, source, &level_matrix, blend, color, filter));
+}
+
+/*******************************************************************************
+* Function Name: image_pyramid_get_stats
+********************************************************************************
+* Summary:
+*  Returns the statistics of the blits through all pyramids, optionally
+*  resetting them.
+*
+* Parameters:
+*  stats  - Output statistics
+*  reset  - true to clear the statistics after reading them
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void image_pyramid_get_stats(image_pyramid_stats_t *stats, bool reset)
+{
+    *stats = pyramid_stats;
+
+    if (reset)
+    {
+        memset(&pyramid_stats, 0, sizeof(pyramid_stats));
+    }
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,103 @@
+/*******************************************************************************
+* File Name        : image_pyramid.h
+*
+* Description      : This file contains the declarations of the image pyramids: an
+*                    image and its half resolution levels prepared by tools/host/img2vglite.
+*                    A blit through a pyramid draws the level closest to the on-screen size
+*                    of the image and counts the pixel bytes the GPU reads.
+*
+* Related Document : See README.md
+*
+********************************************************************************
+* Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+
+#ifndef IMAGE_PYRAMID_H
+#define IMAGE_PYRAMID_H
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include <stdint.h>
+#include <stdbool.h>
+#include "vg_lite.h"
+#include "image_asset.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+
+/* Full resolution and up to three half resolution levels */
+#define IMAGE_PYRAMID_MAX_LEVELS            (4U)
+
+/* A level is drawn magnified by at most this factor, sqrt(2): the level
+ * closest to the on-screen size on a logarithmic scale */
+#define IMAGE_PYRAMID_MAX_MAGNIFICATION     (1.41421356f)
+
+/*******************************************************************************
+* Data Structures and Types
+*******************************************************************************/
+typedef struct {
+    vg_lite_buffer_t levels[IMAGE_PYRAMID_MAX_LEVELS];  /* Level 0 is full size */
+    uint8_t level_count;
+} image_pyramid_t;
+
+typedef struct {
+    uint32_t blits;             /* Blits through a pyramid */
+    uint32_t reduced;           /* Blits drawn from a half resolution level */
+    uint32_t fetched_bytes;     /* Pixel bytes of the levels drawn */
+    uint32_t full_bytes;        /* Pixel bytes of level 0 for the same blits */
+} image_pyramid_stats_t;
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+bool image_pyramid_init(image_pyramid_t *pyramid, const image_asset_t *asset);
+uint32_t image_pyramid_bytes(const image_pyramid_t *pyramid);
+uint8_t image_pyramid_select(const image_pyramid_t *pyramid, const vg_lite_matrix_t *matrix);
+vg_lite_error_t image_pyramid_blit(image_pyramid_t *pyramid, vg_lite_buffer_t *target,
+                                   const vg_lite_matrix_t *matrix, vg_lite_blend_t blend,
+                                   vg_lite_color_t color, vg_lite_filter_t filter);
+void image_pyramid_get_stats(image_pyramid_stats_t *stats, bool reset);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* IMAGE_PYRAMID_H */
+
+/* [] END OF FILE */
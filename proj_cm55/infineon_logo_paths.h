@@ -230,7 +230,8 @@ vg_lite_path_t path[PATH_COUNT] = {
         {0},                /* uploaded */
         sizeof(path_data0), /* path length */
         path_data0,         /* path data */
-        1                   /* initially, path is changed for uploaded */
+        1,                  /* initially, path is changed for uploaded */
+        0                   /* path data not owned by the driver */
     },
     {
         {LEFT_COORD, TOP_COORD, RIGHT_COORD, BOTTOM_COORD},
@@ -239,7 +240,8 @@ vg_lite_path_t path[PATH_COUNT] = {
         {0},
         sizeof(path_data1),
         path_data1,
-        1
+        1,
+        0
     }
 };
 
@@ -41,12 +41,22 @@
 /*******************************************************************************
 * Header Files
 *******************************************************************************/
+#include <string.h>
 #include "retarget_io_init.h"
 #include "vg_lite_platform.h"
 #include "cybsp.h"
 #include "cy_time.h"
 #include "cycfg_peripherals.h"
 #include "vglite_demos.h"
+#include "swap_chain.h"
+#include "frame_pacer.h"
+#include "gpu_submit.h"
+#include "gfx_port.h"
+#include "gpu_mem_plan.h"
+#include "text_engine.h"
+#include "perf_hud.h"
+#include "frame_stats.h"
+#include "cpu_load.h"
 #include "task.h"
 #include "cyabs_rtos.h"
 #include "cyabs_rtos_impl.h"
@@ -56,7 +66,9 @@
 * Macros
 *******************************************************************************/
 #define GFX_TASK_NAME                       ("CM55 Gfx Task")
-#define GFX_TASK_STACK_SIZE                 (configMINIMAL_STACK_SIZE)
+/* Holds the statistics structures read by calculate_fps() and the printf
+ * formatting them, on top of the VGLite calls of the demos */
+#define GFX_TASK_STACK_SIZE                 (configMINIMAL_STACK_SIZE * 4)
 #define GFX_TASK_PRIORITY                   (configMAX_PRIORITIES - 1)
 
 
@@ -64,40 +76,34 @@
 #define UART_CLI_TASK_STACK_SIZE            (configMINIMAL_STACK_SIZE * 2)
 #define UART_CLI_TASK_PRIORITY              (configMAX_PRIORITIES - 1)
 
-#define GFX_TASK_DELAY_MS                   (16U)
+/* Nominal panel refresh rate, refined at run time from DC interrupts */
+#define DISPLAY_REFRESH_HZ                  (60U)
+#define FRAME_PACER_DEFAULT_TARGET          (FRAME_PACER_NATIVE)
+#define US_PER_MS                           (1000U)
+
+/* Longest time the render task waits for the DC to release a frame buffer */
+#define PRESENT_TIMEOUT_MS                  (100U)
 #define DC_INT_PRIORITY                     (3U)
 #define GPU_INT_PRIORITY                    (3U)
 #define I2C_CONTROLLER_IRQ_PRIORITY         (2UL)
 
-#define COLOR_DEPTH                         (16U)
-#define BITS_PER_PIXEL                      (8U)
-#define APP_BUFFER_COUNT                    (3U)
-
-#define DISP_H                              (480U)
-#define DISP_W                              (832U)
-#define DISP_W_ACTUAL                       (800U)
-
-#define ALIGN_128                           (128U)
-/* 64 KB */
-#define DEFAULT_GPU_CMD_BUFFER_SIZE         ((64U) * (1024U))
-
-#define GPU_TESSELLATION_BUFFER_SIZE        ((DISP_H) * 128U)
-
-#define FRAME_BUFFER_SIZE                   ((DISP_W) * (DISP_H) * \
-                                             ((COLOR_DEPTH) / (BITS_PER_PIXEL)))
-
-#define VGLITE_HEAP_SIZE                    (((FRAME_BUFFER_SIZE) * \
-                                              (APP_BUFFER_COUNT)) + \
-                                              ((DEFAULT_GPU_CMD_BUFFER_SIZE) * \
-                                               (APP_BUFFER_COUNT)) + \
-                                              ((GPU_TESSELLATION_BUFFER_SIZE) * \
-                                               (APP_BUFFER_COUNT)))
-
 #define GPU_MEM_BASE                        (0x0U)
 
+/* Display controller layer format of the frame buffers, see FRAME_FORMAT */
+#if (FRAME_FORMAT == FRAME_FORMAT_ARGB8888)
+#define FRAME_BUFFER_DC_FORMAT              (vivARGB8888)
+#else
+#define FRAME_BUFFER_DC_FORMAT              (vivRGB565)
+#endif
+
 
 #define TARGET_NUM_FRAMES                   (60U)
 
+/* Name FreeRTOS gives the idle task */
+#ifndef configIDLE_TASK_NAME
+#define configIDLE_TASK_NAME                ("IDLE")
+#endif
+
 
 /* Rotation and scaling parameters */
 #define DEF_X_SCALE                         (0.3f)
@@ -123,9 +129,35 @@ static mtb_hal_rtc_t rtc_obj;
 GFXSS_Type* base = (GFXSS_Type*) GFXSS;
 
 cy_stc_gfx_context_t gfx_context;
-vg_lite_buffer_t buffer0;
-vg_lite_buffer_t buffer1;
+vg_lite_buffer_t frame_buffers[APP_BUFFER_COUNT];
 vg_lite_buffer_t intermediate_buffer;
+swap_chain_t swap_chain;
+frame_pacer_t frame_pacer;
+gpu_submit_t gpu_submit;
+frame_stats_t frame_stats;
+cpu_load_t cpu_load;
+
+#if ( configGENERATE_RUN_TIME_STATS == 1 )
+/* Task states read for each CPU load sample, static to keep them off the
+ * render task stack */
+static TaskStatus_t cpu_load_tasks[CPU_LOAD_MAX_TASKS];
+
+/* Set by the tick hook once per CPU_LOAD_PERIOD_MS, cleared by the render task */
+static volatile bool cpu_load_sample_due = false;
+static TickType_t cpu_load_sample_tick = RESET_VAL;
+#endif
+
+/* Render task handle, woken from the DC interrupt when a buffer is released */
+static TaskHandle_t gfx_task_handle = NULL;
+
+/* Time the render task spent blocked on the swap chain */
+static uint32_t present_wait_cycles = RESET_VAL;
+
+/* Timestamp at which the CPU started encoding the current frame */
+static uint32_t frame_encode_start = RESET_VAL;
+
+/* GPU fence of the frame being submitted */
+static uint32_t frame_fence = GPU_SUBMIT_NO_FENCE;
 
 vg_lite_buffer_t *render_target;
 vg_lite_matrix_t matrix;
@@ -133,7 +165,9 @@ vg_lite_matrix_t matrix;
 QueueHandle_t event_queque;
 
 bool cancel_requested = false;
-volatile bool fb_pending        = false;
+
+/* Set by the 'f' key, the next calculate_fps() prints the full statistics */
+volatile bool frame_details_requested = false;
 
 /* Heap memory for VGLite to allocate memory for buffers, command, and
    tessellation buffers */
@@ -175,6 +209,17 @@ cy_stc_sysint_t disp_i2c_controller_irq_cfg =
 /* LPTimer HAL object */
 static mtb_hal_lptimer_t lptimer_obj;
 
+/* Added to the DWT cycle counter by gfx_port_resume_cycles() */
+volatile uint32_t gfx_port_cycle_offset = 0U;
+
+#if (configUSE_TICKLESS_IDLE != 0)
+/* Clock of the LPTimer and the state saved when the CPU went to sleep */
+static uint32_t lptimer_hz;
+static uint32_t sleep_start_lptimer;
+static uint32_t sleep_start_cycles;
+static bool sleep_pending = false;
+#endif /* (configUSE_TICKLESS_IDLE != 0) */
+
 
 /*******************************************************************************
 * Extern Functions 
@@ -211,6 +256,11 @@ void setup_run_time_stats_timer(void)
         handle_app_error();
     }
 
+    /* FreeRTOS takes unsigned differences of the counter, which needs the
+     * full 32-bit range rather than the period of the configuration */
+    Cy_TCPWM_Counter_SetPeriod(CYBSP_GENERAL_PURPOSE_TIMER_HW,
+            CYBSP_GENERAL_PURPOSE_TIMER_NUM, UINT32_MAX);
+
     /* Enable the initialized counter */
     Cy_TCPWM_Counter_Enable(CYBSP_GENERAL_PURPOSE_TIMER_HW,
             CYBSP_GENERAL_PURPOSE_TIMER_NUM);
@@ -243,44 +293,66 @@ uint32_t get_run_time_counter_value(void)
 
 
 /*******************************************************************************
-* Function Name: calculate_idle_percentage
+* Function Name: vApplicationTickHook
 ********************************************************************************
 * Summary:
-*  Function to calculate CPU idle percentage. This function is used by LVGL to
-*  showcase CPU usage.
+*  FreeRTOS tick hook. Flags a CPU load sample once per CPU_LOAD_PERIOD_MS.
+*  The sample itself is taken by the render task, uxTaskGetSystemState() is
+*  not allowed in an interrupt. The tick count is compared rather than the
+*  hook calls counted, tickless idle skips the hook for the ticks slept.
 *
 * Parameters:
 *  void
 *
 * Return:
-*  uint32_t: CPU idle percentage
+*  void
 *
 *******************************************************************************/
-uint32_t calculate_idle_percentage(void)
+void vApplicationTickHook(void)
 {
-    static uint32_t previousIdleTime = 0;
-    static TickType_t previousTick = 0;
-    uint32_t time_diff = 0;
-    uint32_t idle_percent = 0;
-
-    uint32_t currentIdleTime = ulTaskGetIdleRunTimeCounter();
-    TickType_t currentTick = portGET_RUN_TIME_COUNTER_VALUE();
+    TickType_t now = xTaskGetTickCountFromISR();
 
-    time_diff = currentTick - previousTick;
-    if((currentIdleTime >= previousIdleTime) && (currentTick > previousTick))
+    if ((now - cpu_load_sample_tick) >= pdMS_TO_TICKS(CPU_LOAD_PERIOD_MS))
     {
-        idle_percent = ((currentIdleTime - previousIdleTime) * 100)/time_diff;
+        cpu_load_sample_tick = now;
+        cpu_load_sample_due  = true;
     }
-    else if ((currentIdleTime >= previousIdleTime) && (currentTick < previousTick))
+}
+
+/*******************************************************************************
+* Function Name: sample_cpu_load
+********************************************************************************
+* Summary:
+*  Takes a CPU load sample: the run time counter of each task and the cycle
+*  counter the interrupt handlers are timed with.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void sample_cpu_load(void)
+{
+    uint32_t total_time = 0U;
+    UBaseType_t count;
+
+    /* Returns no tasks if there are more than CPU_LOAD_MAX_TASKS */
+    count = uxTaskGetSystemState(cpu_load_tasks, CPU_LOAD_MAX_TASKS, &total_time);
+    if (0U == count)
     {
-        time_diff = 10000 - previousTick + currentTick;
-        idle_percent = ((currentIdleTime - previousIdleTime) * 100)/time_diff;
-      
+        total_time = portGET_RUN_TIME_COUNTER_VALUE();
     }
-    previousIdleTime = ulTaskGetIdleRunTimeCounter();
-    previousTick = portGET_RUN_TIME_COUNTER_VALUE();
 
-    return idle_percent;
+    cpu_load_begin(&cpu_load, total_time, gfx_port_cycles());
+    for (UBaseType_t i = 0U; i < count; i++)
+    {
+        cpu_load_add_task(&cpu_load, cpu_load_tasks[i].pcTaskName,
+                          cpu_load_tasks[i].ulRunTimeCounter,
+                          (0 == strcmp(cpu_load_tasks[i].pcTaskName, configIDLE_TASK_NAME)));
+    }
+    cpu_load_end(&cpu_load);
 }
 #endif /*( configGENERATE_RUN_TIME_STATS == 1 )*/
 
@@ -378,12 +450,119 @@ static void setup_tickless_idle_timer(void)
 }
 
 
+#if (configUSE_TICKLESS_IDLE != 0)
+/*******************************************************************************
+* Function Name: cycle_counter_syspm_callback
+********************************************************************************
+* Summary:
+*  SysPm callback that carries the cycle counter across CPU Sleep and Deep
+*  Sleep. The frame timing, the frame pacer and the interrupt accounting
+*  timestamp with gfx_port_cycles(), whose DWT counter stops while the CPU
+*  clock is gated. The LPTimer keeps counting, so the time slept is read from
+*  it before and after the transition and added to the cycle count. Both
+*  stages run with interrupts disabled, before any interrupt handler that
+*  woke the CPU takes a timestamp.
+*
+* Parameters:
+*  callback_params - Unused
+*  mode            - Stage of the low power transition
+*
+* Return:
+*  cy_en_syspm_status_t - CY_SYSPM_SUCCESS, the transition is never refused
+*
+*******************************************************************************/
+static cy_en_syspm_status_t cycle_counter_syspm_callback(
+    cy_stc_syspm_callback_params_t *callback_params, cy_en_syspm_callback_mode_t mode)
+{
+    uint32_t slept_ticks;
+
+    CY_UNUSED_PARAMETER(callback_params);
+
+    if (CY_SYSPM_BEFORE_TRANSITION == mode)
+    {
+        sleep_start_cycles  = gfx_port_cycles();
+        sleep_start_lptimer = mtb_hal_lptimer_read(&lptimer_obj);
+        sleep_pending = true;
+    }
+    else if ((CY_SYSPM_AFTER_TRANSITION == mode) && sleep_pending)
+    {
+        slept_ticks = mtb_hal_lptimer_read(&lptimer_obj) - sleep_start_lptimer;
+        gfx_port_resume_cycles(sleep_start_cycles +
+                               (uint32_t)(((uint64_t)slept_ticks * SystemCoreClock) /
+                                          lptimer_hz));
+        sleep_pending = false;
+    }
+    else
+    {
+        /* Nothing to check or undo */
+    }
+
+    return CY_SYSPM_SUCCESS;
+}
+
+
+/*******************************************************************************
+* Function Name: track_sleep_in_cycle_counter
+********************************************************************************
+* Summary:
+*  Registers cycle_counter_syspm_callback() for CPU Sleep and Deep Sleep, so
+*  the tickless idle of the RTOS abstraction library can put the CPU to sleep
+*  while the task timestamps keep counting real time.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void track_sleep_in_cycle_counter(void)
+{
+    static cy_stc_syspm_callback_params_t callback_params =
+    {
+        .context            = NULL,
+        .base               = NULL
+    };
+    static cy_stc_syspm_callback_t sleep_callback =
+    {
+        .callback           = &cycle_counter_syspm_callback,
+        .skipMode           = SYSPM_SKIP_MODE,
+        .type               = CY_SYSPM_SLEEP,
+        .callbackParams     = &callback_params,
+        .prevItm            = NULL,
+        .nextItm            = NULL,
+        .order              = SYSPM_CALLBACK_ORDER
+    };
+    static cy_stc_syspm_callback_t deepsleep_callback =
+    {
+        .callback           = &cycle_counter_syspm_callback,
+        .skipMode           = SYSPM_SKIP_MODE,
+        .type               = CY_SYSPM_DEEPSLEEP,
+        .callbackParams     = &callback_params,
+        .prevItm            = NULL,
+        .nextItm            = NULL,
+        .order              = SYSPM_CALLBACK_ORDER
+    };
+
+    lptimer_hz = Cy_SysClk_ClkLfGetFrequency();
+    if ((0U == lptimer_hz) ||
+        (!Cy_SysPm_RegisterCallback(&sleep_callback)) ||
+        (!Cy_SysPm_RegisterCallback(&deepsleep_callback)))
+    {
+        handle_app_error();
+    }
+}
+#endif /* (configUSE_TICKLESS_IDLE != 0) */
+
+
 /*******************************************************************************
 * Function Name: dc_irq_handler
 ********************************************************************************
 * Summary:
 *  Display Controller interrupt handler which gets invoked when the DC finishes
-*  utilizing the current frame buffer.
+*  utilizing the current frame buffer. Advances the swap chain, which releases
+*  the previously scanned out buffer and programs the next queued one, and
+*  wakes up the render task if it is blocked waiting for a free buffer.
 *
 * Parameters:
 *  void
@@ -394,8 +573,44 @@ static void setup_tickless_idle_timer(void)
 *******************************************************************************/
 static void dc_irq_handler(void)
 {
-    fb_pending = false;
+    BaseType_t higher_priority_task_woken = pdFALSE;
+    uint32_t start_cycles = gfx_port_cycles();
+
     Cy_GFXSS_Clear_DC_Interrupt(base, &gfx_context);
+
+    frame_pacer_on_vsync(&frame_pacer, start_cycles);
+
+    if (swap_chain_on_vsync(&swap_chain) && (NULL != gfx_task_handle))
+    {
+        vTaskNotifyGiveFromISR(gfx_task_handle, &higher_priority_task_woken);
+    }
+
+    cpu_load_add_irq(&cpu_load, CPU_LOAD_IRQ_DC, gfx_port_cycles() - start_cycles);
+    portYIELD_FROM_ISR(higher_priority_task_woken);
+}
+
+
+/*******************************************************************************
+* Function Name: present_frame_buffer
+********************************************************************************
+* Summary:
+*  Swap chain present callback. Sets the Video/Graphics layer buffer address
+*  and transfers the frame buffer to the Display Controller.
+*
+* Parameters:
+*  slot      - Index of the frame buffer to display
+*  user_data - Unused
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void present_frame_buffer(uint8_t slot, void *user_data)
+{
+    CY_UNUSED_PARAMETER(user_data);
+
+    Cy_GFXSS_Set_FrameBuffer(base, (uint32_t*) frame_buffers[slot].address,
+                             &gfx_context);
 }
 
 
@@ -404,7 +619,8 @@ static void dc_irq_handler(void)
 ********************************************************************************
 * Summary:
 *  GPU interrupt handler which gets invoked when the GPU finishes composing
-*  a frame.
+*  a frame. Signals the fence of the completed frame, which queues it on the
+*  swap chain for display.
 *
 * Parameters:
 *  void
@@ -415,8 +631,36 @@ static void dc_irq_handler(void)
 *******************************************************************************/
 static void gpu_irq_handler(void)
 {
+    uint32_t start_cycles = gfx_port_cycles();
+
     Cy_GFXSS_Clear_GPU_Interrupt(GFXSS, &gfx_context);
+    gpu_submit_on_irq(&gpu_submit, start_cycles);
     vg_lite_IRQHandler();
+    cpu_load_add_irq(&cpu_load, CPU_LOAD_IRQ_GPU, gfx_port_cycles() - start_cycles);
+}
+
+
+/*******************************************************************************
+* Function Name: frame_rendered
+********************************************************************************
+* Summary:
+*  GPU submission callback, invoked from the GPU interrupt when the frame
+*  rendered into a swap chain slot is complete. Hands the buffer over to the
+*  swap chain for display.
+*
+* Parameters:
+*  slot      - Index of the completed frame buffer
+*  user_data - Unused
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void frame_rendered(uint8_t slot, void *user_data)
+{
+    CY_UNUSED_PARAMETER(user_data);
+
+    swap_chain_submit(&swap_chain, slot);
 }
 
 /*******************************************************************************
@@ -445,7 +689,8 @@ static void disp_i2c_controller_interrupt(void)
 *  This function calculates the frames per second (FPS) based on the number of
 *  frames rendered and the elapsed time since the last calculation.
 *  It resets the frame count and start time after reaching the target number of
-*  frames.
+*  frames. Each time, the frame rate and the CPU and GPU load are printed; the
+*  other statistics of the window only when requested with the 'f' key.
 
 * Parameters:
 *  void   
@@ -453,24 +698,145 @@ static void disp_i2c_controller_interrupt(void)
 * Return:
 *  None
 *******************************************************************************/
-uint32_t idle_percent = 0;
+uint32_t cpu_percent = 0;
 void calculate_fps(void)
 {
     static uint32_t start_time_ms = RESET_VAL;
     static uint32_t num_frames    = RESET_VAL;
     static uint32_t time_ms       = RESET_VAL;
     static uint32_t fps_x_1000    = RESET_VAL; 
+    swap_chain_stats_t chain_stats;
+    frame_pacer_stats_t pacer_stats;
+    gpu_submit_stats_t gpu_stats;
+    damage_stats_t damage_stats;
+    path_cache_stats_t path_stats;
+    quality_policy_stats_t quality_stats;
+    path_bounds_stats_t bounds_stats;
+    tess_probe_stats_t tess_stats;
+    gpu_heap_stats_t heap_stats;
+    text_stats_t text_stats;
+    perf_hud_stats_t hud_stats;
+    perf_hud_sample_t hud_sample;
+    frame_stats_report_t frame_report;
+    cpu_load_report_t load_report;
+    uint32_t path_draws;
+    uint32_t glyph_ns;
+    uint32_t skipped;
     num_frames++;
+
+    frame_stats_frame(&frame_stats, gfx_port_cycles(), frame_pacer.period_cycles,
+                      (uint32_t)frame_pacer.target);
     
     if (TARGET_NUM_FRAMES <= num_frames)
     {
-        idle_percent = calculate_idle_percentage();
+        /* Busy share over the last CPU load sample period */
+        if (cpu_load_get(&cpu_load, CPU_LOAD_SHORT_WINDOW, &load_report))
+        {
+            cpu_percent = (load_report.busy_permille + 5U) / 10U;
+        }
         time_ms = get_time_ms() - start_time_ms;
         fps_x_1000 = (num_frames * 1000 * 1000) / time_ms;
 
-        printf("\rFPS: %u.%03u | CPU usage: %3u%%", (uint8_t)(fps_x_1000 / 1000),
-                    (uint16_t)(fps_x_1000 % 1000),
-                    (uint8_t)(100 - idle_percent));
+        swap_chain_get_stats(&swap_chain, &chain_stats, true);
+        frame_pacer_get_stats(&frame_pacer, &pacer_stats, true);
+        gpu_submit_get_stats(&gpu_submit, &gpu_stats, true);
+        damage_tracker_get_stats(&damage_tracker, &damage_stats, true);
+        path_cache_get_stats(&path_cache, &path_stats, true);
+        quality_policy_get_stats(&quality_policy, &quality_stats, true);
+        path_bounds_get_stats(&path_bounds, &bounds_stats, true);
+        tess_probe_get_stats(&tess_probe, &tess_stats, true);
+        gpu_heap_get_stats(&gpu_heap, &heap_stats, true);
+        text_get_stats(&text_stats, true);
+        frame_stats_get_window(&frame_stats, &frame_report, true);
+        skipped = scene_fingerprint_get_skipped(&scene_fingerprint, true);
+        path_draws = path_stats.hits + path_stats.misses;
+        /* Layout and blit issue time per glyph drawn, in nanoseconds */
+        glyph_ns = (text_stats.glyphs > 0U) ?
+                   gfx_port_cycles_to_us(((text_stats.layout_cycles + text_stats.draw_cycles) /
+                                          text_stats.glyphs) * 1000U) : 0U;
+
+        /* The HUD shows the same values, its own cost included */
+        perf_hud_get_stats(&perf_hud, &hud_stats, true);
+        hud_sample.fps_x_1000      = fps_x_1000;
+        hud_sample.cpu_percent     = cpu_percent;
+        hud_sample.gpu_percent     = (time_ms > 0U) ?
+                                     ((gfx_port_cycles_to_us(gpu_stats.gpu_busy_cycles) / 10U) /
+                                      time_ms) : 0U;
+        hud_sample.heap_used_bytes = heap_stats.used_bytes;
+        hud_sample.hud_cpu_ns      = gfx_port_cycles_to_us((hud_stats.cpu_cycles / num_frames) * 1000U);
+        hud_sample.hud_pixels      = hud_stats.pixels / num_frames;
+        perf_hud_sample(&perf_hud, &hud_sample);
+
+        printf("\rFPS: %u.%03u | CPU: %3u%% | GPU: %3u%%",
+               (uint8_t)(fps_x_1000 / 1000),
+               (uint16_t)(fps_x_1000 % 1000),
+               (uint8_t)cpu_percent,
+               (unsigned int)hud_sample.gpu_percent);
+
+        if (frame_details_requested)
+        {
+            frame_details_requested = false;
+            printf("\r\n\r\nLast %u frames:\r\n"
+                   "  Queued: %u (max %u/%u) | Present: %4u us (max %5u us) | Wait: %5u us\r\n"
+                   "  Pacing: %s, missed %u\r\n"
+                   "  GPU: %5u us | Encode: %5u us (overlap %5u us)\r\n"
+                   "  Saved: %3u kpx | Skipped: %2u\r\n"
+                   "  Paths: %3u%% hit, %5u B/frame | AA reduced: %3u%%\r\n"
+                   "  Culled: %2u/frame | Tess saved: %4d kpx\r\n"
+                   "  Tess buffer: %5u B peak, %3u extra passes\r\n"
+                   "  Heap: %4u KB peak, %2u%% frag | FB: %s, %4u KB\r\n"
+                   "  Text: %3u glyphs in %2u blits/frame, %u.%03u us/glyph\r\n"
+                   "  HUD: %s, %u.%03u us, %5u px/frame\r\n"
+                   "  Frame: p50 %2u.%03u, p99 %2u.%03u, max %3u.%03u ms, jitter %2u.%03u ms\r\n\r\n",
+                   (unsigned int)num_frames,
+                   chain_stats.queued, chain_stats.max_queued,
+                   APP_BUFFER_COUNT,
+                   (unsigned int)((chain_stats.frames_presented > 0U) ?
+                       (chain_stats.latency_sum_us / chain_stats.frames_presented) : 0U),
+                   (unsigned int)chain_stats.latency_max_us,
+                   (unsigned int)(gfx_port_cycles_to_us(present_wait_cycles) / num_frames),
+                   frame_pacer_target_name(frame_pacer.target),
+                   (unsigned int)pacer_stats.missed_deadlines,
+                   (unsigned int)((gpu_stats.frames > 0U) ?
+                       (gfx_port_cycles_to_us(gpu_stats.gpu_busy_cycles) / gpu_stats.frames) : 0U),
+                   (unsigned int)(gfx_port_cycles_to_us(gpu_stats.encode_cycles) / num_frames),
+                   (unsigned int)(gfx_port_cycles_to_us(gpu_stats.overlap_cycles) / num_frames),
+                   (unsigned int)((damage_stats.frames > 0U) ?
+                       (damage_stats.pixels_saved / damage_stats.frames / 1000U) : 0U),
+                   (unsigned int)skipped,
+                   (unsigned int)((path_draws > 0U) ?
+                       ((path_stats.hits * 100U) / path_draws) : 0U),
+                   (unsigned int)((path_stats.frames > 0U) ?
+                       (path_stats.bytes_saved / path_stats.frames) : 0U),
+                   (unsigned int)((quality_stats.draws > 0U) ?
+                       ((quality_stats.reduced * 100U) / quality_stats.draws) : 0U),
+                   (unsigned int)((bounds_stats.frames > 0U) ?
+                       (bounds_stats.culled / bounds_stats.frames) : 0U),
+                   (int)((bounds_stats.frames > 0U) ?
+                       (bounds_stats.area_saved / (int32_t)bounds_stats.frames / 1000) : 0),
+                   (unsigned int)tess_stats.peak_bytes,
+                   (unsigned int)tess_stats.extra_passes,
+                   (unsigned int)(heap_stats.peak_bytes / 1024U),
+                   (unsigned int)heap_stats.fragmentation,
+                   FRAME_BUFFER_FORMAT_NAME,
+                   (unsigned int)(heap_stats.tag_bytes[GPU_HEAP_TAG_FRAME_BUFFER] / 1024U),
+                   (unsigned int)(text_stats.glyphs / num_frames),
+                   (unsigned int)(text_stats.blits / num_frames),
+                   (unsigned int)(glyph_ns / 1000U), (unsigned int)(glyph_ns % 1000U),
+                   perf_hud.enabled ? "on" : "off",
+                   (unsigned int)(hud_sample.hud_cpu_ns / 1000U),
+                   (unsigned int)(hud_sample.hud_cpu_ns % 1000U),
+                   (unsigned int)hud_sample.hud_pixels,
+                   (unsigned int)(frame_report.p50_us / 1000U),
+                   (unsigned int)(frame_report.p50_us % 1000U),
+                   (unsigned int)(frame_report.p99_us / 1000U),
+                   (unsigned int)(frame_report.p99_us % 1000U),
+                   (unsigned int)(frame_report.max_us / 1000U),
+                   (unsigned int)(frame_report.max_us % 1000U),
+                   (unsigned int)(frame_report.jitter_us / 1000U),
+                   (unsigned int)(frame_report.jitter_us % 1000U));
+        }
+        present_wait_cycles = RESET_VAL;
         fflush(stdout);
 
         num_frames = RESET_VAL;
@@ -479,6 +845,50 @@ void calculate_fps(void)
 
 }
 
+/*******************************************************************************
+* Function Name: pace_frame
+********************************************************************************
+* Summary:
+*  Sleeps for the time left until the next frame should be started, as
+*  computed by the frame pacer from the DC interrupt timestamps. Replaces a
+*  fixed delay after every frame, which added to the render and vsync wait
+*  time and pulled the frame rate below the panel refresh rate. Takes the
+*  CPU load sample flagged by the tick hook, between two frames.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void pace_frame(void)
+{
+    uint32_t sleep_us = gfx_port_cycles_to_us(
+                            frame_pacer_frame_done(&frame_pacer, gfx_port_cycles()));
+    TickType_t sleep_ticks = pdMS_TO_TICKS(sleep_us / US_PER_MS);
+
+    if (sleep_ticks > 0U)
+    {
+        vTaskDelay(sleep_ticks);
+    }
+    else
+    {
+        /* Let the equal priority UART CLI task run */
+        taskYIELD();
+    }
+
+#if ( configGENERATE_RUN_TIME_STATS == 1 )
+    if (cpu_load_sample_due)
+    {
+        cpu_load_sample_due = false;
+        sample_cpu_load();
+    }
+#endif /* ( configGENERATE_RUN_TIME_STATS == 1 ) */
+
+    frame_encode_start = gfx_port_cycles();
+}
+
 /*******************************************************************************
 * Function Name: cm55_gfx_task 
 ********************************************************************************
@@ -511,7 +921,10 @@ static void cm55_gfx_task(void *arg)
     event_t receive_event;
     bool success = true;
 
+    gfx_task_handle = xTaskGetCurrentTaskHandle();
+
     /* --- Graphics Subsystem Initialization --- */
+    GFXSS_config.dc_cfg->gfx_layer_config->input_format_type = FRAME_BUFFER_DC_FORMAT;
     status = Cy_GFXSS_Init(base, &GFXSS_config, &gfx_context);
     if (status != CY_GFX_SUCCESS)
     {
@@ -601,55 +1014,67 @@ static void cm55_gfx_task(void *arg)
         vg_params.contiguous_mem_size[VG_PARAMS_POS] = VGLITE_HEAP_SIZE;
 
         vg_lite_init_mem(&vg_params);
+        gpu_heap_init(&gpu_heap, contiguous_mem, VGLITE_HEAP_SIZE);
 
-        error = vg_lite_init(DISP_W, DISP_H);
+        error = vg_lite_set_command_buffer_size(GPU_CMD_BUFFER_SIZE);
+        if (error == VG_LITE_SUCCESS)
+        {
+            error = vg_lite_init(DISP_W, GPU_TESSELLATION_HEIGHT);
+        }
         if (error != VG_LITE_SUCCESS)
         {
             printf("vg_lite engine init failed: %d\r\n", error);
             success = false;
         }
+        else
+        {
+            tess_probe_init(&tess_probe, DISP_W, GPU_TESSELLATION_HEIGHT);
+        }
     }
 
     /* --- Buffers Setup --- */
-    if (success)
+    for (uint32_t i = 0; success && (i < APP_BUFFER_COUNT); i++)
     {
-        buffer0.width  = DISP_W_ACTUAL;
-        buffer0.height = DISP_H;
-        buffer0.format = VG_LITE_BGR565;
-        error = vg_lite_allocate_with_align(&buffer0,ALIGN_128);
+        frame_buffers[i].width  = DISP_W_ACTUAL;
+        frame_buffers[i].height = DISP_H;
+        frame_buffers[i].format = FRAME_BUFFER_FORMAT;
+        error = gpu_heap_allocate(&gpu_heap, &frame_buffers[i], GPU_PLAN_BLOCK_ALIGN,
+                                  GPU_HEAP_TAG_FRAME_BUFFER);
         if (error)
         {
-            printf("Buffer0 allocation failed: %d\r\n", error);
+            printf("Buffer%u allocation failed: %d\r\n", (unsigned int)i, error);
+            gpu_heap_report(&gpu_heap);
             success = false;
         }
-        else
-        {
-            render_target = &buffer0;
-        }
     }
 
     if (success)
     {
-        buffer1.width  = DISP_W_ACTUAL;
-        buffer1.height = DISP_H;
-        buffer1.format = VG_LITE_BGR565;
-        error = vg_lite_allocate_with_align(&buffer1,ALIGN_128);
-        if (error)
+        if (!swap_chain_init(&swap_chain, APP_BUFFER_COUNT,
+                             present_frame_buffer, NULL))
         {
-            printf("Buffer1 allocation failed: %d\r\n", error);
+            printf("Swap chain initialization failed\r\n");
             success = false;
         }
+        else
+        {
+            gpu_submit_init(&gpu_submit, frame_rendered, NULL);
+            render_target = &frame_buffers[swap_chain_acquire(&swap_chain)];
+            frame_encode_start = gfx_port_cycles();
+        }
     }
 
     if (success)
     {
-        intermediate_buffer.width  = DISP_W/2;
-        intermediate_buffer.height = DISP_H/2;
-        intermediate_buffer.format = VG_LITE_BGR565;
-        error = vg_lite_allocate(&intermediate_buffer);
+        intermediate_buffer.width  = INTERMEDIATE_WIDTH;
+        intermediate_buffer.height = INTERMEDIATE_HEIGHT;
+        intermediate_buffer.format = INTERMEDIATE_FORMAT;
+        error = gpu_heap_allocate(&gpu_heap, &intermediate_buffer, 0U,
+                                  GPU_HEAP_TAG_INTERMEDIATE);
         if (error)
         {
             printf("Intermediate buffer allocation failed: %d\r\n", error);
+            gpu_heap_report(&gpu_heap);
             success = false;
         }
     }
@@ -680,6 +1105,10 @@ static void cm55_gfx_task(void *arg)
                               DISP_H / TRANSFORMATION_OFFSET,
                               &matrix);
             vg_lite_scale(DEF_X_SCALE, DEF_Y_SCALE, &matrix);
+            build_demo_scenes();
+            reset_frame_history();
+            gpu_mem_plan_print(&gpu_heap);
+            success = gpu_mem_plan_verify(&gpu_heap);
         }
     }
 
@@ -694,10 +1123,12 @@ static void cm55_gfx_task(void *arg)
                     event_handlers[receive_event.b_event] != NULL)
                 {
                     cancel_requested = false;
+                    reset_frame_history();
+                    frame_stats_set_demo(&frame_stats, (uint8_t)receive_event.b_event);
                     while (!cancel_requested)
                     {
                         event_handlers[receive_event.b_event]();
-                        vTaskDelay(pdMS_TO_TICKS(GFX_TASK_DELAY_MS));
+                        pace_frame();
                     }
                     scale_count = RESET_VAL;
                     zoom_out    = false;
@@ -706,11 +1137,13 @@ static void cm55_gfx_task(void *arg)
                                       DISP_H / TRANSFORMATION_OFFSET,
                                       &matrix);
                     vg_lite_scale(DEF_X_SCALE, DEF_Y_SCALE, &matrix);
+                    reset_frame_history();
+                    frame_stats_set_demo(&frame_stats, (uint8_t)EVENT_DEFAULT);
                 }
             }
 
             default_draw();
-            vTaskDelay(pdMS_TO_TICKS(GFX_TASK_DELAY_MS));
+            pace_frame();
         }
     }
     else
@@ -784,6 +1217,17 @@ int main(void)
     /* Setup the LPTimer instance for CM55*/
     setup_tickless_idle_timer();
 
+    /* Enable the cycle counter used for frame timing statistics */
+    gfx_port_init();
+#if (configUSE_TICKLESS_IDLE != 0)
+    track_sleep_in_cycle_counter();
+#endif /* (configUSE_TICKLESS_IDLE != 0) */
+
+    frame_pacer_init(&frame_pacer, FRAME_PACER_DEFAULT_TARGET,
+                     SystemCoreClock / DISPLAY_REFRESH_HZ);
+    frame_stats_init(&frame_stats);
+    cpu_load_init(&cpu_load);
+
     /* Initialize retarget-io middleware */
     init_retarget_io();
 
@@ -804,7 +1248,7 @@ int main(void)
     task_return = xTaskCreate(uart_cli_handler, UART_CLI_TASK_NAME,
                               UART_CLI_TASK_STACK_SIZE,
                               NULL, UART_CLI_TASK_PRIORITY, NULL);
-    
+
     if (pdPASS == task_return)
     {
         /* Start the RTOS Scheduler */
@@ -821,13 +1265,125 @@ int main(void)
 }
 
 
+/*******************************************************************************
+* Function Name: get_render_target_slot
+********************************************************************************
+* Summary:
+*  Returns the swap chain slot of the current render target, used by the
+*  damage tracker to look up the age of the buffer contents.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  uint8_t - Index of render_target in frame_buffers
+*
+*******************************************************************************/
+uint8_t get_render_target_slot(void)
+{
+    return (uint8_t)(render_target - frame_buffers);
+}
+
+
+/*******************************************************************************
+* Function Name: finish_pending_frames
+********************************************************************************
+* Summary:
+*  Waits for the GPU to complete the frames still pending and hands them to
+*  the swap chain. A frame the GPU has finished can still be pending when
+*  its interrupt was served together with another one, and it holds its
+*  buffer until it is retired.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void finish_pending_frames(void)
+{
+    if (gpu_submit_get_pending(&gpu_submit) > 0U)
+    {
+        (void)vg_lite_finish();
+        gpu_submit_on_idle(&gpu_submit, gfx_port_cycles());
+    }
+}
+
+
+/*******************************************************************************
+* Function Name: fence_frame_buffer
+********************************************************************************
+* Summary:
+*  Records the GPU fence of the render target. Called right before
+*  vg_lite_flush(), whose interrupt may arrive before the flush returns.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void fence_frame_buffer(void)
+{
+    uint8_t slot = (uint8_t)(render_target - frame_buffers);
+
+    frame_fence = gpu_submit_frame(&gpu_submit, slot, frame_encode_start, gfx_port_cycles());
+    if (GPU_SUBMIT_NO_FENCE == frame_fence)
+    {
+        /* Each pending frame holds a buffer of its own, so this is a bug */
+        printf("Error: GPU fence queue full, waiting for the GPU\r\n");
+        finish_pending_frames();
+        frame_fence = gpu_submit_frame(&gpu_submit, slot, frame_encode_start,
+                                       gfx_port_cycles());
+    }
+}
+
+
+/*******************************************************************************
+* Function Name: cancel_frame_fence
+********************************************************************************
+* Summary:
+*  Drops the fence of the render target again after vg_lite_flush() failed.
+*  The render target is kept for the next frame.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void cancel_frame_fence(void)
+{
+    if (!gpu_submit_cancel(&gpu_submit, frame_fence))
+    {
+        printf("Error: fence %u of the failed frame already retired\r\n",
+               (unsigned int)frame_fence);
+    }
+    frame_fence = GPU_SUBMIT_NO_FENCE;
+}
+
+
 /*******************************************************************************
 * Function Name: swap_frame_buffer
 ********************************************************************************
 * Summary:
-*  This function waits for any pending frame buffer operation, sets the 
-*  Video/Graphics layer frame buffer to the display controller, and swaps 
-*  between two render buffers. It also updates the FPS statistics.
+*  This function is called after a frame has been submitted with
+*  vg_lite_flush(). The fence recorded by fence_frame_buffer() queues the
+*  buffer on the swap chain for display once the GPU is done with it. This
+*  acquires the next free buffer as render target so the CPU can encode the
+*  next frame while the GPU is still busy. With more than two buffers the GPU
+*  can keep rendering while earlier frames are still waiting for the display
+*  controller. It also updates the FPS statistics.
+*
+*  When no buffer is free the task first waits for the GPU to complete the
+*  pending frames, then blocks on a task notification given by
+*  dc_irq_handler(), so the wait shows up as idle time and the tickless idle
+*  implementation can put the CPU to sleep until the next DC interrupt. The
+*  time slept is added to the cycle counter timestamps, see
+*  cycle_counter_syspm_callback().
 *
 * Parameters:
 *  void
@@ -838,19 +1394,34 @@ int main(void)
 *******************************************************************************/
 void swap_frame_buffer( void ) 
 {
-    static int current_buffer = RESET_VAL;
+    uint32_t wait_start;
+    uint8_t slot;
 
-    while (fb_pending);
+    frame_fence = GPU_SUBMIT_NO_FENCE;
 
-    fb_pending = true;
-    
-    /* Sets Video/Graphics layer buffer address and transfers the frame buffer
-       to the Display Controller */
-    Cy_GFXSS_Set_FrameBuffer(base, (uint32_t*) render_target->address, &gfx_context);
+    slot = swap_chain_acquire(&swap_chain);
+    if (SWAP_CHAIN_INVALID_SLOT == slot)
+    {
+        wait_start = gfx_port_cycles();
+
+        /* Buffers of pending frames can not be released by the DC */
+        finish_pending_frames();
+        slot = swap_chain_acquire(&swap_chain);
+
+        /* Wait until the DC releases a buffer */
+        while (SWAP_CHAIN_INVALID_SLOT == slot)
+        {
+            if (0U == ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(PRESENT_TIMEOUT_MS)))
+            {
+                printf("Frame present timed out\r\n");
+            }
+            slot = swap_chain_acquire(&swap_chain);
+        }
+
+        present_wait_cycles += gfx_port_cycles() - wait_start;
+    }
 
-    /* Swap buffers */
-    render_target = (current_buffer) ? &buffer0 : &buffer1;
-    current_buffer ^= 1;
+    render_target = &frame_buffers[slot];
 
     /* Update frame rate statistics */
     calculate_fps();
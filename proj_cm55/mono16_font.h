@@ -0,0 +1,1303 @@
+/*******************************************************************************
+* Generated by tools/host/font2vglite from DejaVuSansMono.ttf, DejaVu Sans Mono Book at 16 px,
+* do not edit. The glyphs are subject to the license of the font.
+* Defines the pixel data, include it in one source file only.
+*******************************************************************************/
+
+#ifndef MONO16_FONT_H
+#define MONO16_FONT_H
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+#include <stdint.h>
+#include "text_engine.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+#define MONO16_LINE_HEIGHT                  (19U)
+#define MONO16_ASCENT                       (15U)
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+/* Glyph atlas, 320x57 A8, stride 320, rows of 32 code points */
+CY_SECTION(".cy_socmem_data") uint8_t mono16_pixels[] __attribute__((aligned(128))) =
+{
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xA0,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5C, 0xFF, 0x00, 0x5C, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x68, 0x00, 0x00,
+    0x00, 0x00, 0x07, 0x9B, 0xF0, 0xD4, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x36, 0xC4,
+    0xF5, 0xFF, 0xD4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x7C, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x9E, 0xA9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xF1, 0x41, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0xFF, 0x33, 0x00,
+    0x00, 0x00, 0x28, 0xBB, 0xF5, 0xE8, 0x8C, 0x07, 0x00, 0x00, 0x00, 0x00, 0x38, 0x99, 0xF1, 0xFF,
+    0x20, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x93, 0xDA, 0xF5, 0xD4, 0x6E, 0x03, 0x00, 0x00, 0x00, 0x12,
+    0x7A, 0xD2, 0xF5, 0xD9, 0x7F, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xD0, 0xFF, 0x50,
+    0x00, 0x00, 0x00, 0x60, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x88, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x88,
+    0xE1, 0xF8, 0xC3, 0x2F, 0x00, 0x00, 0x00, 0xE8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x6B, 0x00,
+    0x00, 0x00, 0x53, 0xCB, 0xF3, 0xE7, 0xAA, 0x22, 0x00, 0x00, 0x00, 0x00, 0x64, 0xD8, 0xFA, 0xE4,
+    0x87, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4C, 0xBD, 0xEC, 0xEC, 0xAB, 0x1D, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xA0,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5C, 0xFF, 0x00, 0x5C, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x0F, 0xFC, 0x34, 0x00, 0xDF, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x6A, 0x00, 0x00,
+    0x00, 0x00, 0x7A, 0xB9, 0x12, 0x49, 0xEA, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xE9, 0x9A,
+    0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x7C, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x32, 0xFC, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x81, 0xD1, 0x02,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC2, 0xBA, 0x00, 0x00,
+    0x00, 0x0E, 0xE4, 0xAD, 0x11, 0x32, 0xE9, 0x96, 0x00, 0x00, 0x00, 0x13, 0xC8, 0x67, 0x7F, 0xFF,
+    0x20, 0x00, 0x00, 0x00, 0x00, 0xB8, 0xCE, 0x3D, 0x0B, 0x4C, 0xF4, 0x98, 0x00, 0x00, 0x00, 0x7F,
+    0x7A, 0x29, 0x0A, 0x3F, 0xE9, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x75, 0xEE, 0xFF, 0x50,
+    0x00, 0x00, 0x00, 0x60, 0xFF, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBA, 0xCC,
+    0x32, 0x06, 0x36, 0x8D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0xFF, 0x23, 0x00,
+    0x00, 0x48, 0xFE, 0x83, 0x0E, 0x22, 0xC7, 0xDE, 0x0B, 0x00, 0x00, 0x50, 0xFF, 0x6D, 0x0F, 0x40,
+    0xEB, 0x94, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0xB2, 0x3E, 0x0D, 0x30, 0xDE, 0xCA, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xA0,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5C, 0xFF, 0x00, 0x5C, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x50, 0xED, 0x02, 0x24, 0xFF, 0x1C, 0x00, 0x00, 0x00, 0x40, 0xC1, 0xF5, 0xF4, 0xB2, 0x3C,
+    0x00, 0x00, 0xB0, 0x5B, 0x00, 0x00, 0xD8, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0xFF, 0x47,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x7C, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xA9, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFD, 0x4C,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x6C, 0x9A, 0x1B, 0xA0, 0x44, 0x43, 0xC0, 0x1D, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3B, 0xFF, 0x41, 0x00, 0x00,
+    0x00, 0x71, 0xFC, 0x19, 0x00, 0x00, 0x72, 0xFB, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0xFF,
+    0x20, 0x00, 0x00, 0x00, 0x00, 0x74, 0x09, 0x00, 0x00, 0x00, 0x90, 0xFD, 0x13, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0x15, 0x00, 0x00, 0x00, 0x00, 0x20, 0xF3, 0x72, 0xFF, 0x50,
+    0x00, 0x00, 0x00, 0x60, 0xFF, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0xF7, 0x1B,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xE0, 0xC4, 0x00, 0x00,
+    0x00, 0x9F, 0xF2, 0x01, 0x00, 0x00, 0x50, 0xFF, 0x42, 0x00, 0x00, 0xC6, 0xC7, 0x00, 0x00, 0x00,
+    0x74, 0xFB, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x82, 0xFF, 0x12, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xA0,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5C, 0xFF, 0x00, 0x5C, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x95, 0xAA, 0x00, 0x69, 0xD6, 0x00, 0x00, 0x00, 0x2B, 0xF9, 0x74, 0x69, 0x73, 0x47, 0xB5,
+    0x00, 0x00, 0x7C, 0xB5, 0x11, 0x48, 0xEB, 0x0D, 0x00, 0x00, 0x37, 0x00, 0x00, 0x02, 0xE7, 0x91,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x7C, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x14, 0xFA, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xB2,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xAF, 0xE3, 0xCE, 0x8C, 0x1A, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB4, 0xC8, 0x00, 0x00, 0x00,
+    0x00, 0xB8, 0xD1, 0x00, 0x00, 0x00, 0x2E, 0xFF, 0x5B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0xFF,
+    0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0xFF, 0x2D, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x15, 0x00, 0x00, 0x00, 0x00, 0xB5, 0x9E, 0x40, 0xFF, 0x50,
+    0x00, 0x00, 0x00, 0x60, 0xFF, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAA, 0xB5, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0xFF, 0x66, 0x00, 0x00,
+    0x00, 0x9A, 0xF1, 0x01, 0x00, 0x00, 0x4F, 0xFF, 0x3D, 0x00, 0x00, 0xEE, 0x99, 0x00, 0x00, 0x00,
+    0x3F, 0xFF, 0x53, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0x69,
+    0xC5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4A, 0xAB, 0x44, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xC0, 0xEE, 0x06, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xA0,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9C, 0x00, 0x74, 0xF3, 0x00, 0x60, 0x68, 0x00, 0x00,
+    0x00, 0x00, 0x08, 0x9E, 0xF1, 0xD7, 0x42, 0x00, 0x49, 0xC3, 0xA4, 0x07, 0x00, 0x00, 0x98, 0xFB,
+    0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x56, 0xFF, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0xF4,
+    0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0xAE, 0xE3, 0xCE, 0x8B, 0x19, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xD8, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2E, 0xFF, 0x4F, 0x00, 0x00, 0x00,
+    0x00, 0xDE, 0xB0, 0x00, 0x00, 0x00, 0x0D, 0xFF, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0xFF,
+    0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB2, 0xF8, 0x0C, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x08, 0x45, 0xEC, 0xA2, 0x00, 0x00, 0x00, 0x00, 0x56, 0xF3, 0x19, 0x40, 0xFF, 0x50,
+    0x00, 0x00, 0x00, 0x60, 0xFF, 0xE9, 0xFA, 0xDD, 0x7D, 0x04, 0x00, 0x00, 0x00, 0xDA, 0x92, 0x8F,
+    0xED, 0xF5, 0xBA, 0x2A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9F, 0xF7, 0x10, 0x00, 0x00,
+    0x00, 0x2B, 0xEE, 0x7D, 0x0D, 0x21, 0xC5, 0xBC, 0x01, 0x00, 0x00, 0xEE, 0x98, 0x00, 0x00, 0x00,
+    0x3F, 0xFF, 0x77, 0x00, 0x00, 0x00, 0x00, 0x2C, 0xFF, 0xCC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2C, 0xFF, 0xCC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x32, 0x9A, 0xF3, 0xF5,
+    0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0xC4, 0xFF, 0xDA,
+    0x74, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x91, 0xFD, 0x56, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF3, 0x9A,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x1C, 0xFF, 0x23, 0x01, 0xF1, 0x4B, 0x00, 0x00, 0x00, 0x5F, 0xFE, 0x2E, 0x60, 0x68, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4D, 0xC5, 0x9D, 0x23, 0x00, 0x00, 0x00, 0x6C, 0xFB, 0xDE,
+    0xDB, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x8A, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0xFF,
+    0x2D, 0x00, 0x00, 0x00, 0x00, 0x6C, 0x9B, 0x1B, 0xA0, 0x44, 0x44, 0xC0, 0x1D, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xD8, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA7, 0xD5, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0xEF, 0xA3, 0x15, 0xE4, 0x9C, 0x00, 0xFE, 0x92, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0xFF,
+    0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3D, 0xFE, 0x94, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xE8, 0xFF, 0xFF, 0xA4, 0x04, 0x00, 0x00, 0x00, 0x0F, 0xE6, 0x7B, 0x00, 0x40, 0xFF, 0x50,
+    0x00, 0x00, 0x00, 0x54, 0x6F, 0x19, 0x16, 0x70, 0xFB, 0x9C, 0x00, 0x00, 0x00, 0xED, 0xF0, 0xAB,
+    0x18, 0x20, 0xC0, 0xE2, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xF3, 0xA9, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x42, 0xEC, 0xFF, 0xFF, 0xC0, 0x12, 0x00, 0x00, 0x00, 0xC6, 0xC6, 0x00, 0x00, 0x00,
+    0x74, 0xFF, 0x86, 0x00, 0x00, 0x00, 0x00, 0x2C, 0xFF, 0xCC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x2C, 0xFF, 0xCC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x63, 0xCB, 0xFF, 0xC9, 0x66, 0x0E,
+    0x00, 0x00, 0x50, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x27, 0x8A,
+    0xE8, 0xF8, 0xA5, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6B, 0xFF, 0x68, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE4, 0x8B,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x55, 0xEB, 0x00, 0x2A, 0xFF, 0x14, 0x00, 0x00, 0x00, 0x06, 0xBF, 0xF7, 0xD8, 0xAA, 0x3C, 0x00,
+    0x00, 0x00, 0x00, 0x01, 0x51, 0xC7, 0x96, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x21, 0xFA, 0x69, 0x25,
+    0xF3, 0x9A, 0x00, 0x00, 0xE2, 0x5C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xA1, 0xE5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0xFF,
+    0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xD8, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x23, 0xFC, 0x5D, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xEF, 0xA2, 0x17, 0xE7, 0x9F, 0x00, 0xFF, 0x91, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0xFF,
+    0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0xE0, 0xDA, 0x0D, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0A, 0x49, 0xE6, 0xAB, 0x00, 0x00, 0x00, 0x97, 0xE1, 0x08, 0x00, 0x40, 0xFF, 0x50,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0xFE, 0x1F, 0x00, 0x00, 0xEF, 0xF6, 0x11,
+    0x00, 0x00, 0x2F, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5C, 0xFF, 0x4B, 0x00, 0x00, 0x00,
+    0x00, 0x47, 0xF9, 0x75, 0x0F, 0x23, 0xBF, 0xD4, 0x0C, 0x00, 0x00, 0x53, 0xFF, 0x6A, 0x0E, 0x3F,
+    0xE3, 0xF8, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0xF1, 0xEB, 0x8F, 0x2C, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x04, 0x50, 0xB2, 0xFC, 0xCE, 0x00, 0x00, 0x00, 0x00, 0x05, 0xF0, 0x9D, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD4, 0x7B,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x8C, 0xB3, 0x00, 0x61, 0xDB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x47, 0xAF, 0xE2, 0xF9, 0xC2,
+    0x0E, 0x00, 0x21, 0xC8, 0x90, 0x1A, 0x00, 0x87, 0xEC, 0xDD, 0x51, 0x00, 0x71, 0xEE, 0x03, 0x00,
+    0x61, 0xFF, 0x4D, 0x00, 0xF2, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xA2, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0xFF,
+    0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0x44, 0x00, 0x00, 0x00, 0x00, 0x50, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x38, 0xFF, 0xFF, 0xFF, 0xDC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x99, 0xE0, 0x04, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xDF, 0xB0, 0x00, 0x00, 0x00, 0x0D, 0xFF, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0xFF,
+    0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xC2, 0xEC, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x58, 0xFF, 0x3F, 0x00, 0x23, 0xFD, 0x58, 0x00, 0x00, 0x40, 0xFF, 0x50,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0x51, 0x00, 0x00, 0xE0, 0xD2, 0x00,
+    0x00, 0x00, 0x04, 0xFD, 0x86, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xE8, 0x04, 0x00, 0x00, 0x00,
+    0x00, 0xC9, 0xC8, 0x00, 0x00, 0x00, 0x26, 0xFF, 0x6C, 0x00, 0x00, 0x00, 0x69, 0xDC, 0xFA, 0xD6,
+    0x4C, 0xF5, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0xF1, 0xE6, 0x88, 0x28, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x03, 0x4A, 0xAB, 0xF9, 0xCE, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x68, 0x25, 0xF3,
+    0x86, 0x00, 0x08, 0x16, 0x00, 0x00, 0x5A, 0xCD, 0x19, 0x36, 0xEB, 0x1E, 0x85, 0xE2, 0x00, 0x00,
+    0x00, 0xA8, 0xEA, 0x3C, 0xFC, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x8A, 0xF8, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0xFF,
+    0x2D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xD8, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0xF8, 0x6B, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xB8, 0xD1, 0x00, 0x00, 0x00, 0x2E, 0xFF, 0x5B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0xFF,
+    0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA3, 0xF6, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x2B, 0xFF, 0x68, 0x00, 0x34, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4E, 0xFF, 0x51, 0x00, 0x00, 0xBD, 0xD2, 0x00,
+    0x00, 0x00, 0x04, 0xFD, 0x85, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFD, 0x8E, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xEE, 0xA4, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x93, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x1F, 0xFF, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x64, 0xCC, 0xFF, 0xC6, 0x65, 0x0E,
+    0x00, 0x00, 0x50, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x28, 0x88,
+    0xE6, 0xF8, 0xA6, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0xFF, 0x58, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B,
+    0xFF, 0x24, 0x02, 0xEC, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x68, 0x00, 0xD0,
+    0xA2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x7B, 0x00, 0x00, 0xBC, 0x52, 0x55, 0xFF, 0x2C, 0x00,
+    0x00, 0x0F, 0xE0, 0xF6, 0xA7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x56, 0xFF, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0xF4,
+    0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xD8, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xE9, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x71, 0xFC, 0x19, 0x00, 0x00, 0x72, 0xFC, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0xFF,
+    0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x81, 0xFC, 0x4D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x58, 0xFF, 0x4C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xFF, 0x50,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8D, 0xFE, 0x1E, 0x00, 0x00, 0x7C, 0xF6, 0x11,
+    0x00, 0x00, 0x2F, 0xFF, 0x5C, 0x00, 0x00, 0x00, 0x00, 0x78, 0xFF, 0x2F, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xD0, 0xC9, 0x00, 0x00, 0x00, 0x25, 0xFF, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x7C, 0xE7, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x9B, 0xF4, 0xF6,
+    0x9E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2A, 0xC6, 0xFF, 0xDB,
+    0x75, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xA0,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60,
+    0xDF, 0x00, 0x34, 0xFC, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x73, 0x86, 0x31, 0x68, 0x6F, 0x57, 0xFB,
+    0x4D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5D, 0xCC, 0x18, 0x36, 0xED, 0x23, 0x04, 0xC9, 0xDA, 0x42,
+    0x0A, 0x31, 0xC3, 0xFF, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x14, 0xFA, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC2, 0xB2,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xD8, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0xFF, 0xE4, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2C,
+    0xFF, 0xCC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0xF3, 0x79, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x0F, 0xE4, 0xAD, 0x11, 0x31, 0xE9, 0x96, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0xFF,
+    0x20, 0x00, 0x00, 0x00, 0x00, 0x60, 0xFE, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB7,
+    0x56, 0x1C, 0x0C, 0x49, 0xE4, 0xD1, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xFF, 0x50,
+    0x00, 0x00, 0x00, 0xAC, 0x50, 0x17, 0x13, 0x68, 0xF8, 0x97, 0x00, 0x00, 0x00, 0x16, 0xEC, 0xAB,
+    0x18, 0x1E, 0xBE, 0xDE, 0x07, 0x00, 0x00, 0x00, 0x00, 0xD5, 0xD1, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x64, 0xFF, 0x75, 0x0F, 0x21, 0xBB, 0xF1, 0x1E, 0x00, 0x00, 0x25, 0x88, 0x1D, 0x0D, 0x64,
+    0xF8, 0x57, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2C, 0xFF, 0xCC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x14, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x6A,
+    0xC5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4B, 0xAC, 0x45, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xFF, 0x64, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xA0,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA5,
+    0x9A, 0x00, 0x79, 0xC6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x77, 0xCA, 0xF6, 0xF6, 0xC8, 0x53,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x8C, 0xED, 0xE1, 0x58, 0x00, 0x00, 0x0E, 0x93, 0xE7,
+    0xF7, 0xD5, 0x7E, 0x84, 0xF9, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xA8, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1D, 0xFD, 0x4C,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0xFF, 0xE0, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2C,
+    0xFF, 0xCC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0xF1, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x28, 0xBC, 0xF6, 0xEA, 0x8D, 0x07, 0x00, 0x00, 0x00, 0x00, 0xE4, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x8C, 0x00, 0x00, 0xD0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x48, 0x00, 0x00, 0x31,
+    0xA3, 0xDE, 0xF6, 0xD9, 0x8A, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xFF, 0x50,
+    0x00, 0x00, 0x00, 0x36, 0xB3, 0xE6, 0xF9, 0xD6, 0x73, 0x02, 0x00, 0x00, 0x00, 0x00, 0x2E, 0xBB,
+    0xF4, 0xF4, 0xB5, 0x25, 0x00, 0x00, 0x00, 0x00, 0x35, 0xFF, 0x73, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x5F, 0xCE, 0xF3, 0xE7, 0xAE, 0x29, 0x00, 0x00, 0x00, 0x02, 0x70, 0xDE, 0xF6, 0xC8,
+    0x4E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2C, 0xFF, 0xCC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x16, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xFF, 0x64, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x6A, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x32, 0xFC, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x83, 0xD2, 0x02,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0xFF, 0x89, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xEC, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x42, 0xFF, 0x89, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x68, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x9E, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xF2, 0x41, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0xF8, 0x18, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x7E, 0xF8, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBA, 0x98, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xBA, 0x98, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4B, 0xFF, 0xEA,
+    0x02, 0x00, 0x00, 0x00, 0x00, 0xB4, 0xFF, 0xFF, 0xFE, 0xE8, 0xB3, 0x32, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x63, 0xCE, 0xF6, 0xDF, 0x88, 0x0B, 0x00, 0x00, 0xEC, 0xFF, 0xFC, 0xE9, 0xB0, 0x3C, 0x00,
+    0x00, 0x00, 0x00, 0x74, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x78, 0x00, 0x00, 0x2C, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x0D, 0x8B, 0xDF, 0xF7, 0xD3, 0x6C, 0x03, 0x00,
+    0x00, 0xEC, 0xA8, 0x00, 0x00, 0x00, 0x04, 0xFF, 0x90, 0x00, 0x00, 0x6C, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x0C, 0x00, 0x00, 0x00, 0x14, 0xFF, 0xFF, 0xFF, 0xFF, 0x78, 0x00, 0x00, 0x00, 0xEC,
+    0xA8, 0x00, 0x00, 0x00, 0x0F, 0xCF, 0xDF, 0x1A, 0x00, 0x50, 0xFF, 0x44, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x54, 0xFF, 0xEC, 0x03, 0x00, 0x00, 0x56, 0xFF, 0xF4, 0x00, 0x00, 0xE8, 0xFF, 0x4A,
+    0x00, 0x00, 0x00, 0xF8, 0x8C, 0x00, 0x00, 0x00, 0x38, 0xC4, 0xF6, 0xEB, 0x9A, 0x0F, 0x00, 0x00,
+    0x00, 0x74, 0xFF, 0xFF, 0xFF, 0xED, 0xC6, 0x53, 0x00, 0x00, 0x00, 0x00, 0x38, 0xC4, 0xF6, 0xEB,
+    0x99, 0x0E, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0xF9, 0xD8, 0x87, 0x0D, 0x00, 0x00, 0x00, 0x00,
+    0x44, 0xC1, 0xEF, 0xE6, 0xA8, 0x32, 0x00, 0x00, 0xA0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x44, 0x00, 0xD8, 0xBC, 0x00, 0x00, 0x00, 0x18, 0xFF, 0x7C, 0x00, 0x68, 0xFF, 0x34, 0x00,
+    0x00, 0x00, 0x00, 0x92, 0xFB, 0x0F, 0xED, 0x9A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF6, 0x90,
+    0x17, 0xF0, 0xA7, 0x00, 0x00, 0x00, 0x00, 0xBD, 0xE1, 0x0B, 0x6C, 0xFF, 0x3C, 0x00, 0x00, 0x00,
+    0x00, 0x9D, 0xF4, 0x1A, 0x00, 0x9C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00,
+    0x00, 0x60, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x0B, 0xEC, 0x87, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x4C, 0xFF, 0xFF, 0xFF, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54,
+    0xFD, 0xDD, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0E, 0x88, 0xDB, 0xF7, 0xDB, 0x7F, 0x06, 0x00, 0x00, 0x00, 0x00, 0x97, 0xF0, 0xFF,
+    0x39, 0x00, 0x00, 0x00, 0x00, 0xB4, 0xE4, 0x00, 0x01, 0x1B, 0xA8, 0xEF, 0x1C, 0x00, 0x00, 0x00,
+    0x89, 0xF1, 0x56, 0x0A, 0x2F, 0xCE, 0x64, 0x00, 0x00, 0xEC, 0xA8, 0x03, 0x20, 0x82, 0xFB, 0x5A,
+    0x00, 0x00, 0x00, 0x74, 0xFF, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2C, 0xFF, 0x68,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xCC, 0xD1, 0x34, 0x08, 0x43, 0xE3, 0x3C, 0x00,
+    0x00, 0xEC, 0xA8, 0x00, 0x00, 0x00, 0x04, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x9C,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0xFF, 0x78, 0x00, 0x00, 0x00, 0xEC,
+    0xA8, 0x00, 0x00, 0x09, 0xC1, 0xE8, 0x24, 0x00, 0x00, 0x50, 0xFF, 0x44, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x54, 0xFF, 0xF3, 0x42, 0x00, 0x00, 0xA8, 0xF3, 0xF4, 0x00, 0x00, 0xE8, 0xFF, 0xB1,
+    0x00, 0x00, 0x00, 0xF8, 0x8C, 0x00, 0x00, 0x23, 0xF3, 0x98, 0x0E, 0x29, 0xDA, 0xB7, 0x00, 0x00,
+    0x00, 0x74, 0xFF, 0x20, 0x00, 0x18, 0x98, 0xFF, 0x61, 0x00, 0x00, 0x23, 0xF3, 0x98, 0x0E, 0x29,
+    0xDA, 0xB5, 0x00, 0x00, 0x00, 0xE0, 0xB4, 0x00, 0x08, 0x4B, 0xF0, 0xC2, 0x00, 0x00, 0x00, 0x53,
+    0xFE, 0x77, 0x13, 0x18, 0x94, 0xE7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xA0, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xD8, 0xBC, 0x00, 0x00, 0x00, 0x18, 0xFF, 0x7C, 0x00, 0x1F, 0xFF, 0x76, 0x00,
+    0x00, 0x00, 0x00, 0xD4, 0xC2, 0x00, 0xC8, 0xB7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0xFF, 0x6B,
+    0x00, 0x6E, 0xFF, 0x39, 0x00, 0x00, 0x51, 0xFF, 0x4E, 0x00, 0x04, 0xD7, 0xC5, 0x00, 0x00, 0x00,
+    0x29, 0xFC, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2B, 0xFA, 0xCE, 0x00, 0x00, 0x00,
+    0x00, 0x60, 0xFF, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0xF1, 0x0F, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6C, 0xFF, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0xF7,
+    0x80, 0xC8, 0xCC, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x16, 0xD7, 0xA7, 0x2D, 0x08, 0x32, 0xCC, 0x95, 0x00, 0x00, 0x00, 0x00, 0xE1, 0x91, 0xED,
+    0x85, 0x00, 0x00, 0x00, 0x00, 0xB4, 0xE4, 0x00, 0x00, 0x00, 0x2B, 0xFF, 0x63, 0x00, 0x00, 0x32,
+    0xFE, 0x63, 0x00, 0x00, 0x00, 0x12, 0x48, 0x00, 0x00, 0xEC, 0xA8, 0x00, 0x00, 0x00, 0x99, 0xF0,
+    0x0C, 0x00, 0x00, 0x74, 0xFF, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2C, 0xFF, 0x68,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7D, 0xFA, 0x21, 0x00, 0x00, 0x00, 0x29, 0x32, 0x00,
+    0x00, 0xEC, 0xA8, 0x00, 0x00, 0x00, 0x04, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x9C,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0xFF, 0x78, 0x00, 0x00, 0x00, 0xEC,
+    0xA8, 0x00, 0x04, 0xB3, 0xF0, 0x30, 0x00, 0x00, 0x00, 0x50, 0xFF, 0x44, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x54, 0xFF, 0xAB, 0x93, 0x00, 0x07, 0xF2, 0xAA, 0xF4, 0x00, 0x00, 0xE8, 0xD9, 0xFC,
+    0x1A, 0x00, 0x00, 0xF8, 0x8C, 0x00, 0x00, 0x95, 0xF1, 0x08, 0x00, 0x00, 0x57, 0xFF, 0x36, 0x00,
+    0x00, 0x74, 0xFF, 0x20, 0x00, 0x00, 0x04, 0xE7, 0xCB, 0x00, 0x00, 0x95, 0xF1, 0x08, 0x00, 0x00,
+    0x57, 0xFF, 0x33, 0x00, 0x00, 0xE0, 0xB4, 0x00, 0x00, 0x00, 0x83, 0xFF, 0x33, 0x00, 0x00, 0xC7,
+    0xBB, 0x00, 0x00, 0x00, 0x00, 0x6B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xA0, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xD8, 0xBC, 0x00, 0x00, 0x00, 0x18, 0xFF, 0x7C, 0x00, 0x00, 0xD7, 0xB8, 0x00,
+    0x00, 0x00, 0x16, 0xFF, 0x79, 0x00, 0xA3, 0xD5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0xFF, 0x46,
+    0x00, 0x03, 0xD1, 0xC8, 0x01, 0x07, 0xDD, 0xB0, 0x00, 0x00, 0x00, 0x4C, 0xFF, 0x4F, 0x00, 0x00,
+    0xB0, 0xE4, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC1, 0xFD, 0x36, 0x00, 0x00, 0x00,
+    0x00, 0x60, 0xFF, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0xF3, 0x79, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6C, 0xFF, 0x04, 0x00, 0x00, 0x00, 0x00, 0x2B, 0xEE, 0x76,
+    0x00, 0x0E, 0xC6, 0xB8, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xB1, 0xA2, 0x00, 0x00, 0x00, 0x00, 0x24, 0xFD, 0x0A, 0x00, 0x00, 0x2F, 0xFF, 0x4D, 0xAE,
+    0xD1, 0x00, 0x00, 0x00, 0x00, 0xB4, 0xE4, 0x00, 0x00, 0x00, 0x32, 0xFF, 0x6A, 0x00, 0x00, 0x93,
+    0xF8, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEC, 0xA8, 0x00, 0x00, 0x00, 0x41, 0xFF,
+    0x58, 0x00, 0x00, 0x74, 0xFF, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2C, 0xFF, 0x68,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDF, 0xBB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xEC, 0xA8, 0x00, 0x00, 0x00, 0x04, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x9C,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0xFF, 0x78, 0x00, 0x00, 0x00, 0xEC,
+    0xA8, 0x01, 0xA2, 0xF6, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x50, 0xFF, 0x44, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x54, 0xFF, 0x59, 0xE3, 0x01, 0x4C, 0xD5, 0x84, 0xF4, 0x00, 0x00, 0xE8, 0x9C, 0xD7,
+    0x7D, 0x00, 0x00, 0xF8, 0x8C, 0x00, 0x00, 0xDA, 0xBC, 0x00, 0x00, 0x00, 0x19, 0xFF, 0x7C, 0x00,
+    0x00, 0x74, 0xFF, 0x20, 0x00, 0x00, 0x00, 0xC5, 0xE3, 0x00, 0x00, 0xDA, 0xBC, 0x00, 0x00, 0x00,
+    0x19, 0xFF, 0x7A, 0x00, 0x00, 0xE0, 0xB4, 0x00, 0x00, 0x00, 0x5C, 0xFF, 0x50, 0x00, 0x00, 0xDE,
+    0xA4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xA0, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xD8, 0xBC, 0x00, 0x00, 0x00, 0x18, 0xFF, 0x7C, 0x00, 0x00, 0x8E, 0xF4, 0x05,
+    0x00, 0x00, 0x58, 0xFF, 0x31, 0x00, 0x7E, 0xF2, 0x00, 0x1E, 0xFF, 0xBD, 0x00, 0x4F, 0xFF, 0x20,
+    0x00, 0x00, 0x3D, 0xFF, 0x5A, 0x78, 0xF4, 0x1D, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xD5, 0x03, 0x39,
+    0xFF, 0x5D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xFF, 0x93, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x60, 0xFF, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xE9, 0x09, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6C, 0xFF, 0x04, 0x00, 0x00, 0x00, 0x1B, 0xE2, 0x75, 0x00,
+    0x00, 0x00, 0x0D, 0xC4, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2E, 0xF6, 0x13, 0x00, 0x57, 0xE3, 0xEB, 0x8D, 0xF3, 0x2E, 0x00, 0x00, 0x7B, 0xFC, 0x0F, 0x6C,
+    0xFF, 0x1D, 0x00, 0x00, 0x00, 0xB4, 0xE4, 0x00, 0x01, 0x1E, 0xB3, 0xED, 0x1A, 0x00, 0x00, 0xCA,
+    0xD3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEC, 0xA8, 0x00, 0x00, 0x00, 0x19, 0xFF,
+    0x88, 0x00, 0x00, 0x74, 0xFF, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2C, 0xFF, 0x68,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xEC, 0xA8, 0x00, 0x00, 0x00, 0x04, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x9C,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0xFF, 0x78, 0x00, 0x00, 0x00, 0xEC,
+    0xA8, 0x90, 0xFD, 0x4C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0xFF, 0x44, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x54, 0xFF, 0x21, 0xE5, 0x36, 0x9E, 0x84, 0x84, 0xF4, 0x00, 0x00, 0xE8, 0x9C, 0x72,
+    0xE0, 0x02, 0x00, 0xF8, 0x8C, 0x00, 0x03, 0xFC, 0x9E, 0x00, 0x00, 0x00, 0x01, 0xFA, 0xA2, 0x00,
+    0x00, 0x74, 0xFF, 0x20, 0x00, 0x00, 0x04, 0xE7, 0xC1, 0x00, 0x03, 0xFC, 0x9E, 0x00, 0x00, 0x00,
+    0x01, 0xFA, 0xA1, 0x00, 0x00, 0xE0, 0xB4, 0x00, 0x00, 0x00, 0x7C, 0xFF, 0x31, 0x00, 0x00, 0xAB,
+    0xEE, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xA0, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xD8, 0xBC, 0x00, 0x00, 0x00, 0x18, 0xFF, 0x7C, 0x00, 0x00, 0x45, 0xFF, 0x3B,
+    0x00, 0x00, 0x9A, 0xE7, 0x01, 0x00, 0x58, 0xFF, 0x0F, 0x50, 0xF8, 0xEF, 0x01, 0x6C, 0xF9, 0x02,
+    0x00, 0x00, 0x00, 0xA3, 0xE3, 0xF2, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2E, 0xFD, 0x62, 0xC2,
+    0xCB, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0xEA, 0xE5, 0x0E, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x60, 0xFF, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0xF8, 0x6B, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6C, 0xFF, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x7F, 0xAE, 0x00, 0x25, 0xF7, 0x52, 0x15, 0xB1, 0xFF, 0x34, 0x00, 0x00, 0xC7, 0xCB, 0x00, 0x2A,
+    0xFF, 0x69, 0x00, 0x00, 0x00, 0xB4, 0xFF, 0xFF, 0xFF, 0xFF, 0xE5, 0x3E, 0x00, 0x00, 0x00, 0xE1,
+    0xC1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEC, 0xA8, 0x00, 0x00, 0x00, 0x0A, 0xFF,
+    0x9C, 0x00, 0x00, 0x74, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3C, 0x00, 0x00, 0x2C, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x34, 0x00, 0x2D, 0xFF, 0x79, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xEC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x9C,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0xFF, 0x78, 0x00, 0x00, 0x00, 0xEC,
+    0xF2, 0xFF, 0xFF, 0x4B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0xFF, 0x44, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x54, 0xFF, 0x20, 0x95, 0x8B, 0xEC, 0x32, 0x84, 0xF4, 0x00, 0x00, 0xE8, 0x9C, 0x13,
+    0xF8, 0x49, 0x00, 0xF8, 0x8C, 0x00, 0x0F, 0xFF, 0x93, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xB2, 0x00,
+    0x00, 0x74, 0xFF, 0x20, 0x00, 0x17, 0x98, 0xFF, 0x58, 0x00, 0x0F, 0xFF, 0x93, 0x00, 0x00, 0x00,
+    0x00, 0xF0, 0xB1, 0x00, 0x00, 0xE0, 0xB4, 0x00, 0x06, 0x3F, 0xE9, 0xB2, 0x00, 0x00, 0x00, 0x1E,
+    0xCE, 0xFE, 0xC5, 0x8A, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xA0, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xD8, 0xBC, 0x00, 0x00, 0x00, 0x18, 0xFF, 0x7C, 0x00, 0x00, 0x07, 0xF5, 0x7D,
+    0x00, 0x00, 0xDC, 0x9F, 0x00, 0x00, 0x33, 0xFF, 0x2D, 0x83, 0xA6, 0xF8, 0x24, 0x89, 0xD6, 0x00,
+    0x00, 0x00, 0x00, 0x1E, 0xFF, 0xE5, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9C, 0xF3, 0xFF,
+    0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x98, 0xFF, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x60, 0xFF, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x99, 0xE0, 0x04, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6C, 0xFF, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xAE, 0x7B, 0x00, 0x8E, 0xAD, 0x00, 0x00, 0x22, 0xFF, 0x34, 0x00, 0x14, 0xFD, 0x89, 0x00, 0x00,
+    0xE7, 0xB5, 0x00, 0x00, 0x00, 0xB4, 0xE4, 0x00, 0x01, 0x1B, 0x92, 0xF3, 0x34, 0x00, 0x00, 0xE1,
+    0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEC, 0xA8, 0x00, 0x00, 0x00, 0x08, 0xFF,
+    0x9C, 0x00, 0x00, 0x74, 0xFF, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2C, 0xFF, 0x68,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2D, 0xFF, 0x78, 0x00, 0x00, 0x94, 0xFF, 0xFF, 0xA0, 0x00,
+    0x00, 0xEC, 0xA8, 0x00, 0x00, 0x00, 0x04, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x9C,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0xFF, 0x78, 0x00, 0x00, 0x00, 0xEC,
+    0xFF, 0x67, 0xCD, 0xE4, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x50, 0xFF, 0x44, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x54, 0xFF, 0x20, 0x43, 0xF7, 0xE1, 0x00, 0x84, 0xF4, 0x00, 0x00, 0xE8, 0x9C, 0x00,
+    0xA6, 0xAF, 0x00, 0xF8, 0x8C, 0x00, 0x0F, 0xFF, 0x92, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xB1, 0x00,
+    0x00, 0x74, 0xFF, 0xFF, 0xFF, 0xEF, 0xC8, 0x58, 0x00, 0x00, 0x0F, 0xFF, 0x92, 0x00, 0x00, 0x00,
+    0x00, 0xF0, 0xB0, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0x90, 0x05, 0x00, 0x00, 0x00, 0x00,
+    0x02, 0x3F, 0x86, 0xC8, 0xFF, 0xA3, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xA0, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xD8, 0xBC, 0x00, 0x00, 0x00, 0x18, 0xFF, 0x7C, 0x00, 0x00, 0x00, 0xB4, 0xBF,
+    0x00, 0x1E, 0xFF, 0x57, 0x00, 0x00, 0x0E, 0xFF, 0x4A, 0xB6, 0x68, 0xC8, 0x57, 0xA7, 0xB0, 0x00,
+    0x00, 0x00, 0x00, 0x7B, 0xFB, 0xFF, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xFE, 0xB6,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x36, 0xFD, 0xB2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x60, 0xFF, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x23, 0xFC, 0x5D, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6C, 0xFF, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xC1, 0x66, 0x00, 0xB7, 0x7D, 0x00, 0x00, 0x00, 0xF1, 0x34, 0x00, 0x5F, 0xFF, 0x48, 0x00, 0x00,
+    0xA5, 0xF7, 0x0A, 0x00, 0x00, 0xB4, 0xE4, 0x00, 0x00, 0x00, 0x02, 0xE1, 0xB0, 0x00, 0x00, 0xCB,
+    0xD3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEC, 0xA8, 0x00, 0x00, 0x00, 0x18, 0xFF,
+    0x88, 0x00, 0x00, 0x74, 0xFF, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2C, 0xFF, 0x68,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0xFF, 0x8B, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xA0, 0x00,
+    0x00, 0xEC, 0xA8, 0x00, 0x00, 0x00, 0x04, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x9C,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0xFF, 0x76, 0x00, 0x00, 0x00, 0xEC,
+    0xB2, 0x00, 0x32, 0xFC, 0x9D, 0x00, 0x00, 0x00, 0x00, 0x50, 0xFF, 0x44, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x54, 0xFF, 0x20, 0x04, 0xEC, 0x90, 0x00, 0x84, 0xF4, 0x00, 0x00, 0xE8, 0x9C, 0x00,
+    0x40, 0xFB, 0x19, 0xF8, 0x8C, 0x00, 0x03, 0xFC, 0x9E, 0x00, 0x00, 0x00, 0x00, 0xFA, 0xA2, 0x00,
+    0x00, 0x74, 0xFF, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x9E, 0x00, 0x00, 0x00,
+    0x00, 0xFA, 0x9F, 0x00, 0x00, 0xE0, 0xB4, 0x00, 0x0A, 0x7B, 0xFC, 0x44, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x60, 0xFF, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xA0, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xD6, 0xBC, 0x00, 0x00, 0x00, 0x18, 0xFF, 0x7A, 0x00, 0x00, 0x00, 0x6B, 0xF8,
+    0x08, 0x61, 0xFC, 0x12, 0x00, 0x00, 0x00, 0xE8, 0x67, 0xE9, 0x32, 0x91, 0x8B, 0xC4, 0x8B, 0x00,
+    0x00, 0x00, 0x21, 0xF6, 0x88, 0xB1, 0xD3, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x9C,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xCD, 0xF3, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x60, 0xFF, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA7, 0xD5, 0x01, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6C, 0xFF, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xBF, 0x67, 0x00, 0xB8, 0x7C, 0x00, 0x00, 0x00, 0xF2, 0x34, 0x00, 0xAB, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x4D, 0x00, 0x00, 0xB4, 0xE4, 0x00, 0x00, 0x00, 0x00, 0xBD, 0xDA, 0x00, 0x00, 0x96,
+    0xF8, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEC, 0xA8, 0x00, 0x00, 0x00, 0x41, 0xFF,
+    0x59, 0x00, 0x00, 0x74, 0xFF, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2C, 0xFF, 0x68,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE1, 0xB8, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xA0, 0x00,
+    0x00, 0xEC, 0xA8, 0x00, 0x00, 0x00, 0x04, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x9C,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0xFF, 0x6A, 0x00, 0x00, 0x00, 0xEC,
+    0xA8, 0x00, 0x00, 0x8C, 0xFF, 0x46, 0x00, 0x00, 0x00, 0x50, 0xFF, 0x44, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x54, 0xFF, 0x20, 0x00, 0x00, 0x00, 0x00, 0x84, 0xF4, 0x00, 0x00, 0xE8, 0x9C, 0x00,
+    0x00, 0xD8, 0x7B, 0xF8, 0x8C, 0x00, 0x00, 0xDA, 0xBC, 0x00, 0x00, 0x00, 0x18, 0xFF, 0x7C, 0x00,
+    0x00, 0x74, 0xFF, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD9, 0xBC, 0x00, 0x00, 0x00,
+    0x18, 0xFF, 0x7D, 0x00, 0x00, 0xE0, 0xB4, 0x00, 0x00, 0x00, 0xBB, 0xDD, 0x06, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x01, 0xF7, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xA0, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xCE, 0xBD, 0x00, 0x00, 0x00, 0x19, 0xFF, 0x71, 0x00, 0x00, 0x00, 0x22, 0xFF,
+    0x43, 0xA3, 0xC5, 0x00, 0x00, 0x00, 0x00, 0xC3, 0xA1, 0xF6, 0x04, 0x5A, 0xBE, 0xE1, 0x66, 0x00,
+    0x00, 0x00, 0xB5, 0xE4, 0x0B, 0x28, 0xFB, 0x6D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x9C,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6D, 0xFF, 0x71, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x60, 0xFF, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x4F, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6C, 0xFF, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xA8, 0x81, 0x00, 0x8E, 0xAD, 0x00, 0x00, 0x21, 0xFF, 0x34, 0x05, 0xF1, 0x9F, 0x00, 0x00, 0x00,
+    0x09, 0xF6, 0x99, 0x00, 0x00, 0xB4, 0xE4, 0x00, 0x00, 0x00, 0x00, 0xD8, 0xC9, 0x00, 0x00, 0x38,
+    0xFF, 0x61, 0x00, 0x00, 0x00, 0x12, 0x48, 0x00, 0x00, 0xEC, 0xA8, 0x00, 0x00, 0x00, 0x98, 0xF1,
+    0x0D, 0x00, 0x00, 0x74, 0xFF, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2C, 0xFF, 0x68,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x81, 0xF8, 0x1B, 0x00, 0x00, 0x00, 0xE0, 0xA0, 0x00,
+    0x00, 0xEC, 0xA8, 0x00, 0x00, 0x00, 0x04, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x9C,
+    0x00, 0x00, 0x00, 0x00, 0x20, 0x48, 0x00, 0x00, 0x00, 0x4A, 0xFF, 0x43, 0x00, 0x00, 0x00, 0xEC,
+    0xA8, 0x00, 0x00, 0x0A, 0xDF, 0xE1, 0x0D, 0x00, 0x00, 0x50, 0xFF, 0x44, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x54, 0xFF, 0x20, 0x00, 0x00, 0x00, 0x00, 0x84, 0xF4, 0x00, 0x00, 0xE8, 0x9C, 0x00,
+    0x00, 0x74, 0xDF, 0xF9, 0x8C, 0x00, 0x00, 0x96, 0xF1, 0x08, 0x00, 0x00, 0x55, 0xFF, 0x36, 0x00,
+    0x00, 0x74, 0xFF, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x93, 0xF1, 0x08, 0x00, 0x00,
+    0x55, 0xFF, 0x3C, 0x00, 0x00, 0xE0, 0xB4, 0x00, 0x00, 0x00, 0x3A, 0xFF, 0x68, 0x00, 0x00, 0x77,
+    0x06, 0x00, 0x00, 0x00, 0x11, 0xFE, 0x7A, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xA0, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xB1, 0xD0, 0x00, 0x00, 0x00, 0x2D, 0xFF, 0x55, 0x00, 0x00, 0x00, 0x00, 0xDA,
+    0x84, 0xE4, 0x7D, 0x00, 0x00, 0x00, 0x00, 0x9E, 0xED, 0xC4, 0x00, 0x22, 0xF1, 0xFB, 0x40, 0x00,
+    0x00, 0x53, 0xFF, 0x56, 0x00, 0x00, 0x96, 0xEF, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x9C,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xF0, 0xCD, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x60, 0xFF, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB4, 0xC8, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6C, 0xFF, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x73, 0xBC, 0x00, 0x25, 0xF6, 0x50, 0x14, 0xAF, 0xFF, 0x34, 0x43, 0xFF, 0x57, 0x00, 0x00, 0x00,
+    0x00, 0xB6, 0xE4, 0x00, 0x00, 0xB4, 0xE4, 0x00, 0x00, 0x16, 0x80, 0xFF, 0x62, 0x00, 0x00, 0x00,
+    0x93, 0xF0, 0x54, 0x09, 0x2E, 0xCC, 0x64, 0x00, 0x00, 0xEC, 0xA8, 0x02, 0x1E, 0x81, 0xFC, 0x5D,
+    0x00, 0x00, 0x00, 0x74, 0xFF, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2C, 0xFF, 0x68,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xD1, 0xCA, 0x2F, 0x07, 0x37, 0xF0, 0xA0, 0x00,
+    0x00, 0xEC, 0xA8, 0x00, 0x00, 0x00, 0x04, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x9C,
+    0x00, 0x00, 0x00, 0x00, 0x24, 0xF7, 0x6D, 0x10, 0x20, 0xC5, 0xE3, 0x06, 0x00, 0x00, 0x00, 0xEC,
+    0xA8, 0x00, 0x00, 0x00, 0x48, 0xFF, 0x96, 0x00, 0x00, 0x50, 0xFF, 0x44, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x54, 0xFF, 0x20, 0x00, 0x00, 0x00, 0x00, 0x84, 0xF4, 0x00, 0x00, 0xE8, 0x9C, 0x00,
+    0x00, 0x14, 0xF9, 0xFF, 0x8C, 0x00, 0x00, 0x25, 0xF4, 0x98, 0x0E, 0x27, 0xD9, 0xB8, 0x00, 0x00,
+    0x00, 0x74, 0xFF, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0xF2, 0x98, 0x0E, 0x27,
+    0xD9, 0xC2, 0x00, 0x00, 0x00, 0xE0, 0xB4, 0x00, 0x00, 0x00, 0x00, 0xC3, 0xE0, 0x05, 0x00, 0xC4,
+    0xCA, 0x3C, 0x08, 0x27, 0xB5, 0xF3, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xA0, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x50, 0xFE, 0x73, 0x11, 0x23, 0xBC, 0xE7, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x91,
+    0xE4, 0xFF, 0x34, 0x00, 0x00, 0x00, 0x00, 0x78, 0xFF, 0x8D, 0x00, 0x00, 0xEA, 0xFF, 0x1B, 0x00,
+    0x0C, 0xE3, 0xBD, 0x00, 0x00, 0x00, 0x16, 0xF2, 0x9A, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x9C,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x9F, 0xFC, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x60, 0xFF, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3B, 0xFF, 0x41,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6C, 0xFF, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x1D, 0xF9, 0x25, 0x00, 0x57, 0xE3, 0xEC, 0x8F, 0xEE, 0x34, 0x8E, 0xFD, 0x12, 0x00, 0x00, 0x00,
+    0x00, 0x6D, 0xFF, 0x31, 0x00, 0xB4, 0xFF, 0xFF, 0xFF, 0xF4, 0xC8, 0x5C, 0x00, 0x00, 0x00, 0x00,
+    0x01, 0x69, 0xD1, 0xF7, 0xE0, 0x89, 0x0B, 0x00, 0x00, 0xEC, 0xFF, 0xFD, 0xEA, 0xB2, 0x3F, 0x00,
+    0x00, 0x00, 0x00, 0x74, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9C, 0x00, 0x00, 0x2C, 0xFF, 0x68,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x90, 0xE3, 0xF8, 0xDD, 0x9D, 0x24, 0x00,
+    0x00, 0xEC, 0xA8, 0x00, 0x00, 0x00, 0x04, 0xFF, 0x90, 0x00, 0x00, 0x6C, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x0C, 0x00, 0x01, 0x5B, 0xC3, 0xF0, 0xF4, 0xBB, 0x2C, 0x00, 0x00, 0x00, 0x00, 0xEC,
+    0xA8, 0x00, 0x00, 0x00, 0x00, 0xA5, 0xFE, 0x40, 0x00, 0x50, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xE8, 0x00, 0x54, 0xFF, 0x20, 0x00, 0x00, 0x00, 0x00, 0x84, 0xF4, 0x00, 0x00, 0xE8, 0x9C, 0x00,
+    0x00, 0x00, 0xA7, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x3A, 0xC5, 0xF7, 0xED, 0x9B, 0x0F, 0x00, 0x00,
+    0x00, 0x74, 0xFF, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0xC4, 0xF7, 0xFF,
+    0xD6, 0x13, 0x00, 0x00, 0x00, 0xE0, 0xB4, 0x00, 0x00, 0x00, 0x00, 0x4C, 0xFF, 0x64, 0x00, 0x21,
+    0x91, 0xD7, 0xF7, 0xE2, 0xAA, 0x2C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xA0, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x4D, 0xC8, 0xF3, 0xE7, 0xA7, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48,
+    0xFF, 0xEA, 0x01, 0x00, 0x00, 0x00, 0x00, 0x53, 0xFF, 0x57, 0x00, 0x00, 0xB4, 0xF5, 0x01, 0x00,
+    0x8D, 0xFA, 0x29, 0x00, 0x00, 0x00, 0x00, 0x7B, 0xFD, 0x33, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x9C,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xC8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x24, 0x00, 0x00,
+    0x00, 0x60, 0xFF, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC2, 0xBA,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6C, 0xFF, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x8D, 0xC6, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6C,
+    0xFD, 0x6A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x60, 0xFF, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0xFF,
+    0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6C, 0xFF, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x06, 0xAD, 0xD0, 0x4C, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x81, 0x9D, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x60, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x4C, 0xFF, 0xFF, 0xFF, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x01, 0x5A, 0xBD, 0xEE, 0xF9, 0xCF, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xA4,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x64, 0xF3, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x8D, 0xCD, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4C, 0xFF,
+    0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x4F, 0xD6, 0xFA, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x78, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xB0,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0xFF, 0x20, 0x00, 0x00, 0x00, 0x00, 0x28,
+    0xFF, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x2B, 0xC0, 0xF2, 0xE6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDC, 0x7C, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x44, 0xFC, 0xE6, 0x93, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x02, 0xB1, 0x8E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4C, 0xFF,
+    0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04,
+    0xF3, 0x8D, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x78, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xB0,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0xFF, 0x20, 0x00, 0x00, 0x00, 0x00, 0x28,
+    0xFF, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0xFF, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA4, 0xCC, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xB0, 0xDE, 0x21, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDC, 0x7C, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x07, 0x59, 0xFF, 0x4B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4C, 0xFF,
+    0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20,
+    0xFF, 0x4D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x78, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28,
+    0xFF, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0xFF, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA4, 0xCC, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xD7, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDC, 0x7C, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x65, 0xCA, 0xF5, 0xED,
+    0xAD, 0x26, 0x00, 0x00, 0x00, 0x7C, 0xF4, 0x5D, 0xE2, 0xF8, 0xC2, 0x2C, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x67, 0xD0, 0xF7, 0xDE, 0x86, 0x08, 0x00, 0x00, 0x00, 0x62, 0xDD, 0xF9, 0xCA, 0x7D, 0xFF,
+    0x24, 0x00, 0x00, 0x00, 0x2A, 0xB1, 0xF1, 0xF5, 0xB5, 0x22, 0x00, 0x00, 0x00, 0x78, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x5D, 0xDD, 0xF8, 0xC7, 0x78, 0xFF, 0x24, 0x00,
+    0x00, 0x78, 0xF8, 0x4C, 0xD4, 0xF7, 0xCF, 0x36, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xB0,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC8, 0xFF, 0xFF, 0xFF, 0x20, 0x00, 0x00, 0x00, 0x00, 0x28,
+    0xFF, 0x54, 0x00, 0x00, 0x67, 0xFB, 0x5C, 0x00, 0x00, 0x00, 0x00, 0x70, 0xFF, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x24, 0xFF, 0xA8, 0xEF, 0xC5, 0x69, 0xE6, 0xDE, 0x31, 0x00, 0x00, 0x78, 0xF8, 0x4C,
+    0xD4, 0xF7, 0xCF, 0x36, 0x00, 0x00, 0x00, 0x00, 0x44, 0xC9, 0xF7, 0xED, 0xA4, 0x16, 0x00, 0x00,
+    0x00, 0x84, 0xF0, 0x6E, 0xE4, 0xF7, 0xBE, 0x27, 0x00, 0x00, 0x00, 0x00, 0x4E, 0xD6, 0xF9, 0xD2,
+    0x73, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x2C, 0xFF, 0x4C, 0x87, 0xE8, 0xE8, 0x7A, 0x00, 0x00, 0x00,
+    0x3B, 0xC0, 0xF0, 0xE7, 0xA0, 0x1B, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x10, 0x00, 0x00, 0x78, 0xF8, 0x00, 0x00, 0x00, 0x3C, 0xFF, 0x38, 0x00, 0x12, 0xFA, 0x72, 0x00,
+    0x00, 0x00, 0x00, 0xD0, 0xAF, 0x00, 0xE3, 0x86, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE3, 0x86,
+    0x01, 0xBA, 0xD2, 0x08, 0x00, 0x00, 0x3E, 0xFD, 0x5E, 0x00, 0x0B, 0xF2, 0x86, 0x00, 0x00, 0x00,
+    0x00, 0xB3, 0xD2, 0x00, 0x00, 0x38, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x20, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xDC, 0x9C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDC, 0x7C, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0x97, 0x2C, 0x06, 0x1F,
+    0xB3, 0xE3, 0x07, 0x00, 0x00, 0x7C, 0xFE, 0xCE, 0x26, 0x1B, 0xB8, 0xE4, 0x07, 0x00, 0x00, 0x00,
+    0x8B, 0xF4, 0x61, 0x12, 0x1E, 0x6E, 0x42, 0x00, 0x00, 0x44, 0xFF, 0x70, 0x10, 0x52, 0xF6, 0xFF,
+    0x24, 0x00, 0x00, 0x26, 0xF0, 0xAA, 0x1D, 0x18, 0xA7, 0xDC, 0x05, 0x00, 0x00, 0x00, 0x00, 0x24,
+    0xFF, 0x4C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0xFE, 0x76, 0x11, 0x4D, 0xF3, 0xFF, 0x24, 0x00,
+    0x00, 0x78, 0xFD, 0xBB, 0x20, 0x18, 0xC4, 0xDB, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xB0,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0xFF, 0x20, 0x00, 0x00, 0x00, 0x00, 0x28,
+    0xFF, 0x54, 0x00, 0x6A, 0xFA, 0x59, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0xFF, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x24, 0xFF, 0x77, 0x22, 0xF9, 0xCD, 0x11, 0xB2, 0xAA, 0x00, 0x00, 0x78, 0xFD, 0xBB,
+    0x20, 0x18, 0xC4, 0xDB, 0x02, 0x00, 0x00, 0x33, 0xFB, 0x92, 0x14, 0x2C, 0xD5, 0xCC, 0x02, 0x00,
+    0x00, 0x84, 0xFE, 0xCC, 0x24, 0x1B, 0xBA, 0xDD, 0x04, 0x00, 0x00, 0x29, 0xFB, 0x87, 0x12, 0x42,
+    0xED, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x2C, 0xFF, 0xC8, 0x87, 0x1C, 0x1C, 0x8A, 0x07, 0x00, 0x12,
+    0xF0, 0x91, 0x12, 0x15, 0x5B, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA4, 0xCC, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x78, 0xF8, 0x00, 0x00, 0x00, 0x3C, 0xFF, 0x38, 0x00, 0x00, 0xB4, 0xC8, 0x00,
+    0x00, 0x00, 0x25, 0xFF, 0x57, 0x00, 0xA9, 0xBB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xFF, 0x4C,
+    0x00, 0x18, 0xE9, 0x91, 0x00, 0x10, 0xE1, 0xA5, 0x00, 0x00, 0x00, 0x9B, 0xE2, 0x02, 0x00, 0x00,
+    0x14, 0xFA, 0x6F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC1, 0xEB, 0x0E, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xDC, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDC, 0x7C, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF7, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x3A, 0xFF, 0x39, 0x00, 0x00, 0x7C, 0xFF, 0x42, 0x00, 0x00, 0x23, 0xFF, 0x61, 0x00, 0x00, 0x1F,
+    0xFD, 0x79, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBA, 0xCA, 0x00, 0x00, 0x00, 0x9D, 0xFF,
+    0x24, 0x00, 0x00, 0xAA, 0xE4, 0x08, 0x00, 0x00, 0x0F, 0xF6, 0x60, 0x00, 0x00, 0x00, 0x00, 0x24,
+    0xFF, 0x4C, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB5, 0xCD, 0x00, 0x00, 0x00, 0x9B, 0xFF, 0x24, 0x00,
+    0x00, 0x78, 0xFF, 0x2F, 0x00, 0x00, 0x56, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xB0,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0xFF, 0x20, 0x00, 0x00, 0x00, 0x00, 0x28,
+    0xFF, 0x54, 0x6C, 0xFA, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0xFF, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x24, 0xFF, 0x34, 0x00, 0xD8, 0x90, 0x00, 0x7B, 0xD1, 0x00, 0x00, 0x78, 0xFF, 0x2F,
+    0x00, 0x00, 0x56, 0xFF, 0x1F, 0x00, 0x00, 0xA3, 0xE7, 0x04, 0x00, 0x00, 0x48, 0xFF, 0x45, 0x00,
+    0x00, 0x84, 0xFF, 0x3E, 0x00, 0x00, 0x27, 0xFF, 0x57, 0x00, 0x00, 0x9B, 0xE4, 0x02, 0x00, 0x00,
+    0x83, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x2C, 0xFF, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40,
+    0xFF, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA4, 0xCC, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x78, 0xF8, 0x00, 0x00, 0x00, 0x3C, 0xFF, 0x38, 0x00, 0x00, 0x5B, 0xFF, 0x1F,
+    0x00, 0x00, 0x7C, 0xF4, 0x0A, 0x00, 0x6F, 0xEF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x4D, 0xFF, 0x13,
+    0x00, 0x00, 0x49, 0xFD, 0x48, 0xA7, 0xDD, 0x0E, 0x00, 0x00, 0x00, 0x37, 0xFF, 0x43, 0x00, 0x00,
+    0x6C, 0xF9, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0xFE, 0x47, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xEE, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDC, 0x7C, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEC, 0x89, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x6E, 0xD1, 0xF3, 0xFF,
+    0xFF, 0xFF, 0x46, 0x00, 0x00, 0x7C, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0xEB, 0x91, 0x00, 0x00, 0x60,
+    0xFF, 0x2A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEA, 0x92, 0x00, 0x00, 0x00, 0x63, 0xFF,
+    0x24, 0x00, 0x00, 0xEF, 0x9E, 0x00, 0x00, 0x00, 0x00, 0xD0, 0x92, 0x00, 0x00, 0x00, 0x00, 0x24,
+    0xFF, 0x4C, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE9, 0x92, 0x00, 0x00, 0x00, 0x62, 0xFF, 0x24, 0x00,
+    0x00, 0x78, 0xFD, 0x04, 0x00, 0x00, 0x3D, 0xFF, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xB0,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0xFF, 0x20, 0x00, 0x00, 0x00, 0x00, 0x28,
+    0xFF, 0xBA, 0xFF, 0x9D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0xFF, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x24, 0xFF, 0x28, 0x00, 0xCD, 0x84, 0x00, 0x71, 0xDD, 0x00, 0x00, 0x78, 0xFD, 0x04,
+    0x00, 0x00, 0x3D, 0xFF, 0x35, 0x00, 0x00, 0xD9, 0xAF, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x7C, 0x00,
+    0x00, 0x84, 0xFF, 0x06, 0x00, 0x00, 0x00, 0xEF, 0x88, 0x00, 0x00, 0xCD, 0xAE, 0x00, 0x00, 0x00,
+    0x4B, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x2C, 0xFF, 0x68, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C,
+    0xFA, 0xBF, 0x4A, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA4, 0xCC, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x78, 0xF8, 0x00, 0x00, 0x00, 0x3C, 0xFF, 0x38, 0x00, 0x00, 0x0C, 0xF6, 0x74,
+    0x00, 0x00, 0xD3, 0xA6, 0x00, 0x00, 0x35, 0xFF, 0x25, 0x03, 0xED, 0x90, 0x00, 0x82, 0xD8, 0x00,
+    0x00, 0x00, 0x00, 0x8F, 0xF4, 0xFB, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD3, 0xA1, 0x00, 0x00,
+    0xC8, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4B, 0xFE, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x09, 0x65, 0xFF, 0x4F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDC, 0x7C, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAC, 0xDE, 0x2B, 0x02, 0x00, 0x00, 0x0E, 0x97, 0xE4, 0xF2,
+    0xB0, 0x4E, 0x0C, 0x2D, 0xA6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7D, 0xF6, 0x57, 0x10, 0x00,
+    0x31, 0xFF, 0x48, 0x00, 0x00, 0x7C, 0xF9, 0x00, 0x00, 0x00, 0x00, 0xDA, 0xA7, 0x00, 0x00, 0x73,
+    0xFF, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x81, 0x00, 0x00, 0x00, 0x52, 0xFF,
+    0x24, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAD, 0x00, 0x00, 0x00, 0x00, 0x24,
+    0xFF, 0x4C, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x81, 0x00, 0x00, 0x00, 0x51, 0xFF, 0x24, 0x00,
+    0x00, 0x78, 0xF8, 0x00, 0x00, 0x00, 0x3C, 0xFF, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xB0,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0xFF, 0x20, 0x00, 0x00, 0x00, 0x00, 0x28,
+    0xFF, 0xF7, 0xAD, 0xFB, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0xFF, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x24, 0xFF, 0x28, 0x00, 0xCC, 0x84, 0x00, 0x70, 0xE0, 0x00, 0x00, 0x78, 0xF8, 0x00,
+    0x00, 0x00, 0x3C, 0xFF, 0x38, 0x00, 0x00, 0xE8, 0x9D, 0x00, 0x00, 0x00, 0x00, 0xFA, 0x8C, 0x00,
+    0x00, 0x84, 0xF5, 0x00, 0x00, 0x00, 0x00, 0xDE, 0x9F, 0x00, 0x00, 0xE4, 0x9D, 0x00, 0x00, 0x00,
+    0x3A, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x2C, 0xFF, 0x4D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x4C, 0xC8, 0xFD, 0xFE, 0xC7, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA4, 0xCC, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x78, 0xF8, 0x00, 0x00, 0x00, 0x3C, 0xFF, 0x38, 0x00, 0x00, 0x00, 0xAA, 0xCA,
+    0x00, 0x28, 0xFF, 0x4D, 0x00, 0x00, 0x04, 0xF5, 0x5A, 0x3A, 0xE0, 0xDA, 0x00, 0xB7, 0x9D, 0x00,
+    0x00, 0x00, 0x00, 0x2E, 0xFF, 0xCE, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0xF4, 0x0B, 0x24,
+    0xFF, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0xED, 0xBF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x44,
+    0xFF, 0xFF, 0x96, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDC, 0x7C, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0xD9, 0xFF, 0xE8, 0x00, 0x00, 0x46, 0x6F, 0x1A, 0x13,
+    0x5E, 0xBF, 0xF5, 0xD4, 0x57, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD7, 0x97, 0x00, 0x00, 0x00,
+    0x4D, 0xFF, 0x48, 0x00, 0x00, 0x7C, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0xEB, 0x90, 0x00, 0x00, 0x60,
+    0xFF, 0x2B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE9, 0x92, 0x00, 0x00, 0x00, 0x63, 0xFF,
+    0x24, 0x00, 0x00, 0xF0, 0x89, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24,
+    0xFF, 0x4C, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE9, 0x93, 0x00, 0x00, 0x00, 0x63, 0xFF, 0x24, 0x00,
+    0x00, 0x78, 0xF8, 0x00, 0x00, 0x00, 0x3C, 0xFF, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xB0,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0xFF, 0x20, 0x00, 0x00, 0x00, 0x00, 0x28,
+    0xFF, 0x68, 0x04, 0xC9, 0xDB, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0xFF, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x24, 0xFF, 0x28, 0x00, 0xCC, 0x84, 0x00, 0x70, 0xE0, 0x00, 0x00, 0x78, 0xF8, 0x00,
+    0x00, 0x00, 0x3C, 0xFF, 0x38, 0x00, 0x00, 0xD9, 0xAF, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x7C, 0x00,
+    0x00, 0x84, 0xFF, 0x06, 0x00, 0x00, 0x00, 0xEF, 0x89, 0x00, 0x00, 0xCE, 0xAE, 0x00, 0x00, 0x00,
+    0x4B, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x2C, 0xFF, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0B, 0x52, 0xE2, 0xDC, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA4, 0xCC, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x76, 0xF9, 0x00, 0x00, 0x00, 0x46, 0xFF, 0x38, 0x00, 0x00, 0x00, 0x52, 0xFF,
+    0x20, 0x7F, 0xEF, 0x06, 0x00, 0x00, 0x00, 0xC0, 0x8F, 0x83, 0x78, 0xD8, 0x25, 0xEB, 0x63, 0x00,
+    0x00, 0x00, 0x07, 0xCF, 0xC7, 0xF5, 0x7A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xF8, 0x5E, 0x81,
+    0xE2, 0x02, 0x00, 0x00, 0x00, 0x00, 0x05, 0xC8, 0xE7, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x09, 0x5E, 0xFF, 0x4D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDC, 0x7C, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAD, 0xD9, 0x28, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE2, 0x8C, 0x00, 0x00, 0x00,
+    0x9E, 0xFF, 0x48, 0x00, 0x00, 0x7C, 0xFF, 0x42, 0x00, 0x00, 0x23, 0xFF, 0x5F, 0x00, 0x00, 0x20,
+    0xFD, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB7, 0xC9, 0x00, 0x00, 0x00, 0x9D, 0xFF,
+    0x24, 0x00, 0x00, 0xAD, 0xCA, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24,
+    0xFF, 0x4C, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB5, 0xCD, 0x00, 0x00, 0x00, 0x9C, 0xFF, 0x24, 0x00,
+    0x00, 0x78, 0xF8, 0x00, 0x00, 0x00, 0x3C, 0xFF, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xB0,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0xFF, 0x20, 0x00, 0x00, 0x00, 0x00, 0x28,
+    0xFF, 0x54, 0x00, 0x25, 0xF4, 0x9D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xFF, 0x0D, 0x00, 0x00,
+    0x00, 0x00, 0x24, 0xFF, 0x28, 0x00, 0xCC, 0x84, 0x00, 0x70, 0xE0, 0x00, 0x00, 0x78, 0xF8, 0x00,
+    0x00, 0x00, 0x3C, 0xFF, 0x38, 0x00, 0x00, 0xA4, 0xE7, 0x04, 0x00, 0x00, 0x48, 0xFF, 0x46, 0x00,
+    0x00, 0x84, 0xFF, 0x3E, 0x00, 0x00, 0x26, 0xFF, 0x59, 0x00, 0x00, 0x9E, 0xE3, 0x02, 0x00, 0x00,
+    0x83, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x2C, 0xFF, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x76, 0xFA, 0x03, 0x00, 0x00, 0x00, 0x00, 0x98, 0xD5, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x60, 0xFF, 0x11, 0x00, 0x00, 0x75, 0xFF, 0x38, 0x00, 0x00, 0x00, 0x08, 0xF1,
+    0x76, 0xD5, 0x9C, 0x00, 0x00, 0x00, 0x00, 0x86, 0xC5, 0xCC, 0x2B, 0x8A, 0x91, 0xFF, 0x29, 0x00,
+    0x00, 0x00, 0x93, 0xED, 0x1A, 0x67, 0xFB, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA8, 0xBC, 0xDD,
+    0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x91, 0xFC, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xE9, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDC, 0x7C, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEC, 0x85, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x99, 0xE7, 0x32, 0x10, 0x6B,
+    0xEC, 0xFF, 0x48, 0x00, 0x00, 0x7C, 0xFF, 0xCE, 0x25, 0x1A, 0xB5, 0xE2, 0x06, 0x00, 0x00, 0x00,
+    0x8E, 0xF5, 0x62, 0x12, 0x1C, 0x69, 0x42, 0x00, 0x00, 0x42, 0xFF, 0x6E, 0x0F, 0x52, 0xF6, 0xFF,
+    0x24, 0x00, 0x00, 0x2A, 0xF3, 0x9A, 0x22, 0x0B, 0x35, 0x98, 0x54, 0x00, 0x00, 0x00, 0x00, 0x24,
+    0xFF, 0x4C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xFF, 0x76, 0x10, 0x4C, 0xEF, 0xFF, 0x24, 0x00,
+    0x00, 0x78, 0xF8, 0x00, 0x00, 0x00, 0x3C, 0xFF, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xB0,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0xFF, 0x20, 0x00, 0x00, 0x00, 0x00, 0x28,
+    0xFF, 0x54, 0x00, 0x00, 0x68, 0xFF, 0x53, 0x00, 0x00, 0x00, 0x00, 0x24, 0xFB, 0x76, 0x04, 0x00,
+    0x00, 0x00, 0x24, 0xFF, 0x28, 0x00, 0xCC, 0x84, 0x00, 0x70, 0xE0, 0x00, 0x00, 0x78, 0xF8, 0x00,
+    0x00, 0x00, 0x3C, 0xFF, 0x38, 0x00, 0x00, 0x35, 0xFC, 0x92, 0x14, 0x2C, 0xD5, 0xCE, 0x03, 0x00,
+    0x00, 0x84, 0xFE, 0xCC, 0x24, 0x1B, 0xB8, 0xDF, 0x05, 0x00, 0x00, 0x2B, 0xFC, 0x85, 0x11, 0x41,
+    0xED, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x2C, 0xFF, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4D,
+    0x97, 0x33, 0x0A, 0x29, 0xD0, 0xB6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6A, 0xFB, 0x3E, 0x03, 0x00,
+    0x00, 0x00, 0x00, 0x22, 0xFC, 0x8B, 0x0D, 0x3A, 0xDE, 0xFF, 0x38, 0x00, 0x00, 0x00, 0x00, 0xA1,
+    0xE6, 0xFF, 0x44, 0x00, 0x00, 0x00, 0x00, 0x4C, 0xF8, 0xDD, 0x00, 0x3D, 0xF7, 0xED, 0x01, 0x00,
+    0x00, 0x4F, 0xFF, 0x53, 0x00, 0x00, 0xB0, 0xE0, 0x11, 0x00, 0x00, 0x00, 0x00, 0x44, 0xFF, 0xFE,
+    0x20, 0x00, 0x00, 0x00, 0x00, 0x44, 0xFF, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xDC, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDC, 0x7C, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF7, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x9F, 0xEC, 0xF3, 0xB5,
+    0x4D, 0xFF, 0x48, 0x00, 0x00, 0x7C, 0xF4, 0x6B, 0xE4, 0xF8, 0xC1, 0x2B, 0x00, 0x00, 0x00, 0x00,
+    0x01, 0x6A, 0xD2, 0xF8, 0xDF, 0x80, 0x07, 0x00, 0x00, 0x00, 0x61, 0xDE, 0xF9, 0xCA, 0x7D, 0xFF,
+    0x24, 0x00, 0x00, 0x00, 0x2B, 0xAD, 0xED, 0xF5, 0xCA, 0x69, 0x07, 0x00, 0x00, 0x00, 0x00, 0x24,
+    0xFF, 0x4C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xDF, 0xF8, 0xC5, 0x74, 0xFF, 0x1E, 0x00,
+    0x00, 0x78, 0xF8, 0x00, 0x00, 0x00, 0x3C, 0xFF, 0x38, 0x00, 0x00, 0x9C, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0xFF, 0x20, 0x00, 0x00, 0x00, 0x00, 0x28,
+    0xFF, 0x54, 0x00, 0x00, 0x00, 0xB4, 0xED, 0x1B, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xDE, 0xFE, 0xFF,
+    0x14, 0x00, 0x24, 0xFF, 0x28, 0x00, 0xCC, 0x84, 0x00, 0x70, 0xE0, 0x00, 0x00, 0x78, 0xF8, 0x00,
+    0x00, 0x00, 0x3C, 0xFF, 0x38, 0x00, 0x00, 0x00, 0x47, 0xCA, 0xF8, 0xEF, 0xA5, 0x17, 0x00, 0x00,
+    0x00, 0x84, 0xF0, 0x70, 0xE5, 0xF8, 0xBF, 0x28, 0x00, 0x00, 0x00, 0x00, 0x50, 0xD7, 0xF9, 0xD2,
+    0x72, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x2C, 0xFF, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06,
+    0x68, 0xCC, 0xF5, 0xE3, 0x98, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x9D, 0xE8, 0xFE, 0xFF,
+    0x10, 0x00, 0x00, 0x00, 0x65, 0xE1, 0xF7, 0xBC, 0x61, 0xFF, 0x38, 0x00, 0x00, 0x00, 0x00, 0x48,
+    0xFF, 0xE8, 0x03, 0x00, 0x00, 0x00, 0x00, 0x12, 0xFE, 0x92, 0x00, 0x03, 0xEB, 0xB5, 0x00, 0x00,
+    0x1C, 0xED, 0x9E, 0x00, 0x00, 0x00, 0x14, 0xE6, 0xAD, 0x00, 0x00, 0x00, 0x00, 0x01, 0xE7, 0xBB,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x68, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x20, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xDC, 0x9C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDC, 0x7C, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6C, 0xF8, 0x03, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x84, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x34, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1D, 0xFD, 0x55,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xD7, 0xA3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDC, 0x7C, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xA9, 0x36, 0x0A, 0x34, 0xDD, 0x97, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0xBC, 0xCE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x84, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x34, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xA7, 0xE0, 0x04,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xB1, 0xDD, 0x1F, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDC, 0x7C, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x06, 0x59, 0xFF, 0x4C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0xCB, 0xF5, 0xDC, 0x85, 0x09, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xF9, 0xC6, 0x2B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x84, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x34, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xFD, 0xD2, 0x33, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x2D, 0xC3, 0xF3, 0xE7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDC, 0x7C, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x44, 0xFD, 0xE7, 0x97, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDC, 0x7C, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+const image_asset_t mono16_atlas =
+{
+    .name          = "mono16",
+    .format        = VG_LITE_A8,
+    .width         = 320,
+    .height        = 57,
+    .stride        = 320,
+    .data          = mono16_pixels,
+    .clut          = NULL,
+    .clut_count    = 0U,
+    .tint          = 0xFF000000U,
+    .premultiplied = false,
+    .next_level    = NULL
+};
+
+/* Cells of the characters 32 to 126: x, y, advance, ink */
+const font_glyph_t mono16_glyphs[95U] =
+{
+    {   0,   0, 10, false },  /*   */
+    {  10,   0, 10, true  },  /* ! */
+    {  20,   0, 10, true  },  /* " */
+    {  30,   0, 10, true  },  /* # */
+    {  40,   0, 10, true  },  /* $ */
+    {  50,   0, 10, true  },  /* % */
+    {  60,   0, 10, true  },  /* & */
+    {  70,   0, 10, true  },  /* ' */
+    {  80,   0, 10, true  },  /* ( */
+    {  90,   0, 10, true  },  /* ) */
+    { 100,   0, 10, true  },  /* * */
+    { 110,   0, 10, true  },  /* + */
+    { 120,   0, 10, true  },  /* , */
+    { 130,   0, 10, true  },  /* - */
+    { 140,   0, 10, true  },  /* . */
+    { 150,   0, 10, true  },  /* / */
+    { 160,   0, 10, true  },  /* 0 */
+    { 170,   0, 10, true  },  /* 1 */
+    { 180,   0, 10, true  },  /* 2 */
+    { 190,   0, 10, true  },  /* 3 */
+    { 200,   0, 10, true  },  /* 4 */
+    { 210,   0, 10, true  },  /* 5 */
+    { 220,   0, 10, true  },  /* 6 */
+    { 230,   0, 10, true  },  /* 7 */
+    { 240,   0, 10, true  },  /* 8 */
+    { 250,   0, 10, true  },  /* 9 */
+    { 260,   0, 10, true  },  /* : */
+    { 270,   0, 10, true  },  /* ; */
+    { 280,   0, 10, true  },  /* < */
+    { 290,   0, 10, true  },  /* = */
+    { 300,   0, 10, true  },  /* > */
+    { 310,   0, 10, true  },  /* ? */
+    {   0,  19, 10, true  },  /* @ */
+    {  10,  19, 10, true  },  /* A */
+    {  20,  19, 10, true  },  /* B */
+    {  30,  19, 10, true  },  /* C */
+    {  40,  19, 10, true  },  /* D */
+    {  50,  19, 10, true  },  /* E */
+    {  60,  19, 10, true  },  /* F */
+    {  70,  19, 10, true  },  /* G */
+    {  80,  19, 10, true  },  /* H */
+    {  90,  19, 10, true  },  /* I */
+    { 100,  19, 10, true  },  /* J */
+    { 110,  19, 10, true  },  /* K */
+    { 120,  19, 10, true  },  /* L */
+    { 130,  19, 10, true  },  /* M */
+    { 140,  19, 10, true  },  /* N */
+    { 150,  19, 10, true  },  /* O */
+    { 160,  19, 10, true  },  /* P */
+    { 170,  19, 10, true  },  /* Q */
+    { 180,  19, 10, true  },  /* R */
+    { 190,  19, 10, true  },  /* S */
+    { 200,  19, 10, true  },  /* T */
+    { 210,  19, 10, true  },  /* U */
+    { 220,  19, 10, true  },  /* V */
+    { 230,  19, 10, true  },  /* W */
+    { 240,  19, 10, true  },  /* X */
+    { 250,  19, 10, true  },  /* Y */
+    { 260,  19, 10, true  },  /* Z */
+    { 270,  19, 10, true  },  /* [ */
+    { 280,  19, 10, true  },  /* \ */
+    { 290,  19, 10, true  },  /* ] */
+    { 300,  19, 10, true  },  /* ^ */
+    { 310,  19, 10, true  },  /* _ */
+    {   0,  38, 10, true  },  /* ` */
+    {  10,  38, 10, true  },  /* a */
+    {  20,  38, 10, true  },  /* b */
+    {  30,  38, 10, true  },  /* c */
+    {  40,  38, 10, true  },  /* d */
+    {  50,  38, 10, true  },  /* e */
+    {  60,  38, 10, true  },  /* f */
+    {  70,  38, 10, true  },  /* g */
+    {  80,  38, 10, true  },  /* h */
+    {  90,  38, 10, true  },  /* i */
+    { 100,  38, 10, true  },  /* j */
+    { 110,  38, 10, true  },  /* k */
+    { 120,  38, 10, true  },  /* l */
+    { 130,  38, 10, true  },  /* m */
+    { 140,  38, 10, true  },  /* n */
+    { 150,  38, 10, true  },  /* o */
+    { 160,  38, 10, true  },  /* p */
+    { 170,  38, 10, true  },  /* q */
+    { 180,  38, 10, true  },  /* r */
+    { 190,  38, 10, true  },  /* s */
+    { 200,  38, 10, true  },  /* t */
+    { 210,  38, 10, true  },  /* u */
+    { 220,  38, 10, true  },  /* v */
+    { 230,  38, 10, true  },  /* w */
+    { 240,  38, 10, true  },  /* x */
+    { 250,  38, 10, true  },  /* y */
+    { 260,  38, 10, true  },  /* z */
+    { 270,  38, 10, true  },  /* { */
+    { 280,  38, 10, true  },  /* | */
+    { 290,  38, 10, true  },  /* } */
+    { 300,  38, 10, true  },  /* ~ */
+};
+
+const font_asset_t mono16_font =
+{
+    .name        = "mono16",
+    .atlas       = &mono16_atlas,
+    .glyphs      = mono16_glyphs,
+    .first_char  = 32U,
+    .glyph_count = 95U,
+    .line_height = 19U,
+    .ascent      = 15U
+};
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* MONO16_FONT_H */
+
+/* [] END OF FILE */
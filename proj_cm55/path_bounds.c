@@ -0,0 +1,410 @@
+/*******************************************************************************
+* File Name        : path_bounds.c
+*
+* Description      : This file contains the path bounds engine. The bounding box of a
+*                    path sizes the area the GPU tessellates, so the declared boxes of the
+*                    demo paths are fitted to the control points of their segments, and
+*                    draws that cannot touch a visible pixel are not issued at all.
+*
+* Related Document : See README.md
+*
+********************************************************************************
+* Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+
+#include <math.h>
+#include <string.h>
+#include "path_bounds.h"
+#include "path_narrow.h"
+
+
+/*******************************************************************************
+* Function Name: add_point
+********************************************************************************
+* Summary:
+*  Grows a bounding box to include a point.
+*
+* Parameters:
+*  bounds - Bounding box, left, top, right, bottom
+*  first  - true if this is the first point, the box is then initialized
+*  x, y   - Point
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void add_point(vg_lite_float_t bounds[4], bool first, int32_t x, int32_t y)
+{
+    if (first || ((vg_lite_float_t)x < bounds[0])) { bounds[0] = (vg_lite_float_t)x; }
+    if (first || ((vg_lite_float_t)y < bounds[1])) { bounds[1] = (vg_lite_float_t)y; }
+    if (first || ((vg_lite_float_t)x > bounds[2])) { bounds[2] = (vg_lite_float_t)x; }
+    if (first || ((vg_lite_float_t)y > bounds[3])) { bounds[3] = (vg_lite_float_t)y; }
+}
+
+/*******************************************************************************
+* Function Name: path_bounds_compute
+********************************************************************************
+* Summary:
+*  Computes the bounds of all end and control points of a path. Curves lie
+*  within the hull of their control points, so the result contains the
+*  whole shape. Relative segments are resolved against the current point,
+*  which VLC_OP_CLOSE moves back to the start of the sub-path.
+*
+* Parameters:
+*  path   - Path with integer data
+*  bounds - Output bounds, left, top, right, bottom
+*
+* Return:
+*  bool   - false if the path has no points or an unsupported opcode
+*
+*******************************************************************************/
+bool path_bounds_compute(const vg_lite_path_t *path, vg_lite_float_t bounds[4])
+{
+    uint32_t count = path_data_count(path);
+    uint32_t i = 0U;
+    uint32_t points;
+    int32_t opcode;
+    int32_t x = 0;
+    int32_t y = 0;
+    int32_t start_x = 0;
+    int32_t start_y = 0;
+    int32_t px = 0;
+    int32_t py = 0;
+    bool relative;
+    bool first = true;
+
+    while (i < count)
+    {
+        opcode = path_data_get(path, i++);
+        switch (opcode)
+        {
+            case VLC_OP_MOVE:
+            case VLC_OP_MOVE_REL:
+            case VLC_OP_LINE:
+            case VLC_OP_LINE_REL:
+                points = 1U;
+                break;
+
+            case VLC_OP_QUAD:
+            case VLC_OP_QUAD_REL:
+                points = 2U;
+                break;
+
+            case VLC_OP_CUBIC:
+            case VLC_OP_CUBIC_REL:
+                points = 3U;
+                break;
+
+            case VLC_OP_CLOSE:
+                x = start_x;
+                y = start_y;
+                points = 0U;
+                break;
+
+            default:
+                points = 0U;
+                break;
+        }
+
+        /* All points of a relative segment are relative to its start */
+        relative = (VLC_OP_MOVE_REL == opcode) || (VLC_OP_LINE_REL == opcode) ||
+                   (VLC_OP_QUAD_REL == opcode) || (VLC_OP_CUBIC_REL == opcode);
+        for (uint32_t p = 0U; p < points; p++)
+        {
+            px = path_data_get(path, i++);
+            py = path_data_get(path, i++);
+            if (relative)
+            {
+                px += x;
+                py += y;
+            }
+            add_point(bounds, first, px, py);
+            first = false;
+        }
+
+        if (0U != points)
+        {
+            x = px;
+            y = py;
+            if ((VLC_OP_MOVE == opcode) || (VLC_OP_MOVE_REL == opcode))
+            {
+                start_x = x;
+                start_y = y;
+            }
+        }
+    }
+
+    return !first;
+}
+
+/*******************************************************************************
+* Function Name: path_bounds_init
+********************************************************************************
+* Summary:
+*  Initializes the bounds engine without tracked paths and without scissor.
+*
+* Parameters:
+*  bounds - Pointer to the bounds engine
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void path_bounds_init(path_bounds_t *bounds)
+{
+    memset(bounds, 0, sizeof(*bounds));
+}
+
+/*******************************************************************************
+* Function Name: find_entry
+********************************************************************************
+* Summary:
+*  Looks up the declared bounds of a path.
+*
+* Parameters:
+*  bounds - Pointer to the bounds engine
+*  path   - Path
+*
+* Return:
+*  const path_bounds_entry_t* - Entry of the path, NULL if it is not tracked
+*
+*******************************************************************************/
+static const path_bounds_entry_t *find_entry(const path_bounds_t *bounds,
+                                             const vg_lite_path_t *path)
+{
+    for (uint8_t i = 0; i < bounds->count; i++)
+    {
+        if (bounds->entries[i].path == path)
+        {
+            return &bounds->entries[i];
+        }
+    }
+
+    return NULL;
+}
+
+/*******************************************************************************
+* Function Name: path_bounds_fit
+********************************************************************************
+* Summary:
+*  Replaces the declared bounding box of a path with the bounds of its
+*  points. Declared boxes are often placeholders, larger than the shape or,
+*  like the one of the logo, too small for it. The declared box is kept to
+*  report the tessellation area saved.
+*
+* Parameters:
+*  bounds - Pointer to the bounds engine
+*  path   - Path, drawn with the new bounding box from now on
+*
+* Return:
+*  bool   - false if the bounds could not be computed or the path could not
+*           be tracked, the path is then left unchanged
+*
+*******************************************************************************/
+bool path_bounds_fit(path_bounds_t *bounds, vg_lite_path_t *path)
+{
+    path_bounds_entry_t *entry;
+    vg_lite_float_t box[4];
+
+    if (NULL != find_entry(bounds, path))
+    {
+        return true;
+    }
+
+    if ((bounds->count >= PATH_BOUNDS_MAX_ENTRIES) || !path_bounds_compute(path, box))
+    {
+        return false;
+    }
+
+    entry = &bounds->entries[bounds->count++];
+    entry->path = path;
+    memcpy(entry->declared, path->bounding_box, sizeof(entry->declared));
+
+    memcpy(path->bounding_box, box, sizeof(box));
+
+    return true;
+}
+
+/*******************************************************************************
+* Function Name: path_bounds_set_scissor
+********************************************************************************
+* Summary:
+*  Tells the bounds engine about the scissor rectangle set with
+*  vg_lite_set_scissor(), so that draws outside of it are culled as well.
+*
+* Parameters:
+*  bounds  - Pointer to the bounds engine
+*  scissor - Enabled scissor rectangle, NULL when the scissor is disabled
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void path_bounds_set_scissor(path_bounds_t *bounds, const damage_rect_t *scissor)
+{
+    bounds->scissor_enabled = (NULL != scissor);
+    if (NULL != scissor)
+    {
+        bounds->scissor = *scissor;
+    }
+}
+
+/*******************************************************************************
+* Function Name: box_on_target
+********************************************************************************
+* Summary:
+*  Transforms a bounding box and clips it to the visible area.
+*
+* Parameters:
+*  box     - Bounding box, left, top, right, bottom
+*  matrix  - Draw matrix
+*  visible - Visible area of the target
+*
+* Return:
+*  damage_rect_t - Part of the visible area the GPU tessellates, may be empty
+*
+*******************************************************************************/
+static damage_rect_t box_on_target(const vg_lite_float_t box[4], const vg_lite_matrix_t *matrix,
+                                   const damage_rect_t *visible)
+{
+    damage_rect_t rect = damage_rect_transform(matrix->m,
+                                               (int32_t)floorf(box[0]), (int32_t)floorf(box[1]),
+                                               (int32_t)ceilf(box[2]), (int32_t)ceilf(box[3]));
+
+    (void)damage_rect_intersect(&rect, visible, &rect);
+
+    return rect;
+}
+
+/*******************************************************************************
+* Function Name: path_bounds_visible
+********************************************************************************
+* Summary:
+*  Checks whether a draw can touch a pixel of the target inside the scissor,
+*  and counts the tessellation area saved compared with the declared bounds.
+*  A draw whose declared box was too small counts as a negative saving.
+*
+* Parameters:
+*  bounds - Pointer to the bounds engine
+*  path   - Path about to be drawn
+*  matrix - Draw matrix
+*  target - Render target
+*  area   - Output area the GPU tessellates, may be NULL
+*
+* Return:
+*  bool   - false if the draw is to be skipped
+*
+*******************************************************************************/
+bool path_bounds_visible(path_bounds_t *bounds, const vg_lite_path_t *path,
+                         const vg_lite_matrix_t *matrix, const vg_lite_buffer_t *target,
+                         damage_rect_t *area)
+{
+    const path_bounds_entry_t *entry = find_entry(bounds, path);
+    damage_rect_t visible = { 0, 0, target->width, target->height };
+    damage_rect_t tight;
+    damage_rect_t declared;
+    uint32_t tight_area;
+    uint32_t declared_area;
+
+    if (bounds->scissor_enabled)
+    {
+        (void)damage_rect_intersect(&visible, &bounds->scissor, &visible);
+    }
+
+    tight = box_on_target(path->bounding_box, matrix, &visible);
+    tight_area = damage_rect_area(&tight);
+    if (NULL != entry)
+    {
+        declared = box_on_target(entry->declared, matrix, &visible);
+        declared_area = damage_rect_area(&declared);
+        bounds->stats.area_saved += (int32_t)declared_area - (int32_t)tight_area;
+    }
+
+    if (NULL != area)
+    {
+        *area = tight;
+    }
+
+    bounds->stats.draws++;
+    if (0U == tight_area)
+    {
+        bounds->stats.culled++;
+    }
+
+    return (0U != tight_area);
+}
+
+/*******************************************************************************
+* Function Name: path_bounds_end_frame
+********************************************************************************
+* Summary:
+*  Counts a frame for the per frame statistics.
+*
+* Parameters:
+*  bounds - Pointer to the bounds engine
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void path_bounds_end_frame(path_bounds_t *bounds)
+{
+    bounds->stats.frames++;
+}
+
+/*******************************************************************************
+* Function Name: path_bounds_get_stats
+********************************************************************************
+* Summary:
+*  Returns the culling statistics, optionally resetting them.
+*
+* Parameters:
+*  bounds - Pointer to the bounds engine
+*  stats  - Output statistics
+*  reset  - true to clear the statistics after reading them
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void path_bounds_get_stats(path_bounds_t *bounds, path_bounds_stats_t *stats, bool reset)
+{
+    *stats = bounds->stats;
+
+    if (reset)
+    {
+        memset(&bounds->stats, 0, sizeof(bounds->stats));
+    }
+}
+
+/* [] END OF FILE */
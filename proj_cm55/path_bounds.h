@@ -0,0 +1,110 @@
+/*******************************************************************************
+* File Name        : path_bounds.h
+*
+* Description      : This file contains the declarations of the path bounds engine. It
+*                    computes the control point bounds of path data, fits the declared
+*                    bounding boxes of the demo paths to them, and culls draws whose
+*                    transformed bounds fall outside the render target or the scissor.
+*
+* Related Document : See README.md
+*
+********************************************************************************
+* Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+
+#ifndef PATH_BOUNDS_H
+#define PATH_BOUNDS_H
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include <stdint.h>
+#include <stdbool.h>
+#include "vg_lite.h"
+#include "damage_tracker.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+
+/* Number of paths whose declared bounds can be tracked */
+#define PATH_BOUNDS_MAX_ENTRIES             (16U)
+
+/*******************************************************************************
+* Data Structures and Types
+*******************************************************************************/
+
+typedef struct {
+    vg_lite_path_t *path;
+    vg_lite_float_t declared[4];    /* Bounding box before it was tightened */
+} path_bounds_entry_t;
+
+typedef struct {
+    uint32_t draws;             /* Draws checked */
+    uint32_t culled;            /* Draws outside the target or the scissor */
+    int32_t area_saved;         /* Pixels not tessellated, compared with the declared bounds */
+    uint32_t frames;
+} path_bounds_stats_t;
+
+typedef struct {
+    path_bounds_entry_t entries[PATH_BOUNDS_MAX_ENTRIES];
+    uint8_t count;
+    bool scissor_enabled;
+    damage_rect_t scissor;
+    path_bounds_stats_t stats;
+} path_bounds_t;
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+bool path_bounds_compute(const vg_lite_path_t *path, vg_lite_float_t bounds[4]);
+void path_bounds_init(path_bounds_t *bounds);
+bool path_bounds_fit(path_bounds_t *bounds, vg_lite_path_t *path);
+void path_bounds_set_scissor(path_bounds_t *bounds, const damage_rect_t *scissor);
+bool path_bounds_visible(path_bounds_t *bounds, const vg_lite_path_t *path,
+                         const vg_lite_matrix_t *matrix, const vg_lite_buffer_t *target,
+                         damage_rect_t *area);
+void path_bounds_end_frame(path_bounds_t *bounds);
+void path_bounds_get_stats(path_bounds_t *bounds, path_bounds_stats_t *stats, bool reset);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* PATH_BOUNDS_H */
+
+/* [] END OF FILE */
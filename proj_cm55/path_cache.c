@@ -0,0 +1,407 @@
+/*******************************************************************************
+* File Name        : path_cache.c
+*
+* Description      : This file contains the path cache. Paths are uploaded to the
+*                    VGLite heap when they are registered and again only when their
+*                    path_changed flag is set. The least recently used paths are evicted
+*                    to stay within the memory budget.
+*
+* Related Document : See README.md
+*
+********************************************************************************
+* Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+
+#include <string.h>
+#include "path_cache.h"
+
+
+/*******************************************************************************
+* Function Name: find_entry
+********************************************************************************
+* Summary:
+*  Looks up the entry of a path by its address.
+*
+* Parameters:
+*  cache - Pointer to the path cache
+*  path  - Path
+*
+* Return:
+*  path_cache_entry_t* - Entry of the path, NULL if it is not tracked
+*
+*******************************************************************************/
+static path_cache_entry_t *find_entry(path_cache_t *cache, const vg_lite_path_t *path)
+{
+    for (uint8_t i = 0; i < cache->count; i++)
+    {
+        if (cache->entries[i].path == path)
+        {
+            return &cache->entries[i];
+        }
+    }
+
+    return NULL;
+}
+
+/*******************************************************************************
+* Function Name: release_entry
+********************************************************************************
+* Summary:
+*  Frees the uploaded copy of a path. The draw then copies the path data into
+*  the command buffer again. If the copy may still be referenced by the frame
+*  being encoded or by the frame the GPU is executing, the GPU is drained
+*  first.
+*
+*  vg_lite_clear_path() is issued on a temporary path owning only the uploaded
+*  memory, since it also drops the data pointer of the path it is given.
+*
+* Parameters:
+*  cache - Pointer to the path cache
+*  entry - Resident entry
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void release_entry(path_cache_t *cache, path_cache_entry_t *entry)
+{
+    vg_lite_path_t owner;
+
+    if (entry->drawn && ((entry->last_frame + 1U) >= cache->frame))
+    {
+        (void)vg_lite_finish();
+        cache->stats.stalls++;
+    }
+
+    memset(&owner, 0, sizeof(owner));
+    owner.uploaded = entry->path->uploaded;
+    (void)gpu_heap_clear_path(cache->heap, &owner);
+
+    memset(&entry->path->uploaded, 0, sizeof(entry->path->uploaded));
+    cache->used -= entry->bytes;
+    entry->bytes = 0U;
+}
+
+/*******************************************************************************
+* Function Name: evict_lru
+********************************************************************************
+* Summary:
+*  Releases the least recently used resident path other than the one being
+*  uploaded.
+*
+* Parameters:
+*  cache - Pointer to the path cache
+*  keep  - Entry that must not be evicted
+*
+* Return:
+*  bool  - false if no other path is resident
+*
+*******************************************************************************/
+static bool evict_lru(path_cache_t *cache, const path_cache_entry_t *keep)
+{
+    path_cache_entry_t *victim = NULL;
+
+    for (uint8_t i = 0; i < cache->count; i++)
+    {
+        path_cache_entry_t *entry = &cache->entries[i];
+
+        if ((entry != keep) && (0U != entry->bytes) &&
+            ((NULL == victim) || (entry->last_used < victim->last_used)))
+        {
+            victim = entry;
+        }
+    }
+
+    if (NULL == victim)
+    {
+        return false;
+    }
+
+    release_entry(cache, victim);
+    cache->stats.evictions++;
+
+    return true;
+}
+
+/*******************************************************************************
+* Function Name: upload_entry
+********************************************************************************
+* Summary:
+*  Uploads the data of a path to the VGLite heap, replacing an outdated
+*  upload and evicting other paths if the budget requires it.
+*
+* Parameters:
+*  cache - Pointer to the path cache
+*  entry - Entry of the path
+*
+* Return:
+*  bool  - true if the path is resident
+*
+*******************************************************************************/
+static bool upload_entry(path_cache_t *cache, path_cache_entry_t *entry)
+{
+    vg_lite_path_t *path = entry->path;
+    uint32_t needed = path->path_length + PATH_CACHE_UPLOAD_OVERHEAD;
+
+    if (0U != entry->bytes)
+    {
+        release_entry(cache, entry);
+    }
+
+    if (needed > cache->budget)
+    {
+        cache->stats.failures++;
+        return false;
+    }
+
+    while ((cache->used + needed) > cache->budget)
+    {
+        if (!evict_lru(cache, entry))
+        {
+            break;
+        }
+    }
+
+    if (VG_LITE_SUCCESS != gpu_heap_upload_path(cache->heap, path))
+    {
+        memset(&path->uploaded, 0, sizeof(path->uploaded));
+        cache->stats.failures++;
+        return false;
+    }
+
+    entry->bytes = (0U != path->uploaded.bytes) ? path->uploaded.bytes : needed;
+    cache->used += entry->bytes;
+    path->path_changed = 0;
+    cache->stats.uploads++;
+
+    return true;
+}
+
+/*******************************************************************************
+* Function Name: path_cache_init
+********************************************************************************
+* Summary:
+*  Initializes an empty path cache.
+*
+* Parameters:
+*  cache  - Pointer to the path cache
+*  budget - VGLite heap available to uploaded paths in bytes
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void path_cache_init(path_cache_t *cache, uint32_t budget)
+{
+    memset(cache, 0, sizeof(*cache));
+    cache->budget = budget;
+}
+
+/*******************************************************************************
+* Function Name: path_cache_set_heap
+********************************************************************************
+* Summary:
+*  Accounts the uploads of the cache in a heap. To be called before the paths
+*  are registered.
+*
+* Parameters:
+*  cache - Pointer to the path cache
+*  heap  - Heap accounting, NULL for none
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void path_cache_set_heap(path_cache_t *cache, gpu_heap_t *heap)
+{
+    cache->heap = heap;
+}
+
+/*******************************************************************************
+* Function Name: path_cache_register
+********************************************************************************
+* Summary:
+*  Starts tracking a path and uploads it if it fits in the budget. To be called
+*  when the assets are loaded, in order of priority.
+*
+* Parameters:
+*  cache - Pointer to the path cache
+*  path  - Path with static data
+*
+* Return:
+*  bool  - true if the path is resident
+*
+*******************************************************************************/
+bool path_cache_register(path_cache_t *cache, vg_lite_path_t *path)
+{
+    path_cache_entry_t *entry = find_entry(cache, path);
+
+    if (NULL == entry)
+    {
+        if (cache->count >= PATH_CACHE_MAX_ENTRIES)
+        {
+            return false;
+        }
+
+        entry = &cache->entries[cache->count++];
+        memset(entry, 0, sizeof(*entry));
+        entry->path = path;
+    }
+    else if ((0U != entry->bytes) && (0 == path->path_changed))
+    {
+        return true;
+    }
+
+    entry->last_used = cache->tick;
+
+    return upload_entry(cache, entry);
+}
+
+/*******************************************************************************
+* Function Name: path_cache_use
+********************************************************************************
+* Summary:
+*  Prepares a tracked path for a draw. A resident, unchanged path is a hit,
+*  otherwise the path is uploaded again. Paths that are not tracked are left
+*  to the driver.
+*
+* Parameters:
+*  cache - Pointer to the path cache
+*  path  - Path about to be drawn
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void path_cache_use(path_cache_t *cache, vg_lite_path_t *path)
+{
+    path_cache_entry_t *entry = find_entry(cache, path);
+    bool resident;
+
+    if (NULL == entry)
+    {
+        return;
+    }
+
+    if ((0U != entry->bytes) && (0 == path->path_changed))
+    {
+        cache->stats.hits++;
+        resident = true;
+    }
+    else
+    {
+        cache->stats.misses++;
+        resident = upload_entry(cache, entry);
+    }
+
+    entry->last_used  = ++cache->tick;
+    entry->last_frame = cache->frame;
+    entry->drawn      = true;
+
+    if (resident)
+    {
+        cache->stats.bytes_saved += path->path_length;
+    }
+}
+
+/*******************************************************************************
+* Function Name: path_cache_end_frame
+********************************************************************************
+* Summary:
+*  Ends the frame whose commands were just submitted.
+*
+* Parameters:
+*  cache - Pointer to the path cache
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void path_cache_end_frame(path_cache_t *cache)
+{
+    cache->frame++;
+    cache->stats.frames++;
+}
+
+/*******************************************************************************
+* Function Name: path_cache_release
+********************************************************************************
+* Summary:
+*  Frees all uploaded paths and stops tracking them.
+*
+* Parameters:
+*  cache - Pointer to the path cache
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void path_cache_release(path_cache_t *cache)
+{
+    for (uint8_t i = 0; i < cache->count; i++)
+    {
+        if (0U != cache->entries[i].bytes)
+        {
+            release_entry(cache, &cache->entries[i]);
+        }
+    }
+
+    cache->count = 0U;
+}
+
+/*******************************************************************************
+* Function Name: path_cache_get_stats
+********************************************************************************
+* Summary:
+*  Returns the cache statistics, optionally resetting them.
+*
+* Parameters:
+*  cache - Pointer to the path cache
+*  stats - Output statistics
+*  reset - true to clear the statistics after reading them
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void path_cache_get_stats(path_cache_t *cache, path_cache_stats_t *stats, bool reset)
+{
+    *stats = cache->stats;
+
+    if (reset)
+    {
+        memset(&cache->stats, 0, sizeof(cache->stats));
+    }
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,128 @@
+/*******************************************************************************
+* File Name        : path_cache.h
+*
+* Description      : This file contains the declarations of the path cache. The
+*                    path cache keeps the data of the demo paths uploaded to the VGLite
+*                    heap, so that draws reference it instead of copying it into the
+*                    command buffer, and evicts the least recently used paths when the
+*                    memory budget is exceeded.
+*
+* Related Document : See README.md
+*
+********************************************************************************
+* Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+
+#ifndef PATH_CACHE_H
+#define PATH_CACHE_H
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include <stdint.h>
+#include <stdbool.h>
+#include "vg_lite.h"
+#include "gpu_heap.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+
+/* Number of paths that can be tracked */
+#define PATH_CACHE_MAX_ENTRIES              (16U)
+
+/* VGLite heap reserved for uploaded paths. Can be overridden from the
+ * Makefile, e.g. DEFINES+=PATH_CACHE_BUDGET_BYTES=4096U */
+#ifndef PATH_CACHE_BUDGET_BYTES
+#define PATH_CACHE_BUDGET_BYTES             ((8U) * (1024U))
+#endif
+
+/* Estimate of the command header and alignment the driver adds to an upload */
+#define PATH_CACHE_UPLOAD_OVERHEAD          (64U)
+
+/*******************************************************************************
+* Data Structures and Types
+*******************************************************************************/
+
+typedef struct {
+    vg_lite_path_t *path;
+    uint32_t bytes;             /* Heap used by the upload, 0 if not resident */
+    uint32_t last_used;         /* Cache tick of the last draw */
+    uint32_t last_frame;        /* Frame of the last draw */
+    bool drawn;                 /* Referenced by a command since registration */
+} path_cache_entry_t;
+
+typedef struct {
+    uint32_t hits;              /* Draws of resident, unchanged paths */
+    uint32_t misses;            /* Draws that had to (re)upload the path */
+    uint32_t uploads;
+    uint32_t evictions;
+    uint32_t failures;          /* Uploads that did not fit or failed */
+    uint32_t stalls;            /* Waits for the GPU before freeing a path */
+    uint32_t bytes_saved;       /* Path data not copied into the command buffer */
+    uint32_t frames;
+} path_cache_stats_t;
+
+typedef struct {
+    path_cache_entry_t entries[PATH_CACHE_MAX_ENTRIES];
+    uint8_t count;
+    uint32_t budget;
+    uint32_t used;              /* Heap used by all resident paths */
+    uint32_t tick;
+    uint32_t frame;
+    gpu_heap_t *heap;           /* Accounts the uploads, NULL if none */
+    path_cache_stats_t stats;
+} path_cache_t;
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+void path_cache_init(path_cache_t *cache, uint32_t budget);
+void path_cache_set_heap(path_cache_t *cache, gpu_heap_t *heap);
+bool path_cache_register(path_cache_t *cache, vg_lite_path_t *path);
+void path_cache_use(path_cache_t *cache, vg_lite_path_t *path);
+void path_cache_end_frame(path_cache_t *cache);
+void path_cache_release(path_cache_t *cache);
+void path_cache_get_stats(path_cache_t *cache, path_cache_stats_t *stats, bool reset);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* PATH_CACHE_H */
+
+/* [] END OF FILE */
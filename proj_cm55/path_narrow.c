@@ -0,0 +1,281 @@
+/*******************************************************************************
+* File Name        : path_narrow.c
+*
+* Description      : This file contains the path format narrowing pass. Every
+*                    element of the path data, opcodes included, is stored in the data
+*                    type of the path format, so a path whose values all fit in a
+*                    narrower type can be rewritten element by element, in place.
+*
+* Related Document : See README.md
+*
+********************************************************************************
+* Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+
+#include <string.h>
+#include "path_narrow.h"
+
+
+/*******************************************************************************
+* Function Name: path_format_size
+********************************************************************************
+* Summary:
+*  Returns the size of one data element of an integer path format.
+*
+* Parameters:
+*  format   - Path format
+*
+* Return:
+*  uint32_t - Size in bytes, 0 if the format is not an integer format
+*
+*******************************************************************************/
+uint32_t path_format_size(vg_lite_format_t format)
+{
+    switch (format)
+    {
+        case VG_LITE_S8:  return sizeof(int8_t);
+        case VG_LITE_S16: return sizeof(int16_t);
+        case VG_LITE_S32: return sizeof(int32_t);
+        default:          return 0U;
+    }
+}
+
+/*******************************************************************************
+* Function Name: path_data_get
+********************************************************************************
+* Summary:
+*  Reads one element of the data of an integer path.
+*
+* Parameters:
+*  path     - Path
+*  index    - Element index
+*
+* Return:
+*  int32_t  - Element value
+*
+*******************************************************************************/
+int32_t path_data_get(const vg_lite_path_t *path, uint32_t index)
+{
+    const uint8_t *data = (const uint8_t *)path->path;
+    int8_t value8;
+    int16_t value16;
+    int32_t value32 = 0;
+
+    switch (path->format)
+    {
+        case VG_LITE_S8:
+            memcpy(&value8, &data[index * sizeof(value8)], sizeof(value8));
+            value32 = value8;
+            break;
+
+        case VG_LITE_S16:
+            memcpy(&value16, &data[index * sizeof(value16)], sizeof(value16));
+            value32 = value16;
+            break;
+
+        case VG_LITE_S32:
+            memcpy(&value32, &data[index * sizeof(value32)], sizeof(value32));
+            break;
+
+        default:
+            break;
+    }
+
+    return value32;
+}
+
+/*******************************************************************************
+* Function Name: path_data_count
+********************************************************************************
+* Summary:
+*  Returns the number of data elements of an integer path up to and including
+*  its VLC_OP_END opcode.
+*
+* Parameters:
+*  path     - Path
+*
+* Return:
+*  uint32_t - Number of elements, 0 if the format is not an integer format or
+*             the data holds an unknown opcode
+*
+*******************************************************************************/
+uint32_t path_data_count(const vg_lite_path_t *path)
+{
+    uint32_t size = path_format_size(path->format);
+    uint32_t length = (0U != size) ? (path->path_length / size) : 0U;
+    uint32_t i = 0U;
+
+    while (i < length)
+    {
+        int32_t opcode = path_data_get(path, i++);
+
+        switch (opcode)
+        {
+            case VLC_OP_END:
+                return i;
+
+            case VLC_OP_CLOSE:
+                break;
+
+            case VLC_OP_MOVE:
+            case VLC_OP_MOVE_REL:
+            case VLC_OP_LINE:
+            case VLC_OP_LINE_REL:
+                i += 2U;
+                break;
+
+            case VLC_OP_QUAD:
+            case VLC_OP_QUAD_REL:
+                i += 4U;
+                break;
+
+            case VLC_OP_CUBIC:
+            case VLC_OP_CUBIC_REL:
+                i += 6U;
+                break;
+
+            default:
+                return 0U;
+        }
+    }
+
+    /* No VLC_OP_END within path_length */
+    return 0U;
+}
+
+/*******************************************************************************
+* Function Name: path_narrow_format
+********************************************************************************
+* Summary:
+*  Finds the narrowest format holding every value of an integer path.
+*
+* Parameters:
+*  path             - Path
+*
+* Return:
+*  vg_lite_format_t - Narrowest format, the current format if the path cannot
+*                     be narrowed
+*
+*******************************************************************************/
+vg_lite_format_t path_narrow_format(const vg_lite_path_t *path)
+{
+    uint32_t count = path_data_count(path);
+    int32_t min = 0;
+    int32_t max = 0;
+
+    if (0U == count)
+    {
+        return path->format;
+    }
+
+    for (uint32_t i = 0; i < count; i++)
+    {
+        int32_t value = path_data_get(path, i);
+
+        min = (value < min) ? value : min;
+        max = (value > max) ? value : max;
+    }
+
+    if ((min >= INT8_MIN) && (max <= INT8_MAX))
+    {
+        return VG_LITE_S8;
+    }
+    if ((min >= INT16_MIN) && (max <= INT16_MAX))
+    {
+        return VG_LITE_S16;
+    }
+
+    return VG_LITE_S32;
+}
+
+/*******************************************************************************
+* Function Name: path_narrow
+********************************************************************************
+* Summary:
+*  Rewrites the data of an integer path in place in the narrowest format and
+*  updates format and path_length. Elements only move towards the start of
+*  the buffer, so each one is read before it is overwritten. Anything after
+*  VLC_OP_END is dropped. The path must not be uploaded and its data must be
+*  writable.
+*
+* Parameters:
+*  path - Path
+*
+* Return:
+*  bool - true if the path was narrowed
+*
+*******************************************************************************/
+bool path_narrow(vg_lite_path_t *path)
+{
+    vg_lite_format_t format = path_narrow_format(path);
+    uint32_t count = path_data_count(path);
+    uint32_t size = path_format_size(format);
+    uint32_t length = count * size;
+    uint8_t *data = (uint8_t *)path->path;
+
+    if ((path_format_size(format) >= path_format_size(path->format)) ||
+        (NULL != path->uploaded.handle))
+    {
+        return false;
+    }
+
+    for (uint32_t i = 0; i < count; i++)
+    {
+        int32_t value = path_data_get(path, i);
+        int8_t value8 = (int8_t)value;
+        int16_t value16 = (int16_t)value;
+
+        if (VG_LITE_S8 == format)
+        {
+            memcpy(&data[i * size], &value8, size);
+        }
+        else
+        {
+            memcpy(&data[i * size], &value16, size);
+        }
+    }
+
+    /* Pad with VLC_OP_END within the original data */
+    while ((0U != (length % PATH_NARROW_LENGTH_ALIGN)) && (length < path->path_length))
+    {
+        data[length++] = (uint8_t)VLC_OP_END;
+    }
+
+    path->format       = format;
+    path->path_length  = length;
+    path->path_changed = 1;
+
+    return true;
+}
+
+/* [] END OF FILE */
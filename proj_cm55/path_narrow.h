@@ -0,0 +1,81 @@
+/*******************************************************************************
+* File Name        : path_narrow.h
+*
+* Description      : This file contains the declarations of the path format
+*                    narrowing pass. It rewrites the data of an integer path in the
+*                    narrowest VGLite coordinate format its values fit in, keeping the
+*                    opcodes and values unchanged.
+*
+* Related Document : See README.md
+*
+********************************************************************************
+* Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+
+#ifndef PATH_NARROW_H
+#define PATH_NARROW_H
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include <stdint.h>
+#include <stdbool.h>
+#include "vg_lite.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+
+/* Narrowed data is padded with VLC_OP_END to a multiple of this size */
+#define PATH_NARROW_LENGTH_ALIGN            (4U)
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+uint32_t path_format_size(vg_lite_format_t format);
+int32_t path_data_get(const vg_lite_path_t *path, uint32_t index);
+uint32_t path_data_count(const vg_lite_path_t *path);
+vg_lite_format_t path_narrow_format(const vg_lite_path_t *path);
+bool path_narrow(vg_lite_path_t *path);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* PATH_NARROW_H */
+
+/* [] END OF FILE */
@@ -0,0 +1,392 @@
+/*******************************************************************************
+* File Name        : perf_hud.c
+*
+* Description      : This file contains the performance HUD. It shows the values of the FPS
+*                    line in a corner of the screen and changes its text at most once per
+*                    period. The text is part of the frame fingerprint and the HUD reports its
+*                    rectangle to the damage tracker, so an unchanged HUD adds no frames and
+*                    demos tracking damage repaint only its rectangle when it changes.
+*
+* Related Document : See README.md
+*
+********************************************************************************
+* Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include <stdio.h>
+#include <string.h>
+#include "gfx_port.h"
+#include "perf_hud.h"
+#include "gpu_profile.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+#define PERF_HUD_BYTES_PER_KB               (1024U)
+
+
+/*******************************************************************************
+* Function Name: layout_lines
+********************************************************************************
+* Summary:
+*  Formats the last sample into the lines of the HUD.
+*
+* Parameters:
+*  hud    - HUD
+*
+* Return:
+*  bool   - true if the text of any line changed
+*
+*******************************************************************************/
+static bool layout_lines(perf_hud_t *hud)
+{
+    const perf_hud_sample_t *s = &hud->sample;
+    char text[PERF_HUD_LINES][TEXT_RUN_MAX_LENGTH + 1U];
+    bool changed = false;
+
+    if (!hud->sample_valid)
+    {
+        (void)snprintf(text[0], sizeof(text[0]), "FPS    --  CPU  --");
+        (void)snprintf(text[1], sizeof(text[1]), "GPU  --  Heap    --");
+        (void)snprintf(text[2], sizeof(text[2]), "HUD    -- us  -- kpx");
+    }
+    else
+    {
+        (void)snprintf(text[0], sizeof(text[0]), "FPS %3u.%u  CPU %3u%%",
+                       (unsigned int)(s->fps_x_1000 / 1000U),
+                       (unsigned int)((s->fps_x_1000 % 1000U) / 100U),
+                       (unsigned int)s->cpu_percent);
+        (void)snprintf(text[1], sizeof(text[1]), "GPU %3u%%  Heap %4uK",
+                       (unsigned int)s->gpu_percent,
+                       (unsigned int)(s->heap_used_bytes / PERF_HUD_BYTES_PER_KB));
+        (void)snprintf(text[2], sizeof(text[2]), "HUD %3u.%u us %3u kpx",
+                       (unsigned int)(s->hud_cpu_ns / 1000U),
+                       (unsigned int)((s->hud_cpu_ns % 1000U) / 100U),
+                       (unsigned int)(s->hud_pixels / 1000U));
+    }
+
+    for (uint8_t i = 0; i < PERF_HUD_LINES; i++)
+    {
+        changed = text_run_set(&hud->lines[i], text[i]) || changed;
+    }
+
+    return changed;
+}
+
+/*******************************************************************************
+* Function Name: perf_hud_init
+********************************************************************************
+* Summary:
+*  Initializes the HUD in the top right corner of the screen. The rectangle
+*  holds PERF_HUD_COLUMNS of the widest glyph of the font.
+*
+* Parameters:
+*  hud          - HUD to be initialized
+*  font         - Font of the text
+*  screen_width - Width of the render target
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void perf_hud_init(perf_hud_t *hud, text_font_t *font, int32_t screen_width)
+{
+    const font_asset_t *asset = font->asset;
+    int32_t advance = 0;
+    int32_t width;
+    int32_t height;
+
+    memset(hud, 0, sizeof(*hud));
+    hud->enabled   = PERF_HUD_ENABLED;
+    hud->period_ms = PERF_HUD_PERIOD_MS;
+
+    for (uint8_t g = 0; g < asset->glyph_count; g++)
+    {
+        advance = (asset->glyphs[g].advance > advance) ? asset->glyphs[g].advance : advance;
+    }
+    width  = ((int32_t)PERF_HUD_COLUMNS * advance) + (2 * PERF_HUD_PADDING);
+    height = ((int32_t)PERF_HUD_LINES * asset->line_height) + (2 * PERF_HUD_PADDING);
+
+    hud->rect.x1 = screen_width - PERF_HUD_MARGIN;
+    hud->rect.x0 = hud->rect.x1 - width;
+    hud->rect.y0 = PERF_HUD_MARGIN;
+    hud->rect.y1 = hud->rect.y0 + height;
+
+    for (uint8_t i = 0; i < PERF_HUD_LINES; i++)
+    {
+        text_run_init(&hud->lines[i], font);
+    }
+    (void)layout_lines(hud);
+}
+
+/*******************************************************************************
+* Function Name: perf_hud_set_enabled
+********************************************************************************
+* Summary:
+*  Shows or hides the HUD from the next frame on. Safe to call from another
+*  task than the render task.
+*
+* Parameters:
+*  hud     - HUD
+*  enabled - true to show the HUD
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void perf_hud_set_enabled(perf_hud_t *hud, bool enabled)
+{
+    hud->enabled = enabled;
+}
+
+/*******************************************************************************
+* Function Name: perf_hud_set_period
+********************************************************************************
+* Summary:
+*  Sets the shortest time between two changes of the text. The text cannot
+*  change faster than the FPS line is computed. Safe to call from another
+*  task than the render task.
+*
+* Parameters:
+*  hud       - HUD
+*  period_ms - Period in milliseconds
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void perf_hud_set_period(perf_hud_t *hud, uint32_t period_ms)
+{
+    hud->period_ms = period_ms;
+}
+
+/*******************************************************************************
+* Function Name: perf_hud_sample
+********************************************************************************
+* Summary:
+*  Hands the values of a new FPS line to the HUD. They are shown by the
+*  first frame after the period has elapsed.
+*
+* Parameters:
+*  hud    - HUD
+*  sample - Values of the FPS line
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void perf_hud_sample(perf_hud_t *hud, const perf_hud_sample_t *sample)
+{
+    hud->sample         = *sample;
+    hud->sample_valid   = true;
+    hud->sample_pending = true;
+}
+
+/*******************************************************************************
+* Function Name: perf_hud_begin_frame
+********************************************************************************
+* Summary:
+*  Latches the enabled state for the frame being built and lays out the last
+*  sample if the period has elapsed since the text last changed.
+*
+* Parameters:
+*  hud      - HUD
+*  now_ms   - Current time
+*
+* Return:
+*  bool     - true if the HUD is shown in this frame
+*
+*******************************************************************************/
+bool perf_hud_begin_frame(perf_hud_t *hud, uint32_t now_ms)
+{
+    uint32_t start = gfx_port_cycles();
+
+    hud->shown = hud->enabled;
+    if (hud->shown && hud->sample_pending &&
+        ((now_ms - hud->last_change_ms) >= hud->period_ms))
+    {
+        hud->sample_pending = false;
+        if (layout_lines(hud))
+        {
+            hud->last_change_ms = now_ms;
+            hud->version++;
+            hud->stats.redraws++;
+        }
+    }
+    hud->stats.cpu_cycles += gfx_port_cycles() - start;
+
+    return hud->shown;
+}
+
+/*******************************************************************************
+* Function Name: perf_hud_fingerprint
+********************************************************************************
+* Summary:
+*  Adds the state of the HUD to the fingerprint of the frame, so a frame is
+*  rendered when the HUD is toggled or its text changes.
+*
+* Parameters:
+*  hud    - HUD
+*  fp     - Fingerprint of the frame being built
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void perf_hud_fingerprint(perf_hud_t *hud, scene_fingerprint_t *fp)
+{
+    scene_fingerprint_add(fp, &hud->shown, sizeof(hud->shown));
+    if (hud->shown)
+    {
+        scene_fingerprint_add(fp, &hud->version, sizeof(hud->version));
+    }
+}
+
+/*******************************************************************************
+* Function Name: perf_hud_report_damage
+********************************************************************************
+* Summary:
+*  Reports the rectangle of a shown HUD to the damage tracker, keyed by its
+*  text. A hidden HUD reports nothing, so the scene is repainted over it.
+*
+* Parameters:
+*  hud     - HUD
+*  tracker - Damage tracker between begin and end of a frame
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void perf_hud_report_damage(perf_hud_t *hud, damage_tracker_t *tracker)
+{
+    if (hud->shown)
+    {
+        damage_tracker_add_item(tracker, damage_hash(&hud->version, sizeof(hud->version),
+                                                     DAMAGE_HASH_SEED), &hud->rect);
+    }
+}
+
+/*******************************************************************************
+* Function Name: perf_hud_draw
+********************************************************************************
+* Summary:
+*  Clears the part of the HUD rectangle inside the clip rectangle and draws
+*  the lines crossing it. Nothing outside the HUD rectangle is touched.
+*
+* Parameters:
+*  hud             - HUD
+*  target          - Render target, drawn after the scene
+*  clip            - Rectangle being repainted, NULL for the whole frame
+*
+* Return:
+*  vg_lite_error_t - VG_LITE_SUCCESS or the error of the failing call
+*
+*******************************************************************************/
+vg_lite_error_t perf_hud_draw(perf_hud_t *hud, vg_lite_buffer_t *target,
+                              const damage_rect_t *clip)
+{
+    uint32_t start = gfx_port_cycles();
+    vg_lite_error_t error = VG_LITE_SUCCESS;
+    damage_rect_t area = hud->rect;
+    vg_lite_rectangle_t fill;
+    vg_lite_matrix_t matrix;
+
+    if (!hud->shown || ((NULL != clip) && !damage_rect_intersect(&hud->rect, clip, &area)))
+    {
+        return VG_LITE_SUCCESS;
+    }
+
+    fill.x      = area.x0;
+    fill.y      = area.y0;
+    fill.width  = area.x1 - area.x0;
+    fill.height = area.y1 - area.y0;
+    error = GPU_PROFILE_CALL("vg_lite_clear", vg_lite_clear(target, &fill, PERF_HUD_BACKGROUND_COLOR));
+    hud->stats.pixels += damage_rect_area(&area);
+
+    for (uint8_t i = 0; (i < PERF_HUD_LINES) && (VG_LITE_SUCCESS == error); i++)
+    {
+        const text_run_t *line = &hud->lines[i];
+        damage_rect_t line_rect;
+
+        line_rect.x0 = hud->rect.x0 + PERF_HUD_PADDING;
+        line_rect.y0 = hud->rect.y0 + PERF_HUD_PADDING + ((int32_t)i * line->height);
+        line_rect.x1 = line_rect.x0 + line->width;
+        line_rect.y1 = line_rect.y0 + line->height;
+        if (!damage_rect_intersect(&line_rect, &area, NULL))
+        {
+            continue;
+        }
+
+        vg_lite_identity(&matrix);
+        vg_lite_translate((vg_lite_float_t)line_rect.x0, (vg_lite_float_t)line_rect.y0, &matrix);
+        error = text_run_draw(line, target, &matrix, PERF_HUD_TEXT_COLOR);
+        for (uint8_t s = 0; s < line->span_count; s++)
+        {
+            hud->stats.pixels += (uint32_t)line->spans[s].cells.width *
+                                 (uint32_t)line->spans[s].cells.height;
+        }
+    }
+    hud->stats.cpu_cycles += gfx_port_cycles() - start;
+
+    return error;
+}
+
+/*******************************************************************************
+* Function Name: perf_hud_get_stats
+********************************************************************************
+* Summary:
+*  Returns the cost of the HUD, optionally resetting it.
+*
+* Parameters:
+*  hud    - HUD
+*  stats  - Output statistics
+*  reset  - true to clear the statistics after reading them
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void perf_hud_get_stats(perf_hud_t *hud, perf_hud_stats_t *stats, bool reset)
+{
+    *stats = hud->stats;
+
+    if (reset)
+    {
+        memset(&hud->stats, 0, sizeof(hud->stats));
+    }
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,139 @@
+/*******************************************************************************
+* File Name        : perf_hud.h
+*
+* Description      : This file contains the declarations of the performance HUD, a corner
+*                    overlay showing the frame rate, CPU and GPU load and heap use computed
+*                    for the FPS line, together with its own cost per frame.
+*
+* Related Document : See README.md
+*
+********************************************************************************
+* Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+
+#ifndef PERF_HUD_H
+#define PERF_HUD_H
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include <stdint.h>
+#include <stdbool.h>
+#include "vg_lite.h"
+#include "damage_tracker.h"
+#include "scene_fingerprint.h"
+#include "text_engine.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+
+/* Shown from startup. Can be overridden from the Makefile, e.g.
+ * DEFINES+=PERF_HUD_ENABLED=true */
+#ifndef PERF_HUD_ENABLED
+#define PERF_HUD_ENABLED                    (false)
+#endif
+
+/* Shortest time between two changes of the text. Can be overridden from the
+ * Makefile, e.g. DEFINES+=PERF_HUD_PERIOD_MS=250U */
+#ifndef PERF_HUD_PERIOD_MS
+#define PERF_HUD_PERIOD_MS                  (1000U)
+#endif
+
+#define PERF_HUD_LINES                      (3U)
+/* Characters per line, longer lines are cut */
+#define PERF_HUD_COLUMNS                    (20U)
+#define PERF_HUD_MARGIN                     (8)
+#define PERF_HUD_PADDING                    (4)
+#define PERF_HUD_BACKGROUND_COLOR           (0xFF202020U)
+#define PERF_HUD_TEXT_COLOR                 (0xFFFFFFFFU)
+
+/*******************************************************************************
+* Data Structures and Types
+*******************************************************************************/
+
+/* Values of one FPS line */
+typedef struct {
+    uint32_t fps_x_1000;
+    uint32_t cpu_percent;
+    uint32_t gpu_percent;       /* GPU busy time of the interval */
+    uint32_t heap_used_bytes;
+    uint32_t hud_cpu_ns;        /* CPU time of the HUD per frame */
+    uint32_t hud_pixels;        /* Pixels written by the HUD per frame */
+} perf_hud_sample_t;
+
+typedef struct {
+    uint32_t cpu_cycles;        /* Layout and drawing in the render task */
+    uint32_t pixels;            /* Cleared and blitted by the HUD */
+    uint32_t redraws;           /* Text changes */
+} perf_hud_stats_t;
+
+typedef struct {
+    volatile bool enabled;      /* Set from the CLI task */
+    volatile uint32_t period_ms;
+    bool shown;                 /* Enabled state of the frame being built */
+    damage_rect_t rect;
+    text_run_t lines[PERF_HUD_LINES];
+    perf_hud_sample_t sample;
+    bool sample_valid;
+    bool sample_pending;        /* Sample not shown yet */
+    uint32_t last_change_ms;
+    uint32_t version;           /* Incremented when the text changes */
+    perf_hud_stats_t stats;
+} perf_hud_t;
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+void perf_hud_init(perf_hud_t *hud, text_font_t *font, int32_t screen_width);
+void perf_hud_set_enabled(perf_hud_t *hud, bool enabled);
+void perf_hud_set_period(perf_hud_t *hud, uint32_t period_ms);
+void perf_hud_sample(perf_hud_t *hud, const perf_hud_sample_t *sample);
+bool perf_hud_begin_frame(perf_hud_t *hud, uint32_t now_ms);
+void perf_hud_fingerprint(perf_hud_t *hud, scene_fingerprint_t *fp);
+void perf_hud_report_damage(perf_hud_t *hud, damage_tracker_t *tracker);
+vg_lite_error_t perf_hud_draw(perf_hud_t *hud, vg_lite_buffer_t *target,
+                              const damage_rect_t *clip);
+void perf_hud_get_stats(perf_hud_t *hud, perf_hud_stats_t *stats, bool reset);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* PERF_HUD_H */
+
+/* [] END OF FILE */
@@ -0,0 +1,194 @@
+/*******************************************************************************
+* File Name        : quality_policy.c
+*
+* Description      : This file contains the antialiasing quality policy. Draws whose
+*                    transform changed since the last frame are rendered with fewer
+*                    coverage samples, within a budget per frame, and return to the
+*                    quality of their path once they have been still for a few frames.
+*
+* Related Document : See README.md
+*
+********************************************************************************
+* Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+
+#include <string.h>
+#include "quality_policy.h"
+
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+
+/* Coverage samples per pixel, indexed by vg_lite_quality_t. The enumeration
+ * is ordered from the best (VG_LITE_HIGH) to the cheapest (VG_LITE_LOW). */
+static const uint8_t quality_samples[] = {
+    16U,    /* VG_LITE_HIGH */
+    8U,     /* VG_LITE_UPPER */
+    4U,     /* VG_LITE_MEDIUM */
+    1U      /* VG_LITE_LOW */
+};
+
+
+/*******************************************************************************
+* Function Name: quality_policy_init
+********************************************************************************
+* Summary:
+*  Initializes a quality policy.
+*
+* Parameters:
+*  policy - Pointer to the quality policy
+*  config - Budget and qualities of moving draws
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void quality_policy_init(quality_policy_t *policy, const quality_policy_config_t *config)
+{
+    memset(policy, 0, sizeof(*policy));
+    policy->config = *config;
+}
+
+/*******************************************************************************
+* Function Name: quality_policy_begin_frame
+********************************************************************************
+* Summary:
+*  Refills the sample budget. Called once per frame before the qualities of
+*  its draws are selected.
+*
+* Parameters:
+*  policy - Pointer to the quality policy
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void quality_policy_begin_frame(quality_policy_t *policy)
+{
+    policy->spent = 0U;
+    policy->stats.frames++;
+}
+
+/*******************************************************************************
+* Function Name: quality_policy_select
+********************************************************************************
+* Summary:
+*  Selects the quality of one draw. A draw that has been still for the
+*  settle time uses the quality of its path and is not charged: it is only
+*  redrawn when damaged. A moving draw uses the configured moving quality,
+*  lowered further while its samples exceed the rest of the budget. The
+*  result is never better than the quality of the path.
+*
+* Parameters:
+*  policy       - Pointer to the quality policy
+*  best         - Quality of the path
+*  still_frames - Updates since the transform of the draw last changed
+*  area         - Bounds of the draw on screen, in pixels
+*
+* Return:
+*  vg_lite_quality_t - Quality to draw with
+*
+*******************************************************************************/
+vg_lite_quality_t quality_policy_select(quality_policy_t *policy, vg_lite_quality_t best,
+                                        uint8_t still_frames, uint32_t area)
+{
+    vg_lite_quality_t quality = best;
+    uint64_t samples;
+
+    if (still_frames < policy->config.settle_frames)
+    {
+        if (area <= policy->config.small_area)
+        {
+            quality = policy->config.small_quality;
+        }
+        else
+        {
+            quality = policy->config.moving_quality;
+        }
+        if (quality < best)
+        {
+            quality = best;
+        }
+
+        samples = (uint64_t)area * quality_samples[quality];
+        if ((VG_LITE_LOW != quality) && ((policy->spent + samples) > policy->config.budget))
+        {
+            policy->stats.over_budget++;
+        }
+        while ((VG_LITE_LOW != quality) && ((policy->spent + samples) > policy->config.budget))
+        {
+            quality++;
+            samples = (uint64_t)area * quality_samples[quality];
+        }
+
+        policy->spent = ((policy->spent + samples) > UINT32_MAX) ?
+                        UINT32_MAX : (uint32_t)(policy->spent + samples);
+    }
+
+    policy->stats.draws++;
+    if (quality != best)
+    {
+        policy->stats.reduced++;
+    }
+
+    return quality;
+}
+
+/*******************************************************************************
+* Function Name: quality_policy_get_stats
+********************************************************************************
+* Summary:
+*  Returns the selection statistics, optionally resetting them.
+*
+* Parameters:
+*  policy - Pointer to the quality policy
+*  stats  - Output statistics
+*  reset  - true to clear the statistics after reading them
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void quality_policy_get_stats(quality_policy_t *policy, quality_policy_stats_t *stats,
+                              bool reset)
+{
+    *stats = policy->stats;
+
+    if (reset)
+    {
+        memset(&policy->stats, 0, sizeof(policy->stats));
+    }
+}
+
+/* [] END OF FILE */
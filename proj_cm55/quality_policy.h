@@ -0,0 +1,110 @@
+/*******************************************************************************
+* File Name        : quality_policy.h
+*
+* Description      : This file contains the declarations of the antialiasing quality
+*                    policy. It selects the VGLite quality of each path draw from the
+*                    motion of its transform, its size on screen and a per frame budget
+*                    of coverage samples.
+*
+* Related Document : See README.md
+*
+********************************************************************************
+* Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+
+#ifndef QUALITY_POLICY_H
+#define QUALITY_POLICY_H
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include <stdint.h>
+#include <stdbool.h>
+#include "vg_lite.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+
+/* Updates without a transform change before a draw is back to full quality */
+#define QUALITY_POLICY_SETTLE_FRAMES        (2U)
+
+/* Saturation value of the still frame counters */
+#define QUALITY_POLICY_STILL_MAX            (UINT8_MAX)
+
+/*******************************************************************************
+* Data Structures and Types
+*******************************************************************************/
+
+typedef struct {
+    uint32_t budget;                    /* Coverage samples per frame for moving draws */
+    uint32_t small_area;                /* Moving draws up to this many pixels use small_quality */
+    vg_lite_quality_t small_quality;    /* Small shapes show aliasing the most */
+    vg_lite_quality_t moving_quality;
+    uint8_t settle_frames;
+} quality_policy_config_t;
+
+typedef struct {
+    uint32_t draws;             /* Qualities selected */
+    uint32_t reduced;           /* Draws below the quality of their path */
+    uint32_t over_budget;       /* Draws lowered further to stay in the budget */
+    uint32_t frames;
+} quality_policy_stats_t;
+
+typedef struct {
+    quality_policy_config_t config;
+    uint32_t spent;             /* Samples used by the moving draws of this frame */
+    quality_policy_stats_t stats;
+} quality_policy_t;
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+void quality_policy_init(quality_policy_t *policy, const quality_policy_config_t *config);
+void quality_policy_begin_frame(quality_policy_t *policy);
+vg_lite_quality_t quality_policy_select(quality_policy_t *policy, vg_lite_quality_t best,
+                                        uint8_t still_frames, uint32_t area);
+void quality_policy_get_stats(quality_policy_t *policy, quality_policy_stats_t *stats,
+                              bool reset);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* QUALITY_POLICY_H */
+
+/* [] END OF FILE */
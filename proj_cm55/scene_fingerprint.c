@@ -0,0 +1,177 @@
+/*******************************************************************************
+* File Name        : scene_fingerprint.c
+*
+* Description      : This file contains the scene fingerprint used to detect frames
+*                    identical to the last submitted one.
+*
+* Related Document : See README.md
+*
+********************************************************************************
+* Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+
+#include "scene_fingerprint.h"
+#include "damage_tracker.h"
+
+/*******************************************************************************
+* Function Name: scene_fingerprint_reset
+********************************************************************************
+* Summary:
+*  Forgets the last submitted frame, so the next frame is always rendered.
+*  To be called whenever something outside the fingerprint changes the
+*  screen, e.g. a switch to another demo.
+*
+* Parameters:
+*  fp - Pointer to the fingerprint
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void scene_fingerprint_reset(scene_fingerprint_t *fp)
+{
+    fp->submitted_valid = false;
+}
+
+/*******************************************************************************
+* Function Name: scene_fingerprint_begin
+********************************************************************************
+* Summary:
+*  Starts the fingerprint of a new frame.
+*
+* Parameters:
+*  fp       - Pointer to the fingerprint
+*  scene_id - Identifier of the scene (demo) being drawn
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void scene_fingerprint_begin(scene_fingerprint_t *fp, uint32_t scene_id)
+{
+    fp->hash = damage_hash(&scene_id, sizeof(scene_id), DAMAGE_HASH_SEED);
+}
+
+/*******************************************************************************
+* Function Name: scene_fingerprint_add
+********************************************************************************
+* Summary:
+*  Adds draw call arguments to the fingerprint of the current frame.
+*
+* Parameters:
+*  fp   - Pointer to the fingerprint
+*  data - Argument data
+*  size - Size of the data in bytes
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void scene_fingerprint_add(scene_fingerprint_t *fp, const void *data,
+                           size_t size)
+{
+    fp->hash = damage_hash(data, size, fp->hash);
+}
+
+/*******************************************************************************
+* Function Name: scene_fingerprint_unchanged
+********************************************************************************
+* Summary:
+*  Checks whether the current frame is identical to the last submitted one.
+*  If so, the frame is counted as skipped.
+*
+* Parameters:
+*  fp   - Pointer to the fingerprint
+*
+* Return:
+*  bool - true if the frame can be skipped
+*
+*******************************************************************************/
+bool scene_fingerprint_unchanged(scene_fingerprint_t *fp)
+{
+    bool unchanged = (fp->submitted_valid && (fp->hash == fp->submitted_hash));
+
+    if (unchanged)
+    {
+        fp->skipped++;
+    }
+
+    return unchanged;
+}
+
+/*******************************************************************************
+* Function Name: scene_fingerprint_commit
+********************************************************************************
+* Summary:
+*  Records the current frame as submitted.
+*
+* Parameters:
+*  fp - Pointer to the fingerprint
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void scene_fingerprint_commit(scene_fingerprint_t *fp)
+{
+    fp->submitted_hash  = fp->hash;
+    fp->submitted_valid = true;
+}
+
+/*******************************************************************************
+* Function Name: scene_fingerprint_get_skipped
+********************************************************************************
+* Summary:
+*  Returns the number of skipped frames, optionally resetting the counter.
+*
+* Parameters:
+*  fp       - Pointer to the fingerprint
+*  reset    - true to clear the counter after reading it
+*
+* Return:
+*  uint32_t - Skipped frames
+*
+*******************************************************************************/
+uint32_t scene_fingerprint_get_skipped(scene_fingerprint_t *fp, bool reset)
+{
+    uint32_t skipped = fp->skipped;
+
+    if (reset)
+    {
+        fp->skipped = 0U;
+    }
+
+    return skipped;
+}
+
+/* [] END OF FILE */
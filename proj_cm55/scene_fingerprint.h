@@ -0,0 +1,88 @@
+/*******************************************************************************
+* File Name        : scene_fingerprint.h
+*
+* Description      : This file contains the declarations of the scene fingerprint.
+*                    Demos hash the arguments, matrices and asset identities of all
+*                    draw calls of a frame before issuing them; a frame identical to
+*                    the last submitted one is skipped and the previous buffer stays
+*                    on screen.
+*
+* Related Document : See README.md
+*
+********************************************************************************
+* Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+
+#ifndef SCENE_FINGERPRINT_H
+#define SCENE_FINGERPRINT_H
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+/*******************************************************************************
+* Data Structures and Types
+*******************************************************************************/
+
+typedef struct {
+    uint32_t hash;              /* Fingerprint of the frame being built */
+    uint32_t submitted_hash;    /* Fingerprint of the last submitted frame */
+    bool submitted_valid;
+    uint32_t skipped;           /* Frames skipped since last reset */
+} scene_fingerprint_t;
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+void scene_fingerprint_reset(scene_fingerprint_t *fp);
+void scene_fingerprint_begin(scene_fingerprint_t *fp, uint32_t scene_id);
+void scene_fingerprint_add(scene_fingerprint_t *fp, const void *data,
+                           size_t size);
+bool scene_fingerprint_unchanged(scene_fingerprint_t *fp);
+void scene_fingerprint_commit(scene_fingerprint_t *fp);
+uint32_t scene_fingerprint_get_skipped(scene_fingerprint_t *fp, bool reset);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* SCENE_FINGERPRINT_H */
+
+/* [] END OF FILE */
@@ -0,0 +1,1137 @@
+/*******************************************************************************
+* File Name        : scene_graph.c
+*
+* Description      : This file contains the retained scene graph: node construction,
+*                    cached world matrices and the traversals that draw, fingerprint
+*                    and report damage for a scene.
+*
+* Related Document : See README.md
+*
+********************************************************************************
+* Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+
+#include <stdio.h>
+#include <string.h>
+#include "scene_graph.h"
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+static const vg_lite_matrix_t identity_matrix = {
+    .m = { { 1.0f, 0.0f, 0.0f },
+           { 0.0f, 1.0f, 0.0f },
+           { 0.0f, 0.0f, 1.0f } }
+};
+
+static const damage_rect_t empty_rect = { 0, 0, 0, 0 };
+
+
+/*******************************************************************************
+* Function Name: matrix_multiply
+********************************************************************************
+* Summary:
+*  Computes out = a * b, the transform that applies b first and then a.
+*
+* Parameters:
+*  a   - Left matrix (parent)
+*  b   - Right matrix (child)
+*  out - Result, must not alias a or b
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void matrix_multiply(const vg_lite_matrix_t *a, const vg_lite_matrix_t *b,
+                            vg_lite_matrix_t *out)
+{
+    for (uint8_t row = 0; row < 3U; row++)
+    {
+        for (uint8_t col = 0; col < 3U; col++)
+        {
+            out->m[row][col] = (a->m[row][0] * b->m[0][col]) +
+                               (a->m[row][1] * b->m[1][col]) +
+                               (a->m[row][2] * b->m[2][col]);
+        }
+    }
+}
+
+/*******************************************************************************
+* Function Name: node_init
+********************************************************************************
+* Summary:
+*  Common part of the node constructors.
+*
+* Parameters:
+*  node  - Node to be initialized
+*  type  - Node type
+*  blend - Blend mode
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void node_init(scene_node_t *node, scene_node_type_t type,
+                      vg_lite_blend_t blend)
+{
+    memset(node, 0, sizeof(*node));
+    node->type      = type;
+    node->local     = identity_matrix;
+    node->world     = identity_matrix;
+    node->bounds    = empty_rect;
+    node->dirty     = true;
+    node->visible   = true;
+    node->fill_rule = VG_LITE_FILL_EVEN_ODD;
+    node->blend     = blend;
+    node->still_frames = QUALITY_POLICY_STILL_MAX;
+}
+
+/*******************************************************************************
+* Function Name: scene_node_init_group
+********************************************************************************
+* Summary:
+*  Initializes a group node. Its transform applies to all its children.
+*
+* Parameters:
+*  node - Node to be initialized
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void scene_node_init_group(scene_node_t *node)
+{
+    node_init(node, SCENE_NODE_GROUP, VG_LITE_BLEND_NONE);
+}
+
+/*******************************************************************************
+* Function Name: scene_node_init_layer
+********************************************************************************
+* Summary:
+*  Initializes a layer node. The children are drawn into an offscreen buffer,
+*  in the coordinates of that buffer. If composite is set, the buffer is then
+*  blitted into the parent target with the transform and blend of the layer.
+*
+* Parameters:
+*  node        - Node to be initialized
+*  buffer      - Offscreen buffer
+*  clear_color - Color the buffer is cleared to before the children are drawn
+*  composite   - true to blit the buffer into the parent target
+*  blend       - Blend mode of the blit
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void scene_node_init_layer(scene_node_t *node, vg_lite_buffer_t *buffer,
+                           vg_lite_color_t clear_color, bool composite,
+                           vg_lite_blend_t blend)
+{
+    node_init(node, SCENE_NODE_LAYER, blend);
+    node->u.layer.buffer      = buffer;
+    node->u.layer.clear_color = clear_color;
+    node->u.layer.composite   = composite;
+    node->u.layer.filter      = VG_LITE_FILTER_POINT;
+}
+
+/*******************************************************************************
+* Function Name: scene_node_init_path
+********************************************************************************
+* Summary:
+*  Initializes a node filling a path with a solid color.
+*
+* Parameters:
+*  node      - Node to be initialized
+*  path      - Path to be drawn
+*  fill_rule - Fill rule
+*  blend     - Blend mode
+*  color     - Fill color
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void scene_node_init_path(scene_node_t *node, vg_lite_path_t *path,
+                          vg_lite_fill_t fill_rule, vg_lite_blend_t blend,
+                          vg_lite_color_t color)
+{
+    node_init(node, SCENE_NODE_PATH, blend);
+    node->fill_rule    = fill_rule;
+    node->color        = color;
+    node->quality      = path->quality;
+    node->draw_quality = path->quality;
+    node->u.path.path  = path;
+}
+
+/*******************************************************************************
+* Function Name: scene_node_init_image
+********************************************************************************
+* Summary:
+*  Initializes a node blitting an image, or a rectangle of it.
+*
+* Parameters:
+*  node   - Node to be initialized
+*  image  - Source image
+*  rect   - Source rectangle, NULL for the whole image
+*  blend  - Blend mode
+*  filter - Filter used when the image is transformed
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void scene_node_init_image(scene_node_t *node, vg_lite_buffer_t *image,
+                           vg_lite_rectangle_t *rect, vg_lite_blend_t blend,
+                           vg_lite_filter_t filter)
+{
+    node_init(node, SCENE_NODE_IMAGE, blend);
+    node->u.image.image   = image;
+    node->u.image.rect    = rect;
+    node->u.image.filter  = filter;
+    node->u.image.pyramid = NULL;
+}
+
+/*******************************************************************************
+* Function Name: scene_node_init_pyramid
+********************************************************************************
+* Summary:
+*  Initializes a node blitting the level of an image pyramid closest to its
+*  on-screen size. Bounds and fingerprint are those of the full resolution
+*  level.
+*
+* Parameters:
+*  node    - Node to be initialized
+*  pyramid - Source image and its half resolution levels
+*  blend   - Blend mode
+*  filter  - Filter used when the image is transformed
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void scene_node_init_pyramid(scene_node_t *node, image_pyramid_t *pyramid,
+                             vg_lite_blend_t blend, vg_lite_filter_t filter)
+{
+    scene_node_init_image(node, &pyramid->levels[0], NULL, blend, filter);
+    node->u.image.pyramid = pyramid;
+}
+
+/*******************************************************************************
+* Function Name: scene_node_init_pattern
+********************************************************************************
+* Summary:
+*  Initializes a node filling a path with an image pattern. The transform of
+*  the node places the path, image_local places the image in the parent
+*  space.
+*
+* Parameters:
+*  node          - Node to be initialized
+*  path          - Path to be filled
+*  fill_rule     - Fill rule
+*  image         - Pattern image
+*  image_local   - Placement of the image, NULL for identity
+*  blend         - Blend mode
+*  mode          - Pattern mode outside the image
+*  pattern_color - Color outside the image for VG_LITE_PATTERN_COLOR
+*  color         - Paint color
+*  filter        - Filter used when the image is transformed
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void scene_node_init_pattern(scene_node_t *node, vg_lite_path_t *path,
+                             vg_lite_fill_t fill_rule, vg_lite_buffer_t *image,
+                             const vg_lite_matrix_t *image_local,
+                             vg_lite_blend_t blend, vg_lite_pattern_mode_t mode,
+                             vg_lite_color_t pattern_color,
+                             vg_lite_color_t color, vg_lite_filter_t filter)
+{
+    node_init(node, SCENE_NODE_PATTERN, blend);
+    node->fill_rule               = fill_rule;
+    node->color                   = color;
+    node->quality                 = path->quality;
+    node->draw_quality            = path->quality;
+    node->u.pattern.path          = path;
+    node->u.pattern.image         = image;
+    node->u.pattern.image_local   = (NULL != image_local) ? *image_local : identity_matrix;
+    node->u.pattern.image_world   = node->u.pattern.image_local;
+    node->u.pattern.mode          = mode;
+    node->u.pattern.pattern_color = pattern_color;
+    node->u.pattern.filter        = filter;
+}
+
+/*******************************************************************************
+* Function Name: scene_node_init_text
+********************************************************************************
+* Summary:
+*  Initializes a node drawing a text run. The transform of the node places
+*  the top left corner of the run.
+*
+* Parameters:
+*  node  - Node to be initialized
+*  run   - Text run, laid out again through scene_node_set_text()
+*  color - Text color
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void scene_node_init_text(scene_node_t *node, text_run_t *run, vg_lite_color_t color)
+{
+    node_init(node, SCENE_NODE_TEXT, VG_LITE_BLEND_SRC_OVER);
+    node->color      = color;
+    node->u.text.run = run;
+}
+
+/*******************************************************************************
+* Function Name: scene_node_add_child
+********************************************************************************
+* Summary:
+*  Appends a node to the children of a group or layer. Children are drawn in
+*  the order they were added.
+*
+* Parameters:
+*  parent - Group or layer node
+*  child  - Node to be appended, must not have a parent yet
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void scene_node_add_child(scene_node_t *parent, scene_node_t *child)
+{
+    child->parent       = parent;
+    child->next_sibling = NULL;
+    child->dirty        = true;
+
+    if (NULL == parent->last_child)
+    {
+        parent->first_child = child;
+    }
+    else
+    {
+        parent->last_child->next_sibling = child;
+    }
+    parent->last_child = child;
+}
+
+/*******************************************************************************
+* Function Name: scene_node_set_transform
+********************************************************************************
+* Summary:
+*  Sets the transform of a node relative to its parent. The node is only
+*  marked dirty if the transform actually changed.
+*
+* Parameters:
+*  node  - Node
+*  local - New transform
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void scene_node_set_transform(scene_node_t *node, const vg_lite_matrix_t *local)
+{
+    if (0 != memcmp(&node->local, local, sizeof(node->local)))
+    {
+        node->local = *local;
+        node->dirty = true;
+    }
+}
+
+/*******************************************************************************
+* Function Name: scene_node_set_visible
+********************************************************************************
+* Summary:
+*  Shows or hides a node and its children.
+*
+* Parameters:
+*  node    - Node
+*  visible - false to skip the node in all traversals
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void scene_node_set_visible(scene_node_t *node, bool visible)
+{
+    node->visible = visible;
+}
+
+/*******************************************************************************
+* Function Name: scene_node_set_color
+********************************************************************************
+* Summary:
+*  Changes the draw color of a node. For images it is the blit color, the
+*  tint of alpha only images.
+*
+* Parameters:
+*  node  - Node
+*  color - New color
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void scene_node_set_color(scene_node_t *node, vg_lite_color_t color)
+{
+    if (node->color != color)
+    {
+        node->color = color;
+        node->dirty = true;
+    }
+}
+
+/*******************************************************************************
+* Function Name: scene_node_set_text
+********************************************************************************
+* Summary:
+*  Changes the string of a text node. The run is laid out and the bounds are
+*  updated only if the string changed.
+*
+* Parameters:
+*  node  - Text node
+*  text  - New string
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void scene_node_set_text(scene_node_t *node, const char *text)
+{
+    if (text_run_set(node->u.text.run, text))
+    {
+        node->dirty = true;
+    }
+}
+
+/*******************************************************************************
+* Function Name: scene_graph_init
+********************************************************************************
+* Summary:
+*  Initializes a scene graph.
+*
+* Parameters:
+*  graph - Pointer to the scene graph
+*  root  - Root node, usually a group
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void scene_graph_init(scene_graph_t *graph, scene_node_t *root)
+{
+    memset(graph, 0, sizeof(*graph));
+    graph->root = root;
+}
+
+/*******************************************************************************
+* Function Name: scene_graph_set_quality_policy
+********************************************************************************
+* Summary:
+*  Lets a policy select the antialiasing quality of the path and pattern
+*  draws on every update, see quality_policy_select().
+*
+* Parameters:
+*  graph  - Pointer to the scene graph
+*  policy - Quality policy, NULL to always draw with the node quality
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void scene_graph_set_quality_policy(scene_graph_t *graph, quality_policy_t *policy)
+{
+    graph->quality_policy = policy;
+}
+
+/*******************************************************************************
+* Function Name: invalidate_node
+********************************************************************************
+* Summary:
+*  Marks a node and all its descendants dirty.
+*
+* Parameters:
+*  node - Node
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void invalidate_node(scene_node_t *node)
+{
+    node->dirty = true;
+
+    for (scene_node_t *child = node->first_child; NULL != child; child = child->next_sibling)
+    {
+        invalidate_node(child);
+    }
+}
+
+/*******************************************************************************
+* Function Name: scene_graph_invalidate
+********************************************************************************
+* Summary:
+*  Forces the next update to recompute every world matrix.
+*
+* Parameters:
+*  graph - Pointer to the scene graph
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void scene_graph_invalidate(scene_graph_t *graph)
+{
+    invalidate_node(graph->root);
+}
+
+/*******************************************************************************
+* Function Name: node_bounds
+********************************************************************************
+* Summary:
+*  Computes the bounds of the content a node draws into its target. Groups
+*  and layers that are not composited draw nothing themselves.
+*
+* Parameters:
+*  node          - Node with an up to date world matrix
+*
+* Return:
+*  damage_rect_t - Bounds in target coordinates
+*
+*******************************************************************************/
+static damage_rect_t node_bounds(const scene_node_t *node)
+{
+    damage_rect_t bounds = empty_rect;
+    const vg_lite_path_t *path = NULL;
+
+    switch (node->type)
+    {
+        case SCENE_NODE_LAYER:
+            if (node->u.layer.composite)
+            {
+                bounds = damage_rect_transform(node->world.m, 0, 0,
+                                               node->u.layer.buffer->width,
+                                               node->u.layer.buffer->height);
+            }
+            break;
+
+        case SCENE_NODE_PATH:
+            path = node->u.path.path;
+            break;
+
+        case SCENE_NODE_PATTERN:
+            path = node->u.pattern.path;
+            break;
+
+        case SCENE_NODE_IMAGE:
+            if (NULL != node->u.image.rect)
+            {
+                bounds = damage_rect_transform(node->world.m, 0, 0,
+                                               node->u.image.rect->width,
+                                               node->u.image.rect->height);
+            }
+            else
+            {
+                bounds = damage_rect_transform(node->world.m, 0, 0,
+                                               node->u.image.image->width,
+                                               node->u.image.image->height);
+            }
+            break;
+
+        case SCENE_NODE_TEXT:
+            if (0U != node->u.text.run->glyph_count)
+            {
+                bounds = damage_rect_transform(node->world.m, 0, 0,
+                                               node->u.text.run->width,
+                                               node->u.text.run->height);
+            }
+            break;
+
+        default:
+            break;
+    }
+
+    if (NULL != path)
+    {
+        bounds = damage_rect_transform(node->world.m,
+                                       (int32_t)path->bounding_box[0],
+                                       (int32_t)path->bounding_box[1],
+                                       (int32_t)path->bounding_box[2],
+                                       (int32_t)path->bounding_box[3]);
+    }
+
+    return bounds;
+}
+
+/*******************************************************************************
+* Function Name: select_quality
+********************************************************************************
+* Summary:
+*  Selects the antialiasing quality of a path or pattern node for this frame.
+*
+* Parameters:
+*  graph - Pointer to the scene graph
+*  node  - Node with up to date bounds
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void select_quality(scene_graph_t *graph, scene_node_t *node)
+{
+    uint32_t area = 0U;
+
+    if (NULL == graph->quality_policy)
+    {
+        node->draw_quality = node->quality;
+    }
+    else
+    {
+        if (!damage_rect_is_empty(&node->bounds))
+        {
+            area = (uint32_t)(node->bounds.x1 - node->bounds.x0) *
+                   (uint32_t)(node->bounds.y1 - node->bounds.y0);
+        }
+        node->draw_quality = quality_policy_select(graph->quality_policy, node->quality,
+                                                   node->still_frames, area);
+    }
+}
+
+/*******************************************************************************
+* Function Name: update_node
+********************************************************************************
+* Summary:
+*  Recomputes the world matrix and bounds of a node if it or one of its
+*  ancestors changed, then updates its children. Children of a layer are
+*  placed in the coordinates of the layer buffer. Counts the updates since
+*  the world matrix last changed and selects the quality of path draws.
+*
+* Parameters:
+*  graph          - Pointer to the scene graph
+*  node           - Node
+*  parent_world   - World matrix of the parent
+*  parent_changed - true if the parent world matrix was recomputed
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void update_node(scene_graph_t *graph, scene_node_t *node,
+                        const vg_lite_matrix_t *parent_world, bool parent_changed)
+{
+    bool changed = (node->dirty || parent_changed);
+    bool moved = false;
+    const vg_lite_matrix_t *child_world = &node->world;
+    vg_lite_matrix_t previous;
+
+    if (changed)
+    {
+        previous = node->world;
+        matrix_multiply(parent_world, &node->local, &node->world);
+        /* Appearing, or being recomputed to the same place, is not motion */
+        moved = !damage_rect_is_empty(&node->bounds) &&
+                (0 != memcmp(&previous, &node->world, sizeof(previous)));
+        if (SCENE_NODE_PATTERN == node->type)
+        {
+            matrix_multiply(parent_world, &node->u.pattern.image_local,
+                            &node->u.pattern.image_world);
+        }
+        node->bounds = node_bounds(node);
+        node->dirty  = false;
+        graph->stats.updated++;
+    }
+
+    if (moved)
+    {
+        node->still_frames = 0U;
+    }
+    else if (node->still_frames < QUALITY_POLICY_STILL_MAX)
+    {
+        node->still_frames++;
+    }
+
+    if ((SCENE_NODE_PATH == node->type) || (SCENE_NODE_PATTERN == node->type))
+    {
+        select_quality(graph, node);
+    }
+
+    if (SCENE_NODE_LAYER == node->type)
+    {
+        /* Moving the layer does not move its content within the buffer */
+        child_world = &identity_matrix;
+        changed     = false;
+    }
+
+    for (scene_node_t *child = node->first_child; NULL != child; child = child->next_sibling)
+    {
+        update_node(graph, child, child_world, changed);
+    }
+}
+
+/*******************************************************************************
+* Function Name: scene_graph_update
+********************************************************************************
+* Summary:
+*  Brings the cached world matrices and bounds up to date. Only dirty nodes
+*  and their descendants are recomputed. Called once per frame.
+*
+* Parameters:
+*  graph - Pointer to the scene graph
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void scene_graph_update(scene_graph_t *graph)
+{
+    if (NULL != graph->quality_policy)
+    {
+        quality_policy_begin_frame(graph->quality_policy);
+    }
+    update_node(graph, graph->root, &identity_matrix, false);
+}
+
+/*******************************************************************************
+* Function Name: emit
+********************************************************************************
+* Summary:
+*  Executes a command and counts it.
+*
+* Parameters:
+*  graph           - Pointer to the scene graph
+*  frame_target    - Render target of the frame
+*  cmd             - Command
+*
+* Return:
+*  vg_lite_error_t - VG_LITE_SUCCESS or the error of the failing call
+*
+*******************************************************************************/
+static vg_lite_error_t emit(scene_graph_t *graph, vg_lite_buffer_t *frame_target, cmd_t *cmd)
+{
+    vg_lite_error_t error;
+
+    error = cmd_execute(cmd, frame_target);
+    graph->stats.draw_calls++;
+
+    return error;
+}
+
+/*******************************************************************************
+* Function Name: draw_node
+********************************************************************************
+* Summary:
+*  Emits the vg_lite calls of a node and its children.
+*
+* Parameters:
+*  graph           - Pointer to the scene graph
+*  frame_target    - Render target of the frame
+*  node            - Node
+*  target          - Buffer the node is drawn into, CMD_TARGET_FRAME for the
+*                    frame render target
+*  clip            - Only nodes intersecting this rectangle are drawn, NULL
+*                    to draw everything
+*
+* Return:
+*  vg_lite_error_t - VG_LITE_SUCCESS or the error of the failing call
+*
+*******************************************************************************/
+static vg_lite_error_t draw_node(scene_graph_t *graph, vg_lite_buffer_t *frame_target,
+                                 scene_node_t *node, vg_lite_buffer_t *target,
+                                 const damage_rect_t *clip)
+{
+    vg_lite_error_t error = VG_LITE_SUCCESS;
+    scene_node_t *child;
+    cmd_t cmd;
+
+    if (!node->visible)
+    {
+        return VG_LITE_SUCCESS;
+    }
+
+    /* Nodes that only feed an offscreen layer are never culled */
+    if ((NULL != clip) && (SCENE_NODE_GROUP != node->type) &&
+        !((SCENE_NODE_LAYER == node->type) && !node->u.layer.composite) &&
+        !damage_rect_intersect(&node->bounds, clip, NULL))
+    {
+        graph->stats.culled++;
+        return VG_LITE_SUCCESS;
+    }
+
+    cmd.target    = target;
+    cmd.matrix    = node->world;
+    cmd.fill_rule = node->fill_rule;
+    cmd.blend     = node->blend;
+    cmd.color     = node->color;
+    cmd.quality   = node->draw_quality;
+    cmd.filter    = VG_LITE_FILTER_POINT;
+
+    switch (node->type)
+    {
+        case SCENE_NODE_GROUP:
+            for (child = node->first_child; (NULL != child) && !error; child = child->next_sibling)
+            {
+                error = draw_node(graph, frame_target, child, target, clip);
+            }
+            break;
+
+        case SCENE_NODE_LAYER:
+            cmd.op           = CMD_OP_CLEAR;
+            cmd.target       = node->u.layer.buffer;
+            cmd.color        = node->u.layer.clear_color;
+            cmd.u.clear.full = true;
+            error = emit(graph, frame_target, &cmd);
+            for (child = node->first_child; (NULL != child) && !error; child = child->next_sibling)
+            {
+                error = draw_node(graph, frame_target, child, node->u.layer.buffer, NULL);
+            }
+            if (!error && node->u.layer.composite)
+            {
+                cmd.op             = CMD_OP_BLIT;
+                cmd.target         = target;
+                cmd.color          = node->color;
+                cmd.filter         = node->u.layer.filter;
+                cmd.u.blit.source  = node->u.layer.buffer;
+                cmd.u.blit.pyramid = NULL;
+                error = emit(graph, frame_target, &cmd);
+            }
+            break;
+
+        case SCENE_NODE_PATH:
+            cmd.op          = CMD_OP_DRAW;
+            cmd.u.draw.path = node->u.path.path;
+            error = emit(graph, frame_target, &cmd);
+            break;
+
+        case SCENE_NODE_IMAGE:
+            cmd.op             = (NULL != node->u.image.rect) ? CMD_OP_BLIT_RECT : CMD_OP_BLIT;
+            cmd.filter         = node->u.image.filter;
+            cmd.u.blit.source  = node->u.image.image;
+            cmd.u.blit.pyramid = node->u.image.pyramid;
+            if (NULL != node->u.image.rect)
+            {
+                cmd.u.blit.rect = *node->u.image.rect;
+            }
+            error = emit(graph, frame_target, &cmd);
+            break;
+
+        case SCENE_NODE_PATTERN:
+            cmd.op                      = CMD_OP_DRAW_PATTERN;
+            cmd.filter                  = node->u.pattern.filter;
+            cmd.u.pattern.path          = node->u.pattern.path;
+            cmd.u.pattern.image         = node->u.pattern.image;
+            cmd.u.pattern.image_matrix  = node->u.pattern.image_world;
+            cmd.u.pattern.mode          = node->u.pattern.mode;
+            cmd.u.pattern.pattern_color = node->u.pattern.pattern_color;
+            error = emit(graph, frame_target, &cmd);
+            break;
+
+        case SCENE_NODE_TEXT:
+            cmd.op         = CMD_OP_TEXT;
+            cmd.u.text.run = node->u.text.run;
+            error = emit(graph, frame_target, &cmd);
+            break;
+
+        default:
+            break;
+    }
+
+    if (error && (SCENE_NODE_GROUP != node->type))
+    {
+        printf("Scene node type %d: vg_lite call returned error %d\r\n",
+               (int)node->type, error);
+    }
+
+    return error;
+}
+
+/*******************************************************************************
+* Function Name: scene_graph_draw
+********************************************************************************
+* Summary:
+*  Draws the scene into a target in a single traversal. The world matrices
+*  must be up to date (see scene_graph_update()). With a clip rectangle, the
+*  nodes outside of it are skipped; the caller is expected to have set the
+*  scissor to the same rectangle, so scenes containing layers must be drawn
+*  without clip.
+*
+* Parameters:
+*  graph           - Pointer to the scene graph
+*  target          - Render target
+*  clip            - Clip rectangle, NULL to draw everything
+*
+* Return:
+*  vg_lite_error_t - VG_LITE_SUCCESS or the error of the failing call
+*
+*******************************************************************************/
+vg_lite_error_t scene_graph_draw(scene_graph_t *graph, vg_lite_buffer_t *target,
+                                 const damage_rect_t *clip)
+{
+    return draw_node(graph, target, graph->root, CMD_TARGET_FRAME, clip);
+}
+
+/*******************************************************************************
+* Function Name: fingerprint_path
+********************************************************************************
+* Summary:
+*  Adds the identity of a path to a fingerprint. A path whose data is
+*  modified in place must have path_changed set by its owner. The quality
+*  is set per draw, it is part of the node.
+*
+* Parameters:
+*  fp   - Pointer to the fingerprint
+*  path - Path
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void fingerprint_path(scene_fingerprint_t *fp, const vg_lite_path_t *path)
+{
+    scene_fingerprint_add(fp, &path->path, sizeof(path->path));
+    scene_fingerprint_add(fp, &path->path_length, sizeof(path->path_length));
+    scene_fingerprint_add(fp, &path->path_changed, sizeof(path->path_changed));
+}
+
+/*******************************************************************************
+* Function Name: fingerprint_image
+********************************************************************************
+* Summary:
+*  Adds the identity of an image buffer to a fingerprint.
+*
+* Parameters:
+*  fp    - Pointer to the fingerprint
+*  image - Image buffer
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void fingerprint_image(scene_fingerprint_t *fp, const vg_lite_buffer_t *image)
+{
+    scene_fingerprint_add(fp, &image->address, sizeof(image->address));
+    scene_fingerprint_add(fp, &image->width, sizeof(image->width));
+    scene_fingerprint_add(fp, &image->height, sizeof(image->height));
+    scene_fingerprint_add(fp, &image->format, sizeof(image->format));
+}
+
+/*******************************************************************************
+* Function Name: fingerprint_node
+********************************************************************************
+* Summary:
+*  Adds the draw arguments of a visible node and its children to a
+*  fingerprint.
+*
+* Parameters:
+*  fp   - Pointer to the fingerprint
+*  node - Node
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void fingerprint_node(scene_fingerprint_t *fp, const scene_node_t *node)
+{
+    if (!node->visible)
+    {
+        return;
+    }
+
+    scene_fingerprint_add(fp, &node->type, sizeof(node->type));
+    scene_fingerprint_add(fp, &node->world, sizeof(node->world));
+    scene_fingerprint_add(fp, &node->fill_rule, sizeof(node->fill_rule));
+    scene_fingerprint_add(fp, &node->blend, sizeof(node->blend));
+    scene_fingerprint_add(fp, &node->color, sizeof(node->color));
+    scene_fingerprint_add(fp, &node->draw_quality, sizeof(node->draw_quality));
+
+    switch (node->type)
+    {
+        case SCENE_NODE_LAYER:
+            fingerprint_image(fp, node->u.layer.buffer);
+            scene_fingerprint_add(fp, &node->u.layer.clear_color, sizeof(node->u.layer.clear_color));
+            scene_fingerprint_add(fp, &node->u.layer.composite, sizeof(node->u.layer.composite));
+            break;
+
+        case SCENE_NODE_PATH:
+            fingerprint_path(fp, node->u.path.path);
+            break;
+
+        case SCENE_NODE_IMAGE:
+            fingerprint_image(fp, node->u.image.image);
+            if (NULL != node->u.image.rect)
+            {
+                scene_fingerprint_add(fp, node->u.image.rect, sizeof(*node->u.image.rect));
+            }
+            break;
+
+        case SCENE_NODE_PATTERN:
+            fingerprint_path(fp, node->u.pattern.path);
+            fingerprint_image(fp, node->u.pattern.image);
+            scene_fingerprint_add(fp, &node->u.pattern.image_world, sizeof(node->u.pattern.image_world));
+            scene_fingerprint_add(fp, &node->u.pattern.pattern_color, sizeof(node->u.pattern.pattern_color));
+            break;
+
+        case SCENE_NODE_TEXT:
+            scene_fingerprint_add(fp, &node->u.text.run->font, sizeof(node->u.text.run->font));
+            scene_fingerprint_add(fp, node->u.text.run->text, strlen(node->u.text.run->text));
+            break;
+
+        default:
+            break;
+    }
+
+    for (const scene_node_t *child = node->first_child; NULL != child; child = child->next_sibling)
+    {
+        fingerprint_node(fp, child);
+    }
+}
+
+/*******************************************************************************
+* Function Name: scene_graph_fingerprint
+********************************************************************************
+* Summary:
+*  Adds the draw arguments of the whole scene to a fingerprint, so that a
+*  frame identical to the previous one can be skipped before any vg_lite
+*  call is encoded.
+*
+* Parameters:
+*  graph - Pointer to the scene graph
+*  fp    - Fingerprint started with scene_fingerprint_begin()
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void scene_graph_fingerprint(scene_graph_t *graph, scene_fingerprint_t *fp)
+{
+    fingerprint_node(fp, graph->root);
+}
+
+/*******************************************************************************
+* Function Name: report_node_damage
+********************************************************************************
+* Summary:
+*  Reports the nodes drawing into the frame target to the damage tracker.
+*  The key of a node covers its transform, asset, paint, quality and text, so a
+*  draw settling back to full quality is redrawn. The content of
+*  layers is not tracked, only the composited result.
+*
+* Parameters:
+*  node    - Node
+*  tracker - Damage tracker between begin and end of a frame
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void report_node_damage(const scene_node_t *node, damage_tracker_t *tracker)
+{
+    uint32_t key;
+
+    if (!node->visible)
+    {
+        return;
+    }
+
+    if (SCENE_NODE_GROUP == node->type)
+    {
+        for (const scene_node_t *child = node->first_child; NULL != child; child = child->next_sibling)
+        {
+            report_node_damage(child, tracker);
+        }
+    }
+    else if (!damage_rect_is_empty(&node->bounds))
+    {
+        key = damage_hash(&node->world, sizeof(node->world), DAMAGE_HASH_SEED);
+        key = damage_hash(&node->u, sizeof(node->u), key);
+        key = damage_hash(&node->color, sizeof(node->color), key);
+        key = damage_hash(&node->draw_quality, sizeof(node->draw_quality), key);
+        if (SCENE_NODE_TEXT == node->type)
+        {
+            key = damage_hash(node->u.text.run->text, strlen(node->u.text.run->text), key);
+        }
+        damage_tracker_add_item(tracker, key, &node->bounds);
+    }
+    else
+    {
+        /* Offscreen only, nothing drawn into the frame target */
+    }
+}
+
+/*******************************************************************************
+* Function Name: scene_graph_report_damage
+********************************************************************************
+* Summary:
+*  Reports the bounds of every draw of the scene to the damage tracker.
+*
+* Parameters:
+*  graph   - Pointer to the scene graph
+*  tracker - Damage tracker between begin and end of a frame
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void scene_graph_report_damage(scene_graph_t *graph, damage_tracker_t *tracker)
+{
+    report_node_damage(graph->root, tracker);
+}
+
+/*******************************************************************************
+* Function Name: scene_graph_get_stats
+********************************************************************************
+* Summary:
+*  Returns the traversal statistics, optionally resetting them.
+*
+* Parameters:
+*  graph - Pointer to the scene graph
+*  stats - Output statistics
+*  reset - true to clear the statistics after reading them
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void scene_graph_get_stats(scene_graph_t *graph, scene_graph_stats_t *stats,
+                           bool reset)
+{
+    *stats = graph->stats;
+
+    if (reset)
+    {
+        memset(&graph->stats, 0, sizeof(graph->stats));
+    }
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,196 @@
+/*******************************************************************************
+* File Name        : scene_graph.h
+*
+* Description      : This file contains the declarations of the retained scene graph.
+*                    Demos describe their content once as a tree of group, layer,
+*                    path, image and pattern nodes. World matrices and screen bounds
+*                    are cached and only recomputed for nodes marked dirty, and a
+*                    single traversal emits the vg_lite calls of a frame.
+*
+* Related Document : See README.md
+*
+********************************************************************************
+* Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+
+#ifndef SCENE_GRAPH_H
+#define SCENE_GRAPH_H
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include <stdint.h>
+#include <stdbool.h>
+#include "vg_lite.h"
+#include "damage_tracker.h"
+#include "scene_fingerprint.h"
+#include "cmd_list.h"
+#include "quality_policy.h"
+
+/*******************************************************************************
+* Data Structures and Types
+*******************************************************************************/
+
+typedef enum {
+    SCENE_NODE_GROUP,           /* Transforms its children, draws nothing */
+    SCENE_NODE_LAYER,           /* Group rendered into an offscreen buffer */
+    SCENE_NODE_PATH,            /* vg_lite_draw() */
+    SCENE_NODE_IMAGE,           /* vg_lite_blit() / vg_lite_blit_rect() */
+    SCENE_NODE_PATTERN,         /* vg_lite_draw_pattern() */
+    SCENE_NODE_TEXT             /* Text run, vg_lite_blit_rect() per span */
+} scene_node_type_t;
+
+typedef struct {
+    vg_lite_buffer_t *buffer;   /* Offscreen target of the children */
+    vg_lite_color_t clear_color;/* Cleared to this color before drawing */
+    bool composite;             /* Blit the layer into the parent target */
+    vg_lite_filter_t filter;
+} scene_layer_t;
+
+typedef struct {
+    vg_lite_path_t *path;
+} scene_path_t;
+
+typedef struct {
+    vg_lite_buffer_t *image;
+    vg_lite_rectangle_t *rect;  /* Source rectangle, NULL for whole image */
+    vg_lite_filter_t filter;
+    image_pyramid_t *pyramid;   /* Levels of the image, NULL if none */
+} scene_image_t;
+
+typedef struct {
+    vg_lite_path_t *path;
+    vg_lite_buffer_t *image;
+    vg_lite_matrix_t image_local;   /* Image placement in parent space */
+    vg_lite_matrix_t image_world;
+    vg_lite_pattern_mode_t mode;
+    vg_lite_color_t pattern_color;
+    vg_lite_filter_t filter;
+} scene_pattern_t;
+
+typedef struct {
+    text_run_t *run;            /* Laid out string, owned by the caller */
+} scene_text_t;
+
+typedef struct scene_node {
+    scene_node_type_t type;
+    struct scene_node *parent;
+    struct scene_node *first_child;
+    struct scene_node *last_child;
+    struct scene_node *next_sibling;
+
+    vg_lite_matrix_t local;     /* Transform relative to the parent */
+    vg_lite_matrix_t world;     /* Cached transform to the target */
+    damage_rect_t bounds;       /* Cached bounds in target coordinates */
+    bool dirty;                 /* local changed since the last update */
+    uint8_t still_frames;       /* Updates since the world matrix changed */
+    vg_lite_quality_t draw_quality; /* Antialiasing selected for this frame */
+    bool visible;
+
+    /* Paint */
+    vg_lite_fill_t fill_rule;
+    vg_lite_blend_t blend;
+    vg_lite_color_t color;
+    vg_lite_quality_t quality;  /* Best antialiasing of path and pattern nodes */
+
+    union {
+        scene_layer_t layer;
+        scene_path_t path;
+        scene_image_t image;
+        scene_pattern_t pattern;
+        scene_text_t text;
+    } u;
+} scene_node_t;
+
+typedef struct {
+    uint32_t updated;           /* World matrices recomputed */
+    uint32_t draw_calls;        /* vg_lite calls emitted by traversals */
+    uint32_t culled;            /* Nodes skipped outside the clip */
+} scene_graph_stats_t;
+
+typedef struct {
+    scene_node_t *root;
+    quality_policy_t *quality_policy;   /* NULL to draw with the node quality */
+    scene_graph_stats_t stats;
+} scene_graph_t;
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+void scene_node_init_group(scene_node_t *node);
+void scene_node_init_layer(scene_node_t *node, vg_lite_buffer_t *buffer,
+                           vg_lite_color_t clear_color, bool composite,
+                           vg_lite_blend_t blend);
+void scene_node_init_path(scene_node_t *node, vg_lite_path_t *path,
+                          vg_lite_fill_t fill_rule, vg_lite_blend_t blend,
+                          vg_lite_color_t color);
+void scene_node_init_image(scene_node_t *node, vg_lite_buffer_t *image,
+                           vg_lite_rectangle_t *rect, vg_lite_blend_t blend,
+                           vg_lite_filter_t filter);
+void scene_node_init_pyramid(scene_node_t *node, image_pyramid_t *pyramid,
+                             vg_lite_blend_t blend, vg_lite_filter_t filter);
+void scene_node_init_pattern(scene_node_t *node, vg_lite_path_t *path,
+                             vg_lite_fill_t fill_rule, vg_lite_buffer_t *image,
+                             const vg_lite_matrix_t *image_local,
+                             vg_lite_blend_t blend, vg_lite_pattern_mode_t mode,
+                             vg_lite_color_t pattern_color,
+                             vg_lite_color_t color, vg_lite_filter_t filter);
+void scene_node_init_text(scene_node_t *node, text_run_t *run, vg_lite_color_t color);
+void scene_node_add_child(scene_node_t *parent, scene_node_t *child);
+void scene_node_set_transform(scene_node_t *node, const vg_lite_matrix_t *local);
+void scene_node_set_visible(scene_node_t *node, bool visible);
+void scene_node_set_color(scene_node_t *node, vg_lite_color_t color);
+void scene_node_set_text(scene_node_t *node, const char *text);
+
+void scene_graph_init(scene_graph_t *graph, scene_node_t *root);
+void scene_graph_set_quality_policy(scene_graph_t *graph, quality_policy_t *policy);
+void scene_graph_invalidate(scene_graph_t *graph);
+void scene_graph_update(scene_graph_t *graph);
+vg_lite_error_t scene_graph_draw(scene_graph_t *graph, vg_lite_buffer_t *target,
+                                 const damage_rect_t *clip);
+void scene_graph_fingerprint(scene_graph_t *graph, scene_fingerprint_t *fp);
+void scene_graph_report_damage(scene_graph_t *graph, damage_tracker_t *tracker);
+void scene_graph_get_stats(scene_graph_t *graph, scene_graph_stats_t *stats,
+                           bool reset);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* SCENE_GRAPH_H */
+
+/* [] END OF FILE */
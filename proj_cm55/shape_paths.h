@@ -67,7 +67,8 @@ vg_lite_path_t polygon_path =
     {0},                            /* uploaded */
     sizeof(polygon_path_data),      /* path length */
     polygon_path_data,              /* path data */
-    1                               /* path changed */
+    1,                              /* path changed */
+    0                               /* path data not owned by the driver */
 };
 
 int32_t self_intersecting_star[] = 
@@ -89,7 +90,8 @@ vg_lite_path_t self_intersecting_star_path =
     {0},                                /* uploaded */
     sizeof(self_intersecting_star),     /* path length */
     self_intersecting_star,             /* path data */
-    1                                   /* path changed */
+    1,                                  /* path changed */
+    0                                   /* path data not owned by the driver */
 };
 
 int32_t overlapping_squares[] = 
@@ -119,7 +121,8 @@ vg_lite_path_t overlapping_squares_path =
     {0},                                /* uploaded */
     sizeof(overlapping_squares),        /* path length */
     overlapping_squares,                /* path data */
-    1                                   /* path changed */
+    1,                                  /* path changed */
+    0                                   /* path data not owned by the driver */
 };
 
 int32_t concentric_circles_data_path[] = 
@@ -165,7 +168,8 @@ vg_lite_path_t concentric_circles_path =
     {0},
     sizeof(concentric_circles_data_path),
     concentric_circles_data_path,
-    1
+    1,
+    0
 };
 
 int16_t triangle_path_data[] = 
@@ -255,7 +259,8 @@ static vg_lite_path_t highlight_path =
     {0},                                                            /* uploaded */
     sizeof(highlight_path_data),                                    /* path length */
     highlight_path_data,                                            /* path data */
-    1
+    1,
+    0
 };
 
 int16_t square_path_data[] = 
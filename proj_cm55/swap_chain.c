@@ -0,0 +1,343 @@
+/*******************************************************************************
+* File Name        : swap_chain.c
+*
+* Description      : This file contains the frame buffer swap chain state machine.
+*                    It has no dependency on the graphics driver so that it can be
+*                    driven by a simulated DC interrupt on a host build.
+*
+* Related Document : See README.md
+*
+********************************************************************************
+* Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+
+#include <string.h>
+#include "swap_chain.h"
+#include "gfx_port.h"
+
+/*******************************************************************************
+* Function Name: queue_push
+********************************************************************************
+* Summary:
+*  Appends a slot to the in-flight FIFO. Must be called with interrupts
+*  disabled.
+*
+* Parameters:
+*  chain - Pointer to the swap chain
+*  slot  - Slot index to append
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void queue_push(swap_chain_t *chain, uint8_t slot)
+{
+    uint8_t tail = (chain->queue_head + chain->queue_count) % chain->depth;
+
+    chain->queue[tail] = slot;
+    chain->queue_count++;
+}
+
+/*******************************************************************************
+* Function Name: queue_pop
+********************************************************************************
+* Summary:
+*  Removes and returns the head of the in-flight FIFO. Must be called with
+*  interrupts disabled and a non-empty FIFO.
+*
+* Parameters:
+*  chain - Pointer to the swap chain
+*
+* Return:
+*  uint8_t - Slot index that was at the head of the FIFO
+*
+*******************************************************************************/
+static uint8_t queue_pop(swap_chain_t *chain)
+{
+    uint8_t slot = chain->queue[chain->queue_head];
+
+    chain->queue_head = (chain->queue_head + 1U) % chain->depth;
+    chain->queue_count--;
+
+    return slot;
+}
+
+/*******************************************************************************
+* Function Name: kick_flip
+********************************************************************************
+* Summary:
+*  Programs the head of the in-flight FIFO into the display controller if no
+*  other flip is waiting for the DC to latch it. Must be called with
+*  interrupts disabled.
+*
+* Parameters:
+*  chain - Pointer to the swap chain
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void kick_flip(swap_chain_t *chain)
+{
+    if ((!chain->flip_pending) && (chain->queue_count > 0U))
+    {
+        chain->flip_pending = true;
+        chain->present(chain->queue[chain->queue_head], chain->user_data);
+    }
+}
+
+/*******************************************************************************
+* Function Name: swap_chain_init
+********************************************************************************
+* Summary:
+*  Initializes a swap chain with all buffers free.
+*
+* Parameters:
+*  chain     - Pointer to the swap chain
+*  depth     - Number of frame buffers, SWAP_CHAIN_MIN_DEPTH to
+*              SWAP_CHAIN_MAX_DEPTH
+*  present   - Callback that programs a slot into the display controller
+*  user_data - Opaque pointer passed to the present callback
+*
+* Return:
+*  bool      - true on success, false on invalid arguments
+*
+*******************************************************************************/
+bool swap_chain_init(swap_chain_t *chain, uint8_t depth,
+                     swap_chain_present_t present, void *user_data)
+{
+    bool result = false;
+
+    if ((NULL != chain) && (NULL != present) &&
+        (depth >= SWAP_CHAIN_MIN_DEPTH) && (depth <= SWAP_CHAIN_MAX_DEPTH))
+    {
+        memset(chain, 0, sizeof(*chain));
+        chain->depth        = depth;
+        chain->scanout_slot = SWAP_CHAIN_INVALID_SLOT;
+        chain->present      = present;
+        chain->user_data    = user_data;
+
+        for (uint8_t i = 0; i < depth; i++)
+        {
+            chain->state[i] = SWAP_BUFFER_FREE;
+        }
+        result = true;
+    }
+
+    return result;
+}
+
+/*******************************************************************************
+* Function Name: swap_chain_acquire
+********************************************************************************
+* Summary:
+*  Hands a free buffer to the render task. Does not block.
+*
+* Parameters:
+*  chain   - Pointer to the swap chain
+*
+* Return:
+*  uint8_t - Acquired slot index, or SWAP_CHAIN_INVALID_SLOT if every buffer
+*            is in flight or on scanout
+*
+*******************************************************************************/
+uint8_t swap_chain_acquire(swap_chain_t *chain)
+{
+    uint8_t slot = SWAP_CHAIN_INVALID_SLOT;
+    uint32_t state = GFX_ENTER_CRITICAL();
+
+    for (uint8_t i = 0; i < chain->depth; i++)
+    {
+        if (SWAP_BUFFER_FREE == chain->state[i])
+        {
+            chain->state[i] = SWAP_BUFFER_RENDERING;
+            slot = i;
+            break;
+        }
+    }
+
+    GFX_EXIT_CRITICAL(state);
+
+    return slot;
+}
+
+/*******************************************************************************
+* Function Name: swap_chain_submit
+********************************************************************************
+* Summary:
+*  Queues a rendered buffer for display. The buffer is programmed into the
+*  display controller right away if the DC has no other flip pending,
+*  otherwise it is programmed from the DC interrupt once the DC is ready.
+*
+* Parameters:
+*  chain - Pointer to the swap chain
+*  slot  - Slot index previously returned by swap_chain_acquire()
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void swap_chain_submit(swap_chain_t *chain, uint8_t slot)
+{
+    uint32_t state;
+
+    if ((slot < chain->depth) && (SWAP_BUFFER_RENDERING == chain->state[slot]))
+    {
+        state = GFX_ENTER_CRITICAL();
+
+        chain->state[slot] = SWAP_BUFFER_IN_FLIGHT;
+        chain->submit_cycles[slot] = gfx_port_cycles();
+        queue_push(chain, slot);
+
+        chain->stats.frames_submitted++;
+        chain->stats.queued = chain->queue_count;
+        if (chain->queue_count > chain->stats.max_queued)
+        {
+            chain->stats.max_queued = chain->queue_count;
+        }
+
+        kick_flip(chain);
+
+        GFX_EXIT_CRITICAL(state);
+    }
+}
+
+/*******************************************************************************
+* Function Name: swap_chain_on_vsync
+********************************************************************************
+* Summary:
+*  Advances the swap chain when the display controller has latched a new
+*  frame buffer. The previously scanned out buffer is released and the next
+*  in-flight buffer, if any, is programmed. To be called from the DC
+*  interrupt (or from a simulated one on a host build).
+*
+* Parameters:
+*  chain - Pointer to the swap chain
+*
+* Return:
+*  bool  - true if a buffer was released and a blocked render task should
+*          be woken up
+*
+*******************************************************************************/
+bool swap_chain_on_vsync(swap_chain_t *chain)
+{
+    uint8_t slot;
+    uint32_t latency_us;
+    bool released = false;
+    uint32_t state = GFX_ENTER_CRITICAL();
+
+    chain->stats.vsync_count++;
+
+    if (chain->flip_pending)
+    {
+        slot = queue_pop(chain);
+        chain->flip_pending = false;
+
+        if (SWAP_CHAIN_INVALID_SLOT != chain->scanout_slot)
+        {
+            chain->state[chain->scanout_slot] = SWAP_BUFFER_FREE;
+            released = true;
+        }
+        chain->state[slot] = SWAP_BUFFER_ON_SCANOUT;
+        chain->scanout_slot = slot;
+        chain->stats.frames_presented++;
+
+        latency_us = gfx_port_cycles_to_us(gfx_port_cycles() -
+                                           chain->submit_cycles[slot]);
+        chain->stats.latency_sum_us += latency_us;
+        if (latency_us > chain->stats.latency_max_us)
+        {
+            chain->stats.latency_max_us = latency_us;
+        }
+
+        kick_flip(chain);
+    }
+    else
+    {
+        /* Nothing new was ready, the panel shows the same frame again */
+        chain->stats.repeated_vsyncs++;
+    }
+
+    GFX_EXIT_CRITICAL(state);
+
+    return released;
+}
+
+/*******************************************************************************
+* Function Name: swap_chain_get_queued
+********************************************************************************
+* Summary:
+*  Returns the number of buffers currently in flight.
+*
+* Parameters:
+*  chain   - Pointer to the swap chain
+*
+* Return:
+*  uint8_t - Number of submitted buffers not yet latched by the DC
+*
+*******************************************************************************/
+uint8_t swap_chain_get_queued(const swap_chain_t *chain)
+{
+    return chain->queue_count;
+}
+
+/*******************************************************************************
+* Function Name: swap_chain_get_stats
+********************************************************************************
+* Summary:
+*  Copies the swap chain statistics, optionally resetting the counters.
+*
+* Parameters:
+*  chain - Pointer to the swap chain
+*  stats - Destination for the statistics
+*  reset - true to clear the counters after reading them
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void swap_chain_get_stats(swap_chain_t *chain, swap_chain_stats_t *stats,
+                          bool reset)
+{
+    uint32_t state = GFX_ENTER_CRITICAL();
+
+    *stats = chain->stats;
+    if (reset)
+    {
+        memset(&chain->stats, 0, sizeof(chain->stats));
+    }
+
+    GFX_EXIT_CRITICAL(state);
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,127 @@
+/*******************************************************************************
+* File Name        : swap_chain.h
+*
+* Description      : This file contains the declarations of the frame buffer swap
+*                    chain. It tracks the state of each frame buffer (free, rendering,
+*                    in flight, on scanout) so that the GPU can render ahead while the
+*                    display controller is still scanning out an earlier frame.
+*
+* Related Document : See README.md
+*
+********************************************************************************
+* Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+
+#ifndef SWAP_CHAIN_H
+#define SWAP_CHAIN_H
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include <stdint.h>
+#include <stdbool.h>
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+#define SWAP_CHAIN_MIN_DEPTH                (2U)
+#define SWAP_CHAIN_MAX_DEPTH                (4U)
+#define SWAP_CHAIN_INVALID_SLOT             (0xFFU)
+
+/*******************************************************************************
+* Data Structures and Types
+*******************************************************************************/
+
+typedef enum {
+    SWAP_BUFFER_FREE,           /* Available for rendering */
+    SWAP_BUFFER_RENDERING,      /* Acquired by the render task */
+    SWAP_BUFFER_IN_FLIGHT,      /* Submitted, waiting to be latched by the DC */
+    SWAP_BUFFER_ON_SCANOUT      /* Currently scanned out by the DC */
+} swap_buffer_state_t;
+
+/* Programs the given slot into the display controller. Called with interrupts
+ * disabled, either from the render task or from the DC interrupt. */
+typedef void (*swap_chain_present_t)(uint8_t slot, void *user_data);
+
+typedef struct {
+    uint32_t frames_submitted;  /* Frames handed over by the render task */
+    uint32_t frames_presented;  /* Frames latched by the display controller */
+    uint32_t vsync_count;       /* DC interrupts seen */
+    uint32_t repeated_vsyncs;   /* DC interrupts with no new frame queued */
+    uint8_t  queued;            /* In-flight buffers at the last submit */
+    uint8_t  max_queued;        /* Highest in-flight count since last reset */
+    uint32_t latency_sum_us;    /* Submit to scanout time, summed */
+    uint32_t latency_max_us;    /* Worst submit to scanout time */
+} swap_chain_stats_t;
+
+typedef struct {
+    uint8_t depth;
+    volatile swap_buffer_state_t state[SWAP_CHAIN_MAX_DEPTH];
+
+    /* FIFO of in-flight slots, the head is the one programmed into the DC */
+    uint8_t queue[SWAP_CHAIN_MAX_DEPTH];
+    uint32_t submit_cycles[SWAP_CHAIN_MAX_DEPTH];
+    uint8_t queue_head;
+    uint8_t queue_count;
+    bool flip_pending;
+    uint8_t scanout_slot;
+
+    swap_chain_present_t present;
+    void *user_data;
+
+    swap_chain_stats_t stats;
+} swap_chain_t;
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+bool swap_chain_init(swap_chain_t *chain, uint8_t depth,
+                     swap_chain_present_t present, void *user_data);
+uint8_t swap_chain_acquire(swap_chain_t *chain);
+void swap_chain_submit(swap_chain_t *chain, uint8_t slot);
+bool swap_chain_on_vsync(swap_chain_t *chain);
+uint8_t swap_chain_get_queued(const swap_chain_t *chain);
+void swap_chain_get_stats(swap_chain_t *chain, swap_chain_stats_t *stats,
+                          bool reset);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* SWAP_CHAIN_H */
+
+/* [] END OF FILE */
@@ -0,0 +1,306 @@
+/*******************************************************************************
+* File Name        : tess_probe.c
+*
+* Description      : This file contains the tessellation probe. VGLite tessellates a path
+*                    in the window set with vg_lite_init(). A draw taller than the window
+*                    is tessellated in several passes. The probe derives the buffer use
+*                    and the passes of each draw from its area on the target. The
+*                    calibration evaluates all candidate window heights at once, because
+*                    the passes of a draw only depend on its area.
+*
+* Related Document : See README.md
+*
+********************************************************************************
+* Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+
+#include <stdio.h>
+#include <string.h>
+#include "tess_probe.h"
+
+
+/*******************************************************************************
+* Function Name: div_round_up
+********************************************************************************
+* Summary:
+*  Integer division rounding up.
+*
+* Parameters:
+*  value    - Dividend
+*  divisor  - Divisor, not 0
+*
+* Return:
+*  uint32_t - Quotient rounded up
+*
+*******************************************************************************/
+static uint32_t div_round_up(uint32_t value, uint32_t divisor)
+{
+    return (value + divisor - 1U) / divisor;
+}
+
+/*******************************************************************************
+* Function Name: tess_probe_init
+********************************************************************************
+* Summary:
+*  Initializes the probe for the tessellation window of the driver.
+*
+* Parameters:
+*  probe         - Pointer to the probe
+*  window_width  - Tessellation width passed to vg_lite_init()
+*  window_height - Tessellation height passed to vg_lite_init()
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void tess_probe_init(tess_probe_t *probe, uint16_t window_width, uint16_t window_height)
+{
+    memset(probe, 0, sizeof(*probe));
+    probe->window_width  = window_width;
+    probe->window_height = window_height;
+}
+
+/*******************************************************************************
+* Function Name: tess_probe_record
+********************************************************************************
+* Summary:
+*  Records one draw. A draw is tessellated in one pass per window it spans;
+*  each pass uses one buffer line per row of the draw inside the window.
+*
+* Parameters:
+*  probe - Pointer to the probe
+*  area  - Area of the draw on the target, clipped to the target
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void tess_probe_record(tess_probe_t *probe, const damage_rect_t *area)
+{
+    uint32_t width;
+    uint32_t height;
+    uint32_t cols;
+    uint32_t passes;
+    uint32_t bytes;
+
+    if (damage_rect_is_empty(area))
+    {
+        return;
+    }
+
+    width  = (uint32_t)(area->x1 - area->x0);
+    height = (uint32_t)(area->y1 - area->y0);
+    cols   = div_round_up(width, probe->window_width);
+    passes = cols * div_round_up(height, probe->window_height);
+    bytes  = ((height < probe->window_height) ? height : probe->window_height) *
+             TESS_PROBE_BYTES_PER_ROW;
+
+    probe->stats.draws++;
+    probe->stats.passes       += passes;
+    probe->stats.extra_passes += passes - cols;
+    if (bytes > probe->stats.peak_bytes)
+    {
+        probe->stats.peak_bytes = bytes;
+    }
+
+    if (probe->calibrating)
+    {
+        probe->calibration_draws++;
+        if (height > probe->calibration_max_rows)
+        {
+            probe->calibration_max_rows = (uint16_t)height;
+        }
+        for (uint32_t i = 0; i < TESS_PROBE_CANDIDATES; i++)
+        {
+            probe->candidate_extra[i] +=
+                cols * (div_round_up(height, (i + 1U) * TESS_PROBE_ROW_STEP) - 1U);
+        }
+    }
+}
+
+/*******************************************************************************
+* Function Name: tess_probe_end_frame
+********************************************************************************
+* Summary:
+*  Counts a frame for the per frame statistics.
+*
+* Parameters:
+*  probe - Pointer to the probe
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void tess_probe_end_frame(tess_probe_t *probe)
+{
+    probe->stats.frames++;
+}
+
+/*******************************************************************************
+* Function Name: tess_probe_start_calibration
+********************************************************************************
+* Summary:
+*  Clears the calibration results and starts evaluating the candidate
+*  window heights on every recorded draw.
+*
+* Parameters:
+*  probe - Pointer to the probe
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void tess_probe_start_calibration(tess_probe_t *probe)
+{
+    probe->calibrating = false;
+    probe->calibration_draws    = 0U;
+    probe->calibration_max_rows = 0U;
+    memset(probe->candidate_extra, 0, sizeof(probe->candidate_extra));
+    probe->calibrating = true;
+}
+
+/*******************************************************************************
+* Function Name: tess_probe_stop_calibration
+********************************************************************************
+* Summary:
+*  Stops the calibration, the results are kept until the next start.
+*
+* Parameters:
+*  probe - Pointer to the probe
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void tess_probe_stop_calibration(tess_probe_t *probe)
+{
+    probe->calibrating = false;
+}
+
+/*******************************************************************************
+* Function Name: tess_probe_recommend
+********************************************************************************
+* Summary:
+*  Returns the smallest candidate window height that tessellated every draw
+*  of the calibration in as few passes as a window of the full target.
+*
+* Parameters:
+*  probe    - Pointer to the probe
+*
+* Return:
+*  uint16_t - Window height in lines, the configured height if no draw was
+*             recorded or no candidate is tall enough
+*
+*******************************************************************************/
+uint16_t tess_probe_recommend(const tess_probe_t *probe)
+{
+    if (0U == probe->calibration_draws)
+    {
+        return probe->window_height;
+    }
+
+    for (uint32_t i = 0; i < TESS_PROBE_CANDIDATES; i++)
+    {
+        if (0U == probe->candidate_extra[i])
+        {
+            return (uint16_t)((i + 1U) * TESS_PROBE_ROW_STEP);
+        }
+    }
+
+    return probe->window_height;
+}
+
+/*******************************************************************************
+* Function Name: tess_probe_report
+********************************************************************************
+* Summary:
+*  Prints the extra passes of each candidate window height up to the
+*  recommended one, and the build setting adopting it.
+*
+* Parameters:
+*  probe - Pointer to the probe
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void tess_probe_report(const tess_probe_t *probe)
+{
+    uint16_t recommended = tess_probe_recommend(probe);
+    uint32_t height;
+
+    printf("\r\nTessellation calibration: %u draws, tallest %u lines\r\n",
+           (unsigned int)probe->calibration_draws, (unsigned int)probe->calibration_max_rows);
+    for (uint32_t i = 0; i < TESS_PROBE_CANDIDATES; i++)
+    {
+        height = (i + 1U) * TESS_PROBE_ROW_STEP;
+        if (height > recommended)
+        {
+            break;
+        }
+        printf("  %3u lines, %6u bytes: %6u extra passes\r\n", (unsigned int)height,
+               (unsigned int)(height * TESS_PROBE_BYTES_PER_ROW),
+               (unsigned int)probe->candidate_extra[i]);
+    }
+    printf("Recommended: DEFINES+=GPU_TESSELLATION_HEIGHT=%uU (%u bytes, now %u bytes)\r\n",
+           (unsigned int)recommended, (unsigned int)(recommended * TESS_PROBE_BYTES_PER_ROW),
+           (unsigned int)(probe->window_height * TESS_PROBE_BYTES_PER_ROW));
+}
+
+/*******************************************************************************
+* Function Name: tess_probe_get_stats
+********************************************************************************
+* Summary:
+*  Returns the statistics of the configured window, optionally resetting
+*  them.
+*
+* Parameters:
+*  probe - Pointer to the probe
+*  stats - Output statistics
+*  reset - true to clear the statistics after reading them
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void tess_probe_get_stats(tess_probe_t *probe, tess_probe_stats_t *stats, bool reset)
+{
+    *stats = probe->stats;
+
+    if (reset)
+    {
+        memset(&probe->stats, 0, sizeof(probe->stats));
+    }
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,111 @@
+/*******************************************************************************
+* File Name        : tess_probe.h
+*
+* Description      : This file contains the declarations of the tessellation probe. It
+*                    models the tessellation window passed to vg_lite_init(), records the
+*                    buffer use and the number of passes of every draw, and evaluates a
+*                    sweep of window heights to recommend the smallest one that adds no
+*                    passes.
+*
+* Related Document : See README.md
+*
+********************************************************************************
+* Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+
+#ifndef TESS_PROBE_H
+#define TESS_PROBE_H
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include <stdint.h>
+#include <stdbool.h>
+#include "damage_tracker.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+
+/* Tessellation buffer used per line of the tessellation window */
+#define TESS_PROBE_BYTES_PER_ROW            (128U)
+
+/* Window heights evaluated by the calibration, in steps of TESS_PROBE_ROW_STEP */
+#define TESS_PROBE_ROW_STEP                 (16U)
+#define TESS_PROBE_CANDIDATES               (32U)
+
+/*******************************************************************************
+* Data Structures and Types
+*******************************************************************************/
+
+typedef struct {
+    uint32_t draws;
+    uint32_t passes;            /* Tessellation passes with the configured window */
+    uint32_t extra_passes;      /* Passes caused by draws taller than the window */
+    uint32_t peak_bytes;        /* Largest tessellation buffer use of one draw */
+    uint32_t frames;
+} tess_probe_stats_t;
+
+typedef struct {
+    uint16_t window_width;      /* As passed to vg_lite_init() */
+    uint16_t window_height;
+    bool calibrating;
+    uint32_t calibration_draws;
+    uint16_t calibration_max_rows;  /* Tallest draw seen while calibrating */
+    uint32_t candidate_extra[TESS_PROBE_CANDIDATES];    /* Extra passes per window height */
+    tess_probe_stats_t stats;
+} tess_probe_t;
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+void tess_probe_init(tess_probe_t *probe, uint16_t window_width, uint16_t window_height);
+void tess_probe_record(tess_probe_t *probe, const damage_rect_t *area);
+void tess_probe_end_frame(tess_probe_t *probe);
+void tess_probe_start_calibration(tess_probe_t *probe);
+void tess_probe_stop_calibration(tess_probe_t *probe);
+uint16_t tess_probe_recommend(const tess_probe_t *probe);
+void tess_probe_report(const tess_probe_t *probe);
+void tess_probe_get_stats(tess_probe_t *probe, tess_probe_stats_t *stats, bool reset);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* TESS_PROBE_H */
+
+/* [] END OF FILE */
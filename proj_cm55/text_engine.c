@@ -0,0 +1,304 @@
+/*******************************************************************************
+* File Name        : text_engine.c
+*
+* Description      : This file contains the text engine. A run is laid out only when its
+*                    string changes: each character is looked up in the glyph table and
+*                    runs of characters that are also neighbours in the atlas are merged
+*                    into one span, so a string is drawn with one vg_lite_blit_rect() call
+*                    per span instead of one per glyph.
+*
+* Related Document : See README.md
+*
+********************************************************************************
+* Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include <stdio.h>
+#include <string.h>
+#include "gfx_port.h"
+#include "text_engine.h"
+#include "gpu_profile.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* Address alignment of the image buffers required by the GPU */
+#define TEXT_ATLAS_ADDRESS_MASK             (0x3FU)
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+static text_stats_t text_stats;
+
+
+/*******************************************************************************
+* Function Name: text_font_init
+********************************************************************************
+* Summary:
+*  Sets up the atlas buffer of a prepared font. The atlas holds coverage
+*  only, it is drawn in the color of the run.
+*
+* Parameters:
+*  font     - Font, filled in
+*  asset    - Font prepared by tools/host/font2vglite
+*
+* Return:
+*  bool     - false if the atlas is not usable, the error is reported
+*
+*******************************************************************************/
+bool text_font_init(text_font_t *font, const font_asset_t *asset)
+{
+    const image_asset_t *atlas = asset->atlas;
+
+    memset(font, 0, sizeof(*font));
+
+    if ((VG_LITE_A8 != atlas->format) ||
+        (atlas->stride < image_asset_min_stride(atlas->format, atlas->width)))
+    {
+        printf("Font %s: atlas is not %s with a valid stride\r\n", asset->name,
+               image_asset_format_name(VG_LITE_A8));
+        return false;
+    }
+    if (0U != ((uintptr_t)atlas->data & TEXT_ATLAS_ADDRESS_MASK))
+    {
+        printf("Font %s: atlas is not aligned at 64 bytes\r\n", asset->name);
+        return false;
+    }
+
+    font->asset             = asset;
+    font->atlas.width       = atlas->width;
+    font->atlas.height      = atlas->height;
+    font->atlas.stride      = atlas->stride;
+    font->atlas.format      = atlas->format;
+    /* The coverage is multiplied by the blit color */
+    font->atlas.image_mode  = VG_LITE_MULTIPLY_IMAGE_MODE;
+    font->atlas.handle      = NULL;
+    font->atlas.memory      = atlas->data;
+    font->atlas.address     = (uint32_t)(uintptr_t)atlas->data;
+
+    return true;
+}
+
+/*******************************************************************************
+* Function Name: text_font_glyph
+********************************************************************************
+* Summary:
+*  Looks up the glyph of a character. Characters missing in the font are
+*  replaced by TEXT_REPLACEMENT_CHAR.
+*
+* Parameters:
+*  font     - Font
+*  c        - Character
+*
+* Return:
+*  const font_glyph_t * - Glyph, NULL if the replacement is missing too
+*
+*******************************************************************************/
+const font_glyph_t *text_font_glyph(const text_font_t *font, char c)
+{
+    const font_asset_t *asset = font->asset;
+    uint32_t index = (uint32_t)(uint8_t)c - asset->first_char;
+
+    if (index >= asset->glyph_count)
+    {
+        index = (uint32_t)(uint8_t)TEXT_REPLACEMENT_CHAR - asset->first_char;
+    }
+
+    return (index < asset->glyph_count) ? &asset->glyphs[index] : NULL;
+}
+
+/*******************************************************************************
+* Function Name: text_run_init
+********************************************************************************
+* Summary:
+*  Initializes an empty text run.
+*
+* Parameters:
+*  run      - Run to be initialized
+*  font     - Font of the run
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void text_run_init(text_run_t *run, text_font_t *font)
+{
+    memset(run, 0, sizeof(*run));
+    run->font   = font;
+    run->height = font->asset->line_height;
+}
+
+/*******************************************************************************
+* Function Name: text_run_set
+********************************************************************************
+* Summary:
+*  Changes the string of a run and lays it out again, unless it is unchanged.
+*  Blank glyphs only advance the pen. A glyph whose cell follows the cell of
+*  the previous glyph in the atlas extends the span of that glyph.
+*
+* Parameters:
+*  run      - Run
+*  text     - New string, truncated to TEXT_RUN_MAX_LENGTH characters
+*
+* Return:
+*  bool     - true if the string changed
+*
+*******************************************************************************/
+bool text_run_set(text_run_t *run, const char *text)
+{
+    uint32_t start;
+    const font_glyph_t *previous = NULL;
+    int32_t pen = 0;
+
+    if (0 == strncmp(run->text, text, TEXT_RUN_MAX_LENGTH))
+    {
+        return false;
+    }
+
+    start = gfx_port_cycles();
+    strncpy(run->text, text, TEXT_RUN_MAX_LENGTH);
+    run->text[TEXT_RUN_MAX_LENGTH] = '\0';
+    run->span_count  = 0U;
+    run->glyph_count = 0U;
+
+    for (const char *c = run->text; '\0' != *c; c++)
+    {
+        const font_glyph_t *glyph = text_font_glyph(run->font, *c);
+
+        if (NULL == glyph)
+        {
+            continue;
+        }
+        if (glyph->ink)
+        {
+            if ((NULL != previous) && previous->ink && (glyph->y == previous->y) &&
+                (glyph->x == (previous->x + previous->advance)))
+            {
+                run->spans[run->span_count - 1U].cells.width += glyph->advance;
+            }
+            else
+            {
+                text_span_t *span = &run->spans[run->span_count++];
+
+                span->cells.x      = glyph->x;
+                span->cells.y      = glyph->y;
+                span->cells.width  = glyph->advance;
+                span->cells.height = run->font->asset->line_height;
+                span->x            = pen;
+            }
+            run->glyph_count++;
+        }
+        pen += glyph->advance;
+        previous = glyph;
+    }
+    run->width = pen;
+
+    text_stats.layouts++;
+    text_stats.layout_cycles += gfx_port_cycles() - start;
+
+    return true;
+}
+
+/*******************************************************************************
+* Function Name: text_run_draw
+********************************************************************************
+* Summary:
+*  Draws a run with one vg_lite_blit_rect() call per span. The matrix places
+*  the top left corner of the run, the spans are offset along its x axis.
+*
+* Parameters:
+*  run             - Run
+*  target          - Render target
+*  matrix          - Placement of the run
+*  color           - Text color
+*
+* Return:
+*  vg_lite_error_t - VG_LITE_SUCCESS or the error of the failing call
+*
+*******************************************************************************/
+vg_lite_error_t text_run_draw(const text_run_t *run, vg_lite_buffer_t *target,
+                              const vg_lite_matrix_t *matrix, vg_lite_color_t color)
+{
+    uint32_t start = gfx_port_cycles();
+    vg_lite_error_t error = VG_LITE_SUCCESS;
+
+    for (uint8_t s = 0; (s < run->span_count) && (VG_LITE_SUCCESS == error); s++)
+    {
+        vg_lite_matrix_t span_matrix = *matrix;
+        vg_lite_rectangle_t cells = run->spans[s].cells;
+
+        for (uint8_t row = 0; row < 3U; row++)
+        {
+            span_matrix.m[row][2] += span_matrix.m[row][0] * (vg_lite_float_t)run->spans[s].x;
+        }
+        error = GPU_PROFILE_CALL("vg_lite_blit_rect",
+                                 vg_lite_blit_rect(target, &run->font->atlas, &cells, &span_matrix,
+                                                   VG_LITE_BLEND_SRC_OVER, color,
+                                                   VG_LITE_FILTER_POINT));
+        text_stats.blits++;
+    }
+
+    text_stats.glyphs += run->glyph_count;
+    text_stats.draw_cycles += gfx_port_cycles() - start;
+
+    return error;
+}
+
+/*******************************************************************************
+* Function Name: text_get_stats
+********************************************************************************
+* Summary:
+*  Returns the statistics of all text runs, optionally resetting them.
+*
+* Parameters:
+*  stats  - Output statistics
+*  reset  - true to clear the statistics after reading them
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void text_get_stats(text_stats_t *stats, bool reset)
+{
+    *stats = text_stats;
+
+    if (reset)
+    {
+        memset(&text_stats, 0, sizeof(text_stats));
+    }
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,140 @@
+/*******************************************************************************
+* File Name        : text_engine.h
+*
+* Description      : This file contains the declarations of the text engine. Fonts are
+*                    rasterized on the host by tools/host/font2vglite into an A8 glyph atlas
+*                    of fixed height cells. A text run is laid out once, when its string
+*                    changes, into spans of consecutive atlas cells, and each span is drawn
+*                    with one vg_lite_blit_rect() call.
+*
+* Related Document : See README.md
+*
+********************************************************************************
+* Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+
+#ifndef TEXT_ENGINE_H
+#define TEXT_ENGINE_H
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include <stdint.h>
+#include <stdbool.h>
+#include "vg_lite.h"
+#include "image_asset.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+
+/* Longest string of a text run, longer strings are truncated */
+#define TEXT_RUN_MAX_LENGTH                 (64U)
+
+/* Drawn for characters missing in the font */
+#define TEXT_REPLACEMENT_CHAR               ('?')
+
+/*******************************************************************************
+* Data Structures and Types
+*******************************************************************************/
+
+/* Atlas cell of one glyph: the advance wide, the line height high */
+typedef struct {
+    uint16_t x;
+    uint16_t y;
+    uint8_t advance;
+    bool ink;                   /* false for blank glyphs, never drawn */
+} font_glyph_t;
+
+/* Font prepared by tools/host/font2vglite */
+typedef struct {
+    const char *name;
+    const image_asset_t *atlas; /* VG_LITE_A8 glyph cells */
+    const font_glyph_t *glyphs;
+    uint8_t first_char;
+    uint8_t glyph_count;
+    uint8_t line_height;        /* Height of every cell */
+    uint8_t ascent;             /* Baseline below the top of a cell */
+} font_asset_t;
+
+typedef struct {
+    const font_asset_t *asset;
+    vg_lite_buffer_t atlas;
+} text_font_t;
+
+/* Consecutive glyphs whose cells are also consecutive in the atlas */
+typedef struct {
+    vg_lite_rectangle_t cells;
+    int32_t x;                  /* Pen position of the first glyph */
+} text_span_t;
+
+typedef struct {
+    text_font_t *font;
+    char text[TEXT_RUN_MAX_LENGTH + 1U];
+    text_span_t spans[TEXT_RUN_MAX_LENGTH];
+    uint8_t span_count;
+    uint8_t glyph_count;        /* Glyphs with ink */
+    int32_t width;
+    int32_t height;
+} text_run_t;
+
+typedef struct {
+    uint32_t layouts;           /* Runs laid out again */
+    uint32_t glyphs;            /* Glyphs drawn */
+    uint32_t blits;             /* vg_lite_blit_rect() calls */
+    uint32_t layout_cycles;     /* CPU cycles laying out runs */
+    uint32_t draw_cycles;       /* CPU cycles issuing the blits */
+} text_stats_t;
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+bool text_font_init(text_font_t *font, const font_asset_t *asset);
+const font_glyph_t *text_font_glyph(const text_font_t *font, char c);
+void text_run_init(text_run_t *run, text_font_t *font);
+bool text_run_set(text_run_t *run, const char *text);
+vg_lite_error_t text_run_draw(const text_run_t *run, vg_lite_buffer_t *target,
+                              const vg_lite_matrix_t *matrix, vg_lite_color_t color);
+void text_get_stats(text_stats_t *stats, bool reset);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* TEXT_ENGINE_H */
+
+/* [] END OF FILE */
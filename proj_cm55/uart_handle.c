@@ -41,6 +41,10 @@
 
 
 #include "vglite_demos.h"
+#include "frame_pacer.h"
+#include "gpu_profile.h"
+#include "frame_stats.h"
+#include "cpu_load.h"
 #include "retarget_io_init.h"
 
 /*******************************************************************************
@@ -53,12 +57,37 @@
 #define UART_KEY_ENTER_LF      (0x0A)   /* Line Feed */
 #define UART_KEY_MIN           ('1')    /* Lowest valid app number */
 #define UART_KEY_MAX           ('5')    /* Highest valid app number */
+#define UART_KEY_PACING        ('p')    /* Cycle the frame pacing target */
+#define UART_KEY_TESS_CAL      ('t')    /* Calibrate the tessellation window */
+#define UART_KEY_HEAP          ('m')    /* Print the VGLite heap use */
+#define UART_KEY_HEAP_DUMP     ('j')    /* Dump the VGLite heap blocks as JSON */
+#define UART_KEY_HUD           ('h')    /* Show or hide the performance HUD */
+#define UART_KEY_HUD_PERIOD    ('u')    /* Cycle the HUD update period */
+#define UART_KEY_PROFILE_DUMP  ('g')    /* Dump the GPU cost per call site */
+#define UART_KEY_PROFILE_RESET ('r')    /* Restart the GPU profile */
+#define UART_KEY_FRAME_STATS   ('f')    /* Print the frame times per demo */
+#define UART_KEY_FRAME_RESET   ('c')    /* Clear the frame time statistics */
+#define UART_KEY_CPU_LOAD      ('l')    /* Print the CPU load per task and interrupt */
+
+/* Time each demo runs during the tessellation calibration */
+#define TESS_CALIBRATION_DEMO_MS    (3000U)
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+
+/* Update periods of the HUD selected with UART_KEY_HUD_PERIOD */
+static const uint32_t hud_periods_ms[] = { 250U, 500U, 1000U, 2000U, 5000U };
 
 /*******************************************************************************
 * Extern Variables 
 *******************************************************************************/
 extern QueueHandle_t event_queque;
 extern bool cancel_requested;
+extern volatile bool frame_details_requested;
+extern frame_pacer_t frame_pacer;
+extern frame_stats_t frame_stats;
+extern cpu_load_t cpu_load;
 
 /*******************************************************************************
  *  Function Name: benchmarking_case
@@ -115,6 +144,43 @@ void benchmarking_case(int case_number)
 }
 
 
+/*******************************************************************************
+ *  Function Name: tess_calibration
+ * *****************************************************************************
+ * Summary:
+ *  -Runs every demo for TESS_CALIBRATION_DEMO_MS while the tessellation probe
+ *   evaluates the candidate window heights, then prints the recommendation.
+ * 
+ * Parameters:
+ *  None
+ * 
+ * Return:
+ *  None
+ * ****************************************************************************/
+static void tess_calibration(void)
+{
+    event_t event = { EVENT_DEFAULT, 0U };
+
+    printf("Tessellation calibration: %u ms per demo\r\n",
+           (unsigned int)TESS_CALIBRATION_DEMO_MS);
+    tess_probe_start_calibration(&tess_probe);
+
+    /* The default demo runs while no other one is selected */
+    vTaskDelay(pdMS_TO_TICKS(TESS_CALIBRATION_DEMO_MS));
+    for (uint8_t demo = EVENT_FILL_RULES; demo < EVENT_MAX; demo++)
+    {
+        event.b_event = (event_type_t)demo;
+        cancel_requested = false;
+        xQueueSend(event_queque, &event, 0);
+        vTaskDelay(pdMS_TO_TICKS(TESS_CALIBRATION_DEMO_MS));
+        cancel_requested = true;
+    }
+
+    tess_probe_stop_calibration(&tess_probe);
+    tess_probe_report(&tess_probe);
+}
+
+
 /*******************************************************************************
 * Function Name: uart_cli_handler
 ********************************************************************************
@@ -149,6 +215,18 @@ void uart_cli_handler(void *pv_parameters)
         printf("3. Blit Color Rendering \n\r");
         printf("4. Pattern Fill \n\r");
         printf("5. UI/Filter Demo \n\r\r\n");
+        printf("Press 'p' to change the frame pacing target (now: %s)\r\n",
+               frame_pacer_target_name(frame_pacer.target));
+        printf("Press 't' to calibrate the tessellation buffer size\r\n");
+        printf("Press 'm' for the VGLite heap use, 'j' for a JSON dump of it\r\n");
+        printf("Press 'h' to show or hide the performance HUD (now: %s), "
+               "'u' to change its update period (now: %u ms)\r\n",
+               perf_hud.enabled ? "on" : "off", (unsigned int)perf_hud.period_ms);
+        printf("Press 'f' for the frame times per demo and the statistics of the next "
+               "FPS line, 'c' to clear them\r\n");
+        printf("Press 'l' for the CPU load per task and interrupt\r\n");
+        printf("Press 'g' to dump the GPU profile, 'r' to restart it%s\r\n\n",
+               GPU_PROFILE_ENABLED ? "" : " (compiled out)");
 
         bool waiting_for_enter = false;
 
@@ -172,6 +250,76 @@ void uart_cli_handler(void *pv_parameters)
                     waiting_for_enter = false;  /* allow new number input after Enter */
                     break;
                 }
+                else if (uart_read_choice == UART_KEY_PACING)
+                {
+                    frame_pacer_set_target(&frame_pacer,
+                        (frame_pacer_target_t)((frame_pacer.target + 1U) % FRAME_PACER_TARGET_MAX));
+                    printf("\r\nFrame pacing target: %s\r\n",
+                           frame_pacer_target_name(frame_pacer.target));
+                }
+                else if (uart_read_choice == UART_KEY_HEAP)
+                {
+                    gpu_heap_report(&gpu_heap);
+                }
+                else if (uart_read_choice == UART_KEY_HEAP_DUMP)
+                {
+                    gpu_heap_dump(&gpu_heap);
+                }
+                else if (uart_read_choice == UART_KEY_HUD)
+                {
+                    perf_hud_set_enabled(&perf_hud, !perf_hud.enabled);
+                    printf("\r\nPerformance HUD: %s\r\n", perf_hud.enabled ? "on" : "off");
+                }
+                else if (uart_read_choice == UART_KEY_HUD_PERIOD)
+                {
+                    uint8_t next = 0U;
+
+                    /* The period after the current one, the first after the last */
+                    for (uint8_t i = 0; i < (sizeof(hud_periods_ms) / sizeof(hud_periods_ms[0])); i++)
+                    {
+                        if (hud_periods_ms[i] > perf_hud.period_ms)
+                        {
+                            next = i;
+                            break;
+                        }
+                    }
+                    perf_hud_set_period(&perf_hud, hud_periods_ms[next]);
+                    printf("\r\nHUD update period: %u ms\r\n", (unsigned int)perf_hud.period_ms);
+                }
+                else if (uart_read_choice == UART_KEY_FRAME_STATS)
+                {
+                    const char *names[EVENT_MAX];
+
+                    for (uint8_t i = 0; i < (uint8_t)EVENT_MAX; i++)
+                    {
+                        names[i] = get_demo_name((event_type_t)i);
+                    }
+                    frame_stats_print(&frame_stats, names, (uint8_t)EVENT_MAX);
+                    /* Printed by the render task, which owns the statistics */
+                    frame_details_requested = true;
+                }
+                else if (uart_read_choice == UART_KEY_FRAME_RESET)
+                {
+                    frame_stats_reset(&frame_stats);
+                    printf("\r\nFrame time statistics cleared\r\n");
+                }
+                else if (uart_read_choice == UART_KEY_CPU_LOAD)
+                {
+                    cpu_load_print(&cpu_load);
+                }
+                else if (uart_read_choice == UART_KEY_PROFILE_DUMP)
+                {
+                    gpu_profile_dump();
+                }
+                else if (uart_read_choice == UART_KEY_PROFILE_RESET)
+                {
+                    gpu_profile_reset();
+                    printf("\r\nGPU profile restarted\r\n");
+                }
+                else if (!waiting_for_enter && (uart_read_choice == UART_KEY_TESS_CAL))
+                {
+                    tess_calibration();
+                }
                 else if (!waiting_for_enter && uart_read_choice >= UART_KEY_MIN && uart_read_choice <= UART_KEY_MAX) 
                 {
                     uint8_t app_number = uart_read_choice - UART_KEY_MIN;
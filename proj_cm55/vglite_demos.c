@@ -45,14 +45,24 @@
 #include "vg_lite_platform.h"
 #include "cyabs_rtos.h"
 #include "cyabs_rtos_impl.h"
-#include "icon/facial_rec.h"
-#include "icon/game_control.h"
-#include "icon/vision.h"
-#include "icon/wearable.h"
+#include "image_assets.h"
 #include "infineon_logo_paths.h"
-#include "infineon_logo.h"
 #include "shape_paths.h"
 #include "retarget_io_init.h"
+#include "damage_tracker.h"
+#include "scene_fingerprint.h"
+#include "scene_graph.h"
+#include "cmd_list.h"
+#include "path_cache.h"
+#include "path_narrow.h"
+#include "path_bounds.h"
+#include "tess_probe.h"
+#include "quality_policy.h"
+#include "image_asset.h"
+#include "text_engine.h"
+#include "mono16_font.h"
+#include "perf_hud.h"
+#include "gpu_profile.h"
 
 /*******************************************************************************
 * Macros
@@ -63,6 +73,7 @@
 #define SCREEN_HALF_HEIGHT                  ( SCREEN_HEIGHT/2 )
 #define ICON_COUNT                          ( 4 )
 #define ICON_SIZE                           ( 176 )
+#define BYTES_PER_ARGB8888_PIXEL            ( 4U )
 #define GRID_COLS                           ( 2 )
 #define GRID_ROWS                           ( 2 )
 #define GRID_0_X_OFFSET                     ( 0 )
@@ -74,6 +85,7 @@
 #define SCALING_LIMIT                       ( 5 )
 #define ROTATION_DEG                        ( 5.0f )
 #define BYTE_ALIGNMENT_MASK_64              ( 0x3FU )
+#define BYTES_PER_KB                        ( 1024U )
 #define X_OFFSET_0                          ( 0 )
 #define Y_OFFSET_0                          ( 0 )
 #define ZOOM_SCALE_0_25                     ( 0.25f )
@@ -90,6 +102,35 @@
 #define MAIN_MATRIX_Y_OFFSET                ( 80 )
 #define TRIANGLE_Y_ADJUSTMENT_BOX           ( 120 )
 #define TRIANGLE_Y_ADJUSTMENT_MAIN_MATRIX   ( 60 )
+#define QUADRANT_COUNT                      ( GRID_COLS * GRID_ROWS )
+#define HIGHLIGHT_COLOR                     ( 0xFFE5AF71U )
+#define ALPHA_BEHAVIOR_CLEAR_COLOR          ( 0x80808080U )
+/* Caption of every demo, top left */
+#define CAPTION_X_POS                       ( 8 )
+#define CAPTION_Y_POS                       ( 8 )
+#define CAPTION_COLOR                       ( 0xFF000000U )
+
+/* Antialiasing of moving draws: 4x, 8x for small shapes, within a budget of
+ * four coverage samples per screen pixel and frame */
+#define QUALITY_MOVING_BUDGET               ( SCREEN_WIDTH * SCREEN_HEIGHT * 4U )
+#define QUALITY_SMALL_AREA                  ( 64U * 64U )
+
+
+/*******************************************************************************
+* Data Structures and Types
+*******************************************************************************/
+
+/* Retained description of one demo */
+typedef struct {
+    event_type_t id;
+    const char *name;           /* Demo name in the GPU profile */
+    scene_graph_t graph;
+    vg_lite_color_t clear_color;
+    bool track_damage;          /* Redraw only the damaged rectangles */
+    uint8_t exit_id;            /* Cleanup sequence covering the demo paths */
+    scene_node_t caption;       /* Text node drawn over the scene */
+    text_run_t caption_run;
+} demo_scene_t;
 
 
 /*******************************************************************************
@@ -104,8 +145,75 @@ uint32_t color_data[] =
     0xffb36600, /* path_data1 : red */   
 };
 vg_lite_buffer_t image_buffer;
+damage_tracker_t damage_tracker;
+scene_fingerprint_t scene_fingerprint;
+path_cache_t path_cache;
+path_bounds_t path_bounds;
+tess_probe_t tess_probe;
+quality_policy_t quality_policy;
+gpu_heap_t gpu_heap;
+perf_hud_t perf_hud;
 
 static vg_lite_buffer_t        icons[ICON_COUNT];
+static text_font_t             caption_font;
+
+/* Prepared by tools/host/img2vglite from images/assets/assets.txt */
+static const image_asset_t *const icon_assets[ICON_COUNT] = {
+    &facial_rec_asset,
+    &game_control_asset,
+    &vision_asset,
+    &wearable_asset
+};
+
+/* Caption of the UI filter demo for each highlighted icon */
+static const char *const icon_captions[ICON_COUNT] = {
+    "UI filter: Facial recognition",
+    "UI filter: Game control",
+    "UI filter: Vision",
+    "UI filter: Wearable"
+};
+
+/* Scene descriptions of the demos, built once by build_demo_scenes() */
+static demo_scene_t default_scene;
+static scene_node_t default_root;
+static scene_node_t logo_group;
+static scene_node_t logo_nodes[PATH_COUNT];
+
+static demo_scene_t fill_rules_scene;
+static scene_node_t fill_rules_root;
+static scene_node_t fill_rules_nodes[QUADRANT_COUNT];
+
+static demo_scene_t alpha_behavior_scene;
+static scene_node_t alpha_behavior_root;
+static scene_node_t alpha_behavior_layers[QUADRANT_COUNT];
+static scene_node_t alpha_behavior_nodes[QUADRANT_COUNT];
+
+static demo_scene_t blit_color_scene;
+static scene_node_t blit_color_root;
+static scene_node_t blit_color_layer;
+static scene_node_t blit_color_logo_group;
+static scene_node_t blit_color_logo_nodes[PATH_COUNT];
+static scene_node_t blit_color_copies[GRID_COLS];
+static vg_lite_rectangle_t blit_color_logo_rect = { LOGO_START_X_POS, LOGO_START_Y_POS,
+                                                    LOGO_WIDTH, LOGO_HEIGHT };
+
+static demo_scene_t pattern_fill_scene;
+static scene_node_t pattern_fill_root;
+static scene_node_t pattern_fill_nodes[QUADRANT_COUNT];
+
+static demo_scene_t filter_scene;
+static scene_node_t filter_root;
+static scene_node_t highlight_node;
+static scene_node_t icon_nodes[ICON_COUNT];
+
+/* Paths uploaded to the VGLite heap when the assets load, in priority order */
+static vg_lite_path_t* const cached_paths[] = {
+    &path[0], &path[1],
+    &polygon_path, &overlapping_squares_path,
+    &self_intersecting_star_path, &concentric_circles_path,
+    &square_path, &pentagon_path, &triangle_path, &hexagon_path,
+    &highlight_path
+};
 
 /* Lookup table for cleanup sequences */
 static vg_lite_path_t* const cleanup_table[EVENT_MAX][EXIT_MAX][4] = {
@@ -165,7 +273,10 @@ static vg_lite_path_t* const cleanup_table[EVENT_MAX][EXIT_MAX][4] = {
 * Function Name: setup_vglite_image_buffer
 ********************************************************************************
 * Summary:
-*  -Sets up a vg_lite_buffer_t with image data and properties.
+*  -Sets up a vg_lite_buffer_t with image data and properties. Any format
+*   the GPU reads is accepted: indexed images need the color lookup table
+*   loaded with image_asset_load_clut(), alpha images are drawn in the blit
+*   color.
 *
 * Parameters:
 *  buffer      - Pointer to vg_lite_buffer_t to initialize
@@ -190,6 +301,13 @@ bool setup_vglite_image_buffer(vg_lite_buffer_t *buffer, uint8_t *imm_array,
         printf("Image is not aligned at 64 bytes \r\n");
         result = false;
     }
+    else if ((0U == image_asset_bits_per_pixel(format)) ||
+             (stride < image_asset_min_stride(format, width)))
+    {
+        printf("Image stride %d too small for %d %s pixels\r\n", (int)stride, (int)width,
+               image_asset_format_name(format));
+        result = false;
+    }
     else
     {
         /* Get width, height, stride and format info */
@@ -197,6 +315,9 @@ bool setup_vglite_image_buffer(vg_lite_buffer_t *buffer, uint8_t *imm_array,
         buffer->height = height;
         buffer->stride = stride;
         buffer->format = format;
+        /* Alpha only images are multiplied by the blit color */
+        buffer->image_mode = image_asset_is_alpha(format) ? VG_LITE_MULTIPLY_IMAGE_MODE :
+                                                           VG_LITE_NORMAL_IMAGE_MODE;
 
         /* Assign image data into the buffer */
         buffer->handle  = NULL;
@@ -208,74 +329,51 @@ bool setup_vglite_image_buffer(vg_lite_buffer_t *buffer, uint8_t *imm_array,
 }
 
 /*******************************************************************************
-* Function Name: load_images
+* Function Name: prepare_path_draw
 ********************************************************************************
 * Summary:
-*  -Loads icon images into the icons buffer array.
+*  -Command hook culling draws outside the render target or the scissor,
+*   recording the tessellation work of the others and keeping their path
+*   uploaded.
 *
 * Parameters:
-*  void
+*  draw_path     - Path about to be drawn
+*  draw_matrix   - Draw matrix
+*  target        - Render target
+*  user_data     - Unused
 *
 * Return:
-*  bool         - 0 on success, -1 on error
+*  bool          - false to skip the draw
 *
 *******************************************************************************/
-bool load_images(void)
+static bool prepare_path_draw(vg_lite_path_t *draw_path, const vg_lite_matrix_t *draw_matrix,
+                              vg_lite_buffer_t *target, void *user_data)
 {
-    bool result = true;
+    damage_rect_t area;
 
-    /* Load the icons */
-    if (setup_vglite_image_buffer(&icons[0], (uint8_t *)&Facial_Rec_map[0],
-                                  FACIAL_WIDTH, FACIAL_HEIGHT, FACIAL_STRIDE,
-                                  VG_LITE_ARGB8888) == false)
-    {
-        printf("Load img1 file error \r\n");
-        result = false;
-    }
-    else if (setup_vglite_image_buffer(&icons[1], (uint8_t *)&Game_control_map[0],
-                                       GAME_WIDTH, GAME_HEIGHT, GAME_STRIDE,
-                                       VG_LITE_ARGB8888) == false)
-    {
-        printf("Load img2 file error \r\n");
-        result = false;
-    }
-    else if (setup_vglite_image_buffer(&icons[2], (uint8_t *)&vision_map[0],
-                                       VISION_WIDTH, VISION_HEIGHT, VISION_STRIDE,
-                                       VG_LITE_ARGB8888) == false)
-    {
-        printf("Load img3 file error \r\n");
-        result = false;
-    }
-    else if (setup_vglite_image_buffer(&icons[3], (uint8_t *)&wearable_map[0],
-                                       WEARABLE_WIDTH, WEARABLE_HEIGHT, WEARABLE_STRIDE,
-                                       VG_LITE_ARGB8888) == false)
-    {
-        printf("Load img4 file error \r\n");
-        result = false;
-    }
-    else if (setup_vglite_image_buffer(&image_buffer, (uint8_t *)&infineon_logo_img,
-                                       IMG_WIDTH, IMG_HEIGHT, IMG_STRIDE, IMG_FORMAT) == false)
-    {
-        printf("Could not load image\r\n");
-        result = false;
-    }
-    else
+    (void)user_data;
+
+    if (!path_bounds_visible(&path_bounds, draw_path, draw_matrix, target, &area))
     {
-        /* All images loaded successfully */
-        result = true;
+        return false;
     }
+    tess_probe_record(&tess_probe, &area);
+    path_cache_use(&path_cache, draw_path);
 
-    return result;
+    return true;
 }
 
-
 /*******************************************************************************
-* Function Name: FillRules_draw
+* Function Name: load_paths
 ********************************************************************************
 * Summary:
-*  -This function draws the image using GPU and refreshes the frame buffer.
-*  -It uses the VG_LITE_FILL_NON_ZERO fill rule to render the Infineon logo.
-*     
+*  -Fits the bounding boxes of the demo paths to their control points and
+*   rewrites them in the narrowest coordinate format their values fit in,
+*   then uploads them to the VGLite heap. Draws then reference the
+*   uploaded data instead of copying it into the command buffer. Paths that do
+*   not fit in the budget are uploaded on first use, evicting the least
+*   recently used ones.
+*
 * Parameters:
 *  void
 *
@@ -283,235 +381,138 @@ bool load_images(void)
 *  void
 *
 *******************************************************************************/
-void fill_rules_draw(void)
+static void load_paths(void)
 {
-    uint8_t exit_id = EXIT_0;
-    vg_lite_error_t error = VG_LITE_SUCCESS;
-    vg_lite_matrix_t fill_matrix;
-
-    do
-    {
-        vg_lite_identity(&fill_matrix);
-        vg_lite_translate(X_OFFSET_0, Y_OFFSET_0, &fill_matrix);
-        
-        /* Draw the path using the matrix. */
-        error = vg_lite_clear(render_target, NULL, WHITE_COLOR);
-        if (error)
-        {
-            printf("Clear failed: vg_lite_clear() returned error %d\r\n", error);
-            break;
-        }
+    uint32_t bytes_before = 0U;
+    uint32_t bytes_after = 0U;
+    float area_before = 0.0f;
+    float area_after = 0.0f;
+    vg_lite_float_t *box;
 
-        exit_id = EXIT_1;
-        /* Draw polygon path (top-left) */
-        vg_lite_identity(&matrix);
-        vg_lite_translate(X_OFFSET_0, Y_OFFSET_0, &matrix);
-        error = vg_lite_draw(render_target, &polygon_path, VG_LITE_FILL_EVEN_ODD,
-            &matrix, VG_LITE_BLEND_NONE, TEAL_COLOR);
-        if (error) 
-        {
-            printf("vg_lite_draw() returned error %d\r\n", error);
-            break;
-        }
-
-        /* Draw self-intersecting star path (top-right) */
-        vg_lite_identity(&matrix);
-        vg_lite_translate(SCREEN_HALF_WIDTH, Y_OFFSET_0, &matrix);
-        error = vg_lite_draw( render_target, &polygon_path, VG_LITE_FILL_NON_ZERO,
-                            &matrix, VG_LITE_BLEND_NONE, TEAL_COLOR );
-        if (error) 
-        {
-            printf("vg_lite_draw() returned error %d\r\n", error);
-            break;
-        }
+    path_cache_init(&path_cache, PATH_CACHE_BUDGET_BYTES);
+    path_cache_set_heap(&path_cache, &gpu_heap);
+    path_bounds_init(&path_bounds);
 
-        exit_id = EXIT_2;
-        /* Draw overlapping squares path (bottom-left) */
-        vg_lite_identity(&matrix);
-        vg_lite_translate(X_OFFSET_0, SCREEN_HALF_HEIGHT, &matrix);
-        error = vg_lite_draw(render_target, &overlapping_squares_path, VG_LITE_FILL_EVEN_ODD,
-            &matrix, VG_LITE_BLEND_NONE, TEAL_COLOR);
-        if (error) 
+    for (uint8_t i = 0; i < (sizeof(cached_paths) / sizeof(cached_paths[0])); i++)
+    {
+        box = cached_paths[i]->bounding_box;
+        area_before += (box[2] - box[0]) * (box[3] - box[1]);
+        if (!path_bounds_fit(&path_bounds, cached_paths[i]))
         {
-            printf("vg_lite_draw() returned error %d\r\n", error);
-            break;
+            printf("Path %u: bounds not computed\r\n", (unsigned int)i);
         }
+        area_after += (box[2] - box[0]) * (box[3] - box[1]);
 
-        /* Draw concentric circles path (bottom-right) */
-        vg_lite_identity(&matrix);
-        vg_lite_translate(SCREEN_HALF_WIDTH, SCREEN_HALF_HEIGHT, &matrix);
-        error = vg_lite_draw( render_target, &overlapping_squares_path, VG_LITE_FILL_NON_ZERO,
-                            &matrix, VG_LITE_BLEND_NONE, TEAL_COLOR );
-        if (error) 
-        {
-            printf("vg_lite_draw() returned error %d\r\n", error);
-            break;
-        }
+        bytes_before += cached_paths[i]->path_length;
+        (void)path_narrow(cached_paths[i]);
+        bytes_after += cached_paths[i]->path_length;
 
-        /* Flush command buffer and wait for GPU to complete. */
-        error = vg_lite_finish();
-        if (error)
+        if (!path_cache_register(&path_cache, cached_paths[i]))
         {
-            printf("GPU operation failed: vg_lite_finish() returned error %d\r\n", error);
-            break;
+            printf("Path %u not uploaded, %u of %u bytes in use\r\n", (unsigned int)i,
+                   (unsigned int)path_cache.used, (unsigned int)path_cache.budget);
         }
-        swap_frame_buffer();
+    }
 
-    }while(false);
+    printf("Path data: %u bytes, %u bytes before narrowing\r\n",
+           (unsigned int)bytes_after, (unsigned int)bytes_before);
+    printf("Path bounds: %u%% of the declared area\r\n",
+           (unsigned int)((area_before > 0.0f) ? ((area_after * 100.0f) / area_before) : 0.0f));
 
-    if (error)
-    {
-        cleanup(EVENT_FILL_RULES,exit_id);
-    }
-    
+    cmd_set_path_hook(prepare_path_draw, NULL);
 }
 
 /*******************************************************************************
-* Function Name: AlphaBehavior_draw
+* Function Name: load_images
 ********************************************************************************
 * Summary:
-*  -This function draws the image using GPU and refreshes the frame buffer.
-*  -It uses the VG_LITE_FILL_EVEN_ODD fill rule and VG_LITE_BLEND_SRC_OVER
+*  -Loads icon images into the icons buffer array. The images are stored in
+*   the format chosen in images/assets/assets.txt, with aligned rows, the GPU
+*   reads them directly. The glyph atlas of the captions is read the same way.
 *
 * Parameters:
 *  void
 *
 * Return:
-*  void
+*  bool         - 0 on success, -1 on error
 *
 *******************************************************************************/
-void alpha_behavior_draw(void)
+bool load_images(void)
 {
-    uint8_t exit_id = EXIT_0;
-    vg_lite_error_t error = VG_LITE_SUCCESS;
-    vg_lite_matrix_t draw_matrix;
+    bool result = true;
+    uint32_t packed_bytes = 0U;
+    uint32_t argb_bytes = 0U;
+    const uint32_t *clut = NULL;
 
-    do
+    /* Load the icons */
+    for (uint8_t i = 0; (i < ICON_COUNT) && result; i++)
     {
-        vg_lite_identity(&draw_matrix);
-        vg_lite_translate(X_OFFSET_0, Y_OFFSET_0, &draw_matrix);
-        
-        /* Draw the path using the matrix. */
-        error = vg_lite_clear(render_target, NULL, 0x80808080 );
-        if (error)
-        {
-            printf("Clear failed: vg_lite_clear() returned error %d\r\n", error);
-            break;
-        }
-
-        exit_id = EXIT_1;
-        /* Draw polygon path (top-left) */
-        vg_lite_identity(&matrix);
-        vg_lite_translate(X_OFFSET_0, Y_OFFSET_0, &matrix);
-        error = vg_lite_draw(&intermediate_buffer, &self_intersecting_star_path, 
-                             VG_LITE_FILL_EVEN_ODD,
-                             &draw_matrix, VG_LITE_BLEND_NONE, TEAL_COLOR );
-        if (error) 
-        {
-            printf("vg_lite_draw() returned error %d\r\n", error);
-            break;
-        }
-
-        error = vg_lite_blit(render_target, &intermediate_buffer, &matrix,
-                             VG_LITE_BLEND_SRC_OVER, 0, 
-                             VG_LITE_FILTER_POINT );
-        if (error) 
-        {
-            printf("vg_lite_blit() returned error %d\r\n", error);
-            break;
-        }
-
-        vg_lite_clear(&intermediate_buffer, NULL, WHITE_COLOR);
-
-        /* Draw self-intersecting star path (top-right) */
-        vg_lite_identity(&matrix);
-        vg_lite_translate(SCREEN_HALF_WIDTH, Y_OFFSET_0, &matrix);
-        error = vg_lite_draw(&intermediate_buffer, &self_intersecting_star_path, 
-                             VG_LITE_FILL_EVEN_ODD,
-                             &draw_matrix, VG_LITE_BLEND_NONE, TEAL_COLOR);
-        if (error) 
-        {
-            printf("vg_lite_draw() returned error %d\r\n", error);
-            break;
-        }
-
-        error = vg_lite_blit(render_target, &intermediate_buffer, &matrix,
-                             VG_LITE_BLEND_MULTIPLY, 0,
-                             VG_LITE_FILTER_POINT);
-        if (error) 
-        {
-            printf("vg_lite_blit() returned error %d\r\n", error);
-            break;
-        }
-
-        exit_id = EXIT_2;
-        vg_lite_clear(&intermediate_buffer, NULL, WHITE_COLOR);
-        /* Draw overlapping squares path (bottom-left) */
-        vg_lite_identity(&matrix);
-        vg_lite_translate(X_OFFSET_0, SCREEN_HALF_HEIGHT, &matrix);
-        error = vg_lite_draw(&intermediate_buffer, &concentric_circles_path,
-                             VG_LITE_FILL_EVEN_ODD,
-                             &draw_matrix, VG_LITE_BLEND_NONE, TEAL_COLOR);
-        if (error) 
-        {
-            printf("vg_lite_draw() returned error %d\r\n", error);
-            break;
-        }
+        const image_asset_t *asset = icon_assets[i];
 
-        error = vg_lite_blit(render_target, &intermediate_buffer, &matrix,
-                             VG_LITE_BLEND_SRC_OVER, 0, 
-                             VG_LITE_FILTER_POINT);
-        if (error) 
-        {
-            printf("vg_lite_blit() returned error %d\r\n", error);
-            break;
-        }
-        vg_lite_clear(&intermediate_buffer, NULL, WHITE_COLOR);
-
-        /* Draw concentric circles path (bottom-right) */
-        vg_lite_identity(&matrix);
-        vg_lite_translate(SCREEN_HALF_WIDTH, SCREEN_HALF_HEIGHT, &matrix);
-        error = vg_lite_draw(&intermediate_buffer, &concentric_circles_path,
-                             VG_LITE_FILL_EVEN_ODD,
-                             &draw_matrix, VG_LITE_BLEND_NONE, TEAL_COLOR);
-        if (error) 
+        /* One table per index size, loaded once for all icons sharing it */
+        if ((asset->clut != clut) && !image_asset_load_clut(asset))
         {
-            printf("vg_lite_draw() returned error %d\r\n", error);
-            break;
+            result = false;
         }
-
-        error = vg_lite_blit(render_target, &intermediate_buffer, &matrix,
-                             VG_LITE_BLEND_MULTIPLY, 0,
-                             VG_LITE_FILTER_POINT);
-        if (error) 
+        else if (setup_vglite_image_buffer(&icons[i], asset->data, asset->width,
+                                           asset->height, asset->stride,
+                                           asset->format) == false)
         {
-            printf("vg_lite_blit() returned error %d\r\n", error);
-            break;
+            printf("Load img%u file error \r\n", (unsigned int)(i + 1U));
+            result = false;
         }
-        vg_lite_clear(&intermediate_buffer, NULL, WHITE_COLOR);
-        /* Flush command buffer and wait for GPU to complete. */
-        error = vg_lite_finish();
-        if (error)
+        else
         {
-            printf("GPU operation failed: vg_lite_finish() returned error %d\r\n", error);
-            break;
+            if (asset->clut != clut)
+            {
+                packed_bytes += asset->clut_count * sizeof(uint32_t);
+            }
+            clut = asset->clut;
+            packed_bytes += image_asset_bytes(asset);
+            argb_bytes += (uint32_t)asset->width * (uint32_t)asset->height *
+                          BYTES_PER_ARGB8888_PIXEL;
         }
+    }
 
-        swap_frame_buffer();
-    }while(false);
-
-    if (error)
+    if (!result)
+    {
+        /* Error already reported */
+    }
+    else if (text_font_init(&caption_font, &mono16_font) == false)
+    {
+        /* Error already reported */
+        result = false;
+    }
+    else if (setup_vglite_image_buffer(&image_buffer, infineon_logo_asset.data,
+                                       infineon_logo_asset.width, infineon_logo_asset.height,
+                                       infineon_logo_asset.stride,
+                                       infineon_logo_asset.format) == false)
+    {
+        printf("Could not load image\r\n");
+        result = false;
+    }
+    else
     {
-        cleanup(EVENT_ALPHA_BEHAVIOR,exit_id);
+        /* All images loaded successfully */
+        result = true;
+        printf("Icons: %u KB as %s, %u KB as ARGB8888\r\n",
+               (unsigned int)(packed_bytes / BYTES_PER_KB),
+               image_asset_format_name(icon_assets[0]->format),
+               (unsigned int)(argb_bytes / BYTES_PER_KB));
+        load_paths();
     }
+
+    return result;
 }
 
+
 /*******************************************************************************
-* Function Name: BlitColor_draw
+* Function Name: reset_frame_history
 ********************************************************************************
 * Summary:
-*  -This function draws the image using GPU and refreshes the frame buffer.
-*  -It uses the VG_LITE_FILL_EVEN_ODD fill rule and VG_LITE_BLEND_SRC_OVER
+*  -Resets the damage tracker and the scene fingerprint so that the next frame
+*   is rendered and every frame buffer is repainted in full. To be called
+*   whenever the active demo changes.
 *
 * Parameters:
 *  void
@@ -520,331 +521,775 @@ void alpha_behavior_draw(void)
 *  void
 *
 *******************************************************************************/
-void blit_color_draw(void)
+void reset_frame_history(void)
 {
-    uint8_t exit_id = EXIT_0;
-    uint8_t count;
-    vg_lite_error_t error = VG_LITE_SUCCESS;
-
-    do
-    {
-        error = vg_lite_clear(render_target, NULL, TEAL_COLOR);
-        if (error) 
-        {
-            printf("Clear failed: vg_lite_clear() returned error %d\r\n", error);
-            break;
-        }
-
-        error = vg_lite_clear(&intermediate_buffer, NULL, WHITE_COLOR);
-        if (error) 
-        {
-            printf("Clear failed: vg_lite_clear() returned error %d\r\n", error);
-            break;
-        }
-
-        vg_lite_identity(&matrix);
-        float scale = ZOOM_SCALE_0_25;
-        vg_lite_scale(scale, scale, &matrix);
-        vg_lite_translate(X_OFFSET_0, Y_OFFSET_0, &matrix);
-
-        for (count = 0; count < PATH_COUNT; count++) 
-        {
-            exit_id++;
-            error = vg_lite_draw(&intermediate_buffer, &path[count], 
-                                 VG_LITE_FILL_EVEN_ODD,
-                                 &matrix, VG_LITE_BLEND_NONE, color_data[count]);
-            if (error) 
-            {
-                printf("vg_lite_draw() returned error %d\r\n", error);
-                break;
-            }
-        }
-        
-        if (error)
-        {
-            break;
-        }
-
-        vg_lite_int32_t logo_x = LOGO_START_X_POS;  
-        vg_lite_int32_t logo_y = LOGO_START_Y_POS;
-        vg_lite_int32_t logo_width = LOGO_WIDTH;
-        vg_lite_int32_t logo_height = LOGO_HEIGHT;
-        
-        vg_lite_rectangle_t logo_rect = { logo_x, logo_y, logo_width, logo_height };
-
-        int center_x_off_dest = ((SCREEN_HALF_WIDTH) - logo_width) / 2;
-        int center_y_off_dest = ((SCREEN_HEIGHT) - logo_height) / 2;
-        int x_offsets_dest[GRID_COLS] = {center_x_off_dest, (SCREEN_HALF_WIDTH)+center_x_off_dest};
-        int y_offsets_dest[GRID_COLS] = {center_y_off_dest, center_y_off_dest};
-
-        for (int i = 0; i < GRID_COLS; i++) 
-        {
-            vg_lite_identity(&matrix);
-            vg_lite_translate(x_offsets_dest[i], y_offsets_dest[i], &matrix);
-
-            error = vg_lite_blit_rect( render_target, &intermediate_buffer, &logo_rect, &matrix, 
-                                        VG_LITE_BLEND_SRC_OVER, 0, VG_LITE_FILTER_POINT );
-            if (error) 
-            {
-                printf("Blit failed: vg_lite_blit_rect() returned error__ %d\r\n", error);
-                break;
-            }
-        }
-
-        if (error)
-        {
-            break;
-        }
-        
-        error = vg_lite_finish();
-        if (error) 
-        {
-            printf("GPU operation failed: vg_lite_finish() returned error %d\r\n", error);
-            break;
-        }
-
-        swap_frame_buffer();
-    
-    }while(false);    
-
-    if (error)
-    {
-        cleanup(EVENT_BLIT_COLOR,exit_id);
-    }
+    damage_tracker_reset(&damage_tracker, SCREEN_WIDTH, SCREEN_HEIGHT);
+    scene_fingerprint_reset(&scene_fingerprint);
 }
 
-
 /*******************************************************************************
-* Function Name: filter_draw
+* Function Name: skip_unchanged_frame
 ********************************************************************************
 * Summary:
-*  -This function draws the image using GPU and refreshes the frame buffer.
-*  -It uses the VG_LITE_FILL_EVEN_ODD fill rule and VG_LITE_BLEND_SRC_OVER
+*  -Checks the fingerprint of the frame being built against the last submitted
+*   frame. An unchanged frame is skipped: no commands are encoded, nothing is
+*   submitted to the GPU and the buffer on scanout stays on screen.
 *
 * Parameters:
 *  void
 *
 * Return:
-*  void
+*  bool          - true if the frame was skipped
 *
 *******************************************************************************/
-void filter_draw(void)
+static bool skip_unchanged_frame(void)
 {
-    uint8_t exit_id = EXIT_0;
-    uint8_t count;
-    vg_lite_matrix_t highlight_matrix;
-    int icon_size = 176;
-    vg_lite_error_t error = VG_LITE_SUCCESS;
-
-    do
-    {
-        vg_lite_identity(&matrix);
-        vg_lite_translate(X_OFFSET_0, Y_OFFSET_0, &matrix);
-        vg_lite_scale(ZOOM_SCALE_0_25, ZOOM_SCALE_0_25, &matrix);
-
-        /* Draw the path using the matrix. */
-        error = vg_lite_clear(render_target, NULL, WHITE_COLOR);
-        if (error)
-        {
-            printf("Clear failed: vg_lite_clear() returned error %d\r\n", error);
-            break;
-        }
-
-        int cell_width = SCREEN_WIDTH / GRID_COLS;
-        int cell_height = SCREEN_HEIGHT / GRID_ROWS;
-
-        vg_lite_identity(&highlight_matrix);
-        uint8_t highlight_row = GRID_0_X_OFFSET;
-        uint8_t highlight_col = GRID_0_Y_OFFSET;
-
-        /* Calculate which icon to highlight based on time */
-        uint32_t current_time = get_time_ms();
-        uint32_t highlight_period = 5000; // 5 seconds
-        uint8_t current_icon = (current_time / highlight_period) % ICON_COUNT;
-
-        /* Compute row and column of highlighted icon */
-        highlight_row = current_icon / GRID_COLS;
-        highlight_col = current_icon % GRID_COLS;
-
-        /* Center icon in its grid cell */
-        int icon_x = highlight_col * cell_width + (cell_width - ICON_SIZE) / 2;
-        int icon_y = highlight_row * cell_height + (cell_height - ICON_SIZE) / 2;
-
-        vg_lite_translate(icon_x, icon_y, &highlight_matrix);
-        vg_lite_scale(icon_size / (float)HIGHLIGHT_SIZE, icon_size / (float)HIGHLIGHT_SIZE, &highlight_matrix);
-
-        exit_id = EXIT_1;
-
-        /* Draw the path using the matrix */
-        error = vg_lite_draw( render_target, &highlight_path, VG_LITE_FILL_EVEN_ODD, &highlight_matrix, 
-                                VG_LITE_BLEND_SRC_OVER, 0xFFE5AF71 );
-        if (error) {
-            printf("vg_lite_draw() returned error %d\r\n", error);
-            break;
-        }
-
-        /* Draw the 4 icons in a 2x2 grid */
-        for (count = 0; count < ICON_COUNT; count++) {
-            vg_lite_identity(&matrix);
-            
-            int row = count / GRID_COLS;
-            int col = count % GRID_COLS;
-
-            /* Center icon in its grid cell */
-            int icon_x = col * cell_width + (cell_width - ICON_SIZE) / 2;
-            int icon_y = row * cell_height + (cell_height - ICON_SIZE) / 2;
+    bool skipped = scene_fingerprint_unchanged(&scene_fingerprint);
 
-            vg_lite_translate(icon_x, icon_y, &matrix);
-
-            /* Draw the icon */
-            error = vg_lite_blit( render_target, &icons[count], &matrix, 
-                                VG_LITE_BLEND_SRC_OVER, 0, VG_LITE_FILTER_LINEAR );
-            if (error) {
-                printf("vg_lite_blit() returned error %d\r\n", error);
-                break;
-            }
-        }
-
-        if (error)
-        {
-            break;
-        }
-
-        /* Flush command buffer and wait for GPU to complete. */
-        error = vg_lite_finish();
-        if (error)
-        {
-            printf("GPU operation failed: vg_lite_finish() returned error %d\r\n", error);
-            break;
-        }
-
-        swap_frame_buffer();
-    }while(false);
-    
-    if (error)
+    if (skipped)
     {
-        cleanup(EVENT_UI_FILTER,exit_id);
+        /* No flush follows to retire the last frame, hand it to the display
+         * now. The previous frame is shown again, count it as a displayed
+         * frame. */
+        finish_pending_frames();
+        calculate_fps();
     }
 
+    return skipped;
 }
 
 /*******************************************************************************
-* Function Name: pattern_fill_draw
+* Function Name: submit_frame
 ********************************************************************************
 * Summary:
-*  -This function draws the image using GPU and refreshes the frame buffer.
-*  -It shows the infineon log on 4 different shapes using vg_lite_draw_pattern
+*  -Submits the command buffer and queues the render target for presentation.
+*   The GPU completes it in the background while the next frame is encoded.
+*   The fence is recorded first, as the GPU interrupt of the frame may arrive
+*   before vg_lite_flush() returns.
 *
 * Parameters:
 *  void
 *
 * Return:
-*  void
+*  vg_lite_error_t - VG_LITE_SUCCESS or the error of vg_lite_flush()
 *
 *******************************************************************************/
-void pattern_fill_draw(void)
+static vg_lite_error_t submit_frame(void)
 {
-    uint8_t exit_id = EXIT_0;
-    vg_lite_error_t error = VG_LITE_SUCCESS;
-    vg_lite_matrix_t box_matrix;
+    vg_lite_error_t error;
 
-    do
+    fence_frame_buffer();
+    error = vg_lite_flush();
+    if (error)
+    {
+        printf("GPU operation failed: vg_lite_flush() returned error %d\r\n", error);
+        cancel_frame_fence();
+    }
+    else
     {
-        vg_lite_identity(&box_matrix);
-        vg_lite_scale(ZOOM_SCALE_2_00, ZOOM_SCALE_1_00, &box_matrix); 
+        scene_fingerprint_commit(&scene_fingerprint);
+        path_cache_end_frame(&path_cache);
+        path_bounds_end_frame(&path_bounds);
+        tess_probe_end_frame(&tess_probe);
+        swap_frame_buffer();
+    }
 
-        vg_lite_translate(BOX_X_OFFSET, BOX_Y_OFFSET, &box_matrix);
+    return error;
+}
 
-        vg_lite_identity(&matrix);
-        vg_lite_translate( MAIN_MATRIX_X_OFFSET, MAIN_MATRIX_Y_OFFSET, &matrix);
+/*******************************************************************************
+* Function Name: begin_damage_pass
+********************************************************************************
+* Summary:
+*  -Restricts rendering to one rectangle of the repaint region and clears it.
+*
+* Parameters:
+*  rect            - Rectangle of the repaint region
+*  clear_color     - Background color
+*
+* Return:
+*  vg_lite_error_t - VG_LITE_SUCCESS or the error of the failing call
+*
+*******************************************************************************/
+static vg_lite_error_t begin_damage_pass(const damage_rect_t *rect,
+                                         vg_lite_color_t clear_color)
+{
+    vg_lite_rectangle_t area = { rect->x0, rect->y0,
+                                 rect->x1 - rect->x0, rect->y1 - rect->y0 };
+    vg_lite_error_t error;
 
-        /* Draw the path using the matrix. */
-        error = vg_lite_clear(render_target, NULL, WHITE_COLOR);
-        if (error)
-        {
-            printf("Clear failed: vg_lite_clear() returned error %d\r\n", error);
-            break;
-        }
+    error = vg_lite_set_scissor(rect->x0, rect->y0, rect->x1, rect->y1);
+    if (VG_LITE_SUCCESS == error)
+    {
+        error = vg_lite_enable_scissor();
+        path_bounds_set_scissor(&path_bounds, rect);
+    }
+    if (VG_LITE_SUCCESS == error)
+    {
+        error = GPU_PROFILE_CALL("vg_lite_clear", vg_lite_clear(render_target, &area, clear_color));
+    }
 
-        exit_id = EXIT_1;
-        error = vg_lite_draw_pattern( render_target, &square_path, VG_LITE_FILL_EVEN_ODD, &box_matrix, &image_buffer, 
-                                    &matrix, VG_LITE_BLEND_SRC_OVER, VG_LITE_PATTERN_COLOR, TEAL_COLOR,TEAL_COLOR,
-                                    VG_LITE_FILTER_POINT );
-        if (error)
-        {
-            printf("vg_lite_draw_pattern() returned error %d\r\n", error);
-            break;
-        }
+    return error;
+}
 
-        vg_lite_identity(&box_matrix);
-        vg_lite_scale(ZOOM_SCALE_2_00, ZOOM_SCALE_1_00, &box_matrix); 
-        vg_lite_translate( BOX_X_OFFSET + ( SCREEN_HALF_WIDTH / 2 ), BOX_Y_OFFSET, &box_matrix);
+/*******************************************************************************
+* Function Name: quadrant_matrices
+********************************************************************************
+* Summary:
+*  -Builds the translation matrices of the four screen quadrants, in the order
+*   top-left, top-right, bottom-left, bottom-right.
+*
+* Parameters:
+*  quadrant      - Array of QUADRANT_COUNT matrices to be filled
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void quadrant_matrices(vg_lite_matrix_t quadrant[QUADRANT_COUNT])
+{
+    for (uint8_t i = 0; i < (QUADRANT_COUNT); i++)
+    {
+        vg_lite_identity(&quadrant[i]);
+        vg_lite_translate((i % GRID_COLS) * SCREEN_HALF_WIDTH,
+                          (i / GRID_COLS) * SCREEN_HALF_HEIGHT, &quadrant[i]);
+    }
+}
 
-        vg_lite_identity(&matrix);
-        vg_lite_translate( MAIN_MATRIX_X_OFFSET + SCREEN_HALF_WIDTH, MAIN_MATRIX_Y_OFFSET, &matrix);
+/*******************************************************************************
+* Function Name: demo_scene_init
+********************************************************************************
+* Summary:
+*  -Initializes the description of a demo around its root node and adds the
+*   caption of the demo on top of the scene.
+*
+* Parameters:
+*  scene         - Demo scene
+*  id            - Demo identifier
+*  name          - Short name of the demo
+*  root          - Root group of the scene
+*  clear_color   - Background color
+*  track_damage  - true to redraw only the damaged rectangles. Scenes with
+*                  layers must be redrawn in full.
+*  exit_id       - Cleanup sequence covering all paths of the demo
+*  caption       - Text shown in the top left corner
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void demo_scene_init(demo_scene_t *scene, event_type_t id, const char *name,
+                            scene_node_t *root,
+                            vg_lite_color_t clear_color, bool track_damage,
+                            uint8_t exit_id, const char *caption)
+{
+    vg_lite_matrix_t local;
+
+    scene->id           = id;
+    scene->name         = name;
+    scene->clear_color  = clear_color;
+    scene->track_damage = track_damage;
+    scene->exit_id      = exit_id;
+
+    text_run_init(&scene->caption_run, &caption_font);
+    scene_node_init_text(&scene->caption, &scene->caption_run, CAPTION_COLOR);
+    scene_node_set_text(&scene->caption, caption);
+    vg_lite_identity(&local);
+    vg_lite_translate(CAPTION_X_POS, CAPTION_Y_POS, &local);
+    scene_node_set_transform(&scene->caption, &local);
+    scene_node_add_child(root, &scene->caption);
+
+    scene_graph_init(&scene->graph, root);
+    scene_graph_set_quality_policy(&scene->graph, &quality_policy);
+}
 
-        exit_id = EXIT_2;
-        error = vg_lite_draw_pattern( render_target, &pentagon_path, VG_LITE_FILL_EVEN_ODD, &box_matrix, &image_buffer, 
-                                    &matrix, VG_LITE_BLEND_SRC_OVER, VG_LITE_PATTERN_COLOR, TEAL_COLOR,TEAL_COLOR, 
-                                    VG_LITE_FILTER_POINT );
-        if (error)
-        {
-            printf("vg_lite_draw_pattern() returned error %d\r\n", error);
-            break;
-        }
+/*******************************************************************************
+* Function Name: build_default_scene
+********************************************************************************
+* Summary:
+*  -The Infineon logo, animated through the transform of its group.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void build_default_scene(void)
+{
+    scene_node_init_group(&default_root);
+    scene_node_init_group(&logo_group);
+    scene_node_add_child(&default_root, &logo_group);
 
-        vg_lite_identity(&box_matrix);
-        vg_lite_scale(ZOOM_SCALE_2_00, ZOOM_SCALE_1_50, &box_matrix); 
-        vg_lite_translate(BOX_X_OFFSET, (BOX_Y_OFFSET + SCREEN_HALF_HEIGHT - TRIANGLE_Y_ADJUSTMENT_BOX) , &box_matrix);
+    for (uint8_t count = 0; count < PATH_COUNT; count++)
+    {
+        scene_node_init_path(&logo_nodes[count], &path[count], VG_LITE_FILL_EVEN_ODD,
+                             VG_LITE_BLEND_NONE, color_data[count]);
+        scene_node_add_child(&logo_group, &logo_nodes[count]);
+    }
 
-        vg_lite_identity(&matrix);
-        vg_lite_translate( MAIN_MATRIX_X_OFFSET, MAIN_MATRIX_Y_OFFSET + SCREEN_HALF_HEIGHT + 
-                            TRIANGLE_Y_ADJUSTMENT_MAIN_MATRIX, &matrix);
+    demo_scene_init(&default_scene, EVENT_DEFAULT, "Default",
+                    &default_root, WHITE_COLOR, true, EXIT_2, "Infineon logo");
+}
 
-        exit_id = EXIT_3;
-        error = vg_lite_draw_pattern( render_target, &triangle_path, VG_LITE_FILL_EVEN_ODD, &box_matrix, &image_buffer,
-                                    &matrix, VG_LITE_BLEND_SRC_OVER, VG_LITE_PATTERN_COLOR, TEAL_COLOR,TEAL_COLOR, 
-                                    VG_LITE_FILTER_POINT );
-        if (error)
+/*******************************************************************************
+* Function Name: build_fill_rules_scene
+********************************************************************************
+* Summary:
+*  -The polygon (top) and the overlapping squares (bottom) filled with the
+*   even-odd (left) and non-zero (right) fill rules.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void build_fill_rules_scene(void)
+{
+    static vg_lite_path_t* const quadrant_path[QUADRANT_COUNT] = {
+        &polygon_path, &polygon_path,
+        &overlapping_squares_path, &overlapping_squares_path
+    };
+    static const vg_lite_fill_t quadrant_fill[QUADRANT_COUNT] = {
+        VG_LITE_FILL_EVEN_ODD, VG_LITE_FILL_NON_ZERO,
+        VG_LITE_FILL_EVEN_ODD, VG_LITE_FILL_NON_ZERO
+    };
+    vg_lite_matrix_t quadrant[QUADRANT_COUNT];
+
+    quadrant_matrices(quadrant);
+    scene_node_init_group(&fill_rules_root);
+
+    for (uint8_t i = 0; i < QUADRANT_COUNT; i++)
+    {
+        scene_node_init_path(&fill_rules_nodes[i], quadrant_path[i], quadrant_fill[i],
+                             VG_LITE_BLEND_NONE, TEAL_COLOR);
+        scene_node_set_transform(&fill_rules_nodes[i], &quadrant[i]);
+        scene_node_add_child(&fill_rules_root, &fill_rules_nodes[i]);
+    }
+
+    demo_scene_init(&fill_rules_scene, EVENT_FILL_RULES, "Fill rules",
+                    &fill_rules_root, WHITE_COLOR, false, EXIT_2,
+                    "Fill rules: even-odd, non-zero");
+}
+
+/*******************************************************************************
+* Function Name: build_alpha_behavior_scene
+********************************************************************************
+* Summary:
+*  -The star (top) and the concentric circles (bottom) drawn into the
+*   intermediate buffer, then composited with the source-over (left) and
+*   multiply (right) blend modes.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void build_alpha_behavior_scene(void)
+{
+    static vg_lite_path_t* const quadrant_path[QUADRANT_COUNT] = {
+        &self_intersecting_star_path, &self_intersecting_star_path,
+        &concentric_circles_path, &concentric_circles_path
+    };
+    static const vg_lite_blend_t quadrant_blend[QUADRANT_COUNT] = {
+        VG_LITE_BLEND_SRC_OVER, VG_LITE_BLEND_MULTIPLY,
+        VG_LITE_BLEND_SRC_OVER, VG_LITE_BLEND_MULTIPLY
+    };
+    vg_lite_matrix_t quadrant[QUADRANT_COUNT];
+
+    quadrant_matrices(quadrant);
+    scene_node_init_group(&alpha_behavior_root);
+
+    for (uint8_t i = 0; i < QUADRANT_COUNT; i++)
+    {
+        scene_node_init_layer(&alpha_behavior_layers[i], &intermediate_buffer, WHITE_COLOR,
+                              true, quadrant_blend[i]);
+        scene_node_set_transform(&alpha_behavior_layers[i], &quadrant[i]);
+        scene_node_add_child(&alpha_behavior_root, &alpha_behavior_layers[i]);
+
+        scene_node_init_path(&alpha_behavior_nodes[i], quadrant_path[i], VG_LITE_FILL_EVEN_ODD,
+                             VG_LITE_BLEND_NONE, TEAL_COLOR);
+        scene_node_add_child(&alpha_behavior_layers[i], &alpha_behavior_nodes[i]);
+    }
+
+    demo_scene_init(&alpha_behavior_scene, EVENT_ALPHA_BEHAVIOR, "Alpha behavior",
+                    &alpha_behavior_root, ALPHA_BEHAVIOR_CLEAR_COLOR, false, EXIT_2,
+                    "Alpha behavior: source over, multiply");
+}
+
+/*******************************************************************************
+* Function Name: build_blit_color_scene
+********************************************************************************
+* Summary:
+*  -The logo drawn at quarter scale into the intermediate buffer, then two
+*   copies of it blitted side by side with vg_lite_blit_rect().
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void build_blit_color_scene(void)
+{
+    vg_lite_matrix_t local;
+    int center_x_off_dest = ((SCREEN_HALF_WIDTH) - LOGO_WIDTH) / 2;
+    int center_y_off_dest = ((SCREEN_HEIGHT) - LOGO_HEIGHT) / 2;
+    int x_offsets_dest[GRID_COLS] = {center_x_off_dest, (SCREEN_HALF_WIDTH)+center_x_off_dest};
+    int y_offsets_dest[GRID_COLS] = {center_y_off_dest, center_y_off_dest};
+
+    scene_node_init_group(&blit_color_root);
+
+    /* Offscreen logo, not composited itself */
+    scene_node_init_layer(&blit_color_layer, &intermediate_buffer, WHITE_COLOR,
+                          false, VG_LITE_BLEND_NONE);
+    scene_node_add_child(&blit_color_root, &blit_color_layer);
+
+    scene_node_init_group(&blit_color_logo_group);
+    vg_lite_identity(&local);
+    vg_lite_scale(ZOOM_SCALE_0_25, ZOOM_SCALE_0_25, &local);
+    vg_lite_translate(X_OFFSET_0, Y_OFFSET_0, &local);
+    scene_node_set_transform(&blit_color_logo_group, &local);
+    scene_node_add_child(&blit_color_layer, &blit_color_logo_group);
+
+    for (uint8_t count = 0; count < PATH_COUNT; count++)
+    {
+        scene_node_init_path(&blit_color_logo_nodes[count], &path[count], VG_LITE_FILL_EVEN_ODD,
+                             VG_LITE_BLEND_NONE, color_data[count]);
+        scene_node_add_child(&blit_color_logo_group, &blit_color_logo_nodes[count]);
+    }
+
+    for (uint8_t i = 0; i < GRID_COLS; i++)
+    {
+        scene_node_init_image(&blit_color_copies[i], &intermediate_buffer, &blit_color_logo_rect,
+                              VG_LITE_BLEND_SRC_OVER, VG_LITE_FILTER_POINT);
+        vg_lite_identity(&local);
+        vg_lite_translate(x_offsets_dest[i], y_offsets_dest[i], &local);
+        scene_node_set_transform(&blit_color_copies[i], &local);
+        scene_node_add_child(&blit_color_root, &blit_color_copies[i]);
+    }
+
+    demo_scene_init(&blit_color_scene, EVENT_BLIT_COLOR, "Blit color",
+                    &blit_color_root, TEAL_COLOR, false, EXIT_2,
+                    "Blit color: vg_lite_blit_rect()");
+}
+
+/*******************************************************************************
+* Function Name: build_pattern_fill_scene
+********************************************************************************
+* Summary:
+*  -A square, pentagon, triangle and hexagon filled with the Infineon logo
+*   image using vg_lite_draw_pattern().
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void build_pattern_fill_scene(void)
+{
+    static vg_lite_path_t* const shape_path[QUADRANT_COUNT] = {
+        &square_path, &pentagon_path, &triangle_path, &hexagon_path
+    };
+    vg_lite_matrix_t box_matrix[QUADRANT_COUNT];
+    vg_lite_matrix_t pattern_matrix[QUADRANT_COUNT];
+
+    vg_lite_identity(&box_matrix[0]);
+    vg_lite_scale(ZOOM_SCALE_2_00, ZOOM_SCALE_1_00, &box_matrix[0]); 
+    vg_lite_translate(BOX_X_OFFSET, BOX_Y_OFFSET, &box_matrix[0]);
+
+    vg_lite_identity(&pattern_matrix[0]);
+    vg_lite_translate( MAIN_MATRIX_X_OFFSET, MAIN_MATRIX_Y_OFFSET, &pattern_matrix[0]);
+
+    vg_lite_identity(&box_matrix[1]);
+    vg_lite_scale(ZOOM_SCALE_2_00, ZOOM_SCALE_1_00, &box_matrix[1]); 
+    vg_lite_translate( BOX_X_OFFSET + ( SCREEN_HALF_WIDTH / 2 ), BOX_Y_OFFSET, &box_matrix[1]);
+
+    vg_lite_identity(&pattern_matrix[1]);
+    vg_lite_translate( MAIN_MATRIX_X_OFFSET + SCREEN_HALF_WIDTH, MAIN_MATRIX_Y_OFFSET, &pattern_matrix[1]);
+
+    vg_lite_identity(&box_matrix[2]);
+    vg_lite_scale(ZOOM_SCALE_2_00, ZOOM_SCALE_1_50, &box_matrix[2]); 
+    vg_lite_translate(BOX_X_OFFSET, (BOX_Y_OFFSET + SCREEN_HALF_HEIGHT - TRIANGLE_Y_ADJUSTMENT_BOX) , &box_matrix[2]);
+
+    vg_lite_identity(&pattern_matrix[2]);
+    vg_lite_translate( MAIN_MATRIX_X_OFFSET, MAIN_MATRIX_Y_OFFSET + SCREEN_HALF_HEIGHT + 
+                        TRIANGLE_Y_ADJUSTMENT_MAIN_MATRIX, &pattern_matrix[2]);
+
+    vg_lite_identity(&box_matrix[3]);
+    vg_lite_scale(ZOOM_SCALE_2_00, ZOOM_SCALE_1_00, &box_matrix[3]); 
+    vg_lite_translate(BOX_X_OFFSET + ( SCREEN_HALF_WIDTH / 2 ), BOX_Y_OFFSET +  SCREEN_HALF_HEIGHT  , &box_matrix[3]);
+
+    vg_lite_identity(&pattern_matrix[3]);
+    vg_lite_translate(MAIN_MATRIX_X_OFFSET + SCREEN_HALF_WIDTH,MAIN_MATRIX_Y_OFFSET + SCREEN_HALF_HEIGHT, &pattern_matrix[3]);
+
+    scene_node_init_group(&pattern_fill_root);
+
+    for (uint8_t i = 0; i < QUADRANT_COUNT; i++)
+    {
+        scene_node_init_pattern(&pattern_fill_nodes[i], shape_path[i], VG_LITE_FILL_EVEN_ODD,
+                                &image_buffer, &pattern_matrix[i], VG_LITE_BLEND_SRC_OVER,
+                                VG_LITE_PATTERN_COLOR, TEAL_COLOR, TEAL_COLOR,
+                                VG_LITE_FILTER_POINT);
+        scene_node_set_transform(&pattern_fill_nodes[i], &box_matrix[i]);
+        scene_node_add_child(&pattern_fill_root, &pattern_fill_nodes[i]);
+    }
+
+    demo_scene_init(&pattern_fill_scene, EVENT_PATTERN_FILL, "Pattern fill",
+                    &pattern_fill_root, WHITE_COLOR, false, EXIT_4,
+                    "Pattern fill: vg_lite_draw_pattern()");
+}
+
+/*******************************************************************************
+* Function Name: build_filter_scene
+********************************************************************************
+* Summary:
+*  -Four icons in a 2x2 grid and the highlight behind the selected one. The
+*   highlight is placed by filter_draw() every frame. The icons are drawn at
+*   1:1 and have no half resolution levels.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void build_filter_scene(void)
+{
+    vg_lite_matrix_t local;
+    int cell_width = SCREEN_WIDTH / GRID_COLS;
+    int cell_height = SCREEN_HEIGHT / GRID_ROWS;
+
+    scene_node_init_group(&filter_root);
+
+    scene_node_init_path(&highlight_node, &highlight_path, VG_LITE_FILL_EVEN_ODD,
+                         VG_LITE_BLEND_SRC_OVER, HIGHLIGHT_COLOR);
+    scene_node_add_child(&filter_root, &highlight_node);
+
+    /* Lay out the 4 icons in a 2x2 grid */
+    for (uint8_t count = 0; count < ICON_COUNT; count++)
+    {
+        int row = count / GRID_COLS;
+        int col = count % GRID_COLS;
+
+        /* Center icon in its grid cell */
+        int icon_x = col * cell_width + (cell_width - ICON_SIZE) / 2;
+        int icon_y = row * cell_height + (cell_height - ICON_SIZE) / 2;
+
+        scene_node_init_image(&icon_nodes[count], &icons[count], NULL,
+                              image_asset_blend(icon_assets[count]), VG_LITE_FILTER_LINEAR);
+        /* Tint of alpha only icons, 0 leaves the other formats unchanged */
+        scene_node_set_color(&icon_nodes[count], icon_assets[count]->tint);
+        vg_lite_identity(&local);
+        vg_lite_translate(icon_x, icon_y, &local);
+        scene_node_set_transform(&icon_nodes[count], &local);
+        scene_node_add_child(&filter_root, &icon_nodes[count]);
+    }
+
+    demo_scene_init(&filter_scene, EVENT_UI_FILTER, "UI filter",
+                    &filter_root, WHITE_COLOR, true, EXIT_1, icon_captions[0]);
+}
+
+/*******************************************************************************
+* Function Name: build_demo_scenes
+********************************************************************************
+* Summary:
+*  -Builds the scene descriptions of all demos. To be called once after the
+*   images are loaded and the intermediate buffer is allocated. Draws that
+*   move are rendered with fewer antialiasing samples until they settle.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void build_demo_scenes(void)
+{
+    const quality_policy_config_t quality_config = {
+        .budget         = QUALITY_MOVING_BUDGET,
+        .small_area     = QUALITY_SMALL_AREA,
+        .small_quality  = VG_LITE_UPPER,
+        .moving_quality = VG_LITE_MEDIUM,
+        .settle_frames  = QUALITY_POLICY_SETTLE_FRAMES
+    };
+
+    quality_policy_init(&quality_policy, &quality_config);
+
+    build_default_scene();
+    build_fill_rules_scene();
+    build_alpha_behavior_scene();
+    build_blit_color_scene();
+    build_pattern_fill_scene();
+    build_filter_scene();
+
+    perf_hud_init(&perf_hud, &caption_font, SCREEN_WIDTH);
+}
+
+/*******************************************************************************
+* Function Name: get_demo_name
+********************************************************************************
+* Summary:
+*  Returns the short name of a demo, used in the statistics reports.
+*
+* Parameters:
+*  demo          - Demo identifier
+*
+* Return:
+*  const char*   - Name, "-" before the scenes are built
+*
+*******************************************************************************/
+const char *get_demo_name(event_type_t demo)
+{
+    static const demo_scene_t *const scenes[EVENT_MAX] = {
+        [EVENT_DEFAULT]         = &default_scene,
+        [EVENT_FILL_RULES]      = &fill_rules_scene,
+        [EVENT_ALPHA_BEHAVIOR]  = &alpha_behavior_scene,
+        [EVENT_BLIT_COLOR]      = &blit_color_scene,
+        [EVENT_PATTERN_FILL]    = &pattern_fill_scene,
+        [EVENT_UI_FILTER]       = &filter_scene,
+    };
+
+    return ((demo < EVENT_MAX) && (NULL != scenes[demo]->name)) ? scenes[demo]->name : "-";
+}
+
+/*******************************************************************************
+* Function Name: render_demo_scene
+********************************************************************************
+* Summary:
+*  -Renders one frame of a demo: updates the cached transforms, skips the
+*   frame if it is identical to the last submitted one, otherwise draws the
+*   damaged rectangles (or the whole screen) in one traversal and submits it.
+*   The HUD is drawn over the scene, within its own rectangle.
+*
+* Parameters:
+*  scene         - Demo scene
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void render_demo_scene(demo_scene_t *scene)
+{
+    vg_lite_error_t error = VG_LITE_SUCCESS;
+    const damage_region_t *repaint;
+
+    GPU_PROFILE_DEMO(scene->name);
+
+    do
+    {
+        scene_graph_update(&scene->graph);
+        (void)perf_hud_begin_frame(&perf_hud, get_time_ms());
+
+        /* Fingerprint the frame before encoding any command */
+        scene_fingerprint_begin(&scene_fingerprint, scene->id);
+        scene_fingerprint_add(&scene_fingerprint, &scene->clear_color,
+                              sizeof(scene->clear_color));
+        scene_graph_fingerprint(&scene->graph, &scene_fingerprint);
+        perf_hud_fingerprint(&perf_hud, &scene_fingerprint);
+        if (skip_unchanged_frame())
         {
-            printf("vg_lite_draw_pattern() returned error %d\r\n", error);
             break;
         }
 
-        vg_lite_identity(&box_matrix);
-        vg_lite_scale(ZOOM_SCALE_2_00, ZOOM_SCALE_1_00, &box_matrix); 
-        vg_lite_translate(BOX_X_OFFSET + ( SCREEN_HALF_WIDTH / 2 ), BOX_Y_OFFSET +  SCREEN_HALF_HEIGHT  , &box_matrix);
+        if (scene->track_damage)
+        {
+            damage_tracker_begin_frame(&damage_tracker, get_render_target_slot());
+            scene_graph_report_damage(&scene->graph, &damage_tracker);
+            perf_hud_report_damage(&perf_hud, &damage_tracker);
+            repaint = damage_tracker_end_frame(&damage_tracker);
 
-        vg_lite_identity(&matrix);
-        vg_lite_translate(MAIN_MATRIX_X_OFFSET + SCREEN_HALF_WIDTH,MAIN_MATRIX_Y_OFFSET + SCREEN_HALF_HEIGHT, &matrix);
+            /* Clear and redraw only the out of date regions */
+            for (uint8_t r = 0; r < repaint->count; r++)
+            {
+                error = begin_damage_pass(&repaint->rects[r], scene->clear_color);
+                if (error)
+                {
+                    printf("Clear failed: vg_lite_clear() returned error %d\r\n", error);
+                    break;
+                }
+
+                error = scene_graph_draw(&scene->graph, render_target, &repaint->rects[r]);
+                if (!error)
+                {
+                    error = perf_hud_draw(&perf_hud, render_target, &repaint->rects[r]);
+                }
+                if (error)
+                {
+                    break;
+                }
+            }
 
-        exit_id = EXIT_4;
-        error = vg_lite_draw_pattern( render_target, &hexagon_path, VG_LITE_FILL_EVEN_ODD, &box_matrix, &image_buffer, 
-                                    &matrix, VG_LITE_BLEND_SRC_OVER, VG_LITE_PATTERN_COLOR, TEAL_COLOR,TEAL_COLOR, 
-                                    VG_LITE_FILTER_POINT );
-        if (error)
+            vg_lite_disable_scissor();
+            path_bounds_set_scissor(&path_bounds, NULL);
+        }
+        else
         {
-            printf("vg_lite_draw_pattern() returned error %d\r\n", error);
-            break;
+            error = GPU_PROFILE_CALL("vg_lite_clear",
+                                     vg_lite_clear(render_target, NULL, scene->clear_color));
+            if (error)
+            {
+                printf("Clear failed: vg_lite_clear() returned error %d\r\n", error);
+                break;
+            }
+
+            error = scene_graph_draw(&scene->graph, render_target, NULL);
+            if (!error)
+            {
+                error = perf_hud_draw(&perf_hud, render_target, NULL);
+            }
         }
 
-        /* Flush command buffer and wait for GPU to complete. */
-        error = vg_lite_finish();
         if (error)
         {
-            printf("GPU operation failed: vg_lite_finish() returned error %d\r\n", error);
             break;
         }
 
-        swap_frame_buffer();
+        error = submit_frame();
     }while(false);
 
     if (error)
     {
-        cleanup(EVENT_PATTERN_FILL,exit_id);
+        cleanup(scene->id, scene->exit_id);
     }
 }
 
+/*******************************************************************************
+* Function Name: FillRules_draw
+********************************************************************************
+* Summary:
+*  -This function draws the image using GPU and refreshes the frame buffer.
+*  -It uses the VG_LITE_FILL_NON_ZERO fill rule to render the Infineon logo.
+*     
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void fill_rules_draw(void)
+{
+    render_demo_scene(&fill_rules_scene);
+}
+
+/*******************************************************************************
+* Function Name: AlphaBehavior_draw
+********************************************************************************
+* Summary:
+*  -This function draws the image using GPU and refreshes the frame buffer.
+*  -It uses the VG_LITE_FILL_EVEN_ODD fill rule and VG_LITE_BLEND_SRC_OVER
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void alpha_behavior_draw(void)
+{
+    render_demo_scene(&alpha_behavior_scene);
+}
+
+/*******************************************************************************
+* Function Name: BlitColor_draw
+********************************************************************************
+* Summary:
+*  -This function draws the image using GPU and refreshes the frame buffer.
+*  -It uses the VG_LITE_FILL_EVEN_ODD fill rule and VG_LITE_BLEND_SRC_OVER
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void blit_color_draw(void)
+{
+    render_demo_scene(&blit_color_scene);
+}
+
+/*******************************************************************************
+* Function Name: filter_draw
+********************************************************************************
+* Summary:
+*  -This function draws the image using GPU and refreshes the frame buffer.
+*  -It uses the VG_LITE_FILL_EVEN_ODD fill rule and VG_LITE_BLEND_SRC_OVER
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void filter_draw(void)
+{
+    vg_lite_matrix_t highlight_matrix;
+    int icon_size = 176;
+    int cell_width = SCREEN_WIDTH / GRID_COLS;
+    int cell_height = SCREEN_HEIGHT / GRID_ROWS;
+
+    vg_lite_identity(&highlight_matrix);
+    uint8_t highlight_row = GRID_0_X_OFFSET;
+    uint8_t highlight_col = GRID_0_Y_OFFSET;
+
+    /* Calculate which icon to highlight based on time */
+    uint32_t current_time = get_time_ms();
+    uint32_t highlight_period = 5000; // 5 seconds
+    uint8_t current_icon = (current_time / highlight_period) % ICON_COUNT;
+
+    /* Compute row and column of highlighted icon */
+    highlight_row = current_icon / GRID_COLS;
+    highlight_col = current_icon % GRID_COLS;
+
+    /* Center icon in its grid cell */
+    int icon_x = highlight_col * cell_width + (cell_width - ICON_SIZE) / 2;
+    int icon_y = highlight_row * cell_height + (cell_height - ICON_SIZE) / 2;
+
+    vg_lite_translate(icon_x, icon_y, &highlight_matrix);
+    vg_lite_scale(icon_size / (float)HIGHLIGHT_SIZE, icon_size / (float)HIGHLIGHT_SIZE, &highlight_matrix);
+
+    /* Only marks the highlight dirty when it moves to another icon */
+    scene_node_set_transform(&highlight_node, &highlight_matrix);
+
+    /* Laid out again only when the highlight moves to another icon */
+    scene_node_set_text(&filter_scene.caption, icon_captions[current_icon]);
+
+    render_demo_scene(&filter_scene);
+}
+
+/*******************************************************************************
+* Function Name: pattern_fill_draw
+********************************************************************************
+* Summary:
+*  -This function draws the image using GPU and refreshes the frame buffer.
+*  -It shows the infineon log on 4 different shapes using vg_lite_draw_pattern
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void pattern_fill_draw(void)
+{
+    render_demo_scene(&pattern_fill_scene);
+}
+
 /*******************************************************************************
 * Function Name: animate_image
 ********************************************************************************
@@ -891,56 +1336,12 @@ void animate_image(void)
 *******************************************************************************/
 void default_draw(void)
 {
-    uint8_t exit_id = EXIT_0;
-    uint8_t count;
-    vg_lite_error_t error = VG_LITE_SUCCESS;
+    scene_node_set_transform(&logo_group, &matrix);
 
-    do
-    {
-        /* Draw the path using the matrix. */
-        error = vg_lite_clear(render_target, NULL, WHITE_COLOR);
-        if (error)
-        {
-            printf("Clear failed: vg_lite_clear() returned error %d\r\n", error);
-            break;
-        }
-
-        for (count = 0; count < PATH_COUNT; count++)
-        {
-            exit_id++;
-            error = vg_lite_draw(render_target, &path[count], VG_LITE_FILL_EVEN_ODD,
-                                &matrix, VG_LITE_BLEND_NONE, color_data[count]);
+    render_demo_scene(&default_scene);
 
-            if (error)
-            {
-                printf("vg_lite_draw() returned error %d\r\n", error);
-                break;
-            }
-        }
-
-        if (error)
-        {
-            break;
-        }
-
-        /* Rotate and zoom in/out the rendered image */
-        animate_image();
-
-        /* Flush command buffer and wait for GPU to complete. */
-        error = vg_lite_finish();
-        if (error)
-        {
-            printf("GPU operation failed: vg_lite_finish() returned error %d\r\n", error);
-            break;
-        }
-
-        swap_frame_buffer();
-    }while(false);
-
-    if (error)
-    {
-        cleanup(EVENT_DEFAULT,exit_id);
-    }
+    /* Rotate and zoom in/out the rendered image */
+    animate_image();
 }
 
 /*******************************************************************************
@@ -971,10 +1372,14 @@ void cleanup(event_type_t demo_id, uint8_t e_id)
         vg_lite_path_t* const* paths = cleanup_table[demo_id][e_id];
         for (int i = 0; paths && paths[i]; i++) 
         {
-            vg_lite_clear_path(paths[i]);
+            gpu_heap_clear_path(&gpu_heap, paths[i]);
         }
     }
     
+    cmd_set_path_hook(NULL, NULL);
+    path_cache_release(&path_cache);
+    gpu_heap_report(&gpu_heap);
+
     /* Deallocate all the resource and free up all the memory */
     vg_lite_close();
 
@@ -57,6 +57,14 @@ extern "C" {
 #include "queue.h"
 #include "vg_lite.h"
 #include "cy_graphics.h"
+#include "damage_tracker.h"
+#include "scene_fingerprint.h"
+#include "path_cache.h"
+#include "path_bounds.h"
+#include "tess_probe.h"
+#include "quality_policy.h"
+#include "gpu_heap.h"
+#include "perf_hud.h"
 
 /*******************************************************************************
 * Macros
@@ -114,7 +122,14 @@ void pattern_fill_draw(void);
 void cleanup(event_type_t demo_id, uint8_t e_id);
 uint32_t get_time_ms(void);
 void default_draw(void);
+void fence_frame_buffer(void);
+void cancel_frame_fence(void);
+void finish_pending_frames(void);
 void swap_frame_buffer( void );
+uint8_t get_render_target_slot(void);
+void reset_frame_history(void);
+void build_demo_scenes(void);
+const char *get_demo_name(event_type_t demo);
 
 /*******************************************************************************
 * Extern Variables 
@@ -124,6 +139,14 @@ extern vg_lite_buffer_t *render_target;
 extern vg_lite_buffer_t intermediate_buffer;
 extern bool zoom_out;
 extern int scale_count;
+extern damage_tracker_t damage_tracker;
+extern scene_fingerprint_t scene_fingerprint;
+extern path_cache_t path_cache;
+extern path_bounds_t path_bounds;
+extern tess_probe_t tess_probe;
+extern quality_policy_t quality_policy;
+extern gpu_heap_t gpu_heap;
+extern perf_hud_t perf_hud;
 
 #if defined(__cplusplus)
 }
@@ -0,0 +1,328 @@
+/*******************************************************************************
+* File Name        : cpu_load_check.c
+*
+* Description      : Host checks of the CPU accounting: counter wrap, windows,
+*                    task registration and interrupt shares.
+*
+* Related Document : See README.md
+*
+********************************************************************************
+* Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "cpu_load.h"
+#include "host_check.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* Run time counter ticks and CPU cycles between two samples */
+#define TICKS_PER_SAMPLE                    (10000U)
+#define CYCLES_PER_SAMPLE                   (400000000U)
+/* Starts close to a wrap so every counter wraps during the checks */
+#define COUNTER_START                       (0xFFFFE000UL)
+#define CYCLES_START                        (0xF0000000UL)
+
+#define SIM_TASKS                           (4U)
+#define IDLE_SLOT                           (2U)
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+static const char *const task_names[SIM_TASKS] = {
+    "CM55 Gfx Task", "UART CLI Task", "IDLE", "Tmr Svc"
+};
+static const uint32_t steady[SIM_TASKS] = { 600U, 10U, 350U, 40U };
+static const uint32_t heavy[SIM_TASKS] = { 900U, 10U, 50U, 40U };
+
+static cpu_load_t load;
+static uint32_t sim_time;
+static uint32_t sim_cycles;
+static uint32_t sim_task_time[SIM_TASKS];
+static bool sim_task_present[SIM_TASKS];
+
+
+/*******************************************************************************
+* Function Name: sim_start
+********************************************************************************
+* Summary:
+*  Restarts the simulated system with all counters close to a wrap.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void sim_start(void)
+{
+    cpu_load_init(&load);
+    sim_time   = COUNTER_START;
+    sim_cycles = CYCLES_START;
+    for (uint8_t task = 0U; task < SIM_TASKS; task++)
+    {
+        sim_task_time[task]    = COUNTER_START + (task * 100U);
+        sim_task_present[task] = true;
+    }
+    load.irq_cycles[CPU_LOAD_IRQ_DC]  = 0xFFFFFF00UL;
+    load.irq_cycles[CPU_LOAD_IRQ_GPU] = 0xFFFF0000UL;
+}
+
+/*******************************************************************************
+* Function Name: run_samples
+********************************************************************************
+* Summary:
+*  Runs the simulated system for a number of sample periods and takes a
+*  sample at the end of each.
+*
+* Parameters:
+*  count    - Sample periods
+*  permille - Share of each task in 1/1000
+*  dc       - Share of the DC interrupt in 1/1000
+*  gpu      - Share of the GPU interrupt in 1/1000
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void run_samples(uint32_t count, const uint32_t *permille, uint32_t dc, uint32_t gpu)
+{
+    for (uint32_t i = 0U; i < count; i++)
+    {
+        sim_time   += TICKS_PER_SAMPLE;
+        sim_cycles += CYCLES_PER_SAMPLE;
+        for (uint8_t task = 0U; task < SIM_TASKS; task++)
+        {
+            sim_task_time[task] += (TICKS_PER_SAMPLE / CPU_LOAD_PERMILLE) * permille[task];
+        }
+        /* Several handler runs per period */
+        for (uint32_t run = 0U; run < 4U; run++)
+        {
+            cpu_load_add_irq(&load, CPU_LOAD_IRQ_DC, (CYCLES_PER_SAMPLE / 4000U) * dc);
+            cpu_load_add_irq(&load, CPU_LOAD_IRQ_GPU, (CYCLES_PER_SAMPLE / 4000U) * gpu);
+        }
+
+        cpu_load_begin(&load, sim_time, sim_cycles);
+        for (uint8_t task = 0U; task < SIM_TASKS; task++)
+        {
+            if (sim_task_present[task])
+            {
+                cpu_load_add_task(&load, task_names[task], sim_task_time[task],
+                                  IDLE_SLOT == task);
+            }
+        }
+        cpu_load_end(&load);
+    }
+}
+
+/*******************************************************************************
+* Function Name: shares_are
+********************************************************************************
+* Summary:
+*  Tells whether a report holds the given task shares.
+*
+* Parameters:
+*  report   - Shares over a window
+*  permille - Expected share of each simulated task
+*
+* Return:
+*  bool     - All shares match
+*
+*******************************************************************************/
+static bool shares_are(const cpu_load_report_t *report, const uint32_t *permille)
+{
+    for (uint8_t task = 0U; task < SIM_TASKS; task++)
+    {
+        if (report->task_permille[task] != permille[task])
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+/*******************************************************************************
+* Function Name: check_windows
+********************************************************************************
+* Summary:
+*  Checks the shares over both windows across counter wraps, a change of
+*  load and more samples than the history holds.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void check_windows(void)
+{
+    cpu_load_report_t report;
+    uint32_t mixed[SIM_TASKS];
+
+    sim_start();
+    check(!cpu_load_get(&load, CPU_LOAD_SHORT_WINDOW, &report), "No shares before any sample");
+    run_samples(1U, steady, 10U, 5U);
+    check(!cpu_load_get(&load, CPU_LOAD_SHORT_WINDOW, &report), "One sample is no window");
+
+    run_samples(1U, steady, 10U, 5U);
+    check(cpu_load_get(&load, CPU_LOAD_SHORT_WINDOW, &report) && shares_are(&report, steady) &&
+          (4U == report.task_count), "Task shares across a counter wrap");
+    check((10U == report.irq_permille[CPU_LOAD_IRQ_DC]) &&
+          (5U == report.irq_permille[CPU_LOAD_IRQ_GPU]), "Interrupt shares across a wrap");
+    check(650U == report.busy_permille, "Busy is all but the idle task");
+    check(0 == strcmp(cpu_load_task_name(&load, IDLE_SLOT), "IDLE") &&
+          (NULL == cpu_load_task_name(&load, SIM_TASKS)), "Tasks keep their names");
+
+    run_samples(3U, steady, 10U, 5U);
+    cpu_load_get(&load, CPU_LOAD_LONG_WINDOW, &report);
+    check((4U == report.samples) && shares_are(&report, steady),
+          "Long window shortened to the samples taken");
+
+    run_samples(CPU_LOAD_LONG_WINDOW, steady, 10U, 5U);
+    run_samples(1U, heavy, 30U, 5U);
+    cpu_load_get(&load, CPU_LOAD_SHORT_WINDOW, &report);
+    check(shares_are(&report, heavy) && (30U == report.irq_permille[CPU_LOAD_IRQ_DC]),
+          "Short window follows a change of load");
+    for (uint8_t task = 0U; task < SIM_TASKS; task++)
+    {
+        mixed[task] = ((steady[task] * (CPU_LOAD_LONG_WINDOW - 1U)) + heavy[task]) /
+                      CPU_LOAD_LONG_WINDOW;
+    }
+    cpu_load_get(&load, CPU_LOAD_LONG_WINDOW, &report);
+    check((CPU_LOAD_LONG_WINDOW == report.samples) && shares_are(&report, mixed) &&
+          (12U == report.irq_permille[CPU_LOAD_IRQ_DC]), "Long window averages its samples");
+
+    run_samples(3U * CPU_LOAD_HISTORY, steady, 10U, 5U);
+    cpu_load_get(&load, CPU_LOAD_LONG_WINDOW, &report);
+    check(shares_are(&report, steady), "History wraps around");
+}
+
+/*******************************************************************************
+* Function Name: check_tasks
+********************************************************************************
+* Summary:
+*  Checks tasks appearing, disappearing and beyond the slots, and the busy
+*  share without an idle task.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void check_tasks(void)
+{
+    static const uint32_t later[SIM_TASKS] = { 600U, 10U, 300U, 90U };
+    static const uint32_t gone[SIM_TASKS] = { 600U, 10U, 300U, 0U };
+    cpu_load_report_t report;
+    char name[CPU_LOAD_NAME_LENGTH];
+
+    /* A task created after the first sample */
+    sim_start();
+    sim_task_present[3] = false;
+    sim_task_time[3]    = 0U;
+    run_samples(2U, gone, 0U, 0U);
+    sim_task_present[3] = true;
+    run_samples(1U, later, 0U, 0U);
+    cpu_load_get(&load, CPU_LOAD_SHORT_WINDOW, &report);
+    check(shares_are(&report, later), "New task counts from zero");
+    cpu_load_get(&load, CPU_LOAD_LONG_WINDOW, &report);
+    check(0U != report.task_permille[3], "New task shows in the long window");
+
+    /* Deleted and created again, the counter restarts */
+    sim_task_present[3] = false;
+    run_samples(1U, gone, 0U, 0U);
+    cpu_load_get(&load, CPU_LOAD_SHORT_WINDOW, &report);
+    check(shares_are(&report, gone), "Missing task keeps its time");
+    sim_task_present[3] = true;
+    sim_task_time[3]    = 0U;
+    run_samples(1U, later, 0U, 0U);
+    cpu_load_get(&load, CPU_LOAD_SHORT_WINDOW, &report);
+    check(shares_are(&report, later), "Task created again counts from zero");
+
+    for (uint8_t i = 0U; i < CPU_LOAD_MAX_TASKS; i++)
+    {
+        snprintf(name, sizeof(name), "Extra %u", (unsigned int)i);
+        cpu_load_begin(&load, sim_time, sim_cycles);
+        cpu_load_add_task(&load, name, 0U, false);
+        cpu_load_end(&load);
+    }
+    check(CPU_LOAD_MAX_TASKS == load.task_count, "Tasks beyond the slots are ignored");
+
+    cpu_load_init(&load);
+    cpu_load_begin(&load, 0U, 0U);
+    cpu_load_add_task(&load, "A", 0U, false);
+    cpu_load_add_task(&load, "B", 0U, false);
+    cpu_load_end(&load);
+    cpu_load_begin(&load, 1000U, 0U);
+    cpu_load_add_task(&load, "A", 200U, false);
+    cpu_load_add_task(&load, "B", 300U, false);
+    cpu_load_end(&load);
+    cpu_load_get(&load, CPU_LOAD_SHORT_WINDOW, &report);
+    check((500U == report.busy_permille) && (0U == report.irq_permille[CPU_LOAD_IRQ_DC]),
+          "Busy sums the tasks without an idle task");
+}
+
+/*******************************************************************************
+* Function Name: main
+********************************************************************************
+* Summary:
+*  Runs the CPU accounting checks.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  int - 0 if all checks passed
+*
+*******************************************************************************/
+int main(void)
+{
+    check_windows();
+    check_tasks();
+
+    sim_start();
+    run_samples(CPU_LOAD_HISTORY, steady, 10U, 5U);
+    cpu_load_print(&load);
+
+    return check_summary();
+}
+
+/* [] END OF FILE */
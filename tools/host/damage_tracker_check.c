@@ -0,0 +1,548 @@
+/*******************************************************************************
+* File Name        : damage_tracker_check.c
+*
+* Description      : Host check of the damage tracker: merging of overlapping, contained
+*                    and adjacent rectangles, the merge at DAMAGE_MAX_RECTS, and the repaint
+*                    regions of swap chain buffers of different age.
+*
+* Related Document : See README.md
+*
+********************************************************************************
+* Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "damage_tracker.h"
+#include "host_check.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+#define SCREEN_WIDTH                        (64)
+#define SCREEN_HEIGHT                       (48)
+/* Slots the buffer age checks rotate through */
+#define CHAIN_DEPTH                         (3U)
+#define SPRITE_KEY                          (1U)
+#define SPRITE_SIZE                         (8)
+/* Horizontal step of the sprite per frame, leaves a gap between positions */
+#define SPRITE_STEP                         (10)
+#define BAR_KEY                             (2U)
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+static damage_tracker_t tracker;
+
+
+/*******************************************************************************
+* Function Name: rect
+********************************************************************************
+* Summary:
+*  Builds a rectangle from its corners.
+*
+* Parameters:
+*  x0, y0 - Top left corner
+*  x1, y1 - Bottom right corner, exclusive
+*
+* Return:
+*  damage_rect_t - Rectangle
+*
+*******************************************************************************/
+static damage_rect_t rect(int32_t x0, int32_t y0, int32_t x1, int32_t y1)
+{
+    damage_rect_t r = { x0, y0, x1, y1 };
+
+    return r;
+}
+
+/*******************************************************************************
+* Function Name: region_has
+********************************************************************************
+* Summary:
+*  Tells whether a region holds exactly the given rectangle.
+*
+* Parameters:
+*  region - Region to search
+*  r      - Rectangle
+*
+* Return:
+*  bool   - true if one of the region rectangles equals r
+*
+*******************************************************************************/
+static bool region_has(const damage_region_t *region, damage_rect_t r)
+{
+    for (uint8_t i = 0U; i < region->count; i++)
+    {
+        if ((region->rects[i].x0 == r.x0) && (region->rects[i].y0 == r.y0) &&
+            (region->rects[i].x1 == r.x1) && (region->rects[i].y1 == r.y1))
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+/*******************************************************************************
+* Function Name: region_covers
+********************************************************************************
+* Summary:
+*  Tells whether every pixel of a rectangle lies inside a region.
+*
+* Parameters:
+*  region - Region
+*  r      - Rectangle
+*
+* Return:
+*  bool   - true if all pixels are covered
+*
+*******************************************************************************/
+static bool region_covers(const damage_region_t *region, damage_rect_t r)
+{
+    const damage_rect_t *c;
+    bool found;
+
+    for (int32_t y = r.y0; y < r.y1; y++)
+    {
+        for (int32_t x = r.x0; x < r.x1; x++)
+        {
+            found = false;
+            for (uint8_t i = 0U; (i < region->count) && !found; i++)
+            {
+                c = &region->rects[i];
+                found = (x >= c->x0) && (x < c->x1) && (y >= c->y0) && (y < c->y1);
+            }
+            if (!found)
+            {
+                return false;
+            }
+        }
+    }
+
+    return true;
+}
+
+/*******************************************************************************
+* Function Name: region_touches
+********************************************************************************
+* Summary:
+*  Tells whether any pixel of a rectangle lies inside a region.
+*
+* Parameters:
+*  region - Region
+*  r      - Rectangle
+*
+* Return:
+*  bool   - true if the region and the rectangle overlap
+*
+*******************************************************************************/
+static bool region_touches(const damage_region_t *region, damage_rect_t r)
+{
+    for (uint8_t i = 0U; i < region->count; i++)
+    {
+        if (damage_rect_intersect(&region->rects[i], &r, NULL))
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+/*******************************************************************************
+* Function Name: is_full_screen
+********************************************************************************
+* Summary:
+*  Tells whether a repaint region is the whole screen.
+*
+* Parameters:
+*  region - Repaint region
+*
+* Return:
+*  bool   - true for a full screen repaint
+*
+*******************************************************************************/
+static bool is_full_screen(const damage_region_t *region)
+{
+    return (1U == region->count) &&
+           region_has(region, rect(0, 0, SCREEN_WIDTH, SCREEN_HEIGHT));
+}
+
+/*******************************************************************************
+* Function Name: sprite_at
+********************************************************************************
+* Summary:
+*  Returns the sprite rectangle of a frame, the sprite moves right by
+*  SPRITE_STEP each frame.
+*
+* Parameters:
+*  frame - Frame number
+*
+* Return:
+*  damage_rect_t - Sprite bounds
+*
+*******************************************************************************/
+static damage_rect_t sprite_at(uint32_t frame)
+{
+    int32_t x = (int32_t)frame * SPRITE_STEP;
+
+    return rect(x, 0, x + SPRITE_SIZE, SPRITE_SIZE);
+}
+
+/*******************************************************************************
+* Function Name: covers_sprites
+********************************************************************************
+* Summary:
+*  Tells whether a region covers the sprite positions of a range of frames.
+*
+* Parameters:
+*  region - Region
+*  first  - First frame
+*  last   - Last frame, inclusive
+*
+* Return:
+*  bool   - true if every position is covered
+*
+*******************************************************************************/
+static bool covers_sprites(const damage_region_t *region, uint32_t first, uint32_t last)
+{
+    for (uint32_t frame = first; frame <= last; frame++)
+    {
+        if (!region_covers(region, sprite_at(frame)))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+/*******************************************************************************
+* Function Name: render
+********************************************************************************
+* Summary:
+*  Tracks one frame drawn into a swap chain slot: a static bar at the bottom
+*  and the sprite at the position of the given frame.
+*
+* Parameters:
+*  slot  - Swap chain slot drawn into
+*  frame - Frame number that sets the sprite position
+*
+* Return:
+*  const damage_region_t* - Region to repaint in the slot
+*
+*******************************************************************************/
+static const damage_region_t *render(uint8_t slot, uint32_t frame)
+{
+    const damage_rect_t bar = rect(0, SCREEN_HEIGHT - 8, SCREEN_WIDTH, SCREEN_HEIGHT);
+    const damage_rect_t sprite = sprite_at(frame);
+
+    damage_tracker_begin_frame(&tracker, slot);
+    damage_tracker_add_item(&tracker, BAR_KEY, &bar);
+    damage_tracker_add_item(&tracker, SPRITE_KEY, &sprite);
+
+    return damage_tracker_end_frame(&tracker);
+}
+
+/*******************************************************************************
+* Function Name: check_rects
+********************************************************************************
+* Summary:
+*  Checks the rectangle helpers.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void check_rects(void)
+{
+    const damage_rect_t a = rect(0, 0, 10, 10);
+    const damage_rect_t b = rect(5, 5, 20, 20);
+    const damage_rect_t right = rect(10, 0, 20, 10);
+    damage_rect_t out;
+
+    check(damage_rect_is_empty(&(damage_rect_t){ 5, 5, 5, 10 }) &&
+          damage_rect_is_empty(&(damage_rect_t){ 5, 10, 8, 5 }) &&
+          !damage_rect_is_empty(&a),
+          "rect: zero width and inverted rectangles are empty");
+    check((100U == damage_rect_area(&a)) &&
+          (0U == damage_rect_area(&(damage_rect_t){ 5, 10, 8, 5 })),
+          "rect: area, none for an empty rectangle");
+    check(damage_rect_intersect(&a, &b, &out) &&
+          (5 == out.x0) && (5 == out.y0) && (10 == out.x1) && (10 == out.y1),
+          "rect: intersection of overlapping rectangles");
+    check(!damage_rect_intersect(&a, &right, NULL),
+          "rect: rectangles sharing an edge do not intersect");
+}
+
+/*******************************************************************************
+* Function Name: check_merging
+********************************************************************************
+* Summary:
+*  Checks how damage_region_add() folds overlapping, contained and adjacent
+*  rectangles.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void check_merging(void)
+{
+    damage_region_t region;
+
+    damage_region_clear(&region);
+    damage_region_add(&region, &(damage_rect_t){ 5, 5, 5, 10 });
+    check(0U == region.count, "region: empty rectangle is ignored");
+
+    /* Overlap: the union costs no more pixels than the two apart */
+    damage_region_clear(&region);
+    damage_region_add(&region, &(damage_rect_t){ 0, 0, 10, 10 });
+    damage_region_add(&region, &(damage_rect_t){ 5, 0, 15, 10 });
+    check((1U == region.count) && region_has(&region, rect(0, 0, 15, 10)),
+          "region: overlapping rectangles merge");
+
+    /* Overlap at a corner: the union would draw far more pixels */
+    damage_region_clear(&region);
+    damage_region_add(&region, &(damage_rect_t){ 0, 0, 10, 10 });
+    damage_region_add(&region, &(damage_rect_t){ 9, 9, 20, 20 });
+    check((2U == region.count) && region_has(&region, rect(0, 0, 10, 10)) &&
+          region_has(&region, rect(9, 9, 20, 20)),
+          "region: corner overlap stays apart");
+
+    /* Containment, in both orders */
+    damage_region_clear(&region);
+    damage_region_add(&region, &(damage_rect_t){ 0, 0, 20, 20 });
+    damage_region_add(&region, &(damage_rect_t){ 5, 5, 10, 10 });
+    check((1U == region.count) && region_has(&region, rect(0, 0, 20, 20)),
+          "region: contained rectangle is dropped");
+    damage_region_clear(&region);
+    damage_region_add(&region, &(damage_rect_t){ 5, 5, 10, 10 });
+    damage_region_add(&region, &(damage_rect_t){ 0, 0, 20, 20 });
+    check((1U == region.count) && region_has(&region, rect(0, 0, 20, 20)),
+          "region: containing rectangle replaces");
+
+    /* Adjacency: a shared edge merges, a shared corner does not */
+    damage_region_clear(&region);
+    damage_region_add(&region, &(damage_rect_t){ 0, 0, 10, 10 });
+    damage_region_add(&region, &(damage_rect_t){ 10, 0, 20, 10 });
+    check((1U == region.count) && region_has(&region, rect(0, 0, 20, 10)),
+          "region: rectangles sharing an edge merge");
+    damage_region_clear(&region);
+    damage_region_add(&region, &(damage_rect_t){ 0, 0, 10, 10 });
+    damage_region_add(&region, &(damage_rect_t){ 10, 10, 20, 20 });
+    check(2U == region.count, "region: rectangles sharing a corner stay apart");
+
+    /* A rectangle bridging two others absorbs both */
+    damage_region_clear(&region);
+    damage_region_add(&region, &(damage_rect_t){ 0, 0, 10, 10 });
+    damage_region_add(&region, &(damage_rect_t){ 20, 0, 30, 10 });
+    damage_region_add(&region, &(damage_rect_t){ 10, 0, 20, 10 });
+    check((1U == region.count) && region_has(&region, rect(0, 0, 30, 10)),
+          "region: bridging rectangle absorbs its neighbours");
+    check(300U == damage_region_area(&region), "region: area of a merged region");
+}
+
+/*******************************************************************************
+* Function Name: check_merge_cap
+********************************************************************************
+* Summary:
+*  Checks that a full region merges a new rectangle into the one that grows
+*  the least, without losing any damaged pixel.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void check_merge_cap(void)
+{
+    damage_region_t region;
+    damage_rect_t r;
+    bool covered = true;
+
+    /* Diagonal squares, too far apart to merge on their own */
+    damage_region_clear(&region);
+    for (int32_t i = 0; i < (int32_t)DAMAGE_MAX_RECTS; i++)
+    {
+        r = rect(i * 20, i * 20, (i * 20) + 10, (i * 20) + 10);
+        damage_region_add(&region, &r);
+    }
+    check(DAMAGE_MAX_RECTS == region.count, "cap: separate rectangles fill the region");
+
+    r = rect(80, 80, 90, 90);
+    damage_region_add(&region, &r);
+    check(DAMAGE_MAX_RECTS == region.count, "cap: a further rectangle does not overflow");
+    check(region_has(&region, rect(60, 60, 90, 90)),
+          "cap: merged into the rectangle that grows the least");
+    for (int32_t i = 0; i <= (int32_t)DAMAGE_MAX_RECTS; i++)
+    {
+        covered = covered &&
+                  region_covers(&region, rect(i * 20, i * 20, (i * 20) + 10, (i * 20) + 10));
+    }
+    check(covered, "cap: every added rectangle is still covered");
+
+    /* The merged rectangle may now reach a neighbour and absorb it */
+    damage_region_clear(&region);
+    damage_region_add(&region, &(damage_rect_t){ 0, 0, 10, 10 });
+    damage_region_add(&region, &(damage_rect_t){ 20, 0, 30, 10 });
+    damage_region_add(&region, &(damage_rect_t){ 0, 40, 10, 50 });
+    damage_region_add(&region, &(damage_rect_t){ 40, 40, 50, 50 });
+    damage_region_add(&region, &(damage_rect_t){ 10, 0, 20, 5 });
+    check((3U == region.count) && region_has(&region, rect(0, 0, 30, 10)),
+          "cap: grown rectangle absorbs its neighbour");
+}
+
+/*******************************************************************************
+* Function Name: check_buffer_age
+********************************************************************************
+* Summary:
+*  Checks the repaint regions of a three slot swap chain: a slot repaints
+*  the damage of every frame it missed, and the whole screen when its
+*  content is unknown or too old.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void check_buffer_age(void)
+{
+    const damage_rect_t bar = rect(0, SCREEN_HEIGHT - 8, SCREEN_WIDTH, SCREEN_HEIGHT);
+    const damage_region_t *repaint;
+    damage_stats_t stats;
+    bool full = true;
+    uint32_t frame = 0U;
+
+    damage_tracker_reset(&tracker, SCREEN_WIDTH, SCREEN_HEIGHT);
+    damage_tracker_get_stats(&tracker, &stats, true);
+
+    for (; frame < CHAIN_DEPTH; frame++)
+    {
+        repaint = render((uint8_t)frame, frame);
+        full = full && is_full_screen(repaint);
+    }
+    check(full, "age: first use of each slot repaints the whole screen");
+
+    /* Slot 0 holds frame 0 and missed frames 1 and 2 */
+    repaint = render(0U, frame);
+    check(covers_sprites(repaint, 0U, frame),
+          "age 3: repaints the sprite of every missed frame");
+    check(!region_touches(repaint, bar) && !is_full_screen(repaint),
+          "age 3: leaves the static bar alone");
+    frame++;
+
+    /* Slot 1 holds frame 1, the sprite of frame 0 is already gone there */
+    repaint = render(1U, frame);
+    check(covers_sprites(repaint, 1U, frame) && !region_touches(repaint, sprite_at(0U)),
+          "age 3: repaints nothing older than the slot content");
+
+    /* The same slot again with nothing moved */
+    repaint = render(1U, frame);
+    check(0U == repaint->count, "age 1: unchanged frame repaints nothing");
+    frame++;
+
+    /* Slot 1 again after a move: only this frame's damage */
+    repaint = render(1U, frame);
+    check(region_covers(repaint, sprite_at(frame)) &&
+          region_covers(repaint, sprite_at(frame - 1U)) &&
+          !region_touches(repaint, sprite_at(frame - 2U)),
+          "age 1: repaints the old and new sprite only");
+    frame++;
+
+    /* Slot 0 was last drawn DAMAGE_HISTORY + 1 frames ago */
+    (void)render(1U, frame++);
+    repaint = render(0U, frame);
+    check(is_full_screen(repaint), "age beyond the history repaints the whole screen");
+    frame++;
+
+    repaint = render(SWAP_CHAIN_MAX_DEPTH, frame);
+    check(is_full_screen(repaint), "slot outside the swap chain repaints the whole screen");
+
+    damage_tracker_invalidate(&tracker);
+    repaint = render(0U, frame);
+    check(is_full_screen(repaint), "invalidate repaints the whole screen");
+
+    repaint = render(0U, frame);
+    check(0U == repaint->count, "unchanged frame after invalidate repaints nothing");
+
+    /* Too many items to compare: the frame damage is the whole screen */
+    damage_tracker_begin_frame(&tracker, 0U);
+    for (uint32_t i = 0U; i <= DAMAGE_MAX_ITEMS; i++)
+    {
+        damage_tracker_add_item(&tracker, i, &bar);
+    }
+    repaint = damage_tracker_end_frame(&tracker);
+    check(is_full_screen(repaint), "item overflow repaints the whole screen");
+
+    damage_tracker_get_stats(&tracker, &stats, true);
+    check((stats.frames == tracker.frame) && (stats.pixels_saved > 0U) &&
+          (stats.pixels_drawn + stats.pixels_saved ==
+           stats.frames * (uint32_t)(SCREEN_WIDTH * SCREEN_HEIGHT)),
+          "stats: drawn and saved pixels add up to full screens");
+}
+
+/*******************************************************************************
+* Function Name: main
+********************************************************************************
+* Summary:
+*  Runs the damage tracker checks.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  int - EXIT_SUCCESS if all checks pass
+*
+*******************************************************************************/
+int main(void)
+{
+    check_rects();
+    check_merging();
+    check_merge_cap();
+    check_buffer_age();
+
+    return check_summary();
+}
+
+/* [] END OF FILE */
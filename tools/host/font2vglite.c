@@ -0,0 +1,400 @@
+/*******************************************************************************
+* File Name        : font2vglite.c
+*
+* Description      : Host tool rasterizing a font into the glyph atlas of the text engine.
+*                    The printable ASCII characters are rendered with FreeType at one pixel
+*                    size into A8 cells, each the advance of its glyph wide and the line
+*                    height high. Cells are packed in rows of 32 code points in code point
+*                    order, so characters that follow each other in the code ("0123",
+*                    "ABC") are also neighbours in the atlas and drawn with one blit.
+*
+* Related Document : See README.md
+*
+********************************************************************************
+* Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+
+#include <ctype.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <ft2build.h>
+#include FT_FREETYPE_H
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+#define MAX_NAME_LENGTH                     (64U)
+#define MACRO_VALUE_COLUMN                  (44U)
+/* Printable ASCII */
+#define FIRST_CHAR                          (32U)
+#define LAST_CHAR                           (126U)
+#define GLYPH_COUNT                         (LAST_CHAR - FIRST_CHAR + 1U)
+/* Code points per atlas row */
+#define ROW_LENGTH                          (32U)
+#define DEFAULT_PIXEL_SIZE                  (16U)
+/* IMAGE_ASSET_STRIDE_ALIGN and IMAGE_ASSET_DATA_ALIGN of image_asset.h */
+#define STRIDE_ALIGN                        (64U)
+#define DATA_ALIGN                          (128U)
+
+/*******************************************************************************
+* Data Structures and Types
+*******************************************************************************/
+typedef struct {
+    uint32_t x;
+    uint32_t y;
+    uint32_t advance;
+    bool ink;
+} glyph_t;
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+static glyph_t glyphs[GLYPH_COUNT];
+
+
+/*******************************************************************************
+* Function Name: fail
+********************************************************************************
+* Summary:
+*  Reports an error and exits.
+*
+* Parameters:
+*  message  - Error
+*  detail   - Context of the error, may be NULL
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void fail(const char *message, const char *detail)
+{
+    fprintf(stderr, "font2vglite: %s%s%.60s\n", message, (NULL != detail) ? ": " : "",
+            (NULL != detail) ? detail : "");
+    exit(EXIT_FAILURE);
+}
+
+/*******************************************************************************
+* Function Name: macro_padding
+********************************************************************************
+* Summary:
+*  Returns the padding aligning the value of a generated macro.
+*
+* Parameters:
+*  prefix   - Start of the macro name
+*  suffix   - End of the macro name
+*
+* Return:
+*  int      - Number of spaces
+*
+*******************************************************************************/
+static int macro_padding(const char *prefix, const char *suffix)
+{
+    size_t used = strlen("#define ") + strlen(prefix) + strlen(suffix);
+
+    return (used < MACRO_VALUE_COLUMN) ? (int)(MACRO_VALUE_COLUMN - used) : 1;
+}
+
+/*******************************************************************************
+* Function Name: render_glyph
+********************************************************************************
+* Summary:
+*  Renders one character into its atlas cell. Pixels outside the cell, of
+*  glyphs overhanging their advance, are dropped.
+*
+* Parameters:
+*  face     - Font at the pixel size
+*  glyph    - Atlas cell of the character
+*  c        - Character
+*  ascent   - Baseline below the top of a cell
+*  height   - Line height
+*  atlas    - Atlas pixels
+*  stride   - Atlas row pitch in bytes
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void render_glyph(FT_Face face, glyph_t *glyph, uint32_t c, int32_t ascent,
+                         uint32_t height, uint8_t *atlas, uint32_t stride)
+{
+    FT_GlyphSlot slot;
+    char text[2] = { (char)c, '\0' };
+
+    if (0 != FT_Load_Char(face, c, FT_LOAD_RENDER))
+    {
+        fail("cannot render character", text);
+    }
+    slot = face->glyph;
+
+    for (uint32_t row = 0; row < slot->bitmap.rows; row++)
+    {
+        int32_t y = ascent - slot->bitmap_top + (int32_t)row;
+
+        if ((y < 0) || (y >= (int32_t)height))
+        {
+            continue;
+        }
+        for (uint32_t column = 0; column < slot->bitmap.width; column++)
+        {
+            int32_t x = slot->bitmap_left + (int32_t)column;
+            uint8_t coverage = slot->bitmap.buffer[(row * (uint32_t)slot->bitmap.pitch) + column];
+
+            if ((x < 0) || (x >= (int32_t)glyph->advance) || (0U == coverage))
+            {
+                continue;
+            }
+            atlas[((glyph->y + (uint32_t)y) * stride) + glyph->x + (uint32_t)x] = coverage;
+            glyph->ink = true;
+        }
+    }
+}
+
+/*******************************************************************************
+* Function Name: usage
+********************************************************************************
+* Summary:
+*  Prints the command line and exits.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void usage(void)
+{
+    fprintf(stderr,
+            "usage: font2vglite [-n name] [-s size] font.ttf > output.h\n"
+            "  -n name   prefix of the symbols, default: font\n"
+            "  -s size   pixel size, default: %u\n"
+            "Rasterizes the characters %u to %u into an A8 glyph atlas.\n",
+            DEFAULT_PIXEL_SIZE, FIRST_CHAR, LAST_CHAR);
+    exit(EXIT_FAILURE);
+}
+
+/*******************************************************************************
+* Function Name: main
+********************************************************************************
+* Summary:
+*  Rasterizes a font into one C header written to stdout. The atlas size is
+*  written to stderr.
+*
+* Parameters:
+*  argc - Number of arguments
+*  argv - Arguments
+*
+* Return:
+*  int  - 0 on success
+*
+*******************************************************************************/
+int main(int argc, char *argv[])
+{
+    const char *name = "font";
+    uint32_t pixel_size = DEFAULT_PIXEL_SIZE;
+    char upper[MAX_NAME_LENGTH];
+    FT_Library library;
+    FT_Face face;
+    int32_t ascent;
+    int32_t descent;
+    uint32_t height;
+    uint32_t width = 0U;
+    uint32_t stride;
+    uint32_t row_width = 0U;
+    uint8_t *atlas;
+    int c;
+
+    while (-1 != (c = getopt(argc, argv, "n:s:")))
+    {
+        switch (c)
+        {
+            case 'n':
+                name = optarg;
+                break;
+            case 's':
+                pixel_size = (uint32_t)strtoul(optarg, NULL, 0);
+                if ((0U == pixel_size) || (pixel_size > 64U))
+                {
+                    usage();
+                }
+                break;
+            default:
+                usage();
+                break;
+        }
+    }
+    if ((optind != (argc - 1)) || (strlen(name) >= MAX_NAME_LENGTH))
+    {
+        usage();
+    }
+
+    if ((0 != FT_Init_FreeType(&library)) || (0 != FT_New_Face(library, argv[optind], 0, &face)))
+    {
+        fail("cannot open font", argv[optind]);
+    }
+    if (0 != FT_Set_Pixel_Sizes(face, 0, pixel_size))
+    {
+        fail("font has no such size", argv[optind]);
+    }
+    /* 26.6 fixed point, rounded outwards */
+    ascent = (int32_t)((face->size->metrics.ascender + 63) >> 6);
+    descent = (int32_t)((-face->size->metrics.descender + 63) >> 6);
+    height = (uint32_t)(ascent + descent);
+
+    /* Cell placement, rows of ROW_LENGTH code points */
+    for (uint32_t i = 0; i < GLYPH_COUNT; i++)
+    {
+        char text[2] = { (char)(FIRST_CHAR + i), '\0' };
+
+        if (0 != FT_Load_Char(face, FIRST_CHAR + i, FT_LOAD_DEFAULT))
+        {
+            fail("cannot load character", text);
+        }
+        if (0U == ((FIRST_CHAR + i) % ROW_LENGTH))
+        {
+            row_width = 0U;
+        }
+        glyphs[i].x = row_width;
+        glyphs[i].y = (((FIRST_CHAR + i) / ROW_LENGTH) - (FIRST_CHAR / ROW_LENGTH)) * height;
+        glyphs[i].advance = (uint32_t)((face->glyph->advance.x + 32) >> 6);
+        if (glyphs[i].advance > UINT8_MAX)
+        {
+            fail("advance too large", text);
+        }
+        row_width += glyphs[i].advance;
+        width = (row_width > width) ? row_width : width;
+    }
+    stride = (width + STRIDE_ALIGN - 1U) & ~(STRIDE_ALIGN - 1U);
+    height = (height > UINT8_MAX) ? UINT8_MAX : height;
+
+    {
+        uint32_t atlas_height = glyphs[GLYPH_COUNT - 1U].y + height;
+
+        atlas = calloc((size_t)stride * atlas_height, 1U);
+        if (NULL == atlas)
+        {
+            fail("out of memory", NULL);
+        }
+        for (uint32_t i = 0; i < GLYPH_COUNT; i++)
+        {
+            render_glyph(face, &glyphs[i], FIRST_CHAR + i, ascent, height, atlas, stride);
+        }
+
+        for (size_t i = 0; name[i] != '\0'; i++)
+        {
+            upper[i] = (char)toupper((unsigned char)name[i]);
+            upper[i + 1U] = '\0';
+        }
+
+        printf("/*******************************************************************************\n"
+               "* Generated by tools/host/font2vglite from %s, %s %s at %u px,\n"
+               "* do not edit. The glyphs are subject to the license of the font.\n"
+               "* Defines the pixel data, include it in one source file only.\n"
+               "*******************************************************************************/\n\n"
+               "#ifndef %s_FONT_H\n#define %s_FONT_H\n\n"
+               "#if defined(__cplusplus)\nextern \"C\" {\n#endif\n\n"
+               "#include <stdint.h>\n#include \"text_engine.h\"\n\n"
+               "/*******************************************************************************\n"
+               "* Macros\n"
+               "*******************************************************************************/\n"
+               "#define %s_LINE_HEIGHT%*s(%uU)\n"
+               "#define %s_ASCENT%*s(%dU)\n\n"
+               "/*******************************************************************************\n"
+               "* Global Variables\n"
+               "*******************************************************************************/\n"
+               "/* Glyph atlas, %ux%u A8, stride %u, rows of %u code points */\n"
+               "CY_SECTION(\".cy_socmem_data\") uint8_t %s_pixels[] __attribute__((aligned(%u))) =\n{",
+               strrchr(argv[optind], '/') ? strrchr(argv[optind], '/') + 1 : argv[optind],
+               face->family_name, face->style_name, pixel_size, upper, upper,
+               upper, macro_padding(upper, "_LINE_HEIGHT"), "", height,
+               upper, macro_padding(upper, "_ASCENT"), "", ascent,
+               width, atlas_height, stride, ROW_LENGTH, name, DATA_ALIGN);
+        for (size_t b = 0; b < ((size_t)stride * atlas_height); b++)
+        {
+            printf("%s0x%02X,", (0U == (b % 16U)) ? "\n    " : " ", atlas[b]);
+        }
+        printf("\n};\n\n"
+               "const image_asset_t %s_atlas =\n"
+               "{\n"
+               "    .name          = \"%s\",\n"
+               "    .format        = VG_LITE_A8,\n"
+               "    .width         = %u,\n"
+               "    .height        = %u,\n"
+               "    .stride        = %u,\n"
+               "    .data          = %s_pixels,\n"
+               "    .clut          = NULL,\n"
+               "    .clut_count    = 0U,\n"
+               "    .tint          = 0xFF000000U,\n"
+               "    .premultiplied = false,\n"
+               "    .next_level    = NULL\n"
+               "};\n\n"
+               "/* Cells of the characters %u to %u: x, y, advance, ink */\n"
+               "const font_glyph_t %s_glyphs[%uU] =\n{\n",
+               name, name, width, atlas_height, stride, name, FIRST_CHAR, LAST_CHAR,
+               name, GLYPH_COUNT);
+        for (uint32_t i = 0; i < GLYPH_COUNT; i++)
+        {
+            uint32_t code = FIRST_CHAR + i;
+
+            printf("    { %3u, %3u, %2u, %-5s },  /* %c */\n", glyphs[i].x, glyphs[i].y,
+                   glyphs[i].advance, glyphs[i].ink ? "true" : "false", (char)code);
+        }
+        printf("};\n\n"
+               "const font_asset_t %s_font =\n"
+               "{\n"
+               "    .name        = \"%s\",\n"
+               "    .atlas       = &%s_atlas,\n"
+               "    .glyphs      = %s_glyphs,\n"
+               "    .first_char  = %uU,\n"
+               "    .glyph_count = %uU,\n"
+               "    .line_height = %uU,\n"
+               "    .ascent      = %dU\n"
+               "};\n\n"
+               "#if defined(__cplusplus)\n}\n#endif\n\n#endif /* %s_FONT_H */\n\n"
+               "/* [] END OF FILE */\n",
+               name, name, name, name, FIRST_CHAR, GLYPH_COUNT, height, ascent, upper);
+
+        fprintf(stderr, "%s %s %u px: %ux%u atlas, %u bytes\n", face->family_name,
+                face->style_name, pixel_size, width, atlas_height, stride * atlas_height);
+        free(atlas);
+    }
+
+    FT_Done_Face(face);
+    FT_Done_FreeType(library);
+
+    return EXIT_SUCCESS;
+}
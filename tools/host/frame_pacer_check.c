@@ -0,0 +1,364 @@
+/*******************************************************************************
+* File Name        : frame_pacer_check.c
+*
+* Description      : Host check of the frame pacer against synthetic refresh timestamps:
+*                    frames per refresh of each target, wake-up times, missed deadlines,
+*                    jittered and missed refresh interrupts.
+*
+* Related Document : See README.md
+*
+********************************************************************************
+* Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "frame_pacer.h"
+#include "host_check.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* 60 Hz refresh, one cycle is one nanosecond. The simulated time stays
+ * below the 4.29 s wrap of the 32-bit timestamps. */
+#define VSYNC_PERIOD                        (16666667U)
+#define SIM_REFRESHES                       (240U)
+/* Frame counts may differ by the frames rendered unpaced before the first
+ * refresh interrupt and the one in progress at the end */
+#define FRAME_TOLERANCE                     (4U)
+
+/*******************************************************************************
+* Data Structures and Types
+*******************************************************************************/
+typedef struct {
+    uint32_t period;            /* Actual refresh period */
+    uint32_t jitter;            /* Largest offset of an interrupt timestamp */
+    uint32_t drop_every;        /* Every n-th interrupt is lost, 0 for none */
+    uint32_t render;            /* Render time of a frame */
+} sim_display_t;
+
+typedef struct {
+    uint32_t frames;
+    uint32_t missed;
+    uint32_t max_wake_error;    /* Distance of a wake-up from a refresh */
+    uint32_t period_estimate;
+} sim_result_t;
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+static frame_pacer_t pacer;
+static uint32_t random_state;
+
+
+/*******************************************************************************
+* Function Name: jitter_offset
+********************************************************************************
+* Summary:
+*  Returns a repeatable pseudo random offset within +-jitter.
+*
+* Parameters:
+*  jitter  - Largest offset
+*
+* Return:
+*  int32_t - Offset
+*
+*******************************************************************************/
+static int32_t jitter_offset(uint32_t jitter)
+{
+    random_state = (random_state * 1103515245U) + 12345U;
+
+    return (0U == jitter) ? 0 :
+           (int32_t)((random_state >> 8) % ((2U * jitter) + 1U)) - (int32_t)jitter;
+}
+
+/*******************************************************************************
+* Function Name: simulate
+********************************************************************************
+* Summary:
+*  Runs a render task paced by the frame pacer for SIM_REFRESHES refreshes.
+*  The refresh interrupts are delivered with their timestamps as time
+*  passes, the render task sleeps for the time the pacer returns.
+*
+* Parameters:
+*  target  - Pacing target
+*  display - Simulated display and render timing
+*  result  - Output of the run
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void simulate(frame_pacer_target_t target, const sim_display_t *display,
+                     sim_result_t *result)
+{
+    frame_pacer_stats_t stats;
+    uint32_t vsync_times[SIM_REFRESHES + 1U];
+    uint32_t next = 0U;
+    uint32_t now = display->period / 3U;
+    uint32_t done;
+    uint32_t sleep;
+    uint32_t error;
+    uint32_t end = SIM_REFRESHES * display->period;
+
+    random_state = 1U;
+    for (uint32_t i = 0U; i <= SIM_REFRESHES; i++)
+    {
+        vsync_times[i] = ((i + 1U) * display->period) + (uint32_t)jitter_offset(display->jitter);
+    }
+
+    frame_pacer_init(&pacer, target, VSYNC_PERIOD);
+    result->max_wake_error = 0U;
+
+    while (now < end)
+    {
+        done = now + display->render;
+        while ((next < SIM_REFRESHES) && ((int32_t)(done - vsync_times[next]) >= 0))
+        {
+            if ((0U == display->drop_every) || (0U != ((next + 1U) % display->drop_every)))
+            {
+                frame_pacer_on_vsync(&pacer, vsync_times[next]);
+            }
+            next++;
+        }
+
+        sleep = frame_pacer_frame_done(&pacer, done);
+        now = done + sleep;
+
+        if ((sleep > 0U) && (next > 0U))
+        {
+            /* Wake-ups are meant to land on a refresh */
+            error = (uint32_t)abs((int32_t)(now - vsync_times[next]));
+            if (error > result->max_wake_error)
+            {
+                result->max_wake_error = error;
+            }
+        }
+    }
+
+    frame_pacer_get_stats(&pacer, &stats, false);
+    result->frames          = stats.frames;
+    result->missed          = stats.missed_deadlines;
+    result->period_estimate = pacer.period_cycles;
+}
+
+/*******************************************************************************
+* Function Name: close_to
+********************************************************************************
+* Summary:
+*  Tells whether a count is within a tolerance of the expected one.
+*
+* Parameters:
+*  value     - Count
+*  expected  - Expected count
+*  tolerance - Allowed difference
+*
+* Return:
+*  bool      - true if within the tolerance
+*
+*******************************************************************************/
+static bool close_to(uint32_t value, uint32_t expected, uint32_t tolerance)
+{
+    return (value + tolerance >= expected) && (value <= expected + tolerance);
+}
+
+/*******************************************************************************
+* Function Name: check_targets
+********************************************************************************
+* Summary:
+*  Checks the frame rate of each target with regular refreshes.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void check_targets(void)
+{
+    const sim_display_t display = { VSYNC_PERIOD, 0U, 0U, VSYNC_PERIOD / 4U };
+    sim_result_t result;
+
+    simulate(FRAME_PACER_UNLIMITED, &display, &result);
+    check(close_to(result.frames, SIM_REFRESHES * 4U, FRAME_TOLERANCE) &&
+          (0U == result.missed),
+          "unlimited: never sleeps");
+
+    simulate(FRAME_PACER_NATIVE, &display, &result);
+    check(close_to(result.frames, SIM_REFRESHES, FRAME_TOLERANCE),
+          "native: one frame per refresh");
+    check((0U == result.missed) && (result.max_wake_error <= 1U),
+          "native: wakes at the refresh, no deadline missed");
+
+    simulate(FRAME_PACER_HALF, &display, &result);
+    check(close_to(result.frames, SIM_REFRESHES / 2U, FRAME_TOLERANCE) &&
+          (0U == result.missed),
+          "1/2: one frame every second refresh");
+
+    simulate(FRAME_PACER_THIRD, &display, &result);
+    check(close_to(result.frames, SIM_REFRESHES / 3U, FRAME_TOLERANCE) &&
+          (0U == result.missed),
+          "1/3: one frame every third refresh");
+    check(result.period_estimate == VSYNC_PERIOD, "period estimate of regular refreshes");
+}
+
+/*******************************************************************************
+* Function Name: check_slow_frames
+********************************************************************************
+* Summary:
+*  Checks frames that take longer than their refresh.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void check_slow_frames(void)
+{
+    const sim_display_t slow = { VSYNC_PERIOD, 0U, 0U, (VSYNC_PERIOD * 5U) / 4U };
+    const sim_display_t half_slow = { VSYNC_PERIOD, 0U, 0U, (VSYNC_PERIOD * 3U) / 2U };
+    sim_result_t result;
+
+    /* Every frame misses its refresh; the next one starts right away */
+    simulate(FRAME_PACER_NATIVE, &slow, &result);
+    check((result.missed + 1U >= result.frames) &&
+          close_to(result.frames, (SIM_REFRESHES * 4U) / 5U, FRAME_TOLERANCE),
+          "native: slow frames missed, not delayed further");
+
+    /* 1.5 refreshes fit in the two of the 1/2 target */
+    simulate(FRAME_PACER_HALF, &half_slow, &result);
+    check((0U == result.missed) &&
+          close_to(result.frames, SIM_REFRESHES / 2U, FRAME_TOLERANCE),
+          "1/2: frames longer than a refresh are paced");
+}
+
+/*******************************************************************************
+* Function Name: check_jitter
+********************************************************************************
+* Summary:
+*  Checks pacing with jittered, lost and off-nominal refresh interrupts.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void check_jitter(void)
+{
+    const sim_display_t jittered = { VSYNC_PERIOD, VSYNC_PERIOD / 50U, 0U, VSYNC_PERIOD / 4U };
+    const sim_display_t dropped = { VSYNC_PERIOD, 0U, 7U, VSYNC_PERIOD / 4U };
+    const sim_display_t fast = { (VSYNC_PERIOD * 96U) / 100U, 0U, 0U, VSYNC_PERIOD / 4U };
+    sim_result_t result;
+
+    /* Timestamps 2% of a period early or late */
+    simulate(FRAME_PACER_NATIVE, &jittered, &result);
+    check(close_to(result.frames, SIM_REFRESHES, FRAME_TOLERANCE) && (0U == result.missed),
+          "jitter: one frame per refresh");
+    check(result.max_wake_error <= (3U * jittered.jitter),
+          "jitter: wake-ups within the jitter of the refresh");
+    check(close_to(result.period_estimate, VSYNC_PERIOD, VSYNC_PERIOD / 100U),
+          "jitter: period estimate within 1%");
+
+    /* Every seventh interrupt lost: the refresh count still advances */
+    simulate(FRAME_PACER_NATIVE, &dropped, &result);
+    check(close_to(result.frames, SIM_REFRESHES, FRAME_TOLERANCE) && (0U == result.missed),
+          "lost interrupts: one frame per refresh");
+    check(result.period_estimate == VSYNC_PERIOD, "lost interrupts: period estimate kept");
+
+    /* Refresh 4% faster than nominal: the estimate follows it */
+    simulate(FRAME_PACER_NATIVE, &fast, &result);
+    check(close_to(result.period_estimate, fast.period, fast.period / 1000U),
+          "off-nominal refresh: period estimate follows");
+    check(close_to(result.frames, SIM_REFRESHES, FRAME_TOLERANCE) && (result.missed <= 1U),
+          "off-nominal refresh: one frame per refresh");
+}
+
+/*******************************************************************************
+* Function Name: check_target_change
+********************************************************************************
+* Summary:
+*  Checks the first decisions of the pacer and a target change.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void check_target_change(void)
+{
+    frame_pacer_init(&pacer, FRAME_PACER_NATIVE, VSYNC_PERIOD);
+    check(0U == frame_pacer_frame_done(&pacer, 1000U), "no sleep before the first refresh");
+
+    frame_pacer_on_vsync(&pacer, VSYNC_PERIOD);
+    check((VSYNC_PERIOD - 1000U) ==
+          frame_pacer_frame_done(&pacer, (2U * VSYNC_PERIOD) - (VSYNC_PERIOD - 1000U)),
+          "first frame sleeps until the next refresh");
+
+    frame_pacer_set_target(&pacer, FRAME_PACER_THIRD);
+    check(!pacer.synced, "target change restarts the pacing");
+    frame_pacer_set_target(&pacer, FRAME_PACER_TARGET_MAX);
+    check(FRAME_PACER_THIRD == pacer.target, "invalid target ignored");
+}
+
+
+/*******************************************************************************
+* Function Name: main
+********************************************************************************
+* Summary:
+*  Runs the frame pacer checks.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  int - 0 if all checks passed
+*
+*******************************************************************************/
+int main(void)
+{
+    check_targets();
+    check_slow_frames();
+    check_jitter();
+    check_target_change();
+
+    return check_summary();
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,271 @@
+/*******************************************************************************
+* File Name        : frame_stats_check.c
+*
+* Description      : Host check of the frame time statistics: accuracy of the log-linear
+*                    buckets over the whole range, percentiles, jitter, missed refreshes
+*                    per pacing target, demo switches and resets.
+*
+* Related Document : See README.md
+*
+********************************************************************************
+* Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include "frame_stats.h"
+#include "host_check.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* On the host one cycle is one nanosecond */
+#define NS_PER_US                           (1000U)
+#define REFRESH_NS                          (16666667U)
+#define FRAME_US                            (16667U)
+/* Half the relative bucket width, the error of a reported value */
+#define MAX_ERROR_SHARE                     (32U)
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+static frame_stats_t stats;
+
+
+/*******************************************************************************
+* Function Name: close_to
+********************************************************************************
+* Summary:
+*  Tells whether a reported duration is within the bucket error of the
+*  expected one.
+*
+* Parameters:
+*  value    - Reported duration
+*  expected - Recorded duration
+*
+* Return:
+*  bool     - true if close enough
+*
+*******************************************************************************/
+static bool close_to(uint32_t value, uint32_t expected)
+{
+    uint32_t error = (value > expected) ? (value - expected) : (expected - value);
+
+    return error <= ((expected / MAX_ERROR_SHARE) + 1U);
+}
+
+/*******************************************************************************
+* Function Name: check_histogram
+********************************************************************************
+* Summary:
+*  Checks the bucket error over the whole range and the percentiles of
+*  typical frame time distributions.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void check_histogram(void)
+{
+    static frame_histogram_t histogram;
+    frame_stats_report_t report;
+    bool accurate = true;
+
+    frame_histogram_reset(&histogram);
+    frame_histogram_report(&histogram, &report);
+    check((0U == report.frames) && (0U == report.p50_us) && (0U == report.max_us),
+          "Empty histogram reports zeros");
+
+    /* The median of 0, us and a long frame is the bucket of us */
+    for (uint32_t us = 1U; us < (1UL << FRAME_STATS_RANGE_BITS); us += 1U + (us / 7U))
+    {
+        frame_histogram_reset(&histogram);
+        frame_histogram_add(&histogram, 0U);
+        frame_histogram_add(&histogram, us);
+        frame_histogram_add(&histogram, 1UL << (FRAME_STATS_RANGE_BITS + 1U));
+        accurate = accurate && close_to(frame_histogram_percentile(&histogram, 500U), us);
+    }
+    check(accurate, "Every duration reported within 1/32");
+
+    frame_histogram_reset(&histogram);
+    for (uint32_t i = 0; i < 1000U; i++)
+    {
+        frame_histogram_add(&histogram, 10000U + (i * 10U));
+    }
+    frame_histogram_report(&histogram, &report);
+    check(close_to(report.p50_us, 15000U) && close_to(report.p95_us, 19500U) &&
+          close_to(report.p99_us, 19900U) && (19990U == report.max_us),
+          "Percentiles of a uniform distribution");
+
+    frame_histogram_reset(&histogram);
+    for (uint32_t i = 0; i < 1000U; i++)
+    {
+        frame_histogram_add(&histogram, (i < 980U) ? FRAME_US : (2U * FRAME_US));
+    }
+    frame_histogram_report(&histogram, &report);
+    check(close_to(report.p50_us, FRAME_US) && close_to(report.p95_us, FRAME_US) &&
+          (report.p99_us == (2U * FRAME_US)), "Stutter of 2% shows in p99 only");
+    check(frame_histogram_percentile(&histogram, 1000U) == report.max_us,
+          "p100 is the longest frame");
+
+    frame_histogram_add(&histogram, 5000000U);
+    check(5000000U == frame_histogram_percentile(&histogram, 1000U),
+          "Frames beyond the range keep their exact maximum");
+}
+
+/*******************************************************************************
+* Function Name: run_frames
+********************************************************************************
+* Summary:
+*  Records frames completing at the given durations.
+*
+* Parameters:
+*  now_ns    - Completion time of the previous frame, advanced
+*  durations - Frame durations in microseconds
+*  count     - Number of frames
+*  target    - Refreshes per frame
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void run_frames(uint32_t *now_ns, const uint32_t *durations, uint32_t count,
+                       uint32_t target)
+{
+    for (uint32_t i = 0; i < count; i++)
+    {
+        *now_ns += durations[i] * NS_PER_US;
+        frame_stats_frame(&stats, *now_ns, REFRESH_NS, target);
+    }
+}
+
+/*******************************************************************************
+* Function Name: check_frames
+********************************************************************************
+* Summary:
+*  Checks the recording of frames: jitter, missed refreshes for each pacing
+*  target, the window of the FPS line, demo switches and resets.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void check_frames(void)
+{
+    static const uint32_t stutter[] = { FRAME_US, FRAME_US, 2U * FRAME_US, FRAME_US };
+    static const uint32_t half[] = { 2U * FRAME_US, 2U * FRAME_US, 3U * FRAME_US };
+    frame_stats_report_t report;
+    uint32_t now_ns = 0U;
+
+    frame_stats_init(&stats);
+    frame_stats_set_demo(&stats, 2U);
+    frame_stats_frame(&stats, now_ns, REFRESH_NS, 1U);
+    frame_stats_get_demo(&stats, 2U, &report);
+    check(0U == report.frames, "First frame of a demo starts the interval");
+
+    run_frames(&now_ns, stutter, 4U, 1U);
+    frame_stats_get_demo(&stats, 2U, &report);
+    check((4U == report.frames) && ((2U * FRAME_US) == report.max_us) && (1U == report.missed_vsyncs),
+          "Doubled frame misses one refresh");
+    check((FRAME_US * 2U / 3U == report.jitter_us) && (FRAME_US == report.jitter_max_us),
+          "Jitter between consecutive frames");
+
+    frame_stats_get_window(&stats, &report, true);
+    check((4U == report.frames) && (1U == report.missed_vsyncs), "Window holds the same frames");
+    frame_stats_get_window(&stats, &report, false);
+    check(0U == report.frames, "Window restarted");
+
+    frame_stats_set_demo(&stats, 3U);
+    now_ns += 1000000000U;
+    frame_stats_frame(&stats, now_ns, REFRESH_NS, 2U);
+    run_frames(&now_ns, half, 3U, 2U);
+    frame_stats_get_demo(&stats, 3U, &report);
+    check((3U == report.frames) && (1U == report.missed_vsyncs),
+          "Switch not recorded, half rate frames miss only beyond two refreshes");
+    frame_stats_get_demo(&stats, 2U, &report);
+    check(4U == report.frames, "Other demos keep their frames");
+
+    run_frames(&now_ns, stutter, 2U, 0U);
+    frame_stats_get_demo(&stats, 3U, &report);
+    check((5U == report.frames) && (1U == report.missed_vsyncs),
+          "Unlimited rate expects one refresh per frame");
+
+    frame_stats_set_demo(&stats, 200U);
+    frame_stats_frame(&stats, now_ns, REFRESH_NS, 1U);
+    run_frames(&now_ns, stutter, 1U, 1U);
+    frame_stats_get_demo(&stats, FRAME_STATS_MAX_DEMOS - 1U, &report);
+    check(1U == report.frames, "Unknown demos share the last histogram");
+
+    frame_stats_reset(&stats);
+    frame_stats_get_demo(&stats, 2U, &report);
+    check(4U == report.frames, "Reset waits for the next frame");
+    run_frames(&now_ns, stutter, 2U, 1U);
+    frame_stats_get_demo(&stats, 2U, &report);
+    check(0U == report.frames, "Reset empties every demo");
+    frame_stats_get_demo(&stats, FRAME_STATS_MAX_DEMOS - 1U, &report);
+    check(1U == report.frames, "Frame after a reset starts a new interval");
+}
+
+/*******************************************************************************
+* Function Name: main
+********************************************************************************
+* Summary:
+*  Runs the frame statistics checks.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  int - 0 if all checks passed
+*
+*******************************************************************************/
+int main(void)
+{
+    const char *const names[] = { "Default", "Fill rules", "Alpha behavior",
+                                  "Blit color", "Pattern fill", "UI filter" };
+
+    check_histogram();
+    check_frames();
+    frame_stats_print(&stats, names, (uint8_t)(sizeof(names) / sizeof(names[0])));
+
+    return check_summary();
+}
+
+/* [] END OF FILE */
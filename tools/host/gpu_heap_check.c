@@ -0,0 +1,220 @@
+/*******************************************************************************
+* File Name        : gpu_heap_check.c
+*
+* Description      : Host check of the VGLite heap accounting: live blocks by tag,
+*                    peak, largest free block and fragmentation, on synthetic blocks
+*                    and on buffers and paths allocated from the stand-in heap.
+*
+* Related Document : See README.md
+*
+********************************************************************************
+* Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "gpu_heap.h"
+#include "path_cache.h"
+#include "vg_lite_stub.h"
+#include "host_check.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+#define ARENA_SIZE                          (4096U)
+#define FRAME_COUNT                         (3U)
+#define FRAME_WIDTH                         (128)
+#define FRAME_HEIGHT                        (100)
+#define FRAME_BYTES                         (FRAME_WIDTH * FRAME_HEIGHT * 2U)
+#define FRAME_ALIGN                         (128U)
+#define DRIVER_BYTES                        (256U * 64U * 2U)
+#define PATH_BYTES                          (200U)
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+static uint8_t arena[ARENA_SIZE];
+static uint8_t path_data[PATH_BYTES];
+static vg_lite_path_t path = { .format = VG_LITE_S8, .path_length = PATH_BYTES,
+                               .path = path_data, .path_changed = 1 };
+static gpu_heap_t heap;
+static path_cache_t cache;
+
+
+/*******************************************************************************
+* Function Name: check_accounting
+********************************************************************************
+* Summary:
+*  Records and forgets blocks at known offsets of a local arena.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void check_accounting(void)
+{
+    gpu_heap_stats_t stats;
+
+    gpu_heap_init(&heap, arena, ARENA_SIZE);
+    check(gpu_heap_record(&heap, &arena[1024], 512U, GPU_HEAP_TAG_FRAME_BUFFER),
+          "block recorded");
+    check(gpu_heap_record(&heap, &arena[2048], 512U, GPU_HEAP_TAG_PATH), "second block recorded");
+    check(!gpu_heap_record(&heap, &arena[1280], 64U, GPU_HEAP_TAG_PATH), "overlap rejected");
+    check(!gpu_heap_record(&heap, &arena[ARENA_SIZE - 16U], 64U, GPU_HEAP_TAG_OTHER),
+          "block past the end rejected");
+
+    /* [0, 1024) driver, [1536, 2048) and [2560, 4096) free */
+    gpu_heap_get_stats(&heap, &stats, false);
+    check((3U == stats.blocks) && (1024U == stats.tag_bytes[GPU_HEAP_TAG_DRIVER]),
+          "space below the first block recorded as the driver's");
+    check((2048U == stats.used_bytes) && (2048U == stats.free_bytes), "used and free bytes");
+    check(1536U == stats.largest_free, "largest free block");
+    check(25U == stats.fragmentation, "fragmentation");
+    check(2U == stats.untracked, "rejected blocks counted");
+
+    check(gpu_heap_forget(&heap, &arena[1024]), "block forgotten");
+    check(!gpu_heap_forget(&heap, &arena[1024]), "unknown block not forgotten");
+    gpu_heap_get_stats(&heap, &stats, true);
+    check((1536U == stats.used_bytes) && (2048U == stats.peak_bytes), "peak kept after a free");
+    check((1536U == stats.largest_free) && (40U == stats.fragmentation),
+          "fragmentation after a free");
+    check((0U == stats.tag_blocks[GPU_HEAP_TAG_FRAME_BUFFER]) &&
+          (1U == stats.tag_blocks[GPU_HEAP_TAG_PATH]), "blocks per tag");
+    gpu_heap_get_stats(&heap, &stats, false);
+    check(0U == stats.untracked, "counters reset");
+}
+
+/*******************************************************************************
+* Function Name: check_allocations
+********************************************************************************
+* Summary:
+*  Allocates buffers and paths from the stand-in heap through the wrappers.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void check_allocations(void)
+{
+    vg_lite_buffer_t driver = { .width = 256, .height = 64, .format = VG_LITE_BGR565 };
+    vg_lite_buffer_t frames[FRAME_COUNT];
+    vg_lite_buffer_t huge = { .width = 4096, .height = 4096, .format = VG_LITE_ARGB8888 };
+    gpu_heap_stats_t stats;
+    void *hole;
+
+    gpu_heap_init(&heap, vg_lite_stub_heap_base(), VG_LITE_STUB_HEAP_SIZE);
+
+    /* Allocated by the driver before the application */
+    check(VG_LITE_SUCCESS == vg_lite_allocate(&driver), "driver buffer allocated");
+
+    for (uint32_t i = 0U; i < FRAME_COUNT; i++)
+    {
+        frames[i] = (vg_lite_buffer_t){ .width = FRAME_WIDTH, .height = FRAME_HEIGHT,
+                                        .format = VG_LITE_BGR565 };
+        check(VG_LITE_SUCCESS == gpu_heap_allocate(&heap, &frames[i], FRAME_ALIGN,
+                                                   GPU_HEAP_TAG_FRAME_BUFFER),
+              "frame buffer allocated");
+    }
+    path_cache_init(&cache, 1024U);
+    path_cache_set_heap(&cache, &heap);
+    check(path_cache_register(&cache, &path), "path uploaded");
+
+    gpu_heap_get_stats(&heap, &stats, false);
+    check(DRIVER_BYTES == stats.tag_bytes[GPU_HEAP_TAG_DRIVER], "driver block inferred");
+    check((FRAME_COUNT == stats.tag_blocks[GPU_HEAP_TAG_FRAME_BUFFER]) &&
+          ((FRAME_COUNT * FRAME_BYTES) == stats.tag_bytes[GPU_HEAP_TAG_FRAME_BUFFER]),
+          "frame buffers by tag");
+    check((1U == stats.tag_blocks[GPU_HEAP_TAG_PATH]) &&
+          (path.uploaded.bytes == stats.tag_bytes[GPU_HEAP_TAG_PATH]), "uploaded path by tag");
+
+    /* Freeing the middle buffer leaves a hole in front of the path */
+    hole = frames[1].memory;
+    check(VG_LITE_SUCCESS == gpu_heap_free(&heap, &frames[1]), "frame buffer freed");
+    gpu_heap_get_stats(&heap, &stats, false);
+    check((2U == stats.tag_blocks[GPU_HEAP_TAG_FRAME_BUFFER]) &&
+          (stats.largest_free < stats.free_bytes),
+          "free leaves a fragmented heap");
+    check(stats.peak_bytes == (stats.used_bytes + FRAME_BYTES), "peak kept");
+
+    check(VG_LITE_OUT_OF_MEMORY == gpu_heap_allocate(&heap, &huge, 0U, GPU_HEAP_TAG_OTHER),
+          "oversized buffer fails");
+    check(VG_LITE_SUCCESS == gpu_heap_allocate(&heap, &frames[1], FRAME_ALIGN,
+                                               GPU_HEAP_TAG_FRAME_BUFFER),
+          "frame buffer allocated again");
+    check(hole == frames[1].memory, "hole reused first fit");
+
+    path_cache_release(&cache);
+    gpu_heap_get_stats(&heap, &stats, true);
+    check(0U == stats.tag_blocks[GPU_HEAP_TAG_PATH], "released path forgotten");
+    check((1U == stats.failures) && (0U == stats.untracked), "failure counted");
+    gpu_heap_report(&heap);
+    gpu_heap_dump(&heap);
+
+    for (uint32_t i = 0U; i < FRAME_COUNT; i++)
+    {
+        (void)gpu_heap_free(&heap, &frames[i]);
+    }
+    (void)vg_lite_free(&driver);
+    gpu_heap_get_stats(&heap, &stats, false);
+    check((DRIVER_BYTES == stats.used_bytes) && (1U == stats.blocks),
+          "only the inferred driver block left");
+}
+
+/*******************************************************************************
+* Function Name: main
+********************************************************************************
+* Summary:
+*  Runs the heap accounting checks.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  int - 0 if all checks passed
+*
+*******************************************************************************/
+int main(void)
+{
+    check_accounting();
+    check_allocations();
+
+    return check_summary();
+}
+
+/* [] END OF FILE */
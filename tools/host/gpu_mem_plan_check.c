@@ -0,0 +1,223 @@
+/*******************************************************************************
+* File Name        : gpu_mem_plan_check.c
+*
+* Description      : Host check of the VGLite heap plan: allocates the planned
+*                    buffers from the stand-in heap in the order of the application
+*                    and checks that each lands at its planned offset. Prints the
+*                    memory map; 'make plan DEFINES=...' evaluates other settings.
+*
+* Related Document : See README.md
+*
+********************************************************************************
+* Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "gpu_mem_plan.h"
+#include "vg_lite_stub.h"
+#include "host_check.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+
+/* The driver buffers are allocated as 8 bit buffers of this width */
+#define DRIVER_BUFFER_WIDTH                 (1024)
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+static gpu_heap_t heap;
+static gpu_heap_t overrun_heap;
+static vg_lite_buffer_t cmd_buffers[GPU_CMD_BUFFER_COUNT];
+static vg_lite_buffer_t tess_buffer;
+static vg_lite_buffer_t frame_buffers[APP_BUFFER_COUNT];
+static vg_lite_buffer_t intermediate_buffer;
+
+
+/*******************************************************************************
+* Function Name: offset_of
+********************************************************************************
+* Summary:
+*  Returns the offset of an allocated buffer in the stand-in heap.
+*
+* Parameters:
+*  buffer - Allocated buffer
+*
+* Return:
+*  uint32_t - Offset in bytes
+*
+*******************************************************************************/
+static uint32_t offset_of(const vg_lite_buffer_t *buffer)
+{
+    return (uint32_t)((const uint8_t *)buffer->memory - vg_lite_stub_heap_base());
+}
+
+/*******************************************************************************
+* Function Name: allocate_driver_buffer
+********************************************************************************
+* Summary:
+*  Stands in for a buffer vg_lite_init() allocates.
+*
+* Parameters:
+*  buffer - Buffer to allocate
+*  bytes  - Size of the buffer, a multiple of DRIVER_BUFFER_WIDTH
+*
+* Return:
+*  bool   - true if the allocation succeeded
+*
+*******************************************************************************/
+static bool allocate_driver_buffer(vg_lite_buffer_t *buffer, uint32_t bytes)
+{
+    buffer->width  = DRIVER_BUFFER_WIDTH;
+    buffer->height = (vg_lite_int32_t)(bytes / DRIVER_BUFFER_WIDTH);
+    buffer->format = VG_LITE_A8;
+
+    return VG_LITE_SUCCESS == vg_lite_allocate_with_align(buffer, GPU_PLAN_BLOCK_ALIGN);
+}
+
+/*******************************************************************************
+* Function Name: driver_overrun_fits
+********************************************************************************
+* Summary:
+*  Records the application buffers as a driver that takes more memory than
+*  planned would place them, and verifies the result against the plan.
+*
+* Parameters:
+*  overrun - Bytes the driver takes beyond its planned region
+*
+* Return:
+*  bool    - Result of gpu_mem_plan_verify()
+*
+*******************************************************************************/
+static bool driver_overrun_fits(uint32_t overrun)
+{
+    const uint8_t *base = vg_lite_stub_heap_base();
+    uint32_t offset = GPU_PLAN_FRAME_OFFSET + overrun;
+
+    gpu_heap_init(&overrun_heap, base, VGLITE_HEAP_SIZE);
+    for (uint32_t i = 0U; i < APP_BUFFER_COUNT; i++)
+    {
+        (void)gpu_heap_record(&overrun_heap, base + offset, GPU_PLAN_FRAME_BYTES,
+                              GPU_HEAP_TAG_FRAME_BUFFER);
+        offset += GPU_PLAN_FRAME_BYTES;
+    }
+    (void)gpu_heap_record(&overrun_heap, base + offset, GPU_PLAN_INTERMEDIATE_BYTES,
+                          GPU_HEAP_TAG_INTERMEDIATE);
+
+    return gpu_mem_plan_verify(&overrun_heap);
+}
+
+/*******************************************************************************
+* Function Name: main
+********************************************************************************
+* Summary:
+*  Runs the heap plan checks.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  int - 0 if all checks passed
+*
+*******************************************************************************/
+int main(void)
+{
+    gpu_heap_stats_t stats;
+    bool placed = true;
+
+    check(VGLITE_HEAP_SIZE <= VG_LITE_STUB_HEAP_SIZE, "plan fits in the stand-in heap");
+    if (VGLITE_HEAP_SIZE > VG_LITE_STUB_HEAP_SIZE)
+    {
+        return EXIT_FAILURE;
+    }
+    gpu_heap_init(&heap, vg_lite_stub_heap_base(), VGLITE_HEAP_SIZE);
+
+    /* vg_lite_init() */
+    for (uint32_t i = 0U; i < GPU_CMD_BUFFER_COUNT; i++)
+    {
+        placed = placed && allocate_driver_buffer(&cmd_buffers[i], GPU_CMD_BUFFER_SIZE);
+    }
+    placed = placed && allocate_driver_buffer(&tess_buffer, GPU_TESSELLATION_BUFFER_SIZE);
+    check(placed && (GPU_PLAN_TESS_OFFSET == offset_of(&tess_buffer)),
+          "driver buffers at their planned offsets");
+
+    /* Buffers of main() */
+    placed = true;
+    for (uint32_t i = 0U; i < APP_BUFFER_COUNT; i++)
+    {
+        frame_buffers[i].width  = DISP_W_ACTUAL;
+        frame_buffers[i].height = DISP_H;
+        frame_buffers[i].format = FRAME_BUFFER_FORMAT;
+        placed = placed &&
+                 (VG_LITE_SUCCESS == gpu_heap_allocate(&heap, &frame_buffers[i],
+                                                       GPU_PLAN_BLOCK_ALIGN,
+                                                       GPU_HEAP_TAG_FRAME_BUFFER)) &&
+                 ((GPU_PLAN_FRAME_OFFSET + (i * GPU_PLAN_FRAME_BYTES)) ==
+                  offset_of(&frame_buffers[i])) &&
+                 ((uint32_t)frame_buffers[i].stride <= GPU_PLAN_FRAME_STRIDE);
+    }
+    check(placed, "frame buffers at their planned offsets");
+
+    intermediate_buffer.width  = INTERMEDIATE_WIDTH;
+    intermediate_buffer.height = INTERMEDIATE_HEIGHT;
+    intermediate_buffer.format = INTERMEDIATE_FORMAT;
+    check((VG_LITE_SUCCESS == gpu_heap_allocate(&heap, &intermediate_buffer, 0U,
+                                                GPU_HEAP_TAG_INTERMEDIATE)) &&
+          (GPU_PLAN_INTERMEDIATE_OFFSET == offset_of(&intermediate_buffer)),
+          "intermediate target at its planned offset");
+
+    gpu_heap_get_stats(&heap, &stats, false);
+    check((GPU_PLAN_CMD_BYTES + GPU_PLAN_TESS_BYTES) == stats.tag_bytes[GPU_HEAP_TAG_DRIVER],
+          "driver block inferred as planned");
+    check(GPU_PLAN_PATH_BYTES <= stats.largest_free, "path budget left in one block");
+    check((VGLITE_HEAP_SIZE - stats.used_bytes) == GPU_PLAN_PATH_BYTES +
+          (VGLITE_HEAP_SIZE - GPU_PLAN_MARGIN_OFFSET) +
+          ((GPU_PLAN_FRAME_BYTES * APP_BUFFER_COUNT) -
+           stats.tag_bytes[GPU_HEAP_TAG_FRAME_BUFFER]) +
+          (GPU_PLAN_INTERMEDIATE_BYTES - stats.tag_bytes[GPU_HEAP_TAG_INTERMEDIATE]),
+          "no space outside the planned regions");
+
+    check(gpu_mem_plan_verify(&heap), "allocations verified against the plan");
+    gpu_mem_plan_print(&heap);
+
+    /* A driver taking more than planned moves the frame buffers up */
+    check(driver_overrun_fits(GPU_PLAN_MARGIN_BYTES / 2U), "overrun within the margin accepted");
+    check(!driver_overrun_fits(GPU_PLAN_MARGIN_BYTES + GPU_PLAN_BLOCK_ALIGN),
+          "overrun beyond the margin refused");
+
+    return check_summary();
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,222 @@
+/*******************************************************************************
+* File Name        : gpu_profile_check.c
+*
+* Description      : Host check of the GPU profiler, built with GPU_PROFILE_ENABLED:
+*                    bracketing of the wrapped calls, rows per demo and call site, error
+*                    pass-through, a full table and restarting the profile.
+*
+* Related Document : See README.md
+*
+********************************************************************************
+* Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "gpu_profile.h"
+#include "cmd_list.h"
+#include "text_engine.h"
+#include "vg_lite_stub.h"
+
+/* The pixel data is placed in SOCMEM on the device */
+#define CY_SECTION(name)
+#include "mono16_font.h"
+#include "host_check.h"
+
+#if !GPU_PROFILE_ENABLED
+#error "Build with -DGPU_PROFILE_ENABLED=true"
+#endif
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+#define SCREEN_WIDTH                        (800)
+#define SCREEN_HEIGHT                       (480)
+/* vg_lite_finish() calls of a bracket */
+#define FINISH_PER_CALL                     (2U)
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+static vg_lite_buffer_t frame = { .width = SCREEN_WIDTH, .height = SCREEN_HEIGHT,
+                                  .stride = SCREEN_WIDTH * 4, .format = VG_LITE_ARGB8888,
+                                  .address = 0x10000U };
+
+/*******************************************************************************
+* Function Name: find_row
+********************************************************************************
+* Summary:
+*  Returns the row of a demo and function.
+*
+* Parameters:
+*  demo     - Demo name
+*  function - Function making the call
+*
+* Return:
+*  const gpu_profile_site_t* - Row, NULL if not found
+*
+*******************************************************************************/
+static const gpu_profile_site_t *find_row(const char *demo, const char *function)
+{
+    const gpu_profile_site_t *sites;
+    uint32_t count = gpu_profile_get_sites(&sites);
+
+    for (uint32_t i = 0; i < count; i++)
+    {
+        if ((0 == strcmp(sites[i].demo, demo)) && (0 == strcmp(sites[i].function, function)))
+        {
+            return &sites[i];
+        }
+    }
+
+    return NULL;
+}
+
+/*******************************************************************************
+* Function Name: check_sites
+********************************************************************************
+* Summary:
+*  Checks that wrapped calls are bracketed and charged to the current demo
+*  and to their call site.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void check_sites(void)
+{
+    const gpu_profile_site_t *sites;
+    const gpu_profile_site_t *row;
+    vg_lite_stub_stats_t stub;
+    cmd_t clear = { .op = CMD_OP_CLEAR, .target = CMD_TARGET_FRAME,
+                    .color = 0xFFFFFFFFU, .u.clear.full = true };
+    text_font_t font;
+    text_run_t run;
+    vg_lite_matrix_t matrix;
+
+    check(0U == gpu_profile_get_sites(&sites), "Empty before the first call");
+
+    vg_lite_stub_get_stats(&stub, true);
+    GPU_PROFILE_DEMO("Fill rules");
+    (void)cmd_execute(&clear, &frame);
+    (void)cmd_execute(&clear, &frame);
+    vg_lite_stub_get_stats(&stub, true);
+    row = find_row("Fill rules", "cmd_execute");
+    check((1U == gpu_profile_get_sites(&sites)) && (NULL != row) && (2U == row->calls) &&
+          (0 == strcmp(row->call, "vg_lite_clear")) && (row->line > 0U),
+          "Calls of one site summed in one row");
+    check((2U == stub.clear) && (((2U * FINISH_PER_CALL) + FINISH_PER_CALL) == stub.finish),
+          "Each call bracketed, first one measures the overhead");
+    check((row->total_ns >= row->max_ns) && (row->total_ns <= (2U * row->max_ns)),
+          "Total and maximum time");
+
+    GPU_PROFILE_DEMO("Pattern fill");
+    (void)cmd_execute(&clear, &frame);
+    row = find_row("Pattern fill", "cmd_execute");
+    check((2U == gpu_profile_get_sites(&sites)) && (NULL != row) && (1U == row->calls),
+          "Same site in another demo gets its own row");
+
+    check(VG_LITE_INVALID_ARGUMENT == cmd_execute(&clear, NULL), "Errors passed through");
+
+    (void)text_font_init(&font, &mono16_font);
+    text_run_init(&run, &font);
+    (void)text_run_set(&run, "CBA");
+    vg_lite_identity(&matrix);
+    (void)text_run_draw(&run, &frame, &matrix, 0xFF000000U);
+    row = find_row("Pattern fill", "text_run_draw");
+    check((NULL != row) && (run.span_count == row->calls) &&
+          (0 == strcmp(row->call, "vg_lite_blit_rect")), "Blits of a text run charged to the text engine");
+}
+
+/*******************************************************************************
+* Function Name: check_table
+********************************************************************************
+* Summary:
+*  Checks that calls of sites not fitting in the table are dropped and that
+*  a restart empties it before the next call.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void check_table(void)
+{
+    const gpu_profile_site_t *sites;
+    cmd_t clear = { .op = CMD_OP_CLEAR, .target = CMD_TARGET_FRAME,
+                    .color = 0xFFFFFFFFU, .u.clear.full = true };
+
+    GPU_PROFILE_DEMO("UI filter");
+    for (uint32_t line = 1U; line <= (GPU_PROFILE_MAX_SITES + 1U); line++)
+    {
+        gpu_profile_begin();
+        (void)gpu_profile_end(__func__, line, "vg_lite_clear", VG_LITE_SUCCESS);
+    }
+    check(GPU_PROFILE_MAX_SITES == gpu_profile_get_sites(&sites), "Sites beyond the table dropped");
+
+    gpu_profile_reset();
+    check(GPU_PROFILE_MAX_SITES == gpu_profile_get_sites(&sites), "Restart waits for the next call");
+    (void)cmd_execute(&clear, &frame);
+    check((1U == gpu_profile_get_sites(&sites)) && (1U == sites[0].calls), "Restart empties the table");
+    gpu_profile_dump();
+}
+
+/*******************************************************************************
+* Function Name: main
+********************************************************************************
+* Summary:
+*  Runs the GPU profiler checks.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  int - 0 if all checks passed
+*
+*******************************************************************************/
+int main(void)
+{
+    check_sites();
+    check_table();
+
+    return check_summary();
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,363 @@
+/*******************************************************************************
+* File Name        : gpu_profile_diff.c
+*
+* Description      : Host tool comparing two GPU profiles dumped over UART by the
+*                    application built with GPU_PROFILE_ENABLED. It reads the lines
+*                    starting with gpu_profile, from two saved terminal logs and prints
+*                    the average time of each call site in both, with the change.
+*                    Sites are matched by demo, function and VGLite call, so an edit
+*                    moving a call to another line keeps it comparable.
+*
+* Related Document : See README.md
+*
+********************************************************************************
+* Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* Same as GPU_PROFILE_DUMP_PREFIX of the application */
+#define DUMP_PREFIX                         "gpu_profile,"
+#define MAX_ROWS                            (512U)
+#define MAX_LINE_LENGTH                     (512U)
+#define MAX_FIELD_LENGTH                    (64U)
+/* demo,site,call,calls,avg_ns,max_ns,total_us */
+#define FIELD_COUNT                         (7U)
+
+/*******************************************************************************
+* Data Structures and Types
+*******************************************************************************/
+typedef struct {
+    char demo[MAX_FIELD_LENGTH];
+    char site[MAX_FIELD_LENGTH];        /* function:line */
+    char call[MAX_FIELD_LENGTH];
+    unsigned long calls;
+    unsigned long avg_ns;
+    bool matched;
+} row_t;
+
+typedef struct {
+    row_t rows[MAX_ROWS];
+    size_t count;
+} profile_t;
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+static profile_t before;
+static profile_t after;
+
+
+/*******************************************************************************
+* Function Name: fail
+********************************************************************************
+* Summary:
+*  Prints an error and terminates the tool.
+*
+* Parameters:
+*  message - Error
+*  detail  - File name the error is about
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void fail(const char *message, const char *detail)
+{
+    fprintf(stderr, "gpu_profile_diff: %s: %s\n", detail, message);
+    exit(EXIT_FAILURE);
+}
+
+/*******************************************************************************
+* Function Name: parse_row
+********************************************************************************
+* Summary:
+*  Splits one dump line into a row. The column header does not parse.
+*
+* Parameters:
+*  text - Line, after the prefix
+*  row  - Output row
+*
+* Return:
+*  bool - true if the line is a row of the table
+*
+*******************************************************************************/
+static bool parse_row(char *text, row_t *row)
+{
+    char *fields[FIELD_COUNT];
+    char *end;
+    size_t count = 0U;
+
+    text[strcspn(text, "\r\n")] = '\0';
+    for (char *field = text; (NULL != field) && (count < FIELD_COUNT); count++)
+    {
+        fields[count] = field;
+        field = strchr(field, ',');
+        if (NULL != field)
+        {
+            *field++ = '\0';
+        }
+    }
+    if (FIELD_COUNT != count)
+    {
+        return false;
+    }
+
+    for (size_t i = 0; i < 3U; i++)
+    {
+        if (strlen(fields[i]) >= MAX_FIELD_LENGTH)
+        {
+            return false;
+        }
+    }
+    row->calls = strtoul(fields[3], &end, 10);
+    if ((end == fields[3]) || ('\0' != *end))
+    {
+        return false;
+    }
+    row->avg_ns = strtoul(fields[4], &end, 10);
+    if ((end == fields[4]) || ('\0' != *end))
+    {
+        return false;
+    }
+    strcpy(row->demo, fields[0]);
+    strcpy(row->site, fields[1]);
+    strcpy(row->call, fields[2]);
+    row->matched = false;
+
+    return true;
+}
+
+/*******************************************************************************
+* Function Name: read_profile
+********************************************************************************
+* Summary:
+*  Reads the rows of the last dump of a saved terminal log. Other output of
+*  the application in the log is skipped.
+*
+* Parameters:
+*  path    - Log file
+*  profile - Output rows
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void read_profile(const char *path, profile_t *profile)
+{
+    char line[MAX_LINE_LENGTH];
+    FILE *file = fopen(path, "r");
+    row_t row;
+
+    if (NULL == file)
+    {
+        fail("cannot open", path);
+    }
+
+    while (NULL != fgets(line, sizeof(line), file))
+    {
+        char *text = strstr(line, DUMP_PREFIX);
+
+        if (NULL == text)
+        {
+            continue;
+        }
+        text += strlen(DUMP_PREFIX);
+        if (0 == strncmp(text, "demo,", strlen("demo,")))
+        {
+            /* A later dump replaces an earlier one */
+            profile->count = 0U;
+            continue;
+        }
+        if (!parse_row(text, &row))
+        {
+            continue;
+        }
+        if (profile->count >= MAX_ROWS)
+        {
+            fail("too many call sites", path);
+        }
+        profile->rows[profile->count++] = row;
+    }
+    fclose(file);
+
+    if (0U == profile->count)
+    {
+        fail("no GPU profile found", path);
+    }
+}
+
+/*******************************************************************************
+* Function Name: same_function
+********************************************************************************
+* Summary:
+*  Compares the function part of two sites, ignoring the line numbers.
+*
+* Parameters:
+*  a    - Site
+*  b    - Site
+*
+* Return:
+*  bool - true if both sites are in the same function
+*
+*******************************************************************************/
+static bool same_function(const char *a, const char *b)
+{
+    size_t length = strcspn(a, ":");
+
+    return (length == strcspn(b, ":")) && (0 == strncmp(a, b, length));
+}
+
+/*******************************************************************************
+* Function Name: find_match
+********************************************************************************
+* Summary:
+*  Returns the first unmatched row of the earlier profile for the same demo,
+*  function and VGLite call as a row of the later one.
+*
+* Parameters:
+*  row    - Row of the later profile
+*
+* Return:
+*  row_t* - Row of the earlier profile, NULL if the site is new
+*
+*******************************************************************************/
+static row_t *find_match(const row_t *row)
+{
+    for (size_t i = 0; i < before.count; i++)
+    {
+        row_t *old = &before.rows[i];
+
+        if (!old->matched && (0 == strcmp(old->demo, row->demo)) &&
+            (0 == strcmp(old->call, row->call)) && same_function(old->site, row->site))
+        {
+            return old;
+        }
+    }
+
+    return NULL;
+}
+
+/*******************************************************************************
+* Function Name: usage
+********************************************************************************
+* Summary:
+*  Prints the command line help and terminates the tool.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void usage(void)
+{
+    fprintf(stderr,
+            "usage: gpu_profile_diff before.log after.log\n"
+            "Compares the average time per call of each call site in the last GPU\n"
+            "profile dumped into two saved terminal logs (key 'g' of the menu).\n");
+    exit(EXIT_FAILURE);
+}
+
+/*******************************************************************************
+* Function Name: main
+********************************************************************************
+* Summary:
+*  Prints the sites of the later profile with their earlier and later average
+*  time, then the sites only found in the earlier one.
+*
+* Parameters:
+*  argc - Number of arguments
+*  argv - Arguments
+*
+* Return:
+*  int  - 0 on success
+*
+*******************************************************************************/
+int main(int argc, char *argv[])
+{
+    if (3 != argc)
+    {
+        usage();
+    }
+    read_profile(argv[1], &before);
+    read_profile(argv[2], &after);
+
+    printf("%-16s %-28s %-22s %10s %10s %8s\n", "demo", "site", "call",
+           "before ns", "after ns", "change");
+    for (size_t i = 0; i < after.count; i++)
+    {
+        const row_t *row = &after.rows[i];
+        row_t *old = find_match(row);
+
+        if (NULL == old)
+        {
+            printf("%-16s %-28s %-22s %10s %10lu %8s\n", row->demo, row->site, row->call,
+                   "-", row->avg_ns, "new");
+            continue;
+        }
+        old->matched = true;
+        if (0U == old->avg_ns)
+        {
+            printf("%-16s %-28s %-22s %10lu %10lu %8s\n", row->demo, row->site, row->call,
+                   old->avg_ns, row->avg_ns, "-");
+        }
+        else
+        {
+            printf("%-16s %-28s %-22s %10lu %10lu %+7.1f%%\n", row->demo, row->site, row->call,
+                   old->avg_ns, row->avg_ns,
+                   (((double)row->avg_ns - (double)old->avg_ns) * 100.0) / (double)old->avg_ns);
+        }
+    }
+    for (size_t i = 0; i < before.count; i++)
+    {
+        const row_t *old = &before.rows[i];
+
+        if (!old->matched)
+        {
+            printf("%-16s %-28s %-22s %10lu %10s %8s\n", old->demo, old->site, old->call,
+                   old->avg_ns, "-", "gone");
+        }
+    }
+
+    return EXIT_SUCCESS;
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,353 @@
+/*******************************************************************************
+* File Name        : gpu_submit_check.c
+*
+* Description      : Host check of the GPU submission layer: frames retired by interrupts
+*                    that arrive early, late, shared or without a frame, after the GPU went
+*                    idle, and with every fence entry in use.
+*
+* Related Document : See README.md
+*
+********************************************************************************
+* Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "gpu_submit.h"
+#include "host_check.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+#define MAX_DONE                            (16U)
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+static gpu_submit_t submit;
+
+/* Slots handed to the done callback, in order */
+static uint8_t done_slots[MAX_DONE];
+static uint32_t done_count;
+
+
+/*******************************************************************************
+* Function Name: on_done
+********************************************************************************
+* Summary:
+*  Done callback, records the slot of the completed frame.
+*
+* Parameters:
+*  slot      - Swap chain slot of the frame
+*  user_data - Unused
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void on_done(uint8_t slot, void *user_data)
+{
+    (void)user_data;
+    if (done_count < MAX_DONE)
+    {
+        done_slots[done_count] = slot;
+    }
+    done_count++;
+}
+
+/*******************************************************************************
+* Function Name: reset
+********************************************************************************
+* Summary:
+*  Starts a check with an empty submission context.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void reset(void)
+{
+    gpu_submit_init(&submit, on_done, NULL);
+    done_count = 0U;
+}
+
+/*******************************************************************************
+* Function Name: check_early_irq
+********************************************************************************
+* Summary:
+*  The interrupt of a frame arrives before vg_lite_flush() returns. The
+*  fence is recorded before the flush, so the frame is retired.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void check_early_irq(void)
+{
+    gpu_submit_stats_t stats;
+    uint32_t fence;
+
+    reset();
+    fence = gpu_submit_frame(&submit, 1U, 0U, 100U);
+    gpu_submit_on_irq(&submit, 150U);
+    gpu_submit_get_stats(&submit, &stats, false);
+
+    check(GPU_SUBMIT_NO_FENCE != fence, "fence recorded");
+    check((1U == done_count) && (1U == done_slots[0]), "early interrupt retires the frame");
+    check(gpu_submit_fence_done(&submit, fence) && (0U == stats.stray_irqs),
+          "early interrupt is not stray");
+    check(0U == gpu_submit_get_pending(&submit), "nothing left pending");
+}
+
+/*******************************************************************************
+* Function Name: check_in_order
+********************************************************************************
+* Summary:
+*  Frames are retired in submission order, one per interrupt, and the GPU
+*  busy time counts from the later of the submission and the previous
+*  completion.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void check_in_order(void)
+{
+    gpu_submit_stats_t stats;
+    uint32_t first;
+    uint32_t second;
+
+    reset();
+    first = gpu_submit_frame(&submit, 0U, 0U, 100U);
+    second = gpu_submit_frame(&submit, 2U, 100U, 200U);
+    check(2U == gpu_submit_get_pending(&submit), "two frames pending");
+
+    gpu_submit_on_irq(&submit, 300U);
+    check(gpu_submit_fence_done(&submit, first) && !gpu_submit_fence_done(&submit, second),
+          "first interrupt completes the first frame only");
+    gpu_submit_on_irq(&submit, 450U);
+    check((2U == done_count) && (0U == done_slots[0]) && (2U == done_slots[1]),
+          "frames handed over in submission order");
+
+    gpu_submit_get_stats(&submit, &stats, true);
+    check((2U == stats.frames) && (350U == stats.gpu_busy_cycles), "GPU busy time");
+    check((200U == stats.encode_cycles) && (100U == stats.overlap_cycles),
+          "encoding overlapped with the first frame");
+    gpu_submit_get_stats(&submit, &stats, false);
+    check((0U == stats.frames) && (0U == stats.gpu_busy_cycles), "statistics reset");
+}
+
+/*******************************************************************************
+* Function Name: check_stray_and_shared
+********************************************************************************
+* Summary:
+*  An interrupt with nothing pending, e.g. of a vg_lite_finish(), is counted
+*  and ignored. Two frames completed by one interrupt leave the second
+*  pending until the GPU is known to be idle.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void check_stray_and_shared(void)
+{
+    gpu_submit_stats_t stats;
+    uint32_t second;
+
+    reset();
+    gpu_submit_on_irq(&submit, 10U);
+    gpu_submit_get_stats(&submit, &stats, false);
+    check((1U == stats.stray_irqs) && (0U == done_count), "stray interrupt ignored");
+
+    (void)gpu_submit_frame(&submit, 0U, 0U, 100U);
+    second = gpu_submit_frame(&submit, 1U, 100U, 200U);
+    gpu_submit_on_irq(&submit, 400U);
+    check((1U == done_count) && (1U == gpu_submit_get_pending(&submit)),
+          "shared interrupt retires one frame");
+
+    gpu_submit_on_idle(&submit, 500U);
+    gpu_submit_get_stats(&submit, &stats, false);
+    check((2U == done_count) && (1U == done_slots[1]) && gpu_submit_fence_done(&submit, second),
+          "idle GPU retires the rest");
+    check((1U == stats.idle_retired) && (0U == gpu_submit_get_pending(&submit)),
+          "idle retirement counted");
+
+    gpu_submit_on_idle(&submit, 600U);
+    check(2U == done_count, "idle with nothing pending");
+}
+
+/*******************************************************************************
+* Function Name: check_queue_full
+********************************************************************************
+* Summary:
+*  A frame is refused, not dropped, when every entry is in use, and is
+*  accepted once the pending ones are retired.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void check_queue_full(void)
+{
+    gpu_submit_stats_t stats;
+    uint32_t fence = GPU_SUBMIT_NO_FENCE;
+
+    reset();
+    for (uint8_t i = 0U; i < GPU_SUBMIT_MAX_PENDING; i++)
+    {
+        fence = gpu_submit_frame(&submit, i, 0U, 100U);
+    }
+    check(GPU_SUBMIT_NO_FENCE != fence, "every entry in use");
+    check(GPU_SUBMIT_NO_FENCE == gpu_submit_frame(&submit, 0U, 0U, 100U),
+          "full queue refuses the frame");
+    gpu_submit_get_stats(&submit, &stats, false);
+    check(1U == stats.queue_full, "refused frame counted");
+
+    gpu_submit_on_idle(&submit, 200U);
+    check(GPU_SUBMIT_NO_FENCE != gpu_submit_frame(&submit, 0U, 0U, 300U),
+          "frame accepted after the GPU went idle");
+    check(GPU_SUBMIT_MAX_PENDING == done_count, "pending frames handed over");
+}
+
+/*******************************************************************************
+* Function Name: check_cancel_and_retire
+********************************************************************************
+* Summary:
+*  A failed flush drops its own frame only. Retiring by fence completes
+*  every older frame and stops at the given one.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void check_cancel_and_retire(void)
+{
+    uint32_t first;
+    uint32_t second;
+    uint32_t third;
+
+    reset();
+    first = gpu_submit_frame(&submit, 0U, 0U, 100U);
+    second = gpu_submit_frame(&submit, 1U, 0U, 200U);
+    check(!gpu_submit_cancel(&submit, first), "only the newest frame can be cancelled");
+    check(gpu_submit_cancel(&submit, second) && (1U == gpu_submit_get_pending(&submit)),
+          "failed flush cancelled");
+
+    second = gpu_submit_frame(&submit, 1U, 0U, 300U);
+    third = gpu_submit_frame(&submit, 2U, 0U, 400U);
+    gpu_submit_retire(&submit, second, 500U);
+    check((2U == done_count) && (1U == gpu_submit_get_pending(&submit)) &&
+          !gpu_submit_fence_done(&submit, third), "retired up to the fence");
+    gpu_submit_on_irq(&submit, 600U);
+    check(!gpu_submit_cancel(&submit, third), "retired frame not cancelled");
+    check((3U == done_count) && (2U == done_slots[2]), "every frame handed over once");
+}
+
+/*******************************************************************************
+* Function Name: check_fence_wrap
+********************************************************************************
+* Summary:
+*  The fence counter skips GPU_SUBMIT_NO_FENCE when it wraps and fences
+*  compare across the wrap.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void check_fence_wrap(void)
+{
+    uint32_t last;
+    uint32_t wrapped;
+
+    reset();
+    submit.next_fence = UINT32_MAX;
+    last = gpu_submit_frame(&submit, 0U, 0U, 100U);
+    wrapped = gpu_submit_frame(&submit, 1U, 0U, 200U);
+    check((UINT32_MAX == last) && (1U == wrapped), "fence 0 skipped");
+
+    gpu_submit_on_irq(&submit, 300U);
+    check(gpu_submit_fence_done(&submit, last) && !gpu_submit_fence_done(&submit, wrapped),
+          "fences compared across the wrap");
+    gpu_submit_retire(&submit, wrapped, 400U);
+    check(gpu_submit_fence_done(&submit, wrapped) && (2U == done_count),
+          "retired across the wrap");
+}
+
+
+/*******************************************************************************
+* Function Name: main
+********************************************************************************
+* Summary:
+*  Runs the GPU submission checks.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  int - 0 if all checks passed
+*
+*******************************************************************************/
+int main(void)
+{
+    check_early_irq();
+    check_in_order();
+    check_stray_and_shared();
+    check_queue_full();
+    check_cancel_and_retire();
+    check_fence_wrap();
+
+    return check_summary();
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,317 @@
+/*******************************************************************************
+* File Name        : image_assets_check.c
+*
+* Description      : Host check of the images prepared by tools/host/img2vglite in
+*                    image_assets.h: alignment, row pitch, color lookup tables,
+*                    premultiplied alpha and the half resolution levels. The output of the tool itself is compared
+*                    byte for byte with the committed header and with the fixtures in
+*                    testdata by "make check".
+*
+* Related Document : See README.md
+*
+********************************************************************************
+* Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+
+
+
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include "vg_lite_stub.h"
+
+/* The pixel data is placed in SOCMEM on the device */
+#define CY_SECTION(name)
+#include "image_assets.h"
+#include "host_check.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* Smallest saving of the indexed images over ARGB8888 */
+#define MIN_SAVING                          (3U)
+#define BYTES_PER_ARGB8888_PIXEL            (4U)
+
+
+/*******************************************************************************
+* Function Name: is_premultiplied
+********************************************************************************
+* Summary:
+*  Tells whether no color channel of a color exceeds its alpha.
+*
+* Parameters:
+*  argb  - Color, 0xAARRGGBB
+*
+* Return:
+*  bool  - true if the color can be premultiplied
+*
+*******************************************************************************/
+static bool is_premultiplied(uint32_t argb)
+{
+    uint32_t alpha = argb >> 24;
+
+    return (((argb >> 16) & 0xFFU) <= alpha) && (((argb >> 8) & 0xFFU) <= alpha) &&
+           ((argb & 0xFFU) <= alpha);
+}
+
+/*******************************************************************************
+* Function Name: check_layout
+********************************************************************************
+* Summary:
+*  Checks the alignment, the row pitch and the padding of an image.
+*
+* Parameters:
+*  asset - Image or level
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void check_layout(const image_asset_t *asset)
+{
+    int32_t row = image_asset_min_stride(asset->format, asset->width);
+    bool padding_clear = true;
+    char name[96];
+
+    printf("%s: %dx%d %s, stride %d, %u bytes\r\n", asset->name, (int)asset->width,
+           (int)asset->height, image_asset_format_name(asset->format), (int)asset->stride,
+           (unsigned int)image_asset_bytes(asset));
+
+    snprintf(name, sizeof(name), "%s: pixels %u byte aligned", asset->name,
+             IMAGE_ASSET_DATA_ALIGN);
+    check(0U == ((uintptr_t)asset->data & (IMAGE_ASSET_DATA_ALIGN - 1U)), name);
+    snprintf(name, sizeof(name), "%s: row pitch a multiple of %u bytes", asset->name,
+             IMAGE_ASSET_STRIDE_ALIGN);
+    check((row > 0) && (asset->stride >= row) &&
+          (0 == (asset->stride % (int32_t)IMAGE_ASSET_STRIDE_ALIGN)), name);
+
+    for (int32_t y = 0; y < asset->height; y++)
+    {
+        for (int32_t x = row; x < asset->stride; x++)
+        {
+            padding_clear = padding_clear && (0U == asset->data[(y * asset->stride) + x]);
+        }
+    }
+    snprintf(name, sizeof(name), "%s: row padding cleared", asset->name);
+    check(padding_clear, name);
+}
+
+/*******************************************************************************
+* Function Name: check_colors
+********************************************************************************
+* Summary:
+*  Checks the color lookup table and the premultiplied alpha of an image.
+*
+* Parameters:
+*  asset - Image or level
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void check_colors(const image_asset_t *asset)
+{
+    bool premultiplied = true;
+    char name[96];
+
+    snprintf(name, sizeof(name), "%s: color table matches the format", asset->name);
+    check(image_asset_is_indexed(asset->format) ?
+          ((NULL != asset->clut) && (0U == asset->clut[0]) &&
+           (asset->clut_count == (1UL << image_asset_bits_per_pixel(asset->format)))) :
+          ((NULL == asset->clut) && (0U == asset->clut_count)), name);
+
+    if (!asset->premultiplied)
+    {
+        return;
+    }
+    if (image_asset_is_indexed(asset->format) && (NULL != asset->clut))
+    {
+        for (uint32_t e = 0; e < asset->clut_count; e++)
+        {
+            premultiplied = premultiplied && is_premultiplied(asset->clut[e]);
+        }
+    }
+    else if (VG_LITE_ARGB8888 == asset->format)
+    {
+        for (int32_t y = 0; y < asset->height; y++)
+        {
+            for (int32_t x = 0; x < asset->width; x++)
+            {
+                const uint8_t *p = &asset->data[(y * asset->stride) + (x * 4)];
+
+                premultiplied = premultiplied &&
+                                is_premultiplied(((uint32_t)p[3] << 24) |
+                                                 ((uint32_t)p[2] << 16) |
+                                                 ((uint32_t)p[1] << 8) | p[0]);
+            }
+        }
+    }
+    snprintf(name, sizeof(name), "%s: colors premultiplied", asset->name);
+    check(premultiplied, name);
+    snprintf(name, sizeof(name), "%s: blended as premultiplied", asset->name);
+    check(VG_LITE_BLEND_PREMULTIPLY_SRC_OVER == image_asset_blend(asset), name);
+}
+
+/*******************************************************************************
+* Function Name: check_levels
+********************************************************************************
+* Summary:
+*  Checks that each half resolution level has the format, color table and
+*  alpha of its image and half the size of the previous level, rounded up.
+*
+* Parameters:
+*  asset - Full resolution image
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void check_levels(const image_asset_t *asset)
+{
+    bool halved = true;
+    char name[96];
+
+    if (NULL == asset->next_level)
+    {
+        return;
+    }
+    for (const image_asset_t *level = asset; NULL != level->next_level; level = level->next_level)
+    {
+        const image_asset_t *next = level->next_level;
+
+        halved = halved && (next->format == asset->format) && (next->clut == asset->clut) &&
+                 (next->premultiplied == asset->premultiplied) &&
+                 (next->width == ((level->width + 1) / 2)) &&
+                 (next->height == ((level->height + 1) / 2));
+    }
+    snprintf(name, sizeof(name), "%s: levels halve the image", asset->name);
+    check(halved, name);
+}
+
+/*******************************************************************************
+* Function Name: check_size
+********************************************************************************
+* Summary:
+*  Checks the size of the indexed images against ARGB8888.
+*
+* Parameters:
+*  asset - Full resolution image
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void check_size(const image_asset_t *asset)
+{
+    char name[96];
+
+    if (!image_asset_is_indexed(asset->format))
+    {
+        return;
+    }
+    snprintf(name, sizeof(name), "%s: several times smaller than ARGB8888", asset->name);
+    check((image_asset_bytes(asset) * MIN_SAVING) <=
+          ((uint32_t)asset->width * (uint32_t)asset->height * BYTES_PER_ARGB8888_PIXEL), name);
+}
+
+/*******************************************************************************
+* Function Name: check_clut
+********************************************************************************
+* Summary:
+*  Checks loading the color lookup table and the format helpers.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void check_clut(void)
+{
+    static const uint32_t table[256] = { 0U };
+    vg_lite_stub_stats_t stats;
+    image_asset_t asset = *image_assets[0];
+
+    vg_lite_stub_get_stats(&stats, true);
+    check(image_asset_load_clut(&asset), "Table of the first image loaded");
+    vg_lite_stub_get_stats(&stats, true);
+    check(image_asset_is_indexed(asset.format) ?
+          ((1U == stats.set_clut) && (stats.clut_count == asset.clut_count)) :
+          (0U == stats.set_clut), "Table loaded only for indexed formats");
+
+    asset.format = VG_LITE_INDEX_4;
+    asset.clut = table;
+    asset.clut_count = 256U;
+    check(!image_asset_load_clut(&asset), "256 entry table rejected for VG_LITE_INDEX_4");
+    asset.clut_count = 16U;
+    check(image_asset_load_clut(&asset), "16 entry table accepted for VG_LITE_INDEX_4");
+
+    check((image_asset_min_stride(VG_LITE_INDEX_4, 175) == 88) &&
+          (image_asset_min_stride(VG_LITE_A8, 175) == 175) &&
+          (image_asset_min_stride(VG_LITE_ARGB8888, 175) == 700) &&
+          (image_asset_min_stride(VG_LITE_BGR565, 175) == 350), "Minimum row pitch");
+}
+
+/*******************************************************************************
+* Function Name: main
+********************************************************************************
+* Summary:
+*  Runs the prepared image checks.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  int - 0 if all checks passed
+*
+*******************************************************************************/
+int main(void)
+{
+    for (uint32_t i = 0; i < IMAGE_ASSETS_COUNT; i++)
+    {
+        for (const image_asset_t *level = image_assets[i]; NULL != level;
+             level = level->next_level)
+        {
+            check_layout(level);
+            check_colors(level);
+        }
+        check_levels(image_assets[i]);
+        check_size(image_assets[i]);
+    }
+    check_clut();
+
+    return check_summary();
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,284 @@
+/*******************************************************************************
+* File Name        : image_pyramid_check.c
+*
+* Description      : Host check of the image pyramids: level setup from the prepared
+*                    icons, level selection by scale, the draw matrix of a reduced
+*                    level and the byte accounting of blits and of pyramid nodes.
+*
+* Related Document : See README.md
+*
+********************************************************************************
+* Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include "image_pyramid.h"
+#include "scene_graph.h"
+#include "vg_lite_stub.h"
+
+/* The pixel data is placed in SOCMEM on the device */
+#define CY_SECTION(name)
+#include "pyramid_assets.h"
+#include "host_check.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+#define SCREEN_WIDTH                        (800)
+#define SCREEN_HEIGHT                       (480)
+/* Antialiasing margin added by damage_rect_transform() */
+#define BOUNDS_PADDING                      (1)
+
+/*******************************************************************************
+* Data Structures and Types
+*******************************************************************************/
+typedef struct {
+    float scale_x;
+    float scale_y;
+    float degrees;
+    uint8_t level;
+    const char *name;
+} selection_case_t;
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+static vg_lite_buffer_t frame = { .width = SCREEN_WIDTH, .height = SCREEN_HEIGHT,
+                                  .stride = SCREEN_WIDTH * 4, .format = VG_LITE_ARGB8888,
+                                  .address = 0x10000U };
+
+/* 176x190 icon with levels of 88x95 and 44x48 */
+static const selection_case_t selection_cases[] =
+{
+    { 1.00f, 1.00f,  0.0f, 0U, "Full size drawn from level 0" },
+    { 2.00f, 2.00f,  0.0f, 0U, "Magnified drawn from level 0" },
+    { 0.75f, 0.75f,  0.0f, 0U, "3/4 size drawn from level 0" },
+    { 0.70f, 0.70f,  0.0f, 1U, "0.7 size drawn from level 1" },
+    { 0.50f, 0.50f,  0.0f, 1U, "Half size drawn from level 1" },
+    { 0.50f, 0.50f, 30.0f, 1U, "Rotated half size drawn from level 1" },
+    { 0.25f, 0.25f,  0.0f, 2U, "Quarter size drawn from level 2" },
+    { 0.05f, 0.05f,  0.0f, 2U, "Tiny drawn from the smallest level" },
+    { 1.00f, 0.25f,  0.0f, 0U, "Squeezed along one axis drawn from level 0" },
+};
+
+/*******************************************************************************
+* Function Name: check_init
+********************************************************************************
+* Summary:
+*  Checks the level buffers set up from a prepared icon and the rejection of
+*  a level of the wrong size.
+*
+* Parameters:
+*  pyramid - Pyramid, set up from facial_rec
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void check_init(image_pyramid_t *pyramid)
+{
+    image_pyramid_t broken;
+    image_asset_t level = facial_rec_level1_asset;
+    image_asset_t base = facial_rec_asset;
+
+    check(image_pyramid_init(pyramid, &facial_rec_asset), "Icon pyramid set up");
+    check((3U == pyramid->level_count) &&
+          (176 == pyramid->levels[0].width) && (190 == pyramid->levels[0].height) &&
+          (88 == pyramid->levels[1].width) && (95 == pyramid->levels[1].height) &&
+          (44 == pyramid->levels[2].width) && (48 == pyramid->levels[2].height),
+          "Icon levels halve the size");
+    check((pyramid->levels[1].memory == facial_rec_level1_asset.data) &&
+          (VG_LITE_INDEX_8 == pyramid->levels[1].format) &&
+          (VG_LITE_NORMAL_IMAGE_MODE == pyramid->levels[1].image_mode),
+          "Level buffers point to the prepared pixels");
+    check(image_pyramid_bytes(pyramid) == (36480U + 12160U + 3072U), "Pyramid bytes");
+
+    level.width = 90;
+    level.next_level = NULL;
+    base.next_level = &level;
+    check(!image_pyramid_init(&broken, &base), "Level of the wrong size rejected");
+    check(image_pyramid_init(&broken, &facial_rec_level2_asset) && (1U == broken.level_count),
+          "Image without levels is a single level pyramid");
+}
+
+/*******************************************************************************
+* Function Name: check_select
+********************************************************************************
+* Summary:
+*  Checks the level chosen for scaled and rotated draw matrices.
+*
+* Parameters:
+*  pyramid - Icon pyramid
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void check_select(const image_pyramid_t *pyramid)
+{
+    for (uint32_t i = 0; i < (sizeof(selection_cases) / sizeof(selection_cases[0])); i++)
+    {
+        const selection_case_t *test = &selection_cases[i];
+        vg_lite_matrix_t matrix;
+
+        vg_lite_identity(&matrix);
+        vg_lite_translate(100.0f, 50.0f, &matrix);
+        vg_lite_rotate(test->degrees, &matrix);
+        vg_lite_scale(test->scale_x, test->scale_y, &matrix);
+        check(image_pyramid_select(pyramid, &matrix) == test->level, test->name);
+    }
+}
+
+/*******************************************************************************
+* Function Name: check_blit
+********************************************************************************
+* Summary:
+*  Checks that a reduced level is blitted with the matrix scaled by the size
+*  ratio, so it covers the pixels of the full resolution image, and the byte
+*  accounting of the blits.
+*
+* Parameters:
+*  pyramid - Icon pyramid
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void check_blit(image_pyramid_t *pyramid)
+{
+    vg_lite_stub_call_t logged[2];
+    image_pyramid_stats_t stats;
+    vg_lite_matrix_t matrix;
+    vg_lite_matrix_t expected;
+
+    image_pyramid_get_stats(&stats, true);
+    (void)vg_lite_stub_get_log(logged, 2U, true);
+
+    vg_lite_identity(&matrix);
+    vg_lite_translate(112.0f, 32.0f, &matrix);
+    vg_lite_scale(0.5f, 0.5f, &matrix);
+    expected = matrix;
+    vg_lite_scale(2.0f, 2.0f, &expected);
+
+    check(VG_LITE_SUCCESS == image_pyramid_blit(pyramid, &frame, &matrix,
+                                                VG_LITE_BLEND_PREMULTIPLY_SRC_OVER, 0U,
+                                                VG_LITE_FILTER_LINEAR), "Reduced blit issued");
+    (void)vg_lite_blit(&frame, &pyramid->levels[1], &expected,
+                       VG_LITE_BLEND_PREMULTIPLY_SRC_OVER, 0U, VG_LITE_FILTER_LINEAR);
+    check((2U == vg_lite_stub_get_log(logged, 2U, true)) &&
+          (logged[0].args_hash == logged[1].args_hash),
+          "Level 1 blitted at twice the scale of the full resolution image");
+
+    vg_lite_identity(&matrix);
+    (void)image_pyramid_blit(pyramid, &frame, &matrix, VG_LITE_BLEND_SRC_OVER, 0U,
+                             VG_LITE_FILTER_LINEAR);
+    image_pyramid_get_stats(&stats, true);
+    printf("Blits: %u, %u reduced, %u of %u bytes read\r\n", (unsigned int)stats.blits,
+           (unsigned int)stats.reduced, (unsigned int)stats.fetched_bytes,
+           (unsigned int)stats.full_bytes);
+    check((2U == stats.blits) && (1U == stats.reduced) &&
+          (stats.fetched_bytes == (12160U + 36480U)) && (stats.full_bytes == (2U * 36480U)),
+          "Bytes read counted against full resolution blits");
+    (void)vg_lite_stub_get_log(logged, 2U, true);
+}
+
+/*******************************************************************************
+* Function Name: check_node
+********************************************************************************
+* Summary:
+*  Checks a pyramid node of a scene: the bounds are those of the full
+*  resolution image, the level is chosen and the bytes counted on every draw.
+*
+* Parameters:
+*  pyramid - Icon pyramid
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void check_node(image_pyramid_t *pyramid)
+{
+    scene_node_t root;
+    scene_node_t icon;
+    scene_graph_t graph;
+    image_pyramid_stats_t stats;
+    vg_lite_matrix_t local;
+
+    scene_node_init_group(&root);
+    scene_node_init_pyramid(&icon, pyramid, VG_LITE_BLEND_SRC_OVER, VG_LITE_FILTER_LINEAR);
+    vg_lite_identity(&local);
+    vg_lite_scale(0.25f, 0.25f, &local);
+    scene_node_set_transform(&icon, &local);
+    scene_node_add_child(&root, &icon);
+    scene_graph_init(&graph, &root);
+    scene_graph_update(&graph);
+    check(((icon.bounds.x1 - icon.bounds.x0) == (44 + (2 * BOUNDS_PADDING))) &&
+          ((icon.bounds.y1 - icon.bounds.y0) == (48 + (2 * BOUNDS_PADDING))),
+          "Bounds of the full resolution image");
+
+    image_pyramid_get_stats(&stats, true);
+    (void)scene_graph_draw(&graph, &frame, NULL);
+    (void)scene_graph_draw(&graph, &frame, NULL);
+    image_pyramid_get_stats(&stats, true);
+    check((2U == stats.blits) && (2U == stats.reduced) &&
+          (stats.fetched_bytes == (2U * 3072U)), "Level 2 counted on every draw");
+}
+
+/*******************************************************************************
+* Function Name: main
+********************************************************************************
+* Summary:
+*  Runs the image pyramid checks.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  int - 0 if all checks passed
+*
+*******************************************************************************/
+int main(void)
+{
+    image_pyramid_t pyramid;
+
+    check_init(&pyramid);
+    check_select(&pyramid);
+    check_blit(&pyramid);
+    check_node(&pyramid);
+
+    return check_summary();
+}
+
+/* [] END OF FILE */
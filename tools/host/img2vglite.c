@@ -0,0 +1,1452 @@
+/*******************************************************************************
+* File Name        : img2vglite.c
+*
+* Description      : Host tool preparing the images of the application for the GPU.
+*                    It reads PNG files listed in a manifest and, for each image,
+*                    converts the pixels to the target format, optionally premultiplies
+*                    the alpha, pads the rows to the preferred stride alignment and emits
+*                    aligned C arrays with their image_asset_t descriptors. Indexed
+*                    formats share one color lookup table per index size, computed over
+*                    all images of that size by median cut, as VGLite holds one table per
+*                    index size. Alpha formats keep the coverage and the average color of
+*                    the image as its tint. Images marked "mipmap" also get half
+*                    resolution levels, reduced in premultiplied space, for the image
+*                    pyramids of the application.
+*
+* Related Document : See README.md
+*
+********************************************************************************
+* Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+
+#include <ctype.h>
+#include <errno.h>
+#include <math.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <zlib.h>
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+#define MAX_ASSETS                          (32U)
+#define MAX_NAME_LENGTH                     (64U)
+#define MAX_PATH_LENGTH                     (256U)
+#define MAX_CLUT_SIZE                       (256U)
+#define MACRO_VALUE_COLUMN                  (44U)
+/* IMAGE_ASSET_STRIDE_ALIGN and IMAGE_ASSET_DATA_ALIGN of image_asset.h */
+#define DEFAULT_STRIDE_ALIGN                (64U)
+#define DATA_ALIGN                          (128U)
+/* Refinement passes moving every table entry to the mean of its colors */
+#define REFINE_PASSES                       (8U)
+/* Half resolution levels: at most IMAGE_PYRAMID_MAX_LEVELS in total, the
+ * shorter side not below the minimum level size */
+#define MAX_LEVELS                          (4U)
+#define DEFAULT_MIN_LEVEL_SIZE              (32U)
+#define LEVEL_SUFFIX_LENGTH                 (8U)
+
+#define PNG_SIGNATURE_SIZE                  (8U)
+#define PNG_CHUNK_OVERHEAD                  (12U)
+#define PNG_IHDR_SIZE                       (13U)
+
+#define CHANNEL(argb, c)                    (((argb) >> (24U - (8U * (c)))) & 0xFFU)
+
+/*******************************************************************************
+* Data Structures and Types
+*******************************************************************************/
+typedef struct {
+    const char *option;
+    const char *vg_format;
+    uint32_t bits;
+    bool indexed;
+    bool alpha;
+} output_format_t;
+
+typedef struct asset {
+    char name[MAX_NAME_LENGTH];
+    char file[MAX_PATH_LENGTH];     /* As written in the manifest */
+    const output_format_t *format;
+    bool premultiply;
+    uint32_t width;
+    uint32_t height;
+    uint32_t *pixels;               /* 0xAARRGGBB, straight alpha */
+    uint32_t stride;
+    uint8_t *packed;
+    uint32_t tint;                  /* 0xAARRGGBB */
+    struct asset *next_level;       /* Half resolution, NULL if none */
+} asset_t;
+
+/* Color lookup table shared by the images of one index size */
+typedef struct {
+    uint32_t bits;
+    uint32_t entries[MAX_CLUT_SIZE];    /* Straight alpha */
+    uint32_t size;
+    bool used;
+    bool premultiplied;
+} clut_t;
+
+/* Distinct color and the number of pixels having it */
+typedef struct {
+    uint32_t argb;
+    uint32_t count;
+} color_t;
+
+/* Range of the color array described by one table entry */
+typedef struct {
+    size_t first;
+    size_t count;
+    double error;                   /* Weighted squared error of the range */
+    int channel;                    /* Channel of the largest spread */
+} box_t;
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+static const output_format_t formats[] =
+{
+    { "argb8888", "VG_LITE_ARGB8888", 32U, false, false },
+    { "bgr565",   "VG_LITE_BGR565",   16U, false, false },
+    { "index8",   "VG_LITE_INDEX_8",   8U, true,  false },
+    { "index4",   "VG_LITE_INDEX_4",   4U, true,  false },
+    { "a8",       "VG_LITE_A8",        8U, false, true  },
+    { "a4",       "VG_LITE_A4",        4U, false, true  },
+};
+
+static asset_t assets[MAX_ASSETS];
+static size_t asset_count;
+static clut_t cluts[2] = { { .bits = 8U }, { .bits = 4U } };
+static int sort_channel;
+static uint32_t min_level_size = DEFAULT_MIN_LEVEL_SIZE;
+
+
+/*******************************************************************************
+* Function Name: fail
+********************************************************************************
+* Summary:
+*  Prints an error and terminates the tool.
+*
+* Parameters:
+*  message - Error description
+*  detail  - Additional text, may be NULL
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void fail(const char *message, const char *detail)
+{
+    fprintf(stderr, "img2vglite: %s%s%.60s\n", message, (NULL != detail) ? ": " : "",
+            (NULL != detail) ? detail : "");
+    exit(EXIT_FAILURE);
+}
+
+/*******************************************************************************
+* Function Name: read_file
+********************************************************************************
+* Summary:
+*  Reads a whole file into a NUL terminated buffer.
+*
+* Parameters:
+*  path  - File name
+*  size  - Returns the file size, may be NULL
+*
+* Return:
+*  uint8_t* - Allocated contents
+*
+*******************************************************************************/
+static uint8_t *read_file(const char *path, size_t *size)
+{
+    FILE *file = fopen(path, "rb");
+    uint8_t *data;
+    long length;
+
+    if (NULL == file)
+    {
+        fail(strerror(errno), path);
+    }
+    if ((0 != fseek(file, 0L, SEEK_END)) || ((length = ftell(file)) < 0L) ||
+        (0 != fseek(file, 0L, SEEK_SET)))
+    {
+        fail("cannot read", path);
+    }
+    data = malloc((size_t)length + 1U);
+    if ((NULL == data) || (fread(data, 1U, (size_t)length, file) != (size_t)length))
+    {
+        fail("cannot read", path);
+    }
+    data[length] = '\0';
+    fclose(file);
+    if (NULL != size)
+    {
+        *size = (size_t)length;
+    }
+
+    return data;
+}
+
+/*******************************************************************************
+* Function Name: macro_padding
+********************************************************************************
+* Summary:
+*  Returns the number of spaces aligning the value of a macro definition with
+*  the column used in the rest of the code.
+*
+* Parameters:
+*  prefix - Macro prefix
+*  suffix - Macro suffix
+*
+* Return:
+*  int    - Number of spaces, at least one
+*
+*******************************************************************************/
+static int macro_padding(const char *prefix, const char *suffix)
+{
+    size_t used = strlen("#define ") + strlen(prefix) + strlen(suffix);
+
+    return (used < MACRO_VALUE_COLUMN) ? (int)(MACRO_VALUE_COLUMN - used) : 1;
+}
+
+/*******************************************************************************
+* Function Name: get_be32
+********************************************************************************
+* Summary:
+*  Reads a big endian 32 bit value.
+*
+* Parameters:
+*  data     - First byte
+*
+* Return:
+*  uint32_t - Value
+*
+*******************************************************************************/
+static uint32_t get_be32(const uint8_t *data)
+{
+    return ((uint32_t)data[0] << 24) | ((uint32_t)data[1] << 16) |
+           ((uint32_t)data[2] << 8) | data[3];
+}
+
+/*******************************************************************************
+* Function Name: paeth
+********************************************************************************
+* Summary:
+*  Paeth predictor of the PNG filters.
+*
+* Parameters:
+*  a, b, c  - Left, above and upper left bytes
+*
+* Return:
+*  uint8_t  - Predicted byte
+*
+*******************************************************************************/
+static uint8_t paeth(uint8_t a, uint8_t b, uint8_t c)
+{
+    int p = (int)a + (int)b - (int)c;
+    int pa = abs(p - (int)a);
+    int pb = abs(p - (int)b);
+    int pc = abs(p - (int)c);
+
+    return ((pa <= pb) && (pa <= pc)) ? a : ((pb <= pc) ? b : c);
+}
+
+/*******************************************************************************
+* Function Name: read_png
+********************************************************************************
+* Summary:
+*  Decodes a non interlaced, 8 bit per channel PNG file of any color type into
+*  straight alpha 0xAARRGGBB pixels. Palette and single color transparency
+*  are applied.
+*
+* Parameters:
+*  asset - Image, width, height and pixels are filled in
+*  path  - File name
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void read_png(asset_t *asset, const char *path)
+{
+    static const uint8_t signature[PNG_SIGNATURE_SIZE] = { 0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n' };
+    uint8_t palette[256][4];
+    uint16_t key[3] = { 0xFFFFU, 0xFFFFU, 0xFFFFU };
+    bool has_key = false;
+    uint8_t *idat = NULL;
+    size_t idat_size = 0U;
+    size_t size;
+    uint8_t *file = read_file(path, &size);
+    size_t offset = PNG_SIGNATURE_SIZE;
+    uint32_t color_type = 0U;
+    uint32_t channels = 0U;
+    uint8_t *raw;
+    uLongf raw_size;
+    size_t row_bytes;
+
+    memset(palette, 0xFF, sizeof(palette));
+    if ((size < PNG_SIGNATURE_SIZE) || (0 != memcmp(file, signature, PNG_SIGNATURE_SIZE)))
+    {
+        fail("not a PNG file", path);
+    }
+
+    while (true)
+    {
+        uint32_t length;
+        const uint8_t *type;
+        const uint8_t *data;
+
+        if ((size - offset) < PNG_CHUNK_OVERHEAD)
+        {
+            fail("truncated PNG file", path);
+        }
+        length = get_be32(&file[offset]);
+        type = &file[offset + 4U];
+        data = &file[offset + 8U];
+        if (length > (size - offset - PNG_CHUNK_OVERHEAD))
+        {
+            fail("truncated PNG file", path);
+        }
+        if (crc32(0UL, type, length + 4U) != get_be32(&data[length]))
+        {
+            fail("PNG chunk CRC mismatch", path);
+        }
+
+        if (0 == memcmp(type, "IHDR", 4U))
+        {
+            if ((PNG_IHDR_SIZE != length) || (8U != data[8]) || (0U != data[12]))
+            {
+                fail("only non interlaced 8 bit PNG files are supported", path);
+            }
+            asset->width  = get_be32(&data[0]);
+            asset->height = get_be32(&data[4]);
+            color_type = data[9];
+            channels = (0U == color_type) ? 1U : (2U == color_type) ? 3U :
+                       (3U == color_type) ? 1U : (4U == color_type) ? 2U :
+                       (6U == color_type) ? 4U : 0U;
+            if ((0U == channels) || (0U == asset->width) || (0U == asset->height) ||
+                (asset->width > 4096U) || (asset->height > 4096U))
+            {
+                fail("unsupported PNG image", path);
+            }
+        }
+        else if (0 == memcmp(type, "PLTE", 4U))
+        {
+            for (uint32_t i = 0; (i < (length / 3U)) && (i < 256U); i++)
+            {
+                palette[i][0] = data[(i * 3U) + 0U];
+                palette[i][1] = data[(i * 3U) + 1U];
+                palette[i][2] = data[(i * 3U) + 2U];
+            }
+        }
+        else if (0 == memcmp(type, "tRNS", 4U))
+        {
+            if (3U == color_type)
+            {
+                for (uint32_t i = 0; (i < length) && (i < 256U); i++)
+                {
+                    palette[i][3] = data[i];
+                }
+            }
+            else
+            {
+                for (uint32_t i = 0; (i < 3U) && (((i * 2U) + 1U) < length); i++)
+                {
+                    key[i] = (uint16_t)((data[i * 2U] << 8) | data[(i * 2U) + 1U]);
+                }
+                has_key = true;
+            }
+        }
+        else if (0 == memcmp(type, "IDAT", 4U))
+        {
+            idat = realloc(idat, idat_size + length);
+            if (NULL == idat)
+            {
+                fail("out of memory", NULL);
+            }
+            memcpy(&idat[idat_size], data, length);
+            idat_size += length;
+        }
+        else if (0 == memcmp(type, "IEND", 4U))
+        {
+            break;
+        }
+        offset += (size_t)length + PNG_CHUNK_OVERHEAD;
+    }
+    if ((0U == channels) || (NULL == idat))
+    {
+        fail("PNG file without image data", path);
+    }
+
+    /* Inflate, every row starts with its filter type */
+    row_bytes = (size_t)asset->width * channels;
+    raw_size = (uLongf)((row_bytes + 1U) * asset->height);
+    raw = malloc(raw_size);
+    asset->pixels = malloc((size_t)asset->width * asset->height * sizeof(uint32_t));
+    if ((NULL == raw) || (NULL == asset->pixels))
+    {
+        fail("out of memory", NULL);
+    }
+    if ((Z_OK != uncompress(raw, &raw_size, idat, idat_size)) ||
+        (raw_size != ((row_bytes + 1U) * asset->height)))
+    {
+        fail("corrupt PNG image data", path);
+    }
+
+    for (uint32_t y = 0; y < asset->height; y++)
+    {
+        uint8_t *row = &raw[(y * (row_bytes + 1U)) + 1U];
+        const uint8_t *above = (y > 0U) ? &raw[((y - 1U) * (row_bytes + 1U)) + 1U] : NULL;
+        uint8_t filter = row[-1];
+
+        for (size_t i = 0; i < row_bytes; i++)
+        {
+            uint8_t a = (i >= channels) ? row[i - channels] : 0U;
+            uint8_t b = (NULL != above) ? above[i] : 0U;
+            uint8_t c = ((NULL != above) && (i >= channels)) ? above[i - channels] : 0U;
+
+            switch (filter)
+            {
+                case 0U: break;
+                case 1U: row[i] = (uint8_t)(row[i] + a); break;
+                case 2U: row[i] = (uint8_t)(row[i] + b); break;
+                case 3U: row[i] = (uint8_t)(row[i] + (((uint32_t)a + b) / 2U)); break;
+                case 4U: row[i] = (uint8_t)(row[i] + paeth(a, b, c)); break;
+                default: fail("unknown PNG filter", path); break;
+            }
+        }
+
+        for (uint32_t x = 0; x < asset->width; x++)
+        {
+            const uint8_t *p = &row[x * channels];
+            uint32_t r;
+            uint32_t g;
+            uint32_t b;
+            uint32_t alpha = 0xFFU;
+
+            switch (color_type)
+            {
+                case 0U:
+                    r = g = b = p[0];
+                    alpha = (has_key && (key[0] == p[0])) ? 0U : 0xFFU;
+                    break;
+                case 2U:
+                    r = p[0];
+                    g = p[1];
+                    b = p[2];
+                    alpha = (has_key && (key[0] == r) && (key[1] == g) && (key[2] == b)) ?
+                            0U : 0xFFU;
+                    break;
+                case 3U:
+                    r = palette[p[0]][0];
+                    g = palette[p[0]][1];
+                    b = palette[p[0]][2];
+                    alpha = palette[p[0]][3];
+                    break;
+                case 4U:
+                    r = g = b = p[0];
+                    alpha = p[1];
+                    break;
+                default:
+                    r = p[0];
+                    g = p[1];
+                    b = p[2];
+                    alpha = p[3];
+                    break;
+            }
+            asset->pixels[(y * asset->width) + x] = (alpha << 24) | (r << 16) | (g << 8) | b;
+        }
+    }
+
+    free(raw);
+    free(idat);
+    free(file);
+}
+
+/*******************************************************************************
+* Function Name: premultiply
+********************************************************************************
+* Summary:
+*  Multiplies the color channels of a color by its alpha.
+*
+* Parameters:
+*  argb     - Straight alpha color, 0xAARRGGBB
+*
+* Return:
+*  uint32_t - Premultiplied color
+*
+*******************************************************************************/
+static uint32_t premultiply(uint32_t argb)
+{
+    uint32_t alpha = CHANNEL(argb, 0);
+    uint32_t result = alpha << 24;
+
+    for (uint32_t c = 1; c < 4U; c++)
+    {
+        result |= (((CHANNEL(argb, c) * alpha) + 127U) / 255U) << (24U - (8U * c));
+    }
+
+    return result;
+}
+
+/*******************************************************************************
+* Function Name: distance
+********************************************************************************
+* Summary:
+*  Squared distance of two colors. Color differences are weighted by the
+*  coverage of the pixels, they are invisible where the image is transparent.
+*
+* Parameters:
+*  a, b     - Colors, 0xAARRGGBB
+*
+* Return:
+*  uint32_t - Distance
+*
+*******************************************************************************/
+static uint32_t distance(uint32_t a, uint32_t b)
+{
+    int32_t alpha = (int32_t)CHANNEL(a, 0) - (int32_t)CHANNEL(b, 0);
+    uint32_t coverage = (CHANNEL(a, 0) > CHANNEL(b, 0)) ? CHANNEL(a, 0) : CHANNEL(b, 0);
+    uint32_t sum = 0U;
+
+    for (int c = 1; c < 4; c++)
+    {
+        int32_t d = (int32_t)CHANNEL(a, c) - (int32_t)CHANNEL(b, c);
+
+        sum += (uint32_t)(d * d);
+    }
+
+    return (uint32_t)(alpha * alpha) * 3U + ((sum * coverage) / 255U);
+}
+
+/*******************************************************************************
+* Function Name: nearest
+********************************************************************************
+* Summary:
+*  Returns the color lookup table entry closest to a color.
+*
+* Parameters:
+*  clut     - Color lookup table
+*  argb     - Color
+*
+* Return:
+*  uint32_t - Index
+*
+*******************************************************************************/
+static uint32_t nearest(const clut_t *clut, uint32_t argb)
+{
+    uint32_t best = 0U;
+    uint32_t best_distance = UINT32_MAX;
+
+    /* Entry 0 is transparent, it is exact for all fully transparent pixels */
+    if (0U == CHANNEL(argb, 0))
+    {
+        return 0U;
+    }
+    for (uint32_t i = 0; i < clut->size; i++)
+    {
+        uint32_t d = distance(argb, clut->entries[i]);
+
+        if (d < best_distance)
+        {
+            best_distance = d;
+            best = i;
+        }
+    }
+
+    return best;
+}
+
+/*******************************************************************************
+* Function Name: compare_argb
+********************************************************************************
+* Summary:
+*  qsort() comparison of two colors.
+*
+* Parameters:
+*  a, b  - Colors, 0xAARRGGBB
+*
+* Return:
+*  int   - Order of the colors
+*
+*******************************************************************************/
+static int compare_argb(const void *a, const void *b)
+{
+    uint32_t x = *(const uint32_t *)a;
+    uint32_t y = *(const uint32_t *)b;
+
+    return (x > y) - (x < y);
+}
+
+/*******************************************************************************
+* Function Name: compare_channel
+********************************************************************************
+* Summary:
+*  qsort() comparison of two distinct colors by the channel being split.
+*
+* Parameters:
+*  a, b  - Distinct colors
+*
+* Return:
+*  int   - Order of the colors
+*
+*******************************************************************************/
+static int compare_channel(const void *a, const void *b)
+{
+    uint32_t x = CHANNEL(((const color_t *)a)->argb, sort_channel);
+    uint32_t y = CHANNEL(((const color_t *)b)->argb, sort_channel);
+
+    /* Ties by color, qsort() is not stable */
+    return (x != y) ? ((x > y) - (x < y)) : compare_argb(a, b);
+}
+
+/*******************************************************************************
+* Function Name: measure_box
+********************************************************************************
+* Summary:
+*  Computes the mean color of a range of colors, its squared error and the
+*  channel along which the colors spread the most.
+*
+* Parameters:
+*  colors - Distinct colors
+*  box    - Range, error and channel are filled in
+*
+* Return:
+*  uint32_t - Mean color, 0xAARRGGBB
+*
+*******************************************************************************/
+static uint32_t measure_box(const color_t *colors, box_t *box)
+{
+    double sum[4] = { 0.0, 0.0, 0.0, 0.0 };
+    double square[4] = { 0.0, 0.0, 0.0, 0.0 };
+    double weight = 0.0;
+    double spread = -1.0;
+    uint32_t mean = 0U;
+
+    for (size_t i = box->first; i < (box->first + box->count); i++)
+    {
+        for (int c = 0; c < 4; c++)
+        {
+            double value = CHANNEL(colors[i].argb, c);
+
+            sum[c]    += value * colors[i].count;
+            square[c] += value * value * colors[i].count;
+        }
+        weight += colors[i].count;
+    }
+
+    box->error = 0.0;
+    for (int c = 0; c < 4; c++)
+    {
+        double error = square[c] - ((sum[c] * sum[c]) / weight);
+
+        box->error += error;
+        if (error > spread)
+        {
+            spread = error;
+            box->channel = c;
+        }
+        mean |= (uint32_t)lround(sum[c] / weight) << (24U - (8U * (uint32_t)c));
+    }
+    if (box->count < 2U)
+    {
+        box->error = 0.0;
+    }
+
+    return mean;
+}
+
+/*******************************************************************************
+* Function Name: build_clut
+********************************************************************************
+* Summary:
+*  Computes the color lookup table of the images of one index size. Entry 0
+*  is transparent, the others are found by median cut: the range of colors
+*  with the largest error is split at the median of its widest channel until
+*  the table is full, then the entries are refined by a few k-means passes.
+*
+* Parameters:
+*  clut  - Table, filled in
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void build_clut(clut_t *clut)
+{
+    size_t total = 0U;
+    size_t distinct = 0U;
+    uint32_t *all;
+    color_t *colors;
+    box_t boxes[MAX_CLUT_SIZE];
+    uint32_t box_count = 1U;
+    uint32_t size = 1UL << clut->bits;
+
+    for (size_t i = 0; i < asset_count; i++)
+    {
+        for (const asset_t *level = &assets[i]; NULL != level; level = level->next_level)
+        {
+            if (level->format->indexed && (level->format->bits == clut->bits))
+            {
+                total += (size_t)level->width * level->height;
+            }
+        }
+    }
+    all = malloc((total + 1U) * sizeof(uint32_t));
+    colors = malloc((total + 1U) * sizeof(color_t));
+    if ((NULL == all) || (NULL == colors))
+    {
+        fail("out of memory", NULL);
+    }
+
+    /* Distinct visible colors and their pixel counts */
+    total = 0U;
+    for (size_t i = 0; i < asset_count; i++)
+    {
+        for (const asset_t *level = &assets[i]; NULL != level; level = level->next_level)
+        {
+            if (!level->format->indexed || (level->format->bits != clut->bits))
+            {
+                continue;
+            }
+            for (size_t p = 0; p < ((size_t)level->width * level->height); p++)
+            {
+                if (0U != CHANNEL(level->pixels[p], 0))
+                {
+                    all[total++] = level->pixels[p];
+                }
+            }
+        }
+    }
+    qsort(all, total, sizeof(uint32_t), compare_argb);
+    for (size_t i = 0; i < total; i++)
+    {
+        if ((0U == distinct) || (colors[distinct - 1U].argb != all[i]))
+        {
+            colors[distinct].argb  = all[i];
+            colors[distinct].count = 0U;
+            distinct++;
+        }
+        colors[distinct - 1U].count++;
+    }
+    free(all);
+
+    clut->entries[0] = 0U;
+    clut->size = 1U;
+    if (0U == distinct)
+    {
+        free(colors);
+        return;
+    }
+
+    boxes[0].first = 0U;
+    boxes[0].count = distinct;
+    (void)measure_box(colors, &boxes[0]);
+    while (box_count < (size - 1U))
+    {
+        uint32_t worst = 0U;
+        size_t split;
+        uint64_t half = 0U;
+        uint64_t seen = 0U;
+
+        for (uint32_t b = 1; b < box_count; b++)
+        {
+            if (boxes[b].error > boxes[worst].error)
+            {
+                worst = b;
+            }
+        }
+        if (boxes[worst].error <= 0.0)
+        {
+            break;
+        }
+
+        /* Split at the median pixel, keeping both halves non empty */
+        sort_channel = boxes[worst].channel;
+        qsort(&colors[boxes[worst].first], boxes[worst].count, sizeof(color_t),
+              compare_channel);
+        for (size_t i = 0; i < boxes[worst].count; i++)
+        {
+            half += colors[boxes[worst].first + i].count;
+        }
+        half /= 2U;
+        for (split = 0U; split < (boxes[worst].count - 1U); split++)
+        {
+            seen += colors[boxes[worst].first + split].count;
+            if (seen >= half)
+            {
+                break;
+            }
+        }
+        split++;
+        if (split >= boxes[worst].count)
+        {
+            split = boxes[worst].count - 1U;
+        }
+
+        boxes[box_count].first = boxes[worst].first + split;
+        boxes[box_count].count = boxes[worst].count - split;
+        boxes[worst].count = split;
+        (void)measure_box(colors, &boxes[worst]);
+        (void)measure_box(colors, &boxes[box_count]);
+        box_count++;
+    }
+    for (uint32_t b = 0; b < box_count; b++)
+    {
+        clut->entries[clut->size++] = measure_box(colors, &boxes[b]);
+    }
+
+    for (uint32_t pass = 0; pass < REFINE_PASSES; pass++)
+    {
+        static double sum[MAX_CLUT_SIZE][4];
+        static double weight[MAX_CLUT_SIZE];
+
+        memset(sum, 0, sizeof(sum));
+        memset(weight, 0, sizeof(weight));
+        for (size_t i = 0; i < distinct; i++)
+        {
+            uint32_t index = nearest(clut, colors[i].argb);
+
+            for (int c = 0; c < 4; c++)
+            {
+                sum[index][c] += (double)CHANNEL(colors[i].argb, c) * colors[i].count;
+            }
+            weight[index] += colors[i].count;
+        }
+        for (uint32_t e = 1; e < clut->size; e++)
+        {
+            if (weight[e] > 0.0)
+            {
+                clut->entries[e] = 0U;
+                for (int c = 0; c < 4; c++)
+                {
+                    clut->entries[e] |= (uint32_t)lround(sum[e][c] / weight[e]) <<
+                                        (24U - (8U * (uint32_t)c));
+                }
+            }
+        }
+    }
+    free(colors);
+}
+
+/*******************************************************************************
+* Function Name: add_levels
+********************************************************************************
+* Summary:
+*  Appends the half resolution levels of an image. Each pixel of a level is
+*  the mean of up to 2x2 pixels of the previous one, weighted by alpha, which
+*  averages the premultiplied colors: transparent pixels do not darken the
+*  edges. Odd sizes are rounded up, the last row and column average fewer
+*  pixels.
+*
+* Parameters:
+*  asset - Full resolution image
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void add_levels(asset_t *asset)
+{
+    asset_t *source = asset;
+
+    for (uint32_t count = 1U; count < MAX_LEVELS; count++)
+    {
+        uint32_t width = (source->width + 1U) / 2U;
+        uint32_t height = (source->height + 1U) / 2U;
+        asset_t *level;
+
+        if (((width < height) ? width : height) < min_level_size)
+        {
+            break;
+        }
+        level = calloc(1U, sizeof(asset_t));
+        if (NULL == level)
+        {
+            fail("out of memory", NULL);
+        }
+        *level = *asset;
+        snprintf(level->name, sizeof(level->name), "%s_level%u", asset->name, count);
+        level->width = width;
+        level->height = height;
+        level->next_level = NULL;
+        level->pixels = malloc((size_t)width * height * sizeof(uint32_t));
+        if (NULL == level->pixels)
+        {
+            fail("out of memory", NULL);
+        }
+
+        for (uint32_t y = 0; y < height; y++)
+        {
+            for (uint32_t x = 0; x < width; x++)
+            {
+                uint32_t alpha = 0U;
+                uint32_t color[3] = { 0U, 0U, 0U };
+                uint32_t n = 0U;
+                uint32_t argb;
+
+                for (uint32_t sy = 2U * y; sy < ((2U * y) + 2U) && (sy < source->height); sy++)
+                {
+                    for (uint32_t sx = 2U * x; sx < ((2U * x) + 2U) && (sx < source->width); sx++)
+                    {
+                        argb = source->pixels[((size_t)sy * source->width) + sx];
+                        alpha += CHANNEL(argb, 0);
+                        for (uint32_t c = 1; c < 4U; c++)
+                        {
+                            color[c - 1U] += CHANNEL(argb, c) * CHANNEL(argb, 0);
+                        }
+                        n++;
+                    }
+                }
+
+                argb = ((alpha + (n / 2U)) / n) << 24;
+                for (uint32_t c = 1; (c < 4U) && (0U != alpha); c++)
+                {
+                    argb |= ((color[c - 1U] + (alpha / 2U)) / alpha) << (24U - (8U * c));
+                }
+                level->pixels[((size_t)y * width) + x] = argb;
+            }
+        }
+
+        source->next_level = level;
+        source = level;
+    }
+}
+
+/*******************************************************************************
+* Function Name: pack_asset
+********************************************************************************
+* Summary:
+*  Converts the pixels of an image into its output format, rows padded to the
+*  stride alignment. Multi byte pixels are little endian, sub byte formats
+*  hold the first pixel in the low nibble. Returns the error of the prepared
+*  image against the source, both composited over black.
+*
+* Parameters:
+*  asset        - Image
+*  stride_align - Row pitch alignment in bytes
+*
+* Return:
+*  double - Peak signal to noise ratio in dB, INFINITY if exact
+*
+*******************************************************************************/
+static double pack_asset(asset_t *asset, uint32_t stride_align)
+{
+    const output_format_t *format = asset->format;
+    const clut_t *clut = &cluts[(8U == format->bits) ? 0 : 1];
+    double sum[3] = { 0.0, 0.0, 0.0 };
+    double weight = 0.0;
+    double error = 0.0;
+    size_t pixels = (size_t)asset->width * asset->height;
+
+    asset->stride = ((((asset->width * format->bits) + 7U) / 8U) + stride_align - 1U) &
+                    ~(stride_align - 1U);
+    asset->packed = calloc((size_t)asset->stride * asset->height, 1U);
+    if (NULL == asset->packed)
+    {
+        fail("out of memory", NULL);
+    }
+
+    /* Tint of the alpha formats, the coverage weighted mean color */
+    for (size_t p = 0; p < pixels; p++)
+    {
+        for (int c = 1; c < 4; c++)
+        {
+            sum[c - 1] += (double)CHANNEL(asset->pixels[p], c) * CHANNEL(asset->pixels[p], 0);
+        }
+        weight += CHANNEL(asset->pixels[p], 0);
+    }
+    asset->tint = 0xFF000000U;
+    for (int c = 1; c < 4; c++)
+    {
+        asset->tint |= (uint32_t)((weight > 0.0) ? lround(sum[c - 1] / weight) : 0L) <<
+                       (24U - (8U * (uint32_t)c));
+    }
+
+    for (uint32_t y = 0; y < asset->height; y++)
+    {
+        uint8_t *row = &asset->packed[(size_t)y * asset->stride];
+
+        for (uint32_t x = 0; x < asset->width; x++)
+        {
+            uint32_t argb = asset->pixels[((size_t)y * asset->width) + x];
+            uint32_t stored = asset->premultiply ? premultiply(argb) : argb;
+            uint32_t value;
+            uint32_t shown;     /* Premultiplied color the GPU blends */
+
+            if (format->indexed)
+            {
+                value = nearest(clut, argb);
+                shown = premultiply(clut->entries[value]);
+            }
+            else if (format->alpha)
+            {
+                value = CHANNEL(argb, 0);
+                value = (4U == format->bits) ? (((value * 15U) + 127U) / 255U) : value;
+                shown = premultiply((asset->tint & 0x00FFFFFFU) |
+                                    (((4U == format->bits) ? (value * 17U) : value) << 24));
+            }
+            else if (16U == format->bits)
+            {
+                /* Opaque, the premultiplied color is the color over black */
+                value = ((CHANNEL(stored, 1) >> 3) << 11) | ((CHANNEL(stored, 2) >> 2) << 5) |
+                        (CHANNEL(stored, 3) >> 3);
+                shown = 0xFF000000U |
+                        ((((value >> 11) << 3) | (value >> 13)) << 16) |
+                        (((((value >> 5) & 0x3FU) << 2) | ((value >> 9) & 0x3U)) << 8) |
+                        (((value & 0x1FU) << 3) | ((value >> 2) & 0x7U));
+                if (!asset->premultiply)
+                {
+                    shown = premultiply((shown & 0x00FFFFFFU) | (argb & 0xFF000000U));
+                }
+            }
+            else
+            {
+                value = stored;
+                shown = premultiply(argb);
+            }
+
+            switch (format->bits)
+            {
+                case 32U:
+                    row[(x * 4U) + 0U] = (uint8_t)value;
+                    row[(x * 4U) + 1U] = (uint8_t)(value >> 8);
+                    row[(x * 4U) + 2U] = (uint8_t)(value >> 16);
+                    row[(x * 4U) + 3U] = (uint8_t)(value >> 24);
+                    break;
+                case 16U:
+                    row[(x * 2U) + 0U] = (uint8_t)value;
+                    row[(x * 2U) + 1U] = (uint8_t)(value >> 8);
+                    break;
+                case 8U:
+                    row[x] = (uint8_t)value;
+                    break;
+                default:
+                    row[x / 2U] |= (uint8_t)(value << ((x & 1U) * 4U));
+                    break;
+            }
+
+            for (int c = 1; c < 4; c++)
+            {
+                double d = (((double)CHANNEL(argb, c) * CHANNEL(argb, 0)) / 255.0) -
+                           (double)CHANNEL(shown, c);
+
+                error += d * d;
+            }
+        }
+    }
+
+    error /= (double)pixels * 3.0;
+
+    return (error > 0.0) ? (10.0 * log10((255.0 * 255.0) / error)) : INFINITY;
+}
+
+/*******************************************************************************
+* Function Name: emit_asset
+********************************************************************************
+* Summary:
+*  Writes the pixel data and the descriptor of an image, after those of its
+*  half resolution levels, which it points to. The size and error of each
+*  level is written to stderr.
+*
+* Parameters:
+*  asset        - Image
+*  name         - Prefix of the shared symbols
+*  stride_align - Row pitch alignment in bytes
+*  source_bytes - Incremented by the size of the image as ARGB8888
+*  packed_bytes - Incremented by the size of the prepared image
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void emit_asset(asset_t *asset, const char *name, uint32_t stride_align,
+                       size_t *source_bytes, size_t *packed_bytes)
+{
+    double psnr;
+    size_t bytes;
+    uint32_t tint;
+
+    if (NULL != asset->next_level)
+    {
+        emit_asset(asset->next_level, name, stride_align, source_bytes, packed_bytes);
+    }
+
+    psnr = pack_asset(asset, stride_align);
+    bytes = (size_t)asset->stride * asset->height;
+    /* vg_lite_color_t is 0xAABBGGRR */
+    tint = (asset->tint & 0xFF00FF00U) | ((asset->tint >> 16) & 0xFFU) |
+           ((asset->tint & 0xFFU) << 16);
+
+    printf("/* %s, %ux%u %s, stride %u%s */\n"
+           "CY_SECTION(\".cy_socmem_data\") uint8_t %s_pixels[] __attribute__((aligned(%u))) =\n{",
+           asset->file, asset->width, asset->height, asset->format->vg_format, asset->stride,
+           asset->premultiply ? ", premultiplied" : "", asset->name, DATA_ALIGN);
+    for (size_t b = 0; b < bytes; b++)
+    {
+        printf("%s0x%02X,", (0U == (b % 16U)) ? "\n    " : " ", asset->packed[b]);
+    }
+    printf("\n};\n\n"
+           "const image_asset_t %s_asset =\n"
+           "{\n"
+           "    .name          = \"%s\",\n"
+           "    .format        = %s,\n"
+           "    .width         = %u,\n"
+           "    .height        = %u,\n"
+           "    .stride        = %u,\n"
+           "    .data          = %s_pixels,\n"
+           "    .clut          = %s%s%s,\n"
+           "    .clut_count    = %uU,\n"
+           "    .tint          = 0x%08XU,\n"
+           "    .premultiplied = %s,\n"
+           "    .next_level    = %s%s%s\n"
+           "};\n\n",
+           asset->name, asset->name, asset->format->vg_format, asset->width, asset->height,
+           asset->stride, asset->name,
+           asset->format->indexed ? name : "NULL", asset->format->indexed ? "_clut" : "",
+           asset->format->indexed ? ((8U == asset->format->bits) ? "8" : "4") : "",
+           asset->format->indexed ? (1U << asset->format->bits) : 0U,
+           asset->format->alpha ? tint : 0U, asset->premultiply ? "true" : "false",
+           (NULL != asset->next_level) ? "&" : "NULL",
+           (NULL != asset->next_level) ? asset->next_level->name : "",
+           (NULL != asset->next_level) ? "_asset" : "");
+
+    *source_bytes += (size_t)asset->width * asset->height * 4U;
+    *packed_bytes += bytes;
+    fprintf(stderr, "%s: %ux%u %s, stride %u, %zu bytes, ", asset->name, asset->width,
+            asset->height, asset->format->option, asset->stride, bytes);
+    if (isinf(psnr))
+    {
+        fprintf(stderr, "lossless\n");
+    }
+    else
+    {
+        fprintf(stderr, "PSNR %.1f dB\n", psnr);
+    }
+}
+
+/*******************************************************************************
+* Function Name: read_manifest
+********************************************************************************
+* Summary:
+*  Reads the manifest and decodes the images it lists. Each line holds the
+*  symbol name, the PNG file relative to the manifest, the output format and
+*  optionally "premultiply" and "mipmap". Text after '#' is a comment.
+*
+* Parameters:
+*  path  - Manifest file name
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void read_manifest(const char *path)
+{
+    char *text = (char *)read_file(path, NULL);
+    const char *slash = strrchr(path, '/');
+    int directory = (NULL != slash) ? (int)(slash - path + 1) : 0;
+    char *line = text;
+
+    while (NULL != line)
+    {
+        char *next = strchr(line, '\n');
+        char *fields[5] = { NULL, NULL, NULL, NULL, NULL };
+        size_t field_count = 0U;
+        asset_t *asset;
+        char file[MAX_PATH_LENGTH + MAX_PATH_LENGTH];
+        char *token;
+        bool premultiply_option = false;
+        bool mipmap_option = false;
+
+        if (NULL != next)
+        {
+            *next++ = '\0';
+        }
+        if (NULL != strchr(line, '#'))
+        {
+            *strchr(line, '#') = '\0';
+        }
+        for (token = strtok(line, " \t\r"); NULL != token; token = strtok(NULL, " \t\r"))
+        {
+            if (field_count >= 5U)
+            {
+                fail("too many fields", token);
+            }
+            fields[field_count++] = token;
+        }
+        line = next;
+        if (0U == field_count)
+        {
+            continue;
+        }
+        if ((field_count < 3U) || (asset_count >= MAX_ASSETS) ||
+            (strlen(fields[0]) >= (MAX_NAME_LENGTH - LEVEL_SUFFIX_LENGTH)) ||
+            (strlen(fields[1]) >= MAX_PATH_LENGTH))
+        {
+            fail("manifest line not understood", fields[0]);
+        }
+        for (size_t i = 3; i < field_count; i++)
+        {
+            premultiply_option = premultiply_option || (0 == strcmp(fields[i], "premultiply"));
+            mipmap_option = mipmap_option || (0 == strcmp(fields[i], "mipmap"));
+            if ((0 != strcmp(fields[i], "premultiply")) && (0 != strcmp(fields[i], "mipmap")))
+            {
+                fail("unknown option", fields[i]);
+            }
+        }
+
+        asset = &assets[asset_count];
+        for (size_t i = 0; fields[0][i] != '\0'; i++)
+        {
+            if (!(isalnum((unsigned char)fields[0][i]) || ('_' == fields[0][i])) ||
+                ((0U == i) && isdigit((unsigned char)fields[0][i])))
+            {
+                fail("name is not a C identifier", fields[0]);
+            }
+        }
+        for (size_t i = 0; i < asset_count; i++)
+        {
+            if (0 == strcmp(assets[i].name, fields[0]))
+            {
+                fail("duplicate name", fields[0]);
+            }
+        }
+        strcpy(asset->name, fields[0]);
+        strcpy(asset->file, fields[1]);
+        for (size_t i = 0; i < (sizeof(formats) / sizeof(formats[0])); i++)
+        {
+            if (0 == strcmp(fields[2], formats[i].option))
+            {
+                asset->format = &formats[i];
+            }
+        }
+        if (NULL == asset->format)
+        {
+            fail("unknown format", fields[2]);
+        }
+        /* Alpha formats hold no color to premultiply */
+        asset->premultiply = premultiply_option && !asset->format->alpha;
+
+        snprintf(file, sizeof(file), "%.*s%s", directory, path, fields[1]);
+        read_png(asset, file);
+        if (mipmap_option)
+        {
+            add_levels(asset);
+        }
+        asset_count++;
+    }
+    free(text);
+
+    if (0U == asset_count)
+    {
+        fail("no image listed", path);
+    }
+}
+
+/*******************************************************************************
+* Function Name: usage
+********************************************************************************
+* Summary:
+*  Prints the command line help and terminates the tool.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void usage(void)
+{
+    fprintf(stderr,
+            "usage: img2vglite [-n name] [-a align] [-m size] manifest > output.h\n"
+            "  -n name   prefix of the shared symbols, default: image_assets\n"
+            "  -a align  row pitch alignment in bytes, default: %u\n"
+            "  -m size   smallest side of a half resolution level, default: %u\n"
+            "Each manifest line holds: name file.png format [premultiply] [mipmap]\n"
+            "  format    argb8888, bgr565, index8, index4, a8 or a4\n"
+            "  mipmap    adds half resolution levels, at most %u levels in total\n"
+            "Indexed images of one index size share a color lookup table, alpha\n"
+            "images are drawn in their average color.\n", DEFAULT_STRIDE_ALIGN,
+            DEFAULT_MIN_LEVEL_SIZE, MAX_LEVELS);
+    exit(EXIT_FAILURE);
+}
+
+/*******************************************************************************
+* Function Name: main
+********************************************************************************
+* Summary:
+*  Prepares the images of a manifest into one C header written to stdout.
+*  The size and error of each image is written to stderr.
+*
+* Parameters:
+*  argc - Number of arguments
+*  argv - Arguments
+*
+* Return:
+*  int  - 0 on success
+*
+*******************************************************************************/
+int main(int argc, char *argv[])
+{
+    const char *name = "image_assets";
+    uint32_t stride_align = DEFAULT_STRIDE_ALIGN;
+    char upper[MAX_NAME_LENGTH];
+    size_t source_bytes = 0U;
+    size_t packed_bytes = 0U;
+    int c;
+
+    while (-1 != (c = getopt(argc, argv, "n:a:m:")))
+    {
+        switch (c)
+        {
+            case 'n':
+                name = optarg;
+                break;
+            case 'a':
+                stride_align = (uint32_t)strtoul(optarg, NULL, 0);
+                if ((0U == stride_align) || (0U != (stride_align & (stride_align - 1U))))
+                {
+                    usage();
+                }
+                break;
+            case 'm':
+                min_level_size = (uint32_t)strtoul(optarg, NULL, 0);
+                if (0U == min_level_size)
+                {
+                    usage();
+                }
+                break;
+            default:
+                usage();
+                break;
+        }
+    }
+    if ((optind != (argc - 1)) || (strlen(name) >= MAX_NAME_LENGTH))
+    {
+        usage();
+    }
+    read_manifest(argv[optind]);
+
+    /* One table per index size, premultiplied if its images are */
+    for (size_t i = 0; i < asset_count; i++)
+    {
+        clut_t *clut = &cluts[(8U == assets[i].format->bits) ? 0 : 1];
+
+        if (!assets[i].format->indexed)
+        {
+            continue;
+        }
+        if (clut->used && (clut->premultiplied != assets[i].premultiply))
+        {
+            fail("images sharing a color lookup table differ in premultiply", assets[i].name);
+        }
+        clut->used = true;
+        clut->premultiplied = assets[i].premultiply;
+    }
+    for (size_t t = 0; t < 2U; t++)
+    {
+        if (cluts[t].used)
+        {
+            build_clut(&cluts[t]);
+        }
+    }
+
+    for (size_t i = 0; name[i] != '\0'; i++)
+    {
+        upper[i] = (char)toupper((unsigned char)name[i]);
+        upper[i + 1U] = '\0';
+    }
+
+    printf("/*******************************************************************************\n"
+           "* Generated by tools/host/img2vglite from %s, do not edit.\n"
+           "* Defines the pixel data, include it in one source file only.\n"
+           "*******************************************************************************/\n\n"
+           "#ifndef %s_H\n#define %s_H\n\n"
+           "#if defined(__cplusplus)\nextern \"C\" {\n#endif\n\n"
+           "#include <stdint.h>\n#include \"image_asset.h\"\n\n"
+           "/*******************************************************************************\n"
+           "* Macros\n"
+           "*******************************************************************************/\n"
+           "#define %s_COUNT%*s(%zuU)\n"
+           "#define %s_STRIDE_ALIGN%*s(%uU)\n\n"
+           "/*******************************************************************************\n"
+           "* Global Variables\n"
+           "*******************************************************************************/\n",
+           argv[optind], upper, upper, upper, macro_padding(upper, "_COUNT"), "", asset_count,
+           upper, macro_padding(upper, "_STRIDE_ALIGN"), "", stride_align);
+
+    for (size_t t = 0; t < 2U; t++)
+    {
+        uint32_t size = 1UL << cluts[t].bits;
+
+        if (!cluts[t].used)
+        {
+            continue;
+        }
+        printf("/* Color lookup table of the %u bit indexed images, 0xAARRGGBB%s,\n"
+               " * entry 0 is transparent */\n"
+               "const uint32_t %s_clut%u[%uU] =\n{", cluts[t].bits,
+               cluts[t].premultiplied ? " premultiplied" : "", name, cluts[t].bits, size);
+        for (uint32_t i = 0; i < size; i++)
+        {
+            uint32_t entry = (i < cluts[t].size) ? cluts[t].entries[i] : 0U;
+
+            printf("%s0x%08XU,", (0U == (i % 8U)) ? "\n    " : " ",
+                   cluts[t].premultiplied ? premultiply(entry) : entry);
+        }
+        printf("\n};\n\n");
+        packed_bytes += size * sizeof(uint32_t);
+    }
+
+    for (size_t i = 0; i < asset_count; i++)
+    {
+        emit_asset(&assets[i], name, stride_align, &source_bytes, &packed_bytes);
+    }
+
+    printf("const image_asset_t *const %s[%s_COUNT] =\n{\n", name, upper);
+    for (size_t i = 0; i < asset_count; i++)
+    {
+        printf("    &%s_asset,\n", assets[i].name);
+    }
+    printf("};\n\n#if defined(__cplusplus)\n}\n#endif\n\n#endif /* %s_H */\n\n"
+           "/* [] END OF FILE */\n", upper);
+
+    fprintf(stderr, "%zu image(s): %zu bytes, %zu bytes as ARGB8888\n", asset_count,
+            packed_bytes, source_bytes);
+
+    return EXIT_SUCCESS;
+}
+
+/* [] END OF FILE */
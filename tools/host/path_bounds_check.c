@@ -0,0 +1,314 @@
+/*******************************************************************************
+* File Name        : path_bounds_check.c
+*
+* Description      : Host check of the path bounds engine: the bounds of every demo path
+*                    contain its flattened curves, and draws outside the target or the
+*                    scissor are culled.
+*
+* Related Document : See README.md
+*
+********************************************************************************
+* Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "path_bounds.h"
+#include "path_narrow.h"
+#include "cmd_list.h"
+#include "vg_lite_stub.h"
+#include "infineon_logo_paths.h"
+#include "shape_paths.h"
+#include "host_check.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+#define SCREEN_WIDTH                        (800)
+#define SCREEN_HEIGHT                       (480)
+
+/* Points evaluated on each curve segment */
+#define CURVE_STEPS                         (64U)
+
+/*******************************************************************************
+* Data Structures and Types
+*******************************************************************************/
+typedef struct {
+    const char *name;
+    vg_lite_path_t *path;
+} named_path_t;
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+static const named_path_t demo_paths[] =
+{
+    { "logo 0",             &path[0] },
+    { "logo 1",             &path[1] },
+    { "polygon",            &polygon_path },
+    { "star",               &self_intersecting_star_path },
+    { "squares",            &overlapping_squares_path },
+    { "circles",            &concentric_circles_path },
+    { "triangle",           &triangle_path },
+    { "pentagon",           &pentagon_path },
+    { "hexagon",            &hexagon_path },
+    { "highlight",          &highlight_path },
+    { "square",             &square_path }
+};
+
+static vg_lite_buffer_t frame = { .width = SCREEN_WIDTH, .height = SCREEN_HEIGHT,
+                                  .stride = SCREEN_WIDTH * 4, .format = VG_LITE_ARGB8888,
+                                  .address = 0x10000U };
+
+static path_bounds_t bounds;
+
+
+/*******************************************************************************
+* Function Name: inside
+********************************************************************************
+* Summary:
+*  Checks that a point lies within a bounding box.
+*
+* Parameters:
+*  box  - Bounding box, left, top, right, bottom
+*  x, y - Point
+*
+* Return:
+*  bool - true if the point is inside or on the border
+*
+*******************************************************************************/
+static bool inside(const vg_lite_float_t box[4], float x, float y)
+{
+    const float eps = 0.001f;
+
+    return (x >= (box[0] - eps)) && (y >= (box[1] - eps)) &&
+           (x <= (box[2] + eps)) && (y <= (box[3] + eps));
+}
+
+/*******************************************************************************
+* Function Name: curves_inside
+********************************************************************************
+* Summary:
+*  Flattens every segment of a path independently of the bounds engine and
+*  checks that all points lie within the given box.
+*
+* Parameters:
+*  p   - Path
+*  box - Bounding box
+*
+* Return:
+*  bool - true if the whole outline is inside
+*
+*******************************************************************************/
+static bool curves_inside(const vg_lite_path_t *p, const vg_lite_float_t box[4])
+{
+    uint32_t count = path_data_count(p);
+    uint32_t i = 0U;
+    float x = 0.0f;
+    float y = 0.0f;
+    float sx = 0.0f;
+    float sy = 0.0f;
+    float c[6];
+    bool ok = true;
+
+    while (ok && (i < count))
+    {
+        int32_t op = path_data_get(p, i++);
+        uint32_t n = ((VLC_OP_QUAD == op) || (VLC_OP_QUAD_REL == op)) ? 4U :
+                     (((VLC_OP_CUBIC == op) || (VLC_OP_CUBIC_REL == op)) ? 6U :
+                     (((op >= VLC_OP_MOVE) && (op <= VLC_OP_LINE_REL)) ? 2U : 0U));
+        bool rel = (VLC_OP_MOVE_REL == op) || (VLC_OP_LINE_REL == op) ||
+                   (VLC_OP_QUAD_REL == op) || (VLC_OP_CUBIC_REL == op);
+
+        for (uint32_t k = 0; k < n; k++)
+        {
+            c[k] = (float)path_data_get(p, i++) + (rel ? ((0U == (k % 2U)) ? x : y) : 0.0f);
+        }
+
+        for (uint32_t s = 1; ok && (n > 2U) && (s < CURVE_STEPS); s++)
+        {
+            float t = (float)s / (float)CURVE_STEPS;
+            float u = 1.0f - t;
+            float px;
+            float py;
+
+            if (4U == n)
+            {
+                px = (u * u * x) + (2.0f * u * t * c[0]) + (t * t * c[2]);
+                py = (u * u * y) + (2.0f * u * t * c[1]) + (t * t * c[3]);
+            }
+            else
+            {
+                px = (u * u * u * x) + (3.0f * u * u * t * c[0]) + (3.0f * u * t * t * c[2]) +
+                     (t * t * t * c[4]);
+                py = (u * u * u * y) + (3.0f * u * u * t * c[1]) + (3.0f * u * t * t * c[3]) +
+                     (t * t * t * c[5]);
+            }
+            ok = inside(box, px, py);
+        }
+
+        if (VLC_OP_CLOSE == op)
+        {
+            x = sx;
+            y = sy;
+        }
+        else if (0U != n)
+        {
+            x = c[n - 2U];
+            y = c[n - 1U];
+            ok = ok && inside(box, x, y);
+            if ((VLC_OP_MOVE == op) || (VLC_OP_MOVE_REL == op))
+            {
+                sx = x;
+                sy = y;
+            }
+        }
+    }
+
+    return ok;
+}
+
+/*******************************************************************************
+* Function Name: cull_draw
+********************************************************************************
+* Summary:
+*  Command hook, as registered by the application.
+*
+* Parameters:
+*  path      - Path about to be drawn
+*  matrix    - Draw matrix
+*  target    - Render target
+*  user_data - Bounds engine
+*
+* Return:
+*  bool      - false to skip the draw
+*
+*******************************************************************************/
+static bool cull_draw(vg_lite_path_t *path, const vg_lite_matrix_t *matrix,
+                      vg_lite_buffer_t *target, void *user_data)
+{
+    return path_bounds_visible((path_bounds_t *)user_data, path, matrix, target, NULL);
+}
+
+/*******************************************************************************
+* Function Name: main
+********************************************************************************
+* Summary:
+*  Runs the path bounds checks.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  int - 0 if all checks passed
+*
+*******************************************************************************/
+int main(void)
+{
+    path_bounds_stats_t stats;
+    vg_lite_float_t computed[4];
+    vg_lite_float_t declared[4];
+    vg_lite_matrix_t matrix;
+    damage_rect_t scissor = { 0, 0, 100, 100 };
+    cmd_t draw = { .op = CMD_OP_DRAW, .target = CMD_TARGET_FRAME,
+                   .u.draw.path = &polygon_path };
+    vg_lite_stub_stats_t stub;
+    float area_before = 0.0f;
+    float area_after = 0.0f;
+    bool ok;
+
+    path_bounds_init(&bounds);
+
+    for (uint32_t n = 0; n < (sizeof(demo_paths) / sizeof(demo_paths[0])); n++)
+    {
+        vg_lite_float_t *box = demo_paths[n].path->bounding_box;
+
+        memcpy(declared, box, sizeof(declared));
+        ok = path_bounds_compute(demo_paths[n].path, computed) &&
+             curves_inside(demo_paths[n].path, computed);
+        ok = ok && path_bounds_fit(&bounds, demo_paths[n].path) &&
+             (0 == memcmp(box, computed, sizeof(computed)));
+        printf("%-10s %6.0f,%4.0f - %5.0f,%4.0f  ->  %6.0f,%4.0f - %5.0f,%4.0f\r\n",
+               demo_paths[n].name, declared[0], declared[1], declared[2], declared[3],
+               box[0], box[1], box[2], box[3]);
+        check(ok, "outline within the fitted bounds");
+
+        area_before += (declared[2] - declared[0]) * (declared[3] - declared[1]);
+        area_after += (box[2] - box[0]) * (box[3] - box[1]);
+    }
+    printf("Bounding box area: %.0f -> %.0f (%.0f%%)\r\n", area_before, area_after,
+           (area_after * 100.0f) / area_before);
+
+    /* Culling against the target */
+    vg_lite_identity(&matrix);
+    check(path_bounds_visible(&bounds, &polygon_path, &matrix, &frame, NULL), "draw on screen");
+    vg_lite_translate(SCREEN_WIDTH, 0.0f, &matrix);
+    check(!path_bounds_visible(&bounds, &polygon_path, &matrix, &frame, NULL),
+          "draw right of the target culled");
+    vg_lite_identity(&matrix);
+    vg_lite_translate(-400.0f, -400.0f, &matrix);
+    check(!path_bounds_visible(&bounds, &polygon_path, &matrix, &frame, NULL),
+          "draw above the target culled");
+
+    /* Culling against the scissor, the polygon starts at (50, 60) */
+    vg_lite_identity(&matrix);
+    vg_lite_translate(100.0f, 100.0f, &matrix);
+    path_bounds_set_scissor(&bounds, &scissor);
+    check(!path_bounds_visible(&bounds, &polygon_path, &matrix, &frame, NULL),
+          "draw outside the scissor culled");
+    path_bounds_set_scissor(&bounds, NULL);
+    check(path_bounds_visible(&bounds, &polygon_path, &matrix, &frame, NULL),
+          "visible again without scissor");
+
+    path_bounds_end_frame(&bounds);
+    path_bounds_get_stats(&bounds, &stats, true);
+    check((5U == stats.draws) && (3U == stats.culled) && (1U == stats.frames), "statistics");
+    check(stats.area_saved > 0, "tessellation area saved");
+    printf("      %d px not tessellated\r\n", (int)stats.area_saved);
+
+    /* Through the command hook: culled draws never reach vg_lite */
+    cmd_set_path_hook(cull_draw, &bounds);
+    vg_lite_stub_get_stats(&stub, true);
+    vg_lite_identity(&draw.matrix);
+    check(VG_LITE_SUCCESS == cmd_execute(&draw, &frame), "visible draw executed");
+    vg_lite_translate(SCREEN_WIDTH, 0.0f, &draw.matrix);
+    check(VG_LITE_SUCCESS == cmd_execute(&draw, &frame), "culled draw succeeds");
+    vg_lite_stub_get_stats(&stub, true);
+    check(1U == stub.draw, "culled draw not issued");
+    cmd_set_path_hook(NULL, NULL);
+
+    return check_summary();
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,240 @@
+/*******************************************************************************
+* File Name        : path_cache_check.c
+*
+* Description      : Host check of the path cache: paths are uploaded once, draws of
+*                    resident paths are hits, changed paths are uploaded again, the least
+*                    recently used paths are evicted to stay within the budget and a path
+*                    the GPU may still read is only freed after waiting for the GPU.
+*
+* Related Document : See README.md
+*
+********************************************************************************
+* Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "cmd_list.h"
+#include "path_cache.h"
+#include "vg_lite_stub.h"
+#include "host_check.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+#define SCREEN_WIDTH                        (800)
+#define SCREEN_HEIGHT                       (480)
+#define BUDGET_BYTES                        (600U)
+#define SMALL_PATH_BYTES                    (100U)
+#define MEDIUM_PATH_BYTES                   (200U)
+#define LARGE_PATH_BYTES                    (300U)
+#define STEADY_FRAMES                       (10U)
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+static vg_lite_buffer_t frame = { .width = SCREEN_WIDTH, .height = SCREEN_HEIGHT,
+                                  .stride = SCREEN_WIDTH * 4, .format = VG_LITE_ARGB8888,
+                                  .address = 0x10000U };
+static uint8_t small_data[SMALL_PATH_BYTES];
+static uint8_t medium_data[MEDIUM_PATH_BYTES];
+static uint8_t large_data[LARGE_PATH_BYTES];
+static vg_lite_path_t small = { .format = VG_LITE_S8, .path_length = SMALL_PATH_BYTES,
+                                .path = small_data, .path_changed = 1 };
+static vg_lite_path_t medium = { .format = VG_LITE_S8, .path_length = MEDIUM_PATH_BYTES,
+                                 .path = medium_data, .path_changed = 1 };
+static vg_lite_path_t large = { .format = VG_LITE_S8, .path_length = LARGE_PATH_BYTES,
+                                .path = large_data, .path_changed = 1 };
+
+static path_cache_t cache;
+
+/*******************************************************************************
+* Function Name: use_cached_path
+********************************************************************************
+* Summary:
+*  Command hook, as registered by the application.
+*
+* Parameters:
+*  path      - Path about to be drawn
+*  matrix    - Draw matrix
+*  target    - Render target
+*  user_data - Path cache
+*
+* Return:
+*  bool      - true, every draw is issued
+*
+*******************************************************************************/
+static bool use_cached_path(vg_lite_path_t *path, const vg_lite_matrix_t *matrix,
+                            vg_lite_buffer_t *target, void *user_data)
+{
+    (void)matrix;
+    (void)target;
+    path_cache_use((path_cache_t *)user_data, path);
+
+    return true;
+}
+
+/*******************************************************************************
+* Function Name: draw
+********************************************************************************
+* Summary:
+*  Executes a draw command of a path.
+*
+* Parameters:
+*  path - Path
+*
+* Return:
+*  bool - true if the draw succeeded
+*
+*******************************************************************************/
+static bool draw(vg_lite_path_t *path)
+{
+    cmd_t cmd = { .op = CMD_OP_DRAW, .target = CMD_TARGET_FRAME,
+                  .fill_rule = VG_LITE_FILL_NON_ZERO, .blend = VG_LITE_BLEND_SRC_OVER,
+                  .color = 0xFF000000U, .u.draw.path = path };
+
+    vg_lite_identity(&cmd.matrix);
+
+    return (VG_LITE_SUCCESS == cmd_execute(&cmd, &frame));
+}
+
+/*******************************************************************************
+* Function Name: heap_in_sync
+********************************************************************************
+* Summary:
+*  Checks the bookkeeping of the cache against the memory held in the driver.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  bool - true if the cache accounts for all uploads and stays within budget
+*
+*******************************************************************************/
+static bool heap_in_sync(void)
+{
+    vg_lite_stub_stats_t stub;
+
+    vg_lite_stub_get_stats(&stub, false);
+
+    return (cache.used == stub.uploaded_bytes) && (cache.used <= cache.budget);
+}
+
+/*******************************************************************************
+* Function Name: main
+********************************************************************************
+* Summary:
+*  Runs the checks and prints the cache statistics of repeated frames.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  int - 0 if all checks passed
+*
+*******************************************************************************/
+int main(void)
+{
+    path_cache_stats_t stats;
+    vg_lite_stub_stats_t stub;
+
+    path_cache_init(&cache, BUDGET_BYTES);
+    cmd_set_path_hook(use_cached_path, &cache);
+
+    /* Upload at load time, the third path only fits by evicting the first */
+    check(path_cache_register(&cache, &small), "small path uploaded");
+    check(path_cache_register(&cache, &medium), "medium path uploaded");
+    check(path_cache_register(&cache, &large), "large path uploaded");
+    check((NULL == small.uploaded.handle) && (NULL != medium.uploaded.handle),
+          "least recently used path evicted");
+    check(small.path == small_data, "evicted path keeps its data");
+    check(0 == medium.path_changed, "uploaded path marked unchanged");
+    check(heap_in_sync(), "heap within budget");
+
+    /* Draws of resident paths reference the upload */
+    path_cache_get_stats(&cache, &stats, true);
+    vg_lite_stub_get_stats(&stub, true);
+    check(draw(&medium) && draw(&large), "draws of resident paths");
+    path_cache_end_frame(&cache);
+    path_cache_get_stats(&cache, &stats, true);
+    vg_lite_stub_get_stats(&stub, true);
+    check((2U == stats.hits) && (0U == stats.misses) && (0U == stub.upload_path), "resident draws hit");
+    check((MEDIUM_PATH_BYTES + LARGE_PATH_BYTES) == stats.bytes_saved, "path data not copied");
+
+    /* An evicted path is uploaded on use, the GPU is drained before freeing a
+     * path the previous frame drew */
+    check(draw(&small), "draw of evicted path");
+    path_cache_get_stats(&cache, &stats, true);
+    vg_lite_stub_get_stats(&stub, true);
+    check((1U == stats.misses) && (1U == stub.upload_path) && (1U == stats.evictions),
+          "evicted path uploaded again");
+    check((1U == stats.stalls) && (1U == stub.finish), "recently drawn path freed after finish");
+    check(heap_in_sync(), "heap within budget after eviction");
+    path_cache_end_frame(&cache);
+    path_cache_end_frame(&cache);
+
+    /* A changed path is uploaded again, an unchanged one is not */
+    small.path_changed = 1;
+    check(draw(&small), "draw of changed path");
+    path_cache_get_stats(&cache, &stats, true);
+    vg_lite_stub_get_stats(&stub, true);
+    check((1U == stats.misses) && (1U == stub.upload_path) && (0 == small.path_changed),
+          "changed path uploaded again");
+    check((0U == stats.stalls) && (0U == stub.finish), "old path freed without waiting");
+    check(heap_in_sync(), "heap within budget after update");
+
+    /* Frames drawing the same paths only hit */
+    path_cache_end_frame(&cache);
+    path_cache_get_stats(&cache, &stats, true);
+    for (uint32_t n = 0; n < STEADY_FRAMES; n++)
+    {
+        (void)draw(&small);
+        (void)draw(&large);
+        path_cache_end_frame(&cache);
+    }
+    path_cache_get_stats(&cache, &stats, true);
+    printf("      %u%% hit rate, %u bytes/frame not copied, %u uploads, %u evictions\r\n",
+           (unsigned int)((stats.hits * 100U) / (stats.hits + stats.misses)),
+           (unsigned int)(stats.bytes_saved / stats.frames),
+           (unsigned int)stats.uploads, (unsigned int)stats.evictions);
+    check(((STEADY_FRAMES * 2U) - 1U) <= stats.hits, "repeated draws hit");
+    check(heap_in_sync(), "heap within budget after repeated frames");
+
+    path_cache_release(&cache);
+    vg_lite_stub_get_stats(&stub, false);
+    check((0U == cache.used) && (0U == stub.uploaded_bytes), "release frees all uploads");
+
+    return check_summary();
+}
+
+/* [] END OF FILE */
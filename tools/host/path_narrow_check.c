@@ -0,0 +1,212 @@
+/*******************************************************************************
+* File Name        : path_narrow_check.c
+*
+* Description      : Host check and build time use of the path narrowing pass: every
+*                    demo path is narrowed and compared element by element with the
+*                    original. With -e the narrowed data is printed as C arrays that can
+*                    replace the original declarations.
+*
+* Related Document : See README.md
+*
+********************************************************************************
+* Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "path_narrow.h"
+#include "infineon_logo_paths.h"
+#include "shape_paths.h"
+#include "host_check.h"
+
+/*******************************************************************************
+* Data Structures and Types
+*******************************************************************************/
+typedef struct {
+    const char *name;
+    vg_lite_path_t *path;
+} named_path_t;
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+static const named_path_t demo_paths[] =
+{
+    { "path_data0",                     &path[0] },
+    { "path_data1",                     &path[1] },
+    { "polygon_path_data",              &polygon_path },
+    { "self_intersecting_star",         &self_intersecting_star_path },
+    { "overlapping_squares",            &overlapping_squares_path },
+    { "concentric_circles_data_path",   &concentric_circles_path },
+    { "triangle_path_data",             &triangle_path },
+    { "pentagon_path_data",             &pentagon_path },
+    { "hexagon_path_data",              &hexagon_path },
+    { "highlight_path_data",            &highlight_path },
+    { "square_path_data",               &square_path }
+};
+
+static const char * const format_names[] = { "VG_LITE_S8", "VG_LITE_S16", "VG_LITE_S32" };
+static const char * const c_types[] = { "int8_t", "int16_t", "int32_t" };
+
+/*******************************************************************************
+* Function Name: format_index
+********************************************************************************
+* Summary:
+*  Maps an integer path format to an index of the name tables.
+*
+* Parameters:
+*  format - Path format
+*
+* Return:
+*  int    - Index
+*
+*******************************************************************************/
+static int format_index(vg_lite_format_t format)
+{
+    return (VG_LITE_S8 == format) ? 0 : ((VG_LITE_S16 == format) ? 1 : 2);
+}
+
+/*******************************************************************************
+* Function Name: emit
+********************************************************************************
+* Summary:
+*  Prints the data of a narrowed path as a C array, one segment per line.
+*
+* Parameters:
+*  name - Array name
+*  p    - Narrowed path
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void emit(const char *name, const vg_lite_path_t *p)
+{
+    static const uint32_t arguments[] = { 0U, 0U, 2U, 2U, 2U, 2U, 4U, 4U, 6U, 6U };
+    uint32_t count = path_data_count(p);
+    uint32_t i = 0U;
+
+    printf("/* %s, %u bytes */\n%s %s[] =\n{\n", format_names[format_index(p->format)],
+           (unsigned int)p->path_length, c_types[format_index(p->format)], name);
+    while (i < count)
+    {
+        int32_t opcode = path_data_get(p, i++);
+
+        printf("    %d", (int)opcode);
+        for (uint32_t j = 0; j < arguments[opcode]; j++)
+        {
+            printf(", %d", (int)path_data_get(p, i++));
+        }
+        printf(",\n");
+    }
+    printf("};\n\n");
+}
+
+/*******************************************************************************
+* Function Name: main
+********************************************************************************
+* Summary:
+*  Narrows a copy of every demo path and compares it with the original.
+*
+* Parameters:
+*  argc - Number of arguments
+*  argv - "-e" to print the narrowed arrays
+*
+* Return:
+*  int  - 0 if all checks passed
+*
+*******************************************************************************/
+int main(int argc, char *argv[])
+{
+    bool print = (argc > 1) && (0 == strcmp(argv[1], "-e"));
+    uint32_t before = 0U;
+    uint32_t after = 0U;
+
+    for (uint32_t n = 0; n < (sizeof(demo_paths) / sizeof(demo_paths[0])); n++)
+    {
+        const vg_lite_path_t *original = demo_paths[n].path;
+        vg_lite_path_t narrowed = *original;
+        uint32_t count = path_data_count(original);
+        bool same;
+
+        narrowed.path = malloc(original->path_length);
+        if (NULL == narrowed.path)
+        {
+            return EXIT_FAILURE;
+        }
+        memcpy(narrowed.path, original->path, original->path_length);
+        (void)path_narrow(&narrowed);
+
+        same = (0U != count) && (path_data_count(&narrowed) == count);
+        for (uint32_t i = 0; same && (i < count); i++)
+        {
+            same = (path_data_get(&narrowed, i) == path_data_get(original, i));
+        }
+
+        if (print)
+        {
+            emit(demo_paths[n].name, &narrowed);
+        }
+        else
+        {
+            printf("%-30s %-11s -> %-11s %5u -> %5u bytes\r\n", demo_paths[n].name,
+                   format_names[format_index(original->format)],
+                   format_names[format_index(narrowed.format)],
+                   (unsigned int)original->path_length, (unsigned int)narrowed.path_length);
+            check(same, "opcodes and values unchanged");
+            check(narrowed.path_length <= original->path_length, "not larger");
+            if (narrowed.format != original->format)
+            {
+                /* Each step halves the element size, up to the length alignment padding */
+                check(narrowed.path_length <= ((original->path_length / 2U) + PATH_NARROW_LENGTH_ALIGN),
+                      "path data halved");
+            }
+        }
+
+        before += original->path_length;
+        after += narrowed.path_length;
+        free(narrowed.path);
+    }
+
+    if (print)
+    {
+        return EXIT_SUCCESS;
+    }
+
+    printf("Demo path data: %u -> %u bytes (%u%% saved)\r\n", (unsigned int)before,
+           (unsigned int)after, (unsigned int)(((before - after) * 100U) / before));
+    return check_summary();
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,294 @@
+/*******************************************************************************
+* File Name        : perf_hud_check.c
+*
+* Description      : Host check of the performance HUD: placement in the corner, the
+*                    throttling of text updates, fingerprint and damage reporting and the
+*                    clipped drawing and cost accounting.
+*
+* Related Document : See README.md
+*
+********************************************************************************
+* Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "perf_hud.h"
+#include "vg_lite_stub.h"
+
+/* The pixel data is placed in SOCMEM on the device */
+#define CY_SECTION(name)
+#include "mono16_font.h"
+#include "host_check.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+#define SCREEN_WIDTH                        (800)
+#define SCREEN_HEIGHT                       (480)
+#define LOG_SIZE                            (32U)
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+static vg_lite_buffer_t frame = { .width = SCREEN_WIDTH, .height = SCREEN_HEIGHT,
+                                  .stride = SCREEN_WIDTH * 4, .format = VG_LITE_ARGB8888,
+                                  .address = 0x10000U };
+
+static const perf_hud_sample_t sample = { 59900U, 42U, 17U, 190U * 1024U, 12300U, 4000U };
+
+/*******************************************************************************
+* Function Name: fingerprint
+********************************************************************************
+* Summary:
+*  Returns the fingerprint of a frame holding only the HUD.
+*
+* Parameters:
+*  hud      - HUD
+*
+* Return:
+*  uint32_t - Fingerprint hash
+*
+*******************************************************************************/
+static uint32_t fingerprint(perf_hud_t *hud)
+{
+    scene_fingerprint_t fp;
+
+    scene_fingerprint_begin(&fp, 0U);
+    perf_hud_fingerprint(hud, &fp);
+
+    return fp.hash;
+}
+
+/*******************************************************************************
+* Function Name: check_layout
+********************************************************************************
+* Summary:
+*  Checks the placement of the HUD, that it starts hidden and that the text
+*  follows the samples no faster than the update period.
+*
+* Parameters:
+*  hud    - HUD, initialized by this function
+*  font   - Font of the text
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void check_layout(perf_hud_t *hud, text_font_t *font)
+{
+    perf_hud_stats_t stats;
+    int32_t advance = mono16_glyphs[0].advance;
+    uint32_t version;
+
+    perf_hud_init(hud, font, SCREEN_WIDTH);
+    check((hud->rect.x1 == (SCREEN_WIDTH - PERF_HUD_MARGIN)) && (hud->rect.y0 == PERF_HUD_MARGIN) &&
+          ((hud->rect.x1 - hud->rect.x0) == (((int32_t)PERF_HUD_COLUMNS * advance) + (2 * PERF_HUD_PADDING))) &&
+          ((hud->rect.y1 - hud->rect.y0) ==
+           (((int32_t)PERF_HUD_LINES * mono16_font.line_height) + (2 * PERF_HUD_PADDING))),
+          "Placed in the top right corner");
+    check(!perf_hud_begin_frame(hud, 0U), "Hidden by default");
+
+    perf_hud_set_enabled(hud, true);
+    check(perf_hud_begin_frame(hud, 0U) && (0 == strncmp(hud->lines[0].text, "FPS", 3U)),
+          "Shown with placeholders before the first sample");
+    for (uint8_t i = 0; i < PERF_HUD_LINES; i++)
+    {
+        check(strlen(hud->lines[i].text) <= PERF_HUD_COLUMNS, "Line fits the columns");
+    }
+
+    version = hud->version;
+    perf_hud_sample(hud, &sample);
+    (void)perf_hud_begin_frame(hud, PERF_HUD_PERIOD_MS - 1U);
+    check(version == hud->version, "Sample held back within the period");
+    (void)perf_hud_begin_frame(hud, PERF_HUD_PERIOD_MS);
+    check(((version + 1U) == hud->version) &&
+          (0 == strcmp(hud->lines[0].text, "FPS  59.9  CPU  42%")) &&
+          (0 == strcmp(hud->lines[1].text, "GPU  17%  Heap  190K")) &&
+          (0 == strcmp(hud->lines[2].text, "HUD  12.3 us   4 kpx")),
+          "Sample shown after the period");
+
+    version = hud->version;
+    perf_hud_sample(hud, &sample);
+    (void)perf_hud_begin_frame(hud, 3U * PERF_HUD_PERIOD_MS);
+    check(version == hud->version, "Unchanged text keeps the version");
+
+    perf_hud_set_period(hud, 0U);
+    perf_hud_get_stats(hud, &stats, true);
+    check((1U == stats.redraws) && (0U == stats.pixels), "Text changes counted");
+}
+
+/*******************************************************************************
+* Function Name: check_fingerprint
+********************************************************************************
+* Summary:
+*  Checks that the frame fingerprint follows toggling and text changes, and
+*  that the damage tracker repaints only the HUD rectangle for them.
+*
+* Parameters:
+*  hud    - Shown HUD
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void check_fingerprint(perf_hud_t *hud)
+{
+    static damage_tracker_t tracker;
+    perf_hud_sample_t changed = sample;
+    const damage_region_t *repaint;
+    uint32_t shown;
+    uint32_t hash;
+
+    shown = fingerprint(hud);
+    check(shown == fingerprint(hud), "Same HUD, same fingerprint");
+
+    damage_tracker_reset(&tracker, SCREEN_WIDTH, SCREEN_HEIGHT);
+    for (uint8_t i = 0; i < 2U; i++)
+    {
+        damage_tracker_begin_frame(&tracker, 0U);
+        perf_hud_report_damage(hud, &tracker);
+        repaint = damage_tracker_end_frame(&tracker);
+    }
+    check(0U == repaint->count, "Unchanged HUD repaints nothing");
+
+    changed.cpu_percent++;
+    perf_hud_sample(hud, &changed);
+    (void)perf_hud_begin_frame(hud, 4U * PERF_HUD_PERIOD_MS);
+    hash = fingerprint(hud);
+    check(hash != shown, "Changed text changes the fingerprint");
+    damage_tracker_begin_frame(&tracker, 0U);
+    perf_hud_report_damage(hud, &tracker);
+    repaint = damage_tracker_end_frame(&tracker);
+    check((1U == repaint->count) && (0 == memcmp(&repaint->rects[0], &hud->rect, sizeof(hud->rect))),
+          "Changed text repaints the HUD rectangle only");
+
+    perf_hud_set_enabled(hud, false);
+    (void)perf_hud_begin_frame(hud, 4U * PERF_HUD_PERIOD_MS);
+    check(hash != fingerprint(hud), "Hiding changes the fingerprint");
+    damage_tracker_begin_frame(&tracker, 0U);
+    perf_hud_report_damage(hud, &tracker);
+    repaint = damage_tracker_end_frame(&tracker);
+    check((1U == repaint->count) && (0 == memcmp(&repaint->rects[0], &hud->rect, sizeof(hud->rect))),
+          "Hiding repaints the scene under the HUD");
+
+    perf_hud_set_enabled(hud, true);
+    (void)perf_hud_begin_frame(hud, 4U * PERF_HUD_PERIOD_MS);
+    check(hash == fingerprint(hud), "Shown again, same fingerprint");
+}
+
+/*******************************************************************************
+* Function Name: check_draw
+********************************************************************************
+* Summary:
+*  Checks that drawing stays inside the HUD rectangle and the clip, and that
+*  its pixels are counted.
+*
+* Parameters:
+*  hud    - Shown HUD
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void check_draw(perf_hud_t *hud)
+{
+    vg_lite_stub_call_t logged[LOG_SIZE];
+    vg_lite_stub_stats_t stub;
+    perf_hud_stats_t stats;
+    damage_rect_t clip = { 0, 0, SCREEN_WIDTH / 2, SCREEN_HEIGHT };
+    uint32_t spans = 0U;
+    uint32_t count;
+
+    for (uint8_t i = 0; i < PERF_HUD_LINES; i++)
+    {
+        spans += hud->lines[i].span_count;
+    }
+    perf_hud_get_stats(hud, &stats, true);
+    vg_lite_stub_get_stats(&stub, true);
+    (void)vg_lite_stub_get_log(logged, LOG_SIZE, true);
+
+    check((VG_LITE_SUCCESS == perf_hud_draw(hud, &frame, &clip)) &&
+          (0U == vg_lite_stub_get_log(logged, LOG_SIZE, true)), "Clip outside the HUD draws nothing");
+
+    check(VG_LITE_SUCCESS == perf_hud_draw(hud, &frame, NULL), "Full frame drawn");
+    count = vg_lite_stub_get_log(logged, LOG_SIZE, true);
+    vg_lite_stub_get_stats(&stub, true);
+    check((count == (1U + spans)) && (VG_LITE_STUB_CLEAR == logged[0].op) &&
+          (1U == stub.clear) && (spans == stub.blit_rect), "One clear and one blit per span");
+    perf_hud_get_stats(hud, &stats, true);
+    check(stats.pixels > damage_rect_area(&hud->rect), "Cleared and text pixels counted");
+
+    clip = hud->rect;
+    clip.y1 = clip.y0 + PERF_HUD_PADDING + 1;
+    (void)perf_hud_draw(hud, &frame, &clip);
+    vg_lite_stub_get_stats(&stub, true);
+    check((1U == stub.clear) && (hud->lines[0].span_count == stub.blit_rect),
+          "Clip across the first line draws that line only");
+
+    (void)vg_lite_stub_get_log(logged, LOG_SIZE, true);
+    perf_hud_set_enabled(hud, false);
+    (void)perf_hud_begin_frame(hud, 0U);
+    (void)perf_hud_draw(hud, &frame, NULL);
+    check(0U == vg_lite_stub_get_log(logged, LOG_SIZE, true), "Hidden HUD draws nothing");
+}
+
+/*******************************************************************************
+* Function Name: main
+********************************************************************************
+* Summary:
+*  Runs the performance HUD checks.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  int - 0 if all checks passed
+*
+*******************************************************************************/
+int main(void)
+{
+    text_font_t font;
+    perf_hud_t hud;
+
+    check(text_font_init(&font, &mono16_font), "Font set up");
+    check_layout(&hud, &font);
+    check_fingerprint(&hud);
+    check_draw(&hud);
+
+    return check_summary();
+}
+
+/* [] END OF FILE */
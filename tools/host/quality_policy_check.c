@@ -0,0 +1,205 @@
+/*******************************************************************************
+* File Name        : quality_policy_check.c
+*
+* Description      : Host check of the antialiasing quality policy: moving draws are
+*                    rendered with fewer samples within the budget, and a draw that
+*                    stops moving settles back to the quality of its path and is redrawn.
+*
+* Related Document : See README.md
+*
+********************************************************************************
+* Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "scene_graph.h"
+#include "quality_policy.h"
+#include "vg_lite_stub.h"
+#include "host_check.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+#define SCREEN_WIDTH                        (800)
+#define SCREEN_HEIGHT                       (480)
+#define MOVING_BUDGET                       (SCREEN_WIDTH * SCREEN_HEIGHT * 4U)
+#define SMALL_AREA                          (64U * 64U)
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+static vg_lite_buffer_t frame = { .width = SCREEN_WIDTH, .height = SCREEN_HEIGHT,
+                                  .stride = SCREEN_WIDTH * 4, .format = VG_LITE_ARGB8888,
+                                  .address = 0x10000U };
+static vg_lite_path_t logo = { .bounding_box = { 0.0f, 0.0f, 300.0f, 200.0f },
+                               .quality = VG_LITE_HIGH, .format = VG_LITE_S16 };
+static vg_lite_path_t dot = { .bounding_box = { 0.0f, 0.0f, 20.0f, 20.0f },
+                              .quality = VG_LITE_HIGH, .format = VG_LITE_S16 };
+static vg_lite_path_t plain = { .bounding_box = { 0.0f, 0.0f, 300.0f, 200.0f },
+                                .quality = VG_LITE_MEDIUM, .format = VG_LITE_S16 };
+
+static const quality_policy_config_t config = {
+    .budget         = MOVING_BUDGET,
+    .small_area     = SMALL_AREA,
+    .small_quality  = VG_LITE_UPPER,
+    .moving_quality = VG_LITE_MEDIUM,
+    .settle_frames  = QUALITY_POLICY_SETTLE_FRAMES
+};
+
+static quality_policy_t policy;
+static scene_node_t root;
+static scene_node_t group;
+static scene_node_t logo_node;
+static scene_node_t dot_node;
+static scene_graph_t graph;
+static scene_fingerprint_t fingerprint;
+
+/*******************************************************************************
+* Function Name: render
+********************************************************************************
+* Summary:
+*  Renders one frame the way the demos do: update, fingerprint, then draw
+*  unless the frame is unchanged.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  bool - true if the frame was drawn, false if it was skipped
+*
+*******************************************************************************/
+static bool render(void)
+{
+    bool drawn;
+
+    scene_graph_update(&graph);
+    scene_fingerprint_begin(&fingerprint, 0U);
+    scene_graph_fingerprint(&graph, &fingerprint);
+    drawn = !scene_fingerprint_unchanged(&fingerprint);
+    if (drawn)
+    {
+        (void)scene_graph_draw(&graph, &frame, NULL);
+        scene_fingerprint_commit(&fingerprint);
+    }
+
+    return drawn;
+}
+
+/*******************************************************************************
+* Function Name: main
+********************************************************************************
+* Summary:
+*  Runs the quality policy checks.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  int - 0 if all checks passed
+*
+*******************************************************************************/
+int main(void)
+{
+    quality_policy_stats_t stats;
+    vg_lite_matrix_t local;
+    bool drawn;
+
+    /* Selection rules */
+    quality_policy_init(&policy, &config);
+    quality_policy_begin_frame(&policy);
+    check(VG_LITE_HIGH == quality_policy_select(&policy, VG_LITE_HIGH, 2U, 60000U),
+          "still draw uses the path quality");
+    check(VG_LITE_MEDIUM == quality_policy_select(&policy, VG_LITE_HIGH, 0U, 60000U),
+          "large moving draw uses the moving quality");
+    check(VG_LITE_UPPER == quality_policy_select(&policy, VG_LITE_HIGH, 1U, 400U),
+          "small moving draw uses the small quality");
+    check(VG_LITE_LOW == quality_policy_select(&policy, VG_LITE_LOW, 0U, 400U),
+          "never better than the path quality");
+    check(VG_LITE_LOW == quality_policy_select(&policy, VG_LITE_HIGH, 0U,
+                                               SCREEN_WIDTH * SCREEN_HEIGHT * 3U),
+          "budget exhausted by a huge moving draw");
+    quality_policy_get_stats(&policy, &stats, true);
+    check((5U == stats.draws) && (3U == stats.reduced) && (1U == stats.over_budget),
+          "statistics");
+    quality_policy_begin_frame(&policy);
+    check(VG_LITE_MEDIUM == quality_policy_select(&policy, VG_LITE_HIGH, 0U, 60000U),
+          "budget refilled every frame");
+
+    /* Scene: a logo rotating in a group, a dot that does not move */
+    quality_policy_init(&policy, &config);
+    scene_node_init_group(&root);
+    scene_node_init_group(&group);
+    scene_node_add_child(&root, &group);
+    scene_node_init_path(&logo_node, &logo, VG_LITE_FILL_EVEN_ODD, VG_LITE_BLEND_NONE,
+                         0xFF0000FFU);
+    scene_node_add_child(&group, &logo_node);
+    scene_node_init_path(&dot_node, &dot, VG_LITE_FILL_EVEN_ODD, VG_LITE_BLEND_NONE,
+                         0xFF00FF00U);
+    scene_node_add_child(&root, &dot_node);
+    scene_graph_init(&graph, &root);
+    scene_graph_set_quality_policy(&graph, &policy);
+    scene_fingerprint_reset(&fingerprint);
+
+    check(render() && (VG_LITE_HIGH == logo.quality) && (VG_LITE_HIGH == dot.quality),
+          "first frame at full quality");
+
+    vg_lite_identity(&local);
+    for (uint8_t frame_index = 0; frame_index < 4U; frame_index++)
+    {
+        vg_lite_rotate(5.0f, &local);
+        scene_node_set_transform(&group, &local);
+        (void)render();
+    }
+    check(VG_LITE_MEDIUM == logo.quality, "rotating logo drawn at 4x");
+    check(VG_LITE_HIGH == dot.quality, "still dot keeps 16x");
+
+    /* Motion stops: unchanged until settled, then one frame at full quality */
+    drawn = render();
+    check(!drawn && (VG_LITE_MEDIUM == logo_node.draw_quality), "first still frame skipped");
+    drawn = render();
+    check(drawn && (VG_LITE_HIGH == logo.quality), "settled frame redrawn at 16x");
+    check(!render(), "static frames skipped after settling");
+
+    /* The quality of a path is only lowered, never raised */
+    scene_node_init_path(&dot_node, &plain, VG_LITE_FILL_EVEN_ODD, VG_LITE_BLEND_NONE,
+                         0xFF00FF00U);
+    scene_graph_set_quality_policy(&graph, NULL);
+    scene_graph_invalidate(&graph);
+    (void)render();
+    check(VG_LITE_MEDIUM == plain.quality, "without policy the path quality is used");
+
+    return check_summary();
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,271 @@
+/*******************************************************************************
+* File Name        : scene_graph_bench.c
+*
+* Description      : Host benchmark of the retained scene graph: cost of updating the
+*                    cached world matrices with and without dirty tracking, and of the
+*                    draw, fingerprint and damage traversals.
+*
+* Related Document : See README.md
+*
+********************************************************************************
+* Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "gfx_port.h"
+#include "scene_graph.h"
+#include "vg_lite_stub.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+#define SCREEN_WIDTH                        (800)
+#define SCREEN_HEIGHT                       (480)
+#define GROUP_COUNT                         (8)
+#define PATHS_PER_GROUP                     (8)
+#define IMAGES_PER_GROUP                    (2)
+#define DEFAULT_ITERATIONS                  (100000U)
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+static vg_lite_buffer_t target = { .width = SCREEN_WIDTH, .height = SCREEN_HEIGHT,
+                                   .stride = SCREEN_WIDTH * 4, .format = VG_LITE_ARGB8888,
+                                   .address = 0x1000U };
+static vg_lite_buffer_t icon = { .width = 176, .height = 190, .stride = 176 * 4,
+                                 .format = VG_LITE_ARGB8888, .address = 0x2000U };
+static vg_lite_path_t shape = { .bounding_box = { 0.0f, 0.0f, 40.0f, 40.0f },
+                                .quality = VG_LITE_HIGH, .format = VG_LITE_S16 };
+
+static scene_node_t root;
+static scene_node_t groups[GROUP_COUNT];
+static scene_node_t paths[GROUP_COUNT][PATHS_PER_GROUP];
+static scene_node_t images[GROUP_COUNT][IMAGES_PER_GROUP];
+static scene_graph_t graph;
+static scene_fingerprint_t fingerprint;
+static damage_tracker_t tracker;
+
+static uint32_t iterations = DEFAULT_ITERATIONS;
+
+
+/*******************************************************************************
+* Function Name: build_scene
+********************************************************************************
+* Summary:
+*  Builds a scene shaped like the demos: a few groups, each holding paths and
+*  images at fixed offsets.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void build_scene(void)
+{
+    vg_lite_matrix_t local;
+
+    scene_node_init_group(&root);
+
+    for (int g = 0; g < GROUP_COUNT; g++)
+    {
+        scene_node_init_group(&groups[g]);
+        vg_lite_identity(&local);
+        vg_lite_translate((float)((g % 4) * (SCREEN_WIDTH / 4)),
+                          (float)((g / 4) * (SCREEN_HEIGHT / 2)), &local);
+        scene_node_set_transform(&groups[g], &local);
+        scene_node_add_child(&root, &groups[g]);
+
+        for (int p = 0; p < PATHS_PER_GROUP; p++)
+        {
+            scene_node_init_path(&paths[g][p], &shape, VG_LITE_FILL_EVEN_ODD,
+                                 VG_LITE_BLEND_SRC_OVER, 0xFF808000U);
+            vg_lite_identity(&local);
+            vg_lite_translate((float)(p * 20), (float)(p * 20), &local);
+            vg_lite_scale(0.5f, 0.5f, &local);
+            scene_node_set_transform(&paths[g][p], &local);
+            scene_node_add_child(&groups[g], &paths[g][p]);
+        }
+
+        for (int i = 0; i < IMAGES_PER_GROUP; i++)
+        {
+            scene_node_init_image(&images[g][i], &icon, NULL, VG_LITE_BLEND_SRC_OVER,
+                                  VG_LITE_FILTER_LINEAR);
+            vg_lite_identity(&local);
+            vg_lite_translate(10.0f, (float)(i * 40), &local);
+            scene_node_set_transform(&images[g][i], &local);
+            scene_node_add_child(&groups[g], &images[g][i]);
+        }
+    }
+
+    scene_graph_init(&graph, &root);
+    scene_graph_update(&graph);
+    damage_tracker_reset(&tracker, SCREEN_WIDTH, SCREEN_HEIGHT);
+}
+
+/*******************************************************************************
+* Function Name: report
+********************************************************************************
+* Summary:
+*  Prints the result of one benchmark case.
+*
+* Parameters:
+*  name   - Case name
+*  cycles - Total time of all iterations in ns
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void report(const char *name, uint32_t cycles)
+{
+    scene_graph_stats_t stats;
+    vg_lite_stub_stats_t calls;
+
+    scene_graph_get_stats(&graph, &stats, true);
+    vg_lite_stub_get_stats(&calls, true);
+
+    printf("%-28s %9.1f ns/frame %7.1f updated %7.1f draws %7.1f culled %7.1f vg_lite calls\r\n",
+           name, (double)cycles / iterations,
+           (double)stats.updated / iterations,
+           (double)stats.draw_calls / iterations,
+           (double)stats.culled / iterations,
+           (double)(calls.draw + calls.blit + calls.blit_rect + calls.draw_pattern + calls.clear) /
+               iterations);
+}
+
+/*******************************************************************************
+* Function Name: main
+********************************************************************************
+* Summary:
+*  Runs every case for the number of iterations given on the command line.
+*
+* Parameters:
+*  argc, argv - Optional iteration count
+*
+* Return:
+*  int        - 0
+*
+*******************************************************************************/
+int main(int argc, char *argv[])
+{
+    vg_lite_matrix_t moved[2];
+    scene_graph_stats_t build_stats;
+    vg_lite_stub_stats_t build_calls;
+    damage_rect_t clip = { 0, 0, SCREEN_WIDTH / 4, SCREEN_HEIGHT / 2 };
+    uint32_t start;
+
+    if (argc > 1)
+    {
+        iterations = (uint32_t)strtoul(argv[1], NULL, 0);
+    }
+    if (0U == iterations)
+    {
+        iterations = DEFAULT_ITERATIONS;
+    }
+
+    build_scene();
+    printf("Scene: %d groups, %d nodes, %u iterations\r\n", GROUP_COUNT,
+           1 + (GROUP_COUNT * (1 + PATHS_PER_GROUP + IMAGES_PER_GROUP)), iterations);
+
+    vg_lite_identity(&moved[0]);
+    vg_lite_identity(&moved[1]);
+    vg_lite_translate(5.0f, 5.0f, &moved[1]);
+
+    /* Discard the counts of the initial update */
+    scene_graph_get_stats(&graph, &build_stats, true);
+    vg_lite_stub_get_stats(&build_calls, true);
+
+    /* Static scene, nothing dirty */
+    start = gfx_port_cycles();
+    for (uint32_t n = 0; n < iterations; n++)
+    {
+        scene_graph_update(&graph);
+    }
+    report("update, static", gfx_port_cycles() - start);
+
+    /* One group animated, as in the default demo */
+    start = gfx_port_cycles();
+    for (uint32_t n = 0; n < iterations; n++)
+    {
+        scene_node_set_transform(&groups[0], &moved[n & 1U]);
+        scene_graph_update(&graph);
+    }
+    report("update, one group moved", gfx_port_cycles() - start);
+
+    /* Everything recomputed, equivalent to rebuilding matrices every frame */
+    start = gfx_port_cycles();
+    for (uint32_t n = 0; n < iterations; n++)
+    {
+        scene_graph_invalidate(&graph);
+        scene_graph_update(&graph);
+    }
+    report("update, no caching", gfx_port_cycles() - start);
+
+    start = gfx_port_cycles();
+    for (uint32_t n = 0; n < iterations; n++)
+    {
+        (void)scene_graph_draw(&graph, &target, NULL);
+    }
+    report("draw, full screen", gfx_port_cycles() - start);
+
+    start = gfx_port_cycles();
+    for (uint32_t n = 0; n < iterations; n++)
+    {
+        (void)scene_graph_draw(&graph, &target, &clip);
+    }
+    report("draw, clipped to 1/8", gfx_port_cycles() - start);
+
+    start = gfx_port_cycles();
+    for (uint32_t n = 0; n < iterations; n++)
+    {
+        scene_fingerprint_begin(&fingerprint, 0U);
+        scene_graph_fingerprint(&graph, &fingerprint);
+    }
+    report("fingerprint", gfx_port_cycles() - start);
+
+    start = gfx_port_cycles();
+    for (uint32_t n = 0; n < iterations; n++)
+    {
+        damage_tracker_begin_frame(&tracker, 0U);
+        scene_graph_report_damage(&graph, &tracker);
+        (void)damage_tracker_end_frame(&tracker);
+    }
+    report("damage", gfx_port_cycles() - start);
+
+    return 0;
+}
+
+/* [] END OF FILE */
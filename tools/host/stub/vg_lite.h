@@ -0,0 +1,243 @@
+/*******************************************************************************
+* File Name        : vg_lite.h
+*
+* Description      : Host stand-in for the subset of the VGLite API used by the
+*                    graphics modules, so that they can be built and benchmarked on a
+*                    Linux host. Draw calls are only counted, see vg_lite_stub.h.
+*
+* Related Document : See README.md
+*
+********************************************************************************
+* Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+
+#ifndef VG_LITE_H
+#define VG_LITE_H
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+#define VLC_OP_END                          (0x00)
+#define VLC_OP_CLOSE                        (0x01)
+#define VLC_OP_MOVE                         (0x02)
+#define VLC_OP_MOVE_REL                     (0x03)
+#define VLC_OP_LINE                         (0x04)
+#define VLC_OP_LINE_REL                     (0x05)
+#define VLC_OP_QUAD                         (0x06)
+#define VLC_OP_QUAD_REL                     (0x07)
+#define VLC_OP_CUBIC                        (0x08)
+#define VLC_OP_CUBIC_REL                    (0x09)
+
+/*******************************************************************************
+* Data Structures and Types
+*******************************************************************************/
+typedef int32_t  vg_lite_int32_t;
+typedef uint32_t vg_lite_uint32_t;
+typedef float    vg_lite_float_t;
+typedef uint32_t vg_lite_color_t;
+
+typedef enum {
+    VG_LITE_SUCCESS = 0,
+    VG_LITE_INVALID_ARGUMENT,
+    VG_LITE_OUT_OF_MEMORY,
+    VG_LITE_NO_CONTEXT,
+    VG_LITE_TIMEOUT,
+    VG_LITE_OUT_OF_RESOURCES,
+    VG_LITE_GENERIC_IO,
+    VG_LITE_NOT_SUPPORT
+} vg_lite_error_t;
+
+typedef enum {
+    VG_LITE_FILL_NON_ZERO,
+    VG_LITE_FILL_EVEN_ODD
+} vg_lite_fill_t;
+
+typedef enum {
+    VG_LITE_BLEND_NONE,
+    VG_LITE_BLEND_SRC_OVER,
+    VG_LITE_BLEND_DST_OVER,
+    VG_LITE_BLEND_SRC_IN,
+    VG_LITE_BLEND_DST_IN,
+    VG_LITE_BLEND_MULTIPLY,
+    VG_LITE_BLEND_SCREEN,
+    VG_LITE_BLEND_ADDITIVE,
+    VG_LITE_BLEND_SUBTRACT,
+    VG_LITE_BLEND_PREMULTIPLY_SRC_OVER
+} vg_lite_blend_t;
+
+typedef enum {
+    VG_LITE_FILTER_POINT,
+    VG_LITE_FILTER_LINEAR,
+    VG_LITE_FILTER_BI_LINEAR
+} vg_lite_filter_t;
+
+typedef enum {
+    VG_LITE_PATTERN_COLOR,
+    VG_LITE_PATTERN_PAD
+} vg_lite_pattern_mode_t;
+
+typedef enum {
+    VG_LITE_HIGH,
+    VG_LITE_UPPER,
+    VG_LITE_MEDIUM,
+    VG_LITE_LOW
+} vg_lite_quality_t;
+
+typedef enum {
+    VG_LITE_S8,
+    VG_LITE_S16,
+    VG_LITE_S32,
+    VG_LITE_FP32
+} vg_lite_format_t;
+
+typedef enum {
+    VG_LITE_RGBA8888,
+    VG_LITE_BGRA8888,
+    VG_LITE_ARGB8888,
+    VG_LITE_BGR565,
+    VG_LITE_RGB565,
+    VG_LITE_L8,
+    VG_LITE_A8,
+    VG_LITE_A4,
+    VG_LITE_INDEX_8,
+    VG_LITE_INDEX_4
+} vg_lite_buffer_format_t;
+
+typedef enum {
+    VG_LITE_ZERO = 0,
+    VG_LITE_NORMAL_IMAGE_MODE = 0x1F00,
+    VG_LITE_MULTIPLY_IMAGE_MODE = 0x1F01
+} vg_lite_image_mode_t;
+
+typedef struct {
+    vg_lite_float_t m[3][3];
+} vg_lite_matrix_t;
+
+typedef struct {
+    vg_lite_int32_t x;
+    vg_lite_int32_t y;
+    vg_lite_int32_t width;
+    vg_lite_int32_t height;
+} vg_lite_rectangle_t;
+
+typedef struct {
+    vg_lite_int32_t width;
+    vg_lite_int32_t height;
+    vg_lite_int32_t stride;
+    vg_lite_buffer_format_t format;
+    void *handle;
+    void *memory;
+    vg_lite_uint32_t address;
+    vg_lite_image_mode_t image_mode;
+} vg_lite_buffer_t;
+
+typedef struct {
+    void *handle;
+    void *memory;
+    vg_lite_uint32_t address;
+    vg_lite_uint32_t bytes;
+    vg_lite_uint32_t property;
+} vg_lite_hw_memory_t;
+
+typedef struct {
+    vg_lite_float_t bounding_box[4];
+    vg_lite_quality_t quality;
+    vg_lite_format_t format;
+    vg_lite_hw_memory_t uploaded;
+    vg_lite_uint32_t path_length;
+    void *path;
+    vg_lite_int32_t path_changed;
+    vg_lite_int32_t pdata_internal;
+} vg_lite_path_t;
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+vg_lite_error_t vg_lite_clear(vg_lite_buffer_t *target, vg_lite_rectangle_t *rect,
+                              vg_lite_color_t color);
+vg_lite_error_t vg_lite_draw(vg_lite_buffer_t *target, vg_lite_path_t *path,
+                             vg_lite_fill_t fill_rule, vg_lite_matrix_t *matrix,
+                             vg_lite_blend_t blend, vg_lite_color_t color);
+vg_lite_error_t vg_lite_blit(vg_lite_buffer_t *target, vg_lite_buffer_t *source,
+                             vg_lite_matrix_t *matrix, vg_lite_blend_t blend,
+                             vg_lite_color_t color, vg_lite_filter_t filter);
+vg_lite_error_t vg_lite_blit_rect(vg_lite_buffer_t *target, vg_lite_buffer_t *source,
+                                  vg_lite_rectangle_t *rect, vg_lite_matrix_t *matrix,
+                                  vg_lite_blend_t blend, vg_lite_color_t color,
+                                  vg_lite_filter_t filter);
+vg_lite_error_t vg_lite_draw_pattern(vg_lite_buffer_t *target, vg_lite_path_t *path,
+                                     vg_lite_fill_t fill_rule, vg_lite_matrix_t *path_matrix,
+                                     vg_lite_buffer_t *pattern_image,
+                                     vg_lite_matrix_t *pattern_matrix,
+                                     vg_lite_blend_t blend,
+                                     vg_lite_pattern_mode_t pattern_mode,
+                                     vg_lite_color_t pattern_color,
+                                     vg_lite_color_t color, vg_lite_filter_t filter);
+vg_lite_error_t vg_lite_set_scissor(vg_lite_int32_t x, vg_lite_int32_t y,
+                                    vg_lite_int32_t right, vg_lite_int32_t bottom);
+vg_lite_error_t vg_lite_enable_scissor(void);
+vg_lite_error_t vg_lite_disable_scissor(void);
+vg_lite_error_t vg_lite_allocate(vg_lite_buffer_t *buffer);
+vg_lite_error_t vg_lite_allocate_with_align(vg_lite_buffer_t *buffer, vg_lite_uint32_t align);
+vg_lite_error_t vg_lite_free(vg_lite_buffer_t *buffer);
+vg_lite_error_t vg_lite_set_CLUT(vg_lite_uint32_t count, vg_lite_uint32_t *colors);
+vg_lite_error_t vg_lite_upload_path(vg_lite_path_t *path);
+vg_lite_error_t vg_lite_clear_path(vg_lite_path_t *path);
+vg_lite_error_t vg_lite_flush(void);
+vg_lite_error_t vg_lite_finish(void);
+
+vg_lite_error_t vg_lite_identity(vg_lite_matrix_t *matrix);
+vg_lite_error_t vg_lite_translate(vg_lite_float_t x, vg_lite_float_t y,
+                                  vg_lite_matrix_t *matrix);
+vg_lite_error_t vg_lite_scale(vg_lite_float_t scale_x, vg_lite_float_t scale_y,
+                              vg_lite_matrix_t *matrix);
+vg_lite_error_t vg_lite_rotate(vg_lite_float_t degrees, vg_lite_matrix_t *matrix);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* VG_LITE_H */
+
+/* [] END OF FILE */
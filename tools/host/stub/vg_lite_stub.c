@@ -0,0 +1,621 @@
+/*******************************************************************************
+* File Name        : vg_lite_stub.c
+*
+* Description      : Host stand-in for the VGLite API. Matrix functions behave like
+*                    the driver, draw calls validate their arguments and are counted.
+*
+* Related Document : See README.md
+*
+********************************************************************************
+* Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+
+#include <math.h>
+#include <string.h>
+#include "vg_lite_stub.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+#define PI                                  (3.14159265358979323846f)
+#define FNV_OFFSET_BASIS                    (0x811C9DC5U)
+#define FNV_PRIME                           (0x01000193U)
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+static vg_lite_stub_stats_t stub_stats;
+static vg_lite_stub_call_t stub_log[VG_LITE_STUB_LOG_SIZE];
+static uint32_t stub_log_count;
+
+/* Live heap blocks, sorted by offset */
+static uint8_t stub_heap[VG_LITE_STUB_HEAP_SIZE];
+static struct {
+    uint32_t offset;
+    uint32_t bytes;
+} stub_blocks[VG_LITE_STUB_HEAP_BLOCKS];
+static uint32_t stub_block_count;
+
+
+/*******************************************************************************
+* Function Name: multiply
+********************************************************************************
+* Summary:
+*  Post-multiplies a matrix in place: matrix = matrix * mult, like the
+*  driver does for vg_lite_translate(), vg_lite_scale() and vg_lite_rotate().
+*
+* Parameters:
+*  matrix - Matrix to be updated
+*  mult   - Right hand matrix
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void multiply(vg_lite_matrix_t *matrix, const vg_lite_matrix_t *mult)
+{
+    vg_lite_matrix_t temp;
+
+    for (int row = 0; row < 3; row++)
+    {
+        for (int col = 0; col < 3; col++)
+        {
+            temp.m[row][col] = (matrix->m[row][0] * mult->m[0][col]) +
+                               (matrix->m[row][1] * mult->m[1][col]) +
+                               (matrix->m[row][2] * mult->m[2][col]);
+        }
+    }
+
+    *matrix = temp;
+}
+
+/*******************************************************************************
+* Function Name: hash
+********************************************************************************
+* Summary:
+*  FNV-1a over a call argument, chained through seed.
+*
+* Parameters:
+*  data - Argument
+*  size - Size of the argument in bytes
+*  seed - Hash of the previous arguments
+*
+* Return:
+*  uint32_t - Updated hash
+*
+*******************************************************************************/
+static uint32_t hash(const void *data, size_t size, uint32_t seed)
+{
+    const uint8_t *bytes = (const uint8_t *)data;
+
+    for (size_t i = 0; i < size; i++)
+    {
+        seed = (seed ^ bytes[i]) * FNV_PRIME;
+    }
+
+    return seed;
+}
+
+/*******************************************************************************
+* Function Name: log_call
+********************************************************************************
+* Summary:
+*  Appends a draw call to the log. Calls beyond VG_LITE_STUB_LOG_SIZE are
+*  counted but not logged.
+*
+* Parameters:
+*  op        - Call
+*  target    - Target buffer
+*  args_hash - Hash of the other arguments
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void log_call(vg_lite_stub_op_t op, vg_lite_buffer_t *target, uint32_t args_hash)
+{
+    if (stub_log_count < VG_LITE_STUB_LOG_SIZE)
+    {
+        stub_log[stub_log_count].op        = op;
+        stub_log[stub_log_count].target    = target;
+        stub_log[stub_log_count].args_hash = args_hash;
+    }
+    stub_log_count++;
+}
+
+/*******************************************************************************
+* Function Name: heap_alloc
+********************************************************************************
+* Summary:
+*  Allocates from the stand-in heap at the lowest aligned offset that fits.
+*
+* Parameters:
+*  bytes - Size of the block
+*  align - Alignment of the block offset, power of two
+*
+* Return:
+*  void* - Block, NULL if no gap is large enough
+*
+*******************************************************************************/
+static void *heap_alloc(uint32_t bytes, uint32_t align)
+{
+    uint32_t start = 0U;
+
+    if ((0U == bytes) || (VG_LITE_STUB_HEAP_BLOCKS == stub_block_count))
+    {
+        return NULL;
+    }
+
+    for (uint32_t i = 0U; i <= stub_block_count; i++)
+    {
+        uint32_t end = (i < stub_block_count) ? stub_blocks[i].offset : VG_LITE_STUB_HEAP_SIZE;
+
+        start = (start + align - 1U) & ~(align - 1U);
+        if ((start <= end) && (bytes <= (end - start)))
+        {
+            memmove(&stub_blocks[i + 1U], &stub_blocks[i],
+                    (stub_block_count - i) * sizeof(stub_blocks[0]));
+            stub_blocks[i].offset = start;
+            stub_blocks[i].bytes  = bytes;
+            stub_block_count++;
+
+            return &stub_heap[start];
+        }
+
+        if (i < stub_block_count)
+        {
+            start = stub_blocks[i].offset + stub_blocks[i].bytes;
+        }
+    }
+
+    return NULL;
+}
+
+/*******************************************************************************
+* Function Name: heap_free
+********************************************************************************
+* Summary:
+*  Returns a block to the stand-in heap.
+*
+* Parameters:
+*  memory - Block returned by heap_alloc()
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void heap_free(void *memory)
+{
+    for (uint32_t i = 0U; i < stub_block_count; i++)
+    {
+        if (&stub_heap[stub_blocks[i].offset] == memory)
+        {
+            stub_block_count--;
+            memmove(&stub_blocks[i], &stub_blocks[i + 1U],
+                    (stub_block_count - i) * sizeof(stub_blocks[0]));
+            return;
+        }
+    }
+}
+
+/* VGLite API, see vg_lite.h */
+
+vg_lite_error_t vg_lite_identity(vg_lite_matrix_t *matrix)
+{
+    memset(matrix, 0, sizeof(*matrix));
+    matrix->m[0][0] = 1.0f;
+    matrix->m[1][1] = 1.0f;
+    matrix->m[2][2] = 1.0f;
+
+    return VG_LITE_SUCCESS;
+}
+
+vg_lite_error_t vg_lite_translate(vg_lite_float_t x, vg_lite_float_t y,
+                                  vg_lite_matrix_t *matrix)
+{
+    vg_lite_matrix_t t;
+
+    vg_lite_identity(&t);
+    t.m[0][2] = x;
+    t.m[1][2] = y;
+    multiply(matrix, &t);
+
+    return VG_LITE_SUCCESS;
+}
+
+vg_lite_error_t vg_lite_scale(vg_lite_float_t scale_x, vg_lite_float_t scale_y,
+                              vg_lite_matrix_t *matrix)
+{
+    vg_lite_matrix_t s;
+
+    vg_lite_identity(&s);
+    s.m[0][0] = scale_x;
+    s.m[1][1] = scale_y;
+    multiply(matrix, &s);
+
+    return VG_LITE_SUCCESS;
+}
+
+vg_lite_error_t vg_lite_rotate(vg_lite_float_t degrees, vg_lite_matrix_t *matrix)
+{
+    vg_lite_matrix_t r;
+    float angle = degrees / 180.0f * PI;
+
+    vg_lite_identity(&r);
+    r.m[0][0] = cosf(angle);
+    r.m[0][1] = -sinf(angle);
+    r.m[1][0] = sinf(angle);
+    r.m[1][1] = cosf(angle);
+    multiply(matrix, &r);
+
+    return VG_LITE_SUCCESS;
+}
+
+vg_lite_error_t vg_lite_clear(vg_lite_buffer_t *target, vg_lite_rectangle_t *rect,
+                              vg_lite_color_t color)
+{
+    uint32_t h = hash(&color, sizeof(color), FNV_OFFSET_BASIS);
+
+    if (NULL != rect)
+    {
+        h = hash(rect, sizeof(*rect), h);
+    }
+    log_call(VG_LITE_STUB_CLEAR, target, h);
+    stub_stats.clear++;
+
+    return (NULL == target) ? VG_LITE_INVALID_ARGUMENT : VG_LITE_SUCCESS;
+}
+
+vg_lite_error_t vg_lite_draw(vg_lite_buffer_t *target, vg_lite_path_t *path,
+                             vg_lite_fill_t fill_rule, vg_lite_matrix_t *matrix,
+                             vg_lite_blend_t blend, vg_lite_color_t color)
+{
+    uint32_t h = hash(&path, sizeof(path), FNV_OFFSET_BASIS);
+
+    h = (NULL != path) ? hash(&path->quality, sizeof(path->quality), h) : h;
+    h = hash(&fill_rule, sizeof(fill_rule), h);
+    h = (NULL != matrix) ? hash(matrix, sizeof(*matrix), h) : h;
+    h = hash(&blend, sizeof(blend), h);
+    h = hash(&color, sizeof(color), h);
+    log_call(VG_LITE_STUB_DRAW, target, h);
+    stub_stats.draw++;
+
+    return ((NULL == target) || (NULL == path) || (NULL == matrix)) ?
+           VG_LITE_INVALID_ARGUMENT : VG_LITE_SUCCESS;
+}
+
+vg_lite_error_t vg_lite_blit(vg_lite_buffer_t *target, vg_lite_buffer_t *source,
+                             vg_lite_matrix_t *matrix, vg_lite_blend_t blend,
+                             vg_lite_color_t color, vg_lite_filter_t filter)
+{
+    uint32_t h = hash(&source, sizeof(source), FNV_OFFSET_BASIS);
+
+    h = (NULL != matrix) ? hash(matrix, sizeof(*matrix), h) : h;
+    h = hash(&blend, sizeof(blend), h);
+    h = hash(&color, sizeof(color), h);
+    h = hash(&filter, sizeof(filter), h);
+    log_call(VG_LITE_STUB_BLIT, target, h);
+    stub_stats.blit++;
+
+    return ((NULL == target) || (NULL == source) || (NULL == matrix)) ?
+           VG_LITE_INVALID_ARGUMENT : VG_LITE_SUCCESS;
+}
+
+vg_lite_error_t vg_lite_blit_rect(vg_lite_buffer_t *target, vg_lite_buffer_t *source,
+                                  vg_lite_rectangle_t *rect, vg_lite_matrix_t *matrix,
+                                  vg_lite_blend_t blend, vg_lite_color_t color,
+                                  vg_lite_filter_t filter)
+{
+    uint32_t h = hash(&source, sizeof(source), FNV_OFFSET_BASIS);
+
+    h = (NULL != rect) ? hash(rect, sizeof(*rect), h) : h;
+    h = (NULL != matrix) ? hash(matrix, sizeof(*matrix), h) : h;
+    h = hash(&blend, sizeof(blend), h);
+    h = hash(&color, sizeof(color), h);
+    h = hash(&filter, sizeof(filter), h);
+    log_call(VG_LITE_STUB_BLIT_RECT, target, h);
+    stub_stats.blit_rect++;
+
+    return ((NULL == target) || (NULL == source) || (NULL == rect) || (NULL == matrix)) ?
+           VG_LITE_INVALID_ARGUMENT : VG_LITE_SUCCESS;
+}
+
+vg_lite_error_t vg_lite_draw_pattern(vg_lite_buffer_t *target, vg_lite_path_t *path,
+                                     vg_lite_fill_t fill_rule, vg_lite_matrix_t *path_matrix,
+                                     vg_lite_buffer_t *pattern_image,
+                                     vg_lite_matrix_t *pattern_matrix,
+                                     vg_lite_blend_t blend,
+                                     vg_lite_pattern_mode_t pattern_mode,
+                                     vg_lite_color_t pattern_color,
+                                     vg_lite_color_t color, vg_lite_filter_t filter)
+{
+    uint32_t h = hash(&path, sizeof(path), FNV_OFFSET_BASIS);
+
+    h = (NULL != path) ? hash(&path->quality, sizeof(path->quality), h) : h;
+    h = hash(&fill_rule, sizeof(fill_rule), h);
+    h = (NULL != path_matrix) ? hash(path_matrix, sizeof(*path_matrix), h) : h;
+    h = hash(&pattern_image, sizeof(pattern_image), h);
+    h = (NULL != pattern_matrix) ? hash(pattern_matrix, sizeof(*pattern_matrix), h) : h;
+    h = hash(&blend, sizeof(blend), h);
+    h = hash(&pattern_mode, sizeof(pattern_mode), h);
+    h = hash(&pattern_color, sizeof(pattern_color), h);
+    h = hash(&color, sizeof(color), h);
+    h = hash(&filter, sizeof(filter), h);
+    log_call(VG_LITE_STUB_DRAW_PATTERN, target, h);
+    stub_stats.draw_pattern++;
+
+    return ((NULL == target) || (NULL == path) || (NULL == path_matrix) ||
+            (NULL == pattern_image) || (NULL == pattern_matrix)) ?
+           VG_LITE_INVALID_ARGUMENT : VG_LITE_SUCCESS;
+}
+
+vg_lite_error_t vg_lite_set_scissor(vg_lite_int32_t x, vg_lite_int32_t y,
+                                    vg_lite_int32_t right, vg_lite_int32_t bottom)
+{
+    (void)x;
+    (void)y;
+    (void)right;
+    (void)bottom;
+    stub_stats.scissor++;
+
+    return VG_LITE_SUCCESS;
+}
+
+vg_lite_error_t vg_lite_set_CLUT(vg_lite_uint32_t count, vg_lite_uint32_t *colors)
+{
+    if ((NULL == colors) || ((2U != count) && (4U != count) && (16U != count) && (256U != count)))
+    {
+        return VG_LITE_INVALID_ARGUMENT;
+    }
+    stub_stats.set_clut++;
+    stub_stats.clut_count = count;
+
+    return VG_LITE_SUCCESS;
+}
+
+vg_lite_error_t vg_lite_enable_scissor(void)
+{
+    return VG_LITE_SUCCESS;
+}
+
+vg_lite_error_t vg_lite_disable_scissor(void)
+{
+    return VG_LITE_SUCCESS;
+}
+
+vg_lite_error_t vg_lite_flush(void)
+{
+    stub_stats.flush++;
+
+    return VG_LITE_SUCCESS;
+}
+
+vg_lite_error_t vg_lite_finish(void)
+{
+    stub_stats.finish++;
+
+    return vg_lite_flush();
+}
+
+vg_lite_error_t vg_lite_allocate_with_align(vg_lite_buffer_t *buffer, vg_lite_uint32_t align)
+{
+    uint32_t bits;
+
+    if ((NULL == buffer) || (buffer->width <= 0) || (buffer->height <= 0) ||
+        (0U == align) || (0U != (align & (align - 1U))))
+    {
+        return VG_LITE_INVALID_ARGUMENT;
+    }
+
+    switch (buffer->format)
+    {
+        case VG_LITE_BGR565:
+        case VG_LITE_RGB565:
+            bits = 16U;
+            break;
+        case VG_LITE_L8:
+        case VG_LITE_A8:
+        case VG_LITE_INDEX_8:
+            bits = 8U;
+            break;
+        case VG_LITE_A4:
+        case VG_LITE_INDEX_4:
+            bits = 4U;
+            break;
+        default:
+            bits = 32U;
+            break;
+    }
+
+    buffer->stride = (vg_lite_int32_t)(((((((uint32_t)buffer->width * bits) + 7U) / 8U) +
+                                         VG_LITE_STUB_STRIDE_ALIGN - 1U) /
+                                        VG_LITE_STUB_STRIDE_ALIGN) * VG_LITE_STUB_STRIDE_ALIGN);
+    buffer->handle = heap_alloc((uint32_t)buffer->stride * (uint32_t)buffer->height, align);
+    if (NULL == buffer->handle)
+    {
+        return VG_LITE_OUT_OF_MEMORY;
+    }
+    buffer->memory  = buffer->handle;
+    buffer->address = (vg_lite_uint32_t)((uint8_t *)buffer->memory - stub_heap);
+
+    return VG_LITE_SUCCESS;
+}
+
+vg_lite_error_t vg_lite_allocate(vg_lite_buffer_t *buffer)
+{
+    return vg_lite_allocate_with_align(buffer, VG_LITE_STUB_HEAP_ALIGN);
+}
+
+vg_lite_error_t vg_lite_free(vg_lite_buffer_t *buffer)
+{
+    if ((NULL == buffer) || (NULL == buffer->handle))
+    {
+        return VG_LITE_INVALID_ARGUMENT;
+    }
+
+    heap_free(buffer->handle);
+    buffer->handle  = NULL;
+    buffer->memory  = NULL;
+    buffer->address = 0U;
+
+    return VG_LITE_SUCCESS;
+}
+
+vg_lite_error_t vg_lite_upload_path(vg_lite_path_t *path)
+{
+    uint32_t bytes;
+
+    if ((NULL == path) || (NULL == path->path) || (NULL != path->uploaded.handle))
+    {
+        return VG_LITE_INVALID_ARGUMENT;
+    }
+
+    bytes = path->path_length + VG_LITE_STUB_UPLOAD_HEADER;
+    path->uploaded.handle = heap_alloc(bytes, VG_LITE_STUB_HEAP_ALIGN);
+    if (NULL == path->uploaded.handle)
+    {
+        return VG_LITE_OUT_OF_MEMORY;
+    }
+    memcpy((uint8_t *)path->uploaded.handle + VG_LITE_STUB_UPLOAD_HEADER, path->path,
+           path->path_length);
+    path->uploaded.memory = path->uploaded.handle;
+    path->uploaded.bytes  = bytes;
+    stub_stats.upload_path++;
+    stub_stats.uploaded_bytes += bytes;
+
+    return VG_LITE_SUCCESS;
+}
+
+/* Like the driver, also drops the data pointer of the path */
+vg_lite_error_t vg_lite_clear_path(vg_lite_path_t *path)
+{
+    if (NULL == path)
+    {
+        return VG_LITE_INVALID_ARGUMENT;
+    }
+
+    if (NULL != path->uploaded.handle)
+    {
+        stub_stats.uploaded_bytes -= path->uploaded.bytes;
+        heap_free(path->uploaded.handle);
+        memset(&path->uploaded, 0, sizeof(path->uploaded));
+    }
+    path->path = NULL;
+    stub_stats.clear_path++;
+
+    return VG_LITE_SUCCESS;
+}
+
+/*******************************************************************************
+* Function Name: vg_lite_stub_heap_base
+********************************************************************************
+* Summary:
+*  Returns the start of the stand-in heap, VG_LITE_STUB_HEAP_SIZE bytes long.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  uint8_t* - First byte of the heap
+*
+*******************************************************************************/
+uint8_t *vg_lite_stub_heap_base(void)
+{
+    return stub_heap;
+}
+
+/*******************************************************************************
+* Function Name: vg_lite_stub_get_stats
+********************************************************************************
+* Summary:
+*  Returns the number of calls made to the stand-in, optionally resetting
+*  the counters.
+*
+* Parameters:
+*  stats - Output counters
+*  reset - true to clear the counters after reading them
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void vg_lite_stub_get_stats(vg_lite_stub_stats_t *stats, bool reset)
+{
+    uint32_t uploaded_bytes = stub_stats.uploaded_bytes;
+    uint32_t clut_count = stub_stats.clut_count;
+
+    *stats = stub_stats;
+
+    if (reset)
+    {
+        memset(&stub_stats, 0, sizeof(stub_stats));
+        stub_stats.uploaded_bytes = uploaded_bytes;
+        stub_stats.clut_count = clut_count;
+    }
+}
+
+/*******************************************************************************
+* Function Name: vg_lite_stub_get_log
+********************************************************************************
+* Summary:
+*  Copies the logged draw calls, optionally clearing the log.
+*
+* Parameters:
+*  log       - Output array
+*  max_calls - Size of the output array
+*  reset     - true to clear the log after reading it
+*
+* Return:
+*  uint32_t  - Number of calls made since the last reset, which may exceed
+*              the number of entries copied
+*
+*******************************************************************************/
+uint32_t vg_lite_stub_get_log(vg_lite_stub_call_t *log, uint32_t max_calls,
+                              bool reset)
+{
+    uint32_t count = stub_log_count;
+
+    for (uint32_t i = 0; (i < count) && (i < max_calls) && (i < VG_LITE_STUB_LOG_SIZE); i++)
+    {
+        log[i] = stub_log[i];
+    }
+
+    if (reset)
+    {
+        stub_log_count = 0U;
+    }
+
+    return count;
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,119 @@
+/*******************************************************************************
+* File Name        : vg_lite_stub.h
+*
+* Description      : Call counters of the host VGLite stand-in.
+*
+* Related Document : See README.md
+*
+********************************************************************************
+* Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+
+#ifndef VG_LITE_STUB_H
+#define VG_LITE_STUB_H
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include <stdint.h>
+#include <stdbool.h>
+#include "vg_lite.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+#define VG_LITE_STUB_LOG_SIZE               (64U)
+
+/* Command header the stand-in adds to an uploaded path */
+#define VG_LITE_STUB_UPLOAD_HEADER          (16U)
+
+/* Contiguous heap the buffers and uploaded paths are allocated from, first
+ * fit like the driver */
+#define VG_LITE_STUB_HEAP_SIZE              ((8U) * (1024U) * (1024U))
+#define VG_LITE_STUB_HEAP_BLOCKS            (256U)
+#define VG_LITE_STUB_HEAP_ALIGN             (64U)
+#define VG_LITE_STUB_STRIDE_ALIGN           (64U)
+
+/*******************************************************************************
+* Data Structures and Types
+*******************************************************************************/
+typedef enum {
+    VG_LITE_STUB_CLEAR,
+    VG_LITE_STUB_DRAW,
+    VG_LITE_STUB_BLIT,
+    VG_LITE_STUB_BLIT_RECT,
+    VG_LITE_STUB_DRAW_PATTERN
+} vg_lite_stub_op_t;
+
+/* One logged draw call: the target and a hash of all other arguments */
+typedef struct {
+    vg_lite_stub_op_t op;
+    vg_lite_buffer_t *target;
+    uint32_t args_hash;
+} vg_lite_stub_call_t;
+
+typedef struct {
+    uint32_t clear;
+    uint32_t draw;
+    uint32_t blit;
+    uint32_t blit_rect;
+    uint32_t draw_pattern;
+    uint32_t scissor;
+    uint32_t flush;
+    uint32_t finish;
+    uint32_t upload_path;
+    uint32_t clear_path;
+    uint32_t set_clut;
+    uint32_t clut_count;        /* Entries of the last table loaded, not reset */
+    uint32_t uploaded_bytes;    /* Heap held by uploaded paths, not reset */
+} vg_lite_stub_stats_t;
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+uint8_t *vg_lite_stub_heap_base(void);
+void vg_lite_stub_get_stats(vg_lite_stub_stats_t *stats, bool reset);
+uint32_t vg_lite_stub_get_log(vg_lite_stub_call_t *log, uint32_t max_calls,
+                              bool reset);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* VG_LITE_STUB_H */
+
+/* [] END OF FILE */
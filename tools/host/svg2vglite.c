@@ -0,0 +1,1953 @@
+/*******************************************************************************
+* File Name        : svg2vglite.c
+*
+* Description      : Host tool compiling the paths of an SVG file into VGLite path
+*                    data. Transforms are flattened into the coordinates, every path is
+*                    stored in the narrowest coordinate format its values fit in, with
+*                    exact bounds, and emitted as const aligned C arrays together with
+*                    their vg_lite_path_t descriptors.
+*
+* Related Document : See README.md
+*
+********************************************************************************
+* Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+
+#include <ctype.h>
+#include <errno.h>
+#include <math.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+#define MAX_GROUP_DEPTH                     (32U)
+#define MAX_NAME_LENGTH                     (64U)
+#define MAX_ARC_SEGMENTS                    (4U)
+#define DATA_ALIGNMENT                      (4U)
+#define DEFAULT_FILL                        (0xFF000000U)
+#define OUTPUT_FORMAT_COUNT                 (3U)
+#define INITIAL_CAPACITY                    (64U)
+#define PI                                  (3.14159265358979323846)
+#define MACRO_VALUE_COLUMN                  (44U)
+
+/*******************************************************************************
+* Data Structures and Types
+*******************************************************************************/
+
+typedef enum {
+    SEG_MOVE,
+    SEG_LINE,
+    SEG_QUAD,
+    SEG_CUBIC,
+    SEG_CLOSE
+} seg_type_t;
+
+/* Segment in output coordinates, the end point is the last point */
+typedef struct {
+    seg_type_t type;
+    double pt[3][2];
+} segment_t;
+
+/* Quantized segment */
+typedef struct {
+    seg_type_t type;
+    int64_t pt[3][2];
+    bool relative;
+} qsegment_t;
+
+typedef struct {
+    double a, b, c, d, e, f;    /* x' = a*x + c*y + e, y' = b*x + d*y + f */
+} affine_t;
+
+/* Inherited presentation state of a group */
+typedef struct {
+    affine_t transform;
+    uint32_t fill;              /* 0xAARRGGBB, alpha 0 for none */
+    bool even_odd;
+} style_t;
+
+typedef struct {
+    uint32_t fill;
+    bool even_odd;
+    char id[MAX_NAME_LENGTH];
+    segment_t *segs;
+    size_t count;
+    size_t capacity;
+    double bounds[4];           /* left, top, right, bottom */
+} shape_t;
+
+typedef struct {
+    const char *c_type;
+    const char *vg_format;
+    int64_t min;
+    int64_t max;
+    size_t size;
+} output_format_t;
+
+typedef struct {
+    const char *input;
+    const char *name;
+    const char *quality;
+    double scale;
+    int min_format;             /* Index into formats[] */
+    bool per_element;           /* One path per SVG element */
+    bool origin;                /* Move the union bounds to 0,0 */
+} options_t;
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+static const output_format_t formats[OUTPUT_FORMAT_COUNT] =
+{
+    { "int8_t",  "VG_LITE_S8",  INT8_MIN,  INT8_MAX,  sizeof(int8_t)  },
+    { "int16_t", "VG_LITE_S16", INT16_MIN, INT16_MAX, sizeof(int16_t) },
+    { "int32_t", "VG_LITE_S32", INT32_MIN, INT32_MAX, sizeof(int32_t) }
+};
+
+static const affine_t identity = { 1.0, 0.0, 0.0, 1.0, 0.0, 0.0 };
+
+static shape_t *shapes;
+static size_t shape_count;
+static size_t shape_capacity;
+
+
+/*******************************************************************************
+* Function Name: fail
+********************************************************************************
+* Summary:
+*  Prints an error and terminates the tool.
+*
+* Parameters:
+*  message - Error description
+*  detail  - Additional text, may be NULL
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void fail(const char *message, const char *detail)
+{
+    fprintf(stderr, "svg2vglite: %s%s%.40s\n", message, (NULL != detail) ? ": " : "",
+            (NULL != detail) ? detail : "");
+    exit(EXIT_FAILURE);
+}
+
+/*******************************************************************************
+* Function Name: grow
+********************************************************************************
+* Summary:
+*  Makes room for one more element in a dynamic array.
+*
+* Parameters:
+*  array    - Pointer to the array pointer
+*  count    - Number of elements in use
+*  capacity - Pointer to the allocated number of elements
+*  size     - Size of one element
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void grow(void **array, size_t count, size_t *capacity, size_t size)
+{
+    if (count >= *capacity)
+    {
+        *capacity = (0U == *capacity) ? INITIAL_CAPACITY : (*capacity * 2U);
+        *array = realloc(*array, *capacity * size);
+        if (NULL == *array)
+        {
+            fail("out of memory", NULL);
+        }
+    }
+}
+
+/*******************************************************************************
+* Function Name: affine_multiply
+********************************************************************************
+* Summary:
+*  Concatenates two transforms, the child is applied first.
+*
+* Parameters:
+*  parent - Outer transform
+*  child  - Inner transform
+*
+* Return:
+*  affine_t - parent * child
+*
+*******************************************************************************/
+static affine_t affine_multiply(const affine_t *parent, const affine_t *child)
+{
+    affine_t r;
+
+    r.a = (parent->a * child->a) + (parent->c * child->b);
+    r.b = (parent->b * child->a) + (parent->d * child->b);
+    r.c = (parent->a * child->c) + (parent->c * child->d);
+    r.d = (parent->b * child->c) + (parent->d * child->d);
+    r.e = (parent->a * child->e) + (parent->c * child->f) + parent->e;
+    r.f = (parent->b * child->e) + (parent->d * child->f) + parent->f;
+
+    return r;
+}
+
+/*******************************************************************************
+* Function Name: affine_apply
+********************************************************************************
+* Summary:
+*  Transforms a point.
+*
+* Parameters:
+*  m   - Transform
+*  x   - X coordinate
+*  y   - Y coordinate
+*  out - Transformed point
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void affine_apply(const affine_t *m, double x, double y, double out[2])
+{
+    out[0] = (m->a * x) + (m->c * y) + m->e;
+    out[1] = (m->b * x) + (m->d * y) + m->f;
+}
+
+/*******************************************************************************
+* Function Name: skip_separators
+********************************************************************************
+* Summary:
+*  Skips white space and commas.
+*
+* Parameters:
+*  p    - Text position
+*
+* Return:
+*  const char* - First character that is not a separator
+*
+*******************************************************************************/
+static const char *skip_separators(const char *p)
+{
+    while (isspace((unsigned char)*p) || (',' == *p))
+    {
+        p++;
+    }
+
+    return p;
+}
+
+/*******************************************************************************
+* Function Name: parse_number
+********************************************************************************
+* Summary:
+*  Parses an SVG number, which may directly follow the previous one, e.g.
+*  "1.5.5" or "3-4".
+*
+* Parameters:
+*  p     - Pointer to the text position, advanced past the number
+*  value - Parsed value
+*
+* Return:
+*  bool  - false if no number follows
+*
+*******************************************************************************/
+static bool parse_number(const char **p, double *value)
+{
+    const char *s = skip_separators(*p);
+    const char *q = s;
+    char buffer[MAX_NAME_LENGTH];
+    size_t length;
+    size_t digits = 0U;
+
+    if (('+' == *q) || ('-' == *q))
+    {
+        q++;
+    }
+    while (isdigit((unsigned char)*q))
+    {
+        q++;
+        digits++;
+    }
+    if ('.' == *q)
+    {
+        q++;
+        while (isdigit((unsigned char)*q))
+        {
+            q++;
+            digits++;
+        }
+    }
+    if (0U == digits)
+    {
+        return false;
+    }
+    if ((('e' == *q) || ('E' == *q)) &&
+        (isdigit((unsigned char)q[1]) ||
+         ((('+' == q[1]) || ('-' == q[1])) && isdigit((unsigned char)q[2]))))
+    {
+        q += 2;
+        while (isdigit((unsigned char)*q))
+        {
+            q++;
+        }
+    }
+
+    length = (size_t)(q - s);
+    if (length >= sizeof(buffer))
+    {
+        fail("number too long", s);
+    }
+    memcpy(buffer, s, length);
+    buffer[length] = '\0';
+    *value = strtod(buffer, NULL);
+    *p = q;
+
+    return true;
+}
+
+/*******************************************************************************
+* Function Name: parse_flag
+********************************************************************************
+* Summary:
+*  Parses an arc flag, a single '0' or '1' that needs no separator.
+*
+* Parameters:
+*  p    - Pointer to the text position, advanced past the flag
+*  flag - Parsed flag
+*
+* Return:
+*  bool - false if no flag follows
+*
+*******************************************************************************/
+static bool parse_flag(const char **p, bool *flag)
+{
+    const char *s = skip_separators(*p);
+
+    if (('0' != *s) && ('1' != *s))
+    {
+        return false;
+    }
+    *flag = ('1' == *s);
+    *p = s + 1;
+
+    return true;
+}
+
+/*******************************************************************************
+* Function Name: parse_transform
+********************************************************************************
+* Summary:
+*  Parses a transform attribute, a list of matrix, translate, scale, rotate,
+*  skewX and skewY functions.
+*
+* Parameters:
+*  text - Attribute value
+*
+* Return:
+*  affine_t - Combined transform
+*
+*******************************************************************************/
+static affine_t parse_transform(const char *text)
+{
+    affine_t result = identity;
+    const char *p = text;
+
+    for (;;)
+    {
+        char function[MAX_NAME_LENGTH];
+        double args[6];
+        size_t length = 0U;
+        size_t argc = 0U;
+        affine_t t = identity;
+
+        p = skip_separators(p);
+        if ('\0' == *p)
+        {
+            break;
+        }
+        while (isalpha((unsigned char)*p) && (length < (sizeof(function) - 1U)))
+        {
+            function[length++] = *p++;
+        }
+        function[length] = '\0';
+        p = skip_separators(p);
+        if ('(' != *p)
+        {
+            fail("malformed transform", text);
+        }
+        p++;
+        while ((argc < 6U) && parse_number(&p, &args[argc]))
+        {
+            argc++;
+        }
+        p = skip_separators(p);
+        if (')' != *p)
+        {
+            fail("malformed transform", text);
+        }
+        p++;
+
+        if ((0 == strcmp(function, "matrix")) && (6U == argc))
+        {
+            t.a = args[0]; t.b = args[1]; t.c = args[2];
+            t.d = args[3]; t.e = args[4]; t.f = args[5];
+        }
+        else if ((0 == strcmp(function, "translate")) && (argc >= 1U))
+        {
+            t.e = args[0];
+            t.f = (argc >= 2U) ? args[1] : 0.0;
+        }
+        else if ((0 == strcmp(function, "scale")) && (argc >= 1U))
+        {
+            t.a = args[0];
+            t.d = (argc >= 2U) ? args[1] : args[0];
+        }
+        else if ((0 == strcmp(function, "rotate")) && (argc >= 1U))
+        {
+            double r = args[0] * PI / 180.0;
+            double cx = (argc >= 3U) ? args[1] : 0.0;
+            double cy = (argc >= 3U) ? args[2] : 0.0;
+
+            t.a = cos(r); t.b = sin(r); t.c = -sin(r); t.d = cos(r);
+            t.e = cx - (t.a * cx) - (t.c * cy);
+            t.f = cy - (t.b * cx) - (t.d * cy);
+        }
+        else if ((0 == strcmp(function, "skewX")) && (1U == argc))
+        {
+            t.c = tan(args[0] * PI / 180.0);
+        }
+        else if ((0 == strcmp(function, "skewY")) && (1U == argc))
+        {
+            t.b = tan(args[0] * PI / 180.0);
+        }
+        else
+        {
+            fail("unsupported transform", function);
+        }
+
+        result = affine_multiply(&result, &t);
+    }
+
+    return result;
+}
+
+/*******************************************************************************
+* Function Name: parse_color
+********************************************************************************
+* Summary:
+*  Parses a paint value. Supports "none" and #rgb / #rrggbb colors.
+*
+* Parameters:
+*  text   - Paint value
+*  length - Length of the value
+*  color  - Parsed color, 0xAARRGGBB with alpha 0 for none
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void parse_color(const char *text, size_t length, uint32_t *color)
+{
+    char buffer[MAX_NAME_LENGTH];
+    unsigned long value;
+
+    while ((length > 0U) && isspace((unsigned char)*text))
+    {
+        text++;
+        length--;
+    }
+    while ((length > 0U) && isspace((unsigned char)text[length - 1U]))
+    {
+        length--;
+    }
+    if (length >= sizeof(buffer))
+    {
+        fail("unsupported color", text);
+    }
+    memcpy(buffer, text, length);
+    buffer[length] = '\0';
+
+    if (0 == strcmp(buffer, "none"))
+    {
+        *color = 0U;
+    }
+    else if (('#' == buffer[0]) && (7U == length))
+    {
+        value = strtoul(&buffer[1], NULL, 16);
+        *color = 0xFF000000U | (uint32_t)value;
+    }
+    else if (('#' == buffer[0]) && (4U == length))
+    {
+        value = strtoul(&buffer[1], NULL, 16);
+        *color = 0xFF000000U | (uint32_t)(((value & 0xF00U) * 0x1100U) |
+                                          ((value & 0x0F0U) * 0x110U) |
+                                          ((value & 0x00FU) * 0x11U));
+    }
+    else
+    {
+        fail("unsupported color", buffer);
+    }
+}
+
+/*******************************************************************************
+* Function Name: find_attribute
+********************************************************************************
+* Summary:
+*  Looks up an attribute of an element.
+*
+* Parameters:
+*  tag    - Text of the start tag, from '<' to '>'
+*  end    - End of the start tag
+*  name   - Attribute name
+*  length - Length of the value
+*
+* Return:
+*  const char* - Start of the value, NULL if the attribute is not present
+*
+*******************************************************************************/
+static const char *find_attribute(const char *tag, const char *end, const char *name,
+                                  size_t *length)
+{
+    size_t name_length = strlen(name);
+    const char *p = tag;
+
+    while ((p = strstr(p, name)) != NULL && (p < end))
+    {
+        const char *q = p + name_length;
+
+        if (isspace((unsigned char)p[-1]))
+        {
+            q = skip_separators(q);
+            if ('=' == *q)
+            {
+                char quote;
+                const char *value;
+
+                q = skip_separators(q + 1);
+                quote = *q;
+                value = q + 1;
+                q = strchr(value, quote);
+                if ((NULL == q) || (q > end))
+                {
+                    fail("unterminated attribute", name);
+                }
+                *length = (size_t)(q - value);
+                return value;
+            }
+        }
+        p += name_length;
+    }
+
+    return NULL;
+}
+
+/*******************************************************************************
+* Function Name: copy_attribute
+********************************************************************************
+* Summary:
+*  Returns a NUL terminated copy of an attribute value.
+*
+* Parameters:
+*  value  - Start of the value
+*  length - Length of the value
+*
+* Return:
+*  char*  - Allocated copy
+*
+*******************************************************************************/
+static char *copy_attribute(const char *value, size_t length)
+{
+    char *copy = malloc(length + 1U);
+
+    if (NULL == copy)
+    {
+        fail("out of memory", NULL);
+    }
+    memcpy(copy, value, length);
+    copy[length] = '\0';
+
+    return copy;
+}
+
+/*******************************************************************************
+* Function Name: apply_style
+********************************************************************************
+* Summary:
+*  Updates the inherited state with the transform, fill and fill-rule of an
+*  element, given as attributes or as properties of its style attribute.
+*
+* Parameters:
+*  tag   - Start of the tag
+*  end   - End of the tag
+*  style - State to be updated
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void apply_style(const char *tag, const char *end, style_t *style)
+{
+    const char *value;
+    size_t length;
+
+    value = find_attribute(tag, end, "transform", &length);
+    if (NULL != value)
+    {
+        char *text = copy_attribute(value, length);
+        affine_t t = parse_transform(text);
+
+        style->transform = affine_multiply(&style->transform, &t);
+        free(text);
+    }
+
+    value = find_attribute(tag, end, "fill", &length);
+    if (NULL != value)
+    {
+        parse_color(value, length, &style->fill);
+    }
+
+    value = find_attribute(tag, end, "fill-rule", &length);
+    if (NULL != value)
+    {
+        style->even_odd = (0 == strncmp(value, "evenodd", length));
+    }
+
+    value = find_attribute(tag, end, "style", &length);
+    if (NULL != value)
+    {
+        const char *p = value;
+        const char *stop = value + length;
+
+        while (p < stop)
+        {
+            const char *colon = memchr(p, ':', (size_t)(stop - p));
+            const char *semicolon;
+
+            if (NULL == colon)
+            {
+                break;
+            }
+            semicolon = memchr(colon, ';', (size_t)(stop - colon));
+            semicolon = (NULL != semicolon) ? semicolon : stop;
+            p = skip_separators(p);
+            if (0 == strncmp(p, "fill:", 5U))
+            {
+                parse_color(colon + 1, (size_t)(semicolon - colon - 1), &style->fill);
+            }
+            else if (0 == strncmp(p, "fill-rule:", 10U))
+            {
+                style->even_odd = (NULL != strstr(colon, "evenodd")) &&
+                                  (strstr(colon, "evenodd") < semicolon);
+            }
+            p = semicolon + 1;
+        }
+    }
+}
+
+/*******************************************************************************
+* Function Name: add_segment
+********************************************************************************
+* Summary:
+*  Appends a segment to a shape, transforming its points.
+*
+* Parameters:
+*  shape - Shape
+*  m     - Transform of the element
+*  type  - Segment type
+*  pts   - Points in user coordinates, the end point last
+*  count - Number of points
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void add_segment(shape_t *shape, const affine_t *m, seg_type_t type,
+                        const double pts[][2], size_t count)
+{
+    segment_t *seg;
+
+    grow((void **)&shape->segs, shape->count, &shape->capacity, sizeof(segment_t));
+    seg = &shape->segs[shape->count++];
+    memset(seg, 0, sizeof(*seg));
+    seg->type = type;
+    for (size_t i = 0; i < count; i++)
+    {
+        affine_apply(m, pts[i][0], pts[i][1], seg->pt[i]);
+    }
+}
+
+/*******************************************************************************
+* Function Name: add_arc
+********************************************************************************
+* Summary:
+*  Appends an elliptical arc as cubic Bezier segments of at most 90 degrees,
+*  following the endpoint to center conversion of the SVG specification.
+*
+* Parameters:
+*  shape - Shape
+*  m     - Transform of the element
+*  from  - Start point
+*  rx    - X radius
+*  ry    - Y radius
+*  angle - Rotation of the ellipse in degrees
+*  large - Large arc flag
+*  sweep - Sweep flag
+*  to    - End point
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void add_arc(shape_t *shape, const affine_t *m, const double from[2], double rx,
+                    double ry, double angle, bool large, bool sweep, const double to[2])
+{
+    double phi = angle * PI / 180.0;
+    double cos_phi = cos(phi);
+    double sin_phi = sin(phi);
+    double dx = (from[0] - to[0]) / 2.0;
+    double dy = (from[1] - to[1]) / 2.0;
+    double x1 = (cos_phi * dx) + (sin_phi * dy);
+    double y1 = (-sin_phi * dx) + (cos_phi * dy);
+    double lambda;
+    double num;
+    double coef;
+    double cx1;
+    double cy1;
+    double cx;
+    double cy;
+    double theta;
+    double delta;
+    uint32_t segments;
+
+    rx = fabs(rx);
+    ry = fabs(ry);
+    if ((0.0 == rx) || (0.0 == ry))
+    {
+        add_segment(shape, m, SEG_LINE, (const double (*)[2])to, 1U);
+        return;
+    }
+
+    lambda = ((x1 * x1) / (rx * rx)) + ((y1 * y1) / (ry * ry));
+    if (lambda > 1.0)
+    {
+        rx *= sqrt(lambda);
+        ry *= sqrt(lambda);
+    }
+
+    num = (rx * rx * ry * ry) - (rx * rx * y1 * y1) - (ry * ry * x1 * x1);
+    coef = sqrt(fmax(0.0, num / ((rx * rx * y1 * y1) + (ry * ry * x1 * x1))));
+    coef = (large == sweep) ? -coef : coef;
+    cx1 = coef * rx * y1 / ry;
+    cy1 = -coef * ry * x1 / rx;
+    cx = (cos_phi * cx1) - (sin_phi * cy1) + ((from[0] + to[0]) / 2.0);
+    cy = (sin_phi * cx1) + (cos_phi * cy1) + ((from[1] + to[1]) / 2.0);
+
+    theta = atan2((y1 - cy1) / ry, (x1 - cx1) / rx);
+    delta = atan2((-y1 - cy1) / ry, (-x1 - cx1) / rx) - theta;
+    if (sweep && (delta < 0.0))
+    {
+        delta += 2.0 * PI;
+    }
+    else if (!sweep && (delta > 0.0))
+    {
+        delta -= 2.0 * PI;
+    }
+
+    segments = (uint32_t)ceil(fabs(delta) / (PI / 2.0) - 1e-9);
+    segments = (0U == segments) ? 1U : segments;
+    if (segments > MAX_ARC_SEGMENTS)
+    {
+        segments = MAX_ARC_SEGMENTS;
+    }
+
+    for (uint32_t i = 0; i < segments; i++)
+    {
+        double t0 = theta + ((delta * i) / segments);
+        double t1 = theta + ((delta * (i + 1U)) / segments);
+        double k = (4.0 / 3.0) * tan((t1 - t0) / 4.0);
+        double e0[2] = { cos(t0), sin(t0) };
+        double e1[2] = { cos(t1), sin(t1) };
+        double unit[3][2] = {
+            { e0[0] - (k * e0[1]), e0[1] + (k * e0[0]) },
+            { e1[0] + (k * e1[1]), e1[1] - (k * e1[0]) },
+            { e1[0], e1[1] }
+        };
+        double pts[3][2];
+
+        for (uint32_t j = 0; j < 3U; j++)
+        {
+            double ux = rx * unit[j][0];
+            double uy = ry * unit[j][1];
+
+            pts[j][0] = (cos_phi * ux) - (sin_phi * uy) + cx;
+            pts[j][1] = (sin_phi * ux) + (cos_phi * uy) + cy;
+        }
+        if (i == (segments - 1U))
+        {
+            pts[2][0] = to[0];
+            pts[2][1] = to[1];
+        }
+        add_segment(shape, m, SEG_CUBIC, (const double (*)[2])pts, 3U);
+    }
+}
+
+/*******************************************************************************
+* Function Name: parse_path_data
+********************************************************************************
+* Summary:
+*  Parses the d attribute of a path into absolute, transformed segments.
+*  Smooth curves are expanded with their reflected control point and arcs are
+*  converted to cubic curves.
+*
+* Parameters:
+*  shape - Shape receiving the segments
+*  m     - Transform of the element
+*  d     - Path data
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void parse_path_data(shape_t *shape, const affine_t *m, const char *d)
+{
+    const char *p = d;
+    char command = '\0';
+    double current[2] = { 0.0, 0.0 };
+    double start[2] = { 0.0, 0.0 };
+    double last_control[2] = { 0.0, 0.0 };
+    char last_command = '\0';
+
+    for (;;)
+    {
+        double pts[3][2];
+        double values[7];
+        bool relative;
+        char upper;
+        size_t needed;
+
+        p = skip_separators(p);
+        if ('\0' == *p)
+        {
+            break;
+        }
+        if (isalpha((unsigned char)*p))
+        {
+            command = *p++;
+        }
+        else if (('\0' == command) || ('z' == tolower((unsigned char)command)))
+        {
+            fail("path data does not start with a command", p);
+        }
+
+        relative = (0 != islower((unsigned char)command));
+        upper = (char)toupper((unsigned char)command);
+
+        if ('Z' == upper)
+        {
+            add_segment(shape, &identity, SEG_CLOSE, NULL, 0U);
+            current[0] = start[0];
+            current[1] = start[1];
+            last_command = upper;
+            continue;
+        }
+
+        switch (upper)
+        {
+            case 'H': case 'V':       needed = 1U; break;
+            case 'M': case 'L': case 'T': needed = 2U; break;
+            case 'S': case 'Q':       needed = 4U; break;
+            case 'C':                 needed = 6U; break;
+            case 'A':                 needed = 7U; break;
+            default:
+                fail("unsupported path command", p - 1);
+                return;
+        }
+
+        for (size_t i = 0; i < needed; i++)
+        {
+            bool ok;
+
+            if (('A' == upper) && ((3U == i) || (4U == i)))
+            {
+                bool flag;
+
+                ok = parse_flag(&p, &flag);
+                values[i] = flag ? 1.0 : 0.0;
+            }
+            else
+            {
+                ok = parse_number(&p, &values[i]);
+            }
+            if (!ok)
+            {
+                fail("missing path argument", p);
+            }
+        }
+
+        /* Make every point absolute, in user coordinates */
+        if (relative)
+        {
+            if ('H' == upper)
+            {
+                values[0] += current[0];
+            }
+            else if ('V' == upper)
+            {
+                values[0] += current[1];
+            }
+            else if ('A' == upper)
+            {
+                values[5] += current[0];
+                values[6] += current[1];
+            }
+            else
+            {
+                for (size_t i = 0; i < needed; i += 2U)
+                {
+                    values[i]      += current[0];
+                    values[i + 1U] += current[1];
+                }
+            }
+        }
+
+        switch (upper)
+        {
+            case 'M':
+                pts[0][0] = values[0]; pts[0][1] = values[1];
+                add_segment(shape, m, SEG_MOVE, (const double (*)[2])pts, 1U);
+                start[0] = current[0] = pts[0][0];
+                start[1] = current[1] = pts[0][1];
+                /* Further coordinate pairs are implicit line commands */
+                command = relative ? 'l' : 'L';
+                break;
+
+            case 'L':
+            case 'H':
+            case 'V':
+                pts[0][0] = ('V' == upper) ? current[0] : values[0];
+                pts[0][1] = ('H' == upper) ? current[1] :
+                            (('V' == upper) ? values[0] : values[1]);
+                add_segment(shape, m, SEG_LINE, (const double (*)[2])pts, 1U);
+                current[0] = pts[0][0];
+                current[1] = pts[0][1];
+                break;
+
+            case 'C':
+            case 'S':
+                if ('S' == upper)
+                {
+                    bool smooth = ('C' == last_command) || ('S' == last_command);
+
+                    pts[0][0] = smooth ? ((2.0 * current[0]) - last_control[0]) : current[0];
+                    pts[0][1] = smooth ? ((2.0 * current[1]) - last_control[1]) : current[1];
+                    pts[1][0] = values[0]; pts[1][1] = values[1];
+                    pts[2][0] = values[2]; pts[2][1] = values[3];
+                }
+                else
+                {
+                    pts[0][0] = values[0]; pts[0][1] = values[1];
+                    pts[1][0] = values[2]; pts[1][1] = values[3];
+                    pts[2][0] = values[4]; pts[2][1] = values[5];
+                }
+                last_control[0] = pts[1][0];
+                last_control[1] = pts[1][1];
+                add_segment(shape, m, SEG_CUBIC, (const double (*)[2])pts, 3U);
+                current[0] = pts[2][0];
+                current[1] = pts[2][1];
+                break;
+
+            case 'Q':
+            case 'T':
+                if ('T' == upper)
+                {
+                    bool smooth = ('Q' == last_command) || ('T' == last_command);
+
+                    pts[0][0] = smooth ? ((2.0 * current[0]) - last_control[0]) : current[0];
+                    pts[0][1] = smooth ? ((2.0 * current[1]) - last_control[1]) : current[1];
+                    pts[1][0] = values[0]; pts[1][1] = values[1];
+                }
+                else
+                {
+                    pts[0][0] = values[0]; pts[0][1] = values[1];
+                    pts[1][0] = values[2]; pts[1][1] = values[3];
+                }
+                last_control[0] = pts[0][0];
+                last_control[1] = pts[0][1];
+                add_segment(shape, m, SEG_QUAD, (const double (*)[2])pts, 2U);
+                current[0] = pts[1][0];
+                current[1] = pts[1][1];
+                break;
+
+            case 'A':
+                pts[2][0] = values[5];
+                pts[2][1] = values[6];
+                add_arc(shape, m, current, values[0], values[1], values[2],
+                        (0.0 != values[3]), (0.0 != values[4]), pts[2]);
+                current[0] = pts[2][0];
+                current[1] = pts[2][1];
+                break;
+
+            default:
+                break;
+        }
+
+        last_command = upper;
+    }
+}
+
+/*******************************************************************************
+* Function Name: add_shape
+********************************************************************************
+* Summary:
+*  Compiles a path element into a new shape.
+*
+* Parameters:
+*  tag   - Start of the tag
+*  end   - End of the tag
+*  style - Inherited state, including the attributes of the element
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void add_shape(const char *tag, const char *end, const style_t *style)
+{
+    shape_t *shape;
+    const char *value;
+    size_t length;
+    char *d;
+
+    value = find_attribute(tag, end, "d", &length);
+    if ((NULL == value) || (0U == (style->fill >> 24)))
+    {
+        return;
+    }
+
+    grow((void **)&shapes, shape_count, &shape_capacity, sizeof(shape_t));
+    shape = &shapes[shape_count++];
+    memset(shape, 0, sizeof(*shape));
+    shape->fill     = style->fill;
+    shape->even_odd = style->even_odd;
+    snprintf(shape->id, sizeof(shape->id), "path%zu", shape_count - 1U);
+
+    d = copy_attribute(value, length);
+    parse_path_data(shape, &style->transform, d);
+    free(d);
+
+    /* Bounds of the control polygon, only used to decide on merging */
+    shape->bounds[0] = shape->bounds[1] = INFINITY;
+    shape->bounds[2] = shape->bounds[3] = -INFINITY;
+    for (size_t i = 0; i < shape->count; i++)
+    {
+        size_t points = (SEG_CUBIC == shape->segs[i].type) ? 3U :
+                        ((SEG_QUAD == shape->segs[i].type) ? 2U :
+                        ((SEG_CLOSE == shape->segs[i].type) ? 0U : 1U));
+
+        for (size_t j = 0; j < points; j++)
+        {
+            shape->bounds[0] = fmin(shape->bounds[0], shape->segs[i].pt[j][0]);
+            shape->bounds[1] = fmin(shape->bounds[1], shape->segs[i].pt[j][1]);
+            shape->bounds[2] = fmax(shape->bounds[2], shape->segs[i].pt[j][0]);
+            shape->bounds[3] = fmax(shape->bounds[3], shape->segs[i].pt[j][1]);
+        }
+    }
+}
+
+/*******************************************************************************
+* Function Name: parse_svg
+********************************************************************************
+* Summary:
+*  Scans the elements of an SVG document. Groups pass their transform and
+*  fill on to their children, path elements are compiled into shapes, other
+*  drawable elements are reported and ignored.
+*
+* Parameters:
+*  text - Document
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void parse_svg(const char *text)
+{
+    style_t stack[MAX_GROUP_DEPTH];
+    size_t depth = 0U;
+    const char *p = text;
+
+    stack[0].transform = identity;
+    stack[0].fill      = DEFAULT_FILL;
+    stack[0].even_odd  = false;
+
+    while (NULL != (p = strchr(p, '<')))
+    {
+        const char *end;
+        char name[MAX_NAME_LENGTH];
+        size_t length = 0U;
+        bool self_closing;
+
+        if (0 == strncmp(p, "<!--", 4U))
+        {
+            end = strstr(p, "-->");
+            if (NULL == end)
+            {
+                fail("unterminated comment", NULL);
+            }
+            p = end + 3;
+            continue;
+        }
+
+        end = strchr(p, '>');
+        if (NULL == end)
+        {
+            fail("unterminated tag", p);
+        }
+        self_closing = ('/' == end[-1]);
+
+        if ('/' == p[1])
+        {
+            if ((0 == strncmp(p, "</g", 3U)) && !isalnum((unsigned char)p[3]) && (depth > 0U))
+            {
+                depth--;
+            }
+            p = end + 1;
+            continue;
+        }
+
+        p++;
+        while ((isalnum((unsigned char)*p) || (':' == *p)) && (length < (sizeof(name) - 1U)))
+        {
+            name[length++] = *p++;
+        }
+        name[length] = '\0';
+
+        if (0 == strcmp(name, "g"))
+        {
+            style_t style = stack[depth];
+
+            apply_style(p, end, &style);
+            if (!self_closing)
+            {
+                if ((depth + 1U) >= MAX_GROUP_DEPTH)
+                {
+                    fail("groups nested too deeply", NULL);
+                }
+                stack[++depth] = style;
+            }
+        }
+        else if (0 == strcmp(name, "path"))
+        {
+            style_t style = stack[depth];
+
+            apply_style(p, end, &style);
+            add_shape(p, end, &style);
+        }
+        else if ((0 == strcmp(name, "rect")) || (0 == strcmp(name, "circle")) ||
+                 (0 == strcmp(name, "ellipse")) || (0 == strcmp(name, "line")) ||
+                 (0 == strcmp(name, "polygon")) || (0 == strcmp(name, "polyline")) ||
+                 (0 == strcmp(name, "text")) || (0 == strcmp(name, "use")))
+        {
+            fprintf(stderr, "svg2vglite: <%s> ignored, convert it to a path\n", name);
+        }
+        else
+        {
+            /* Not drawable or not drawn by itself */
+        }
+
+        p = end + 1;
+    }
+}
+
+/*******************************************************************************
+* Function Name: quantize
+********************************************************************************
+* Summary:
+*  Converts a coordinate to the integer grid of the output.
+*
+* Parameters:
+*  value  - Coordinate
+*  origin - Coordinate mapped to 0
+*  scale  - Output units per SVG unit
+*
+* Return:
+*  int64_t - Output coordinate
+*
+*******************************************************************************/
+static int64_t quantize(double value, double origin, double scale)
+{
+    return (int64_t)llround((value - origin) * scale);
+}
+
+/*******************************************************************************
+* Function Name: point_count
+********************************************************************************
+* Summary:
+*  Returns the number of points of a segment type.
+*
+* Parameters:
+*  type   - Segment type
+*
+* Return:
+*  size_t - Number of points
+*
+*******************************************************************************/
+static size_t point_count(seg_type_t type)
+{
+    switch (type)
+    {
+        case SEG_CUBIC: return 3U;
+        case SEG_QUAD:  return 2U;
+        case SEG_CLOSE: return 0U;
+        default:        return 1U;
+    }
+}
+
+/*******************************************************************************
+* Function Name: fits
+********************************************************************************
+* Summary:
+*  Checks whether the points of a segment, optionally relative to the current
+*  point, are within the range of a format.
+*
+* Parameters:
+*  seg      - Quantized segment
+*  current  - Current point, used if relative
+*  relative - true to check the relative encoding
+*  format   - Output format
+*
+* Return:
+*  bool     - true if all values fit
+*
+*******************************************************************************/
+static bool fits(const qsegment_t *seg, const int64_t current[2], bool relative,
+                 const output_format_t *format)
+{
+    for (size_t j = 0; j < point_count(seg->type); j++)
+    {
+        for (size_t k = 0; k < 2U; k++)
+        {
+            int64_t v = seg->pt[j][k] - (relative ? current[k] : 0);
+
+            if ((v < format->min) || (v > format->max))
+            {
+                return false;
+            }
+        }
+    }
+
+    return true;
+}
+
+/*******************************************************************************
+* Function Name: encode
+********************************************************************************
+* Summary:
+*  Chooses absolute or relative opcodes for every segment in a format.
+*  Absolute opcodes are preferred, relative ones are used where the absolute
+*  values do not fit. Relative values are differences of quantized points, so
+*  rounding errors do not accumulate. The first segment and the segment
+*  following a close use absolute opcodes.
+*
+* Parameters:
+*  segs   - Quantized segments, relative flags are updated
+*  count  - Number of segments
+*  format - Output format
+*
+* Return:
+*  bool   - true if the path can be encoded in the format
+*
+*******************************************************************************/
+static bool encode(qsegment_t *segs, size_t count, const output_format_t *format)
+{
+    int64_t current[2] = { 0, 0 };
+    int64_t start[2] = { 0, 0 };
+    bool known = false;
+
+    for (size_t i = 0; i < count; i++)
+    {
+        qsegment_t *seg = &segs[i];
+
+        if (SEG_CLOSE == seg->type)
+        {
+            seg->relative = false;
+            current[0] = start[0];
+            current[1] = start[1];
+            known = false;
+            continue;
+        }
+
+        if (fits(seg, current, false, format))
+        {
+            seg->relative = false;
+        }
+        else if (known && fits(seg, current, true, format))
+        {
+            seg->relative = true;
+        }
+        else
+        {
+            return false;
+        }
+
+        current[0] = seg->pt[point_count(seg->type) - 1U][0];
+        current[1] = seg->pt[point_count(seg->type) - 1U][1];
+        if (SEG_MOVE == seg->type)
+        {
+            start[0] = current[0];
+            start[1] = current[1];
+        }
+        known = true;
+    }
+
+    return true;
+}
+
+/*******************************************************************************
+* Function Name: extend_bounds
+********************************************************************************
+* Summary:
+*  Extends bounds by the extrema of one coordinate of a curve, found at the
+*  roots of its derivative.
+*
+* Parameters:
+*  bounds - left, top, right, bottom
+*  axis   - 0 for x, 1 for y
+*  p      - Coordinates of the start, control and end points
+*  count  - Number of points, 3 for a quadratic and 4 for a cubic curve
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void extend_bounds(double bounds[4], size_t axis, const double p[4], size_t count)
+{
+    double roots[2];
+    size_t root_count = 0U;
+
+    if (3U == count)
+    {
+        double den = p[0] - (2.0 * p[1]) + p[2];
+
+        if (0.0 != den)
+        {
+            roots[root_count++] = (p[0] - p[1]) / den;
+        }
+    }
+    else
+    {
+        /* Derivative / 3: a t^2 + b t + c */
+        double a = -p[0] + (3.0 * p[1]) - (3.0 * p[2]) + p[3];
+        double b = 2.0 * (p[0] - (2.0 * p[1]) + p[2]);
+        double c = p[1] - p[0];
+
+        if (fabs(a) < 1e-12)
+        {
+            if (0.0 != b)
+            {
+                roots[root_count++] = -c / b;
+            }
+        }
+        else
+        {
+            double disc = (b * b) - (4.0 * a * c);
+
+            if (disc >= 0.0)
+            {
+                roots[root_count++] = (-b + sqrt(disc)) / (2.0 * a);
+                roots[root_count++] = (-b - sqrt(disc)) / (2.0 * a);
+            }
+        }
+    }
+
+    for (size_t i = 0; i < root_count; i++)
+    {
+        double t = roots[i];
+        double u = 1.0 - t;
+        double v;
+
+        if ((t <= 0.0) || (t >= 1.0))
+        {
+            continue;
+        }
+        v = (3U == count) ? ((u * u * p[0]) + (2.0 * u * t * p[1]) + (t * t * p[2])) :
+            ((u * u * u * p[0]) + (3.0 * u * u * t * p[1]) + (3.0 * u * t * t * p[2]) +
+             (t * t * t * p[3]));
+        bounds[axis]      = fmin(bounds[axis], v);
+        bounds[axis + 2U] = fmax(bounds[axis + 2U], v);
+    }
+}
+
+/*******************************************************************************
+* Function Name: path_bounds
+********************************************************************************
+* Summary:
+*  Computes the exact bounds of the quantized path: the end points of all
+*  segments and the extrema of the curves, not their control points.
+*
+* Parameters:
+*  segs   - Quantized segments
+*  count  - Number of segments
+*  bounds - left, top, right, bottom
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void path_bounds(const qsegment_t *segs, size_t count, double bounds[4])
+{
+    double current[2] = { 0.0, 0.0 };
+    double start[2] = { 0.0, 0.0 };
+
+    bounds[0] = bounds[1] = INFINITY;
+    bounds[2] = bounds[3] = -INFINITY;
+
+    for (size_t i = 0; i < count; i++)
+    {
+        const qsegment_t *seg = &segs[i];
+        size_t points = point_count(seg->type);
+        double end[2];
+
+        if (SEG_CLOSE == seg->type)
+        {
+            current[0] = start[0];
+            current[1] = start[1];
+            continue;
+        }
+
+        end[0] = (double)seg->pt[points - 1U][0];
+        end[1] = (double)seg->pt[points - 1U][1];
+        bounds[0] = fmin(bounds[0], end[0]);
+        bounds[1] = fmin(bounds[1], end[1]);
+        bounds[2] = fmax(bounds[2], end[0]);
+        bounds[3] = fmax(bounds[3], end[1]);
+
+        if ((SEG_QUAD == seg->type) || (SEG_CUBIC == seg->type))
+        {
+            for (size_t axis = 0; axis < 2U; axis++)
+            {
+                double p[4] = { current[axis], 0.0, 0.0, 0.0 };
+
+                for (size_t j = 0; j < points; j++)
+                {
+                    p[j + 1U] = (double)seg->pt[j][axis];
+                }
+                extend_bounds(bounds, axis, p, points + 1U);
+            }
+        }
+
+        current[0] = end[0];
+        current[1] = end[1];
+        if (SEG_MOVE == seg->type)
+        {
+            start[0] = end[0];
+            start[1] = end[1];
+        }
+    }
+}
+
+/*******************************************************************************
+* Function Name: opcode_name
+********************************************************************************
+* Summary:
+*  Returns the VGLite opcode macro of a segment.
+*
+* Parameters:
+*  seg  - Quantized segment
+*
+* Return:
+*  const char* - Macro name
+*
+*******************************************************************************/
+static const char *opcode_name(const qsegment_t *seg)
+{
+    switch (seg->type)
+    {
+        case SEG_MOVE:  return seg->relative ? "VLC_OP_MOVE_REL" : "VLC_OP_MOVE";
+        case SEG_LINE:  return seg->relative ? "VLC_OP_LINE_REL" : "VLC_OP_LINE";
+        case SEG_QUAD:  return seg->relative ? "VLC_OP_QUAD_REL" : "VLC_OP_QUAD";
+        case SEG_CUBIC: return seg->relative ? "VLC_OP_CUBIC_REL" : "VLC_OP_CUBIC";
+        default:        return "VLC_OP_CLOSE";
+    }
+}
+
+/*******************************************************************************
+* Function Name: bounds_overlap
+********************************************************************************
+* Summary:
+*  Checks whether two rectangles intersect.
+*
+* Parameters:
+*  a - left, top, right, bottom
+*  b - left, top, right, bottom
+*
+* Return:
+*  bool - true if they intersect
+*
+*******************************************************************************/
+static bool bounds_overlap(const double a[4], const double b[4])
+{
+    return (a[0] <= b[2]) && (b[0] <= a[2]) && (a[1] <= b[3]) && (b[1] <= a[3]);
+}
+
+/*******************************************************************************
+* Function Name: emit_path
+********************************************************************************
+* Summary:
+*  Quantizes the shapes of one output path, selects the narrowest format,
+*  computes the bounds and writes the data array.
+*
+* Parameters:
+*  out     - Output file
+*  opt     - Options
+*  index   - Index of the output path
+*  first   - First shape of the path
+*  count   - Number of shapes
+*  origin  - Coordinates mapped to 0,0
+*  format  - Selected format
+*  bounds  - Exact bounds of the path
+*
+* Return:
+*  size_t  - Size of the data in bytes
+*
+*******************************************************************************/
+static size_t emit_path(FILE *out, const options_t *opt, size_t index, size_t first,
+                        size_t count, const double origin[2], const output_format_t **format,
+                        double bounds[4])
+{
+    qsegment_t *segs;
+    size_t total = 0U;
+    size_t n = 0U;
+    size_t elements = 1U;
+    int f;
+
+    for (size_t s = first; s < (first + count); s++)
+    {
+        total += shapes[s].count;
+    }
+    segs = calloc(total, sizeof(qsegment_t));
+    if (NULL == segs)
+    {
+        fail("out of memory", NULL);
+    }
+
+    for (size_t s = first; s < (first + count); s++)
+    {
+        for (size_t i = 0; i < shapes[s].count; i++, n++)
+        {
+            segs[n].type = shapes[s].segs[i].type;
+            for (size_t j = 0; j < point_count(segs[n].type); j++)
+            {
+                segs[n].pt[j][0] = quantize(shapes[s].segs[i].pt[j][0], origin[0], opt->scale);
+                segs[n].pt[j][1] = quantize(shapes[s].segs[i].pt[j][1], origin[1], opt->scale);
+            }
+        }
+    }
+
+    for (f = opt->min_format; f < (int)OUTPUT_FORMAT_COUNT; f++)
+    {
+        if (encode(segs, total, &formats[f]))
+        {
+            break;
+        }
+    }
+    if (f >= (int)OUTPUT_FORMAT_COUNT)
+    {
+        fail("coordinates exceed the S32 range, reduce the scale", NULL);
+    }
+    *format = &formats[f];
+    path_bounds(segs, total, bounds);
+
+    for (size_t i = 0; i < total; i++)
+    {
+        elements += 1U + (2U * point_count(segs[i].type));
+    }
+
+    fprintf(out, "/* %zu element%s, %zu segments, %s */\n", count, (1U == count) ? "" : "s",
+            total, (*format)->vg_format);
+    fprintf(out, "const %s %s_path_data%zu[] __attribute__((aligned(%u))) =\n{\n",
+            (*format)->c_type, opt->name, index, DATA_ALIGNMENT);
+    for (size_t i = 0; i < total; i++)
+    {
+        int64_t current[2] = { 0, 0 };
+
+        fprintf(out, "    %s", opcode_name(&segs[i]));
+        if (segs[i].relative)
+        {
+            /* The previous segment is not a close, see encode() */
+            size_t last = point_count(segs[i - 1U].type) - 1U;
+
+            current[0] = segs[i - 1U].pt[last][0];
+            current[1] = segs[i - 1U].pt[last][1];
+        }
+        for (size_t j = 0; j < point_count(segs[i].type); j++)
+        {
+            fprintf(out, ", %lld, %lld", (long long)(segs[i].pt[j][0] - current[0]),
+                    (long long)(segs[i].pt[j][1] - current[1]));
+        }
+        fprintf(out, ",\n");
+    }
+    fprintf(out, "    VLC_OP_END\n};\n\n");
+
+    free(segs);
+
+    return elements * (*format)->size;
+}
+
+/*******************************************************************************
+* Function Name: macro_padding
+********************************************************************************
+* Summary:
+*  Returns the number of spaces aligning the value of a macro definition with
+*  the column used in the rest of the code.
+*
+* Parameters:
+*  prefix - Macro prefix
+*  suffix - Macro suffix
+*
+* Return:
+*  int    - Number of spaces, at least one
+*
+*******************************************************************************/
+static int macro_padding(const char *prefix, const char *suffix)
+{
+    size_t used = strlen("#define ") + strlen(prefix) + strlen(suffix);
+
+    return (used < MACRO_VALUE_COLUMN) ? (int)(MACRO_VALUE_COLUMN - used) : 1;
+}
+
+/*******************************************************************************
+* Function Name: sanitize_name
+********************************************************************************
+* Summary:
+*  Derives a C identifier prefix from the input file name.
+*
+* Parameters:
+*  input  - Input path
+*
+* Return:
+*  char*  - Allocated identifier
+*
+*******************************************************************************/
+static char *sanitize_name(const char *input)
+{
+    const char *base = strrchr(input, '/');
+    char *name;
+    size_t length;
+
+    base = (NULL != base) ? (base + 1) : input;
+    name = copy_attribute(base, strlen(base));
+    length = strcspn(name, ".");
+    name[length] = '\0';
+    for (size_t i = 0; i < length; i++)
+    {
+        name[i] = isalnum((unsigned char)name[i]) ? (char)tolower((unsigned char)name[i]) : '_';
+    }
+
+    return name;
+}
+
+/*******************************************************************************
+* Function Name: read_file
+********************************************************************************
+* Summary:
+*  Reads a whole file into a NUL terminated buffer.
+*
+* Parameters:
+*  path  - File name
+*
+* Return:
+*  char* - Allocated contents
+*
+*******************************************************************************/
+static char *read_file(const char *path)
+{
+    FILE *file = fopen(path, "rb");
+    char *text;
+    long size;
+
+    if (NULL == file)
+    {
+        fail(strerror(errno), path);
+    }
+    if ((0 != fseek(file, 0L, SEEK_END)) || ((size = ftell(file)) < 0L) ||
+        (0 != fseek(file, 0L, SEEK_SET)))
+    {
+        fail("cannot read", path);
+    }
+    text = malloc((size_t)size + 1U);
+    if ((NULL == text) || (fread(text, 1U, (size_t)size, file) != (size_t)size))
+    {
+        fail("cannot read", path);
+    }
+    text[size] = '\0';
+    fclose(file);
+
+    return text;
+}
+
+/*******************************************************************************
+* Function Name: usage
+********************************************************************************
+* Summary:
+*  Prints the command line help and terminates the tool.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void usage(void)
+{
+    fprintf(stderr,
+            "usage: svg2vglite [-n name] [-s scale] [-f s8|s16|s32] [-q quality] [-p] [-o]"
+            " input.svg > output.h\n"
+            "  -n name     prefix of the generated symbols, default: input file name\n"
+            "  -s scale    output units per SVG unit, default: 1\n"
+            "  -f format   narrowest coordinate format to consider, default: s8\n"
+            "  -q quality  high, upper, medium or low, default: high\n"
+            "  -p          one path per SVG element, default: merge adjacent elements\n"
+            "              of the same fill that do not overlap\n"
+            "  -o          move the top left corner of the drawing to 0,0\n");
+    exit(EXIT_FAILURE);
+}
+
+/*******************************************************************************
+* Function Name: main
+********************************************************************************
+* Summary:
+*  Compiles an SVG file into a C header written to stdout. A summary of the
+*  paths is written to stderr.
+*
+* Parameters:
+*  argc - Number of arguments
+*  argv - Arguments
+*
+* Return:
+*  int  - 0 on success
+*
+*******************************************************************************/
+int main(int argc, char *argv[])
+{
+    options_t opt = { NULL, NULL, "VG_LITE_HIGH", 1.0, 0, false, false };
+    double origin[2] = { 0.0, 0.0 };
+    double all[4] = { INFINITY, INFINITY, -INFINITY, -INFINITY };
+    size_t *group_first;
+    size_t group_count = 0U;
+    size_t total_bytes = 0U;
+    size_t s32_bytes = 0U;
+    const output_format_t **path_format;
+    double (*path_box)[4];
+    char guard[MAX_NAME_LENGTH + sizeof("_PATHS_H")];
+    char upper[MAX_NAME_LENGTH];
+    char *text;
+    int c;
+
+    while (-1 != (c = getopt(argc, argv, "n:s:f:q:po")))
+    {
+        switch (c)
+        {
+            case 'n': opt.name = optarg; break;
+            case 's': opt.scale = strtod(optarg, NULL); break;
+            case 'p': opt.per_element = true; break;
+            case 'o': opt.origin = true; break;
+            case 'f':
+                opt.min_format = (0 == strcmp(optarg, "s8")) ? 0 :
+                                 ((0 == strcmp(optarg, "s16")) ? 1 :
+                                 ((0 == strcmp(optarg, "s32")) ? 2 : -1));
+                if (opt.min_format < 0)
+                {
+                    usage();
+                }
+                break;
+            case 'q':
+                opt.quality = (0 == strcmp(optarg, "high"))   ? "VG_LITE_HIGH" :
+                              (0 == strcmp(optarg, "upper"))  ? "VG_LITE_UPPER" :
+                              (0 == strcmp(optarg, "medium")) ? "VG_LITE_MEDIUM" :
+                              (0 == strcmp(optarg, "low"))    ? "VG_LITE_LOW" : NULL;
+                if (NULL == opt.quality)
+                {
+                    usage();
+                }
+                break;
+            default:
+                usage();
+                break;
+        }
+    }
+    if ((optind != (argc - 1)) || !(opt.scale > 0.0))
+    {
+        usage();
+    }
+    opt.input = argv[optind];
+    opt.name = (NULL != opt.name) ? opt.name : sanitize_name(opt.input);
+    if (strlen(opt.name) >= MAX_NAME_LENGTH)
+    {
+        fail("name too long", opt.name);
+    }
+
+    text = read_file(opt.input);
+    parse_svg(text);
+    free(text);
+    if (0U == shape_count)
+    {
+        fail("no filled path found", opt.input);
+    }
+
+    /* Group adjacent shapes that can share one path */
+    group_first = malloc((shape_count + 1U) * sizeof(size_t));
+    path_format = malloc(shape_count * sizeof(*path_format));
+    path_box    = malloc(shape_count * sizeof(*path_box));
+    if ((NULL == group_first) || (NULL == path_format) || (NULL == path_box))
+    {
+        fail("out of memory", NULL);
+    }
+    for (size_t s = 0; s < shape_count; s++)
+    {
+        bool merge = !opt.per_element && (s > 0U) &&
+                     (shapes[s].fill == shapes[s - 1U].fill) &&
+                     (shapes[s].even_odd == shapes[s - 1U].even_odd);
+
+        for (size_t t = (group_count > 0U) ? group_first[group_count - 1U] : 0U;
+             merge && (t < s); t++)
+        {
+            merge = !bounds_overlap(shapes[s].bounds, shapes[t].bounds);
+        }
+        if (!merge)
+        {
+            group_first[group_count++] = s;
+        }
+        all[0] = fmin(all[0], shapes[s].bounds[0]);
+        all[1] = fmin(all[1], shapes[s].bounds[1]);
+    }
+    group_first[group_count] = shape_count;
+    if (opt.origin)
+    {
+        origin[0] = all[0];
+        origin[1] = all[1];
+    }
+
+    for (size_t i = 0; opt.name[i] != '\0'; i++)
+    {
+        upper[i] = (char)toupper((unsigned char)opt.name[i]);
+        upper[i + 1U] = '\0';
+    }
+    snprintf(guard, sizeof(guard), "%s_PATHS_H", upper);
+
+    printf("/*******************************************************************************\n"
+           "* Generated by tools/host/svg2vglite from %s, do not edit.\n"
+           "* Defines the path data, include it in one source file only.\n"
+           "*******************************************************************************/\n\n"
+           "#ifndef %s\n#define %s\n\n"
+           "#if defined(__cplusplus)\nextern \"C\" {\n#endif\n\n"
+           "#include <stdint.h>\n#include \"vg_lite.h\"\n\n",
+           opt.input, guard, guard);
+
+    printf("/*******************************************************************************\n"
+           "* Macros\n"
+           "*******************************************************************************/\n"
+           "#define %s_PATH_COUNT%*s(%zuU)\n", upper,
+           macro_padding(upper, "_PATH_COUNT"), "", group_count);
+    if (1.0 != opt.scale)
+    {
+        printf("/* Output units per SVG unit, scale the path matrix by the inverse */\n"
+               "#define %s_SCALE%*s(%gf)\n", upper, macro_padding(upper, "_SCALE"), "",
+               opt.scale);
+    }
+    printf("\n/*******************************************************************************\n"
+           "* Global Variables\n"
+           "*******************************************************************************/\n");
+
+    for (size_t g = 0; g < group_count; g++)
+    {
+        size_t bytes = emit_path(stdout, &opt, g, group_first[g],
+                                 group_first[g + 1U] - group_first[g], origin,
+                                 &path_format[g], path_box[g]);
+
+        total_bytes += bytes;
+        s32_bytes += (bytes / path_format[g]->size) * sizeof(int32_t);
+        fprintf(stderr, "path %zu: %zu element(s), %s, %zu bytes, bounds %g,%g - %g,%g\n",
+                g, group_first[g + 1U] - group_first[g], path_format[g]->vg_format, bytes,
+                path_box[g][0], path_box[g][1], path_box[g][2], path_box[g][3]);
+    }
+
+    printf("/* Fill colors, vg_lite_color_t is 0xAABBGGRR */\n"
+           "const vg_lite_color_t %s_colors[%s_PATH_COUNT] =\n{\n", opt.name, upper);
+    for (size_t g = 0; g < group_count; g++)
+    {
+        uint32_t argb = shapes[group_first[g]].fill;
+
+        printf("    0x%08XU,\n", (argb & 0xFF00FF00U) | ((argb >> 16) & 0xFFU) |
+               ((argb & 0xFFU) << 16));
+    }
+    printf("};\n\nconst vg_lite_fill_t %s_fill_rules[%s_PATH_COUNT] =\n{\n",
+           opt.name, upper);
+    for (size_t g = 0; g < group_count; g++)
+    {
+        printf("    %s,\n", shapes[group_first[g]].even_odd ?
+               "VG_LITE_FILL_EVEN_ODD" : "VG_LITE_FILL_NON_ZERO");
+    }
+    printf("};\n\nvg_lite_path_t %s_paths[%s_PATH_COUNT] =\n{\n", opt.name, upper);
+    for (size_t g = 0; g < group_count; g++)
+    {
+        printf("    {\n"
+               "        .bounding_box = { %.3ff, %.3ff, %.3ff, %.3ff },\n"
+               "        .quality      = %s,\n"
+               "        .format       = %s,\n"
+               "        .path_length  = sizeof(%s_path_data%zu),\n"
+               "        .path         = (void *)%s_path_data%zu,\n"
+               "        .path_changed = 1\n"
+               "    },\n",
+               path_box[g][0], path_box[g][1], path_box[g][2], path_box[g][3],
+               opt.quality, path_format[g]->vg_format, opt.name, g, opt.name, g);
+    }
+    printf("};\n");
+
+    free(group_first);
+    free(path_format);
+    free(path_box);
+
+    printf("\n#if defined(__cplusplus)\n}\n#endif\n\n#endif /* %s */\n\n"
+           "/* [] END OF FILE */\n", guard);
+
+    fprintf(stderr, "%zu shape(s) in %zu path(s): %zu bytes, %zu bytes as S32\n",
+            shape_count, group_count, total_bytes, s32_bytes);
+
+    return EXIT_SUCCESS;
+}
+
+/* [] END OF FILE */
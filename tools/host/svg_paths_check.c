@@ -0,0 +1,225 @@
+/*******************************************************************************
+* File Name        : svg_paths_check.c
+*
+* Description      : Host check of the paths compiled by svg2vglite from
+*                    images/infineon_logo.svg: the outline matches the hand encoded logo
+*                    of proj_cm55 once the group transforms of the SVG are undone, the
+*                    bounds are exact and the data is smaller.
+*
+* Related Document : See README.md
+*
+********************************************************************************
+* Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include "vg_lite.h"
+#include "infineon_logo_paths.h"
+#include "infineon_logo_svg_paths.h"
+#include "host_check.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* Translation of the groups in the SVG, not applied by the hand encoding */
+#define SVG_OFFSET_X                        (-3.531f)
+#define SVG_OFFSET_Y                        (-354.655f)
+/* The hand encoding truncates every relative value, the error accumulates */
+#define MAX_DEVIATION                       (3.0f)
+#define MAX_POINTS                          (256U)
+
+
+/*******************************************************************************
+* Function Name: element
+********************************************************************************
+* Summary:
+*  Reads one element of path data.
+*
+* Parameters:
+*  path  - Path
+*  index - Element index
+*
+* Return:
+*  int32_t - Element value
+*
+*******************************************************************************/
+static int32_t element(const vg_lite_path_t *path, uint32_t index)
+{
+    switch (path->format)
+    {
+        case VG_LITE_S8:  return ((const int8_t *)path->path)[index];
+        case VG_LITE_S16: return ((const int16_t *)path->path)[index];
+        default:          return ((const int32_t *)path->path)[index];
+    }
+}
+
+/*******************************************************************************
+* Function Name: decode
+********************************************************************************
+* Summary:
+*  Decodes the end points of all segments and the control points of a path.
+*
+* Parameters:
+*  path   - Path
+*  ends   - Output end points
+*  max    - Size of ends
+*  hull   - Output bounds of all points, left, top, right, bottom
+*
+* Return:
+*  uint32_t - Number of end points
+*
+*******************************************************************************/
+static uint32_t decode(const vg_lite_path_t *path, float ends[][2], uint32_t max,
+                       float hull[4])
+{
+    uint32_t size = (VG_LITE_S8 == path->format) ? 1U :
+                    ((VG_LITE_S16 == path->format) ? 2U : 4U);
+    uint32_t length = path->path_length / size;
+    uint32_t count = 0U;
+    float current[2] = { 0.0f, 0.0f };
+    float start[2] = { 0.0f, 0.0f };
+
+    hull[0] = hull[1] = INFINITY;
+    hull[2] = hull[3] = -INFINITY;
+
+    for (uint32_t i = 0; i < length;)
+    {
+        int32_t op = element(path, i++);
+        uint32_t points = ((VLC_OP_CUBIC == op) || (VLC_OP_CUBIC_REL == op)) ? 3U :
+                          (((VLC_OP_QUAD == op) || (VLC_OP_QUAD_REL == op)) ? 2U :
+                          (((VLC_OP_END == op) || (VLC_OP_CLOSE == op)) ? 0U : 1U));
+        bool relative = (0 != (op & 1)) && (VLC_OP_CLOSE != op);
+        float p[2] = { 0.0f, 0.0f };
+
+        if (VLC_OP_END == op)
+        {
+            break;
+        }
+        if (VLC_OP_CLOSE == op)
+        {
+            current[0] = start[0];
+            current[1] = start[1];
+            continue;
+        }
+
+        for (uint32_t j = 0; j < points; j++)
+        {
+            p[0] = (float)element(path, i++) + (relative ? current[0] : 0.0f);
+            p[1] = (float)element(path, i++) + (relative ? current[1] : 0.0f);
+            hull[0] = fminf(hull[0], p[0]);
+            hull[1] = fminf(hull[1], p[1]);
+            hull[2] = fmaxf(hull[2], p[0]);
+            hull[3] = fmaxf(hull[3], p[1]);
+        }
+        current[0] = p[0];
+        current[1] = p[1];
+        if ((VLC_OP_MOVE == op) || (VLC_OP_MOVE_REL == op))
+        {
+            start[0] = p[0];
+            start[1] = p[1];
+        }
+        if (count < max)
+        {
+            ends[count][0] = p[0];
+            ends[count][1] = p[1];
+        }
+        count++;
+    }
+
+    return count;
+}
+
+/*******************************************************************************
+* Function Name: main
+********************************************************************************
+* Summary:
+*  Compares every compiled logo path with the hand encoded one.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  int - 0 if all checks passed
+*
+*******************************************************************************/
+int main(void)
+{
+    static float hand[MAX_POINTS][2];
+    static float compiled[MAX_POINTS][2];
+    uint32_t hand_bytes = 0U;
+    uint32_t compiled_bytes = 0U;
+
+    check(PATH_COUNT == INFINEON_LOGO_SVG_PATH_COUNT, "one path per fill color");
+
+    for (uint32_t i = 0; i < PATH_COUNT; i++)
+    {
+        const vg_lite_path_t *svg = &infineon_logo_svg_paths[i];
+        const float *box = svg->bounding_box;
+        float hand_hull[4];
+        float hull[4];
+        uint32_t hand_count = decode(&path[i], hand, MAX_POINTS, hand_hull);
+        uint32_t count = decode(svg, compiled, MAX_POINTS, hull);
+        float deviation = 0.0f;
+        bool inside = true;
+
+        printf("Path %u: %u segments, %u -> %u bytes, bounds %.1f,%.1f - %.1f,%.1f\r\n",
+               (unsigned int)i, (unsigned int)count, (unsigned int)path[i].path_length,
+               (unsigned int)svg->path_length, box[0], box[1], box[2], box[3]);
+
+        check((hand_count == count) && (count <= MAX_POINTS), "same number of segments");
+        for (uint32_t j = 0; (j < count) && (j < MAX_POINTS); j++)
+        {
+            deviation = fmaxf(deviation, fabsf(hand[j][0] - (compiled[j][0] - SVG_OFFSET_X)));
+            deviation = fmaxf(deviation, fabsf(hand[j][1] - (compiled[j][1] - SVG_OFFSET_Y)));
+            inside = inside && (compiled[j][0] >= box[0]) && (compiled[j][0] <= box[2]) &&
+                     (compiled[j][1] >= box[1]) && (compiled[j][1] <= box[3]);
+        }
+        printf("      max deviation from the hand encoding %.2f px\r\n", deviation);
+        check(deviation <= MAX_DEVIATION, "outline matches the hand encoding");
+        check(inside, "end points within the bounds");
+        check((box[0] >= hull[0]) && (box[1] >= hull[1]) && (box[2] <= hull[2]) &&
+              (box[3] <= hull[3]), "bounds within the control points");
+        check(svg->path_length < path[i].path_length, "smaller data");
+
+        hand_bytes += path[i].path_length;
+        compiled_bytes += svg->path_length;
+    }
+
+    printf("Logo data: %u bytes hand encoded, %u bytes compiled\r\n",
+           (unsigned int)hand_bytes, (unsigned int)compiled_bytes);
+    return check_summary();
+}
+
+/* [] END OF FILE */
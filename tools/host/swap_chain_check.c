@@ -0,0 +1,373 @@
+/*******************************************************************************
+* File Name        : swap_chain_check.c
+*
+* Description      : Host check of the swap chain at depths 2, 3 and 4 against a simulated
+*                    display controller interrupt: buffer reuse, presentation order, queue
+*                    depth and submit to scanout latency.
+*
+* Related Document : See README.md
+*
+********************************************************************************
+* Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "swap_chain.h"
+#include "host_check.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+/* 60 Hz refresh, one cycle is one nanosecond */
+#define VSYNC_PERIOD                        (16666667U)
+#define VSYNC_PERIOD_US                     (VSYNC_PERIOD / 1000U)
+/* Frames latched before the statistics are reset, to leave the start-up */
+#define WARMUP_FRAMES                       (8U)
+#define SIM_FRAMES                          (120U)
+
+/*******************************************************************************
+* Data Structures and Types
+*******************************************************************************/
+typedef struct {
+    uint32_t presented;         /* Frames latched by the simulated DC */
+    uint32_t latency_avg_us;    /* Submit to scanout time */
+    uint32_t latency_max_us;
+    uint32_t repeated_vsyncs;
+    uint32_t blocked_vsyncs;    /* Refreshes the render task waited for a buffer */
+    uint8_t  max_queued;
+    bool     reuse_ok;          /* No buffer acquired while queued or scanned out */
+    bool     order_ok;          /* Frames latched in submission order */
+} sim_result_t;
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+uint32_t gfx_port_sim_cycles;
+
+static swap_chain_t chain;
+
+/* Model of the display controller, kept apart from the swap chain state */
+static uint8_t programmed_slot;
+static uint8_t scanout_slot;
+static uint32_t presents;
+
+/* Frame number rendered into each slot */
+static uint32_t slot_frame[SWAP_CHAIN_MAX_DEPTH];
+
+
+/*******************************************************************************
+* Function Name: present
+********************************************************************************
+* Summary:
+*  Present callback, stands in for programming the DC frame buffer address.
+*
+* Parameters:
+*  slot      - Slot programmed
+*  user_data - Unused
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void present(uint8_t slot, void *user_data)
+{
+    (void)user_data;
+    programmed_slot = slot;
+    presents++;
+}
+
+/*******************************************************************************
+* Function Name: acquire_checked
+********************************************************************************
+* Summary:
+*  Acquires a buffer and checks that the display controller does not use it.
+*
+* Parameters:
+*  result  - Result updated on a reused buffer
+*
+* Return:
+*  uint8_t - Acquired slot or SWAP_CHAIN_INVALID_SLOT
+*
+*******************************************************************************/
+static uint8_t acquire_checked(sim_result_t *result)
+{
+    uint8_t slot = swap_chain_acquire(&chain);
+
+    if (SWAP_CHAIN_INVALID_SLOT != slot)
+    {
+        if ((slot == scanout_slot) || (slot == programmed_slot))
+        {
+            result->reuse_ok = false;
+        }
+        for (uint8_t i = 0U; i < chain.queue_count; i++)
+        {
+            if (slot == chain.queue[(chain.queue_head + i) % chain.depth])
+            {
+                result->reuse_ok = false;
+            }
+        }
+    }
+
+    return slot;
+}
+
+/*******************************************************************************
+* Function Name: simulate
+********************************************************************************
+* Summary:
+*  Runs a render task that takes render_ns per frame against a display
+*  controller that latches the programmed buffer at every refresh. The
+*  statistics cover the steady state after WARMUP_FRAMES.
+*
+* Parameters:
+*  depth     - Number of buffers
+*  render_ns - Render time of one frame
+*  result    - Output of the run
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void simulate(uint8_t depth, uint32_t render_ns, sim_result_t *result)
+{
+    swap_chain_stats_t stats;
+    uint32_t next_vsync = VSYNC_PERIOD;
+    uint32_t render_end;
+    uint32_t frame = 0U;
+    uint32_t last_latched = 0U;
+    uint8_t slot;
+    bool released;
+    bool warm = false;
+
+    gfx_port_sim_cycles = 0U;
+    programmed_slot = SWAP_CHAIN_INVALID_SLOT;
+    scanout_slot    = SWAP_CHAIN_INVALID_SLOT;
+    presents        = 0U;
+    result->reuse_ok = true;
+    result->order_ok = true;
+    result->blocked_vsyncs = 0U;
+    (void)swap_chain_init(&chain, depth, present, NULL);
+
+    slot = acquire_checked(result);
+    render_end = render_ns;
+
+    while (chain.stats.frames_presented < SIM_FRAMES)
+    {
+        if ((!warm) && (chain.stats.frames_presented >= WARMUP_FRAMES))
+        {
+            swap_chain_get_stats(&chain, &stats, true);
+            result->blocked_vsyncs = 0U;
+            warm = true;
+        }
+        if ((SWAP_CHAIN_INVALID_SLOT != slot) && ((int32_t)(next_vsync - render_end) > 0))
+        {
+            /* Render task: submit and start the next frame if a buffer is free */
+            gfx_port_sim_cycles = render_end;
+            slot_frame[slot] = ++frame;
+            swap_chain_submit(&chain, slot);
+            slot = acquire_checked(result);
+            render_end = gfx_port_sim_cycles + render_ns;
+        }
+        else
+        {
+            /* DC interrupt: the programmed buffer is now scanned out */
+            gfx_port_sim_cycles = next_vsync;
+            next_vsync += VSYNC_PERIOD;
+            if (SWAP_CHAIN_INVALID_SLOT != programmed_slot)
+            {
+                scanout_slot = programmed_slot;
+                programmed_slot = SWAP_CHAIN_INVALID_SLOT;
+                if (slot_frame[scanout_slot] != (last_latched + 1U))
+                {
+                    result->order_ok = false;
+                }
+                last_latched = slot_frame[scanout_slot];
+            }
+            released = swap_chain_on_vsync(&chain);
+
+            if (SWAP_CHAIN_INVALID_SLOT == slot)
+            {
+                result->blocked_vsyncs++;
+                if (released)
+                {
+                    slot = acquire_checked(result);
+                    render_end = gfx_port_sim_cycles + render_ns;
+                }
+            }
+        }
+    }
+
+    swap_chain_get_stats(&chain, &stats, false);
+    result->presented       = stats.frames_presented;
+    result->latency_avg_us  = stats.latency_sum_us / stats.frames_presented;
+    result->latency_max_us  = stats.latency_max_us;
+    result->repeated_vsyncs = stats.repeated_vsyncs;
+    result->max_queued      = stats.max_queued;
+}
+
+/*******************************************************************************
+* Function Name: check_depth
+********************************************************************************
+* Summary:
+*  Checks a fast and a slow render task at one depth.
+*
+* Parameters:
+*  depth       - Number of buffers
+*  fast_result - Output of the run with the fast render task
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void check_depth(uint8_t depth, sim_result_t *fast_result)
+{
+    sim_result_t slow;
+    uint32_t latency_us;
+    char name[64];
+
+    /* Render task four times faster than the display: the queue fills up */
+    simulate(depth, VSYNC_PERIOD / 4U, fast_result);
+    printf("Depth %u, fast: latency %5u us (max %5u us), queued %u, blocked %3u, repeated %u\r\n",
+           (unsigned int)depth, (unsigned int)fast_result->latency_avg_us,
+           (unsigned int)fast_result->latency_max_us, (unsigned int)fast_result->max_queued,
+           (unsigned int)fast_result->blocked_vsyncs, (unsigned int)fast_result->repeated_vsyncs);
+
+    (void)snprintf(name, sizeof(name), "depth %u: no buffer reused while displayed", depth);
+    check(fast_result->reuse_ok, name);
+    (void)snprintf(name, sizeof(name), "depth %u: frames latched in order", depth);
+    check(fast_result->order_ok, name);
+    (void)snprintf(name, sizeof(name), "depth %u: every buffer but the scanned out one queued",
+                   depth);
+    check((depth - 1U) == fast_result->max_queued, name);
+    (void)snprintf(name, sizeof(name), "depth %u: a new frame at every refresh", depth);
+    check(0U == fast_result->repeated_vsyncs, name);
+
+    /* A frame finished right after a refresh waits behind depth - 2 others
+     * and is latched depth - 1 refreshes after the one that freed its buffer */
+    latency_us = ((depth - 1U) * VSYNC_PERIOD_US) - (VSYNC_PERIOD_US / 4U);
+    (void)snprintf(name, sizeof(name), "depth %u: latency of the queued buffers", depth);
+    check((fast_result->latency_max_us <= latency_us + 1U) &&
+          (fast_result->latency_avg_us + 1U >= latency_us), name);
+
+    /* Render task slower than the display: frames are shown twice */
+    simulate(depth, (VSYNC_PERIOD * 3U) / 2U, &slow);
+    (void)snprintf(name, sizeof(name), "depth %u, slow: no buffer reused, in order", depth);
+    check(slow.reuse_ok && slow.order_ok, name);
+    (void)snprintf(name, sizeof(name), "depth %u, slow: refreshes repeated", depth);
+    check(slow.repeated_vsyncs >= (SIM_FRAMES / 3U), name);
+
+    /* With two buffers the next frame waits for the flip of the previous one */
+    (void)snprintf(name, sizeof(name), "depth %u, slow: blocked only when double buffered",
+                   depth);
+    check((2U == depth) ? (slow.blocked_vsyncs > 0U) : (0U == slow.blocked_vsyncs), name);
+    (void)snprintf(name, sizeof(name), "depth %u, slow: latched at the next refresh", depth);
+    check(slow.latency_max_us <= VSYNC_PERIOD_US, name);
+}
+
+/*******************************************************************************
+* Function Name: check_limits
+********************************************************************************
+* Summary:
+*  Checks the depth limits and acquisition of every buffer without a refresh.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void check_limits(void)
+{
+    uint8_t slot;
+    uint8_t acquired = 0U;
+
+    check(!swap_chain_init(&chain, SWAP_CHAIN_MIN_DEPTH - 1U, present, NULL) &&
+          !swap_chain_init(&chain, SWAP_CHAIN_MAX_DEPTH + 1U, present, NULL),
+          "depth outside the limits refused");
+
+    (void)swap_chain_init(&chain, 3U, present, NULL);
+    presents = 0U;
+    while (SWAP_CHAIN_INVALID_SLOT != (slot = swap_chain_acquire(&chain)))
+    {
+        swap_chain_submit(&chain, slot);
+        acquired++;
+    }
+    check(3U == acquired, "every buffer acquired before the first refresh");
+    check((1U == presents) && (3U == swap_chain_get_queued(&chain)),
+          "one flip programmed, the others queued");
+
+    swap_chain_submit(&chain, 0U);
+    check(3U == chain.stats.frames_submitted, "a queued buffer is not submitted twice");
+    check(!swap_chain_on_vsync(&chain) && (2U == presents),
+          "first refresh releases no buffer and programs the next one");
+    check(swap_chain_on_vsync(&chain), "second refresh releases the first buffer");
+}
+
+
+/*******************************************************************************
+* Function Name: main
+********************************************************************************
+* Summary:
+*  Runs the swap chain checks.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  int - 0 if all checks passed
+*
+*******************************************************************************/
+int main(void)
+{
+    sim_result_t results[SWAP_CHAIN_MAX_DEPTH + 1U];
+
+    check_limits();
+    for (uint8_t depth = SWAP_CHAIN_MIN_DEPTH; depth <= SWAP_CHAIN_MAX_DEPTH; depth++)
+    {
+        check_depth(depth, &results[depth]);
+    }
+
+    /* Each extra buffer queues one more refresh between render and scanout */
+    check((results[3].latency_avg_us > results[2].latency_avg_us) &&
+          (results[4].latency_avg_us > results[3].latency_avg_us),
+          "latency grows with the depth");
+    check((results[2].blocked_vsyncs == results[3].blocked_vsyncs) &&
+          (results[3].blocked_vsyncs == results[4].blocked_vsyncs),
+          "same frame rate at every depth when rendering is fast");
+
+    return check_summary();
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,120 @@
+/*******************************************************************************
+* File Name        : tess_probe_check.c
+*
+* Description      : Host check of the tessellation probe: buffer use and passes of single
+*                    draws, and the window height recommended by the calibration.
+*
+* Related Document : See README.md
+*
+********************************************************************************
+* Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "tess_probe.h"
+#include "host_check.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+#define WINDOW_WIDTH                        (832U)
+#define WINDOW_HEIGHT                       (480U)
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+static tess_probe_t probe;
+
+
+/*******************************************************************************
+* Function Name: main
+********************************************************************************
+* Summary:
+*  Runs the tessellation probe checks.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  int - 0 if all checks passed
+*
+*******************************************************************************/
+int main(void)
+{
+    const damage_rect_t logo = { 100, 100, 700, 300 };
+    const damage_rect_t screen = { 0, 0, 800, 480 };
+    const damage_rect_t icon = { 10, 10, 186, 186 };
+    const damage_rect_t empty = { 0, 0, 0, 0 };
+    tess_probe_stats_t stats;
+
+    /* Full height window: every draw in one pass */
+    tess_probe_init(&probe, WINDOW_WIDTH, WINDOW_HEIGHT);
+    tess_probe_record(&probe, &logo);
+    tess_probe_record(&probe, &screen);
+    tess_probe_record(&probe, &empty);
+    tess_probe_end_frame(&probe);
+    tess_probe_get_stats(&probe, &stats, true);
+    check((2U == stats.draws) && (2U == stats.passes) && (0U == stats.extra_passes),
+          "one pass per draw with a full height window");
+    check((WINDOW_HEIGHT * TESS_PROBE_BYTES_PER_ROW) == stats.peak_bytes,
+          "peak buffer use of a full screen draw");
+    check(1U == stats.frames, "frames counted");
+
+    /* 128 line window: the 480 line draw needs 4 passes, the 200 line one 2 */
+    tess_probe_init(&probe, WINDOW_WIDTH, 128U);
+    tess_probe_record(&probe, &logo);
+    tess_probe_record(&probe, &screen);
+    tess_probe_get_stats(&probe, &stats, true);
+    check((6U == stats.passes) && (4U == stats.extra_passes), "passes of a short window");
+    check((128U * TESS_PROBE_BYTES_PER_ROW) == stats.peak_bytes, "buffer use limited by the window");
+
+    /* Calibration without the full screen draw: 208 lines are enough */
+    tess_probe_init(&probe, WINDOW_WIDTH, WINDOW_HEIGHT);
+    check(WINDOW_HEIGHT == tess_probe_recommend(&probe), "no recommendation without draws");
+    tess_probe_record(&probe, &screen);
+    tess_probe_start_calibration(&probe);
+    tess_probe_record(&probe, &logo);
+    tess_probe_record(&probe, &icon);
+    tess_probe_stop_calibration(&probe);
+    tess_probe_record(&probe, &screen);
+    check(2U == probe.calibration_draws, "only draws during the calibration evaluated");
+    check(208U == tess_probe_recommend(&probe), "smallest window without extra passes");
+    check((5U == probe.candidate_extra[3]) && (0U == probe.candidate_extra[12]),
+          "extra passes per candidate");
+    tess_probe_report(&probe);
+
+    return check_summary();
+}
+
+/* [] END OF FILE */
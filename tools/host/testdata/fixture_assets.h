@@ -0,0 +1,341 @@
+/*******************************************************************************
+* Generated by tools/host/img2vglite from testdata/assets.txt, do not edit.
+* Defines the pixel data, include it in one source file only.
+*******************************************************************************/
+
+#ifndef FIXTURE_ASSETS_H
+#define FIXTURE_ASSETS_H
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+#include <stdint.h>
+#include "image_asset.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+#define FIXTURE_ASSETS_COUNT                (8U)
+#define FIXTURE_ASSETS_STRIDE_ALIGN         (16U)
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+/* Color lookup table of the 8 bit indexed images, 0xAARRGGBB premultiplied,
+ * entry 0 is transparent */
+const uint32_t fixture_assets_clut8[256U] =
+{
+    0x00000000U, 0x80404040U, 0xFF000000U, 0xFF404040U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U,
+    0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U,
+    0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U,
+    0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U,
+    0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U,
+    0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U,
+    0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U,
+    0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U,
+    0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U,
+    0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U,
+    0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U,
+    0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U,
+    0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U,
+    0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U,
+    0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U,
+    0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U,
+    0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U,
+    0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U,
+    0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U,
+    0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U,
+    0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U,
+    0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U,
+    0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U,
+    0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U,
+    0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U,
+    0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U,
+    0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U,
+    0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U,
+    0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U,
+    0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U,
+    0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U,
+    0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U,
+};
+
+/* Color lookup table of the 4 bit indexed images, 0xAARRGGBB,
+ * entry 0 is transparent */
+const uint32_t fixture_assets_clut4[16U] =
+{
+    0x00000000U, 0x8000FF00U, 0xFFFF0000U, 0xFFFFFFFFU, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U,
+    0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U,
+};
+
+/* rgba.png, 3x5 VG_LITE_ARGB8888, stride 16 */
+CY_SECTION(".cy_socmem_data") uint8_t rgba_straight_pixels[] __attribute__((aligned(128))) =
+{
+    0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0x80, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x1E, 0x14, 0x0A, 0x28, 0x32, 0x64, 0xC8, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xFF, 0x80, 0x80, 0x80, 0x40, 0x00, 0x80, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00,
+    0x33, 0x22, 0x11, 0x44, 0x77, 0x66, 0x55, 0x88, 0xBB, 0xAA, 0x99, 0xCC, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0x02, 0x01, 0x04, 0x09, 0x05, 0xFA, 0x80, 0x00, 0x00, 0x00, 0x00,
+};
+
+const image_asset_t rgba_straight_asset =
+{
+    .name          = "rgba_straight",
+    .format        = VG_LITE_ARGB8888,
+    .width         = 3,
+    .height        = 5,
+    .stride        = 16,
+    .data          = rgba_straight_pixels,
+    .clut          = NULL,
+    .clut_count    = 0U,
+    .tint          = 0x00000000U,
+    .premultiplied = false,
+    .next_level    = NULL
+};
+
+/* rgba.png, 3x5 VG_LITE_ARGB8888, stride 16, premultiplied */
+CY_SECTION(".cy_socmem_data") uint8_t rgba_premul_pixels[] __attribute__((aligned(128))) =
+{
+    0x00, 0x00, 0xFF, 0xFF, 0x00, 0x80, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x05, 0x03, 0x02, 0x28, 0x32, 0x64, 0xC8, 0xFF, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xFF, 0x20, 0x20, 0x20, 0x40, 0x00, 0x60, 0xC0, 0xC0, 0x00, 0x00, 0x00, 0x00,
+    0x0E, 0x09, 0x05, 0x44, 0x3F, 0x36, 0x2D, 0x88, 0x96, 0x88, 0x7A, 0xCC, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x04, 0x05, 0x03, 0x7D, 0x80, 0x00, 0x00, 0x00, 0x00,
+};
+
+const image_asset_t rgba_premul_asset =
+{
+    .name          = "rgba_premul",
+    .format        = VG_LITE_ARGB8888,
+    .width         = 3,
+    .height        = 5,
+    .stride        = 16,
+    .data          = rgba_premul_pixels,
+    .clut          = NULL,
+    .clut_count    = 0U,
+    .tint          = 0x00000000U,
+    .premultiplied = true,
+    .next_level    = NULL
+};
+
+/* rgba.png, 3x5 VG_LITE_A4, stride 16 */
+CY_SECTION(".cy_socmem_data") uint8_t rgba_alpha_pixels[] __attribute__((aligned(128))) =
+{
+    0x8F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xF2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x4F, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x84, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0F, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+const image_asset_t rgba_alpha_asset =
+{
+    .name          = "rgba_alpha",
+    .format        = VG_LITE_A4,
+    .width         = 3,
+    .height        = 5,
+    .stride        = 16,
+    .data          = rgba_alpha_pixels,
+    .clut          = NULL,
+    .clut_count    = 0U,
+    .tint          = 0xFF4A699FU,
+    .premultiplied = false,
+    .next_level    = NULL
+};
+
+/* palette.png, 5x1 VG_LITE_INDEX_4, stride 16 */
+CY_SECTION(".cy_socmem_data") uint8_t palette_pixels[] __attribute__((aligned(128))) =
+{
+    0x12, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+const image_asset_t palette_asset =
+{
+    .name          = "palette",
+    .format        = VG_LITE_INDEX_4,
+    .width         = 5,
+    .height        = 1,
+    .stride        = 16,
+    .data          = palette_pixels,
+    .clut          = fixture_assets_clut4,
+    .clut_count    = 16U,
+    .tint          = 0x00000000U,
+    .premultiplied = false,
+    .next_level    = NULL
+};
+
+/* gray.png, 2x2 VG_LITE_A8, stride 16 */
+CY_SECTION(".cy_socmem_data") uint8_t gray_pixels[] __attribute__((aligned(128))) =
+{
+    0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+const image_asset_t gray_asset =
+{
+    .name          = "gray",
+    .format        = VG_LITE_A8,
+    .width         = 2,
+    .height        = 2,
+    .stride        = 16,
+    .data          = gray_pixels,
+    .clut          = NULL,
+    .clut_count    = 0U,
+    .tint          = 0xFF333333U,
+    .premultiplied = false,
+    .next_level    = NULL
+};
+
+/* rgb.png, 3x1 VG_LITE_BGR565, stride 16 */
+CY_SECTION(".cy_socmem_data") uint8_t rgb_pixels[] __attribute__((aligned(128))) =
+{
+    0x00, 0xF8, 0xE0, 0x07, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+const image_asset_t rgb_asset =
+{
+    .name          = "rgb",
+    .format        = VG_LITE_BGR565,
+    .width         = 3,
+    .height        = 1,
+    .stride        = 16,
+    .data          = rgb_pixels,
+    .clut          = NULL,
+    .clut_count    = 0U,
+    .tint          = 0x00000000U,
+    .premultiplied = false,
+    .next_level    = NULL
+};
+
+/* gray.png, 2x2 VG_LITE_INDEX_8, stride 16, premultiplied */
+CY_SECTION(".cy_socmem_data") uint8_t gray_index_pixels[] __attribute__((aligned(128))) =
+{
+    0x02, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+const image_asset_t gray_index_asset =
+{
+    .name          = "gray_index",
+    .format        = VG_LITE_INDEX_8,
+    .width         = 2,
+    .height        = 2,
+    .stride        = 16,
+    .data          = gray_index_pixels,
+    .clut          = fixture_assets_clut8,
+    .clut_count    = 256U,
+    .tint          = 0x00000000U,
+    .premultiplied = true,
+    .next_level    = NULL
+};
+
+/* rgba.png, 1x1 VG_LITE_ARGB8888, stride 16, premultiplied */
+CY_SECTION(".cy_socmem_data") uint8_t rgba_mipmap_level3_pixels[] __attribute__((aligned(128))) =
+{
+    0x30, 0x3A, 0x64, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+const image_asset_t rgba_mipmap_level3_asset =
+{
+    .name          = "rgba_mipmap_level3",
+    .format        = VG_LITE_ARGB8888,
+    .width         = 1,
+    .height        = 1,
+    .stride        = 16,
+    .data          = rgba_mipmap_level3_pixels,
+    .clut          = NULL,
+    .clut_count    = 0U,
+    .tint          = 0x00000000U,
+    .premultiplied = true,
+    .next_level    = NULL
+};
+
+/* rgba.png, 1x2 VG_LITE_ARGB8888, stride 16, premultiplied */
+CY_SECTION(".cy_socmem_data") uint8_t rgba_mipmap_level2_pixels[] __attribute__((aligned(128))) =
+{
+    0x1D, 0x32, 0x49, 0x7D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x42, 0x41, 0x7F, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+const image_asset_t rgba_mipmap_level2_asset =
+{
+    .name          = "rgba_mipmap_level2",
+    .format        = VG_LITE_ARGB8888,
+    .width         = 1,
+    .height        = 2,
+    .stride        = 16,
+    .data          = rgba_mipmap_level2_pixels,
+    .clut          = NULL,
+    .clut_count    = 0U,
+    .tint          = 0x00000000U,
+    .premultiplied = true,
+    .next_level    = &rgba_mipmap_level3_asset
+};
+
+/* rgba.png, 2x3 VG_LITE_ARGB8888, stride 16, premultiplied */
+CY_SECTION(".cy_socmem_data") uint8_t rgba_mipmap_level1_pixels[] __attribute__((aligned(128))) =
+{
+    0x0E, 0x3A, 0x73, 0xAA, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x1B, 0x18, 0x15, 0x83, 0x4B, 0x74, 0x9D, 0xC6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x80, 0x80, 0x80, 0x82, 0x05, 0x03, 0x7D, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+const image_asset_t rgba_mipmap_level1_asset =
+{
+    .name          = "rgba_mipmap_level1",
+    .format        = VG_LITE_ARGB8888,
+    .width         = 2,
+    .height        = 3,
+    .stride        = 16,
+    .data          = rgba_mipmap_level1_pixels,
+    .clut          = NULL,
+    .clut_count    = 0U,
+    .tint          = 0x00000000U,
+    .premultiplied = true,
+    .next_level    = &rgba_mipmap_level2_asset
+};
+
+/* rgba.png, 3x5 VG_LITE_ARGB8888, stride 16, premultiplied */
+CY_SECTION(".cy_socmem_data") uint8_t rgba_mipmap_pixels[] __attribute__((aligned(128))) =
+{
+    0x00, 0x00, 0xFF, 0xFF, 0x00, 0x80, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x05, 0x03, 0x02, 0x28, 0x32, 0x64, 0xC8, 0xFF, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xFF, 0x20, 0x20, 0x20, 0x40, 0x00, 0x60, 0xC0, 0xC0, 0x00, 0x00, 0x00, 0x00,
+    0x0E, 0x09, 0x05, 0x44, 0x3F, 0x36, 0x2D, 0x88, 0x96, 0x88, 0x7A, 0xCC, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x04, 0x05, 0x03, 0x7D, 0x80, 0x00, 0x00, 0x00, 0x00,
+};
+
+const image_asset_t rgba_mipmap_asset =
+{
+    .name          = "rgba_mipmap",
+    .format        = VG_LITE_ARGB8888,
+    .width         = 3,
+    .height        = 5,
+    .stride        = 16,
+    .data          = rgba_mipmap_pixels,
+    .clut          = NULL,
+    .clut_count    = 0U,
+    .tint          = 0x00000000U,
+    .premultiplied = true,
+    .next_level    = &rgba_mipmap_level1_asset
+};
+
+const image_asset_t *const fixture_assets[FIXTURE_ASSETS_COUNT] =
+{
+    &rgba_straight_asset,
+    &rgba_premul_asset,
+    &rgba_alpha_asset,
+    &palette_asset,
+    &gray_asset,
+    &rgb_asset,
+    &gray_index_asset,
+    &rgba_mipmap_asset,
+};
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* FIXTURE_ASSETS_H */
+
+/* [] END OF FILE */
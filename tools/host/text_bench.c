@@ -0,0 +1,215 @@
+/*******************************************************************************
+* File Name        : text_bench.c
+*
+* Description      : Host benchmark of the text engine: glyph lookup, layout of a changed
+*                    string and issuing the blits of a laid out run, in nanoseconds per
+*                    glyph, with the blits saved by merging spans.
+*
+* Related Document : See README.md
+*
+********************************************************************************
+* Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "gfx_port.h"
+#include "text_engine.h"
+#include "vg_lite_stub.h"
+
+/* The pixel data is placed in SOCMEM on the device */
+#define CY_SECTION(name)
+#include "mono16_font.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+#define SCREEN_WIDTH                        (800)
+#define SCREEN_HEIGHT                       (480)
+#define DEFAULT_ITERATIONS                  (100000U)
+#define STRING_COUNT                        (2U)
+
+/*******************************************************************************
+* Data Structures and Types
+*******************************************************************************/
+typedef struct {
+    const char *name;
+    const char *text[STRING_COUNT];     /* Alternated to force a new layout */
+} bench_case_t;
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+static vg_lite_buffer_t target = { .width = SCREEN_WIDTH, .height = SCREEN_HEIGHT,
+                                   .stride = SCREEN_WIDTH * 4, .format = VG_LITE_ARGB8888,
+                                   .address = 0x1000U };
+
+static const bench_case_t bench_cases[] =
+{
+    { "caption",  { "Alpha behavior: source over, multiply",
+                    "Pattern fill: vg_lite_draw_pattern()" } },
+    { "counter",  { "FPS: 59.940 | 1234 frames", "FPS: 60.012 | 1235 frames" } },
+    { "alphabet", { "abcdefghijklmnopqrstuvwxyz", "ABCDEFGHIJKLMNOPQRSTUVWXYZ" } },
+};
+
+static text_font_t font;
+static uint32_t iterations = DEFAULT_ITERATIONS;
+
+
+/*******************************************************************************
+* Function Name: glyph_total
+********************************************************************************
+* Summary:
+*  Returns the number of glyphs with ink of the strings of a case.
+*
+* Parameters:
+*  c        - Benchmark case
+*
+* Return:
+*  uint32_t - Glyphs drawn for one layout of each string
+*
+*******************************************************************************/
+static uint32_t glyph_total(const bench_case_t *c)
+{
+    text_run_t run;
+    uint32_t glyphs = 0U;
+
+    text_run_init(&run, &font);
+    for (uint32_t s = 0; s < STRING_COUNT; s++)
+    {
+        (void)text_run_set(&run, c->text[s]);
+        glyphs += run.glyph_count;
+    }
+
+    return glyphs;
+}
+
+/*******************************************************************************
+* Function Name: bench_case
+********************************************************************************
+* Summary:
+*  Times glyph lookup, layout and blit issue for the strings of one case and
+*  prints the time per glyph.
+*
+* Parameters:
+*  c      - Benchmark case
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void bench_case(const bench_case_t *c)
+{
+    text_run_t run;
+    text_stats_t stats;
+    vg_lite_stub_stats_t calls;
+    vg_lite_matrix_t matrix;
+    uint32_t characters = (uint32_t)(strlen(c->text[0]) + strlen(c->text[1]));
+    uint32_t glyphs = glyph_total(c);
+    uint32_t lookup_cycles;
+    uint32_t start;
+    volatile uint32_t sink = 0U;
+
+    start = gfx_port_cycles();
+    for (uint32_t n = 0; n < iterations; n++)
+    {
+        for (const char *p = c->text[n & 1U]; '\0' != *p; p++)
+        {
+            sink += text_font_glyph(&font, *p)->x;
+        }
+    }
+    lookup_cycles = gfx_port_cycles() - start;
+    (void)sink;
+
+    text_run_init(&run, &font);
+    vg_lite_identity(&matrix);
+    text_get_stats(&stats, true);
+    vg_lite_stub_get_stats(&calls, true);
+    for (uint32_t n = 0; n < iterations; n++)
+    {
+        (void)text_run_set(&run, c->text[n & 1U]);
+        (void)text_run_draw(&run, &target, &matrix, 0xFF000000U);
+    }
+    text_get_stats(&stats, true);
+    vg_lite_stub_get_stats(&calls, true);
+
+    printf("%-10s %6.1f ns/char lookup %6.1f ns/glyph layout %6.1f ns/glyph draw"
+           " %5.2f blits/glyph (%u blits for %u glyphs)\r\n",
+           c->name, (double)lookup_cycles * STRING_COUNT / ((double)iterations * characters),
+           (double)stats.layout_cycles / stats.glyphs, (double)stats.draw_cycles / stats.glyphs,
+           (double)calls.blit_rect / stats.glyphs,
+           (unsigned int)(calls.blit_rect * STRING_COUNT / iterations), (unsigned int)glyphs);
+}
+
+/*******************************************************************************
+* Function Name: main
+********************************************************************************
+* Summary:
+*  Runs every case for the number of iterations given on the command line.
+*
+* Parameters:
+*  argc, argv - Optional iteration count
+*
+* Return:
+*  int        - 0 on success
+*
+*******************************************************************************/
+int main(int argc, char *argv[])
+{
+    if (argc > 1)
+    {
+        iterations = (uint32_t)strtoul(argv[1], NULL, 0);
+    }
+    if (0U == iterations)
+    {
+        iterations = DEFAULT_ITERATIONS;
+    }
+    iterations = (iterations + 1U) & ~1U;
+
+    if (!text_font_init(&font, &mono16_font))
+    {
+        return EXIT_FAILURE;
+    }
+    printf("Font: %s, %ux%u atlas, %u iterations\r\n", mono16_font.name,
+           (unsigned int)font.atlas.width, (unsigned int)font.atlas.height, iterations);
+
+    for (size_t i = 0; i < (sizeof(bench_cases) / sizeof(bench_cases[0])); i++)
+    {
+        bench_case(&bench_cases[i]);
+    }
+
+    return EXIT_SUCCESS;
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,320 @@
+/*******************************************************************************
+* File Name        : text_engine_check.c
+*
+* Description      : Host check of the text engine: atlas setup from the prepared font,
+*                    glyph lookup and replacement, span merging and layout caching of text
+*                    runs, the blits issued per run and text nodes in the scene graph.
+*
+* Related Document : See README.md
+*
+********************************************************************************
+* Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "text_engine.h"
+#include "scene_graph.h"
+#include "vg_lite_stub.h"
+
+/* The pixel data is placed in SOCMEM on the device */
+#define CY_SECTION(name)
+#include "mono16_font.h"
+#include "host_check.h"
+
+/*******************************************************************************
+* Macros
+*******************************************************************************/
+#define SCREEN_WIDTH                        (800)
+#define SCREEN_HEIGHT                       (480)
+#define LOG_SIZE                            (4U)
+/* Antialiasing margin added by damage_rect_transform() */
+#define BOUNDS_PADDING                      (1)
+
+/*******************************************************************************
+* Data Structures and Types
+*******************************************************************************/
+typedef struct {
+    const char *text;
+    uint8_t spans;
+    uint8_t glyphs;
+    const char *name;
+} layout_case_t;
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+static vg_lite_buffer_t frame = { .width = SCREEN_WIDTH, .height = SCREEN_HEIGHT,
+                                  .stride = SCREEN_WIDTH * 4, .format = VG_LITE_ARGB8888,
+                                  .address = 0x10000U };
+
+static const layout_case_t layout_cases[] =
+{
+    { "ABC",    1U, 3U, "Neighbours in the atlas drawn as one span" },
+    { "0123",   1U, 4U, "Digits in order drawn as one span" },
+    { "CBA",    3U, 3U, "Glyphs apart in the atlas drawn as separate spans" },
+    { "A B",    2U, 2U, "Blank glyphs break spans and are not drawn" },
+    { "_`",     2U, 2U, "Spans do not cross atlas rows" },
+    { "   ",    0U, 0U, "Blank run draws nothing" },
+    { "",       0U, 0U, "Empty run" },
+};
+
+/*******************************************************************************
+* Function Name: check_font
+********************************************************************************
+* Summary:
+*  Checks the atlas buffer set up from the prepared font, the rejection of
+*  unusable atlases and the glyph lookup.
+*
+* Parameters:
+*  font - Font, set up from mono16
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void check_font(text_font_t *font)
+{
+    text_font_t broken;
+    image_asset_t atlas = mono16_atlas;
+    font_asset_t asset = mono16_font;
+    const font_glyph_t *replacement;
+
+    check(text_font_init(font, &mono16_font) && (VG_LITE_A8 == font->atlas.format) &&
+          (VG_LITE_MULTIPLY_IMAGE_MODE == font->atlas.image_mode) &&
+          (font->atlas.memory == mono16_pixels), "Atlas set up as A8 coverage");
+
+    asset.atlas = &atlas;
+    atlas.format = VG_LITE_L8;
+    check(!text_font_init(&broken, &asset), "Atlas of another format rejected");
+    atlas = mono16_atlas;
+    atlas.data = &mono16_pixels[1];
+    check(!text_font_init(&broken, &asset), "Misaligned atlas rejected");
+
+    replacement = &mono16_glyphs[TEXT_REPLACEMENT_CHAR - mono16_font.first_char];
+    check(text_font_glyph(font, 'A') == &mono16_glyphs['A' - mono16_font.first_char],
+          "Glyph found by code point");
+    check((text_font_glyph(font, '\t') == replacement) &&
+          (text_font_glyph(font, (char)0xE9) == replacement),
+          "Missing characters replaced");
+    check(!text_font_glyph(font, ' ')->ink && text_font_glyph(font, '#')->ink,
+          "Blank glyphs have no ink");
+}
+
+/*******************************************************************************
+* Function Name: check_layout
+********************************************************************************
+* Summary:
+*  Checks the spans of each layout case and that an unchanged string is not
+*  laid out again.
+*
+* Parameters:
+*  font - Font
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void check_layout(text_font_t *font)
+{
+    text_run_t run;
+    text_stats_t stats;
+    char long_text[TEXT_RUN_MAX_LENGTH + 8U];
+    int32_t advance = mono16_glyphs[0].advance;
+
+    text_run_init(&run, font);
+    for (size_t i = 0; i < (sizeof(layout_cases) / sizeof(layout_cases[0])); i++)
+    {
+        const layout_case_t *c = &layout_cases[i];
+
+        (void)text_run_set(&run, c->text);
+        check((c->spans == run.span_count) && (c->glyphs == run.glyph_count) &&
+              (run.width == ((int32_t)strlen(c->text) * advance)), c->name);
+    }
+
+    (void)text_run_set(&run, "A B");
+    check((0 == run.spans[0].x) && ((2 * advance) == run.spans[1].x) &&
+          (advance == run.spans[1].cells.width) && (mono16_font.line_height == run.spans[1].cells.height),
+          "Spans placed at their pen position");
+
+    text_get_stats(&stats, true);
+    check(!text_run_set(&run, "A B") && text_run_set(&run, "A C"), "Only changed strings reported");
+    text_get_stats(&stats, true);
+    check(1U == stats.layouts, "Unchanged string not laid out again");
+
+    memset(long_text, 'x', sizeof(long_text) - 1U);
+    long_text[sizeof(long_text) - 1U] = '\0';
+    (void)text_run_set(&run, long_text);
+    check((TEXT_RUN_MAX_LENGTH == strlen(run.text)) &&
+          (run.width == ((int32_t)TEXT_RUN_MAX_LENGTH * advance)), "Long strings truncated");
+}
+
+/*******************************************************************************
+* Function Name: check_draw
+********************************************************************************
+* Summary:
+*  Checks that a run is drawn with one blit per span, each offset by its pen
+*  position along the x axis of the run matrix.
+*
+* Parameters:
+*  font - Font
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void check_draw(text_font_t *font)
+{
+    vg_lite_stub_call_t logged[LOG_SIZE];
+    text_run_t run;
+    text_stats_t stats;
+    vg_lite_matrix_t matrix;
+    vg_lite_matrix_t expected;
+    vg_lite_rectangle_t cells;
+    uint32_t count;
+
+    text_run_init(&run, font);
+    (void)text_run_set(&run, "AB CD");
+    text_get_stats(&stats, true);
+    (void)vg_lite_stub_get_log(logged, LOG_SIZE, true);
+
+    vg_lite_identity(&matrix);
+    vg_lite_translate(100.0f, 50.0f, &matrix);
+    vg_lite_scale(2.0f, 2.0f, &matrix);
+    check(VG_LITE_SUCCESS == text_run_draw(&run, &frame, &matrix, 0xFF0000FFU), "Run drawn");
+
+    expected = matrix;
+    vg_lite_translate((float)run.spans[1].x, 0.0f, &expected);
+    cells = run.spans[1].cells;
+    (void)vg_lite_blit_rect(&frame, &font->atlas, &cells, &expected, VG_LITE_BLEND_SRC_OVER,
+                            0xFF0000FFU, VG_LITE_FILTER_POINT);
+    count = vg_lite_stub_get_log(logged, LOG_SIZE, true);
+    check((3U == count) && (VG_LITE_STUB_BLIT_RECT == logged[0].op) &&
+          (logged[1].args_hash == logged[2].args_hash),
+          "One blit per span, offset along the run");
+
+    text_get_stats(&stats, true);
+    check((4U == stats.glyphs) && (2U == stats.blits) && (0U == stats.layouts),
+          "Glyphs and blits counted");
+}
+
+/*******************************************************************************
+* Function Name: check_scene
+********************************************************************************
+* Summary:
+*  Checks a text node: bounds of the run, one draw command and a new
+*  fingerprint and dirty state only when the string changes.
+*
+* Parameters:
+*  font - Font
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void check_scene(text_font_t *font)
+{
+    scene_node_t root;
+    scene_node_t caption;
+    scene_graph_t graph;
+    scene_fingerprint_t fp;
+    scene_graph_stats_t graph_stats;
+    text_run_t run;
+    text_stats_t stats;
+    vg_lite_matrix_t local;
+    uint32_t before;
+
+    text_run_init(&run, font);
+    scene_node_init_group(&root);
+    scene_node_init_text(&caption, &run, 0xFF000000U);
+    scene_node_set_text(&caption, "Caption");
+    vg_lite_identity(&local);
+    vg_lite_translate(8.0f, 8.0f, &local);
+    scene_node_set_transform(&caption, &local);
+    scene_node_add_child(&root, &caption);
+    scene_graph_init(&graph, &root);
+    scene_graph_update(&graph);
+    check((caption.bounds.x0 == (8 - BOUNDS_PADDING)) &&
+          ((caption.bounds.x1 - caption.bounds.x0) == (run.width + (2 * BOUNDS_PADDING))) &&
+          ((caption.bounds.y1 - caption.bounds.y0) == (run.height + (2 * BOUNDS_PADDING))),
+          "Bounds of the run");
+
+    scene_graph_get_stats(&graph, &graph_stats, true);
+    text_get_stats(&stats, true);
+    check(VG_LITE_SUCCESS == scene_graph_draw(&graph, &frame, NULL), "Text node drawn");
+    scene_graph_get_stats(&graph, &graph_stats, true);
+    text_get_stats(&stats, true);
+    check(1U == graph_stats.draw_calls, "Run drawn as one command");
+    check(stats.blits == run.span_count, "Node draws the spans of the run");
+
+    scene_fingerprint_begin(&fp, 0U);
+    scene_graph_fingerprint(&graph, &fp);
+    before = fp.hash;
+    scene_node_set_text(&caption, "Caption");
+    check(!caption.dirty, "Unchanged string leaves the node clean");
+    scene_node_set_text(&caption, "Caption 2");
+    check(caption.dirty, "Changed string marks the node dirty");
+    scene_graph_update(&graph);
+    scene_fingerprint_begin(&fp, 0U);
+    scene_graph_fingerprint(&graph, &fp);
+    check(before != fp.hash, "Changed string changes the fingerprint");
+}
+
+/*******************************************************************************
+* Function Name: main
+********************************************************************************
+* Summary:
+*  Runs the text engine checks.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  int - 0 if all checks passed
+*
+*******************************************************************************/
+int main(void)
+{
+    text_font_t font;
+
+    check_font(&font);
+    check_layout(&font);
+    check_draw(&font);
+    check_scene(&font);
+
+    return check_summary();
+}
+
+/* [] END OF FILE */